@@ -10,5 +10,6 @@ JTEST_DECLARE_GROUP(cmplx_mag_tests);
 JTEST_DECLARE_GROUP(cmplx_mag_squared_tests);
 JTEST_DECLARE_GROUP(cmplx_mult_cmplx_tests);
 JTEST_DECLARE_GROUP(cmplx_mult_real_tests);
+JTEST_DECLARE_GROUP(cmplx_planar_tests);
 
 #endif /* _COMPLEX_MATH_TESTS_H_ */
@@ -5,11 +5,14 @@
 /* Test/Group Declarations */
 /*--------------------------------------------------------------------------------*/
 
+JTEST_DECLARE_GROUP(adaptive_tests);
 JTEST_DECLARE_GROUP(biquad_tests);
 JTEST_DECLARE_GROUP(conv_tests);
+JTEST_DECLARE_GROUP(correlate_lags_tests);
 JTEST_DECLARE_GROUP(correlate_tests);
 JTEST_DECLARE_GROUP(fir_tests);
 JTEST_DECLARE_GROUP(iir_tests);
 JTEST_DECLARE_GROUP(lms_tests);
+JTEST_DECLARE_GROUP(resample_tests);
 
 #endif /* _FILTERING_TESTS_H_ */
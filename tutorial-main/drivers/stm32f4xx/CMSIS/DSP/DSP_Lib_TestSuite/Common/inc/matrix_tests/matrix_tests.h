@@ -13,5 +13,6 @@ JTEST_DECLARE_GROUP(mat_mult_fast_tests);
 JTEST_DECLARE_GROUP(mat_sub_tests);
 JTEST_DECLARE_GROUP(mat_trans_tests);
 JTEST_DECLARE_GROUP(mat_scale_tests);
+JTEST_DECLARE_GROUP(mat_solve_tests);
 
 #endif /* _MATRIX_TESTS_H_ */
@@ -4,6 +4,7 @@
 /*--------------------------------------------------------------------------------*/
 /* Test/Group Declarations */
 /*--------------------------------------------------------------------------------*/
+JTEST_DECLARE_GROUP(convert_tests);
 JTEST_DECLARE_GROUP(copy_tests);
 JTEST_DECLARE_GROUP(fill_tests);
 JTEST_DECLARE_GROUP(x_to_y_tests);
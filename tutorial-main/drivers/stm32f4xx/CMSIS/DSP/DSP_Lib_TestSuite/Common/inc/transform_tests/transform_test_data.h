@@ -14,6 +14,8 @@
 
 #define TRANSFORM_MAX_FFT_LEN 4096
 #define TRANFORM_BIGGEST_INPUT_TYPE float32_t
+#define TRANSFORM_STFT_MAX_FFT_LEN 1024
+#define TRANSFORM_STFT_FRAMES 6
 
 /*--------------------------------------------------------------------------------*/
 /* Variable Declarations */
@@ -38,6 +40,8 @@ ARR_DESC_DECLARE(transform_radix2_fftlens);
 ARR_DESC_DECLARE(transform_radix4_fftlens);
 ARR_DESC_DECLARE(transform_rfft_fftlens);
 ARR_DESC_DECLARE(transform_rfft_fast_fftlens);
+ARR_DESC_DECLARE(transform_stft_fftlens);
+ARR_DESC_DECLARE(transform_stft_hop_divisors);
 ARR_DESC_DECLARE(transform_dct_fftlens);
 
 /* CFFT Structs */
@@ -7,7 +7,9 @@
 JTEST_DECLARE_GROUP(cfft_tests);
 JTEST_DECLARE_GROUP(cfft_family_tests);
 JTEST_DECLARE_GROUP(dct4_tests);
+JTEST_DECLARE_GROUP(fft_bfp_tests);
 JTEST_DECLARE_GROUP(rfft_tests);
 JTEST_DECLARE_GROUP(rfft_fast_tests);
+JTEST_DECLARE_GROUP(stft_tests);
 
 #endif /* _TRANSFORM_TESTS_H_ */
@@ -0,0 +1,398 @@
+#include "jtest.h"
+#include "complex_math_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "complex_math_templates.h"
+#include "type_abbrev.h"
+#include <math.h>
+
+/*--------------------------------------------------------------------------------*/
+/* Buffers */
+/*--------------------------------------------------------------------------------*/
+
+/* Longest vector, override up to 65536 to run the whole benchmark */
+#ifndef COMPLEX_MATH_PLANAR_MAX_LEN
+#define COMPLEX_MATH_PLANAR_MAX_LEN 1024
+#endif
+
+/* Vector lengths, those above COMPLEX_MATH_PLANAR_MAX_LEN are skipped */
+static const uint32_t cmplx_planar_lens[] = {37, 256, 1024, 4096, 16384, 65536};
+
+/* Planar inputs and outputs */
+static float32_t cmplx_planar_a_re[COMPLEX_MATH_PLANAR_MAX_LEN];
+static float32_t cmplx_planar_a_im[COMPLEX_MATH_PLANAR_MAX_LEN];
+static float32_t cmplx_planar_b_re[COMPLEX_MATH_PLANAR_MAX_LEN];
+static float32_t cmplx_planar_b_im[COMPLEX_MATH_PLANAR_MAX_LEN];
+static float32_t cmplx_planar_d_re[COMPLEX_MATH_PLANAR_MAX_LEN];
+static float32_t cmplx_planar_d_im[COMPLEX_MATH_PLANAR_MAX_LEN];
+
+/* The same vectors interleaved */
+static float32_t cmplx_planar_a[2 * COMPLEX_MATH_PLANAR_MAX_LEN];
+static float32_t cmplx_planar_b[2 * COMPLEX_MATH_PLANAR_MAX_LEN];
+static float32_t cmplx_planar_d[2 * COMPLEX_MATH_PLANAR_MAX_LEN];
+
+/*--------------------------------------------------------------------------------*/
+/* Helper Functions */
+/*--------------------------------------------------------------------------------*/
+
+/**
+ *  Fill the planar inputs with uniform noise in [-1 1) and interleave them.
+ */
+static void cmplx_planar_fill(uint32_t numSamples)
+{
+    uint32_t seed = 0xc0deU + numSamples;
+    uint32_t i;
+
+    for (i = 0; i < numSamples; i++)
+    {
+        seed = seed * 1664525U + 1013904223U;
+        cmplx_planar_a_re[i] = (float32_t) ((int32_t) seed >> 8) / 8388608.0f;
+        seed = seed * 1664525U + 1013904223U;
+        cmplx_planar_a_im[i] = (float32_t) ((int32_t) seed >> 8) / 8388608.0f;
+        seed = seed * 1664525U + 1013904223U;
+        cmplx_planar_b_re[i] = (float32_t) ((int32_t) seed >> 8) / 8388608.0f;
+        seed = seed * 1664525U + 1013904223U;
+        cmplx_planar_b_im[i] = (float32_t) ((int32_t) seed >> 8) / 8388608.0f;
+    }
+
+    arm_cmplx_planar_to_interleaved_f32(cmplx_planar_a_re, cmplx_planar_a_im,
+                                        cmplx_planar_a, numSamples);
+    arm_cmplx_planar_to_interleaved_f32(cmplx_planar_b_re, cmplx_planar_b_im,
+                                        cmplx_planar_b, numSamples);
+}
+
+/**
+ *  Fail the test if a value differs from the reference by more than tol.
+ */
+#define CMPLX_PLANAR_ASSERT_CLOSE(fut, ref, idx, tol)                   \
+    do                                                                  \
+    {                                                                   \
+        if (fabs((float64_t) (fut) - (ref)) > (tol))                    \
+        {                                                               \
+            JTEST_DUMP_STRF("Sample %d: %e, expected %e\n", (int) (idx), \
+                            (double) (fut), (double) (ref));            \
+            return JTEST_TEST_FAILED;                                   \
+        }                                                               \
+    } while (0)
+
+/*
+  Length loop shared by the tests. Runs body for every length of
+  #cmplx_planar_lens that fits the buffers, with freshly filled inputs.
+*/
+#define CMPLX_PLANAR_DO_LENGTHS(body)                                   \
+    do                                                                  \
+    {                                                                   \
+        uint32_t len_idx;                                               \
+        uint32_t numSamples;                                            \
+                                                                        \
+        for (len_idx = 0;                                               \
+             len_idx < sizeof(cmplx_planar_lens) / sizeof(cmplx_planar_lens[0]); \
+             len_idx++)                                                 \
+        {                                                               \
+            numSamples = cmplx_planar_lens[len_idx];                    \
+                                                                        \
+            if (numSamples > COMPLEX_MATH_PLANAR_MAX_LEN)               \
+            {                                                           \
+                continue;                                               \
+            }                                                           \
+                                                                        \
+            cmplx_planar_fill(numSamples);                              \
+                                                                        \
+            /* Display parameter values */                              \
+            JTEST_DUMP_STRF("Number of Samples: %d\n", (int) numSamples); \
+                                                                        \
+            body;                                                       \
+        }                                                               \
+    } while (0)
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_TEST(arm_cmplx_planar_convert_f32_test,
+                  arm_cmplx_interleaved_to_planar_f32)
+{
+    uint32_t i;
+
+    CMPLX_PLANAR_DO_LENGTHS(
+        /* Display cycle count of both conversions */
+        JTEST_COUNT_CYCLES(
+            arm_cmplx_interleaved_to_planar_f32(cmplx_planar_a,
+                                                cmplx_planar_d_re,
+                                                cmplx_planar_d_im,
+                                                numSamples));
+        JTEST_COUNT_CYCLES(
+            arm_cmplx_planar_to_interleaved_f32(cmplx_planar_d_re,
+                                                cmplx_planar_d_im,
+                                                cmplx_planar_d,
+                                                numSamples));
+
+        /* Test correctness, the round trip is exact */
+        for (i = 0; i < numSamples; i++)
+        {
+            TEST_ASSERT_EQUAL(cmplx_planar_d_re[i], cmplx_planar_a_re[i]);
+            TEST_ASSERT_EQUAL(cmplx_planar_d_im[i], cmplx_planar_a_im[i]);
+            TEST_ASSERT_EQUAL(cmplx_planar_a[2 * i], cmplx_planar_a_re[i]);
+            TEST_ASSERT_EQUAL(cmplx_planar_a[2 * i + 1], cmplx_planar_a_im[i]);
+            TEST_ASSERT_EQUAL(cmplx_planar_d[2 * i], cmplx_planar_a[2 * i]);
+            TEST_ASSERT_EQUAL(cmplx_planar_d[2 * i + 1], cmplx_planar_a[2 * i + 1]);
+        });
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_cmplx_mult_cmplx_planar_f32_test,
+                  arm_cmplx_mult_cmplx_planar_f32)
+{
+    uint32_t i;
+
+    CMPLX_PLANAR_DO_LENGTHS(
+        /* Display cycle count of both layouts */
+        JTEST_COUNT_CYCLES(
+            arm_cmplx_mult_cmplx_planar_f32(cmplx_planar_a_re, cmplx_planar_a_im,
+                                            cmplx_planar_b_re, cmplx_planar_b_im,
+                                            cmplx_planar_d_re, cmplx_planar_d_im,
+                                            numSamples));
+        JTEST_COUNT_CYCLES(
+            arm_cmplx_mult_cmplx_f32(cmplx_planar_a, cmplx_planar_b,
+                                     cmplx_planar_d, numSamples));
+
+        /* Test correctness against the interleaved function */
+        for (i = 0; i < numSamples; i++)
+        {
+            CMPLX_PLANAR_ASSERT_CLOSE(cmplx_planar_d_re[i], cmplx_planar_d[2 * i], i, 1.0e-6);
+            CMPLX_PLANAR_ASSERT_CLOSE(cmplx_planar_d_im[i], cmplx_planar_d[2 * i + 1], i, 1.0e-6);
+        });
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_cmplx_mult_conj_planar_f32_test,
+                  arm_cmplx_mult_conj_planar_f32)
+{
+    float64_t ref_re, ref_im;
+    uint32_t i;
+
+    CMPLX_PLANAR_DO_LENGTHS(
+        /* Display cycle count and run test */
+        JTEST_COUNT_CYCLES(
+            arm_cmplx_mult_conj_planar_f32(cmplx_planar_a_re, cmplx_planar_a_im,
+                                           cmplx_planar_b_re, cmplx_planar_b_im,
+                                           cmplx_planar_d_re, cmplx_planar_d_im,
+                                           numSamples));
+
+        /* Cycle count of the interleaved conjugate and multiplication */
+        JTEST_COUNT_CYCLES(
+            arm_cmplx_conj_f32(cmplx_planar_b, cmplx_planar_d, numSamples);
+            arm_cmplx_mult_cmplx_f32(cmplx_planar_a, cmplx_planar_d,
+                                     cmplx_planar_d, numSamples));
+
+        /* Test correctness */
+        for (i = 0; i < numSamples; i++)
+        {
+            ref_re = (float64_t) cmplx_planar_a_re[i] * cmplx_planar_b_re[i] +
+                (float64_t) cmplx_planar_a_im[i] * cmplx_planar_b_im[i];
+            ref_im = (float64_t) cmplx_planar_a_im[i] * cmplx_planar_b_re[i] -
+                (float64_t) cmplx_planar_a_re[i] * cmplx_planar_b_im[i];
+            CMPLX_PLANAR_ASSERT_CLOSE(cmplx_planar_d_re[i], ref_re, i, 1.0e-6);
+            CMPLX_PLANAR_ASSERT_CLOSE(cmplx_planar_d_im[i], ref_im, i, 1.0e-6);
+        });
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_cmplx_mac_planar_f32_test,
+                  arm_cmplx_mac_planar_f32)
+{
+    float64_t ref_re, ref_im;
+    uint32_t i;
+
+    CMPLX_PLANAR_DO_LENGTHS(
+        /* The accumulator starts from a copy of A */
+        memcpy(cmplx_planar_d_re, cmplx_planar_a_re, numSamples * sizeof(float32_t));
+        memcpy(cmplx_planar_d_im, cmplx_planar_a_im, numSamples * sizeof(float32_t));
+
+        /* Display cycle count and run test */
+        JTEST_COUNT_CYCLES(
+            arm_cmplx_mac_planar_f32(cmplx_planar_a_re, cmplx_planar_a_im,
+                                     cmplx_planar_b_re, cmplx_planar_b_im,
+                                     cmplx_planar_d_re, cmplx_planar_d_im,
+                                     numSamples));
+
+        /* Test correctness */
+        for (i = 0; i < numSamples; i++)
+        {
+            ref_re = (float64_t) cmplx_planar_a_re[i] +
+                (float64_t) cmplx_planar_a_re[i] * cmplx_planar_b_re[i] -
+                (float64_t) cmplx_planar_a_im[i] * cmplx_planar_b_im[i];
+            ref_im = (float64_t) cmplx_planar_a_im[i] +
+                (float64_t) cmplx_planar_a_re[i] * cmplx_planar_b_im[i] +
+                (float64_t) cmplx_planar_a_im[i] * cmplx_planar_b_re[i];
+            CMPLX_PLANAR_ASSERT_CLOSE(cmplx_planar_d_re[i], ref_re, i, 1.0e-6);
+            CMPLX_PLANAR_ASSERT_CLOSE(cmplx_planar_d_im[i], ref_im, i, 1.0e-6);
+        }
+
+        /* Cycle count of the interleaved multiplication and addition */
+        JTEST_COUNT_CYCLES(
+            arm_cmplx_mult_cmplx_f32(cmplx_planar_a, cmplx_planar_b,
+                                     cmplx_planar_d, numSamples);
+            arm_add_f32(cmplx_planar_a, cmplx_planar_d, cmplx_planar_d,
+                        2U * numSamples)));
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_cmplx_mag_planar_f32_test,
+                  arm_cmplx_mag_planar_f32)
+{
+    float64_t ref, ulp, err;
+    float64_t max_err = 0.0;
+    uint32_t i;
+
+    CMPLX_PLANAR_DO_LENGTHS(
+        /* Display cycle count of both layouts */
+        JTEST_COUNT_CYCLES(
+            arm_cmplx_mag_planar_f32(cmplx_planar_a_re, cmplx_planar_a_im,
+                                     cmplx_planar_d_re, numSamples));
+        JTEST_COUNT_CYCLES(
+            arm_cmplx_mag_f32(cmplx_planar_a, cmplx_planar_d, numSamples));
+
+        /* Test correctness, in ULP of the double precision magnitude */
+        for (i = 0; i < numSamples; i++)
+        {
+            ref = sqrt((float64_t) cmplx_planar_a_re[i] * cmplx_planar_a_re[i] +
+                       (float64_t) cmplx_planar_a_im[i] * cmplx_planar_a_im[i]);
+            ulp = ldexp(1.0, ilogb(ref) - 23);
+            err = fabs(cmplx_planar_d_re[i] - ref) / ulp;
+            max_err = (err > max_err) ? err : max_err;
+            CMPLX_PLANAR_ASSERT_CLOSE(cmplx_planar_d_re[i], ref, i, 3.0 * ulp);
+        }
+
+        JTEST_DUMP_STRF("Max Error: %d/100 ULP\n", (int) (max_err * 100.0)));
+
+    /* Zero, a denormal power and an infinite power among normal samples */
+    cmplx_planar_a_re[1] = 0.0f;
+    cmplx_planar_a_im[1] = 0.0f;
+    cmplx_planar_a_re[2] = 1.0e-20f;
+    cmplx_planar_a_im[2] = 0.0f;
+    cmplx_planar_a_re[3] = 1.0e20f;
+    cmplx_planar_a_im[3] = 0.0f;
+    arm_cmplx_mag_planar_f32(cmplx_planar_a_re, cmplx_planar_a_im,
+                             cmplx_planar_d_re, 5U);
+    arm_cmplx_mag_f32(cmplx_planar_a, cmplx_planar_d, 5U);
+    TEST_ASSERT_EQUAL(cmplx_planar_d_re[1], 0.0f);
+    TEST_ASSERT_EQUAL(cmplx_planar_d_re[2], sqrtf(1.0e-20f * 1.0e-20f));
+    TEST_ASSERT_EQUAL(isinf(cmplx_planar_d_re[3]) != 0, 1);
+    CMPLX_PLANAR_ASSERT_CLOSE(cmplx_planar_d_re[0], cmplx_planar_d[0], 0, 1.0e-6);
+    CMPLX_PLANAR_ASSERT_CLOSE(cmplx_planar_d_re[4], cmplx_planar_d[4], 4, 1.0e-6);
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_cmplx_mag_squared_planar_f32_test,
+                  arm_cmplx_mag_squared_planar_f32)
+{
+    uint32_t i;
+
+    CMPLX_PLANAR_DO_LENGTHS(
+        /* Display cycle count of both layouts */
+        JTEST_COUNT_CYCLES(
+            arm_cmplx_mag_squared_planar_f32(cmplx_planar_a_re, cmplx_planar_a_im,
+                                             cmplx_planar_d_re, numSamples));
+        JTEST_COUNT_CYCLES(
+            arm_cmplx_mag_squared_f32(cmplx_planar_a, cmplx_planar_d, numSamples));
+
+        /* Test correctness against the interleaved function */
+        for (i = 0; i < numSamples; i++)
+        {
+            CMPLX_PLANAR_ASSERT_CLOSE(cmplx_planar_d_re[i], cmplx_planar_d[i], i, 1.0e-6);
+        });
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_cmplx_dot_prod_planar_f32_test,
+                  arm_cmplx_dot_prod_planar_f32)
+{
+    float32_t fut_re, fut_im, sep_re, sep_im;
+    float64_t ref_re, ref_im;
+    uint32_t i;
+
+    CMPLX_PLANAR_DO_LENGTHS(
+        /* Display cycle count of both layouts */
+        JTEST_COUNT_CYCLES(
+            arm_cmplx_dot_prod_planar_f32(cmplx_planar_a_re, cmplx_planar_a_im,
+                                          cmplx_planar_b_re, cmplx_planar_b_im,
+                                          numSamples, &fut_re, &fut_im));
+        JTEST_COUNT_CYCLES(
+            arm_cmplx_dot_prod_f32(cmplx_planar_a, cmplx_planar_b,
+                                   numSamples, &sep_re, &sep_im));
+
+        /* Test correctness, the error grows with the length */
+        ref_re = 0.0;
+        ref_im = 0.0;
+
+        for (i = 0; i < numSamples; i++)
+        {
+            ref_re += (float64_t) cmplx_planar_a_re[i] * cmplx_planar_b_re[i] -
+                (float64_t) cmplx_planar_a_im[i] * cmplx_planar_b_im[i];
+            ref_im += (float64_t) cmplx_planar_a_re[i] * cmplx_planar_b_im[i] +
+                (float64_t) cmplx_planar_a_im[i] * cmplx_planar_b_re[i];
+        }
+
+        CMPLX_PLANAR_ASSERT_CLOSE(fut_re, ref_re, 0, 1.0e-6 * numSamples);
+        CMPLX_PLANAR_ASSERT_CLOSE(fut_im, ref_im, 0, 1.0e-6 * numSamples));
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_cmplx_phase_planar_f32_test,
+                  arm_cmplx_phase_planar_f32)
+{
+    uint32_t i;
+
+    CMPLX_PLANAR_DO_LENGTHS(
+        /* Display cycle count and run test */
+        JTEST_COUNT_CYCLES(
+            arm_cmplx_phase_planar_f32(cmplx_planar_a_re, cmplx_planar_a_im,
+                                       cmplx_planar_d_re, numSamples));
+
+        /* Cycle count of the interleaved input, split first */
+        JTEST_COUNT_CYCLES(
+            arm_cmplx_interleaved_to_planar_f32(cmplx_planar_a,
+                                                cmplx_planar_b_re,
+                                                cmplx_planar_b_im,
+                                                numSamples);
+            arm_cmplx_phase_planar_f32(cmplx_planar_b_re, cmplx_planar_b_im,
+                                       cmplx_planar_d_im, numSamples));
+
+        /* Test correctness */
+        for (i = 0; i < numSamples; i++)
+        {
+            CMPLX_PLANAR_ASSERT_CLOSE(cmplx_planar_d_re[i],
+                                      atan2((float64_t) cmplx_planar_a_im[i],
+                                            (float64_t) cmplx_planar_a_re[i]),
+                                      i, 1.0e-6);
+            TEST_ASSERT_EQUAL(cmplx_planar_d_im[i], cmplx_planar_d_re[i]);
+        });
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(cmplx_planar_tests)
+{
+    JTEST_TEST_CALL(arm_cmplx_planar_convert_f32_test);
+    JTEST_TEST_CALL(arm_cmplx_mult_cmplx_planar_f32_test);
+    JTEST_TEST_CALL(arm_cmplx_mult_conj_planar_f32_test);
+    JTEST_TEST_CALL(arm_cmplx_mac_planar_f32_test);
+    JTEST_TEST_CALL(arm_cmplx_mag_planar_f32_test);
+    JTEST_TEST_CALL(arm_cmplx_mag_squared_planar_f32_test);
+    JTEST_TEST_CALL(arm_cmplx_dot_prod_planar_f32_test);
+    JTEST_TEST_CALL(arm_cmplx_phase_planar_f32_test);
+}
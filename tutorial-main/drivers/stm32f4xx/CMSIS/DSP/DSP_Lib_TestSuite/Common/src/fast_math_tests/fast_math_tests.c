@@ -4,6 +4,7 @@
 #include "fast_math_templates.h"
 #include "fast_math_test_data.h"
 #include "type_abbrev.h"
+#include <math.h>
 
 SQRT_TEST_TEMPLATE_ELT1(q31);
 SQRT_TEST_TEMPLATE_ELT1(q15);
@@ -16,6 +17,535 @@ SIN_COS_TEST_TEMPLATE_ELT1(f32, float32_t, cos);
 SIN_COS_TEST_TEMPLATE_ELT1(q31, q31_t, cos);
 SIN_COS_TEST_TEMPLATE_ELT1(q15, q15_t, cos);
 
+/*--------------------------------------------------------------------------------*/
+/* Vector Function Buffers */
+/*--------------------------------------------------------------------------------*/
+
+static float32_t fast_math_vector_inputs_a[FAST_MATH_MAX_LEN];
+static float32_t fast_math_vector_inputs_b[FAST_MATH_MAX_LEN];
+static q31_t fast_math_vector_q31_a[FAST_MATH_MAX_LEN];
+static q31_t fast_math_vector_q31_b[FAST_MATH_MAX_LEN];
+static q15_t fast_math_vector_q15_a[FAST_MATH_MAX_LEN];
+static q15_t fast_math_vector_q15_b[FAST_MATH_MAX_LEN];
+
+/*--------------------------------------------------------------------------------*/
+/* Vector Function Helpers */
+/*--------------------------------------------------------------------------------*/
+
+#define FAST_MATH_PI_F64 3.14159265358979323846
+
+/**
+ *  Fill pDst with n pseudo-random values in [lo hi).
+ */
+static void fast_math_fill_f32(
+    float32_t * pDst,
+    uint32_t n,
+    float32_t lo,
+    float32_t hi,
+    uint32_t seed)
+{
+    uint32_t i;
+
+    for (i = 0; i < n; i++)
+    {
+        seed = seed * 1664525U + 1013904223U;
+        pDst[i] = lo + (hi - lo) * ((float32_t) (seed >> 8) / 16777216.0f);
+    }
+}
+
+/**
+ *  Fill pDst with n pseudo-random signed Q31 values, shifted right by the
+ *  index modulo 31 so that small magnitudes are covered as well.
+ */
+static void fast_math_fill_q31(
+    q31_t * pDst,
+    uint32_t n,
+    uint32_t seed)
+{
+    uint32_t i;
+
+    for (i = 0; i < n; i++)
+    {
+        seed = seed * 1664525U + 1013904223U;
+        pDst[i] = ((q31_t) seed) >> (i % 31U);
+    }
+}
+
+/**
+ *  Error of a single precision value against a double precision reference,
+ *  in units of the last place of the reference. Matching infinities and NaNs
+ *  count as exact.
+ */
+static float64_t fast_math_ulp_error(
+    float32_t value,
+    float64_t ref)
+{
+    int exponent;
+
+    if (ref != ref)
+    {
+        return (value != value) ? 0.0 : 1.0e9;
+    }
+
+    /* References beyond the single precision range round to infinity */
+    if (fabs(ref) > 3.40282347e+38)
+    {
+        ref = (ref > 0.0) ? (float64_t) INFINITY : -(float64_t) INFINITY;
+    }
+
+    if ((ref - ref) != 0.0)
+    {
+        return (value == ref) ? 0.0 : 1.0e9;
+    }
+
+    /* |ref| is in [2^(exponent-1) 2^exponent), denormals share the smallest ULP */
+    (void) frexp(fabs(ref), &exponent);
+
+    if (exponent < -125)
+    {
+        exponent = -125;
+    }
+
+    return fabs((float64_t) value - ref) / ldexp(1.0, exponent - 24);
+}
+
+/* Per-element library calls the vector functions are timed against */
+static float32_t fast_math_invsqrt_libm(float32_t x)
+{
+    return 1.0f / sqrtf(x);
+}
+
+static float64_t fast_math_invsqrt_f64(float64_t x)
+{
+    return 1.0 / sqrt(x);
+}
+
+/**
+ *  Fail the test if the measured error is above the documented bound.
+ */
+#define FAST_MATH_ASSERT_ERROR(err, bound, unit)                        \
+    do                                                                  \
+    {                                                                   \
+        JTEST_DUMP_STRF("Max error: %e " unit "\n", (double) (err));    \
+        if ((err) > (bound))                                            \
+        {                                                               \
+            return JTEST_TEST_FAILED;                                   \
+        }                                                               \
+    } while (0)
+
+/*--------------------------------------------------------------------------------*/
+/* Vector Function Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  ULP test template for the single-input floating-point vector functions.
+  The vector function is timed against a loop of the C library function and
+  its maximum error against the double precision C library is checked
+  against the bound documented with the function.
+*/
+#define FAST_MATH_VECTOR_ULP_TEST(func, range, lo, hi, libm_func, ref_func, max_ulp) \
+    JTEST_DEFINE_TEST(arm_v##func##_f32_##range##_test, arm_v##func##_f32)        \
+    {                                                                   \
+        uint32_t i;                                                     \
+        float64_t err;                                                  \
+        float64_t max_err = 0.0;                                        \
+                                                                        \
+        fast_math_fill_f32(fast_math_vector_inputs_a, FAST_MATH_MAX_LEN, \
+                           lo, hi, 0x1234U);                            \
+                                                                        \
+        /* Display parameter values */                                  \
+        JTEST_DUMP_STRF("Input range: [%e %e]\n", (double) (lo), (double) (hi)); \
+                                                                        \
+        /* Display cycle count and run test */                          \
+        JTEST_COUNT_CYCLES(                                             \
+            arm_v##func##_f32(fast_math_vector_inputs_a,                \
+                              fast_math_output_fut,                     \
+                              FAST_MATH_MAX_LEN));                      \
+                                                                        \
+        /* Cycle count of the per-element library calls */              \
+        JTEST_COUNT_CYCLES(                                             \
+            for (i = 0; i < FAST_MATH_MAX_LEN; i++)                     \
+            {                                                           \
+                fast_math_output_ref[i] =                               \
+                    libm_func(fast_math_vector_inputs_a[i]);            \
+            });                                                         \
+                                                                        \
+        /* Test correctness */                                          \
+        for (i = 0; i < FAST_MATH_MAX_LEN; i++)                         \
+        {                                                               \
+            err = fast_math_ulp_error(                                  \
+                fast_math_output_fut[i],                                \
+                ref_func((float64_t) fast_math_vector_inputs_a[i]));    \
+            max_err = (err > max_err) ? err : max_err;                  \
+        }                                                               \
+                                                                        \
+        FAST_MATH_ASSERT_ERROR(max_err, max_ulp, "ULP");                \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+FAST_MATH_VECTOR_ULP_TEST(sin, small, -4.0f, 4.0f, sinf, sin, 1.6);
+FAST_MATH_VECTOR_ULP_TEST(sin, large, -8192.0f, 8192.0f, sinf, sin, 2.5);
+FAST_MATH_VECTOR_ULP_TEST(cos, small, -4.0f, 4.0f, cosf, cos, 1.6);
+FAST_MATH_VECTOR_ULP_TEST(cos, large, -8192.0f, 8192.0f, cosf, cos, 2.5);
+FAST_MATH_VECTOR_ULP_TEST(exp, full, -87.33f, 88.72f, expf, exp, 1.0);
+FAST_MATH_VECTOR_ULP_TEST(log, small, 0.0f, 4.0f, logf, log, 1.0);
+FAST_MATH_VECTOR_ULP_TEST(log, full, 0.0f, 3.0e38f, logf, log, 1.0);
+FAST_MATH_VECTOR_ULP_TEST(tanh, full, -10.0f, 10.0f, tanhf, tanh, 1.5);
+FAST_MATH_VECTOR_ULP_TEST(invsqrt, small, 0.0f, 4.0f, fast_math_invsqrt_libm, fast_math_invsqrt_f64, 2.5);
+FAST_MATH_VECTOR_ULP_TEST(invsqrt, full, 0.0f, 3.0e38f, fast_math_invsqrt_libm, fast_math_invsqrt_f64, 2.5);
+
+/*
+  ULP test template for the floating-point atan2, which takes two inputs.
+*/
+#define FAST_MATH_VECTOR_ATAN2_ULP_TEST(range, lo, hi, max_ulp)         \
+    JTEST_DEFINE_TEST(arm_vatan2_f32_##range##_test, arm_vatan2_f32)    \
+    {                                                                   \
+        uint32_t i;                                                     \
+        float64_t err;                                                  \
+        float64_t max_err = 0.0;                                        \
+                                                                        \
+        fast_math_fill_f32(fast_math_vector_inputs_a, FAST_MATH_MAX_LEN, \
+                           lo, hi, 0x1234U);                            \
+        fast_math_fill_f32(fast_math_vector_inputs_b, FAST_MATH_MAX_LEN, \
+                           lo, hi, 0x5678U);                            \
+                                                                        \
+        /* Display parameter values */                                  \
+        JTEST_DUMP_STRF("Input range: [%e %e]\n", (double) (lo), (double) (hi)); \
+                                                                        \
+        /* Display cycle count and run test */                          \
+        JTEST_COUNT_CYCLES(                                             \
+            arm_vatan2_f32(fast_math_vector_inputs_a,                   \
+                           fast_math_vector_inputs_b,                   \
+                           fast_math_output_fut,                        \
+                           FAST_MATH_MAX_LEN));                         \
+                                                                        \
+        /* Cycle count of the per-element library calls */              \
+        JTEST_COUNT_CYCLES(                                             \
+            for (i = 0; i < FAST_MATH_MAX_LEN; i++)                     \
+            {                                                           \
+                fast_math_output_ref[i] =                               \
+                    atan2f(fast_math_vector_inputs_a[i],                \
+                           fast_math_vector_inputs_b[i]);               \
+            });                                                         \
+                                                                        \
+        /* Test correctness */                                          \
+        for (i = 0; i < FAST_MATH_MAX_LEN; i++)                         \
+        {                                                               \
+            err = fast_math_ulp_error(                                  \
+                fast_math_output_fut[i],                                \
+                atan2((float64_t) fast_math_vector_inputs_a[i],         \
+                      (float64_t) fast_math_vector_inputs_b[i]));       \
+            max_err = (err > max_err) ? err : max_err;                  \
+        }                                                               \
+                                                                        \
+        FAST_MATH_ASSERT_ERROR(max_err, max_ulp, "ULP");                \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+FAST_MATH_VECTOR_ATAN2_ULP_TEST(small, -1.0f, 1.0f, 2.0);
+FAST_MATH_VECTOR_ATAN2_ULP_TEST(large, -1.0e30f, 1.0e30f, 3.0);
+
+/*
+  The table based sine and cosine against their vector versions on the
+  existing [0 2*pi) inputs. Both errors are displayed, only the vector error
+  is checked.
+*/
+#define FAST_MATH_VECTOR_TABLE_COMPARE_TEST(func)                       \
+    JTEST_DEFINE_TEST(arm_v##func##_f32_table_test, arm_v##func##_f32)  \
+    {                                                                   \
+        uint32_t i;                                                     \
+        float64_t ref;                                                  \
+        float64_t max_err_vector = 0.0;                                 \
+        float64_t max_err_table = 0.0;                                  \
+                                                                        \
+        /* Display cycle count and run test */                          \
+        JTEST_COUNT_CYCLES(                                             \
+            arm_v##func##_f32((float32_t *) fast_math_f32_inputs,       \
+                              fast_math_output_fut,                     \
+                              FAST_MATH_MAX_LEN));                      \
+                                                                        \
+        /* Cycle count of the table based function */                   \
+        JTEST_COUNT_CYCLES(                                             \
+            for (i = 0; i < FAST_MATH_MAX_LEN; i++)                     \
+            {                                                           \
+                fast_math_output_ref[i] =                               \
+                    arm_##func##_f32(fast_math_f32_inputs[i]);          \
+            });                                                         \
+                                                                        \
+        for (i = 0; i < FAST_MATH_MAX_LEN; i++)                         \
+        {                                                               \
+            ref = func((float64_t) fast_math_f32_inputs[i]);            \
+            ref = fabs((float64_t) fast_math_output_fut[i] - ref);      \
+            max_err_vector = (ref > max_err_vector) ? ref : max_err_vector; \
+            ref = func((float64_t) fast_math_f32_inputs[i]);            \
+            ref = fabs((float64_t) fast_math_output_ref[i] - ref);      \
+            max_err_table = (ref > max_err_table) ? ref : max_err_table; \
+        }                                                               \
+                                                                        \
+        JTEST_DUMP_STRF("Table max absolute error: %e\n", max_err_table); \
+        FAST_MATH_ASSERT_ERROR(max_err_vector, 1.0e-7, "absolute");     \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+FAST_MATH_VECTOR_TABLE_COMPARE_TEST(sin);
+FAST_MATH_VECTOR_TABLE_COMPARE_TEST(cos);
+
+JTEST_DEFINE_TEST(arm_vmath_f32_special_test, arm_vexp_f32)
+{
+    static float32_t special[] =
+    {
+        0.0f, -0.0f, INFINITY, -INFINITY, NAN, 1.0e-45f, 1.0e-40f, -1.0f,
+        100.0f, -100.0f, 88.72f, -87.33f, 9.5f, -9.5f, 1.0e20f
+    };
+    uint32_t n = sizeof(special) / sizeof(special[0]);
+    uint32_t i;
+    float64_t ref;
+    float64_t err;
+    float64_t max_err = 0.0;
+
+    /* Overflow, underflow, infinities, NaN, zeros and denormals */
+    arm_vexp_f32(special, fast_math_output_fut, n);
+    for (i = 0; i < n; i++)
+    {
+        /* Results below the smallest normal are flushed */
+        ref = exp((float64_t) special[i]);
+        ref = (ref < 1.17549435e-38) ? 0.0 : ref;
+        err = fast_math_ulp_error(fast_math_output_fut[i], ref);
+        max_err = (err > max_err) ? err : max_err;
+    }
+
+    arm_vlog_f32(special, fast_math_output_fut, n);
+    for (i = 0; i < n; i++)
+    {
+        err = fast_math_ulp_error(fast_math_output_fut[i], log((float64_t) special[i]));
+        max_err = (err > max_err) ? err : max_err;
+    }
+
+    arm_vtanh_f32(special, fast_math_output_fut, n);
+    for (i = 0; i < n; i++)
+    {
+        err = fast_math_ulp_error(fast_math_output_fut[i], tanh((float64_t) special[i]));
+        max_err = (err > max_err) ? err : max_err;
+    }
+
+    arm_vinvsqrt_f32(special, fast_math_output_fut, n);
+    for (i = 0; i < n; i++)
+    {
+        err = fast_math_ulp_error(fast_math_output_fut[i], 1.0 / sqrt((float64_t) special[i]));
+        max_err = (err > max_err) ? err : max_err;
+    }
+
+    arm_vsin_f32(special, fast_math_output_fut, n);
+    for (i = 0; i < n; i++)
+    {
+        err = fast_math_ulp_error(fast_math_output_fut[i], sin((float64_t) special[i]));
+        max_err = (err > max_err) ? err : max_err;
+    }
+
+    /* Every pair of special values, signed zeros included */
+    for (i = 0; i < n * n; i++)
+    {
+        fast_math_vector_inputs_a[i] = special[i / n];
+        fast_math_vector_inputs_b[i] = special[i % n];
+    }
+
+    arm_vatan2_f32(fast_math_vector_inputs_a, fast_math_vector_inputs_b, fast_math_output_fut, n * n);
+    for (i = 0; i < n * n; i++)
+    {
+        err = fast_math_ulp_error(fast_math_output_fut[i],
+                                  atan2((float64_t) fast_math_vector_inputs_a[i],
+                                        (float64_t) fast_math_vector_inputs_b[i]));
+        max_err = (err > max_err) ? err : max_err;
+
+        if (signbit(fast_math_output_fut[i]) != signbit(fast_math_vector_inputs_a[i]) &&
+            (fast_math_output_fut[i] == fast_math_output_fut[i]))
+        {
+            return JTEST_TEST_FAILED;
+        }
+    }
+
+    FAST_MATH_ASSERT_ERROR(max_err, 3.0, "ULP");
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  The fixed-point vector sine and cosine must match the scalar functions
+  bit for bit.
+*/
+#define FAST_MATH_VECTOR_EXACT_TEST(func, suffix, type)                 \
+    JTEST_DEFINE_TEST(arm_v##func##_##suffix##_test, arm_v##func##_##suffix) \
+    {                                                                   \
+        uint32_t i;                                                     \
+                                                                        \
+        /* Display cycle count and run test */                          \
+        JTEST_COUNT_CYCLES(                                             \
+            arm_v##func##_##suffix(                                     \
+                (type *) fast_math_##suffix##_inputs,                   \
+                (type *) fast_math_output_fut,                          \
+                FAST_MATH_MAX_LEN));                                    \
+                                                                        \
+        /* Cycle count of the scalar function */                        \
+        JTEST_COUNT_CYCLES(                                             \
+            for (i = 0; i < FAST_MATH_MAX_LEN; i++)                     \
+            {                                                           \
+                ((type *) fast_math_output_ref)[i] =                    \
+                    arm_##func##_##suffix(fast_math_##suffix##_inputs[i]); \
+            });                                                         \
+                                                                        \
+        /* Test correctness */                                          \
+        if (memcmp(fast_math_output_fut, fast_math_output_ref,          \
+                   FAST_MATH_MAX_LEN * sizeof(type)) != 0)              \
+        {                                                               \
+            return JTEST_TEST_FAILED;                                   \
+        }                                                               \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+FAST_MATH_VECTOR_EXACT_TEST(sin, q31, q31_t);
+FAST_MATH_VECTOR_EXACT_TEST(sin, q15, q15_t);
+FAST_MATH_VECTOR_EXACT_TEST(cos, q31, q31_t);
+FAST_MATH_VECTOR_EXACT_TEST(cos, q15, q15_t);
+
+/*
+  The vector square roots must match the scalar functions bit for bit.
+*/
+#define FAST_MATH_VECTOR_SQRT_TEST(suffix, type)                        \
+    JTEST_DEFINE_TEST(arm_vsqrt_##suffix##_test, arm_vsqrt_##suffix)    \
+    {                                                                   \
+        uint32_t i;                                                     \
+                                                                        \
+        /* Display cycle count and run test */                          \
+        JTEST_COUNT_CYCLES(                                             \
+            arm_vsqrt_##suffix(                                         \
+                (type *) fast_math_##suffix##_inputs,                   \
+                (type *) fast_math_output_fut,                          \
+                FAST_MATH_MAX_LEN));                                    \
+                                                                        \
+        /* Cycle count of the scalar function */                        \
+        JTEST_COUNT_CYCLES(                                             \
+            for (i = 0; i < FAST_MATH_MAX_LEN; i++)                     \
+            {                                                           \
+                arm_sqrt_##suffix(                                      \
+                    fast_math_##suffix##_inputs[i],                     \
+                    (type *) fast_math_output_ref + i);                 \
+            });                                                         \
+                                                                        \
+        /* Test correctness */                                          \
+        if (memcmp(fast_math_output_fut, fast_math_output_ref,          \
+                   FAST_MATH_MAX_LEN * sizeof(type)) != 0)              \
+        {                                                               \
+            return JTEST_TEST_FAILED;                                   \
+        }                                                               \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+FAST_MATH_VECTOR_SQRT_TEST(f32, float32_t);
+FAST_MATH_VECTOR_SQRT_TEST(q31, q31_t);
+FAST_MATH_VECTOR_SQRT_TEST(q15, q15_t);
+
+JTEST_DEFINE_TEST(arm_vatan2_q31_test, arm_vatan2_q31)
+{
+    uint32_t i;
+    float64_t ref;
+    float64_t max_err = 0.0;
+
+    fast_math_fill_q31(fast_math_vector_q31_a, FAST_MATH_MAX_LEN, 0x1234U);
+    fast_math_fill_q31(fast_math_vector_q31_b, FAST_MATH_MAX_LEN, 0x5678U);
+
+    /* The negative x axis, full scale corners and the origin */
+    fast_math_vector_q31_a[0] = 0;
+    fast_math_vector_q31_b[0] = -5;
+    fast_math_vector_q31_a[1] = INT32_MIN;
+    fast_math_vector_q31_b[1] = INT32_MIN;
+    fast_math_vector_q31_a[2] = INT32_MIN;
+    fast_math_vector_q31_b[2] = INT32_MAX;
+    fast_math_vector_q31_a[3] = 0;
+    fast_math_vector_q31_b[3] = 0;
+
+    /* Display cycle count and run test */
+    JTEST_COUNT_CYCLES(
+        arm_vatan2_q31(fast_math_vector_q31_a,
+                       fast_math_vector_q31_b,
+                       (q31_t *) fast_math_output_fut,
+                       FAST_MATH_MAX_LEN));
+
+    /* Cycle count of the floating-point vector function on the same points */
+    for (i = 0; i < FAST_MATH_MAX_LEN; i++)
+    {
+        fast_math_vector_inputs_a[i] = (float32_t) fast_math_vector_q31_a[i];
+        fast_math_vector_inputs_b[i] = (float32_t) fast_math_vector_q31_b[i];
+    }
+
+    JTEST_COUNT_CYCLES(
+        arm_vatan2_f32(fast_math_vector_inputs_a,
+                       fast_math_vector_inputs_b,
+                       fast_math_output_ref,
+                       FAST_MATH_MAX_LEN));
+
+    /* Test correctness, the angle is in units of pi */
+    for (i = 0; i < FAST_MATH_MAX_LEN; i++)
+    {
+        ref = atan2((float64_t) fast_math_vector_q31_a[i],
+                    (float64_t) fast_math_vector_q31_b[i]) / FAST_MATH_PI_F64 * 2147483648.0;
+        ref = (ref > 2147483647.0) ? 2147483647.0 : ref;
+        ref = fabs((float64_t) ((q31_t *) fast_math_output_fut)[i] - ref);
+        max_err = (ref > max_err) ? ref : max_err;
+    }
+
+    FAST_MATH_ASSERT_ERROR(max_err, 21.0, "LSB");
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_vatan2_q15_test, arm_vatan2_q15)
+{
+    uint32_t i;
+    float64_t ref;
+    float64_t max_err = 0.0;
+
+    fast_math_fill_q31(fast_math_vector_q31_a, FAST_MATH_MAX_LEN, 0x1234U);
+    fast_math_fill_q31(fast_math_vector_q31_b, FAST_MATH_MAX_LEN, 0x5678U);
+
+    for (i = 0; i < FAST_MATH_MAX_LEN; i++)
+    {
+        fast_math_vector_q15_a[i] = (q15_t) (fast_math_vector_q31_a[i] >> 16);
+        fast_math_vector_q15_b[i] = (q15_t) (fast_math_vector_q31_b[i] >> 16);
+    }
+
+    /* The negative x axis and the origin */
+    fast_math_vector_q15_a[0] = 0;
+    fast_math_vector_q15_b[0] = -5;
+    fast_math_vector_q15_a[1] = 0;
+    fast_math_vector_q15_b[1] = 0;
+
+    /* Display cycle count and run test */
+    JTEST_COUNT_CYCLES(
+        arm_vatan2_q15(fast_math_vector_q15_a,
+                       fast_math_vector_q15_b,
+                       (q15_t *) fast_math_output_fut,
+                       FAST_MATH_MAX_LEN));
+
+    /* Test correctness, the angle is in units of pi */
+    for (i = 0; i < FAST_MATH_MAX_LEN; i++)
+    {
+        ref = atan2((float64_t) fast_math_vector_q15_a[i],
+                    (float64_t) fast_math_vector_q15_b[i]) / FAST_MATH_PI_F64 * 32768.0;
+        ref = (ref > 32767.0) ? 32767.0 : ref;
+        ref = fabs((float64_t) ((q15_t *) fast_math_output_fut)[i] - ref);
+        max_err = (ref > max_err) ? ref : max_err;
+    }
+
+    FAST_MATH_ASSERT_ERROR(max_err, 1.0, "LSB");
+
+    return JTEST_TEST_PASSED;
+}
+
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group */
 /*--------------------------------------------------------------------------------*/
@@ -35,4 +565,30 @@ JTEST_DEFINE_GROUP(fast_math_tests)
     JTEST_TEST_CALL(arm_cos_f32_test);
     JTEST_TEST_CALL(arm_cos_q31_test);
     JTEST_TEST_CALL(arm_cos_q15_test);
+
+    JTEST_TEST_CALL(arm_vsin_f32_small_test);
+    JTEST_TEST_CALL(arm_vsin_f32_large_test);
+    JTEST_TEST_CALL(arm_vcos_f32_small_test);
+    JTEST_TEST_CALL(arm_vcos_f32_large_test);
+    JTEST_TEST_CALL(arm_vexp_f32_full_test);
+    JTEST_TEST_CALL(arm_vlog_f32_small_test);
+    JTEST_TEST_CALL(arm_vlog_f32_full_test);
+    JTEST_TEST_CALL(arm_vtanh_f32_full_test);
+    JTEST_TEST_CALL(arm_vinvsqrt_f32_small_test);
+    JTEST_TEST_CALL(arm_vinvsqrt_f32_full_test);
+    JTEST_TEST_CALL(arm_vatan2_f32_small_test);
+    JTEST_TEST_CALL(arm_vatan2_f32_large_test);
+    JTEST_TEST_CALL(arm_vsin_f32_table_test);
+    JTEST_TEST_CALL(arm_vcos_f32_table_test);
+    JTEST_TEST_CALL(arm_vmath_f32_special_test);
+
+    JTEST_TEST_CALL(arm_vsin_q31_test);
+    JTEST_TEST_CALL(arm_vsin_q15_test);
+    JTEST_TEST_CALL(arm_vcos_q31_test);
+    JTEST_TEST_CALL(arm_vcos_q15_test);
+    JTEST_TEST_CALL(arm_vsqrt_f32_test);
+    JTEST_TEST_CALL(arm_vsqrt_q31_test);
+    JTEST_TEST_CALL(arm_vsqrt_q15_test);
+    JTEST_TEST_CALL(arm_vatan2_q31_test);
+    JTEST_TEST_CALL(arm_vatan2_q15_test);
 }
@@ -0,0 +1,362 @@
+#include "jtest.h"
+#include "filtering_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "test_templates.h"
+#include "type_abbrev.h"
+#include <math.h>
+
+/*--------------------------------------------------------------------------------*/
+/* Buffers */
+/*--------------------------------------------------------------------------------*/
+
+/* Length of the longest scenario */
+#define ADAPTIVE_MAX_SAMPLES 32768
+
+/* Length of the longest unknown system */
+#define ADAPTIVE_MAX_TAPS 1024
+
+/* Samples per call, as in arm_signal_converge_example */
+#define ADAPTIVE_BLOCK_SIZE 32
+
+/* Misalignment in dB at which a filter is considered converged */
+#define ADAPTIVE_CONVERGED_DB (-30.0f)
+
+/* Unknown system of arm_signal_converge_example */
+static const float32_t adaptive_converge_coeffs[32] = {
+    0.004502f, 0.005074f, 0.006707f, 0.009356f, 0.012933f, 0.017303f, 0.022298f, 0.027717f,
+    0.033338f, 0.038930f, 0.044258f, 0.049098f, 0.053243f, 0.056519f, 0.058784f, 0.059941f,
+    0.059941f, 0.058784f, 0.056519f, 0.053243f, 0.049098f, 0.044258f, 0.038930f, 0.033338f,
+    0.027717f, 0.022298f, 0.017303f, 0.012933f, 0.009356f, 0.006707f, 0.005074f, 0.004502f
+};
+
+static float32_t adaptive_system[ADAPTIVE_MAX_TAPS];
+static float32_t adaptive_input[ADAPTIVE_MAX_SAMPLES];
+static float32_t adaptive_ref[ADAPTIVE_MAX_SAMPLES];
+static float32_t adaptive_out[ADAPTIVE_BLOCK_SIZE * 4];
+static float32_t adaptive_err[ADAPTIVE_BLOCK_SIZE * 4];
+static float32_t adaptive_coeffs[ADAPTIVE_MAX_TAPS];
+static float32_t adaptive_taps[ADAPTIVE_MAX_TAPS];
+static float32_t adaptive_state[ADAPTIVE_MAX_TAPS * 4];
+static float32_t adaptive_spectra[ADAPTIVE_MAX_TAPS * 2];
+static float32_t adaptive_matrix[32 * 32];
+static float32_t adaptive_scratch[32];
+
+/*--------------------------------------------------------------------------------*/
+/* Helper Functions */
+/*--------------------------------------------------------------------------------*/
+
+/**
+ *  Build the scenario: an input of numSamples samples of unit variance noise,
+ *  white or lowpass filtered by a one-pole filter of pole 0.9, and the
+ *  reference output of the numTaps tap system in #adaptive_system.
+ */
+static void adaptive_make_scenario(uint32_t numSamples, uint32_t numTaps, uint8_t colored)
+{
+    uint32_t seed = 0x5eedU;
+    float32_t x;
+    float32_t y = 0.0f;
+    float32_t acc;
+    uint32_t n, k;
+
+    for (n = 0; n < numSamples; n++)
+    {
+        seed = seed * 1664525U + 1013904223U;
+        x = 1.7320508f * (float32_t) ((int32_t) seed >> 8) / 8388608.0f;
+
+        /* The pole is compensated to keep unit variance */
+        y = colored ? (0.9f * y + 0.43588989f * x) : x;
+        adaptive_input[n] = y;
+    }
+
+    for (n = 0; n < numSamples; n++)
+    {
+        acc = 0.0f;
+
+        for (k = 0; (k < numTaps) && (k <= n); k++)
+        {
+            acc += adaptive_system[k] * adaptive_input[n - k];
+        }
+
+        adaptive_ref[n] = acc;
+    }
+}
+
+/**
+ *  Exponentially decaying random system of numTaps taps, like a room
+ *  impulse response.
+ */
+static void adaptive_make_echo_path(uint32_t numTaps)
+{
+    uint32_t seed = 0xec40U;
+    uint32_t k;
+
+    for (k = 0; k < numTaps; k++)
+    {
+        seed = seed * 1664525U + 1013904223U;
+        adaptive_system[k] = 0.5f * expf(-6.0f * (float32_t) k / numTaps) *
+            (float32_t) ((int32_t) seed >> 8) / 8388608.0f;
+    }
+}
+
+/**
+ *  Misalignment in dB between the taps and #adaptive_system. The taps are in
+ *  natural order, or time reversed as used by the LMS and RLS filters.
+ */
+static float32_t adaptive_misalignment_db(
+    const float32_t * pTaps,
+    uint32_t numTaps,
+    uint8_t reversed)
+{
+    float64_t err = 0.0;
+    float64_t norm = 0.0;
+    float64_t d;
+    uint32_t k;
+
+    for (k = 0; k < numTaps; k++)
+    {
+        d = adaptive_system[k] - pTaps[reversed ? (numTaps - 1U - k) : k];
+        err += d * d;
+        norm += (float64_t) adaptive_system[k] * adaptive_system[k];
+    }
+
+    return (float32_t) (10.0 * log10(err / norm + 1.0e-30));
+}
+
+/*
+  Run a filter over the scenario, block by block, and record the number of
+  samples after which its misalignment first drops below
+  #ADAPTIVE_CONVERGED_DB. Arguments are: processing call on (input,
+  reference, block size), statement that fills taps, tap array, number of
+  taps, reversed flag, block size, scenario length and the variable that
+  receives the convergence time (numSamples if never converged).
+*/
+#define ADAPTIVE_RUN(process, get_taps, taps, numTaps, reversed,        \
+                     blockSize, numSamples, converged_at)               \
+    do                                                                  \
+    {                                                                   \
+        uint32_t pos;                                                   \
+                                                                        \
+        converged_at = numSamples;                                      \
+                                                                        \
+        for (pos = 0; pos < numSamples; pos += blockSize)               \
+        {                                                               \
+            float32_t * in = adaptive_input + pos;                      \
+            float32_t * ref = adaptive_ref + pos;                       \
+                                                                        \
+            process;                                                    \
+                                                                        \
+            if (converged_at == numSamples)                             \
+            {                                                           \
+                get_taps;                                               \
+                                                                        \
+                if (adaptive_misalignment_db(taps, numTaps, reversed) < \
+                    ADAPTIVE_CONVERGED_DB)                              \
+                {                                                       \
+                    converged_at = pos + blockSize;                     \
+                }                                                       \
+            }                                                           \
+        }                                                               \
+    } while (0)
+
+/*
+  Run the normalized LMS filter of arm_signal_converge_example over the
+  scenario: mu = 0.5.
+*/
+#define ADAPTIVE_RUN_LMS_NORM(numTaps, numSamples, converged_at)        \
+    do                                                                  \
+    {                                                                   \
+        arm_lms_norm_instance_f32 lms_inst;                             \
+                                                                        \
+        memset(adaptive_coeffs, 0, sizeof(adaptive_coeffs));            \
+        arm_lms_norm_init_f32(&lms_inst, numTaps, adaptive_coeffs,      \
+                              adaptive_state, 0.5f,                     \
+                              ADAPTIVE_BLOCK_SIZE);                     \
+                                                                        \
+        ADAPTIVE_RUN(                                                   \
+            arm_lms_norm_f32(&lms_inst, in, ref, adaptive_out,          \
+                             adaptive_err, ADAPTIVE_BLOCK_SIZE),        \
+            (void) 0, adaptive_coeffs, numTaps, 1U,                     \
+            ADAPTIVE_BLOCK_SIZE, numSamples, converged_at);             \
+                                                                        \
+        /* Display cycle count of one block */                          \
+        JTEST_COUNT_CYCLES(                                             \
+            arm_lms_norm_f32(&lms_inst, adaptive_input, adaptive_ref,   \
+                             adaptive_out, adaptive_err,                \
+                             ADAPTIVE_BLOCK_SIZE));                     \
+    } while (0)
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  FDAF test template. Arguments are: configuration suffix, colored input flag,
+  number of taps, partition length, scenario length and whether the FDAF must
+  converge no later than the normalized LMS filter.
+*/
+#define ADAPTIVE_DEFINE_FDAF_TEST(config_suffix, colored, numTaps,      \
+                                  blockLen, numSamples, beat_lms)       \
+    JTEST_DEFINE_TEST(arm_fdaf_f32_##config_suffix##_test,              \
+                      arm_fdaf_f32)                                     \
+    {                                                                   \
+        arm_fdaf_instance_f32 fdaf_inst;                                \
+        uint32_t fdaf_converged;                                        \
+        uint32_t lms_converged;                                         \
+        float32_t misalignment;                                         \
+                                                                        \
+        if ((numTaps) == 32U)                                           \
+        {                                                               \
+            memcpy(adaptive_system, adaptive_converge_coeffs,           \
+                   sizeof(adaptive_converge_coeffs));                   \
+        }                                                               \
+        else                                                            \
+        {                                                               \
+            adaptive_make_echo_path(numTaps);                           \
+        }                                                               \
+                                                                        \
+        adaptive_make_scenario(numSamples, numTaps, colored);           \
+                                                                        \
+        TEST_ASSERT_EQUAL(                                              \
+            arm_fdaf_init_f32(&fdaf_inst, blockLen,                     \
+                              (numTaps) / (blockLen),                   \
+                              adaptive_spectra, adaptive_state,         \
+                              0.5f, 0.9f),                              \
+            ARM_MATH_SUCCESS);                                          \
+                                                                        \
+        /* Display parameter values */                                  \
+        JTEST_DUMP_STRF("Number of Taps: %d\n"                          \
+                        "Partition Length: %d\n"                        \
+                        "Colored input: %d\n",                          \
+                        (int)(numTaps),                                 \
+                        (int)(blockLen),                                \
+                        (int)(colored));                                \
+                                                                        \
+        ADAPTIVE_RUN(                                                   \
+            arm_fdaf_f32(&fdaf_inst, in, ref, adaptive_out,             \
+                         adaptive_err, blockLen),                       \
+            arm_fdaf_get_coeffs_f32(&fdaf_inst, adaptive_taps),         \
+            adaptive_taps, numTaps, 0U,                                 \
+            blockLen, numSamples, fdaf_converged);                      \
+                                                                        \
+        arm_fdaf_get_coeffs_f32(&fdaf_inst, adaptive_taps);             \
+        misalignment = adaptive_misalignment_db(adaptive_taps,          \
+                                                numTaps, 0U);           \
+                                                                        \
+        /* Display cycle count of one block */                          \
+        JTEST_DUMP_STRF("Samples per call: %d\n", (int)(blockLen));     \
+        JTEST_COUNT_CYCLES(                                             \
+            arm_fdaf_f32(&fdaf_inst, adaptive_input, adaptive_ref,      \
+                         adaptive_out, adaptive_err, blockLen));        \
+                                                                        \
+        /* Baseline: normalized LMS */                                  \
+        JTEST_DUMP_STRF("Samples per call: %d\n",                       \
+                        (int)ADAPTIVE_BLOCK_SIZE);                      \
+        ADAPTIVE_RUN_LMS_NORM(numTaps, numSamples, lms_converged);      \
+                                                                        \
+        JTEST_DUMP_STRF("Converged after: FDAF %d, NLMS %d samples\n"   \
+                        "Final FDAF misalignment: %d dB\n",             \
+                        (int)fdaf_converged,                            \
+                        (int)lms_converged,                             \
+                        (int)misalignment);                             \
+                                                                        \
+        /* Test correctness */                                          \
+        if ((misalignment > ADAPTIVE_CONVERGED_DB) ||                   \
+            ((beat_lms) && (fdaf_converged > lms_converged)))           \
+        {                                                               \
+            return JTEST_TEST_FAILED;                                   \
+        }                                                               \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+ADAPTIVE_DEFINE_FDAF_TEST(white, 0U, 32U, 32U, 4096U, 0U);
+ADAPTIVE_DEFINE_FDAF_TEST(colored, 1U, 32U, 32U, 16384U, 1U);
+ADAPTIVE_DEFINE_FDAF_TEST(partitioned, 1U, 32U, 16U, 16384U, 1U);
+ADAPTIVE_DEFINE_FDAF_TEST(echo, 1U, 1024U, 128U, 32768U, 1U);
+
+/*
+  RLS test template. Arguments are: configuration suffix, colored input flag
+  and scenario length. The system is the one of arm_signal_converge_example.
+*/
+#define ADAPTIVE_DEFINE_RLS_TEST(config_suffix, colored, numSamples)    \
+    JTEST_DEFINE_TEST(arm_rls_f32_##config_suffix##_test,               \
+                      arm_rls_f32)                                      \
+    {                                                                   \
+        arm_rls_instance_f32 rls_inst;                                  \
+        uint32_t rls_converged;                                         \
+        uint32_t lms_converged;                                         \
+        float32_t misalignment;                                         \
+                                                                        \
+        memcpy(adaptive_system, adaptive_converge_coeffs,               \
+               sizeof(adaptive_converge_coeffs));                       \
+        adaptive_make_scenario(numSamples, 32U, colored);               \
+                                                                        \
+        TEST_ASSERT_EQUAL(                                              \
+            arm_rls_init_f32(&rls_inst, 32U, adaptive_coeffs,           \
+                             adaptive_state, adaptive_matrix,           \
+                             adaptive_scratch, 0.9999f, 0.01f,          \
+                             ADAPTIVE_BLOCK_SIZE),                      \
+            ARM_MATH_SUCCESS);                                          \
+                                                                        \
+        /* Display parameter values */                                  \
+        JTEST_DUMP_STRF("Number of Taps: %d\n"                          \
+                        "Colored input: %d\n",                          \
+                        32,                                             \
+                        (int)(colored));                                \
+                                                                        \
+        ADAPTIVE_RUN(                                                   \
+            arm_rls_f32(&rls_inst, in, ref, adaptive_out,               \
+                        adaptive_err, ADAPTIVE_BLOCK_SIZE),             \
+            (void) 0, adaptive_coeffs, 32U, 1U,                         \
+            ADAPTIVE_BLOCK_SIZE, numSamples, rls_converged);            \
+                                                                        \
+        misalignment = adaptive_misalignment_db(adaptive_coeffs,        \
+                                                32U, 1U);               \
+                                                                        \
+        /* Display cycle count of one block */                          \
+        JTEST_DUMP_STRF("Samples per call: %d\n",                       \
+                        (int)ADAPTIVE_BLOCK_SIZE);                      \
+        JTEST_COUNT_CYCLES(                                             \
+            arm_rls_f32(&rls_inst, adaptive_input, adaptive_ref,        \
+                        adaptive_out, adaptive_err,                     \
+                        ADAPTIVE_BLOCK_SIZE));                          \
+                                                                        \
+        /* Baseline: normalized LMS */                                  \
+        ADAPTIVE_RUN_LMS_NORM(32U, numSamples, lms_converged);          \
+                                                                        \
+        JTEST_DUMP_STRF("Converged after: RLS %d, NLMS %d samples\n"    \
+                        "Final RLS misalignment: %d dB\n",              \
+                        (int)rls_converged,                             \
+                        (int)lms_converged,                             \
+                        (int)misalignment);                             \
+                                                                        \
+        /* Test correctness */                                          \
+        if ((misalignment > ADAPTIVE_CONVERGED_DB) ||                   \
+            (rls_converged > lms_converged))                            \
+        {                                                               \
+            return JTEST_TEST_FAILED;                                   \
+        }                                                               \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+ADAPTIVE_DEFINE_RLS_TEST(white, 0U, 4096U);
+ADAPTIVE_DEFINE_RLS_TEST(colored, 1U, 16384U);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(adaptive_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_fdaf_f32_white_test);
+    JTEST_TEST_CALL(arm_fdaf_f32_colored_test);
+    JTEST_TEST_CALL(arm_fdaf_f32_partitioned_test);
+    JTEST_TEST_CALL(arm_fdaf_f32_echo_test);
+    JTEST_TEST_CALL(arm_rls_f32_white_test);
+    JTEST_TEST_CALL(arm_rls_f32_colored_test);
+}
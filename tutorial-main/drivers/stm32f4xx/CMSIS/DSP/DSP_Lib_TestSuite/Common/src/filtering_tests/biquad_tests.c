@@ -215,6 +215,196 @@ JTEST_DEFINE_TEST(arm_biquad_cascade_df2T_f64_test,
 }
 
 
+/* Working coefficients and crossfade increments of the multi-channel filters */
+static float32_t biquad_multi_coeffs_fut[FILTERING_MAX_NUMSTAGES * 5];
+static float32_t biquad_multi_coeffs_ref[FILTERING_MAX_NUMSTAGES * 5];
+static float32_t biquad_multi_step_fut[FILTERING_MAX_NUMSTAGES * 5];
+static float32_t biquad_multi_step_ref[FILTERING_MAX_NUMSTAGES * 5];
+static float32_t biquad_multi_coeffs_new[FILTERING_MAX_NUMSTAGES * 5];
+
+/* State of the per channel df2T filters used as the cycle count baseline */
+static float32_t biquad_multi_state_loop[FILTERING_MAX_NUMSTAGES * 2 * FILTERING_MAX_NUMCHANNELS];
+
+/*
+  Multi-channel filtering done by calling arm_biquad_cascade_df2T_f32() once per
+  channel on planar data. Only used to compare cycle counts.
+*/
+static void biquad_df2T_per_channel_f32(
+   uint16_t numStages,
+   uint16_t numChannels,
+   uint32_t blockSize)
+{
+   arm_biquad_cascade_df2T_instance_f32 biquad_inst;
+   uint16_t ch;
+
+   for (ch = 0; ch < numChannels; ch++)
+   {
+      arm_biquad_cascade_df2T_init_f32(
+            &biquad_inst, numStages,
+            (float32_t *) filtering_coeffs_b_f32,
+            biquad_multi_state_loop + 2 * numStages * ch);
+
+      arm_biquad_cascade_df2T_f32(
+            &biquad_inst,
+            (float32_t *) filtering_f32_inputs + blockSize * ch,
+            filtering_output_f32_fut + blockSize * ch,
+            blockSize);
+   }
+}
+
+JTEST_DEFINE_TEST(arm_biquad_cascade_multi_df2T_f32_test,
+     arm_biquad_cascade_multi_df2T_f32)
+{
+  arm_biquad_cascade_multi_df2T_instance_f32 biquad_inst_fut = { 0 };
+  arm_biquad_cascade_multi_df2T_instance_f32 biquad_inst_ref = { 0 };
+
+  TEMPLATE_DO_ARR_DESC(
+        blocksize_idx, uint32_t, blockSize, filtering_blocksizes
+        ,
+     TEMPLATE_DO_ARR_DESC(
+           numstages_idx, uint16_t, numStages, filtering_numstages
+           ,
+        TEMPLATE_DO_ARR_DESC(
+              numchannels_idx, uint16_t, numChannels, filtering_numchannels
+              ,
+              /* Display test parameter values */
+              JTEST_DUMP_STRF("Block Size: %d\n"
+                              "Number of Stages: %d\n"
+                              "Number of Channels: %d\n",
+                              (int)blockSize,
+                              (int)numStages,
+                              (int)numChannels);
+
+              /* Initialize the BIQUAD Instances */
+              arm_biquad_cascade_multi_df2T_init_f32(
+                    &biquad_inst_fut, numStages, numChannels,
+                    (float32_t*)filtering_coeffs_b_f32,
+                    NULL,
+                    (void *) filtering_pState);
+
+              JTEST_COUNT_CYCLES(
+                    arm_biquad_cascade_multi_df2T_f32(
+                          &biquad_inst_fut,
+                          (void *) filtering_f32_inputs,
+                          (void *) filtering_output_fut,
+                          blockSize));
+
+              arm_biquad_cascade_multi_df2T_init_f32(
+                    &biquad_inst_ref, numStages, numChannels,
+                    (float32_t*)filtering_coeffs_b_f32,
+                    NULL,
+                    (void *) filtering_pState);
+
+              ref_biquad_cascade_multi_df2T_f32(
+                    &biquad_inst_ref,
+                    (void *) filtering_f32_inputs,
+                    (void *) filtering_output_ref,
+                    blockSize);
+
+              FILTERING_SNR_COMPARE_INTERFACE(
+                    blockSize * numChannels,
+                    float32_t);
+
+              /* Cycle count of one df2T call per channel */
+              JTEST_COUNT_CYCLES(
+                    biquad_df2T_per_channel_f32(
+                          numStages,
+                          numChannels,
+                          blockSize)))));
+
+        return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_biquad_cascade_multi_df2T_update_f32_test,
+     arm_biquad_cascade_multi_df2T_update_f32)
+{
+  arm_biquad_cascade_multi_df2T_instance_f32 biquad_inst_fut = { 0 };
+  arm_biquad_cascade_multi_df2T_instance_f32 biquad_inst_ref = { 0 };
+  uint32_t i;
+
+  /* New response: same poles, half the gain */
+  for (i = 0; i < FILTERING_MAX_NUMSTAGES * 5; i++)
+  {
+     biquad_multi_coeffs_new[i] = ((i % 5) < 3) ?
+        0.5f * filtering_coeffs_b_f32[i] : filtering_coeffs_b_f32[i];
+  }
+
+  TEMPLATE_DO_ARR_DESC(
+        blocksize_idx, uint32_t, blockSize, filtering_blocksizes
+        ,
+     TEMPLATE_DO_ARR_DESC(
+           numstages_idx, uint16_t, numStages, filtering_numstages
+           ,
+        TEMPLATE_DO_ARR_DESC(
+              ramplength_idx, uint32_t, rampLength, filtering_ramplengths
+              ,
+              /* Display test parameter values */
+              JTEST_DUMP_STRF("Block Size: %d\n"
+                              "Number of Stages: %d\n"
+                              "Ramp Length: %d\n",
+                              (int)blockSize,
+                              (int)numStages,
+                              (int)rampLength);
+
+              /* Initialize the BIQUAD Instances and start the crossfades */
+              memcpy(biquad_multi_coeffs_fut, filtering_coeffs_b_f32,
+                     sizeof(biquad_multi_coeffs_fut));
+              memcpy(biquad_multi_coeffs_ref, filtering_coeffs_b_f32,
+                     sizeof(biquad_multi_coeffs_ref));
+
+              arm_biquad_cascade_multi_df2T_init_f32(
+                    &biquad_inst_fut, numStages, FILTERING_MAX_NUMCHANNELS,
+                    biquad_multi_coeffs_fut,
+                    biquad_multi_step_fut,
+                    (void *) filtering_pState);
+
+              arm_biquad_cascade_multi_df2T_update_f32(
+                    &biquad_inst_fut, biquad_multi_coeffs_new, rampLength);
+
+              /* The crossfade spans both calls for the longer ramps */
+              JTEST_COUNT_CYCLES(
+                    arm_biquad_cascade_multi_df2T_f32(
+                          &biquad_inst_fut,
+                          (void *) filtering_f32_inputs,
+                          (void *) filtering_output_fut,
+                          blockSize));
+
+              arm_biquad_cascade_multi_df2T_f32(
+                    &biquad_inst_fut,
+                    (void *) (filtering_f32_inputs + blockSize * FILTERING_MAX_NUMCHANNELS),
+                    (void *) (filtering_output_fut + blockSize * FILTERING_MAX_NUMCHANNELS),
+                    blockSize);
+
+              arm_biquad_cascade_multi_df2T_init_f32(
+                    &biquad_inst_ref, numStages, FILTERING_MAX_NUMCHANNELS,
+                    biquad_multi_coeffs_ref,
+                    biquad_multi_step_ref,
+                    (void *) filtering_pState);
+
+              arm_biquad_cascade_multi_df2T_update_f32(
+                    &biquad_inst_ref, biquad_multi_coeffs_new, rampLength);
+
+              ref_biquad_cascade_multi_df2T_f32(
+                    &biquad_inst_ref,
+                    (void *) filtering_f32_inputs,
+                    (void *) filtering_output_ref,
+                    2 * blockSize);
+
+              FILTERING_SNR_COMPARE_INTERFACE(
+                    2 * blockSize * FILTERING_MAX_NUMCHANNELS,
+                    float32_t);
+
+              /* Both filters must end up on the same coefficients */
+              if (memcmp(biquad_multi_coeffs_fut, biquad_multi_coeffs_ref,
+                         sizeof(biquad_multi_coeffs_fut)) != 0)
+              {
+                 return JTEST_TEST_FAILED;
+              })));
+
+        return JTEST_TEST_PASSED;
+}
+
+
 BIQUAD_DEFINE_TEST(f32,arm_biquad_casd_df1_inst_f32, df1,float32_t);
 BIQUAD_DEFINE_TEST(f32,arm_biquad_cascade_df2T_instance_f32,df2T,float32_t);
 BIQUAD_DEFINE_TEST(f32,arm_biquad_cascade_stereo_df2T_instance_f32,stereo_df2T,float32_t);
@@ -235,6 +425,8 @@ JTEST_DEFINE_GROUP(biquad_tests)
    JTEST_TEST_CALL(arm_biquad_cascade_df1_f32_test);
    JTEST_TEST_CALL(arm_biquad_cascade_df2T_f32_test);
    JTEST_TEST_CALL(arm_biquad_cascade_stereo_df2T_f32_test);
+   JTEST_TEST_CALL(arm_biquad_cascade_multi_df2T_f32_test);
+   JTEST_TEST_CALL(arm_biquad_cascade_multi_df2T_update_f32_test);
    JTEST_TEST_CALL(arm_biquad_cascade_df2T_f64_test);
    JTEST_TEST_CALL(arm_biquad_cascade_df1_q31_test);
    JTEST_TEST_CALL(arm_biquad_cascade_df1_q15_test);
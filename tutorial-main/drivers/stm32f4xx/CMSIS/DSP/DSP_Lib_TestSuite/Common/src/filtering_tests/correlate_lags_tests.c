@@ -0,0 +1,385 @@
+#include "jtest.h"
+#include "filtering_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "filtering_templates.h"
+#include "type_abbrev.h"
+#include <math.h>
+
+/*--------------------------------------------------------------------------------*/
+/* Buffers */
+/*--------------------------------------------------------------------------------*/
+
+/* Longest input of the window tests */
+#define CORRELATE_LAGS_MAX_LEN 64
+
+/* Length of the delay estimation signals and of their FFT correlation */
+#define CORRELATE_TDE_LEN 1024
+#define CORRELATE_TDE_FFT_LEN 2048
+
+/* Lag window searched by the delay estimation */
+#define CORRELATE_TDE_LAG_LO (-128)
+#define CORRELATE_TDE_LAG_HI 127
+
+/* Input length pairs {srcALen, srcBLen} */
+static const uint32_t correlate_lags_lens[][2] = {
+    {33, 33}, {33, 17}, {17, 33}, {64, 40}, {1, 9}
+};
+
+/* Lag windows {lagLo, lagHi}, partly or fully outside some of the inputs */
+static const int32_t correlate_lags_windows[][2] = {
+    {-63, 63}, {-5, 7}, {10, 40}, {-50, -20}, {0, 0}
+};
+
+/* Delays of the delay estimation tests */
+static const int32_t correlate_tde_delays[] = {-37, 0, 12, 90};
+
+static float32_t correlate_tde_src[CORRELATE_TDE_LEN - 2 * CORRELATE_TDE_LAG_LO];
+static float32_t correlate_tde_a[CORRELATE_TDE_LEN];
+static float32_t correlate_tde_b[CORRELATE_TDE_LEN];
+static float32_t correlate_tde_full[CORRELATE_TDE_LEN * 2];
+static float32_t correlate_tde_scratch[CORRELATE_TDE_FFT_LEN * 3];
+static q31_t correlate_lags_q31_inputs[CORRELATE_LAGS_MAX_LEN * 2];
+
+#define CORRELATE_LAGS_NUM_LENS \
+    (sizeof(correlate_lags_lens) / sizeof(correlate_lags_lens[0]))
+#define CORRELATE_LAGS_NUM_WINDOWS \
+    (sizeof(correlate_lags_windows) / sizeof(correlate_lags_windows[0]))
+#define CORRELATE_TDE_NUM_DELAYS \
+    (sizeof(correlate_tde_delays) / sizeof(correlate_tde_delays[0]))
+
+/*--------------------------------------------------------------------------------*/
+/* Helper Functions */
+/*--------------------------------------------------------------------------------*/
+
+/**
+ *  Fill #correlate_tde_src with lowpass noise and build b = src and
+ *  a = src delayed by delay samples, plus half a sample when half is set.
+ *  With echo set, a also holds an echo 0.8 times as loud, 7 samples later.
+ */
+static void correlate_make_tde(int32_t delay, uint8_t half, uint8_t echo)
+{
+    uint32_t seed = 0x7de5U;
+    float32_t y = 0.0f;
+    int32_t n, m;
+
+    for (n = 0; n < CORRELATE_TDE_LEN - 2 * CORRELATE_TDE_LAG_LO; n++)
+    {
+        seed = seed * 1664525U + 1013904223U;
+        y = 0.8f * y + (float32_t) ((int32_t) seed >> 8) / 8388608.0f;
+        correlate_tde_src[n] = y;
+    }
+
+    /* b starts one window in, so that a can reach both ways */
+    for (n = 0; n < CORRELATE_TDE_LEN; n++)
+    {
+        m = n - CORRELATE_TDE_LAG_LO;
+        correlate_tde_b[n] = correlate_tde_src[m];
+        correlate_tde_a[n] = correlate_tde_src[m - delay];
+
+        if (half)
+        {
+            correlate_tde_a[n] = 0.5f * (correlate_tde_a[n] + correlate_tde_src[m - delay - 1]);
+        }
+
+        if (echo)
+        {
+            correlate_tde_a[n] += 0.8f * correlate_tde_src[m - delay - 7];
+        }
+    }
+}
+
+/**
+ *  Fill #correlate_lags_q31_inputs with the q31 inputs scaled down by 6 bits,
+ *  so that the 2.62 accumulator of 64 products does not overflow.
+ */
+static void correlate_lags_scale_q31(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < CORRELATE_LAGS_MAX_LEN * 2; i++)
+    {
+        correlate_lags_q31_inputs[i] = filtering_q31_inputs[i] >> 6;
+    }
+}
+
+/**
+ *  Compare a window of lags against the full reference correlation
+ *  pRef of two sequences of length srcALen and srcBLen.
+ */
+#define CORRELATE_LAGS_COMPARE(type, pFut, pRef, srcALen, srcBLen,      \
+                               lagLo, lagHi, tol)                       \
+    do                                                                  \
+    {                                                                   \
+        int32_t max_len = (int32_t) (((srcALen) > (srcBLen)) ?          \
+                                     (srcALen) : (srcBLen));            \
+        int32_t lag;                                                    \
+        type expected;                                                  \
+                                                                        \
+        for (lag = (lagLo); lag <= (lagHi); lag++)                      \
+        {                                                               \
+            expected = ((lag > -max_len) && (lag < max_len)) ?          \
+                (pRef)[max_len - 1 + lag] : (type) 0;                   \
+                                                                        \
+            if (fabs((float64_t) (pFut)[lag - (lagLo)] - expected) > (tol)) \
+            {                                                           \
+                JTEST_DUMP_STRF("Lag %d: %e, expected %e\n", (int) lag, \
+                                (double) (pFut)[lag - (lagLo)],         \
+                                (double) expected);                     \
+                return JTEST_TEST_FAILED;                               \
+            }                                                           \
+        }                                                               \
+    } while (0)
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Window test template. Arguments are: function suffix, data type, inputs, a
+  statement preparing them and tolerance. The window is compared against the full correlation of the
+  reference library.
+*/
+#define CORRELATE_LAGS_DEFINE_TEST(suffix, type, inputs, setup, tol)    \
+    JTEST_DEFINE_TEST(arm_correlate_lags_##suffix##_test,               \
+                      arm_correlate_lags_##suffix)                      \
+    {                                                                   \
+        type * pSrcA = (type *) (inputs);                               \
+        type * pSrcB = (type *) (inputs) + CORRELATE_LAGS_MAX_LEN;      \
+        type * pFut = (type *) filtering_output_fut;                    \
+        type * pRef = (type *) filtering_output_ref;                    \
+        uint32_t len_idx, win_idx;                                      \
+        uint32_t srcALen, srcBLen;                                      \
+        int32_t lagLo, lagHi;                                           \
+                                                                        \
+        setup;                                                          \
+                                                                        \
+        for (len_idx = 0; len_idx < CORRELATE_LAGS_NUM_LENS; len_idx++) \
+        {                                                               \
+            srcALen = correlate_lags_lens[len_idx][0];                  \
+            srcBLen = correlate_lags_lens[len_idx][1];                  \
+                                                                        \
+            memset(pRef, 0, CORRELATE_LAGS_MAX_LEN * 2 * sizeof(type)); \
+            ref_correlate_##suffix(pSrcA, srcALen, pSrcB, srcBLen, pRef); \
+                                                                        \
+            for (win_idx = 0; win_idx < CORRELATE_LAGS_NUM_WINDOWS; win_idx++) \
+            {                                                           \
+                lagLo = correlate_lags_windows[win_idx][0];             \
+                lagHi = correlate_lags_windows[win_idx][1];             \
+                                                                        \
+                /* Display parameter values */                          \
+                JTEST_DUMP_STRF("Lengths: %d %d\n"                      \
+                                "Lags: %d to %d\n",                     \
+                                (int)srcALen, (int)srcBLen,             \
+                                (int)lagLo, (int)lagHi);                \
+                                                                        \
+                /* Display cycle count and run test */                  \
+                JTEST_COUNT_CYCLES(                                     \
+                    arm_correlate_lags_##suffix(pSrcA, srcALen, pSrcB,  \
+                                                srcBLen, lagLo, lagHi,  \
+                                                pFut));                 \
+                                                                        \
+                /* Test correctness */                                  \
+                CORRELATE_LAGS_COMPARE(type, pFut, pRef, srcALen,       \
+                                       srcBLen, lagLo, lagHi, tol);     \
+            }                                                           \
+        }                                                               \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+CORRELATE_LAGS_DEFINE_TEST(f32, float32_t, filtering_f32_inputs, (void) 0, 1.0e-3);
+CORRELATE_LAGS_DEFINE_TEST(q15, q15_t, filtering_q15_inputs, (void) 0, 0.0);
+CORRELATE_LAGS_DEFINE_TEST(q31, q31_t, correlate_lags_q31_inputs,
+                           correlate_lags_scale_q31(), 0.0);
+
+/**
+ *  The FFT correlation without weighting matches the direct window.
+ */
+JTEST_DEFINE_TEST(arm_correlate_fft_f32_plain_test, arm_correlate_fft_f32)
+{
+    arm_correlate_fft_instance_f32 corr_inst;
+    float32_t * pSrcA = (float32_t *) filtering_f32_inputs;
+    float32_t * pSrcB = (float32_t *) filtering_f32_inputs + CORRELATE_LAGS_MAX_LEN;
+    uint32_t len_idx, win_idx;
+    uint32_t srcALen, srcBLen;
+    int32_t lagLo, lagHi;
+    float32_t energyA, energyB, tol;
+    uint32_t i;
+
+    TEST_ASSERT_EQUAL(arm_correlate_fft_init_f32(&corr_inst, 128U, correlate_tde_scratch),
+                      ARM_MATH_SUCCESS);
+
+    for (len_idx = 0; len_idx < CORRELATE_LAGS_NUM_LENS; len_idx++)
+    {
+        srcALen = correlate_lags_lens[len_idx][0];
+        srcBLen = correlate_lags_lens[len_idx][1];
+
+        for (win_idx = 0; win_idx < CORRELATE_LAGS_NUM_WINDOWS; win_idx++)
+        {
+            lagLo = correlate_lags_windows[win_idx][0];
+            lagHi = correlate_lags_windows[win_idx][1];
+
+            /* Display parameter values */
+            JTEST_DUMP_STRF("Lengths: %d %d\n"
+                            "Lags: %d to %d\n",
+                            (int)srcALen, (int)srcBLen,
+                            (int)lagLo, (int)lagHi);
+
+            /* Display cycle count and run test */
+            JTEST_COUNT_CYCLES(
+                arm_correlate_fft_f32(&corr_inst, pSrcA, srcALen, pSrcB, srcBLen,
+                                      lagLo, lagHi, ARM_CORRELATE_PLAIN,
+                                      filtering_output_fut));
+
+            arm_correlate_lags_f32(pSrcA, srcALen, pSrcB, srcBLen,
+                                   lagLo, lagHi, filtering_output_ref);
+
+            /* The FFT rounding error scales with the largest possible lag */
+            arm_power_f32(pSrcA, srcALen, &energyA);
+            arm_power_f32(pSrcB, srcBLen, &energyB);
+            tol = 1.0e-5f * sqrtf(energyA * energyB);
+
+            /* Test correctness */
+            for (i = 0; i < (uint32_t) (lagHi - lagLo + 1); i++)
+            {
+                if (fabsf(filtering_output_fut[i] - filtering_output_ref[i]) > tol)
+                {
+                    JTEST_DUMP_STRF("Lag %d: %e, expected %e\n", (int) (lagLo + (int32_t) i),
+                                    (double) filtering_output_fut[i],
+                                    (double) filtering_output_ref[i]);
+                    return JTEST_TEST_FAILED;
+                }
+            }
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  Delay estimation test template. Arguments are: configuration suffix,
+  half-sample delay flag, echo flag and tolerance on the estimated lag. The
+  restricted window and its interpolated peak are timed against
+  arm_correlate_f32() followed by arm_max_f32(), and against the FFT path.
+*/
+#define CORRELATE_DEFINE_TDE_TEST(config_suffix, half, echo, tol)       \
+    JTEST_DEFINE_TEST(arm_correlate_peak_f32_##config_suffix##_test,    \
+                      arm_correlate_peak_f32)                           \
+    {                                                                   \
+        arm_correlate_fft_instance_f32 corr_inst;                       \
+        float32_t * pWin = filtering_output_fut;                        \
+        uint32_t num_lags = CORRELATE_TDE_LAG_HI - CORRELATE_TDE_LAG_LO + 1; \
+        float32_t expected, lag, peak, max_val;                         \
+        uint32_t max_idx;                                               \
+        uint32_t delay_idx;                                             \
+                                                                        \
+        TEST_ASSERT_EQUAL(                                              \
+            arm_correlate_fft_init_f32(&corr_inst, CORRELATE_TDE_FFT_LEN, \
+                                       correlate_tde_scratch),          \
+            ARM_MATH_SUCCESS);                                          \
+                                                                        \
+        for (delay_idx = 0; delay_idx < CORRELATE_TDE_NUM_DELAYS; delay_idx++) \
+        {                                                               \
+            correlate_make_tde(correlate_tde_delays[delay_idx], half, echo); \
+            expected = correlate_tde_delays[delay_idx] + ((half) ? 0.5f : 0.0f); \
+                                                                        \
+            /* Display parameter values */                              \
+            JTEST_DUMP_STRF("Length: %d\n"                              \
+                            "Lags: %d to %d\n"                          \
+                            "Delay: %d\n",                              \
+                            (int)CORRELATE_TDE_LEN,                     \
+                            (int)CORRELATE_TDE_LAG_LO,                  \
+                            (int)CORRELATE_TDE_LAG_HI,                  \
+                            (int)correlate_tde_delays[delay_idx]);      \
+                                                                        \
+            /* Display cycle count of the restricted window and its peak */ \
+            JTEST_COUNT_CYCLES(                                         \
+                arm_correlate_lags_f32(correlate_tde_a, CORRELATE_TDE_LEN, \
+                                       correlate_tde_b, CORRELATE_TDE_LEN, \
+                                       CORRELATE_TDE_LAG_LO,            \
+                                       CORRELATE_TDE_LAG_HI, pWin);     \
+                arm_correlate_peak_f32(pWin, num_lags,                  \
+                                       CORRELATE_TDE_LAG_LO,            \
+                                       &lag, &peak));                   \
+                                                                        \
+            JTEST_DUMP_STRF("Direct: lag %d/1000\n", (int)(lag * 1000.0f)); \
+            if (fabsf(lag - expected) > (tol))                          \
+            {                                                           \
+                return JTEST_TEST_FAILED;                               \
+            }                                                           \
+                                                                        \
+            /* Cycle count of the full correlation and maximum */       \
+            JTEST_COUNT_CYCLES(                                         \
+                arm_correlate_f32(correlate_tde_a, CORRELATE_TDE_LEN,   \
+                                  correlate_tde_b, CORRELATE_TDE_LEN,   \
+                                  correlate_tde_full);                  \
+                arm_max_f32(correlate_tde_full, 2 * CORRELATE_TDE_LEN - 1, \
+                            &max_val, &max_idx));                       \
+                                                                        \
+            /* The full search lands on the same lag */                 \
+            TEST_ASSERT_EQUAL((int32_t) max_idx - (CORRELATE_TDE_LEN - 1), \
+                              (int32_t) floorf(lag + 0.5f));            \
+                                                                        \
+            /* Cycle count of the FFT path, plain and GCC-PHAT */       \
+            JTEST_COUNT_CYCLES(                                         \
+                arm_correlate_fft_f32(&corr_inst,                       \
+                                      correlate_tde_a, CORRELATE_TDE_LEN, \
+                                      correlate_tde_b, CORRELATE_TDE_LEN, \
+                                      CORRELATE_TDE_LAG_LO,             \
+                                      CORRELATE_TDE_LAG_HI,             \
+                                      ARM_CORRELATE_PLAIN, pWin);       \
+                arm_correlate_peak_f32(pWin, num_lags,                  \
+                                       CORRELATE_TDE_LAG_LO,            \
+                                       &lag, &peak));                   \
+                                                                        \
+            JTEST_DUMP_STRF("FFT: lag %d/1000\n", (int)(lag * 1000.0f)); \
+            if (fabsf(lag - expected) > (tol))                          \
+            {                                                           \
+                return JTEST_TEST_FAILED;                               \
+            }                                                           \
+                                                                        \
+            JTEST_COUNT_CYCLES(                                         \
+                arm_correlate_fft_f32(&corr_inst,                       \
+                                      correlate_tde_a, CORRELATE_TDE_LEN, \
+                                      correlate_tde_b, CORRELATE_TDE_LEN, \
+                                      CORRELATE_TDE_LAG_LO,             \
+                                      CORRELATE_TDE_LAG_HI,             \
+                                      ARM_CORRELATE_PHAT, pWin);        \
+                arm_correlate_peak_f32(pWin, num_lags,                  \
+                                       CORRELATE_TDE_LAG_LO,            \
+                                       &lag, &peak));                   \
+                                                                        \
+            JTEST_DUMP_STRF("GCC-PHAT: lag %d/1000\n", (int)(lag * 1000.0f)); \
+            if (fabsf(lag - expected) > (tol))                          \
+            {                                                           \
+                return JTEST_TEST_FAILED;                               \
+            }                                                           \
+        }                                                               \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+CORRELATE_DEFINE_TDE_TEST(integer, 0U, 0U, 0.1f);
+CORRELATE_DEFINE_TDE_TEST(half, 1U, 0U, 0.15f);
+CORRELATE_DEFINE_TDE_TEST(echo, 0U, 1U, 0.2f);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(correlate_lags_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_correlate_lags_f32_test);
+    JTEST_TEST_CALL(arm_correlate_lags_q15_test);
+    JTEST_TEST_CALL(arm_correlate_lags_q31_test);
+    JTEST_TEST_CALL(arm_correlate_fft_f32_plain_test);
+    JTEST_TEST_CALL(arm_correlate_peak_f32_integer_test);
+    JTEST_TEST_CALL(arm_correlate_peak_f32_half_test);
+    JTEST_TEST_CALL(arm_correlate_peak_f32_echo_test);
+}
@@ -572,6 +572,18 @@ ARR_DESC_DEFINE(uint16_t,
                 CURLY(
                       1, 7, FILTERING_MAX_NUMSTAGES));
 
+ARR_DESC_DEFINE(uint16_t,
+                filtering_numchannels,
+                3,
+                CURLY(
+                      1, 3, FILTERING_MAX_NUMCHANNELS));
+
+ARR_DESC_DEFINE(uint32_t,
+                filtering_ramplengths,
+                3,
+                CURLY(
+                      1, 20, 2 * FILTERING_MAX_BLOCKSIZE + 1));
+
 ARR_DESC_DEFINE(uint8_t,
                 filtering_postshifts,
                 3,
@@ -590,6 +602,13 @@ ARR_DESC_DEFINE(uint8_t,
                 CURLY(
                       1, 2, 4, 7, 11, FILTERING_MAX_M));
 
+/* Farrow resampler input steps in 8.24 format, 0.25 to 2.5 */
+ARR_DESC_DEFINE(uint32_t,
+                filtering_farrow_steps,
+                5,
+                CURLY(
+                      0x00400000, 0x00EB3333, 0x01000000, 0x0116A3D7, 0x02800000));
+
 
 /*--------------------------------------------------------------------------------*/
 /* Coefficient Lists */
@@ -6,12 +6,15 @@ JTEST_DEFINE_GROUP(filtering_tests)
     /*
       To skip a test, comment it out.
     */
+    JTEST_GROUP_CALL(adaptive_tests);
     JTEST_GROUP_CALL(biquad_tests);
     JTEST_GROUP_CALL(conv_tests);
+    JTEST_GROUP_CALL(correlate_lags_tests);
     JTEST_GROUP_CALL(correlate_tests);
     JTEST_GROUP_CALL(fir_tests);
     JTEST_GROUP_CALL(iir_tests);
     JTEST_GROUP_CALL(lms_tests);
+    JTEST_GROUP_CALL(resample_tests);
 
     return;
 }
@@ -6,6 +6,7 @@
 #include "test_templates.h"
 #include "filtering_templates.h"
 #include "type_abbrev.h"
+#include <math.h>
 
 #define FIR_DEFINE_TEST(suffix, config_suffix, output_type)             \
    JTEST_DEFINE_TEST(arm_fir##config_suffix##_##suffix##_test,          \
@@ -365,6 +366,339 @@ FIR_SPARSE_DEFINE_TEST(q31,q31_t);
 FIR_SPARSE2_DEFINE_TEST(q15,q15_t);
 FIR_SPARSE2_DEFINE_TEST(q7,q7_t);
 
+/*--------------------------------------------------------------------------------*/
+/* Sparse Gather and Crossfade Tests */
+/*--------------------------------------------------------------------------------*/
+
+/* Delay line and stream of the sparse benchmark */
+#define FIR_GATHER_MAX_DELAY 4096
+#define FIR_GATHER_BLOCKSIZE 64
+#define FIR_GATHER_NUM_BLOCKS 72
+#define FIR_GATHER_MAX_TAPS 64
+
+/* Stream and fade of the crossfade tests */
+#define FIR_XFADE_NUMTAPS 32
+#define FIR_XFADE_BLOCKSIZE 32
+#define FIR_XFADE_NUM_BLOCKS 20
+#define FIR_XFADE_FADE_LEN 100
+
+static float32_t fir_gather_signal[FIR_GATHER_BLOCKSIZE * FIR_GATHER_NUM_BLOCKS];
+static float32_t fir_gather_state[FIR_GATHER_MAX_DELAY + 2 * FIR_GATHER_BLOCKSIZE];
+static float32_t fir_sparse_state[FIR_GATHER_MAX_DELAY + FIR_GATHER_BLOCKSIZE];
+static float32_t fir_gather_coeffs[2][FIR_GATHER_MAX_TAPS];
+static int32_t fir_gather_delays[2][FIR_GATHER_MAX_TAPS];
+static uint32_t fir_gather_offsets[FIR_GATHER_MAX_TAPS];
+
+/* Numbers of active taps of the sparse benchmark */
+static const uint16_t fir_gather_numtaps[] = {8, 9, 16, 32, 64};
+
+/**
+ *  Fill the stream with uniform noise in [-1 1) and draw two tap patterns
+ *  of numTaps taps. Each pattern includes the delays 0 and maxDelay.
+ */
+static void fir_gather_setup(uint16_t numTaps)
+{
+    uint32_t seed = 0x5a17U + numTaps;
+    uint32_t i, set;
+
+    for (i = 0; i < FIR_GATHER_BLOCKSIZE * FIR_GATHER_NUM_BLOCKS; i++)
+    {
+        seed = seed * 1664525U + 1013904223U;
+        fir_gather_signal[i] = (float32_t) ((int32_t) seed >> 8) / 8388608.0f;
+    }
+
+    for (set = 0; set < 2; set++)
+    {
+        for (i = 0; i < numTaps; i++)
+        {
+            seed = seed * 1664525U + 1013904223U;
+            fir_gather_coeffs[set][i] = (float32_t) ((int32_t) seed >> 8) / 8388608.0f;
+            fir_gather_delays[set][i] = (int32_t) ((seed >> 8) % (FIR_GATHER_MAX_DELAY + 1U));
+        }
+
+        fir_gather_delays[set][0] = 0;
+        fir_gather_delays[set][numTaps - 1U] = FIR_GATHER_MAX_DELAY;
+    }
+}
+
+/**
+ *  Output sample n of an FIR filter with time reversed coefficients,
+ *  computed in double precision over #fir_gather_signal.
+ */
+static float64_t fir_xfade_ref(const float32_t * pCoeffs, int32_t n)
+{
+    float64_t acc = 0.0;
+    int32_t k;
+
+    for (k = 0; (k < FIR_XFADE_NUMTAPS) && (k <= n); k++)
+    {
+        acc += (float64_t) pCoeffs[FIR_XFADE_NUMTAPS - 1 - k] * fir_gather_signal[n - k];
+    }
+
+    return acc;
+}
+
+/*
+  The sparse filter with gather offsets is run next to arm_fir_sparse_f32() on
+  a 4096 sample delay line. Both are timed over the whole stream, then run
+  again block by block, compared, and switched to a second tap pattern
+  halfway without resetting the delay line.
+*/
+JTEST_DEFINE_TEST(arm_fir_sparse_gather_f32_test, arm_fir_sparse_gather_f32)
+{
+    arm_fir_sparse_instance_f32 fir_inst_ref = { 0 };
+    arm_fir_sparse_gather_instance_f32 fir_inst_fut = { 0 };
+    uint32_t numtaps_idx, blk, i;
+    uint16_t numTaps;
+    int32_t bad_delay;
+
+    for (numtaps_idx = 0;
+         numtaps_idx < sizeof(fir_gather_numtaps) / sizeof(fir_gather_numtaps[0]);
+         numtaps_idx++)
+    {
+        numTaps = fir_gather_numtaps[numtaps_idx];
+        fir_gather_setup(numTaps);
+
+        /* Display test parameter values */
+        JTEST_DUMP_STRF("Block Size: %d\n"
+                        "Number of Taps: %d\n"
+                        "Max Delay: %d\n",
+                        (int)FIR_GATHER_BLOCKSIZE,
+                        (int)numTaps,
+                        (int)FIR_GATHER_MAX_DELAY);
+
+        /* Cycle count of arm_fir_sparse_f32() over the stream */
+        arm_fir_sparse_init_f32(&fir_inst_ref, numTaps, fir_gather_coeffs[0],
+                                fir_sparse_state, fir_gather_delays[0],
+                                FIR_GATHER_MAX_DELAY, FIR_GATHER_BLOCKSIZE);
+
+        JTEST_COUNT_CYCLES(
+            for (blk = 0; blk < FIR_GATHER_NUM_BLOCKS; blk++)
+            {
+                arm_fir_sparse_f32(&fir_inst_ref,
+                                   fir_gather_signal + blk * FIR_GATHER_BLOCKSIZE,
+                                   filtering_output_ref, filtering_scratch,
+                                   FIR_GATHER_BLOCKSIZE);
+            });
+
+        /* Display cycle count of the gather filter over the stream */
+        TEST_ASSERT_EQUAL(
+            arm_fir_sparse_gather_init_f32(&fir_inst_fut, numTaps,
+                                           fir_gather_coeffs[0],
+                                           fir_gather_state,
+                                           fir_gather_delays[0],
+                                           fir_gather_offsets,
+                                           FIR_GATHER_MAX_DELAY,
+                                           FIR_GATHER_BLOCKSIZE),
+            ARM_MATH_SUCCESS);
+
+        JTEST_COUNT_CYCLES(
+            for (blk = 0; blk < FIR_GATHER_NUM_BLOCKS; blk++)
+            {
+                arm_fir_sparse_gather_f32(&fir_inst_fut,
+                                          fir_gather_signal + blk * FIR_GATHER_BLOCKSIZE,
+                                          filtering_output_fut,
+                                          FIR_GATHER_BLOCKSIZE);
+            });
+
+        /* Test correctness block by block */
+        arm_fir_sparse_init_f32(&fir_inst_ref, numTaps, fir_gather_coeffs[0],
+                                fir_sparse_state, fir_gather_delays[0],
+                                FIR_GATHER_MAX_DELAY, FIR_GATHER_BLOCKSIZE);
+        arm_fir_sparse_gather_init_f32(&fir_inst_fut, numTaps,
+                                       fir_gather_coeffs[0], fir_gather_state,
+                                       fir_gather_delays[0], fir_gather_offsets,
+                                       FIR_GATHER_MAX_DELAY, FIR_GATHER_BLOCKSIZE);
+
+        for (blk = 0; blk < FIR_GATHER_NUM_BLOCKS; blk++)
+        {
+            /* Switch both filters to the second pattern halfway */
+            if (blk == FIR_GATHER_NUM_BLOCKS / 2)
+            {
+                fir_inst_ref.pCoeffs = fir_gather_coeffs[1];
+                fir_inst_ref.pTapDelay = fir_gather_delays[1];
+                TEST_ASSERT_EQUAL(
+                    arm_fir_sparse_gather_set_taps_f32(&fir_inst_fut,
+                                                       fir_gather_coeffs[1],
+                                                       fir_gather_delays[1]),
+                    ARM_MATH_SUCCESS);
+            }
+
+            arm_fir_sparse_f32(&fir_inst_ref,
+                               fir_gather_signal + blk * FIR_GATHER_BLOCKSIZE,
+                               filtering_output_ref, filtering_scratch,
+                               FIR_GATHER_BLOCKSIZE);
+            arm_fir_sparse_gather_f32(&fir_inst_fut,
+                                      fir_gather_signal + blk * FIR_GATHER_BLOCKSIZE,
+                                      filtering_output_fut,
+                                      FIR_GATHER_BLOCKSIZE);
+
+            for (i = 0; i < FIR_GATHER_BLOCKSIZE; i++)
+            {
+                if (fabsf(filtering_output_fut[i] - filtering_output_ref[i]) > 1.0e-4f)
+                {
+                    JTEST_DUMP_STRF("Sample %d: %e, expected %e\n",
+                                    (int) (blk * FIR_GATHER_BLOCKSIZE + i),
+                                    (double) filtering_output_fut[i],
+                                    (double) filtering_output_ref[i]);
+                    return JTEST_TEST_FAILED;
+                }
+            }
+        }
+
+        /* A delay beyond maxDelay is rejected and leaves the taps alone */
+        bad_delay = fir_gather_delays[1][0];
+        fir_gather_delays[1][0] = FIR_GATHER_MAX_DELAY + 1;
+        TEST_ASSERT_EQUAL(
+            arm_fir_sparse_gather_set_taps_f32(&fir_inst_fut, fir_gather_coeffs[0],
+                                               fir_gather_delays[1]),
+            ARM_MATH_ARGUMENT_ERROR);
+        TEST_ASSERT_EQUAL(fir_inst_fut.pCoeffs, fir_gather_coeffs[1]);
+        fir_gather_delays[1][0] = bad_delay;
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  Crossfade test template. Arguments are: configuration suffix and fade
+  length. The filter starts on filtering_coeffs_f32, is switched to
+  filtering_coeffs_b_f32 at the start of block 3, and to
+  filtering_coeffs_c_f32 at block 5, while the first fade is still running
+  for fades longer than 64 samples. The output is compared against a double
+  precision model of the fades.
+*/
+#define FIR_XFADE_DEFINE_TEST(config_suffix, fade_len)                  \
+    JTEST_DEFINE_TEST(arm_fir_xfade_f32_##config_suffix##_test,         \
+                      arm_fir_xfade_f32)                                \
+    {                                                                   \
+        arm_fir_xfade_instance_f32 fir_inst_fut = { 0 };                \
+        arm_fir_instance_f32 fir_inst_ref = { 0 };                      \
+        const float32_t * pCoeffsA = filtering_coeffs_f32;              \
+        const float32_t * pCoeffsB = filtering_coeffs_b_f32;            \
+        const float32_t * pCoeffsC = filtering_coeffs_c_f32;            \
+        int32_t startB = 3 * FIR_XFADE_BLOCKSIZE;                       \
+        int32_t startC = 5 * FIR_XFADE_BLOCKSIZE;                       \
+        float64_t yA, yB, yC, expected, g;                              \
+        float64_t tol = 0.0;                                            \
+        uint32_t blk;                                                   \
+        int32_t n;                                                      \
+                                                                        \
+        fir_gather_setup(FIR_XFADE_NUMTAPS);                            \
+                                                                        \
+        /* The rounding error scales with the coefficient magnitudes */ \
+        for (n = 0; n < FIR_XFADE_NUMTAPS; n++)                         \
+        {                                                               \
+            tol += 1.0e-6 * (fabs(pCoeffsA[n]) + fabs(pCoeffsB[n]) +    \
+                             fabs(pCoeffsC[n]));                        \
+        }                                                               \
+                                                                        \
+        /* The queued set starts when the first fade ends */            \
+        if ((fade_len) > 0 && startB + (fade_len) > startC)             \
+        {                                                               \
+            startC = startB + (fade_len);                               \
+        }                                                               \
+                                                                        \
+        TEST_ASSERT_EQUAL(                                              \
+            arm_fir_xfade_init_f32(&fir_inst_fut, FIR_XFADE_NUMTAPS,    \
+                                   (float32_t *) pCoeffsA,              \
+                                   filtering_pState,                    \
+                                   FIR_XFADE_BLOCKSIZE, (fade_len)),    \
+            ARM_MATH_SUCCESS);                                          \
+                                                                        \
+        /* Display test parameter values */                             \
+        JTEST_DUMP_STRF("Block Size: %d\n"                              \
+                        "Number of Taps: %d\n"                          \
+                        "Fade Length: %d\n",                            \
+                        (int)FIR_XFADE_BLOCKSIZE,                       \
+                        (int)FIR_XFADE_NUMTAPS,                         \
+                        (int)(fade_len));                               \
+                                                                        \
+        for (blk = 0; blk < FIR_XFADE_NUM_BLOCKS; blk++)                \
+        {                                                               \
+            if (blk == 3)                                               \
+            {                                                           \
+                arm_fir_xfade_set_coeffs_f32(&fir_inst_fut,             \
+                                             (float32_t *) pCoeffsB);   \
+            }                                                           \
+                                                                        \
+            if (blk == 5)                                               \
+            {                                                           \
+                arm_fir_xfade_set_coeffs_f32(&fir_inst_fut,             \
+                                             (float32_t *) pCoeffsC);   \
+            }                                                           \
+                                                                        \
+            /* Display cycle count of a block inside and outside fades */ \
+            if ((blk == 0) || (blk == 3))                               \
+            {                                                           \
+                JTEST_COUNT_CYCLES(                                     \
+                    arm_fir_xfade_f32(&fir_inst_fut,                    \
+                                      fir_gather_signal + blk * FIR_XFADE_BLOCKSIZE, \
+                                      filtering_output_fut,             \
+                                      FIR_XFADE_BLOCKSIZE));            \
+            }                                                           \
+            else                                                        \
+            {                                                           \
+                arm_fir_xfade_f32(&fir_inst_fut,                        \
+                                  fir_gather_signal + blk * FIR_XFADE_BLOCKSIZE, \
+                                  filtering_output_fut,                 \
+                                  FIR_XFADE_BLOCKSIZE);                 \
+            }                                                           \
+                                                                        \
+            /* Test correctness */                                      \
+            for (n = blk * FIR_XFADE_BLOCKSIZE;                         \
+                 n < (int32_t) ((blk + 1) * FIR_XFADE_BLOCKSIZE); n++)  \
+            {                                                           \
+                yA = fir_xfade_ref(pCoeffsA, n);                        \
+                yB = fir_xfade_ref(pCoeffsB, n);                        \
+                yC = fir_xfade_ref(pCoeffsC, n);                        \
+                                                                        \
+                if (n < startB)                                         \
+                {                                                       \
+                    expected = yA;                                      \
+                }                                                       \
+                else if (n < startC)                                    \
+                {                                                       \
+                    g = ((fade_len) > 0) ?                              \
+                        (float64_t) (n - startB + 1) / (fade_len) : 1.0; \
+                    g = (g < 1.0) ? g : 1.0;                            \
+                    expected = yA + g * (yB - yA);                      \
+                }                                                       \
+                else                                                    \
+                {                                                       \
+                    g = ((fade_len) > 0) ?                              \
+                        (float64_t) (n - startC + 1) / (fade_len) : 1.0; \
+                    g = (g < 1.0) ? g : 1.0;                            \
+                    expected = yB + g * (yC - yB);                      \
+                }                                                       \
+                                                                        \
+                if (fabs(filtering_output_fut[n - blk * FIR_XFADE_BLOCKSIZE] - \
+                         expected) > tol)                               \
+                {                                                       \
+                    JTEST_DUMP_STRF("Sample %d: %e, expected %e\n",     \
+                                    (int) n,                            \
+                                    (double) filtering_output_fut[n - blk * FIR_XFADE_BLOCKSIZE], \
+                                    expected);                          \
+                    return JTEST_TEST_FAILED;                           \
+                }                                                       \
+            }                                                           \
+        }                                                               \
+                                                                        \
+        /* Cycle count of arm_fir_f32() on a block */                   \
+        arm_fir_init_f32(&fir_inst_ref, FIR_XFADE_NUMTAPS,              \
+                         (float32_t *) pCoeffsA, filtering_pState,      \
+                         FIR_XFADE_BLOCKSIZE);                          \
+        JTEST_COUNT_CYCLES(                                             \
+            arm_fir_f32(&fir_inst_ref, fir_gather_signal,               \
+                        filtering_output_ref, FIR_XFADE_BLOCKSIZE));    \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+FIR_XFADE_DEFINE_TEST(short, 48);
+FIR_XFADE_DEFINE_TEST(long, 100);
+FIR_XFADE_DEFINE_TEST(switch, 0);
+
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group. */
 /*--------------------------------------------------------------------------------*/
@@ -399,4 +733,10 @@ JTEST_DEFINE_GROUP(fir_tests)
    JTEST_TEST_CALL(arm_fir_sparse_q31_test);
    JTEST_TEST_CALL(arm_fir_sparse_q15_test);
    JTEST_TEST_CALL(arm_fir_sparse_q7_test);
+
+   JTEST_TEST_CALL(arm_fir_sparse_gather_f32_test);
+
+   JTEST_TEST_CALL(arm_fir_xfade_f32_short_test);
+   JTEST_TEST_CALL(arm_fir_xfade_f32_long_test);
+   JTEST_TEST_CALL(arm_fir_xfade_f32_switch_test);
 }
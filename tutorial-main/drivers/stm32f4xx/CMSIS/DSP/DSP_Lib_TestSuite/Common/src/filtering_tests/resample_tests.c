@@ -0,0 +1,427 @@
+#include "jtest.h"
+#include "filtering_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "filtering_templates.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Conformance Tests */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Each configuration is run over two consecutive blocks so that the position
+  carried from one call to the next is checked as well.
+*/
+#define RESAMPLE_CHECK_NUMOUT(numout_fut, numout_ref)                         \
+   do                                                                         \
+   {                                                                          \
+      if ((numout_fut) != (numout_ref))                                       \
+      {                                                                       \
+         JTEST_DUMP_STRF("Output count mismatch: %d instead of %d\n",         \
+                         (int)(numout_fut),                                   \
+                         (int)(numout_ref));                                  \
+         return JTEST_TEST_FAILED;                                            \
+      }                                                                       \
+   } while (0)
+
+#define FIR_RESAMPLE_DEFINE_TEST(suffix, output_type)                         \
+   JTEST_DEFINE_TEST(arm_fir_resample_##suffix##_test,                        \
+         arm_fir_resample_##suffix)                                           \
+   {                                                                          \
+      arm_fir_resample_instance_##suffix fir_inst_fut = { 0 };                \
+      arm_fir_resample_instance_##suffix fir_inst_ref = { 0 };                \
+      uint32_t numOut_fut, numOut_ref, numOut2;                               \
+                                                                              \
+      TEMPLATE_DO_ARR_DESC(                                                   \
+            blocksize_idx, uint32_t, blockSize, filtering_blocksizes          \
+            ,                                                                 \
+         TEMPLATE_DO_ARR_DESC(                                                \
+               numtaps_idx, uint16_t, numTaps, filtering_numtaps2             \
+               ,                                                              \
+            TEMPLATE_DO_ARR_DESC(                                             \
+                  L_idx, uint8_t, L, filtering_Ls                             \
+                  ,                                                           \
+               TEMPLATE_DO_ARR_DESC(                                          \
+                     M_idx, uint8_t, M, filtering_Ms                          \
+                     ,                                                        \
+                     /* Display test parameter values */                      \
+                     JTEST_DUMP_STRF("Block Size: %d\n"                       \
+                                     "Number of Taps: %d\n"                   \
+                                     "Upsample factor: %d\n"                  \
+                                     "Downsample factor: %d\n",               \
+                                     (int)blockSize,                          \
+                                     (int)numTaps,                            \
+                                     (int)L,                                  \
+                                     (int)M);                                 \
+                                                                              \
+                     /* Initialize the resampler Instances */                 \
+                     arm_fir_resample_init_##suffix(                          \
+                           &fir_inst_fut, L, M, numTaps,                      \
+                           (output_type*)filtering_coeffs_##suffix,           \
+                           (void *) filtering_pState, blockSize);             \
+                                                                              \
+                     JTEST_COUNT_CYCLES(                                      \
+                           numOut_fut = arm_fir_resample_##suffix(            \
+                                 &fir_inst_fut,                               \
+                                 (void *) filtering_##suffix##_inputs,        \
+                                 (void *) filtering_output_fut,               \
+                                 blockSize));                                 \
+                                                                              \
+                     numOut_fut += arm_fir_resample_##suffix(                 \
+                           &fir_inst_fut,                                     \
+                           (void *) (filtering_##suffix##_inputs + blockSize), \
+                           (output_type *) filtering_output_fut + numOut_fut, \
+                           blockSize);                                        \
+                                                                              \
+                     arm_fir_resample_init_##suffix(                          \
+                           &fir_inst_ref, L, M, numTaps,                      \
+                           (output_type*)filtering_coeffs_##suffix,           \
+                           (void *) filtering_pState, blockSize);             \
+                                                                              \
+                     numOut_ref = ref_fir_resample_##suffix(                  \
+                           &fir_inst_ref,                                     \
+                           (void *) filtering_##suffix##_inputs,              \
+                           (void *) filtering_output_ref,                     \
+                           blockSize);                                        \
+                                                                              \
+                     numOut2 = ref_fir_resample_##suffix(                     \
+                           &fir_inst_ref,                                     \
+                           (void *) (filtering_##suffix##_inputs + blockSize), \
+                           (output_type *) filtering_output_ref + numOut_ref, \
+                           blockSize);                                        \
+                     numOut_ref += numOut2;                                   \
+                                                                              \
+                     RESAMPLE_CHECK_NUMOUT(numOut_fut, numOut_ref);           \
+                                                                              \
+                     FILTERING_SNR_COMPARE_INTERFACE(                         \
+                           numOut_ref,                                        \
+                           output_type)))));                                  \
+                                                                              \
+            return JTEST_TEST_PASSED;                                         \
+   }
+
+#define FARROW_RESAMPLE_DEFINE_TEST(suffix, output_type)                      \
+   JTEST_DEFINE_TEST(arm_farrow_resample_##suffix##_test,                     \
+         arm_farrow_resample_##suffix)                                        \
+   {                                                                          \
+      arm_farrow_resample_instance_##suffix farrow_inst_fut = { 0 };          \
+      arm_farrow_resample_instance_##suffix farrow_inst_ref = { 0 };          \
+      uint32_t numOut_fut, numOut_ref, numOut2;                               \
+                                                                              \
+      TEMPLATE_DO_ARR_DESC(                                                   \
+            blocksize_idx, uint32_t, blockSize, filtering_blocksizes          \
+            ,                                                                 \
+         TEMPLATE_DO_ARR_DESC(                                                \
+               step_idx, uint32_t, step, filtering_farrow_steps               \
+               ,                                                              \
+               /* Display test parameter values */                            \
+               JTEST_DUMP_STRF("Block Size: %d\n"                             \
+                               "Step: 0x%08X\n",                              \
+                               (int)blockSize,                                \
+                               (unsigned int)step);                           \
+                                                                              \
+               /* Initialize the resampler Instances */                       \
+               arm_farrow_resample_init_##suffix(                             \
+                     &farrow_inst_fut, step,                                  \
+                     (void *) filtering_pState, blockSize);                   \
+                                                                              \
+               JTEST_COUNT_CYCLES(                                            \
+                     numOut_fut = arm_farrow_resample_##suffix(               \
+                           &farrow_inst_fut,                                  \
+                           (void *) filtering_##suffix##_inputs,              \
+                           (void *) filtering_output_fut,                     \
+                           blockSize));                                       \
+                                                                              \
+               numOut_fut += arm_farrow_resample_##suffix(                    \
+                     &farrow_inst_fut,                                        \
+                     (void *) (filtering_##suffix##_inputs + blockSize),      \
+                     (output_type *) filtering_output_fut + numOut_fut,       \
+                     blockSize);                                              \
+                                                                              \
+               arm_farrow_resample_init_##suffix(                             \
+                     &farrow_inst_ref, step,                                  \
+                     (void *) filtering_pState, blockSize);                   \
+                                                                              \
+               numOut_ref = ref_farrow_resample_##suffix(                     \
+                     &farrow_inst_ref,                                        \
+                     (void *) filtering_##suffix##_inputs,                    \
+                     (void *) filtering_output_ref,                           \
+                     blockSize);                                              \
+                                                                              \
+               numOut2 = ref_farrow_resample_##suffix(                        \
+                     &farrow_inst_ref,                                        \
+                     (void *) (filtering_##suffix##_inputs + blockSize),      \
+                     (output_type *) filtering_output_ref + numOut_ref,       \
+                     blockSize);                                              \
+               numOut_ref += numOut2;                                         \
+                                                                              \
+               RESAMPLE_CHECK_NUMOUT(numOut_fut, numOut_ref);                 \
+                                                                              \
+               FILTERING_SNR_COMPARE_INTERFACE(                               \
+                     numOut_ref,                                              \
+                     output_type)));                                          \
+                                                                              \
+            return JTEST_TEST_PASSED;                                         \
+   }
+
+FIR_RESAMPLE_DEFINE_TEST(f32, float32_t);
+FIR_RESAMPLE_DEFINE_TEST(q31, q31_t);
+FIR_RESAMPLE_DEFINE_TEST(q15, q15_t);
+FARROW_RESAMPLE_DEFINE_TEST(f32, float32_t);
+FARROW_RESAMPLE_DEFINE_TEST(q31, q31_t);
+FARROW_RESAMPLE_DEFINE_TEST(q15, q15_t);
+
+/*--------------------------------------------------------------------------------*/
+/* THD+N and Cycle Count Tests */
+/*--------------------------------------------------------------------------------*/
+
+#define RESAMPLE_BLOCKSIZE        32
+#define RESAMPLE_NUM_BLOCKS       64
+#define RESAMPLE_PHASELENGTH      16
+#define RESAMPLE_MAX_L            160
+#define RESAMPLE_TONE_AMPLITUDE   0.5
+#define RESAMPLE_TONE_FREQUENCY   (1000.0 / 44100.0)
+#define RESAMPLE_THDN_THRESHOLD   (-60.0)
+
+static float32_t resample_coeffs[RESAMPLE_MAX_L * RESAMPLE_PHASELENGTH];
+static float32_t resample_state[RESAMPLE_BLOCKSIZE + RESAMPLE_PHASELENGTH * RESAMPLE_MAX_L];
+static float32_t resample_input[RESAMPLE_BLOCKSIZE];
+static float32_t resample_output[RESAMPLE_BLOCKSIZE * 4];
+static float32_t resample_upsampled[RESAMPLE_BLOCKSIZE * 3];
+static float32_t resample_decimate_state[RESAMPLE_BLOCKSIZE * 3];
+static float32_t resample_unit_coeff[1] = { 1.0f };
+
+/**
+ *  Blackman windowed sinc lowpass for the rate L*fs with a passband gain of L
+ *  and a cutoff at 0.9 times the lower of the two Nyquist frequencies. The
+ *  response is symmetric so the time reversed order is the same.
+ */
+static void resample_design_lowpass(uint16_t L, uint16_t M, uint32_t numTaps)
+{
+   float64_t fc = 0.45 / (float64_t) ((L > M) ? L : M);
+   float64_t k, x, w;
+   uint32_t i;
+
+   for (i = 0; i < numTaps; i++)
+   {
+      k = (float64_t) i - (float64_t) (numTaps - 1) / 2.0;
+      x = 2.0 * PI * fc * k;
+      w = 0.42 - 0.5 * cos(2.0 * PI * i / (numTaps - 1))
+         + 0.08 * cos(4.0 * PI * i / (numTaps - 1));
+      resample_coeffs[i] = (float32_t) (L * 2.0 * fc * w * ((k == 0.0) ? 1.0 : sin(x) / x));
+   }
+}
+
+/**
+ *  Fill resample_input with the next block of the test tone.
+ */
+static void resample_make_input(uint32_t block)
+{
+   uint32_t i;
+
+   for (i = 0; i < RESAMPLE_BLOCKSIZE; i++)
+   {
+      resample_input[i] = (float32_t) (RESAMPLE_TONE_AMPLITUDE *
+         sin(2.0 * PI * RESAMPLE_TONE_FREQUENCY * (block * RESAMPLE_BLOCKSIZE + i)));
+   }
+}
+
+/**
+ *  Accumulate the power of the tone and of the error of the output samples.
+ *  Output sample m is expected at input time m * step - delay.
+ */
+static void resample_accumulate_error(
+   uint32_t firstOut,
+   uint32_t numOut,
+   float64_t step,
+   float64_t delay,
+   float64_t * pSignal,
+   float64_t * pError)
+{
+   float64_t t, ideal, err;
+   uint32_t i;
+
+   for (i = 0; i < numOut; i++)
+   {
+      t = (firstOut + i) * step - delay;
+
+      /* Skip the start-up transient of the filter */
+      if (t > 2.0 * RESAMPLE_PHASELENGTH)
+      {
+         ideal = RESAMPLE_TONE_AMPLITUDE * sin(2.0 * PI * RESAMPLE_TONE_FREQUENCY * t);
+         err = resample_output[i] - ideal;
+         *pSignal += ideal * ideal;
+         *pError += err * err;
+      }
+   }
+}
+
+JTEST_DEFINE_TEST(arm_fir_resample_f32_thdn_test,
+      arm_fir_resample_f32)
+{
+   arm_fir_resample_instance_f32 fir_inst;
+   uint16_t L = 160;
+   uint16_t M = 147;
+   uint32_t numTaps = L * RESAMPLE_PHASELENGTH;
+   uint32_t block, numOut, totalOut = 0;
+   float64_t signal = 0.0, error = 0.0, thdn;
+
+   /* 44.1 kHz to 48 kHz */
+   resample_design_lowpass(L, M, numTaps);
+   arm_fir_resample_init_f32(&fir_inst, L, M, numTaps, resample_coeffs,
+                             resample_state, RESAMPLE_BLOCKSIZE);
+
+   for (block = 0; block < RESAMPLE_NUM_BLOCKS; block++)
+   {
+      resample_make_input(block);
+
+      JTEST_COUNT_CYCLES(
+            numOut = arm_fir_resample_f32(
+                  &fir_inst,
+                  resample_input,
+                  resample_output,
+                  RESAMPLE_BLOCKSIZE));
+
+      JTEST_DUMP_STRF("Output samples: %d\n", (int)numOut);
+
+      resample_accumulate_error(totalOut, numOut,
+                                (float64_t) M / L,
+                                (float64_t) (numTaps - 1) / (2.0 * L),
+                                &signal, &error);
+      totalOut += numOut;
+   }
+
+   thdn = 10.0 * log10(error / signal);
+   JTEST_DUMP_STRF("THD+N: %d dB\n", (int)thdn);
+
+   if (thdn > RESAMPLE_THDN_THRESHOLD)
+   {
+      return JTEST_TEST_FAILED;
+   }
+
+   return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_farrow_resample_f32_thdn_test,
+      arm_farrow_resample_f32)
+{
+   arm_farrow_resample_instance_f32 farrow_inst;
+   uint32_t step = 0x00EB3333;  /* 44.1 / 48 in 8.24 format */
+   uint32_t block, numOut, totalOut = 0;
+   float64_t signal = 0.0, error = 0.0, thdn;
+
+   arm_farrow_resample_init_f32(&farrow_inst, step, resample_state,
+                                RESAMPLE_BLOCKSIZE);
+
+   for (block = 0; block < RESAMPLE_NUM_BLOCKS; block++)
+   {
+      resample_make_input(block);
+
+      JTEST_COUNT_CYCLES(
+            numOut = arm_farrow_resample_f32(
+                  &farrow_inst,
+                  resample_input,
+                  resample_output,
+                  RESAMPLE_BLOCKSIZE));
+
+      JTEST_DUMP_STRF("Output samples: %d\n", (int)numOut);
+
+      /* The interpolation window delays the output by two input samples */
+      resample_accumulate_error(totalOut, numOut,
+                                (float64_t) step / 16777216.0,
+                                2.0,
+                                &signal, &error);
+      totalOut += numOut;
+   }
+
+   thdn = 10.0 * log10(error / signal);
+   JTEST_DUMP_STRF("THD+N: %d dB\n", (int)thdn);
+
+   if (thdn > RESAMPLE_THDN_THRESHOLD)
+   {
+      return JTEST_TEST_FAILED;
+   }
+
+   return JTEST_TEST_PASSED;
+}
+
+/*
+  3/2 conversion with the polyphase converter and with the chain it replaces:
+  interpolation by 3 followed by keeping one sample in 2. Only the cycle
+  counts are of interest here.
+*/
+JTEST_DEFINE_TEST(arm_fir_resample_f32_chain_test,
+      arm_fir_resample_f32)
+{
+   arm_fir_resample_instance_f32 fir_inst;
+   arm_fir_interpolate_instance_f32 interp_inst;
+   arm_fir_decimate_instance_f32 decim_inst;
+   uint8_t L = 3;
+   uint8_t M = 2;
+   uint16_t numTaps = L * RESAMPLE_PHASELENGTH;
+   uint32_t numOut;
+
+   resample_design_lowpass(L, M, numTaps);
+   resample_make_input(0);
+
+   arm_fir_resample_init_f32(&fir_inst, L, M, numTaps, resample_coeffs,
+                             resample_state, RESAMPLE_BLOCKSIZE);
+
+   JTEST_COUNT_CYCLES(
+         numOut = arm_fir_resample_f32(
+               &fir_inst,
+               resample_input,
+               resample_output,
+               RESAMPLE_BLOCKSIZE));
+
+   JTEST_DUMP_STRF("Output samples: %d\n", (int)numOut);
+
+   arm_fir_interpolate_init_f32(&interp_inst, L, numTaps, resample_coeffs,
+                                resample_state, RESAMPLE_BLOCKSIZE);
+   arm_fir_decimate_init_f32(&decim_inst, 1, M, resample_unit_coeff,
+                             resample_decimate_state, RESAMPLE_BLOCKSIZE * L);
+
+   JTEST_COUNT_CYCLES(
+         arm_fir_interpolate_f32(
+               &interp_inst,
+               resample_input,
+               resample_upsampled,
+               RESAMPLE_BLOCKSIZE));
+
+   JTEST_COUNT_CYCLES(
+         arm_fir_decimate_f32(
+               &decim_inst,
+               resample_upsampled,
+               resample_output,
+               RESAMPLE_BLOCKSIZE * L));
+
+   if (numOut != (RESAMPLE_BLOCKSIZE * L) / M)
+   {
+      return JTEST_TEST_FAILED;
+   }
+
+   return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(resample_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_fir_resample_f32_test);
+    JTEST_TEST_CALL(arm_fir_resample_q31_test);
+    JTEST_TEST_CALL(arm_fir_resample_q15_test);
+    JTEST_TEST_CALL(arm_farrow_resample_f32_test);
+    JTEST_TEST_CALL(arm_farrow_resample_q31_test);
+    JTEST_TEST_CALL(arm_farrow_resample_q15_test);
+    JTEST_TEST_CALL(arm_fir_resample_f32_thdn_test);
+    JTEST_TEST_CALL(arm_farrow_resample_f32_thdn_test);
+    JTEST_TEST_CALL(arm_fir_resample_f32_chain_test);
+}
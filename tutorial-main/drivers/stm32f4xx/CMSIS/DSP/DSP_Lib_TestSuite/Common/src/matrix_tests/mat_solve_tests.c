@@ -0,0 +1,462 @@
+#include "jtest.h"
+#include "matrix_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "test_templates.h"
+#include "matrix_templates.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Buffers */
+/*--------------------------------------------------------------------------------*/
+
+/* Largest system size. The sizes go up to 128 on targets with enough memory for
+   three 128 x 192 double-precision matrices. */
+#ifndef MATRIX_SOLVE_BENCH_MAX_DIM
+#define MATRIX_SOLVE_BENCH_MAX_DIM 64
+#endif
+
+/* The least-squares tests use half as many extra rows as columns */
+#define MATRIX_SOLVE_MAX_ROWS                                       \
+    (MATRIX_SOLVE_BENCH_MAX_DIM + MATRIX_SOLVE_BENCH_MAX_DIM / 2)
+#define MATRIX_SOLVE_MAX_ELTS                                       \
+    (MATRIX_SOLVE_MAX_ROWS * MATRIX_SOLVE_BENCH_MAX_DIM)
+#define MATRIX_SOLVE_NUM_RHS 2
+
+/* The f32 tests use the first half of each buffer */
+static float64_t mat_solve_a[MATRIX_SOLVE_MAX_ELTS];
+static float64_t mat_solve_factors[MATRIX_SOLVE_MAX_ELTS];
+static float64_t mat_solve_inverse[MATRIX_SOLVE_MAX_ELTS];
+static float64_t mat_solve_b[MATRIX_SOLVE_MAX_ROWS * MATRIX_SOLVE_NUM_RHS];
+static float64_t mat_solve_x[MATRIX_SOLVE_MAX_ROWS * MATRIX_SOLVE_NUM_RHS];
+static float64_t mat_solve_tau[MATRIX_SOLVE_BENCH_MAX_DIM];
+static uint16_t mat_solve_pivots[MATRIX_SOLVE_BENCH_MAX_DIM];
+
+static const uint16_t mat_solve_dims[] = {4, 8, 16, 32, 64, 128};
+
+/*--------------------------------------------------------------------------------*/
+/* Helper Functions */
+/*--------------------------------------------------------------------------------*/
+
+/**
+ *  Define the helpers for one data type: fill a buffer with reproducible values
+ *  in [-1, 1), build a symmetric positive definite matrix, multiply matrices in
+ *  double precision and measure the residuals of a solution.
+ *
+ *  The residual of a solve is |A * x - b| / (|A| * |x| + |b|) in the infinity
+ *  norm. For a least-squares solve it is |A' * (A * x - b)| / (|A|^2 * |x| + |A| * |b|),
+ *  which is zero at the minimum.
+ */
+#define MAT_SOLVE_DEFINE_HELPERS(suffix, type)                                  \
+    static void mat_solve_fill_##suffix(type * pDst, uint32_t n, uint32_t seed) \
+    {                                                                           \
+        uint32_t i;                                                             \
+                                                                                \
+        for (i = 0; i < n; i++)                                                 \
+        {                                                                       \
+            seed = seed * 1664525U + 1013904223U;                               \
+            pDst[i] = (type) ((int32_t) seed >> 8) / (type) 8388608.0;          \
+        }                                                                       \
+    }                                                                           \
+                                                                                \
+    static void mat_solve_spd_##suffix(type * pDst, const type * pG, uint32_t n) \
+    {                                                                           \
+        uint32_t i, j, k;                                                       \
+        float64_t sum;                                                          \
+                                                                                \
+        /* G * G' / n + I */                                                    \
+        for (i = 0; i < n; i++)                                                 \
+        {                                                                       \
+            for (j = 0; j < n; j++)                                             \
+            {                                                                   \
+                sum = (i == j) ? 1.0 : 0.0;                                     \
+                                                                                \
+                for (k = 0; k < n; k++)                                         \
+                {                                                               \
+                    sum += (float64_t) pG[i * n + k] * pG[j * n + k] / n;       \
+                }                                                               \
+                                                                                \
+                pDst[i * n + j] = (type) sum;                                   \
+            }                                                                   \
+        }                                                                       \
+    }                                                                           \
+                                                                                \
+    static void mat_solve_mult_##suffix(                                        \
+        const arm_matrix_instance_##suffix * pSrcA,                             \
+        const arm_matrix_instance_##suffix * pSrcB,                             \
+        arm_matrix_instance_##suffix * pDst)                                    \
+    {                                                                           \
+        uint32_t i, j, k;                                                       \
+        float64_t sum;                                                          \
+                                                                                \
+        for (i = 0; i < pSrcA->numRows; i++)                                    \
+        {                                                                       \
+            for (j = 0; j < pSrcB->numCols; j++)                                \
+            {                                                                   \
+                sum = 0.0;                                                      \
+                                                                                \
+                for (k = 0; k < pSrcA->numCols; k++)                            \
+                {                                                               \
+                    sum += (float64_t) pSrcA->pData[i * pSrcA->numCols + k] *   \
+                        pSrcB->pData[k * pSrcB->numCols + j];                   \
+                }                                                               \
+                                                                                \
+                pDst->pData[i * pDst->numCols + j] = (type) sum;                \
+            }                                                                   \
+        }                                                                       \
+    }                                                                           \
+                                                                                \
+    static float64_t mat_solve_norm_##suffix(const type * pSrc,                 \
+                                             uint32_t rows, uint32_t cols)      \
+    {                                                                           \
+        uint32_t i, j;                                                          \
+        float64_t sum, norm = 0.0;                                              \
+                                                                                \
+        for (i = 0; i < rows; i++)                                              \
+        {                                                                       \
+            sum = 0.0;                                                          \
+                                                                                \
+            for (j = 0; j < cols; j++)                                          \
+            {                                                                   \
+                sum += fabs(pSrc[i * cols + j]);                                \
+            }                                                                   \
+                                                                                \
+            norm = (sum > norm) ? sum : norm;                                   \
+        }                                                                       \
+                                                                                \
+        return norm;                                                            \
+    }                                                                           \
+                                                                                \
+    static float64_t mat_solve_residual_##suffix(                               \
+        const type * pA, uint32_t rows, uint32_t cols,                          \
+        const type * pX, const type * pB, uint32_t normal)                      \
+    {                                                                           \
+        static float64_t r[MATRIX_SOLVE_MAX_ROWS * MATRIX_SOLVE_NUM_RHS];       \
+        float64_t normA, normX, normB, sum, err = 0.0;                          \
+        uint32_t i, j, k;                                                       \
+                                                                                \
+        /* r = A * x - b */                                                     \
+        for (i = 0; i < rows; i++)                                              \
+        {                                                                       \
+            for (j = 0; j < MATRIX_SOLVE_NUM_RHS; j++)                          \
+            {                                                                   \
+                sum = -(float64_t) pB[i * MATRIX_SOLVE_NUM_RHS + j];            \
+                                                                                \
+                for (k = 0; k < cols; k++)                                      \
+                {                                                               \
+                    sum += (float64_t) pA[i * cols + k] *                       \
+                        pX[k * MATRIX_SOLVE_NUM_RHS + j];                       \
+                }                                                               \
+                                                                                \
+                r[i * MATRIX_SOLVE_NUM_RHS + j] = sum;                          \
+            }                                                                   \
+        }                                                                       \
+                                                                                \
+        normA = mat_solve_norm_##suffix(pA, rows, cols);                        \
+        normX = mat_solve_norm_##suffix(pX, cols, MATRIX_SOLVE_NUM_RHS);        \
+        normB = mat_solve_norm_##suffix(pB, rows, MATRIX_SOLVE_NUM_RHS);        \
+                                                                                \
+        for (j = 0; j < MATRIX_SOLVE_NUM_RHS; j++)                              \
+        {                                                                       \
+            if (normal)                                                         \
+            {                                                                   \
+                /* A' * r */                                                    \
+                for (k = 0; k < cols; k++)                                      \
+                {                                                               \
+                    sum = 0.0;                                                  \
+                                                                                \
+                    for (i = 0; i < rows; i++)                                  \
+                    {                                                           \
+                        sum += pA[i * cols + k] * r[i * MATRIX_SOLVE_NUM_RHS + j]; \
+                    }                                                           \
+                                                                                \
+                    err = (fabs(sum) > err) ? fabs(sum) : err;                  \
+                }                                                               \
+            }                                                                   \
+            else                                                                \
+            {                                                                   \
+                for (i = 0; i < rows; i++)                                      \
+                {                                                               \
+                    sum = fabs(r[i * MATRIX_SOLVE_NUM_RHS + j]);                \
+                    err = (sum > err) ? sum : err;                              \
+                }                                                               \
+            }                                                                   \
+        }                                                                       \
+                                                                                \
+        return (normal) ? err / (normA * normA * normX + normA * normB) :       \
+            err / (normA * normX + normB);                                      \
+    }
+
+MAT_SOLVE_DEFINE_HELPERS(f32, float32_t)
+MAT_SOLVE_DEFINE_HELPERS(f64, float64_t)
+
+/* The inverse is multiplied by the library function where there is one */
+#define MAT_SOLVE_INVERSE_MULT_f32 arm_mat_mult_f32
+#define MAT_SOLVE_INVERSE_MULT_f64 mat_solve_mult_f64
+
+/**
+ *  Fail the test if a residual exceeds the threshold.
+ */
+#define MAT_SOLVE_ASSERT_RESIDUAL(name, residual, threshold)            \
+    do                                                                  \
+    {                                                                   \
+        if ((residual) > (threshold))                                   \
+        {                                                               \
+            JTEST_DUMP_STRF("%s residual: %e\n", name, (residual));     \
+            return JTEST_TEST_FAILED;                                   \
+        }                                                               \
+    } while (0)
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Solve test template. Every decomposition is timed together with its solve and
+  the residual of the solution is checked against a bound of 100 * n units of
+  roundoff. The inverse-then-multiply path is timed for comparison and its
+  residual is only displayed.
+*/
+#define MAT_SOLVE_DEFINE_TEST(suffix, type, epsilon)                            \
+    JTEST_DEFINE_TEST(arm_mat_solve_##suffix##_test,                            \
+                      arm_mat_lu_solve_##suffix)                                \
+    {                                                                           \
+        arm_matrix_instance_##suffix matA, matF, matInv, matB, matX;            \
+        type * pA = (type *) mat_solve_a;                                       \
+        type * pF = (type *) mat_solve_factors;                                 \
+        type * pB = (type *) mat_solve_b;                                       \
+        type * pX = (type *) mat_solve_x;                                       \
+        type * pTau = (type *) mat_solve_tau;                                   \
+        float64_t threshold;                                                    \
+        float64_t residual;                                                     \
+        arm_status status;                                                      \
+        uint32_t dim_idx;                                                       \
+        uint16_t n, rows;                                                       \
+                                                                                \
+        for (dim_idx = 0;                                                       \
+             dim_idx < sizeof(mat_solve_dims) / sizeof(mat_solve_dims[0]);      \
+             dim_idx++)                                                         \
+        {                                                                       \
+            n = mat_solve_dims[dim_idx];                                        \
+                                                                                \
+            if (n > MATRIX_SOLVE_BENCH_MAX_DIM)                                 \
+            {                                                                   \
+                continue;                                                       \
+            }                                                                   \
+                                                                                \
+            threshold = 100.0 * n * (epsilon);                                  \
+                                                                                \
+            JTEST_DUMP_STRF("Matrix Dimensions: %dx%d\n", (int)n, (int)n);      \
+                                                                                \
+            matA.numRows = n; matA.numCols = n; matA.pData = pA;                \
+            matF.numRows = n; matF.numCols = n; matF.pData = pF;                \
+            matInv.numRows = n; matInv.numCols = n;                             \
+            matInv.pData = (type *) mat_solve_inverse;                          \
+            matB.numRows = n; matB.numCols = MATRIX_SOLVE_NUM_RHS;              \
+            matB.pData = pB;                                                    \
+            matX.numRows = n; matX.numCols = MATRIX_SOLVE_NUM_RHS;              \
+            matX.pData = pX;                                                    \
+                                                                                \
+            /* General system, b = A * x for a known x */                       \
+            mat_solve_fill_##suffix(pA, n * n, n);                              \
+            mat_solve_fill_##suffix(pX, n * MATRIX_SOLVE_NUM_RHS, n + 1U);      \
+            mat_solve_mult_##suffix(&matA, &matX, &matB);                       \
+                                                                                \
+            /* LU, solved in place */                                           \
+            memcpy(pX, pB, n * MATRIX_SOLVE_NUM_RHS * sizeof(type));            \
+            JTEST_COUNT_CYCLES(                                                 \
+                status = arm_mat_lu_##suffix(&matA, &matF, mat_solve_pivots));  \
+            TEST_ASSERT_EQUAL(status, ARM_MATH_SUCCESS);                        \
+            JTEST_COUNT_CYCLES(                                                 \
+                arm_mat_lu_solve_##suffix(&matF, mat_solve_pivots,              \
+                                          &matX, &matX));                       \
+            residual = mat_solve_residual_##suffix(pA, n, n, pX, pB, 0U);       \
+            MAT_SOLVE_ASSERT_RESIDUAL("LU", residual, threshold);               \
+                                                                                \
+            /* QR, decomposed in place */                                       \
+            memcpy(pF, pA, n * n * sizeof(type));                               \
+            memcpy(pX, pB, n * MATRIX_SOLVE_NUM_RHS * sizeof(type));            \
+            JTEST_COUNT_CYCLES(                                                 \
+                arm_mat_qr_##suffix(&matF, &matF, pTau));                       \
+            JTEST_COUNT_CYCLES(                                                 \
+                status = arm_mat_qr_solve_##suffix(&matF, pTau, &matX, &matX)); \
+            TEST_ASSERT_EQUAL(status, ARM_MATH_SUCCESS);                        \
+            residual = mat_solve_residual_##suffix(pA, n, n, pX, pB, 0U);       \
+            MAT_SOLVE_ASSERT_RESIDUAL("QR", residual, threshold);               \
+                                                                                \
+            /* Inverse then multiply, for comparison. The inverse destroys */   \
+            /* its input. */                                                    \
+            memcpy(pF, pA, n * n * sizeof(type));                               \
+            JTEST_COUNT_CYCLES(                                                 \
+                arm_mat_inverse_##suffix(&matF, &matInv));                      \
+            JTEST_COUNT_CYCLES(                                                 \
+                MAT_SOLVE_INVERSE_MULT_##suffix(&matInv, &matB, &matX));        \
+            residual = mat_solve_residual_##suffix(pA, n, n, pX, pB, 0U);       \
+            JTEST_DUMP_STRF("Inverse residual: %e\n", residual);                \
+                                                                                \
+            /* Symmetric positive definite system */                            \
+            mat_solve_fill_##suffix(pF, n * n, n + 2U);                         \
+            mat_solve_spd_##suffix(pA, pF, n);                                  \
+            mat_solve_fill_##suffix(pX, n * MATRIX_SOLVE_NUM_RHS, n + 3U);      \
+            mat_solve_mult_##suffix(&matA, &matX, &matB);                       \
+                                                                                \
+            /* Cholesky, decomposed in place */                                 \
+            memcpy(pF, pA, n * n * sizeof(type));                               \
+            JTEST_COUNT_CYCLES(                                                 \
+                status = arm_mat_cholesky_##suffix(&matF, &matF));              \
+            TEST_ASSERT_EQUAL(status, ARM_MATH_SUCCESS);                        \
+            JTEST_COUNT_CYCLES(                                                 \
+                arm_mat_cholesky_solve_##suffix(&matF, &matB, &matX));          \
+            residual = mat_solve_residual_##suffix(pA, n, n, pX, pB, 0U);       \
+            MAT_SOLVE_ASSERT_RESIDUAL("Cholesky", residual, threshold);         \
+                                                                                \
+            /* LDLT */                                                          \
+            JTEST_COUNT_CYCLES(                                                 \
+                status = arm_mat_ldlt_##suffix(&matA, &matF));                  \
+            TEST_ASSERT_EQUAL(status, ARM_MATH_SUCCESS);                        \
+            JTEST_COUNT_CYCLES(                                                 \
+                arm_mat_ldlt_solve_##suffix(&matF, &matB, &matX));              \
+            residual = mat_solve_residual_##suffix(pA, n, n, pX, pB, 0U);       \
+            MAT_SOLVE_ASSERT_RESIDUAL("LDLT", residual, threshold);             \
+                                                                                \
+            /* Least squares with more equations than unknowns */               \
+            rows = n + n / 2U;                                                  \
+            matA.numRows = rows;                                                \
+            matF.numRows = rows;                                                \
+            matB.numRows = rows;                                                \
+            mat_solve_fill_##suffix(pA, rows * n, n + 4U);                      \
+            mat_solve_fill_##suffix(pB, rows * MATRIX_SOLVE_NUM_RHS, n + 5U);   \
+            memcpy(pX, pB, rows * MATRIX_SOLVE_NUM_RHS * sizeof(type));         \
+            matB.pData = pX;                                                    \
+                                                                                \
+            JTEST_COUNT_CYCLES(                                                 \
+                arm_mat_qr_##suffix(&matA, &matF, pTau));                       \
+            JTEST_COUNT_CYCLES(                                                 \
+                status = arm_mat_qr_solve_##suffix(&matF, pTau, &matB, &matX)); \
+            TEST_ASSERT_EQUAL(status, ARM_MATH_SUCCESS);                        \
+            residual = mat_solve_residual_##suffix(pA, rows, n, pX, pB, 1U);    \
+            MAT_SOLVE_ASSERT_RESIDUAL("Least squares", residual, threshold);    \
+        }                                                                       \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+MAT_SOLVE_DEFINE_TEST(f32, float32_t, 1.1920929e-7);
+MAT_SOLVE_DEFINE_TEST(f64, float64_t, 2.220446049250313e-16);
+
+/*
+  Triangular solves on their own, out of place and in place.
+*/
+#define MAT_TRIANGULAR_DEFINE_TEST(suffix, type, epsilon)                       \
+    JTEST_DEFINE_TEST(arm_mat_solve_triangular_##suffix##_test,                 \
+                      arm_mat_solve_lower_triangular_##suffix)                  \
+    {                                                                           \
+        arm_matrix_instance_##suffix matA, matB, matX;                          \
+        type * pA = (type *) mat_solve_a;                                       \
+        type * pB = (type *) mat_solve_b;                                       \
+        type * pX = (type *) mat_solve_x;                                       \
+        uint32_t i, j;                                                          \
+        uint16_t n = 16;                                                        \
+                                                                                \
+        matA.numRows = n; matA.numCols = n; matA.pData = pA;                    \
+        matB.numRows = n; matB.numCols = MATRIX_SOLVE_NUM_RHS; matB.pData = pB; \
+        matX.numRows = n; matX.numCols = MATRIX_SOLVE_NUM_RHS; matX.pData = pX; \
+                                                                                \
+        /* Lower triangle with a dominant diagonal */                           \
+        mat_solve_fill_##suffix(pA, n * n, 7U);                                 \
+        for (i = 0; i < n; i++)                                                 \
+        {                                                                       \
+            pA[i * n + i] += (type) 2.0;                                        \
+            for (j = i + 1U; j < n; j++)                                        \
+            {                                                                   \
+                pA[i * n + j] = (type) 0.0;                                     \
+            }                                                                   \
+        }                                                                       \
+                                                                                \
+        mat_solve_fill_##suffix(pB, n * MATRIX_SOLVE_NUM_RHS, 8U);              \
+                                                                                \
+        JTEST_COUNT_CYCLES(                                                     \
+            arm_mat_solve_lower_triangular_##suffix(&matA, &matB, &matX));      \
+        MAT_SOLVE_ASSERT_RESIDUAL(                                              \
+            "Lower",                                                            \
+            mat_solve_residual_##suffix(pA, n, n, pX, pB, 0U),                  \
+            100.0 * n * (epsilon));                                             \
+                                                                                \
+        /* Upper triangle: transpose in place */                                \
+        for (i = 0; i < n; i++)                                                 \
+        {                                                                       \
+            for (j = i + 1U; j < n; j++)                                        \
+            {                                                                   \
+                pA[i * n + j] = pA[j * n + i];                                  \
+                pA[j * n + i] = (type) 0.0;                                     \
+            }                                                                   \
+        }                                                                       \
+                                                                                \
+        memcpy(pX, pB, n * MATRIX_SOLVE_NUM_RHS * sizeof(type));                \
+                                                                                \
+        JTEST_COUNT_CYCLES(                                                     \
+            arm_mat_solve_upper_triangular_##suffix(&matA, &matX, &matX));      \
+        MAT_SOLVE_ASSERT_RESIDUAL(                                              \
+            "Upper",                                                            \
+            mat_solve_residual_##suffix(pA, n, n, pX, pB, 0U),                  \
+            100.0 * n * (epsilon));                                             \
+                                                                                \
+        /* A zero on the diagonal is reported */                                \
+        pA[5 * n + 5] = (type) 0.0;                                             \
+        TEST_ASSERT_EQUAL(                                                      \
+            arm_mat_solve_upper_triangular_##suffix(&matA, &matB, &matX),       \
+            ARM_MATH_SINGULAR);                                                 \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+MAT_TRIANGULAR_DEFINE_TEST(f32, float32_t, 1.1920929e-7);
+MAT_TRIANGULAR_DEFINE_TEST(f64, float64_t, 2.220446049250313e-16);
+
+/*
+  Matrices that do not have the properties required by a decomposition.
+*/
+JTEST_DEFINE_TEST(arm_mat_decomposition_failure_test,
+                  arm_mat_cholesky_f32)
+{
+    float32_t indefinite[4] = { 1.0f, 2.0f, 2.0f, 1.0f };
+    float32_t singular[4] = { 1.0f, 2.0f, 2.0f, 4.0f };
+    float32_t zeroPivot[4] = { 0.0f, 1.0f, 1.0f, 0.0f };
+    float32_t factors[4];
+    arm_matrix_instance_f32 matA = { 2, 2, indefinite };
+    arm_matrix_instance_f32 matF = { 2, 2, factors };
+
+    TEST_ASSERT_EQUAL(arm_mat_cholesky_f32(&matA, &matF),
+                      ARM_MATH_DECOMPOSITION_FAILURE);
+
+    /* LDLT handles the indefinite matrix but not a zero leading pivot */
+    TEST_ASSERT_EQUAL(arm_mat_ldlt_f32(&matA, &matF), ARM_MATH_SUCCESS);
+    matA.pData = zeroPivot;
+    TEST_ASSERT_EQUAL(arm_mat_ldlt_f32(&matA, &matF),
+                      ARM_MATH_DECOMPOSITION_FAILURE);
+
+    /* LU pivots around the zero but detects the singular matrix */
+    TEST_ASSERT_EQUAL(arm_mat_lu_f32(&matA, &matF, mat_solve_pivots),
+                      ARM_MATH_SUCCESS);
+    matA.pData = singular;
+    TEST_ASSERT_EQUAL(arm_mat_lu_f32(&matA, &matF, mat_solve_pivots),
+                      ARM_MATH_SINGULAR);
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(mat_solve_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_mat_solve_f32_test);
+    JTEST_TEST_CALL(arm_mat_solve_f64_test);
+    JTEST_TEST_CALL(arm_mat_solve_triangular_f32_test);
+    JTEST_TEST_CALL(arm_mat_solve_triangular_f64_test);
+    JTEST_TEST_CALL(arm_mat_decomposition_failure_test);
+}
@@ -0,0 +1,430 @@
+#include "jtest.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "test_templates.h"
+#include "type_abbrev.h"
+#include <math.h>
+#include <string.h>
+
+/*--------------------------------------------------------------------------------*/
+/* Buffers */
+/*--------------------------------------------------------------------------------*/
+
+/* Largest window tested, override to test longer windows */
+#ifndef STATISTICS_MOV_MAX_WINDOW
+#define STATISTICS_MOV_MAX_WINDOW 4096
+#endif
+
+/* Number of samples fed to each moving window function */
+#ifndef STATISTICS_MOV_STREAM_LEN
+#define STATISTICS_MOV_STREAM_LEN 1024
+#endif
+
+/* Splits the stream in two calls, to check that the state carries over */
+#define STATISTICS_MOV_SPLIT 101
+
+static const uint16_t mov_win_sizes[] = {1, 2, 3, 8, 33, 64, 512, STATISTICS_MOV_MAX_WINDOW};
+
+/* The stream follows STATISTICS_MOV_MAX_WINDOW zeros, the initial window */
+static float32_t mov_src_f32[STATISTICS_MOV_MAX_WINDOW + STATISTICS_MOV_STREAM_LEN];
+static q15_t mov_src_q15[STATISTICS_MOV_MAX_WINDOW + STATISTICS_MOV_STREAM_LEN];
+
+static float32_t mov_state_f32[2 * STATISTICS_MOV_MAX_WINDOW];
+static q15_t mov_state_q15[2 * STATISTICS_MOV_MAX_WINDOW];
+static uint32_t mov_index_u32[2 * STATISTICS_MOV_MAX_WINDOW];
+static uint16_t mov_index_u16[2 * STATISTICS_MOV_MAX_WINDOW];
+static float32_t mov_scratch_f32[STATISTICS_MOV_MAX_WINDOW];
+
+static float32_t mov_fut_a_f32[STATISTICS_MOV_STREAM_LEN];
+static float32_t mov_fut_b_f32[STATISTICS_MOV_STREAM_LEN];
+static float32_t mov_ref_a_f32[STATISTICS_MOV_STREAM_LEN];
+static float32_t mov_ref_b_f32[STATISTICS_MOV_STREAM_LEN];
+static q15_t mov_fut_a_q15[STATISTICS_MOV_STREAM_LEN];
+static q15_t mov_fut_b_q15[STATISTICS_MOV_STREAM_LEN];
+static q15_t mov_ref_a_q15[STATISTICS_MOV_STREAM_LEN];
+static q15_t mov_ref_b_q15[STATISTICS_MOV_STREAM_LEN];
+
+/*--------------------------------------------------------------------------------*/
+/* Helper Functions */
+/*--------------------------------------------------------------------------------*/
+
+/**
+ *  Fill the streams with noise that steps up by a large offset half way, so
+ *  that the windows see a change of mean.
+ */
+static void mov_fill_streams(void)
+{
+    uint32_t seed = 0x1357U;
+    uint32_t i;
+    int32_t noise;
+
+    for (i = 0; i < STATISTICS_MOV_STREAM_LEN; i++)
+    {
+        seed = seed * 1664525U + 1013904223U;
+        noise = (int32_t) seed >> 16;
+
+        mov_src_f32[STATISTICS_MOV_MAX_WINDOW + i] =
+            ((i < STATISTICS_MOV_STREAM_LEN / 2) ? 0.0f : 1000.0f) +
+            (float32_t) noise / 32768.0f;
+        mov_src_q15[STATISTICS_MOV_MAX_WINDOW + i] = (q15_t)
+            (((i < STATISTICS_MOV_STREAM_LEN / 2) ? 0 : 8192) + (noise >> 2));
+    }
+}
+
+/**
+ *  Element k of the n first samples of the scratch buffer once sorted, by
+ *  quickselect.
+ */
+static float32_t mov_ref_select_scratch(
+    uint32_t n,
+    uint32_t k)
+{
+    float32_t * a = mov_scratch_f32;
+    float32_t pivot, tmp;
+    int32_t lo = 0;
+    int32_t hi = (int32_t) n - 1;
+    int32_t i, j;
+
+    while (lo < hi)
+    {
+        pivot = a[(lo + hi) / 2];
+        i = lo;
+        j = hi;
+
+        while (i <= j)
+        {
+            while (a[i] < pivot) i++;
+            while (a[j] > pivot) j--;
+
+            if (i <= j)
+            {
+                tmp = a[i];
+                a[i] = a[j];
+                a[j] = tmp;
+                i++;
+                j--;
+            }
+        }
+
+        if ((int32_t) k <= j)
+        {
+            hi = j;
+        }
+        else if ((int32_t) k >= i)
+        {
+            lo = i;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    return a[k];
+}
+
+/**
+ *  Element k of the sorted window.
+ */
+static float32_t mov_ref_select_f32(
+    const float32_t * pSrc,
+    uint32_t n,
+    uint32_t k)
+{
+    memcpy(mov_scratch_f32, pSrc, n * sizeof(float32_t));
+
+    return mov_ref_select_scratch(n, k);
+}
+
+/**
+ *  Element k of the sorted window, Q15 data converts exactly.
+ */
+static q15_t mov_ref_select_q15(
+    const q15_t * pSrc,
+    uint32_t n,
+    uint32_t k)
+{
+    uint32_t i;
+
+    for (i = 0; i < n; i++)
+    {
+        mov_scratch_f32[i] = pSrc[i];
+    }
+
+    return (q15_t) mov_ref_select_scratch(n, k);
+}
+
+/**
+ *  First sample of the window that ends with output t.
+ */
+#define MOV_WINDOW(src, win_len, t)                                     \
+    ((src) + STATISTICS_MOV_MAX_WINDOW + (t) + 1 - (win_len))
+
+/**
+ *  Feed the whole stream to a moving window function in two calls, timed.
+ */
+#define MOV_RUN_FUT(fn, inst, src, out_a, out_b)                        \
+    JTEST_COUNT_CYCLES(                                                 \
+        fn(&(inst), (src) + STATISTICS_MOV_MAX_WINDOW,                  \
+           (out_a), (out_b), STATISTICS_MOV_SPLIT);                     \
+        fn(&(inst), (src) + STATISTICS_MOV_MAX_WINDOW + STATISTICS_MOV_SPLIT, \
+           (out_a) + STATISTICS_MOV_SPLIT, (out_b) + STATISTICS_MOV_SPLIT, \
+           STATISTICS_MOV_STREAM_LEN - STATISTICS_MOV_SPLIT))
+
+/**
+ *  Fail the test if two outputs differ by more than tol relative to the
+ *  reference plus scale.
+ */
+#define MOV_ASSERT_CLOSE(fut, ref, scale, tol)                          \
+    do                                                                  \
+    {                                                                   \
+        uint32_t t_idx;                                                 \
+        for (t_idx = 0; t_idx < STATISTICS_MOV_STREAM_LEN; t_idx++)     \
+        {                                                               \
+            if (fabs((float64_t) (fut)[t_idx] - (ref)[t_idx]) >         \
+                (tol) * (fabs((float64_t) (ref)[t_idx]) + (scale)))     \
+            {                                                           \
+                JTEST_DUMP_STRF("Output %d: %e, expected %e\n",         \
+                                (int) t_idx, (double) (fut)[t_idx],     \
+                                (double) (ref)[t_idx]);                 \
+                return JTEST_TEST_FAILED;                               \
+            }                                                           \
+        }                                                               \
+    } while (0)
+
+/**
+ *  Fail the test if two outputs differ.
+ */
+#define MOV_ASSERT_EXACT(fut, ref) MOV_ASSERT_CLOSE(fut, ref, 0.0, 0.0)
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Each test feeds the stream to the moving window function and then computes
+  every output again with the block functions on the window, which is the
+  O(winLen) per sample method the moving window functions replace. Both are
+  timed.
+*/
+
+JTEST_DEFINE_TEST(arm_mov_stats_f32_test, arm_mov_stats_f32)
+{
+    arm_mov_stats_instance_f32 mov_inst;
+    uint32_t win_idx;
+    uint32_t win_len;
+    uint32_t t;
+
+    mov_fill_streams();
+    TEST_ASSERT_EQUAL(arm_mov_stats_init_f32(&mov_inst, 0, mov_state_f32),
+                      ARM_MATH_ARGUMENT_ERROR);
+
+    for (win_idx = 0; win_idx < sizeof(mov_win_sizes) / sizeof(mov_win_sizes[0]); win_idx++)
+    {
+        win_len = mov_win_sizes[win_idx];
+        JTEST_DUMP_STRF("Window: %d\n", (int) win_len);
+
+        TEST_ASSERT_EQUAL(arm_mov_stats_init_f32(&mov_inst, win_len, mov_state_f32),
+                          ARM_MATH_SUCCESS);
+
+        /* Display cycle count and run test */
+        MOV_RUN_FUT(arm_mov_stats_f32, mov_inst, mov_src_f32,
+                    mov_fut_a_f32, mov_fut_b_f32);
+
+        /* Cycle count of the block functions on every window */
+        JTEST_COUNT_CYCLES(
+            for (t = 0; t < STATISTICS_MOV_STREAM_LEN; t++)
+            {
+                arm_mean_f32(MOV_WINDOW(mov_src_f32, win_len, t), win_len, &mov_ref_a_f32[t]);
+                arm_var_f32(MOV_WINDOW(mov_src_f32, win_len, t), win_len, &mov_ref_b_f32[t]);
+            });
+
+        /* Test correctness, the means are up to 1000 and the noise power 1/3 */
+        MOV_ASSERT_CLOSE(mov_fut_a_f32, mov_ref_a_f32, 1.0, 1.0e-5);
+        MOV_ASSERT_CLOSE(mov_fut_b_f32, mov_ref_b_f32, 1.0 / 3.0, 1.0e-3);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_mov_stats_q15_test, arm_mov_stats_q15)
+{
+    arm_mov_stats_instance_q15 mov_inst;
+    uint32_t win_idx;
+    uint32_t win_len;
+    uint32_t t;
+
+    mov_fill_streams();
+    TEST_ASSERT_EQUAL(arm_mov_stats_init_q15(&mov_inst, 0, mov_state_q15),
+                      ARM_MATH_ARGUMENT_ERROR);
+
+    for (win_idx = 0; win_idx < sizeof(mov_win_sizes) / sizeof(mov_win_sizes[0]); win_idx++)
+    {
+        win_len = mov_win_sizes[win_idx];
+        JTEST_DUMP_STRF("Window: %d\n", (int) win_len);
+
+        TEST_ASSERT_EQUAL(arm_mov_stats_init_q15(&mov_inst, win_len, mov_state_q15),
+                          ARM_MATH_SUCCESS);
+
+        /* Display cycle count and run test */
+        MOV_RUN_FUT(arm_mov_stats_q15, mov_inst, mov_src_q15,
+                    mov_fut_a_q15, mov_fut_b_q15);
+
+        /* Cycle count of the block functions on every window */
+        JTEST_COUNT_CYCLES(
+            for (t = 0; t < STATISTICS_MOV_STREAM_LEN; t++)
+            {
+                arm_mean_q15(MOV_WINDOW(mov_src_q15, win_len, t), win_len, &mov_ref_a_q15[t]);
+                arm_var_q15(MOV_WINDOW(mov_src_q15, win_len, t), win_len, &mov_ref_b_q15[t]);
+            });
+
+        /* Test correctness, the running sums are exact */
+        MOV_ASSERT_EXACT(mov_fut_a_q15, mov_ref_a_q15);
+        MOV_ASSERT_EXACT(mov_fut_b_q15, mov_ref_b_q15);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  Minimum and maximum test template.
+*/
+#define MOV_DEFINE_MINMAX_TEST(suffix)                                  \
+    JTEST_DEFINE_TEST(arm_mov_minmax_##suffix##_test,                   \
+                      arm_mov_minmax_##suffix)                          \
+    {                                                                   \
+        arm_mov_minmax_instance_##suffix mov_inst;                      \
+        uint32_t win_idx;                                               \
+        uint32_t win_len;                                               \
+        uint32_t t;                                                     \
+        uint32_t idx;                                                   \
+                                                                        \
+        mov_fill_streams();                                             \
+        TEST_ASSERT_EQUAL(arm_mov_minmax_init_##suffix(                 \
+                              &mov_inst, 0, mov_state_##suffix,         \
+                              mov_index_u32),                           \
+                          ARM_MATH_ARGUMENT_ERROR);                     \
+                                                                        \
+        for (win_idx = 0;                                               \
+             win_idx < sizeof(mov_win_sizes) / sizeof(mov_win_sizes[0]); \
+             win_idx++)                                                 \
+        {                                                               \
+            win_len = mov_win_sizes[win_idx];                           \
+            JTEST_DUMP_STRF("Window: %d\n", (int) win_len);             \
+                                                                        \
+            TEST_ASSERT_EQUAL(arm_mov_minmax_init_##suffix(             \
+                                  &mov_inst, win_len, mov_state_##suffix, \
+                                  mov_index_u32),                       \
+                              ARM_MATH_SUCCESS);                        \
+                                                                        \
+            /* Display cycle count and run test */                      \
+            MOV_RUN_FUT(arm_mov_minmax_##suffix, mov_inst,              \
+                        mov_src_##suffix,                               \
+                        mov_fut_a_##suffix, mov_fut_b_##suffix);        \
+                                                                        \
+            /* Cycle count of the block functions on every window */   \
+            JTEST_COUNT_CYCLES(                                         \
+                for (t = 0; t < STATISTICS_MOV_STREAM_LEN; t++)         \
+                {                                                       \
+                    arm_min_##suffix(MOV_WINDOW(mov_src_##suffix, win_len, t), \
+                                     win_len, &mov_ref_a_##suffix[t], &idx); \
+                    arm_max_##suffix(MOV_WINDOW(mov_src_##suffix, win_len, t), \
+                                     win_len, &mov_ref_b_##suffix[t], &idx); \
+                });                                                     \
+                                                                        \
+            /* Test correctness */                                      \
+            MOV_ASSERT_EXACT(mov_fut_a_##suffix, mov_ref_a_##suffix);   \
+            MOV_ASSERT_EXACT(mov_fut_b_##suffix, mov_ref_b_##suffix);   \
+        }                                                               \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+MOV_DEFINE_MINMAX_TEST(f32);
+MOV_DEFINE_MINMAX_TEST(q15);
+
+/*
+  Rank filter test template. Each window is tested for the minimum, the
+  median and the maximum rank.
+*/
+#define MOV_DEFINE_RANK_TEST(suffix)                                    \
+    JTEST_DEFINE_TEST(arm_mov_rank_##suffix##_test,                     \
+                      arm_mov_rank_##suffix)                            \
+    {                                                                   \
+        arm_mov_rank_instance_##suffix mov_inst;                        \
+        uint32_t win_idx;                                               \
+        uint32_t win_len;                                               \
+        uint32_t rank_idx;                                              \
+        uint32_t rank;                                                  \
+        uint32_t t;                                                     \
+                                                                        \
+        mov_fill_streams();                                             \
+        TEST_ASSERT_EQUAL(arm_mov_rank_init_##suffix(                   \
+                              &mov_inst, 4, 4, mov_state_##suffix,      \
+                              mov_index_u16),                           \
+                          ARM_MATH_ARGUMENT_ERROR);                     \
+                                                                        \
+        for (win_idx = 0;                                               \
+             win_idx < sizeof(mov_win_sizes) / sizeof(mov_win_sizes[0]); \
+             win_idx++)                                                 \
+        {                                                               \
+            win_len = mov_win_sizes[win_idx];                           \
+                                                                        \
+            for (rank_idx = 0; rank_idx < 3; rank_idx++)                \
+            {                                                           \
+                rank = (rank_idx * (win_len - 1)) / 2;                  \
+                JTEST_DUMP_STRF("Window: %d Rank: %d\n",                \
+                                (int) win_len, (int) rank);             \
+                                                                        \
+                TEST_ASSERT_EQUAL(arm_mov_rank_init_##suffix(           \
+                                      &mov_inst, win_len, rank,         \
+                                      mov_state_##suffix, mov_index_u16), \
+                                  ARM_MATH_SUCCESS);                    \
+                                                                        \
+                /* Display cycle count and run test */                  \
+                JTEST_COUNT_CYCLES(                                     \
+                    arm_mov_rank_##suffix(                              \
+                        &mov_inst, mov_src_##suffix + STATISTICS_MOV_MAX_WINDOW, \
+                        mov_fut_a_##suffix, STATISTICS_MOV_SPLIT);      \
+                    arm_mov_rank_##suffix(                              \
+                        &mov_inst,                                      \
+                        mov_src_##suffix + STATISTICS_MOV_MAX_WINDOW + STATISTICS_MOV_SPLIT, \
+                        mov_fut_a_##suffix + STATISTICS_MOV_SPLIT,      \
+                        STATISTICS_MOV_STREAM_LEN - STATISTICS_MOV_SPLIT)); \
+                                                                        \
+                /* Cycle count of a selection on every window */       \
+                JTEST_COUNT_CYCLES(                                     \
+                    for (t = 0; t < STATISTICS_MOV_STREAM_LEN; t++)     \
+                    {                                                   \
+                        mov_ref_a_##suffix[t] = mov_ref_select_##suffix( \
+                            MOV_WINDOW(mov_src_##suffix, win_len, t),   \
+                            win_len, rank);                             \
+                    });                                                 \
+                                                                        \
+                /* Test correctness */                                  \
+                MOV_ASSERT_EXACT(mov_fut_a_##suffix, mov_ref_a_##suffix); \
+            }                                                           \
+        }                                                               \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+MOV_DEFINE_RANK_TEST(f32);
+MOV_DEFINE_RANK_TEST(q15);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(mov_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_mov_stats_f32_test);
+    JTEST_TEST_CALL(arm_mov_stats_q15_test);
+    JTEST_TEST_CALL(arm_mov_minmax_f32_test);
+    JTEST_TEST_CALL(arm_mov_minmax_q15_test);
+    JTEST_TEST_CALL(arm_mov_rank_f32_test);
+    JTEST_TEST_CALL(arm_mov_rank_q15_test);
+}
@@ -0,0 +1,267 @@
+#include "jtest.h"
+#include "statistics_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "statistics_templates.h"
+#include "type_abbrev.h"
+#include <math.h>
+
+/*--------------------------------------------------------------------------------*/
+/* Buffers */
+/*--------------------------------------------------------------------------------*/
+
+/* Length of the stream fed to the accumulator, override for longer runs */
+#ifndef STATISTICS_STATS_STREAM_LEN
+#define STATISTICS_STATS_STREAM_LEN 4096
+#endif
+
+static float32_t stats_stream[STATISTICS_STATS_STREAM_LEN];
+
+/* Block lengths the stream is cut into, in turn */
+static const uint32_t stats_stream_blocks[] = {1, 7, 32, 100, 3, 256, 64, 5};
+
+/*--------------------------------------------------------------------------------*/
+/* Helper Functions */
+/*--------------------------------------------------------------------------------*/
+
+/**
+ *  Two-pass statistics computed in double precision.
+ */
+static void stats_ref_f64(
+    const float32_t * pSrc,
+    uint32_t blockSize,
+    arm_stats_result_f32 * pResult)
+{
+    float64_t mean = 0.0;
+    float64_t m2 = 0.0;
+    float64_t power = 0.0;
+    float64_t d;
+    uint32_t i;
+
+    pResult->min = pSrc[0];
+    pResult->max = pSrc[0];
+    pResult->minIndex = 0U;
+    pResult->maxIndex = 0U;
+
+    for (i = 0; i < blockSize; i++)
+    {
+        mean += pSrc[i];
+        power += (float64_t) pSrc[i] * pSrc[i];
+
+        if (pSrc[i] < pResult->min)
+        {
+            pResult->min = pSrc[i];
+            pResult->minIndex = i;
+        }
+
+        if (pSrc[i] > pResult->max)
+        {
+            pResult->max = pSrc[i];
+            pResult->maxIndex = i;
+        }
+    }
+
+    mean /= blockSize;
+
+    for (i = 0; i < blockSize; i++)
+    {
+        d = pSrc[i] - mean;
+        m2 += d * d;
+    }
+
+    pResult->mean = (float32_t) mean;
+    pResult->var = (blockSize > 1U) ? (float32_t) (m2 / (blockSize - 1U)) : 0.0f;
+    pResult->std = (float32_t) sqrt(pResult->var);
+    pResult->power = (float32_t) power;
+    pResult->rms = (float32_t) sqrt(power / blockSize);
+}
+
+/**
+ *  Fill #stats_stream with uniform noise in [-1 1) around a large offset, so
+ *  that a sum of squares formula would cancel.
+ */
+static void stats_fill_stream(float32_t offset)
+{
+    uint32_t seed = 0x2468U;
+    uint32_t i;
+
+    for (i = 0; i < STATISTICS_STATS_STREAM_LEN; i++)
+    {
+        seed = seed * 1664525U + 1013904223U;
+        stats_stream[i] = offset + (float32_t) ((int32_t) seed >> 8) / 8388608.0f;
+    }
+}
+
+/**
+ *  Fail the test if a field differs from the reference by more than tol,
+ *  relative to the reference plus scale.
+ */
+#define STATS_ASSERT_FIELD(fut, ref, field, scale, tol)                 \
+    do                                                                  \
+    {                                                                   \
+        if (fabs((float64_t) (fut).field - (ref).field) >               \
+            (tol) * (fabs((float64_t) (ref).field) + (scale)))          \
+        {                                                               \
+            JTEST_DUMP_STRF("%s: %e, expected %e\n", #field,            \
+                            (double) (fut).field, (double) (ref).field); \
+            return JTEST_TEST_FAILED;                                   \
+        }                                                               \
+    } while (0)
+
+/**
+ *  Compare all fields of two results. The mean is compared relative to the
+ *  RMS, since it can cancel to zero.
+ */
+#define STATS_ASSERT_RESULT(fut, ref, tol)                              \
+    do                                                                  \
+    {                                                                   \
+        STATS_ASSERT_FIELD(fut, ref, mean, (ref).rms, tol);             \
+        STATS_ASSERT_FIELD(fut, ref, var, 0.0, tol);                    \
+        STATS_ASSERT_FIELD(fut, ref, std, 0.0, tol);                    \
+        STATS_ASSERT_FIELD(fut, ref, rms, 0.0, tol);                    \
+        STATS_ASSERT_FIELD(fut, ref, power, 0.0, tol);                  \
+        STATS_ASSERT_FIELD(fut, ref, min, 0.0, 0.0);                    \
+        STATS_ASSERT_FIELD(fut, ref, max, 0.0, 0.0);                    \
+        TEST_ASSERT_EQUAL((fut).minIndex, (ref).minIndex);              \
+        TEST_ASSERT_EQUAL((fut).maxIndex, (ref).maxIndex);              \
+    } while (0)
+
+/**
+ *  The separate library calls arm_stats_f32() replaces. Only timed.
+ */
+static void stats_separate_f32(
+    float32_t * pSrc,
+    uint32_t blockSize,
+    arm_stats_result_f32 * pResult)
+{
+    arm_mean_f32(pSrc, blockSize, &pResult->mean);
+    arm_var_f32(pSrc, blockSize, &pResult->var);
+    arm_std_f32(pSrc, blockSize, &pResult->std);
+    arm_rms_f32(pSrc, blockSize, &pResult->rms);
+    arm_power_f32(pSrc, blockSize, &pResult->power);
+    arm_min_f32(pSrc, blockSize, &pResult->min, &pResult->minIndex);
+    arm_max_f32(pSrc, blockSize, &pResult->max, &pResult->maxIndex);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_TEST(arm_stats_f32_test, arm_stats_f32)
+{
+    arm_stats_result_f32 result_fut;
+    arm_stats_result_f32 result_sep;
+    arm_stats_result_f32 result_ref;
+
+    TEMPLATE_DO_ARR_DESC(
+        input_idx, ARR_DESC_t *, input_ptr, statistics_f_all
+        ,
+        TEMPLATE_DO_ARR_DESC(
+            block_size_idx, uint32_t, block_size, statistics_block_sizes
+            ,
+            float32_t * input_data_ptr = input_ptr->data_ptr;
+
+            TEST_DO_VALID_BLOCKSIZE(
+                block_size, float32_t, input_ptr
+                ,
+                /* Display cycle count and run test */
+                JTEST_COUNT_CYCLES(
+                    arm_stats_f32(input_data_ptr, block_size, &result_fut));
+
+                /* Cycle count of the separate calls */
+                JTEST_COUNT_CYCLES(
+                    stats_separate_f32(input_data_ptr, block_size, &result_sep));
+
+                /* The variance and standard deviation read the input twice */
+                JTEST_DUMP_STRF("Bytes read: fused %d, separate %d\n",
+                                (int) (block_size * sizeof(float32_t)),
+                                (int) (9U * block_size * sizeof(float32_t)));
+
+                /* Test correctness */
+                stats_ref_f64(input_data_ptr, block_size, &result_ref);
+                STATS_ASSERT_RESULT(result_fut, result_ref, 1.0e-5);
+
+                /* Minimum and maximum match the separate functions exactly */
+                STATS_ASSERT_FIELD(result_fut, result_sep, min, 0.0, 0.0);
+                STATS_ASSERT_FIELD(result_fut, result_sep, max, 0.0, 0.0);
+                TEST_ASSERT_EQUAL(result_fut.minIndex, result_sep.minIndex);
+                TEST_ASSERT_EQUAL(result_fut.maxIndex, result_sep.maxIndex))));
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  Accumulator test template. The stream is fed in blocks of varying length
+  and the running result is checked after every block against the double
+  precision statistics of the samples seen so far.
+*/
+#define STATS_DEFINE_STREAM_TEST(config_suffix, offset)                 \
+    JTEST_DEFINE_TEST(arm_stats_update_f32_##config_suffix##_test,      \
+                      arm_stats_update_f32)                             \
+    {                                                                   \
+        arm_stats_instance_f32 stats_inst;                              \
+        arm_stats_result_f32 result_fut;                                \
+        arm_stats_result_f32 result_ref;                                \
+        uint32_t pos = 0;                                               \
+        uint32_t blk_idx = 0;                                           \
+        uint32_t len;                                                   \
+                                                                        \
+        stats_fill_stream(offset);                                      \
+        arm_stats_init_f32(&stats_inst);                                \
+                                                                        \
+        /* An empty accumulator reads as zeros */                       \
+        arm_stats_get_f32(&stats_inst, &result_fut);                    \
+        TEST_ASSERT_EQUAL(result_fut.var, 0.0f);                        \
+                                                                        \
+        while (pos < STATISTICS_STATS_STREAM_LEN)                       \
+        {                                                               \
+            len = stats_stream_blocks[blk_idx % (sizeof(stats_stream_blocks) / \
+                                                 sizeof(stats_stream_blocks[0]))]; \
+            len = (len < STATISTICS_STATS_STREAM_LEN - pos) ?           \
+                len : (STATISTICS_STATS_STREAM_LEN - pos);              \
+                                                                        \
+            arm_stats_update_f32(&stats_inst, stats_stream + pos, len); \
+            pos += len;                                                 \
+            blk_idx++;                                                  \
+                                                                        \
+            /* Test correctness */                                      \
+            arm_stats_get_f32(&stats_inst, &result_fut);                \
+            stats_ref_f64(stats_stream, pos, &result_ref);              \
+            STATS_ASSERT_RESULT(result_fut, result_ref, 1.0e-4);        \
+        }                                                               \
+                                                                        \
+        /* Display cycle count of the whole stream, in blocks of 256 */ \
+        arm_stats_init_f32(&stats_inst);                                \
+        JTEST_COUNT_CYCLES(                                             \
+            for (pos = 0; pos < STATISTICS_STATS_STREAM_LEN; pos += 256U) \
+            {                                                           \
+                arm_stats_update_f32(&stats_inst, stats_stream + pos,   \
+                                     256U);                             \
+            });                                                         \
+                                                                        \
+        /* Cycle count of the fused function on the buffered stream */  \
+        JTEST_COUNT_CYCLES(                                             \
+            arm_stats_f32(stats_stream, STATISTICS_STATS_STREAM_LEN,    \
+                          &result_fut));                                \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+STATS_DEFINE_STREAM_TEST(centered, 0.0f);
+STATS_DEFINE_STREAM_TEST(offset, 1000.0f);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(stats_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_stats_f32_test);
+    JTEST_TEST_CALL(arm_stats_update_f32_centered_test);
+    JTEST_TEST_CALL(arm_stats_update_f32_offset_test);
+}
@@ -0,0 +1,346 @@
+#include "jtest.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "test_templates.h"
+#include "type_abbrev.h"
+#include <math.h>
+
+/*--------------------------------------------------------------------------------*/
+/* Buffers */
+/*--------------------------------------------------------------------------------*/
+
+/* Length of the converted buffers, override for throughput runs */
+#ifndef SUPPORT_CONVERT_LEN
+#define SUPPORT_CONVERT_LEN 1024
+#endif
+
+static float32_t convert_src_f32[SUPPORT_CONVERT_LEN];
+static q31_t     convert_src_q31[SUPPORT_CONVERT_LEN];
+static q31_t     convert_fut_q31[SUPPORT_CONVERT_LEN];
+static q31_t     convert_ref_q31[SUPPORT_CONVERT_LEN];
+static q15_t     convert_fut_q15[SUPPORT_CONVERT_LEN];
+static q15_t     convert_ref_q15[SUPPORT_CONVERT_LEN];
+
+/* Rounding of the plain converters in this build */
+#ifdef ARM_MATH_ROUNDING
+#define CONVERT_PLAIN_ROUNDING ARM_CONVERT_NEAREST
+#else
+#define CONVERT_PLAIN_ROUNDING ARM_CONVERT_TRUNCATE
+#endif
+
+/*--------------------------------------------------------------------------------*/
+/* Helper Functions */
+/*--------------------------------------------------------------------------------*/
+
+/**
+ *  Fill the floating-point source with uniform noise in [-peak peak) and the
+ *  Q31 source with the same values. Every 61st sample is set to the peak or
+ *  its opposite, so both ends of the range are exercised.
+ */
+static void convert_fill(float32_t peak)
+{
+    uint32_t seed = 0x1357U;
+    uint32_t i;
+
+    for (i = 0; i < SUPPORT_CONVERT_LEN; i++)
+    {
+        seed = seed * 1664525U + 1013904223U;
+        convert_src_f32[i] = peak * (float32_t) ((int32_t) seed >> 8) / 8388608.0f;
+
+        if ((i % 61U) == 0U)
+        {
+            convert_src_f32[i] = (i & 1U) ? -peak : peak;
+        }
+
+        convert_src_q31[i] = (q31_t) seed;
+    }
+}
+
+/**
+ *  Largest magnitude of the floating-point source.
+ */
+static float32_t convert_peak_f32(uint32_t blockSize)
+{
+    float32_t peak = 0.0f;
+    uint32_t i;
+
+    for (i = 0; i < blockSize; i++)
+    {
+        peak = (fabsf(convert_src_f32[i]) > peak) ? fabsf(convert_src_f32[i]) : peak;
+    }
+
+    return peak;
+}
+
+/**
+ *  Whether a sample saturates when converted with the rounding of the plain
+ *  converters.
+ */
+static uint32_t convert_is_clipped(float32_t in, float64_t fullScale)
+{
+    float64_t v = (float64_t) in * fullScale;
+
+#ifdef ARM_MATH_ROUNDING
+    v = (v > 0.0) ? floor(v + 0.5) : ceil(v - 0.5);
+#else
+    v = (v > 0.0) ? floor(v) : ceil(v);
+#endif
+
+    return ((v > fullScale - 1.0) || (v < -fullScale)) ? 1U : 0U;
+}
+
+/**
+ *  Reference Q31 to Q15 conversion with gain, rounding half up, and the
+ *  number of saturated samples.
+ */
+static uint32_t convert_ref_q31_q15(
+    q31_t * pSrc,
+    q31_t scaleFract,
+    int8_t shift,
+    q15_t * pDst,
+    uint32_t blockSize)
+{
+    uint32_t clips = 0U;
+    q63_t p;
+    uint32_t i;
+
+    for (i = 0; i < blockSize; i++)
+    {
+        p = (q63_t) pSrc[i] * scaleFract;
+        p = ((p >> (46 - shift)) + 1) >> 1;
+
+        if ((p > 32767) || (p < -32768))
+        {
+            clips++;
+            p = (p > 0) ? 32767 : -32768;
+        }
+
+        pDst[i] = (q15_t) p;
+    }
+
+    return clips;
+}
+
+/**
+ *  Fail the test if the peak differs from the expected value by more than a
+ *  few ULP.
+ */
+#define CONVERT_ASSERT_PEAK(fut, ref)                                   \
+    do                                                                  \
+    {                                                                   \
+        if (fabs((float64_t) (fut) - (ref)) > 1.0e-6 * fabs((float64_t) (ref))) \
+        {                                                               \
+            JTEST_DUMP_STRF("peak: %e, expected %e\n",                  \
+                            (double) (fut), (double) (ref));            \
+            return JTEST_TEST_FAILED;                                   \
+        }                                                               \
+    } while (0)
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Floating-point conversion test template. With unit gain the output is
+  compared with the plain converter, which saturates the same way; every
+  sample outside the range must be counted. With a gain of two the output is
+  compared with arm_scale_f32() followed by the plain converter, which is
+  exact for a power of two.
+*/
+#define CONVERT_DEFINE_F32_TEST(suffix, full_scale)                     \
+    JTEST_DEFINE_TEST(arm_convert_f32_##suffix##_test,                  \
+                      arm_convert_f32_##suffix)                         \
+    {                                                                   \
+        arm_convert_instance conv_inst;                                 \
+        TYPE_FROM_ABBREV(suffix) * fut =                                \
+            (TYPE_FROM_ABBREV(suffix) *) convert_fut_##suffix;          \
+        TYPE_FROM_ABBREV(suffix) * ref =                                \
+            (TYPE_FROM_ABBREV(suffix) *) convert_ref_##suffix;          \
+        uint32_t clips;                                                 \
+        uint32_t i;                                                     \
+                                                                        \
+        /* A tenth of the samples are above full scale */               \
+        convert_fill(1.1f);                                             \
+                                                                        \
+        /* Display cycle count and run test */                          \
+        arm_convert_init(&conv_inst, CONVERT_PLAIN_ROUNDING, 0U);       \
+        JTEST_COUNT_CYCLES(                                             \
+            arm_convert_f32_##suffix(&conv_inst, convert_src_f32, 1.0f, \
+                                     fut, SUPPORT_CONVERT_LEN));        \
+                                                                        \
+        /* Cycle count of the plain converter */                        \
+        JTEST_COUNT_CYCLES(                                             \
+            arm_float_to_##suffix(convert_src_f32, ref,                 \
+                                  SUPPORT_CONVERT_LEN));                \
+                                                                        \
+        /* Test correctness */                                          \
+        clips = 0U;                                                     \
+        for (i = 0; i < SUPPORT_CONVERT_LEN; i++)                       \
+        {                                                               \
+            TEST_ASSERT_EQUAL(fut[i], ref[i]);                          \
+            clips += convert_is_clipped(convert_src_f32[i], full_scale); \
+        }                                                               \
+        TEST_ASSERT_EQUAL(conv_inst.clipCount, clips);                  \
+        CONVERT_ASSERT_PEAK(conv_inst.peak,                             \
+                            convert_peak_f32(SUPPORT_CONVERT_LEN));     \
+                                                                        \
+        /* Statistics accumulate over calls */                          \
+        arm_convert_f32_##suffix(&conv_inst, convert_src_f32, 1.0f,     \
+                                 fut, SUPPORT_CONVERT_LEN / 2U);        \
+        TEST_ASSERT_EQUAL(conv_inst.clipCount >= clips, 1);             \
+                                                                        \
+        /* Fused gain */                                                \
+        arm_convert_init(&conv_inst, CONVERT_PLAIN_ROUNDING, 0U);       \
+        arm_convert_f32_##suffix(&conv_inst, convert_src_f32, 2.0f,     \
+                                 fut, SUPPORT_CONVERT_LEN);             \
+        arm_scale_f32(convert_src_f32, 2.0f, convert_src_f32,           \
+                      SUPPORT_CONVERT_LEN);                             \
+        arm_float_to_##suffix(convert_src_f32, ref, SUPPORT_CONVERT_LEN); \
+        for (i = 0; i < SUPPORT_CONVERT_LEN; i++)                       \
+        {                                                               \
+            TEST_ASSERT_EQUAL(fut[i], ref[i]);                          \
+        }                                                               \
+        CONVERT_ASSERT_PEAK(conv_inst.peak,                             \
+                            convert_peak_f32(SUPPORT_CONVERT_LEN));     \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+CONVERT_DEFINE_F32_TEST(q15, 32768.0);
+CONVERT_DEFINE_F32_TEST(q31, 2147483648.0);
+
+JTEST_DEFINE_TEST(arm_convert_q31_q15_test, arm_convert_q31_q15)
+{
+    arm_convert_instance conv_inst;
+    uint32_t clips;
+    uint32_t i;
+
+    convert_fill(1.0f);
+
+    /* Display cycle count and run test */
+    arm_convert_init(&conv_inst, ARM_CONVERT_TRUNCATE, 0U);
+    JTEST_COUNT_CYCLES(
+        arm_convert_q31_q15(&conv_inst, convert_src_q31, 0x40000000, 1,
+                            convert_fut_q15, SUPPORT_CONVERT_LEN));
+
+    /* Cycle count of the plain converter */
+    JTEST_COUNT_CYCLES(
+        arm_q31_to_q15(convert_src_q31, convert_ref_q15, SUPPORT_CONVERT_LEN));
+
+    /* Unit gain with truncation is the plain converter */
+    for (i = 0; i < SUPPORT_CONVERT_LEN; i++)
+    {
+        TEST_ASSERT_EQUAL(convert_fut_q15[i], convert_ref_q15[i]);
+    }
+    TEST_ASSERT_EQUAL(conv_inst.clipCount, 0U);
+
+    /* Gain of 3 dB with saturation, rounded to nearest */
+    arm_convert_init(&conv_inst, ARM_CONVERT_NEAREST, 0U);
+    arm_convert_q31_q15(&conv_inst, convert_src_q31, 0x5A82799A, 1,
+                        convert_fut_q15, SUPPORT_CONVERT_LEN);
+    clips = convert_ref_q31_q15(convert_src_q31, 0x5A82799A, 1,
+                                convert_ref_q15, SUPPORT_CONVERT_LEN);
+    for (i = 0; i < SUPPORT_CONVERT_LEN; i++)
+    {
+        TEST_ASSERT_EQUAL(convert_fut_q15[i], convert_ref_q15[i]);
+    }
+    TEST_ASSERT_EQUAL(conv_inst.clipCount, clips);
+    TEST_ASSERT_EQUAL(clips > 0U, 1);
+    TEST_ASSERT_EQUAL(conv_inst.peak > 1.0f, 1);
+
+    /* Attenuation by 2^-15, the smallest supported shift */
+    arm_convert_init(&conv_inst, ARM_CONVERT_NEAREST, 0U);
+    arm_convert_q31_q15(&conv_inst, convert_src_q31, 0x7FFFFFFF, -15,
+                        convert_fut_q15, SUPPORT_CONVERT_LEN);
+    convert_ref_q31_q15(convert_src_q31, 0x7FFFFFFF, -15,
+                        convert_ref_q15, SUPPORT_CONVERT_LEN);
+    for (i = 0; i < SUPPORT_CONVERT_LEN; i++)
+    {
+        TEST_ASSERT_EQUAL(convert_fut_q15[i], convert_ref_q15[i]);
+    }
+    TEST_ASSERT_EQUAL(conv_inst.clipCount, 0U);
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  Dither test template. A constant input of a fraction of an LSB is lost by
+  truncation and by rounding to nearest, but dithered output averages to it.
+  The tolerance is five standard deviations of the mean.
+*/
+#define CONVERT_DEFINE_DITHER_TEST(suffix, lsb_frac)                    \
+    JTEST_DEFINE_TEST(arm_convert_dither_##suffix##_test,               \
+                      arm_convert_f32_q15)                              \
+    {                                                                   \
+        arm_convert_instance conv_inst;                                 \
+        float64_t mean;                                                 \
+        float64_t tol = 5.0 * 0.5 / sqrt((float64_t) SUPPORT_CONVERT_LEN); \
+        uint32_t i;                                                     \
+                                                                        \
+        for (i = 0; i < SUPPORT_CONVERT_LEN; i++)                       \
+        {                                                               \
+            convert_src_f32[i] = (lsb_frac) / 32768.0f;                 \
+            convert_src_q31[i] = (q31_t) ((lsb_frac) * 65536.0f);       \
+        }                                                               \
+                                                                        \
+        /* Truncation */                                                \
+        arm_convert_init(&conv_inst, ARM_CONVERT_TRUNCATE, 0U);         \
+        arm_convert_f32_q15(&conv_inst, convert_src_f32, 1.0f,          \
+                            convert_fut_q15, SUPPORT_CONVERT_LEN);      \
+        for (i = 0; i < SUPPORT_CONVERT_LEN; i++)                       \
+        {                                                               \
+            TEST_ASSERT_EQUAL(convert_fut_q15[i], 0);                   \
+        }                                                               \
+                                                                        \
+        /* Floating-point input */                                      \
+        arm_convert_init(&conv_inst, ARM_CONVERT_DITHER, 0x9E3779B9U);  \
+        JTEST_COUNT_CYCLES(                                             \
+            arm_convert_f32_q15(&conv_inst, convert_src_f32, 1.0f,      \
+                                convert_fut_q15, SUPPORT_CONVERT_LEN)); \
+        mean = 0.0;                                                     \
+        for (i = 0; i < SUPPORT_CONVERT_LEN; i++)                       \
+        {                                                               \
+            /* Only the two nearest codes are produced */               \
+            TEST_ASSERT_EQUAL(convert_fut_q15[i] == (q15_t) floor(lsb_frac) || \
+                              convert_fut_q15[i] == (q15_t) floor(lsb_frac) + 1, 1); \
+            mean += convert_fut_q15[i];                                 \
+        }                                                               \
+        mean /= SUPPORT_CONVERT_LEN;                                    \
+        JTEST_DUMP_STRF("Mean: %f, expected %f\n", mean, (double) (lsb_frac)); \
+        TEST_ASSERT_EQUAL(fabs(mean - (lsb_frac)) < tol, 1);            \
+                                                                        \
+        /* Fixed-point input */                                         \
+        arm_convert_init(&conv_inst, ARM_CONVERT_DITHER, 0x9E3779B9U);  \
+        JTEST_COUNT_CYCLES(                                             \
+            arm_convert_q31_q15(&conv_inst, convert_src_q31, 0x40000000, 1, \
+                                convert_fut_q15, SUPPORT_CONVERT_LEN)); \
+        mean = 0.0;                                                     \
+        for (i = 0; i < SUPPORT_CONVERT_LEN; i++)                       \
+        {                                                               \
+            mean += convert_fut_q15[i];                                 \
+        }                                                               \
+        mean /= SUPPORT_CONVERT_LEN;                                    \
+        JTEST_DUMP_STRF("Mean: %f, expected %f\n", mean, (double) (lsb_frac)); \
+        TEST_ASSERT_EQUAL(fabs(mean - (lsb_frac)) < tol, 1);            \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+CONVERT_DEFINE_DITHER_TEST(pos, 0.3f);
+CONVERT_DEFINE_DITHER_TEST(neg, -0.3f);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(convert_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_convert_f32_q15_test);
+    JTEST_TEST_CALL(arm_convert_f32_q31_test);
+    JTEST_TEST_CALL(arm_convert_q31_q15_test);
+    JTEST_TEST_CALL(arm_convert_dither_pos_test);
+    JTEST_TEST_CALL(arm_convert_dither_neg_test);
+}
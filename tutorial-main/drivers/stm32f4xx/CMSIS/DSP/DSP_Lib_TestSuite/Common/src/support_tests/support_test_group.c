@@ -3,6 +3,7 @@
 
 JTEST_DEFINE_GROUP(support_tests)
 {
+    JTEST_GROUP_CALL(convert_tests);
     JTEST_GROUP_CALL(copy_tests);
     JTEST_GROUP_CALL(fill_tests);
     JTEST_GROUP_CALL(x_to_y_tests);
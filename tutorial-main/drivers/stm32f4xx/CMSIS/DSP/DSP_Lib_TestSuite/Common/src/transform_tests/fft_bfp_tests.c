@@ -0,0 +1,389 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "transform_templates.h"
+#include "transform_test_data.h"
+#include "type_abbrev.h"
+#include <math.h>
+
+/*--------------------------------------------------------------------------------*/
+/* Buffers */
+/*--------------------------------------------------------------------------------*/
+
+/* Largest real transform length in transform_rfft_fftlens */
+#define FFT_BFP_MAX_LEN 1024
+
+/* Minimum SNR in dB of the block floating point transforms at any input level */
+#define FFT_BFP_Q15_SNR_THRESHOLD 60
+#define FFT_BFP_Q31_SNR_THRESHOLD 125
+
+/* SNR in dB the block floating point transforms may lose to the fixed scaling ones */
+#define FFT_BFP_SNR_MARGIN 1.0
+
+static float64_t fft_bfp_input[FFT_BFP_MAX_LEN * 2];
+static float64_t fft_bfp_ref[FFT_BFP_MAX_LEN * 2];
+static float64_t fft_bfp_cos[FFT_BFP_MAX_LEN];
+static float64_t fft_bfp_sin[FFT_BFP_MAX_LEN];
+
+/* Peak input levels in dB below full scale */
+static const int32_t fft_bfp_levels[] = {0, -20, -40, -60, -80};
+
+#define FFT_BFP_LEVEL_COUNT (sizeof(fft_bfp_levels) / sizeof(fft_bfp_levels[0]))
+
+/*--------------------------------------------------------------------------------*/
+/* Helper Functions */
+/*--------------------------------------------------------------------------------*/
+
+/**
+ *  Unnormalized complex DFT of fft_bfp_input into fft_bfp_ref, computed in
+ *  double precision. The inverse flag selects the sign of the exponent.
+ */
+static void fft_bfp_dft_f64(uint32_t fftLen, uint8_t ifftFlag)
+{
+    float64_t sign = ifftFlag ? -1.0 : 1.0;
+    float64_t re, im;
+    uint32_t k, n, idx;
+
+    for (k = 0; k < fftLen; k++)
+    {
+        fft_bfp_cos[k] = cos(2.0 * PI * k / fftLen);
+        fft_bfp_sin[k] = sin(2.0 * PI * k / fftLen);
+    }
+
+    for (k = 0; k < fftLen; k++)
+    {
+        re = 0.0;
+        im = 0.0;
+        idx = 0;
+
+        for (n = 0; n < fftLen; n++)
+        {
+            re += fft_bfp_input[2 * n] * fft_bfp_cos[idx] +
+                sign * fft_bfp_input[2 * n + 1] * fft_bfp_sin[idx];
+            im += fft_bfp_input[2 * n + 1] * fft_bfp_cos[idx] -
+                sign * fft_bfp_input[2 * n] * fft_bfp_sin[idx];
+            idx = (idx + k) % fftLen;
+        }
+
+        fft_bfp_ref[2 * k] = re;
+        fft_bfp_ref[2 * k + 1] = im;
+    }
+}
+
+/**
+ *  Fill fft_bfp_input with numValues uniform random values whose peak is
+ *  level dB below full scale.
+ */
+static void fft_bfp_make_input(uint32_t numValues, int32_t level)
+{
+    float64_t amp = 0.99 * pow(10.0, level / 20.0);
+    uint32_t seed = 0x1357U;
+    uint32_t i;
+
+    for (i = 0; i < numValues; i++)
+    {
+        seed = seed * 1664525U + 1013904223U;
+        fft_bfp_input[i] = amp * (float64_t) (int32_t) seed / 2147483648.0;
+    }
+}
+
+/**
+ *  Spread the first fftLen real values of fft_bfp_input into interleaved
+ *  complex values with a zero imaginary part.
+ */
+static void fft_bfp_real_to_cmplx(uint32_t fftLen)
+{
+    uint32_t i = fftLen;
+
+    while (i > 0)
+    {
+        i--;
+        fft_bfp_input[2 * i] = fft_bfp_input[i];
+        fft_bfp_input[2 * i + 1] = 0.0;
+    }
+}
+
+/**
+ *  Replace fft_bfp_input with the spectrum of a real random signal of length
+ *  fftLen, as the fftLen + 2 values the real inverse transforms read, scaled
+ *  to a peak level dB below full scale.
+ */
+static void fft_bfp_make_spectrum(uint32_t fftLen, int32_t level)
+{
+    float64_t peak = 0.0;
+    float64_t amp = 0.99 * pow(10.0, level / 20.0);
+    uint32_t i;
+
+    fft_bfp_make_input(fftLen, 0);
+    fft_bfp_real_to_cmplx(fftLen);
+    fft_bfp_dft_f64(fftLen, 0U);
+
+    /* The imaginary parts at DC and Nyquist are zero */
+    fft_bfp_ref[1] = 0.0;
+    fft_bfp_ref[fftLen + 1] = 0.0;
+
+    for (i = 0; i < fftLen + 2; i++)
+    {
+        peak = (fabs(fft_bfp_ref[i]) > peak) ? fabs(fft_bfp_ref[i]) : peak;
+    }
+
+    for (i = 0; i < fftLen + 2; i++)
+    {
+        fft_bfp_input[i] = fft_bfp_ref[i] * amp / peak;
+    }
+}
+
+/**
+ *  Rebuild the full hermitian spectrum from the fftLen + 2 values in
+ *  fft_bfp_input, run the inverse DFT and keep the real part of the result.
+ */
+static void fft_bfp_real_idft_f64(uint32_t fftLen)
+{
+    uint32_t k;
+
+    for (k = fftLen / 2 + 1; k < fftLen; k++)
+    {
+        fft_bfp_input[2 * k] = fft_bfp_input[2 * (fftLen - k)];
+        fft_bfp_input[2 * k + 1] = -fft_bfp_input[2 * (fftLen - k) + 1];
+    }
+
+    fft_bfp_dft_f64(fftLen, 1U);
+
+    for (k = 0; k < fftLen; k++)
+    {
+        fft_bfp_ref[k] = fft_bfp_ref[2 * k];
+    }
+}
+
+/*
+  Quantization and SNR helpers. Arguments are: function suffix (q15/q31), the
+  data type and its full scale value.
+*/
+#define FFT_BFP_DEFINE_HELPERS(suffix, type, full_scale)                \
+    /* Quantize fft_bfp_input into pDst and keep the quantized values */ \
+    static void fft_bfp_quantize_##suffix(type * pDst, uint32_t numValues) \
+    {                                                                   \
+        uint32_t i;                                                     \
+                                                                        \
+        for (i = 0; i < numValues; i++)                                 \
+        {                                                               \
+            pDst[i] = (type) floor(fft_bfp_input[i] * (full_scale) + 0.5); \
+            fft_bfp_input[i] = pDst[i] / (full_scale);                  \
+        }                                                               \
+    }                                                                   \
+                                                                        \
+    /* SNR in dB of pSrc scaled by scale against fft_bfp_ref */         \
+    static float64_t fft_bfp_snr_##suffix(                              \
+        const type * pSrc, float64_t scale, uint32_t numValues)         \
+    {                                                                   \
+        float64_t signal = 0.0;                                         \
+        float64_t noise = 0.0;                                          \
+        float64_t err;                                                  \
+        uint32_t i;                                                     \
+                                                                        \
+        for (i = 0; i < numValues; i++)                                 \
+        {                                                               \
+            err = fft_bfp_ref[i] - pSrc[i] * scale / (full_scale);      \
+            signal += fft_bfp_ref[i] * fft_bfp_ref[i];                  \
+            noise += err * err;                                         \
+        }                                                               \
+                                                                        \
+        return (noise > 0.0) ? 10.0 * log10(signal / noise) : 300.0;    \
+    }
+
+FFT_BFP_DEFINE_HELPERS(q15, q15_t, 32768.0)
+FFT_BFP_DEFINE_HELPERS(q31, q31_t, 2147483648.0)
+
+/**
+ *  Fail the test if the block floating point SNR is below the threshold or
+ *  below the fixed scaling SNR by more than #FFT_BFP_SNR_MARGIN.
+ */
+#define FFT_BFP_SNR_COMPARE(snr_bfp, snr_fixed, threshold)              \
+    do                                                                  \
+    {                                                                   \
+        JTEST_DUMP_STRF("SNR: block floating point %d dB, "             \
+                        "fixed scaling %d dB\n",                        \
+                        (int) (snr_bfp), (int) (snr_fixed));            \
+                                                                        \
+        if (((snr_bfp) < (threshold)) ||                                \
+            ((snr_bfp) < (snr_fixed) - FFT_BFP_SNR_MARGIN))             \
+        {                                                               \
+            return JTEST_TEST_FAILED;                                   \
+        }                                                               \
+    } while (0)
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  CFFT function test template. Arguments are: function suffix (q15/q31),
+  configuration suffix, inverse-transform flag, data type and SNR threshold.
+  The fixed scaling transform divides by fftLen.
+*/
+#define FFT_BFP_CFFT_DEFINE_TEST(suffix, config_suffix,                 \
+                                 ifft_flag, type, threshold)            \
+    JTEST_DEFINE_TEST(arm_cfft_bfp_##suffix##_##config_suffix##_test,   \
+                      arm_cfft_bfp_##suffix)                            \
+    {                                                                   \
+        type * data_bfp = (type *) transform_fft_input_fut;             \
+        type * data_fixed = (type *) transform_fft_input_ref;           \
+        int32_t exponent;                                               \
+        float64_t snr_bfp;                                              \
+        float64_t snr_fixed;                                            \
+        uint32_t level_idx;                                             \
+                                                                        \
+        /* Go through all arm_cfft_instances */                         \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            cfft_inst_idx, const arm_cfft_instance_##suffix *, cfft_inst_ptr, \
+            transform_cfft_##suffix##_structs                           \
+            ,                                                           \
+            for (level_idx = 0; level_idx < FFT_BFP_LEVEL_COUNT; level_idx++) \
+            {                                                           \
+                fft_bfp_make_input(2U * cfft_inst_ptr->fftLen,          \
+                                   fft_bfp_levels[level_idx]);          \
+                fft_bfp_quantize_##suffix(data_bfp,                     \
+                                          2U * cfft_inst_ptr->fftLen);  \
+                memcpy(data_fixed, data_bfp,                            \
+                       2U * cfft_inst_ptr->fftLen * sizeof(type));      \
+                fft_bfp_dft_f64(cfft_inst_ptr->fftLen, ifft_flag);      \
+                                                                        \
+                /* Display parameter values */                          \
+                JTEST_DUMP_STRF("Block Size: %d\n"                      \
+                                "Inverse-transform flag: %d\n"          \
+                                "Level: %d dBFS\n",                     \
+                                (int)cfft_inst_ptr->fftLen,             \
+                                (int)ifft_flag,                         \
+                                (int)fft_bfp_levels[level_idx]);        \
+                                                                        \
+                /* Display cycle count and run test */                  \
+                JTEST_COUNT_CYCLES(                                     \
+                    arm_cfft_bfp_##suffix(cfft_inst_ptr, data_bfp,      \
+                                          ifft_flag, 1U, &exponent));   \
+                                                                        \
+                /* Cycle count of the fixed scaling transform */        \
+                JTEST_COUNT_CYCLES(                                     \
+                    arm_cfft_##suffix(cfft_inst_ptr, data_fixed,        \
+                                      ifft_flag, 1U));                  \
+                                                                        \
+                /* Test correctness */                                  \
+                snr_bfp = fft_bfp_snr_##suffix(                         \
+                    data_bfp, ldexp(1.0, exponent),                     \
+                    2U * cfft_inst_ptr->fftLen);                        \
+                snr_fixed = fft_bfp_snr_##suffix(                       \
+                    data_fixed, (float64_t) cfft_inst_ptr->fftLen,      \
+                    2U * cfft_inst_ptr->fftLen);                        \
+                FFT_BFP_SNR_COMPARE(snr_bfp, snr_fixed, threshold);     \
+            });                                                         \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+/*
+  RFFT function test template. Arguments are: function suffix (q15/q31),
+  configuration suffix, inverse-transform flag, data type and SNR threshold.
+  The fixed scaling transform divides by fftLenReal.
+*/
+#define FFT_BFP_RFFT_DEFINE_TEST(suffix, config_suffix,                 \
+                                 ifft_flag, type, threshold)            \
+    JTEST_DEFINE_TEST(arm_rfft_bfp_##suffix##_##config_suffix##_test,   \
+                      arm_rfft_bfp_##suffix)                            \
+    {                                                                   \
+        CONCAT(arm_rfft_instance_, suffix) rfft_inst = {0};             \
+        type * src_bfp = (type *) transform_fft_input_fut;              \
+        type * src_fixed = (type *) transform_fft_input_ref;            \
+        type * dst_bfp = (type *) transform_fft_output_fut;             \
+        type * dst_fixed = (type *) transform_fft_output_ref;           \
+        uint32_t num_inputs;                                            \
+        uint32_t num_outputs;                                           \
+        int32_t exponent;                                               \
+        float64_t snr_bfp;                                              \
+        float64_t snr_fixed;                                            \
+        uint32_t level_idx;                                             \
+                                                                        \
+        /* Go through all arm_rfft lengths */                           \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            fftlen_idx, uint16_t, fftlen, transform_rfft_fftlens        \
+            ,                                                           \
+            arm_rfft_init_##suffix(&rfft_inst, (uint32_t) fftlen,       \
+                                   ifft_flag, 1U);                      \
+                                                                        \
+            num_inputs = (ifft_flag) ? (fftlen + 2U) : fftlen;          \
+            num_outputs = (ifft_flag) ? fftlen : (2U * fftlen);         \
+                                                                        \
+            for (level_idx = 0; level_idx < FFT_BFP_LEVEL_COUNT; level_idx++) \
+            {                                                           \
+                if (ifft_flag)                                          \
+                {                                                       \
+                    fft_bfp_make_spectrum(fftlen,                       \
+                                          fft_bfp_levels[level_idx]);   \
+                    fft_bfp_quantize_##suffix(src_bfp, num_inputs);     \
+                    fft_bfp_real_idft_f64(fftlen);                      \
+                }                                                       \
+                else                                                    \
+                {                                                       \
+                    fft_bfp_make_input(fftlen,                          \
+                                       fft_bfp_levels[level_idx]);      \
+                    fft_bfp_quantize_##suffix(src_bfp, num_inputs);     \
+                    fft_bfp_real_to_cmplx(fftlen);                      \
+                    fft_bfp_dft_f64(fftlen, 0U);                        \
+                }                                                       \
+                                                                        \
+                memcpy(src_fixed, src_bfp, num_inputs * sizeof(type));  \
+                                                                        \
+                /* Display parameter values */                          \
+                JTEST_DUMP_STRF("Block Size: %d\n"                      \
+                                "Inverse-transform flag: %d\n"          \
+                                "Level: %d dBFS\n",                     \
+                                (int)fftlen,                            \
+                                (int)ifft_flag,                         \
+                                (int)fft_bfp_levels[level_idx]);        \
+                                                                        \
+                /* Display cycle count and run test */                  \
+                JTEST_COUNT_CYCLES(                                     \
+                    arm_rfft_bfp_##suffix(&rfft_inst, src_bfp,          \
+                                          dst_bfp, &exponent));         \
+                                                                        \
+                /* Cycle count of the fixed scaling transform */        \
+                JTEST_COUNT_CYCLES(                                     \
+                    arm_rfft_##suffix(&rfft_inst, src_fixed,            \
+                                      dst_fixed));                      \
+                                                                        \
+                /* Test correctness */                                  \
+                snr_bfp = fft_bfp_snr_##suffix(                         \
+                    dst_bfp, ldexp(1.0, exponent), num_outputs);        \
+                snr_fixed = fft_bfp_snr_##suffix(                       \
+                    dst_fixed, (float64_t) fftlen, num_outputs);        \
+                FFT_BFP_SNR_COMPARE(snr_bfp, snr_fixed, threshold);     \
+            });                                                         \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+FFT_BFP_CFFT_DEFINE_TEST(q15, forward, 0U, q15_t, FFT_BFP_Q15_SNR_THRESHOLD);
+FFT_BFP_CFFT_DEFINE_TEST(q15, inverse, 1U, q15_t, FFT_BFP_Q15_SNR_THRESHOLD);
+FFT_BFP_CFFT_DEFINE_TEST(q31, forward, 0U, q31_t, FFT_BFP_Q31_SNR_THRESHOLD);
+FFT_BFP_CFFT_DEFINE_TEST(q31, inverse, 1U, q31_t, FFT_BFP_Q31_SNR_THRESHOLD);
+FFT_BFP_RFFT_DEFINE_TEST(q15, forward, 0U, q15_t, FFT_BFP_Q15_SNR_THRESHOLD);
+FFT_BFP_RFFT_DEFINE_TEST(q15, inverse, 1U, q15_t, FFT_BFP_Q15_SNR_THRESHOLD);
+FFT_BFP_RFFT_DEFINE_TEST(q31, forward, 0U, q31_t, FFT_BFP_Q31_SNR_THRESHOLD);
+FFT_BFP_RFFT_DEFINE_TEST(q31, inverse, 1U, q31_t, FFT_BFP_Q31_SNR_THRESHOLD);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(fft_bfp_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_cfft_bfp_q15_forward_test);
+    JTEST_TEST_CALL(arm_cfft_bfp_q15_inverse_test);
+    JTEST_TEST_CALL(arm_cfft_bfp_q31_forward_test);
+    JTEST_TEST_CALL(arm_cfft_bfp_q31_inverse_test);
+    JTEST_TEST_CALL(arm_rfft_bfp_q15_forward_test);
+    JTEST_TEST_CALL(arm_rfft_bfp_q15_inverse_test);
+    JTEST_TEST_CALL(arm_rfft_bfp_q31_forward_test);
+    JTEST_TEST_CALL(arm_rfft_bfp_q31_inverse_test);
+}
@@ -0,0 +1,294 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "transform_templates.h"
+#include "transform_test_data.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Buffers */
+/*--------------------------------------------------------------------------------*/
+
+static float32_t stft_window[TRANSFORM_STFT_MAX_FFT_LEN];
+static float32_t stft_state_fut[TRANSFORM_STFT_MAX_FFT_LEN];
+static float32_t stft_state_ref[TRANSFORM_STFT_MAX_FFT_LEN];
+static float32_t stft_history_chained[TRANSFORM_STFT_MAX_FFT_LEN];
+/* The magnitude and power spectra keep the packed spectrum in the second half */
+static float32_t stft_scratch_fut[TRANSFORM_STFT_MAX_FFT_LEN * 2];
+
+/* Exact-size magnitude output followed by a guard band */
+#define STFT_GUARD_LEN 16
+#define STFT_GUARD_VALUE 12345.0f
+static float32_t stft_output_guarded[TRANSFORM_STFT_MAX_FFT_LEN / 2 + 1 + STFT_GUARD_LEN];
+
+/* The reference real FFT needs room for a full complex frame */
+static float32_t stft_scratch_ref[TRANSFORM_STFT_MAX_FFT_LEN * 2];
+
+/*--------------------------------------------------------------------------------*/
+/* Helper Functions */
+/*--------------------------------------------------------------------------------*/
+
+/**
+ *  Fill #stft_window with a periodic Hann window of length fftlen.
+ */
+static void stft_make_window(uint16_t fftlen)
+{
+    uint32_t i;
+
+    for (i = 0; i < fftlen; i++)
+    {
+        stft_window[i] = 0.5f - 0.5f * cosf(2.0f * PI * (float32_t) i / (float32_t) fftlen);
+    }
+}
+
+/**
+ *  Magnitude STFT built from the existing library functions: shift the
+ *  history, window it, transform it and take the magnitude. This is what
+ *  arm_stft_f32() replaces and is only timed, not checked.
+ */
+static void stft_chained_f32(
+    arm_rfft_fast_instance_f32 * S,
+    float32_t * pSrc,
+    uint16_t fftlen,
+    uint16_t hopsize)
+{
+    float32_t * windowed = stft_scratch_fut;
+    float32_t * spectrum = stft_scratch_ref;
+    float32_t * magnitude = stft_scratch_ref + TRANSFORM_STFT_MAX_FFT_LEN;
+
+    arm_copy_f32(stft_history_chained + hopsize, stft_history_chained, fftlen - hopsize);
+    arm_copy_f32(pSrc, stft_history_chained + fftlen - hopsize, hopsize);
+    arm_mult_f32(stft_history_chained, stft_window, windowed, fftlen);
+    arm_rfft_fast_f32(S, windowed, spectrum, 0U);
+    arm_cmplx_mag_f32(spectrum, magnitude, fftlen / 2);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+STFT function test template. Arguments are: spectrum type suffix and the
+arm_stft_spectrum_type value.
+*/
+#define STFT_DEFINE_TEST(config_suffix, spectrum_type)                  \
+    JTEST_DEFINE_TEST(arm_stft_f32_##config_suffix##_test,              \
+                      arm_stft_f32)                                     \
+    {                                                                   \
+        arm_stft_instance_f32 stft_inst_fut;                            \
+        arm_stft_instance_f32 stft_inst_ref;                            \
+        arm_rfft_fast_instance_f32 rfft_inst_chained;                   \
+        uint16_t hopsize;                                               \
+        uint16_t outlen;                                                \
+        uint32_t frame;                                                 \
+        float32_t * input;                                              \
+                                                                        \
+        /* Go through all FFT lengths and hop sizes */                  \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            fftlen_idx, uint16_t, fftlen, transform_stft_fftlens        \
+            ,                                                           \
+            TEMPLATE_DO_ARR_DESC(                                       \
+                hop_idx, uint16_t, hopdiv, transform_stft_hop_divisors  \
+                ,                                                       \
+                hopsize = fftlen / hopdiv;                              \
+                outlen = (spectrum_type == ARM_STFT_COMPLEX) ?          \
+                    fftlen : (fftlen / 2 + 1);                          \
+                                                                        \
+                stft_make_window(fftlen);                               \
+                                                                        \
+                /* Initialize the STFT instances */                     \
+                arm_stft_init_f32(                                      \
+                    &stft_inst_fut, fftlen, hopsize,                    \
+                    stft_window, stft_state_fut);                       \
+                                                                        \
+                arm_stft_init_f32(                                      \
+                    &stft_inst_ref, fftlen, hopsize,                    \
+                    stft_window, stft_state_ref);                       \
+                                                                        \
+                arm_rfft_fast_init_f32(&rfft_inst_chained, fftlen);     \
+                memset(stft_history_chained, 0,                         \
+                       sizeof(stft_history_chained));                   \
+                                                                        \
+                /* Display parameter values */                          \
+                JTEST_DUMP_STRF("Block Size: %d\n"                      \
+                                "Hop Size: %d\n",                       \
+                                (int)fftlen,                            \
+                                (int)hopsize);                          \
+                                                                        \
+                /* Feed consecutive hops so the ring buffer wraps */    \
+                for (frame = 0; frame < TRANSFORM_STFT_FRAMES; frame++) \
+                {                                                       \
+                    input = transform_fft_f32_inputs + frame * hopsize; \
+                                                                        \
+                    /* Display cycle count and run test */              \
+                    JTEST_COUNT_CYCLES(                                 \
+                        arm_stft_f32(                                   \
+                            &stft_inst_fut,                             \
+                            input,                                      \
+                            stft_scratch_fut,                           \
+                            transform_fft_output_fut,                   \
+                            spectrum_type));                            \
+                                                                        \
+                    ref_stft_f32(                                       \
+                        &stft_inst_ref,                                 \
+                        input,                                          \
+                        stft_scratch_ref,                               \
+                        transform_fft_output_ref,                       \
+                        spectrum_type);                                 \
+                                                                        \
+                    /* Test correctness */                              \
+                    TRANSFORM_SNR_COMPARE_INTERFACE(                    \
+                        outlen,                                         \
+                        float32_t);                                     \
+                                                                        \
+                    /* Cycle count of the equivalent chained calls */   \
+                    JTEST_COUNT_CYCLES(                                 \
+                        stft_chained_f32(                               \
+                            &rfft_inst_chained,                         \
+                            input,                                      \
+                            fftlen,                                     \
+                            hopsize));                                  \
+                }));                                                    \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+STFT_DEFINE_TEST(complex, ARM_STFT_COMPLEX);
+STFT_DEFINE_TEST(magnitude, ARM_STFT_MAGNITUDE);
+STFT_DEFINE_TEST(power, ARM_STFT_POWER);
+
+/*
+The magnitude and power spectra write only fftLen/2+1 values: an output
+buffer of that size is followed by a guard band that must stay untouched.
+*/
+JTEST_DEFINE_TEST(arm_stft_f32_output_size_test, arm_stft_f32)
+{
+    arm_stft_instance_f32 stft_inst_fut;
+    arm_stft_spectrum_type spectrum_type;
+    uint16_t outlen;
+    uint32_t frame;
+    uint32_t i;
+
+    /* Go through all FFT lengths */
+    TEMPLATE_DO_ARR_DESC(
+        fftlen_idx, uint16_t, fftlen, transform_stft_fftlens
+        ,
+        outlen = fftlen / 2 + 1;
+        stft_make_window(fftlen);
+
+        for (spectrum_type = ARM_STFT_MAGNITUDE;
+             spectrum_type <= ARM_STFT_POWER;
+             spectrum_type = (arm_stft_spectrum_type) (spectrum_type + 1))
+        {
+            arm_stft_init_f32(
+                &stft_inst_fut, fftlen, fftlen / 2,
+                stft_window, stft_state_fut);
+
+            /* Display parameter values */
+            JTEST_DUMP_STRF("Block Size: %d\n"
+                            "Spectrum Type: %d\n",
+                            (int)fftlen,
+                            (int)spectrum_type);
+
+            for (i = 0; i < STFT_GUARD_LEN; i++)
+            {
+                stft_output_guarded[outlen + i] = STFT_GUARD_VALUE;
+            }
+
+            for (frame = 0; frame < TRANSFORM_STFT_FRAMES; frame++)
+            {
+                arm_stft_f32(
+                    &stft_inst_fut,
+                    transform_fft_f32_inputs + frame * (fftlen / 2),
+                    stft_scratch_fut,
+                    stft_output_guarded,
+                    spectrum_type);
+            }
+
+            for (i = 0; i < STFT_GUARD_LEN; i++)
+            {
+                if (stft_output_guarded[outlen + i] != STFT_GUARD_VALUE)
+                {
+                    JTEST_DUMP_STRF("Guard value %d overwritten\n", (int)i);
+                    return JTEST_TEST_FAILED;
+                }
+            }
+        });
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_istft_f32_test, arm_istft_f32)
+{
+    arm_stft_instance_f32 stft_inst_fut;
+    arm_stft_instance_f32 stft_inst_ref;
+    uint16_t hopsize;
+    uint32_t frame;
+    float32_t * input;
+
+    /* Go through all FFT lengths and hop sizes */
+    TEMPLATE_DO_ARR_DESC(
+        fftlen_idx, uint16_t, fftlen, transform_stft_fftlens
+        ,
+        TEMPLATE_DO_ARR_DESC(
+            hop_idx, uint16_t, hopdiv, transform_stft_hop_divisors
+            ,
+            hopsize = fftlen / hopdiv;
+
+            stft_make_window(fftlen);
+
+            /* Initialize the STFT instances */
+            arm_stft_init_f32(
+                &stft_inst_fut, fftlen, hopsize,
+                stft_window, stft_state_fut);
+
+            arm_stft_init_f32(
+                &stft_inst_ref, fftlen, hopsize,
+                stft_window, stft_state_ref);
+
+            /* Display parameter values */
+            JTEST_DUMP_STRF("Block Size: %d\n"
+                            "Hop Size: %d\n",
+                            (int)fftlen,
+                            (int)hopsize);
+
+            /* Overlap-add consecutive frames so the accumulator wraps */
+            for (frame = 0; frame < TRANSFORM_STFT_FRAMES; frame++)
+            {
+                input = transform_fft_f32_inputs + frame * fftlen;
+
+                /* Display cycle count and run test */
+                JTEST_COUNT_CYCLES(
+                    arm_istft_f32(
+                        &stft_inst_fut,
+                        input,
+                        stft_scratch_fut,
+                        transform_fft_output_fut));
+
+                ref_istft_f32(
+                    &stft_inst_ref,
+                    input,
+                    stft_scratch_ref,
+                    transform_fft_output_ref);
+
+                /* Test correctness */
+                TRANSFORM_SNR_COMPARE_INTERFACE(
+                    hopsize,
+                    float32_t);
+            }));
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(stft_tests)
+{
+    JTEST_TEST_CALL(arm_stft_f32_complex_test);
+    JTEST_TEST_CALL(arm_stft_f32_magnitude_test);
+    JTEST_TEST_CALL(arm_stft_f32_power_test);
+    JTEST_TEST_CALL(arm_stft_f32_output_size_test);
+    JTEST_TEST_CALL(arm_istft_f32_test);
+}
@@ -3250,6 +3250,20 @@ ARR_DESC_DEFINE(uint16_t,
                       32, 64, 128, 256,
                       512, 1024, 2048));
 
+ARR_DESC_DEFINE(uint16_t,
+                transform_stft_fftlens,
+                6,
+                CURLY(
+                      32, 64, 128, 256,
+                      512, 1024));
+
+/* Hop sizes are given as fftLen divisors */
+ARR_DESC_DEFINE(uint16_t,
+                transform_stft_hop_divisors,
+                3,
+                CURLY(
+                      1, 2, 4));
+
 /*--------------------------------------------------------------------------------*/
 /* CFFT_F32 Structs */
 /*--------------------------------------------------------------------------------*/
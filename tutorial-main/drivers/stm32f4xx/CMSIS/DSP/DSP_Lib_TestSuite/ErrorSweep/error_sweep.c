@@ -0,0 +1,434 @@
+#include "error_sweep.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/*--------------------------------------------------------------------------------*/
+/* Types */
+/*--------------------------------------------------------------------------------*/
+
+/**
+ *  Settings of a run, from the command line.
+ */
+typedef struct
+{
+    uint32_t exhaustiveBits;             /**< functions with operands of up to this many bits are swept exhaustively. */
+    uint32_t strataBits;                 /**< log2 of the number of strata of a sampled sweep, split over the operands. */
+    uint32_t samples;                    /**< random samples per stratum, the first two are its edges. */
+    uint32_t seed;                       /**< seed of the sample positions. */
+} sweep_config;
+
+/**
+ *  How the input space of a function is covered.
+ */
+typedef struct
+{
+    uint32_t exhaustive;                 /**< 1 if every input is visited. */
+    uint64_t span[SWEEP_MAX_OPERANDS];   /**< number of values of each operand. */
+    uint64_t strata[SWEEP_MAX_OPERANDS]; /**< number of strata of each operand. */
+    uint64_t numPoints;                  /**< number of points visited. */
+} sweep_plan;
+
+/**
+ *  Error statistics, in LSBs of the output.
+ */
+typedef struct
+{
+    uint64_t count;                      /**< number of points. */
+    float64_t sumErr;                    /**< sum of the signed errors. */
+    float64_t sumAbsErr;                 /**< sum of the absolute errors. */
+    float64_t sumSqErr;                  /**< sum of the squared errors. */
+    float64_t maxErr;                    /**< largest absolute error. */
+    uint64_t maxPoint;                   /**< point of the largest error, the first one on ties. */
+    uint64_t overOne;                    /**< number of errors above 1 LSB. */
+    uint64_t hash;                       /**< hash of all outputs, independent of the order they are computed in. */
+} sweep_stats;
+
+/*--------------------------------------------------------------------------------*/
+/* Helper Functions */
+/*--------------------------------------------------------------------------------*/
+
+/**
+ *  Bit mixer of SplitMix64.
+ */
+static uint64_t sweep_mix64(uint64_t x)
+{
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9ULL;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EBULL;
+    x ^= x >> 31;
+
+    return x;
+}
+
+static float64_t sweep_seconds(void)
+{
+#ifdef _OPENMP
+    return omp_get_wtime();
+#else
+    return (float64_t) clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+/**
+ *  Sweep the whole input space if every operand is narrow enough. Otherwise
+ *  split every operand range into equal strata and draw the same number of samples from
+ *  each combination of strata, so every part of the range is covered,
+ *  including both ends.
+ */
+static void sweep_make_plan(
+    const sweep_func * pFunc,
+    const sweep_config * pConfig,
+    sweep_plan * pPlan)
+{
+    uint64_t total = 1U;
+    uint32_t k;
+
+    pPlan->exhaustive = 1U;
+
+    for (k = 0; k < pFunc->numOperands; k++)
+    {
+        pPlan->span[k] = (uint64_t) ((int64_t) pFunc->hi[k] - pFunc->lo[k] + 1);
+
+        /* Two Q31 operands do not fit in 64 bits, they are never exhaustive */
+        if ((pPlan->span[k] > ((uint64_t) 1U << pConfig->exhaustiveBits)) ||
+            (pPlan->span[k] > (((uint64_t) 1U << 62) / total)))
+        {
+            pPlan->exhaustive = 0U;
+        }
+        else
+        {
+            total *= pPlan->span[k];
+        }
+    }
+
+    if (pPlan->exhaustive)
+    {
+        pPlan->numPoints = total;
+        return;
+    }
+
+    pPlan->numPoints = pConfig->samples;
+
+    for (k = 0; k < pFunc->numOperands; k++)
+    {
+        pPlan->strata[k] = (uint64_t) 1U << (pConfig->strataBits / pFunc->numOperands);
+        pPlan->strata[k] = (pPlan->strata[k] < pPlan->span[k]) ? pPlan->strata[k] : pPlan->span[k];
+        pPlan->numPoints *= pPlan->strata[k];
+    }
+}
+
+/**
+ *  Operands of point n of the plan.
+ */
+static void sweep_point(
+    const sweep_func * pFunc,
+    const sweep_plan * pPlan,
+    const sweep_config * pConfig,
+    uint64_t n,
+    int32_t * pIn)
+{
+    uint64_t cell, sample, first, width;
+    uint32_t k;
+
+    if (pPlan->exhaustive)
+    {
+        for (k = 0; k < pFunc->numOperands; k++)
+        {
+            pIn[k] = (int32_t) (pFunc->lo[k] + (int64_t) (n % pPlan->span[k]));
+            n /= pPlan->span[k];
+        }
+
+        return;
+    }
+
+    sample = n % pConfig->samples;
+    cell = n / pConfig->samples;
+
+    for (k = 0; k < pFunc->numOperands; k++)
+    {
+        /* Stratum of this operand */
+        first = (cell % pPlan->strata[k]) * pPlan->span[k] / pPlan->strata[k];
+        width = (cell % pPlan->strata[k] + 1U) * pPlan->span[k] / pPlan->strata[k] - first;
+        cell /= pPlan->strata[k];
+
+        /* Both edges, then uniform samples */
+        if (sample == 0U)
+        {
+            pIn[k] = (int32_t) (pFunc->lo[k] + (int64_t) first);
+        }
+        else if (sample == 1U)
+        {
+            pIn[k] = (int32_t) (pFunc->lo[k] + (int64_t) (first + width - 1U));
+        }
+        else
+        {
+            pIn[k] = (int32_t) (pFunc->lo[k] + (int64_t) (first +
+                     sweep_mix64(n ^ ((uint64_t) pConfig->seed << 32) ^
+                                 (0x9E3779B97F4A7C15ULL * (k + 1U))) % width));
+        }
+    }
+}
+
+static void sweep_merge(sweep_stats * pDst, const sweep_stats * pSrc)
+{
+    if ((pSrc->count > 0U) &&
+        ((pDst->count == 0U) ||
+         (pSrc->maxErr > pDst->maxErr) ||
+         ((pSrc->maxErr == pDst->maxErr) && (pSrc->maxPoint < pDst->maxPoint))))
+    {
+        pDst->maxErr = pSrc->maxErr;
+        pDst->maxPoint = pSrc->maxPoint;
+    }
+
+    pDst->count += pSrc->count;
+    pDst->sumErr += pSrc->sumErr;
+    pDst->sumAbsErr += pSrc->sumAbsErr;
+    pDst->sumSqErr += pSrc->sumSqErr;
+    pDst->overOne += pSrc->overOne;
+    pDst->hash += pSrc->hash;
+}
+
+/**
+ *  Run the function under test over the plan, in blocks shared out to all
+ *  threads.
+ */
+static void sweep_run(
+    const sweep_func * pFunc,
+    const sweep_plan * pPlan,
+    const sweep_config * pConfig,
+    sweep_stats * pStats)
+{
+    int64_t numBlocks = (int64_t) ((pPlan->numPoints + SWEEP_BLOCK_SIZE - 1U) / SWEEP_BLOCK_SIZE);
+    long double outMax = ldexpl(1.0L, (int) pFunc->outBits - 1) - 1.0L;
+    long double outMin = -ldexpl(1.0L, (int) pFunc->outBits - 1);
+
+    memset(pStats, 0, sizeof(sweep_stats));
+
+#pragma omp parallel
+    {
+        sweep_stats local;
+        int32_t in[SWEEP_MAX_OPERANDS][SWEEP_BLOCK_SIZE];
+        int32_t out[SWEEP_BLOCK_SIZE];
+        int32_t point[SWEEP_MAX_OPERANDS] = {0};
+        long double ref;
+        float64_t err, absErr;
+        uint64_t first, n;
+        uint32_t len, i;
+        int64_t blk;
+
+        memset(&local, 0, sizeof(sweep_stats));
+        memset(in, 0, sizeof(in));
+
+#pragma omp for schedule(dynamic, 16)
+        for (blk = 0; blk < numBlocks; blk++)
+        {
+            first = (uint64_t) blk * SWEEP_BLOCK_SIZE;
+            len = (uint32_t) (((pPlan->numPoints - first) < SWEEP_BLOCK_SIZE) ?
+                              (pPlan->numPoints - first) : SWEEP_BLOCK_SIZE);
+
+            for (i = 0; i < len; i++)
+            {
+                sweep_point(pFunc, pPlan, pConfig, first + i, point);
+                in[0][i] = point[0];
+                in[1][i] = point[1];
+            }
+
+            pFunc->fut(in[0], in[1], out, len);
+
+            for (i = 0; i < len; i++)
+            {
+                n = first + i;
+
+                /* The best an output of this width can do */
+                ref = pFunc->ref(in[0][i], in[1][i]);
+                ref = (ref > outMax) ? outMax : ((ref < outMin) ? outMin : ref);
+
+                err = (float64_t) ((long double) out[i] - ref);
+                absErr = fabs(err);
+
+                local.count++;
+                local.sumErr += err;
+                local.sumAbsErr += absErr;
+                local.sumSqErr += err * err;
+                local.overOne += (absErr > 1.0) ? 1U : 0U;
+                local.hash += sweep_mix64((n << 32) ^ (uint32_t) out[i]);
+
+                if ((absErr > local.maxErr) || (local.count == 1U))
+                {
+                    local.maxErr = absErr;
+                    local.maxPoint = n;
+                }
+            }
+        }
+
+#pragma omp critical
+        {
+            sweep_merge(pStats, &local);
+        }
+    }
+}
+
+static void sweep_report_header(void)
+{
+    printf("%-16s %-10s %12s %10s %10s %10s %10s %12s  %-26s %s\n",
+           "Function", "Sweep", "Points", "Max ULP", "Mean ULP", "Bias",
+           "RMS", "> 1 ULP", "Worst input", "Output hash");
+}
+
+static void sweep_report(
+    const sweep_func * pFunc,
+    const sweep_plan * pPlan,
+    const sweep_config * pConfig,
+    const sweep_stats * pStats)
+{
+    int32_t worst[SWEEP_MAX_OPERANDS] = {0};
+    char worstStr[32];
+    float64_t count = (pStats->count > 0U) ? (float64_t) pStats->count : 1.0;
+
+    sweep_point(pFunc, pPlan, pConfig, pStats->maxPoint, worst);
+
+    if (pFunc->numOperands == 1U)
+    {
+        sprintf(worstStr, "%ld", (long) worst[0]);
+    }
+    else
+    {
+        sprintf(worstStr, "%ld, %ld", (long) worst[0], (long) worst[1]);
+    }
+
+    printf("%-16s %-10s %12llu %10.3f %10.4f %+10.4f %10.4f %12llu  %-26s %016llx\n",
+           pFunc->name,
+           pPlan->exhaustive ? "exhaustive" : "stratified",
+           (unsigned long long) pStats->count,
+           pStats->maxErr,
+           pStats->sumAbsErr / count,
+           pStats->sumErr / count,
+           sqrt(pStats->sumSqErr / count),
+           (unsigned long long) pStats->overOne,
+           worstStr,
+           (unsigned long long) pStats->hash);
+    fflush(stdout);
+}
+
+static void sweep_usage(const char * prog)
+{
+    printf("Usage: %s [options] [function ...]\n"
+           "  Sweeps the fixed-point functions whose names contain one of the\n"
+           "  given strings, or all of them, and reports the error in output LSBs.\n"
+           "  -x bits     sweep exhaustively if no operand is wider (default 16)\n"
+           "  -s bits     log2 of the number of strata otherwise (default 16)\n"
+           "  -n samples  samples per stratum (default 64)\n"
+           "  -r seed     seed of the sample positions (default 1)\n"
+           "  -t threads  number of threads (default all cores)\n"
+           "  -l          list the functions\n",
+           prog);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Main */
+/*--------------------------------------------------------------------------------*/
+
+int main(int argc, char ** argv)
+{
+    sweep_config config = {16U, 16U, 64U, 1U};
+    sweep_plan plan;
+    sweep_stats stats;
+    const char * filters[64];
+    uint32_t numFilters = 0U;
+    uint32_t f, j;
+    int threads = 0;
+    int i;
+    float64_t start;
+
+    for (i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-x") == 0) && (i + 1 < argc))
+        {
+            config.exhaustiveBits = (uint32_t) atoi(argv[++i]);
+            config.exhaustiveBits = (config.exhaustiveBits < 32U) ? config.exhaustiveBits : 32U;
+        }
+        else if ((strcmp(argv[i], "-s") == 0) && (i + 1 < argc))
+        {
+            config.strataBits = (uint32_t) atoi(argv[++i]);
+            config.strataBits = (config.strataBits < 48U) ? config.strataBits : 48U;
+        }
+        else if ((strcmp(argv[i], "-n") == 0) && (i + 1 < argc))
+        {
+            config.samples = (uint32_t) atoi(argv[++i]);
+            config.samples = (config.samples > 0U) ? config.samples : 1U;
+        }
+        else if ((strcmp(argv[i], "-r") == 0) && (i + 1 < argc))
+        {
+            config.seed = (uint32_t) strtoul(argv[++i], NULL, 0);
+        }
+        else if ((strcmp(argv[i], "-t") == 0) && (i + 1 < argc))
+        {
+            threads = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-l") == 0)
+        {
+            for (f = 0; f < sweep_num_funcs; f++)
+            {
+                printf("%s\n", sweep_funcs[f].name);
+            }
+            return 0;
+        }
+        else if ((argv[i][0] == '-') || (numFilters == 64U))
+        {
+            sweep_usage(argv[0]);
+            return 1;
+        }
+        else
+        {
+            filters[numFilters++] = argv[i];
+        }
+    }
+
+#ifdef _OPENMP
+    if (threads > 0)
+    {
+        omp_set_num_threads(threads);
+    }
+    threads = omp_get_max_threads();
+#else
+    threads = 1;
+#endif
+
+    printf("Exhaustive up to %u-bit operands, otherwise 2^%u strata x %u samples, seed %u, %d threads\n\n",
+           (unsigned) config.exhaustiveBits, (unsigned) config.strataBits,
+           (unsigned) config.samples, (unsigned) config.seed, threads);
+    sweep_report_header();
+
+    start = sweep_seconds();
+
+    for (f = 0; f < sweep_num_funcs; f++)
+    {
+        for (j = 0; j < numFilters; j++)
+        {
+            if (strstr(sweep_funcs[f].name, filters[j]) != NULL)
+            {
+                break;
+            }
+        }
+
+        if ((numFilters > 0U) && (j == numFilters))
+        {
+            continue;
+        }
+
+        sweep_make_plan(&sweep_funcs[f], &config, &plan);
+        sweep_run(&sweep_funcs[f], &plan, &config, &stats);
+        sweep_report(&sweep_funcs[f], &plan, &config, &stats);
+    }
+
+    printf("\nElapsed %.1f s\n", sweep_seconds() - start);
+
+    return 0;
+}
@@ -0,0 +1,56 @@
+#ifndef _ERROR_SWEEP_H_
+#define _ERROR_SWEEP_H_
+
+/*--------------------------------------------------------------------------------*/
+/* Includes */
+/*--------------------------------------------------------------------------------*/
+
+#include "arm_math.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Constants */
+/*--------------------------------------------------------------------------------*/
+
+/* Largest number of operands of a swept function */
+#define SWEEP_MAX_OPERANDS 2
+
+/* Number of inputs passed to a function in one call */
+#define SWEEP_BLOCK_SIZE 1024
+
+#define SWEEP_PI 3.141592653589793238462643383279502884L
+
+/*--------------------------------------------------------------------------------*/
+/* Types */
+/*--------------------------------------------------------------------------------*/
+
+/**
+ *  A function under test and its reference.
+ *
+ *  Operands and outputs are passed widened to 32 bits, the wrapper narrows
+ *  them to the type of the function. The reference returns the exact result
+ *  in LSBs of the output, not rounded. It is clipped to the output range by
+ *  the harness, so saturation at full scale is not counted as an error.
+ */
+typedef struct
+{
+    const char * name;                   /**< name printed in the report. */
+    uint32_t numOperands;                /**< number of operands, 1 or 2. */
+    int32_t lo[SWEEP_MAX_OPERANDS];      /**< smallest swept value of each operand. */
+    int32_t hi[SWEEP_MAX_OPERANDS];      /**< largest swept value of each operand. */
+    uint32_t outBits;                    /**< width of the output: 8, 16 or 32. */
+    void (*fut)(const int32_t * pIn0,
+                const int32_t * pIn1,
+                int32_t * pOut,
+                uint32_t blockSize);     /**< calls the function under test on a block. */
+    long double (*ref)(int32_t in0,
+                       int32_t in1);     /**< exact result in output LSBs. */
+} sweep_func;
+
+/*--------------------------------------------------------------------------------*/
+/* Declare Variables */
+/*--------------------------------------------------------------------------------*/
+
+extern const sweep_func sweep_funcs[];
+extern const uint32_t sweep_num_funcs;
+
+#endif /* _ERROR_SWEEP_H_ */
@@ -0,0 +1,250 @@
+#include "error_sweep.h"
+#include "arm_common_tables.h"
+#include <math.h>
+
+/*--------------------------------------------------------------------------------*/
+/* Wrappers */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  The wrappers narrow the widened operands, call the function under test on
+  the block and widen the outputs again. Scalar functions are called once per
+  sample.
+*/
+
+#define SWEEP_DEFINE_SCALAR_WRAPPER(fn, type)                           \
+    static void sweep_##fn(const int32_t * pIn0, const int32_t * pIn1,  \
+                           int32_t * pOut, uint32_t blockSize)          \
+    {                                                                   \
+        uint32_t i;                                                     \
+                                                                        \
+        (void) pIn1;                                                    \
+        for (i = 0; i < blockSize; i++)                                 \
+        {                                                               \
+            pOut[i] = fn((type) pIn0[i]);                               \
+        }                                                               \
+    }
+
+#define SWEEP_DEFINE_SQRT_WRAPPER(fn, type)                             \
+    static void sweep_##fn(const int32_t * pIn0, const int32_t * pIn1,  \
+                           int32_t * pOut, uint32_t blockSize)          \
+    {                                                                   \
+        type out;                                                       \
+        uint32_t i;                                                     \
+                                                                        \
+        (void) pIn1;                                                    \
+        for (i = 0; i < blockSize; i++)                                 \
+        {                                                               \
+            fn((type) pIn0[i], &out);                                   \
+            pOut[i] = out;                                              \
+        }                                                               \
+    }
+
+#define SWEEP_DEFINE_RECIP_WRAPPER(fn, type, table)                     \
+    static void sweep_##fn(const int32_t * pIn0, const int32_t * pIn1,  \
+                           int32_t * pOut, uint32_t blockSize)          \
+    {                                                                   \
+        type out;                                                       \
+        uint32_t i;                                                     \
+                                                                        \
+        (void) pIn1;                                                    \
+        for (i = 0; i < blockSize; i++)                                 \
+        {                                                               \
+            fn((type) pIn0[i], &out, (type *) table);                   \
+            pOut[i] = out;                                              \
+        }                                                               \
+    }
+
+#define SWEEP_DEFINE_VECTOR_WRAPPER(fn, type)                           \
+    static void sweep_##fn(const int32_t * pIn0, const int32_t * pIn1,  \
+                           int32_t * pOut, uint32_t blockSize)          \
+    {                                                                   \
+        type src[SWEEP_BLOCK_SIZE];                                     \
+        type dst[SWEEP_BLOCK_SIZE];                                     \
+        uint32_t i;                                                     \
+                                                                        \
+        (void) pIn1;                                                    \
+        for (i = 0; i < blockSize; i++)                                 \
+        {                                                               \
+            src[i] = (type) pIn0[i];                                    \
+        }                                                               \
+        fn(src, dst, blockSize);                                        \
+        for (i = 0; i < blockSize; i++)                                 \
+        {                                                               \
+            pOut[i] = dst[i];                                           \
+        }                                                               \
+    }
+
+#define SWEEP_DEFINE_BINARY_WRAPPER(fn, type)                           \
+    static void sweep_##fn(const int32_t * pIn0, const int32_t * pIn1,  \
+                           int32_t * pOut, uint32_t blockSize)          \
+    {                                                                   \
+        type srcA[SWEEP_BLOCK_SIZE];                                    \
+        type srcB[SWEEP_BLOCK_SIZE];                                    \
+        type dst[SWEEP_BLOCK_SIZE];                                     \
+        uint32_t i;                                                     \
+                                                                        \
+        for (i = 0; i < blockSize; i++)                                 \
+        {                                                               \
+            srcA[i] = (type) pIn0[i];                                   \
+            srcB[i] = (type) pIn1[i];                                   \
+        }                                                               \
+        fn(srcA, srcB, dst, blockSize);                                 \
+        for (i = 0; i < blockSize; i++)                                 \
+        {                                                               \
+            pOut[i] = dst[i];                                           \
+        }                                                               \
+    }
+
+SWEEP_DEFINE_BINARY_WRAPPER(arm_mult_q7, q7_t);
+
+SWEEP_DEFINE_SQRT_WRAPPER(arm_sqrt_q15, q15_t);
+SWEEP_DEFINE_VECTOR_WRAPPER(arm_vsqrt_q15, q15_t);
+SWEEP_DEFINE_SCALAR_WRAPPER(arm_sin_q15, q15_t);
+SWEEP_DEFINE_VECTOR_WRAPPER(arm_vsin_q15, q15_t);
+SWEEP_DEFINE_SCALAR_WRAPPER(arm_cos_q15, q15_t);
+SWEEP_DEFINE_VECTOR_WRAPPER(arm_vcos_q15, q15_t);
+SWEEP_DEFINE_RECIP_WRAPPER(arm_recip_q15, q15_t, armRecipTableQ15);
+SWEEP_DEFINE_BINARY_WRAPPER(arm_mult_q15, q15_t);
+SWEEP_DEFINE_BINARY_WRAPPER(arm_vatan2_q15, q15_t);
+
+SWEEP_DEFINE_SQRT_WRAPPER(arm_sqrt_q31, q31_t);
+SWEEP_DEFINE_VECTOR_WRAPPER(arm_vsqrt_q31, q31_t);
+SWEEP_DEFINE_SCALAR_WRAPPER(arm_sin_q31, q31_t);
+SWEEP_DEFINE_VECTOR_WRAPPER(arm_vsin_q31, q31_t);
+SWEEP_DEFINE_SCALAR_WRAPPER(arm_cos_q31, q31_t);
+SWEEP_DEFINE_VECTOR_WRAPPER(arm_vcos_q31, q31_t);
+SWEEP_DEFINE_RECIP_WRAPPER(arm_recip_q31, q31_t, armRecipTableQ31);
+SWEEP_DEFINE_BINARY_WRAPPER(arm_mult_q31, q31_t);
+SWEEP_DEFINE_BINARY_WRAPPER(arm_vatan2_q31, q31_t);
+
+/*--------------------------------------------------------------------------------*/
+/* Reference Functions */
+/*--------------------------------------------------------------------------------*/
+
+static long double ref_mult_q7(int32_t a, int32_t b)
+{
+    return (long double) a * b / 128.0L;
+}
+
+static long double ref_mult_q15(int32_t a, int32_t b)
+{
+    return (long double) a * b / 32768.0L;
+}
+
+static long double ref_mult_q31(int32_t a, int32_t b)
+{
+    return (long double) a * b / 2147483648.0L;
+}
+
+static long double ref_sqrt_q15(int32_t x, int32_t unused)
+{
+    (void) unused;
+    return sqrtl((long double) x * 32768.0L);
+}
+
+static long double ref_sqrt_q31(int32_t x, int32_t unused)
+{
+    (void) unused;
+    return sqrtl((long double) x * 2147483648.0L);
+}
+
+static long double ref_sin_q15(int32_t x, int32_t unused)
+{
+    (void) unused;
+    return sinl(2.0L * SWEEP_PI * x / 32768.0L) * 32768.0L;
+}
+
+static long double ref_cos_q15(int32_t x, int32_t unused)
+{
+    (void) unused;
+    return cosl(2.0L * SWEEP_PI * x / 32768.0L) * 32768.0L;
+}
+
+static long double ref_sin_q31(int32_t x, int32_t unused)
+{
+    (void) unused;
+    return sinl(2.0L * SWEEP_PI * x / 2147483648.0L) * 2147483648.0L;
+}
+
+static long double ref_cos_q31(int32_t x, int32_t unused)
+{
+    (void) unused;
+    return cosl(2.0L * SWEEP_PI * x / 2147483648.0L) * 2147483648.0L;
+}
+
+/*
+  The reciprocals return a mantissa with one integer bit for the input
+  normalized to [0.5 1), and the shift as the return value. The reference
+  normalizes the same way.
+*/
+static long double ref_recip_q15(int32_t x, int32_t unused)
+{
+    int32_t norm = x;
+
+    (void) unused;
+    while (norm < 0x4000)
+    {
+        norm <<= 1;
+    }
+
+    return 536870912.0L / norm;
+}
+
+static long double ref_recip_q31(int32_t x, int32_t unused)
+{
+    int64_t norm = x;
+
+    (void) unused;
+    while (norm < 0x40000000)
+    {
+        norm <<= 1;
+    }
+
+    return 2305843009213693952.0L / norm;
+}
+
+static long double ref_atan2_q15(int32_t y, int32_t x)
+{
+    return atan2l((long double) y, (long double) x) / SWEEP_PI * 32768.0L;
+}
+
+static long double ref_atan2_q31(int32_t y, int32_t x)
+{
+    return atan2l((long double) y, (long double) x) / SWEEP_PI * 2147483648.0L;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Function Table */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  To skip a function, comment it out. The input ranges are the documented
+  domains of the functions.
+*/
+const sweep_func sweep_funcs[] =
+{
+    {"arm_mult_q7",     2, {-128, -128},               {127, 127},               8,  sweep_arm_mult_q7,     ref_mult_q7},
+
+    {"arm_sqrt_q15",    1, {0, 0},                     {0x7FFF, 0},              16, sweep_arm_sqrt_q15,    ref_sqrt_q15},
+    {"arm_vsqrt_q15",   1, {0, 0},                     {0x7FFF, 0},              16, sweep_arm_vsqrt_q15,   ref_sqrt_q15},
+    {"arm_sin_q15",     1, {0, 0},                     {0x7FFF, 0},              16, sweep_arm_sin_q15,     ref_sin_q15},
+    {"arm_vsin_q15",    1, {0, 0},                     {0x7FFF, 0},              16, sweep_arm_vsin_q15,    ref_sin_q15},
+    {"arm_cos_q15",     1, {0, 0},                     {0x7FFF, 0},              16, sweep_arm_cos_q15,     ref_cos_q15},
+    {"arm_vcos_q15",    1, {0, 0},                     {0x7FFF, 0},              16, sweep_arm_vcos_q15,    ref_cos_q15},
+    {"arm_recip_q15",   1, {1, 0},                     {0x7FFF, 0},              16, sweep_arm_recip_q15,   ref_recip_q15},
+    {"arm_mult_q15",    2, {-0x8000, -0x8000},         {0x7FFF, 0x7FFF},         16, sweep_arm_mult_q15,    ref_mult_q15},
+    {"arm_vatan2_q15",  2, {-0x8000, -0x8000},         {0x7FFF, 0x7FFF},         16, sweep_arm_vatan2_q15,  ref_atan2_q15},
+
+    {"arm_sqrt_q31",    1, {0, 0},                     {0x7FFFFFFF, 0},          32, sweep_arm_sqrt_q31,    ref_sqrt_q31},
+    {"arm_vsqrt_q31",   1, {0, 0},                     {0x7FFFFFFF, 0},          32, sweep_arm_vsqrt_q31,   ref_sqrt_q31},
+    {"arm_sin_q31",     1, {0, 0},                     {0x7FFFFFFF, 0},          32, sweep_arm_sin_q31,     ref_sin_q31},
+    {"arm_vsin_q31",    1, {0, 0},                     {0x7FFFFFFF, 0},          32, sweep_arm_vsin_q31,    ref_sin_q31},
+    {"arm_cos_q31",     1, {0, 0},                     {0x7FFFFFFF, 0},          32, sweep_arm_cos_q31,     ref_cos_q31},
+    {"arm_vcos_q31",    1, {0, 0},                     {0x7FFFFFFF, 0},          32, sweep_arm_vcos_q31,    ref_cos_q31},
+    {"arm_recip_q31",   1, {1, 0},                     {0x7FFFFFFF, 0},          32, sweep_arm_recip_q31,   ref_recip_q31},
+    {"arm_mult_q31",    2, {INT32_MIN, INT32_MIN},     {INT32_MAX, INT32_MAX},   32, sweep_arm_mult_q31,    ref_mult_q31},
+    {"arm_vatan2_q31",  2, {INT32_MIN, INT32_MIN},     {INT32_MAX, INT32_MAX},   32, sweep_arm_vatan2_q31,  ref_atan2_q31},
+};
+
+const uint32_t sweep_num_funcs = sizeof(sweep_funcs) / sizeof(sweep_funcs[0]);
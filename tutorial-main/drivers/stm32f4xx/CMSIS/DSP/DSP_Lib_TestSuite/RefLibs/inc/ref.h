@@ -495,6 +495,12 @@ void ref_biquad_cascade_stereo_df2T_f32(
 	float32_t * pDst,
 	uint32_t blockSize);
 	
+void ref_biquad_cascade_multi_df2T_f32(
+	arm_biquad_cascade_multi_df2T_instance_f32 * S,
+	float32_t * pSrc,
+	float32_t * pDst,
+	uint32_t blockSize);
+	
 void ref_biquad_cascade_df2T_f64(
 	const arm_biquad_cascade_df2T_instance_f64 * S,
 	float64_t * pSrc,
@@ -911,6 +917,42 @@ void ref_lms_norm_q15(
   q15_t * pErr,
   uint32_t blockSize);
 
+uint32_t ref_fir_resample_f32(
+  arm_fir_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+uint32_t ref_fir_resample_q31(
+  arm_fir_resample_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+uint32_t ref_fir_resample_q15(
+  arm_fir_resample_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+uint32_t ref_farrow_resample_f32(
+  arm_farrow_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+uint32_t ref_farrow_resample_q31(
+  arm_farrow_resample_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+uint32_t ref_farrow_resample_q15(
+  arm_farrow_resample_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
 void ref_fir_interpolate_f32(
   const arm_fir_interpolate_instance_f32 * S,
   float32_t * pSrc,
@@ -1348,6 +1390,19 @@ void ref_rfft_q15(
   q15_t * pSrc,
   q15_t * pDst);
 
+void ref_stft_f32(
+	arm_stft_instance_f32 * S,
+	float32_t * pSrc,
+	float32_t * pScratch,
+	float32_t * pDst,
+	arm_stft_spectrum_type spectrumType);
+
+void ref_istft_f32(
+	arm_stft_instance_f32 * S,
+	float32_t * pSrc,
+	float32_t * pScratch,
+	float32_t * pDst);
+
 void ref_dct4_f32(
   const arm_dct4_instance_f32 * S,
   float32_t * pState,
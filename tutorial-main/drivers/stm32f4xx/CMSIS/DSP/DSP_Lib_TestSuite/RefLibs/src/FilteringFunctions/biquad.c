@@ -149,6 +149,66 @@ void ref_biquad_cascade_stereo_df2T_f32(
 	
 }
 
+void ref_biquad_cascade_multi_df2T_f32(
+	arm_biquad_cascade_multi_df2T_instance_f32 * S,
+	float32_t * pSrc,
+	float32_t * pDst,
+	uint32_t blockSize)
+{
+   uint32_t numChannels = S->numChannels;
+   uint32_t numCoeffs = 5U * S->numStages;
+   float32_t *pCoeffs, *pD1, *pD2;
+   float32_t acc, Xn;
+   uint32_t n, ch, stage, i;
+
+   /* Sample by sample, all stages and channels, then move the coefficients */
+   for (n = 0; n < blockSize; n++)
+   {
+      for (ch = 0; ch < numChannels; ch++)
+      {
+         Xn = pSrc[n * numChannels + ch];
+
+         for (stage = 0; stage < S->numStages; stage++)
+         {
+            pCoeffs = S->pCoeffs + 5 * stage;
+            pD1 = S->pState + 2 * numChannels * stage + ch;
+            pD2 = pD1 + numChannels;
+
+            /* y[n] = b0 * x[n] + d1 */
+            acc = (pCoeffs[0] * Xn) + *pD1;
+
+            /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+            *pD1 = ((pCoeffs[1] * Xn) + (pCoeffs[3] * acc)) + *pD2;
+
+            /* d2 = b2 * x[n] + a2 * y[n] */
+            *pD2 = (pCoeffs[2] * Xn) + (pCoeffs[4] * acc);
+
+            Xn = acc;
+         }
+
+         pDst[n * numChannels + ch] = Xn;
+      }
+
+      if (S->rampCount > 0U)
+      {
+         for (i = 0; i < numCoeffs; i++)
+         {
+            S->pCoeffs[i] += S->pCoeffsStep[i];
+         }
+
+         S->rampCount--;
+
+         if (S->rampCount == 0U)
+         {
+            for (i = 0; i < numCoeffs; i++)
+            {
+               S->pCoeffs[i] = S->pCoeffsTarget[i];
+            }
+         }
+      }
+   }
+}
+
 void ref_biquad_cascade_df2T_f64(
 	const arm_biquad_cascade_df2T_instance_f64 * S,
 	float64_t * pSrc,
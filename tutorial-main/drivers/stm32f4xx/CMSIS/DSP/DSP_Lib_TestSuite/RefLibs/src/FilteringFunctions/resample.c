@@ -0,0 +1,301 @@
+#include "ref.h"
+
+/*
+ * Filter the zero stuffed signal directly and keep one output in M.
+ */
+uint32_t ref_fir_resample_f32(
+  arm_fir_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pCoeffs = S->pCoeffs;
+  int32_t L = S->L;
+  int32_t hist = S->phaseLength - 1;
+  int32_t numTaps = L * S->phaseLength;
+  int32_t T, u, j;
+  float32_t sum;
+  uint32_t i, numOut = 0;
+
+  for (i = 0; i < blockSize; i++)
+  {
+    S->pState[hist + i] = pSrc[i];
+  }
+
+  /* Output times on the interpolated grid, block input i is at time i*L */
+  for (T = S->inputOffset * L + S->phase; T < (int32_t) blockSize * L; T += S->M)
+  {
+    sum = 0;
+    for (j = 0; j < numTaps; j++)
+    {
+      /* Only the non zero samples of the zero stuffed signal contribute */
+      u = T - j + (hist + 1) * L;
+      if ((u % L) == 0)
+      {
+        sum += pCoeffs[numTaps - 1 - j] * S->pState[u / L - 1];
+      }
+    }
+    pDst[numOut++] = sum;
+  }
+
+  T -= blockSize * L;
+  S->inputOffset = T / L;
+  S->phase = T % L;
+
+  for (i = 0; i < (uint32_t) hist; i++)
+  {
+    S->pState[i] = S->pState[blockSize + i];
+  }
+
+  return numOut;
+}
+
+/*
+ * Filter the zero stuffed signal directly and keep one output in M.
+ */
+uint32_t ref_fir_resample_q31(
+  arm_fir_resample_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pCoeffs = S->pCoeffs;
+  int32_t L = S->L;
+  int32_t hist = S->phaseLength - 1;
+  int32_t numTaps = L * S->phaseLength;
+  int32_t T, u, j;
+  q63_t sum;
+  uint32_t i, numOut = 0;
+
+  for (i = 0; i < blockSize; i++)
+  {
+    S->pState[hist + i] = pSrc[i];
+  }
+
+  /* Output times on the interpolated grid, block input i is at time i*L */
+  for (T = S->inputOffset * L + S->phase; T < (int32_t) blockSize * L; T += S->M)
+  {
+    sum = 0;
+    for (j = 0; j < numTaps; j++)
+    {
+      /* Only the non zero samples of the zero stuffed signal contribute */
+      u = T - j + (hist + 1) * L;
+      if ((u % L) == 0)
+      {
+        sum += (q63_t) pCoeffs[numTaps - 1 - j] * S->pState[u / L - 1];
+      }
+    }
+    pDst[numOut++] = (q31_t) (sum >> 31);
+  }
+
+  T -= blockSize * L;
+  S->inputOffset = T / L;
+  S->phase = T % L;
+
+  for (i = 0; i < (uint32_t) hist; i++)
+  {
+    S->pState[i] = S->pState[blockSize + i];
+  }
+
+  return numOut;
+}
+
+/*
+ * Filter the zero stuffed signal directly and keep one output in M.
+ */
+uint32_t ref_fir_resample_q15(
+  arm_fir_resample_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pCoeffs = S->pCoeffs;
+  int32_t L = S->L;
+  int32_t hist = S->phaseLength - 1;
+  int32_t numTaps = L * S->phaseLength;
+  int32_t T, u, j;
+  q63_t sum;
+  uint32_t i, numOut = 0;
+
+  for (i = 0; i < blockSize; i++)
+  {
+    S->pState[hist + i] = pSrc[i];
+  }
+
+  /* Output times on the interpolated grid, block input i is at time i*L */
+  for (T = S->inputOffset * L + S->phase; T < (int32_t) blockSize * L; T += S->M)
+  {
+    sum = 0;
+    for (j = 0; j < numTaps; j++)
+    {
+      /* Only the non zero samples of the zero stuffed signal contribute */
+      u = T - j + (hist + 1) * L;
+      if ((u % L) == 0)
+      {
+        sum += (q31_t) pCoeffs[numTaps - 1 - j] * S->pState[u / L - 1];
+      }
+    }
+    pDst[numOut++] = (q15_t) ref_sat_q15((q31_t) (sum >> 15));
+  }
+
+  T -= blockSize * L;
+  S->inputOffset = T / L;
+  S->phase = T % L;
+
+  for (i = 0; i < (uint32_t) hist; i++)
+  {
+    S->pState[i] = S->pState[blockSize + i];
+  }
+
+  return numOut;
+}
+
+/*
+ * Cubic Lagrange interpolation with explicit weights, in double precision.
+ */
+uint32_t ref_farrow_resample_f32(
+  arm_farrow_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t n = S->inputOffset;
+  uint32_t frac = S->mu;
+  uint32_t i, k, numOut = 0;
+  float64_t mu, w[4], y;
+
+  for (i = 0; i < blockSize; i++)
+  {
+    S->pState[3 + i] = pSrc[i];
+  }
+
+  while (n < blockSize)
+  {
+    mu = (float64_t) frac / 16777216.0;
+    w[0] = -mu * (mu - 1) * (mu - 2) / 6;
+    w[1] = (mu + 1) * (mu - 1) * (mu - 2) / 2;
+    w[2] = -(mu + 1) * mu * (mu - 2) / 2;
+    w[3] = (mu + 1) * mu * (mu - 1) / 6;
+
+    y = 0;
+    for (k = 0; k < 4; k++)
+    {
+      y += w[k] * (float64_t) S->pState[n + k];
+    }
+    pDst[numOut++] = (float32_t) y;
+
+    frac += S->step & 0x00FFFFFF;
+    n += (S->step >> 24) + (frac >> 24);
+    frac &= 0x00FFFFFF;
+  }
+
+  S->inputOffset = n - blockSize;
+  S->mu = frac;
+
+  for (i = 0; i < 3; i++)
+  {
+    S->pState[i] = S->pState[blockSize + i];
+  }
+
+  return numOut;
+}
+
+/*
+ * Cubic Lagrange interpolation with explicit weights, in double precision.
+ */
+uint32_t ref_farrow_resample_q31(
+  arm_farrow_resample_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t n = S->inputOffset;
+  uint32_t frac = S->mu;
+  uint32_t i, k, numOut = 0;
+  float64_t mu, w[4], y;
+
+  for (i = 0; i < blockSize; i++)
+  {
+    S->pState[3 + i] = pSrc[i];
+  }
+
+  while (n < blockSize)
+  {
+    mu = (float64_t) frac / 16777216.0;
+    w[0] = -mu * (mu - 1) * (mu - 2) / 6;
+    w[1] = (mu + 1) * (mu - 1) * (mu - 2) / 2;
+    w[2] = -(mu + 1) * mu * (mu - 2) / 2;
+    w[3] = (mu + 1) * mu * (mu - 1) / 6;
+
+    y = 0;
+    for (k = 0; k < 4; k++)
+    {
+      y += w[k] * (float64_t) S->pState[n + k] / 2147483648.0;
+    }
+    pDst[numOut++] = ref_sat_q31((q63_t) (y * 2147483648.0));
+
+    frac += S->step & 0x00FFFFFF;
+    n += (S->step >> 24) + (frac >> 24);
+    frac &= 0x00FFFFFF;
+  }
+
+  S->inputOffset = n - blockSize;
+  S->mu = frac;
+
+  for (i = 0; i < 3; i++)
+  {
+    S->pState[i] = S->pState[blockSize + i];
+  }
+
+  return numOut;
+}
+
+/*
+ * Cubic Lagrange interpolation with explicit weights, in double precision.
+ */
+uint32_t ref_farrow_resample_q15(
+  arm_farrow_resample_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t n = S->inputOffset;
+  uint32_t frac = S->mu;
+  uint32_t i, k, numOut = 0;
+  float64_t mu, w[4], y;
+
+  for (i = 0; i < blockSize; i++)
+  {
+    S->pState[3 + i] = pSrc[i];
+  }
+
+  while (n < blockSize)
+  {
+    mu = (float64_t) frac / 16777216.0;
+    w[0] = -mu * (mu - 1) * (mu - 2) / 6;
+    w[1] = (mu + 1) * (mu - 1) * (mu - 2) / 2;
+    w[2] = -(mu + 1) * mu * (mu - 2) / 2;
+    w[3] = (mu + 1) * mu * (mu - 1) / 6;
+
+    y = 0;
+    for (k = 0; k < 4; k++)
+    {
+      y += w[k] * (float64_t) S->pState[n + k] / 32768.0;
+    }
+    pDst[numOut++] = ref_sat_q15((q31_t) (y * 32768.0));
+
+    frac += S->step & 0x00FFFFFF;
+    n += (S->step >> 24) + (frac >> 24);
+    frac &= 0x00FFFFFF;
+  }
+
+  S->inputOffset = n - blockSize;
+  S->mu = frac;
+
+  for (i = 0; i < 3; i++)
+  {
+    S->pState[i] = S->pState[blockSize + i];
+  }
+
+  return numOut;
+}
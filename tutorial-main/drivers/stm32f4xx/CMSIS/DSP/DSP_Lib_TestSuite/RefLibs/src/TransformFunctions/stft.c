@@ -0,0 +1,88 @@
+#include "ref.h"
+
+/*
+ * The reference implementations keep the history and the overlap-add
+ * accumulator as linear buffers that are shifted by hopSize on every call.
+ * S->stateIndex is not used. pScratch must hold 2*fftLen values.
+ */
+
+void ref_stft_f32(
+	arm_stft_instance_f32 * S,
+	float32_t * pSrc,
+	float32_t * pScratch,
+	float32_t * pDst,
+	arm_stft_spectrum_type spectrumType)
+{
+	uint32_t i;
+	uint32_t fftLen = S->fftLen;
+	uint32_t hopSize = S->hopSize;
+	float32_t re, im, nyquist;
+	
+	//shift the history and append the new samples
+	for(i=0;i<fftLen-hopSize;i++)
+	{
+		S->pState[i] = S->pState[i+hopSize];
+	}
+	for(i=0;i<hopSize;i++)
+	{
+		S->pState[fftLen-hopSize+i] = pSrc[i];
+	}
+	
+	for(i=0;i<fftLen;i++)
+	{
+		pScratch[i] = S->pState[i] * S->pWindow[i];
+	}
+	
+	ref_rfft_fast_f32(&S->Srfft, pScratch, pDst, 0);
+	
+	if (spectrumType == ARM_STFT_COMPLEX)
+	{
+		return;
+	}
+	
+	nyquist = pDst[1];
+	for(i=0;i<fftLen/2;i++)
+	{
+		re = pDst[2*i+0];
+		im = (i == 0) ? 0.0f : pDst[2*i+1];
+		pScratch[i] = re * re + im * im;
+	}
+	pScratch[fftLen/2] = nyquist * nyquist;
+	
+	for(i=0;i<=fftLen/2;i++)
+	{
+		pDst[i] = (spectrumType == ARM_STFT_POWER) ? pScratch[i] : sqrtf(pScratch[i]);
+	}
+}
+
+void ref_istft_f32(
+	arm_stft_instance_f32 * S,
+	float32_t * pSrc,
+	float32_t * pScratch,
+	float32_t * pDst)
+{
+	uint32_t i;
+	uint32_t fftLen = S->fftLen;
+	uint32_t hopSize = S->hopSize;
+	
+	ref_rfft_fast_f32(&S->Srfft, pSrc, pScratch, 1);
+	
+	for(i=0;i<fftLen;i++)
+	{
+		S->pState[i] += pScratch[i] * S->pWindow[i];
+	}
+	
+	//the first hopSize samples are complete
+	for(i=0;i<hopSize;i++)
+	{
+		pDst[i] = S->pState[i];
+	}
+	for(i=0;i<fftLen-hopSize;i++)
+	{
+		S->pState[i] = S->pState[i+hopSize];
+	}
+	for(i=fftLen-hopSize;i<fftLen;i++)
+	{
+		S->pState[i] = 0.0f;
+	}
+}
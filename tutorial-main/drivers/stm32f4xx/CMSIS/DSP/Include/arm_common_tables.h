@@ -118,4 +118,7 @@ extern const float32_t sinTable_f32[FAST_MATH_TABLE_SIZE + 1];
 extern const q31_t sinTable_q31[FAST_MATH_TABLE_SIZE + 1];
 extern const q15_t sinTable_q15[FAST_MATH_TABLE_SIZE + 1];
 
+/* Table for the Fast Math CORDIC arctangent */
+extern const q31_t atanCordicTable_q31[FAST_MATH_CORDIC_STAGES];
+
 #endif /*  ARM_COMMON_TABLES_H */
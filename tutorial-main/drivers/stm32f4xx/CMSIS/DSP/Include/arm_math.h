@@ -372,6 +372,12 @@ extern "C"
 #define TABLE_SPACING_Q31     0x400000
 #define TABLE_SPACING_Q15     0x80
 
+  /**
+   * @brief Number of CORDIC stages used by the fixed-point arctangent
+   */
+
+#define FAST_MATH_CORDIC_STAGES  31
+
   /**
    * @brief Macros required for SINE and COSINE Controller functions
    */
@@ -404,7 +410,8 @@ extern "C"
     ARM_MATH_SIZE_MISMATCH = -3,         /**< Size of matrices is not compatible with the operation. */
     ARM_MATH_NANINF = -4,                /**< Not-a-number (NaN) or infinity is generated */
     ARM_MATH_SINGULAR = -5,              /**< Generated by matrix inversion if the input matrix is singular and cannot be inverted. */
-    ARM_MATH_TEST_FAILURE = -6           /**< Test Failed  */
+    ARM_MATH_TEST_FAILURE = -6,          /**< Test Failed  */
+    ARM_MATH_DECOMPOSITION_FAILURE = -7  /**< Generated by matrix decompositions if the input matrix does not have the required properties. */
   } arm_status;
 
   /**
@@ -1385,6 +1392,21 @@ extern "C"
     q31_t *pData;         /**< points to the data of the matrix. */
   } arm_matrix_instance_q31;
 
+  /**
+   * @brief Number of columns of a matrix after packing for arm_mat_mult_packed_f32().
+   */
+#define ARM_MAT_PACKED_COLS(numCols) (((uint32_t) (numCols) + 3U) & ~3U)
+
+  /**
+   * @brief Instance structure for a floating-point matrix packed by arm_mat_pack_f32().
+   */
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the original matrix.     */
+    uint16_t numCols;     /**< number of columns of the original matrix.  */
+    float32_t *pData;     /**< points to the packed data of numRows * ARM_MAT_PACKED_COLS(numCols) values. */
+  } arm_matrix_packed_instance_f32;
+
 
   /**
    * @brief Floating-point matrix addition.
@@ -1521,6 +1543,32 @@ extern "C"
   arm_matrix_instance_f32 * pDst);
 
 
+  /**
+   * @brief Packs a floating-point matrix for use as the second operand of arm_mat_mult_packed_f32()
+   * @param[out] S      points to an instance of the packed matrix structure
+   * @param[in]  pSrc   points to the matrix to pack
+   * @param[out] pData  points to the packed data array of pSrc->numRows * ARM_MAT_PACKED_COLS(pSrc->numCols) values
+   */
+  void arm_mat_pack_f32(
+  arm_matrix_packed_instance_f32 * S,
+  const arm_matrix_instance_f32 * pSrc,
+  float32_t * pData);
+
+
+  /**
+   * @brief Floating-point matrix multiplication with a packed second operand
+   * @param[in]  pSrcA  points to the first input matrix structure
+   * @param[in]  pSrcB  points to the packed second input matrix structure
+   * @param[out] pDst   points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+  arm_status arm_mat_mult_packed_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_packed_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst);
+
+
   /**
    * @brief Q15 matrix multiplication
    * @param[in]  pSrcA   points to the first input matrix structure
@@ -2099,6 +2147,21 @@ void arm_cfft_q15(
     uint8_t ifftFlag,
     uint8_t bitReverseFlag);
 
+/**
+ * @brief Processing function for the Q15 complex FFT in block floating point.
+ * @param[in]      S               points to an instance of the Q15 CFFT structure.
+ * @param[in, out] p1              points to the complex data buffer. Processing occurs in-place.
+ * @param[in]      ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+ * @param[in]      bitReverseFlag  flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.
+ * @param[out]     pExponent       block exponent, the unnormalized transform is p1[n] * 2^(*pExponent).
+ */
+void arm_cfft_bfp_q15(
+    const arm_cfft_instance_q15 * S,
+    q15_t * p1,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag,
+    int32_t * pExponent);
+
   /**
    * @brief Instance structure for the fixed-point CFFT/CIFFT function.
    */
@@ -2116,6 +2179,21 @@ void arm_cfft_q31(
     uint8_t ifftFlag,
     uint8_t bitReverseFlag);
 
+/**
+ * @brief Processing function for the Q31 complex FFT in block floating point.
+ * @param[in]      S               points to an instance of the Q31 CFFT structure.
+ * @param[in, out] p1              points to the complex data buffer. Processing occurs in-place.
+ * @param[in]      ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+ * @param[in]      bitReverseFlag  flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.
+ * @param[out]     pExponent       block exponent, the unnormalized transform is p1[n] * 2^(*pExponent).
+ */
+void arm_cfft_bfp_q31(
+    const arm_cfft_instance_q31 * S,
+    q31_t * p1,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag,
+    int32_t * pExponent);
+
   /**
    * @brief Instance structure for the floating-point CFFT/CIFFT function.
    */
@@ -2158,6 +2236,19 @@ void arm_cfft_q31(
   q15_t * pSrc,
   q15_t * pDst);
 
+/**
+ * @brief Processing function for the Q15 RFFT/RIFFT in block floating point.
+ * @param[in]  S          points to an instance of the Q15 RFFT/RIFFT structure.
+ * @param[in]  pSrc       points to the input buffer, which is modified.
+ * @param[out] pDst       points to the output buffer.
+ * @param[out] pExponent  block exponent, the unnormalized transform is pDst[n] * 2^(*pExponent).
+ */
+  void arm_rfft_bfp_q15(
+  const arm_rfft_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  int32_t * pExponent);
+
   /**
    * @brief Instance structure for the Q31 RFFT/RIFFT function.
    */
@@ -2183,6 +2274,19 @@ void arm_cfft_q31(
   q31_t * pSrc,
   q31_t * pDst);
 
+/**
+ * @brief Processing function for the Q31 RFFT/RIFFT in block floating point.
+ * @param[in]  S          points to an instance of the Q31 RFFT/RIFFT structure.
+ * @param[in]  pSrc       points to the input buffer, which is modified.
+ * @param[out] pDst       points to the output buffer.
+ * @param[out] pExponent  block exponent, the unnormalized transform is pDst[n] * 2^(*pExponent).
+ */
+  void arm_rfft_bfp_q31(
+  const arm_rfft_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  int32_t * pExponent);
+
   /**
    * @brief Instance structure for the floating-point RFFT/RIFFT function.
    */
@@ -2229,6 +2333,73 @@ void arm_rfft_fast_f32(
   float32_t * p, float32_t * pOut,
   uint8_t ifftFlag);
 
+  /**
+   * @brief Spectrum format produced by the floating-point STFT.
+   */
+  typedef enum
+  {
+    ARM_STFT_COMPLEX = 0,              /**< packed complex spectrum of fftLen values, same layout as arm_rfft_fast_f32(). */
+    ARM_STFT_MAGNITUDE = 1,            /**< fftLen/2+1 magnitude bins, DC to Nyquist. */
+    ARM_STFT_POWER = 2                 /**< fftLen/2+1 squared magnitude bins, DC to Nyquist. */
+  } arm_stft_spectrum_type;
+
+  /**
+   * @brief Instance structure for the floating-point STFT/ISTFT functions.
+   */
+  typedef struct
+  {
+    arm_rfft_fast_instance_f32 Srfft;  /**< Internal RFFT structure. */
+    uint16_t fftLen;                   /**< length of the analysis/synthesis frame. */
+    uint16_t hopSize;                  /**< number of samples consumed (STFT) or produced (ISTFT) per call. */
+    uint16_t stateIndex;               /**< position of the oldest sample in the state ring buffer. */
+    const float32_t *pWindow;          /**< points to the window coefficients of length fftLen. */
+    float32_t *pState;                 /**< points to the state ring buffer of length fftLen. */
+  } arm_stft_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point STFT/ISTFT.
+   * @param[in,out] S        points to an instance of the floating-point STFT structure.
+   * @param[in]     fftLen   length of the frame. Supported lengths are the ones of arm_rfft_fast_init_f32().
+   * @param[in]     hopSize  frame advance in samples, 1 <= hopSize <= fftLen.
+   * @param[in]     pWindow  points to the window coefficients of length fftLen.
+   * @param[in]     pState   points to the state buffer of length fftLen.
+   * @return        ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if a parameter is not supported.
+   */
+  arm_status arm_stft_init_f32(
+  arm_stft_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t hopSize,
+  const float32_t * pWindow,
+  float32_t * pState);
+
+  /**
+   * @brief Processing function for the floating-point STFT.
+   * @param[in,out] S             points to an instance of the floating-point STFT structure.
+   * @param[in]     pSrc          points to hopSize new input samples.
+   * @param[in]     pScratch      points to a scratch buffer, fftLen values for ARM_STFT_COMPLEX, 2*fftLen otherwise.
+   * @param[out]    pDst          points to the output spectrum, fftLen values for ARM_STFT_COMPLEX, fftLen/2+1 otherwise.
+   * @param[in]     spectrumType  selects the output format.
+   */
+  void arm_stft_f32(
+  arm_stft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pScratch,
+  float32_t * pDst,
+  arm_stft_spectrum_type spectrumType);
+
+  /**
+   * @brief Processing function for the floating-point inverse STFT with overlap-add.
+   * @param[in,out] S         points to an instance of the floating-point STFT structure.
+   * @param[in]     pSrc      points to the packed complex spectrum of length fftLen.
+   * @param[in]     pScratch  points to a scratch buffer of length fftLen.
+   * @param[out]    pDst      points to hopSize output samples.
+   */
+  void arm_istft_f32(
+  arm_stft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pScratch,
+  float32_t * pDst);
+
   /**
    * @brief Instance structure for the floating-point DCT4/IDCT4 function.
    */
@@ -3543,6 +3714,288 @@ void arm_rfft_fast_f32(
   uint32_t blockSize);
 
 
+  /**
+   * @brief Instance structure for the Q15 polyphase sample rate converter.
+   */
+  typedef struct
+  {
+    uint16_t L;                     /**< upsample factor. */
+    uint16_t M;                     /**< downsample factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    uint16_t phase;                 /**< polyphase branch of the next output sample, 0 to L-1. */
+    uint32_t inputOffset;           /**< input samples to skip before the next output sample. */
+    q15_t *pCoeffs;                 /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q15_t *pState;                  /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_fir_resample_instance_q15;
+
+
+  /**
+   * @brief Instance structure for the Q31 polyphase sample rate converter.
+   */
+  typedef struct
+  {
+    uint16_t L;                     /**< upsample factor. */
+    uint16_t M;                     /**< downsample factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    uint16_t phase;                 /**< polyphase branch of the next output sample, 0 to L-1. */
+    uint32_t inputOffset;           /**< input samples to skip before the next output sample. */
+    q31_t *pCoeffs;                 /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q31_t *pState;                  /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_fir_resample_instance_q31;
+
+
+  /**
+   * @brief Instance structure for the floating-point polyphase sample rate converter.
+   */
+  typedef struct
+  {
+    uint16_t L;                     /**< upsample factor. */
+    uint16_t M;                     /**< downsample factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    uint16_t phase;                 /**< polyphase branch of the next output sample, 0 to L-1. */
+    uint32_t inputOffset;           /**< input samples to skip before the next output sample. */
+    float32_t *pCoeffs;             /**< points to the coefficient array. The array is of length L*phaseLength. */
+    float32_t *pState;              /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_fir_resample_instance_f32;
+
+
+  /**
+   * @brief Processing function for the Q15 polyphase sample rate converter.
+   * @param[in,out] S          points to an instance of the Q15 resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process.
+   * @return number of output samples written to pDst.
+   */
+  uint32_t arm_fir_resample_q15(
+  arm_fir_resample_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 polyphase sample rate converter.
+   * @param[in,out] S          points to an instance of the Q15 resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return  The function returns ARM_MATH_SUCCESS if initialization is successful,
+   * ARM_MATH_ARGUMENT_ERROR if L or M is 0, or ARM_MATH_LENGTH_ERROR if numTaps is not a multiple of L.
+   */
+  arm_status arm_fir_resample_init_q15(
+  arm_fir_resample_instance_q15 * S,
+  uint16_t L,
+  uint16_t M,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the Q31 polyphase sample rate converter.
+   * @param[in,out] S          points to an instance of the Q31 resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process.
+   * @return number of output samples written to pDst.
+   */
+  uint32_t arm_fir_resample_q31(
+  arm_fir_resample_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 polyphase sample rate converter.
+   * @param[in,out] S          points to an instance of the Q31 resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return  The function returns ARM_MATH_SUCCESS if initialization is successful,
+   * ARM_MATH_ARGUMENT_ERROR if L or M is 0, or ARM_MATH_LENGTH_ERROR if numTaps is not a multiple of L.
+   */
+  arm_status arm_fir_resample_init_q31(
+  arm_fir_resample_instance_q31 * S,
+  uint16_t L,
+  uint16_t M,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the floating-point polyphase sample rate converter.
+   * @param[in,out] S          points to an instance of the floating-point resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process.
+   * @return number of output samples written to pDst.
+   */
+  uint32_t arm_fir_resample_f32(
+  arm_fir_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point polyphase sample rate converter.
+   * @param[in,out] S          points to an instance of the floating-point resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return  The function returns ARM_MATH_SUCCESS if initialization is successful,
+   * ARM_MATH_ARGUMENT_ERROR if L or M is 0, or ARM_MATH_LENGTH_ERROR if numTaps is not a multiple of L.
+   */
+  arm_status arm_fir_resample_init_f32(
+  arm_fir_resample_instance_f32 * S,
+  uint16_t L,
+  uint16_t M,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Instance structure for the Q15 Farrow fractional resampler.
+   */
+  typedef struct
+  {
+    uint32_t step;                  /**< input samples advanced per output sample, in 8.24 format. */
+    uint32_t mu;                    /**< fractional position of the next output sample, in 0.24 format. */
+    uint32_t inputOffset;           /**< input samples to skip before the next output sample. */
+    q15_t *pState;                  /**< points to the state variable array. The array is of length blockSize+3. */
+  } arm_farrow_resample_instance_q15;
+
+
+  /**
+   * @brief Instance structure for the Q31 Farrow fractional resampler.
+   */
+  typedef struct
+  {
+    uint32_t step;                  /**< input samples advanced per output sample, in 8.24 format. */
+    uint32_t mu;                    /**< fractional position of the next output sample, in 0.24 format. */
+    uint32_t inputOffset;           /**< input samples to skip before the next output sample. */
+    q31_t *pState;                  /**< points to the state variable array. The array is of length blockSize+3. */
+  } arm_farrow_resample_instance_q31;
+
+
+  /**
+   * @brief Instance structure for the floating-point Farrow fractional resampler.
+   */
+  typedef struct
+  {
+    uint32_t step;                  /**< input samples advanced per output sample, in 8.24 format. */
+    uint32_t mu;                    /**< fractional position of the next output sample, in 0.24 format. */
+    uint32_t inputOffset;           /**< input samples to skip before the next output sample. */
+    float32_t *pState;              /**< points to the state variable array. The array is of length blockSize+3. */
+  } arm_farrow_resample_instance_f32;
+
+
+  /**
+   * @brief Processing function for the Q15 Farrow fractional resampler.
+   * @param[in,out] S          points to an instance of the Q15 Farrow resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process.
+   * @return number of output samples written to pDst.
+   */
+  uint32_t arm_farrow_resample_q15(
+  arm_farrow_resample_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 Farrow fractional resampler.
+   * @param[in,out] S          points to an instance of the Q15 Farrow resampler structure.
+   * @param[in]     step       input samples advanced per output sample (input rate / output rate), in 8.24 format.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return  The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if step is 0.
+   */
+  arm_status arm_farrow_resample_init_q15(
+  arm_farrow_resample_instance_q15 * S,
+  uint32_t step,
+  q15_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the Q31 Farrow fractional resampler.
+   * @param[in,out] S          points to an instance of the Q31 Farrow resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process.
+   * @return number of output samples written to pDst.
+   */
+  uint32_t arm_farrow_resample_q31(
+  arm_farrow_resample_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 Farrow fractional resampler.
+   * @param[in,out] S          points to an instance of the Q31 Farrow resampler structure.
+   * @param[in]     step       input samples advanced per output sample (input rate / output rate), in 8.24 format.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return  The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if step is 0.
+   */
+  arm_status arm_farrow_resample_init_q31(
+  arm_farrow_resample_instance_q31 * S,
+  uint32_t step,
+  q31_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the floating-point Farrow fractional resampler.
+   * @param[in,out] S          points to an instance of the floating-point Farrow resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process.
+   * @return number of output samples written to pDst.
+   */
+  uint32_t arm_farrow_resample_f32(
+  arm_farrow_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point Farrow fractional resampler.
+   * @param[in,out] S          points to an instance of the floating-point Farrow resampler structure.
+   * @param[in]     step       input samples advanced per output sample (input rate / output rate), in 8.24 format.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return  The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if step is 0.
+   */
+  arm_status arm_farrow_resample_init_f32(
+  arm_farrow_resample_instance_f32 * S,
+  uint32_t step,
+  float32_t * pState,
+  uint32_t blockSize);
+
+
   /**
    * @brief Instance structure for the high precision Q31 Biquad cascade filter.
    */
@@ -3603,6 +4056,20 @@ void arm_rfft_fast_f32(
     float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
   } arm_biquad_cascade_stereo_df2T_instance_f32;
 
+  /**
+   * @brief Instance structure for the floating-point multi-channel transposed direct form II Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint8_t numStages;               /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint16_t numChannels;            /**< number of interleaved channels. */
+    float32_t *pState;               /**< points to the array of state coefficients.  The array is of length 2*numStages*numChannels. */
+    float32_t *pCoeffs;              /**< points to the array of coefficients.  The array is of length 5*numStages. */
+    float32_t *pCoeffsStep;          /**< points to the array of per-sample coefficient increments used during a crossfade.  The array is of length 5*numStages. */
+    const float32_t *pCoeffsTarget;  /**< points to the coefficients reached at the end of the crossfade. */
+    uint32_t rampCount;              /**< number of samples left in the crossfade. */
+  } arm_biquad_cascade_multi_df2T_instance_f32;
+
   /**
    * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
    */
@@ -3684,6 +4151,51 @@ void arm_rfft_fast_f32(
   float32_t * pState);
 
 
+  /**
+   * @brief Processing function for the floating-point multi-channel transposed direct form II Biquad cascade filter.
+   * @param[in,out] S          points to an instance of the filter data structure.
+   * @param[in]     pSrc       points to the block of interleaved input data.
+   * @param[out]    pDst       points to the block of interleaved output data.
+   * @param[in]     blockSize  number of samples per channel to process.
+   */
+  void arm_biquad_cascade_multi_df2T_f32(
+  arm_biquad_cascade_multi_df2T_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point multi-channel transposed direct form II Biquad cascade filter.
+   * @param[in,out] S            points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of interleaved channels.
+   * @param[in]     pCoeffs      points to the filter coefficients.
+   * @param[in]     pCoeffsStep  points to the coefficient increment buffer, or NULL.
+   * @param[in]     pState       points to the state buffer.
+   */
+  void arm_biquad_cascade_multi_df2T_init_f32(
+  arm_biquad_cascade_multi_df2T_instance_f32 * S,
+  uint8_t numStages,
+  uint16_t numChannels,
+  float32_t * pCoeffs,
+  float32_t * pCoeffsStep,
+  float32_t * pState);
+
+
+  /**
+   * @brief  Coefficient update function for the floating-point multi-channel transposed direct form II Biquad cascade filter.
+   * @param[in,out] S           points to an instance of the filter data structure.
+   * @param[in]     pNewCoeffs  points to the new filter coefficients.
+   * @param[in]     rampLength  number of samples over which the coefficients are crossfaded, 0 to switch immediately.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if a crossfade is requested without an increment buffer.
+   */
+  arm_status arm_biquad_cascade_multi_df2T_update_f32(
+  arm_biquad_cascade_multi_df2T_instance_f32 * S,
+  const float32_t * pNewCoeffs,
+  uint32_t rampLength);
+
+
   /**
    * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
    * @param[in,out] S          points to an instance of the filter data structure.
@@ -4252,17 +4764,142 @@ void arm_rfft_fast_f32(
 
 
   /**
-   * @brief Correlation of floating-point sequences.
-   * @param[in]  pSrcA    points to the first input sequence.
-   * @param[in]  srcALen  length of the first input sequence.
-   * @param[in]  pSrcB    points to the second input sequence.
-   * @param[in]  srcBLen  length of the second input sequence.
-   * @param[out] pDst     points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @brief Instance structure for the floating-point frequency domain adaptive filter.
    */
-  void arm_correlate_f32(
-  float32_t * pSrcA,
-  uint32_t srcALen,
-  float32_t * pSrcB,
+  typedef struct
+  {
+    arm_rfft_fast_instance_f32 Srfft;  /**< Internal RFFT structure of length 2*blockLen. */
+    uint16_t blockLen;                 /**< partition length and number of samples per block. */
+    uint16_t numPartitions;            /**< number of partitions, the filter has blockLen*numPartitions taps. */
+    uint16_t head;                     /**< position of the newest input spectrum in the ring. */
+    uint32_t blockCount;               /**< number of blocks processed, saturating. */
+    float32_t mu;                      /**< normalized step size. */
+    float32_t beta;                    /**< forgetting factor of the power estimate. */
+    float32_t *pCoeffs;                /**< points to the coefficient spectra. The array is of length 2*blockLen*numPartitions. */
+    float32_t *pState;                 /**< points to the state variable array. The array is of length 2*blockLen*(numPartitions+4)+blockLen+1. */
+  } arm_fdaf_instance_f32;
+
+
+  /**
+   * @brief Processing function for the floating-point frequency domain adaptive filter.
+   * @param[in,out] S          points to an instance of the floating-point FDAF structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[in]     pRef       points to the block of reference data.
+   * @param[out]    pOut       points to the block of output data.
+   * @param[out]    pErr       points to the block of error data.
+   * @param[in]     blockSize  number of samples to process, a multiple of S->blockLen.
+   */
+  void arm_fdaf_f32(
+  arm_fdaf_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pRef,
+  float32_t * pOut,
+  float32_t * pErr,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point frequency domain adaptive filter.
+   * @param[in,out] S              points to an instance of the floating-point FDAF structure.
+   * @param[in]     blockLen       partition length, 2*blockLen must be supported by arm_rfft_fast_init_f32().
+   * @param[in]     numPartitions  number of partitions.
+   * @param[in]     pCoeffs        points to the coefficient spectra buffer.
+   * @param[in]     pState         points to the state buffer.
+   * @param[in]     mu             normalized step size, 0 < mu < 2.
+   * @param[in]     beta           forgetting factor of the power estimate.
+   * @return  The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR
+   * if numPartitions is 0 or 2*blockLen is not a supported FFT length.
+   */
+  arm_status arm_fdaf_init_f32(
+  arm_fdaf_instance_f32 * S,
+  uint16_t blockLen,
+  uint16_t numPartitions,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  float32_t mu,
+  float32_t beta);
+
+
+  /**
+   * @brief  Time domain coefficients of the floating-point frequency domain adaptive filter.
+   * @param[in,out] S     points to an instance of the floating-point FDAF structure.
+   * @param[out]    pDst  points to the blockLen*numPartitions taps, in natural order.
+   */
+  void arm_fdaf_get_coeffs_f32(
+  arm_fdaf_instance_f32 * S,
+  float32_t * pDst);
+
+
+  /**
+   * @brief Instance structure for the floating-point RLS filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;     /**< number of coefficients in the filter. */
+    float32_t *pState;    /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    float32_t *pCoeffs;   /**< points to the coefficient array. The array is of length numTaps. */
+    float32_t *pP;        /**< points to the inverse correlation matrix. The array is of length numTaps*numTaps. */
+    float32_t *pScratch;  /**< points to the scratch array. The array is of length numTaps. */
+    float32_t lambda;     /**< forgetting factor. */
+  } arm_rls_instance_f32;
+
+
+  /**
+   * @brief Processing function for the floating-point RLS filter.
+   * @param[in,out] S          points to an instance of the floating-point RLS filter structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[in]     pRef       points to the block of reference data.
+   * @param[out]    pOut       points to the block of output data.
+   * @param[out]    pErr       points to the block of error data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_rls_f32(
+  arm_rls_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pRef,
+  float32_t * pOut,
+  float32_t * pErr,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point RLS filter.
+   * @param[in,out] S          points to an instance of the floating-point RLS filter structure.
+   * @param[in]     numTaps    number of filter coefficients.
+   * @param[in]     pCoeffs    points to the coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     pP         points to the inverse correlation matrix buffer.
+   * @param[in]     pScratch   points to the scratch buffer.
+   * @param[in]     lambda     forgetting factor.
+   * @param[in]     delta      regularization, P starts as the identity matrix divided by delta.
+   * @param[in]     blockSize  number of samples to process per call.
+   * @return  The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR
+   * if numTaps is 0 or delta is not positive.
+   */
+  arm_status arm_rls_init_f32(
+  arm_rls_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  float32_t * pP,
+  float32_t * pScratch,
+  float32_t lambda,
+  float32_t delta,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Correlation of floating-point sequences.
+   * @param[in]  pSrcA    points to the first input sequence.
+   * @param[in]  srcALen  length of the first input sequence.
+   * @param[in]  pSrcB    points to the second input sequence.
+   * @param[in]  srcBLen  length of the second input sequence.
+   * @param[out] pDst     points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   */
+  void arm_correlate_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
   uint32_t srcBLen,
   float32_t * pDst);
 
@@ -4405,6 +5042,140 @@ void arm_rfft_fast_f32(
   q7_t * pDst);
 
 
+  /**
+   * @brief Correlation of floating-point sequences over a window of lags.
+   * @param[in]  pSrcA    points to the first input sequence.
+   * @param[in]  srcALen  length of the first input sequence.
+   * @param[in]  pSrcB    points to the second input sequence.
+   * @param[in]  srcBLen  length of the second input sequence.
+   * @param[in]  lagLo    first lag to compute.
+   * @param[in]  lagHi    last lag to compute.
+   * @param[out] pDst     points to the block of output data  Length lagHi - lagLo + 1.
+   */
+  void arm_correlate_lags_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  int32_t lagLo,
+  int32_t lagHi,
+  float32_t * pDst);
+
+
+  /**
+   * @brief Correlation of Q15 sequences over a window of lags.
+   * @param[in]  pSrcA    points to the first input sequence.
+   * @param[in]  srcALen  length of the first input sequence.
+   * @param[in]  pSrcB    points to the second input sequence.
+   * @param[in]  srcBLen  length of the second input sequence.
+   * @param[in]  lagLo    first lag to compute.
+   * @param[in]  lagHi    last lag to compute.
+   * @param[out] pDst     points to the block of output data  Length lagHi - lagLo + 1.
+   */
+  void arm_correlate_lags_q15(
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  int32_t lagLo,
+  int32_t lagHi,
+  q15_t * pDst);
+
+
+  /**
+   * @brief Correlation of Q31 sequences over a window of lags.
+   * @param[in]  pSrcA    points to the first input sequence.
+   * @param[in]  srcALen  length of the first input sequence.
+   * @param[in]  pSrcB    points to the second input sequence.
+   * @param[in]  srcBLen  length of the second input sequence.
+   * @param[in]  lagLo    first lag to compute.
+   * @param[in]  lagHi    last lag to compute.
+   * @param[out] pDst     points to the block of output data  Length lagHi - lagLo + 1.
+   */
+  void arm_correlate_lags_q31(
+  q31_t * pSrcA,
+  uint32_t srcALen,
+  q31_t * pSrcB,
+  uint32_t srcBLen,
+  int32_t lagLo,
+  int32_t lagHi,
+  q31_t * pDst);
+
+
+  /**
+   * @brief Peak of a floating-point correlation with sub-sample interpolation.
+   * @param[in]  pSrc     points to the correlation.
+   * @param[in]  numLags  number of lags in pSrc.
+   * @param[in]  lagLo    lag of pSrc[0].
+   * @param[out] pLag     lag of the peak, with a fractional part.
+   * @param[out] pPeak    interpolated value of the peak.
+   */
+  void arm_correlate_peak_f32(
+  float32_t * pSrc,
+  uint32_t numLags,
+  int32_t lagLo,
+  float32_t * pLag,
+  float32_t * pPeak);
+
+
+  /**
+   * @brief Weighting of the cross spectrum in arm_correlate_fft_f32().
+   */
+  typedef enum
+  {
+    ARM_CORRELATE_PLAIN = 0,           /**< plain correlation. */
+    ARM_CORRELATE_PHAT = 1             /**< generalized cross-correlation with phase transform (GCC-PHAT). */
+  } arm_correlate_weighting;
+
+
+  /**
+   * @brief Instance structure for the floating-point FFT correlation.
+   */
+  typedef struct
+  {
+    arm_rfft_fast_instance_f32 Srfft;  /**< Internal RFFT structure. */
+    uint16_t fftLen;                   /**< length of the real FFTs. */
+    float32_t *pScratch;               /**< points to the scratch buffer of length 3*fftLen. */
+  } arm_correlate_fft_instance_f32;
+
+
+  /**
+   * @brief  Initialization function for the floating-point FFT correlation.
+   * @param[in,out] S         points to an instance of the floating-point FFT correlation structure.
+   * @param[in]     fftLen    length of the real FFTs. Supported lengths are the ones of arm_rfft_fast_init_f32().
+   * @param[in]     pScratch  points to the scratch buffer of length 3*fftLen.
+   * @return  The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if fftLen is not supported.
+   */
+  arm_status arm_correlate_fft_init_f32(
+  arm_correlate_fft_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pScratch);
+
+
+  /**
+   * @brief Correlation of floating-point sequences computed with real FFTs.
+   * @param[in]  S          points to an instance of the floating-point FFT correlation structure.
+   * @param[in]  pSrcA      points to the first input sequence.
+   * @param[in]  srcALen    length of the first input sequence.
+   * @param[in]  pSrcB      points to the second input sequence.
+   * @param[in]  srcBLen    length of the second input sequence.
+   * @param[in]  lagLo      first lag to output.
+   * @param[in]  lagHi      last lag to output.
+   * @param[in]  weighting  weighting of the cross spectrum.
+   * @param[out] pDst       points to the block of output data  Length lagHi - lagLo + 1.
+   */
+  void arm_correlate_fft_f32(
+  arm_correlate_fft_instance_f32 * S,
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  int32_t lagLo,
+  int32_t lagHi,
+  arm_correlate_weighting weighting,
+  float32_t * pDst);
+
+
   /**
    * @brief Instance structure for the floating-point sparse FIR filter.
    */
@@ -4606,6 +5377,131 @@ void arm_rfft_fast_f32(
   uint32_t blockSize);
 
 
+  /**
+   * @brief Instance structure for the floating-point sparse FIR filter with gather offsets.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;             /**< number of nonzero coefficients in the filter. */
+    uint32_t blockSize;           /**< largest number of samples processed per call. */
+    uint32_t maxDelay;            /**< largest tap delay supported. */
+    uint32_t delaySize;           /**< length of the delay line, maxDelay+blockSize. */
+    uint32_t stateIndex;          /**< position the next input sample is written to. */
+    float32_t *pState;            /**< points to the state buffer array. The array is of length maxDelay+2*blockSize. */
+    float32_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps. */
+    uint32_t *pOffsets;           /**< points to the gather offsets, delaySize-pTapDelay[k]. The array is of length numTaps. */
+  } arm_fir_sparse_gather_instance_f32;
+
+
+  /**
+   * @brief Processing function for the floating-point sparse FIR filter with gather offsets.
+   * @param[in,out] S          points to an instance of the floating-point sparse gather FIR structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process, at most the blockSize given at initialization.
+   */
+  void arm_fir_sparse_gather_f32(
+  arm_fir_sparse_gather_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point sparse FIR filter with gather offsets.
+   * @param[in,out] S          points to an instance of the floating-point sparse gather FIR structure.
+   * @param[in]     numTaps    number of nonzero coefficients in the filter.
+   * @param[in]     pCoeffs    points to the array of filter coefficients.
+   * @param[in]     pState     points to the state buffer of length maxDelay+2*blockSize.
+   * @param[in]     pTapDelay  points to the array of tap delays.
+   * @param[in]     pOffsets   points to the array the gather offsets are computed into.
+   * @param[in]     maxDelay   largest tap delay supported.
+   * @param[in]     blockSize  largest number of samples processed per call.
+   * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR for a zero blockSize or a delay outside [0, maxDelay].
+   */
+  arm_status arm_fir_sparse_gather_init_f32(
+  arm_fir_sparse_gather_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  int32_t * pTapDelay,
+  uint32_t * pOffsets,
+  uint32_t maxDelay,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Tap update for the floating-point sparse FIR filter with gather offsets, keeping the delay line.
+   * @param[in,out] S          points to an instance of the floating-point sparse gather FIR structure.
+   * @param[in]     pCoeffs    points to the array of numTaps filter coefficients.
+   * @param[in]     pTapDelay  points to the array of numTaps tap delays.
+   * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR for a delay outside [0, maxDelay].
+   */
+  arm_status arm_fir_sparse_gather_set_taps_f32(
+  arm_fir_sparse_gather_instance_f32 * S,
+  float32_t * pCoeffs,
+  int32_t * pTapDelay);
+
+
+  /**
+   * @brief Instance structure for the floating-point crossfading FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;             /**< number of filter coefficients in the filter. */
+    float32_t *pState;            /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    float32_t *pCoeffs;           /**< points to the active coefficient set. The array is of length numTaps. */
+    float32_t *pCoeffsNext;       /**< points to the set being faded in, or NULL when no fade is running. */
+    float32_t *pCoeffsPending;    /**< points to the set queued behind the running fade, or NULL. */
+    uint32_t fadeLen;             /**< length of a crossfade in samples. */
+    uint32_t fadeCnt;             /**< samples of the running fade already produced. */
+    float32_t fadeStep;           /**< gain step of a fade, 1/fadeLen. */
+  } arm_fir_xfade_instance_f32;
+
+
+  /**
+   * @brief Processing function for the floating-point crossfading FIR filter.
+   * @param[in,out] S          points to an instance of the floating-point crossfading FIR structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_fir_xfade_f32(
+  arm_fir_xfade_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point crossfading FIR filter.
+   * @param[in,out] S          points to an instance of the floating-point crossfading FIR structure.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the initial coefficient set.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  largest number of samples processed per call.
+   * @param[in]     fadeLen    length of a crossfade in samples, zero to switch at once.
+   * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if numTaps is zero.
+   */
+  arm_status arm_fir_xfade_init_f32(
+  arm_fir_xfade_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize,
+  uint32_t fadeLen);
+
+
+  /**
+   * @brief  Coefficient update for the floating-point crossfading FIR filter.
+   * @param[in,out] S        points to an instance of the floating-point crossfading FIR structure.
+   * @param[in]     pCoeffs  points to the new coefficient set, faded in from the next sample.
+   */
+  void arm_fir_xfade_set_coeffs_f32(
+  arm_fir_xfade_instance_f32 * S,
+  float32_t * pCoeffs);
+
+
   /**
    * @brief  Floating-point sin_cos function.
    * @param[in]  theta   input value in degrees
@@ -4925,6 +5821,278 @@ void arm_rfft_fast_f32(
   arm_matrix_instance_f64 * dst);
 
 
+  /**
+   * @brief Floating-point Cholesky decomposition.
+   * @param[in]  pSrc  points to the symmetric positive definite input matrix structure.
+   * @param[out] pDst  points to the lower triangular factor, which can be the same as pSrc.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the dimensions do not match and
+   * ARM_MATH_DECOMPOSITION_FAILURE if the input matrix is not positive definite.
+   */
+  arm_status arm_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst);
+
+
+  /**
+   * @brief Solves a linear system with a floating-point Cholesky factor.
+   * @param[in]  pSrcL  points to the lower triangular factor.
+   * @param[in]  pSrcB  points to the right-hand side matrix structure.
+   * @param[out] pDst   points to the solution matrix structure, which can be the same as pSrcB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the dimensions do not match.
+   */
+  arm_status arm_mat_cholesky_solve_f32(
+  const arm_matrix_instance_f32 * pSrcL,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst);
+
+
+  /**
+   * @brief Floating-point LDLT decomposition.
+   * @param[in]  pSrc  points to the symmetric input matrix structure.
+   * @param[out] pDst  points to the packed factors, which can be the same as pSrc.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the dimensions do not match and
+   * ARM_MATH_DECOMPOSITION_FAILURE if a pivot is zero.
+   */
+  arm_status arm_mat_ldlt_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst);
+
+
+  /**
+   * @brief Solves a linear system with floating-point LDLT factors.
+   * @param[in]  pSrcLD  points to the packed factors.
+   * @param[in]  pSrcB   points to the right-hand side matrix structure.
+   * @param[out] pDst    points to the solution matrix structure, which can be the same as pSrcB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the dimensions do not match.
+   */
+  arm_status arm_mat_ldlt_solve_f32(
+  const arm_matrix_instance_f32 * pSrcLD,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst);
+
+
+  /**
+   * @brief Floating-point LU decomposition with partial pivoting.
+   * @param[in]  pSrc     points to the input matrix structure.
+   * @param[out] pDst     points to the packed factors, which can be the same as pSrc.
+   * @param[out] pPivots  points to the row exchanges, an array of pSrc->numRows values.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the dimensions do not match and
+   * ARM_MATH_SINGULAR if the input matrix is singular.
+   */
+  arm_status arm_mat_lu_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst,
+  uint16_t * pPivots);
+
+
+  /**
+   * @brief Solves a linear system with floating-point LU factors.
+   * @param[in]  pSrcLU   points to the packed factors.
+   * @param[in]  pPivots  points to the row exchanges.
+   * @param[in]  pSrcB    points to the right-hand side matrix structure.
+   * @param[out] pDst     points to the solution matrix structure, which can be the same as pSrcB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the dimensions do not match.
+   */
+  arm_status arm_mat_lu_solve_f32(
+  const arm_matrix_instance_f32 * pSrcLU,
+  const uint16_t * pPivots,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst);
+
+
+  /**
+   * @brief Floating-point QR decomposition.
+   * @param[in]  pSrc  points to the input matrix structure with numRows >= numCols.
+   * @param[out] pDst  points to the packed factors, which can be the same as pSrc.
+   * @param[out] pTau  points to the reflection factors, an array of pSrc->numCols values.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the dimensions do not match.
+   */
+  arm_status arm_mat_qr_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst,
+  float32_t * pTau);
+
+
+  /**
+   * @brief Solves a linear least-squares problem with floating-point QR factors.
+   * @param[in]     pSrcQR  points to the packed factors.
+   * @param[in]     pTau    points to the reflection factors.
+   * @param[in,out] pSrcB   points to the right-hand side matrix structure, which is overwritten.
+   * @param[out]    pDst    points to the solution matrix structure, which can be the same as pSrcB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the dimensions do not match and
+   * ARM_MATH_SINGULAR if R has a zero diagonal element.
+   */
+  arm_status arm_mat_qr_solve_f32(
+  const arm_matrix_instance_f32 * pSrcQR,
+  const float32_t * pTau,
+  arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst);
+
+
+  /**
+   * @brief Floating-point lower triangular solve.
+   * @param[in]  pSrcA  points to the lower triangular matrix structure.
+   * @param[in]  pSrcB  points to the right-hand side matrix structure.
+   * @param[out] pDst   points to the solution matrix structure, which can be the same as pSrcB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the dimensions do not match and
+   * ARM_MATH_SINGULAR if a diagonal element is zero.
+   */
+  arm_status arm_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst);
+
+
+  /**
+   * @brief Floating-point upper triangular solve.
+   * @param[in]  pSrcA  points to the upper triangular matrix structure.
+   * @param[in]  pSrcB  points to the right-hand side matrix structure.
+   * @param[out] pDst   points to the solution matrix structure, which can be the same as pSrcB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the dimensions do not match and
+   * ARM_MATH_SINGULAR if a diagonal element is zero.
+   */
+  arm_status arm_mat_solve_upper_triangular_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst);
+
+
+  /**
+   * @brief Double-precision floating-point Cholesky decomposition.
+   * @param[in]  pSrc  points to the symmetric positive definite input matrix structure.
+   * @param[out] pDst  points to the lower triangular factor, which can be the same as pSrc.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the dimensions do not match and
+   * ARM_MATH_DECOMPOSITION_FAILURE if the input matrix is not positive definite.
+   */
+  arm_status arm_mat_cholesky_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pDst);
+
+
+  /**
+   * @brief Solves a linear system with a double-precision floating-point Cholesky factor.
+   * @param[in]  pSrcL  points to the lower triangular factor.
+   * @param[in]  pSrcB  points to the right-hand side matrix structure.
+   * @param[out] pDst   points to the solution matrix structure, which can be the same as pSrcB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the dimensions do not match.
+   */
+  arm_status arm_mat_cholesky_solve_f64(
+  const arm_matrix_instance_f64 * pSrcL,
+  const arm_matrix_instance_f64 * pSrcB,
+  arm_matrix_instance_f64 * pDst);
+
+
+  /**
+   * @brief Double-precision floating-point LDLT decomposition.
+   * @param[in]  pSrc  points to the symmetric input matrix structure.
+   * @param[out] pDst  points to the packed factors, which can be the same as pSrc.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the dimensions do not match and
+   * ARM_MATH_DECOMPOSITION_FAILURE if a pivot is zero.
+   */
+  arm_status arm_mat_ldlt_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pDst);
+
+
+  /**
+   * @brief Solves a linear system with double-precision floating-point LDLT factors.
+   * @param[in]  pSrcLD  points to the packed factors.
+   * @param[in]  pSrcB   points to the right-hand side matrix structure.
+   * @param[out] pDst    points to the solution matrix structure, which can be the same as pSrcB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the dimensions do not match.
+   */
+  arm_status arm_mat_ldlt_solve_f64(
+  const arm_matrix_instance_f64 * pSrcLD,
+  const arm_matrix_instance_f64 * pSrcB,
+  arm_matrix_instance_f64 * pDst);
+
+
+  /**
+   * @brief Double-precision floating-point LU decomposition with partial pivoting.
+   * @param[in]  pSrc     points to the input matrix structure.
+   * @param[out] pDst     points to the packed factors, which can be the same as pSrc.
+   * @param[out] pPivots  points to the row exchanges, an array of pSrc->numRows values.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the dimensions do not match and
+   * ARM_MATH_SINGULAR if the input matrix is singular.
+   */
+  arm_status arm_mat_lu_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pDst,
+  uint16_t * pPivots);
+
+
+  /**
+   * @brief Solves a linear system with double-precision floating-point LU factors.
+   * @param[in]  pSrcLU   points to the packed factors.
+   * @param[in]  pPivots  points to the row exchanges.
+   * @param[in]  pSrcB    points to the right-hand side matrix structure.
+   * @param[out] pDst     points to the solution matrix structure, which can be the same as pSrcB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the dimensions do not match.
+   */
+  arm_status arm_mat_lu_solve_f64(
+  const arm_matrix_instance_f64 * pSrcLU,
+  const uint16_t * pPivots,
+  const arm_matrix_instance_f64 * pSrcB,
+  arm_matrix_instance_f64 * pDst);
+
+
+  /**
+   * @brief Double-precision floating-point QR decomposition.
+   * @param[in]  pSrc  points to the input matrix structure with numRows >= numCols.
+   * @param[out] pDst  points to the packed factors, which can be the same as pSrc.
+   * @param[out] pTau  points to the reflection factors, an array of pSrc->numCols values.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the dimensions do not match.
+   */
+  arm_status arm_mat_qr_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pDst,
+  float64_t * pTau);
+
+
+  /**
+   * @brief Solves a linear least-squares problem with double-precision floating-point QR factors.
+   * @param[in]     pSrcQR  points to the packed factors.
+   * @param[in]     pTau    points to the reflection factors.
+   * @param[in,out] pSrcB   points to the right-hand side matrix structure, which is overwritten.
+   * @param[out]    pDst    points to the solution matrix structure, which can be the same as pSrcB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the dimensions do not match and
+   * ARM_MATH_SINGULAR if R has a zero diagonal element.
+   */
+  arm_status arm_mat_qr_solve_f64(
+  const arm_matrix_instance_f64 * pSrcQR,
+  const float64_t * pTau,
+  arm_matrix_instance_f64 * pSrcB,
+  arm_matrix_instance_f64 * pDst);
+
+
+  /**
+   * @brief Double-precision floating-point lower triangular solve.
+   * @param[in]  pSrcA  points to the lower triangular matrix structure.
+   * @param[in]  pSrcB  points to the right-hand side matrix structure.
+   * @param[out] pDst   points to the solution matrix structure, which can be the same as pSrcB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the dimensions do not match and
+   * ARM_MATH_SINGULAR if a diagonal element is zero.
+   */
+  arm_status arm_mat_solve_lower_triangular_f64(
+  const arm_matrix_instance_f64 * pSrcA,
+  const arm_matrix_instance_f64 * pSrcB,
+  arm_matrix_instance_f64 * pDst);
+
+
+  /**
+   * @brief Double-precision floating-point upper triangular solve.
+   * @param[in]  pSrcA  points to the upper triangular matrix structure.
+   * @param[in]  pSrcB  points to the right-hand side matrix structure.
+   * @param[out] pDst   points to the solution matrix structure, which can be the same as pSrcB.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH if the dimensions do not match and
+   * ARM_MATH_SINGULAR if a diagonal element is zero.
+   */
+  arm_status arm_mat_solve_upper_triangular_f64(
+  const arm_matrix_instance_f64 * pSrcA,
+  const arm_matrix_instance_f64 * pSrcB,
+  arm_matrix_instance_f64 * pDst);
+
+
 
   /**
    * @ingroup groupController
@@ -5685,6 +6853,181 @@ void arm_rfft_fast_f32(
   q15_t x);
 
 
+  /**
+   * @brief  Vector sine for floating-point data.
+   * @param[in]   pSrc       points to the input vector in radians.
+   * @param[out]  pDst       points to the output vector.
+   * @param[in]   blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void arm_vsin_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Vector sine for Q31 data.
+   * @param[in]   pSrc       points to the scaled input vector in radians.
+   * @param[out]  pDst       points to the output vector.
+   * @param[in]   blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void arm_vsin_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Vector sine for Q15 data.
+   * @param[in]   pSrc       points to the scaled input vector in radians.
+   * @param[out]  pDst       points to the output vector.
+   * @param[in]   blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void arm_vsin_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Vector cosine for floating-point data.
+   * @param[in]   pSrc       points to the input vector in radians.
+   * @param[out]  pDst       points to the output vector.
+   * @param[in]   blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void arm_vcos_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Vector cosine for Q31 data.
+   * @param[in]   pSrc       points to the scaled input vector in radians.
+   * @param[out]  pDst       points to the output vector.
+   * @param[in]   blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void arm_vcos_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Vector cosine for Q15 data.
+   * @param[in]   pSrc       points to the scaled input vector in radians.
+   * @param[out]  pDst       points to the output vector.
+   * @param[in]   blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void arm_vcos_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Vector exponential for floating-point data.
+   * @param[in]   pSrc       points to the input vector.
+   * @param[out]  pDst       points to the output vector.
+   * @param[in]   blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void arm_vexp_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Vector natural logarithm for floating-point data.
+   * @param[in]   pSrc       points to the input vector.
+   * @param[out]  pDst       points to the output vector.
+   * @param[in]   blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void arm_vlog_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Vector hyperbolic tangent for floating-point data.
+   * @param[in]   pSrc       points to the input vector.
+   * @param[out]  pDst       points to the output vector.
+   * @param[in]   blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void arm_vtanh_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Vector four-quadrant arctangent for floating-point data.
+   * @param[in]   pSrcY      points to the vector of y coordinates.
+   * @param[in]   pSrcX      points to the vector of x coordinates.
+   * @param[out]  pDst       points to the output vector in radians.
+   * @param[in]   blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void arm_vatan2_f32(
+  float32_t * pSrcY,
+  float32_t * pSrcX,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Vector four-quadrant arctangent for Q31 data.
+   * @param[in]   pSrcY      points to the vector of y coordinates.
+   * @param[in]   pSrcX      points to the vector of x coordinates.
+   * @param[out]  pDst       points to the output vector, angle/pi in Q31 format.
+   * @param[in]   blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void arm_vatan2_q31(
+  q31_t * pSrcY,
+  q31_t * pSrcX,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Vector four-quadrant arctangent for Q15 data.
+   * @param[in]   pSrcY      points to the vector of y coordinates.
+   * @param[in]   pSrcX      points to the vector of x coordinates.
+   * @param[out]  pDst       points to the output vector, angle/pi in Q15 format.
+   * @param[in]   blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void arm_vatan2_q15(
+  q15_t * pSrcY,
+  q15_t * pSrcX,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Vector reciprocal square root for floating-point data.
+   * @param[in]   pSrc       points to the input vector.
+   * @param[out]  pDst       points to the output vector.
+   * @param[in]   blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void arm_vinvsqrt_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
   /**
    * @ingroup groupFastMath
    */
@@ -5759,21 +7102,60 @@ void arm_rfft_fast_f32(
    * @return The function returns ARM_MATH_SUCCESS if input value is positive value or ARM_MATH_ARGUMENT_ERROR if
    * <code>in</code> is negative value and returns zero output for negative values.
    */
-  arm_status arm_sqrt_q31(
-  q31_t in,
-  q31_t * pOut);
+  arm_status arm_sqrt_q31(
+  q31_t in,
+  q31_t * pOut);
+
+
+  /**
+   * @brief  Q15 square root function.
+   * @param[in]  in    input value.  The range of the input value is [0 +1) or 0x0000 to 0x7FFF.
+   * @param[out] pOut  square root of input value.
+   * @return The function returns ARM_MATH_SUCCESS if input value is positive value or ARM_MATH_ARGUMENT_ERROR if
+   * <code>in</code> is negative value and returns zero output for negative values.
+   */
+  arm_status arm_sqrt_q15(
+  q15_t in,
+  q15_t * pOut);
+
+
+  /**
+   * @brief  Vector floating-point square root.
+   * @param[in]   pSrc       points to the input vector.
+   * @param[out]  pDst       points to the output vector.
+   * @param[in]   blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void arm_vsqrt_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Vector Q31 square root.
+   * @param[in]   pSrc       points to the input vector.
+   * @param[out]  pDst       points to the output vector.
+   * @param[in]   blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void arm_vsqrt_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief  Q15 square root function.
-   * @param[in]  in    input value.  The range of the input value is [0 +1) or 0x0000 to 0x7FFF.
-   * @param[out] pOut  square root of input value.
-   * @return The function returns ARM_MATH_SUCCESS if input value is positive value or ARM_MATH_ARGUMENT_ERROR if
-   * <code>in</code> is negative value and returns zero output for negative values.
+   * @brief  Vector Q15 square root.
+   * @param[in]   pSrc       points to the input vector.
+   * @param[out]  pDst       points to the output vector.
+   * @param[in]   blockSize  number of samples in each vector.
+   * @return none.
    */
-  arm_status arm_sqrt_q15(
-  q15_t in,
-  q15_t * pOut);
+  void arm_vsqrt_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
 
   /**
    * @} end of SQRT group
@@ -6522,6 +7904,344 @@ void arm_rfft_fast_f32(
   uint32_t * pIndex);
 
 
+  /**
+   * @brief Results of the floating-point fused statistics functions.
+   */
+  typedef struct
+  {
+    float32_t mean;              /**< mean of the samples. */
+    float32_t var;               /**< variance, normalized by the number of samples minus one. */
+    float32_t std;               /**< standard deviation. */
+    float32_t rms;               /**< root mean square. */
+    float32_t power;             /**< sum of the squares of the samples. */
+    float32_t min;               /**< minimum value. */
+    float32_t max;               /**< maximum value. */
+    uint32_t minIndex;           /**< position of the first minimum. */
+    uint32_t maxIndex;           /**< position of the first maximum. */
+  } arm_stats_result_f32;
+
+  /**
+   * @brief Instance structure for the floating-point statistics accumulator.
+   */
+  typedef struct
+  {
+    uint32_t count;              /**< number of samples accumulated. */
+    float32_t mean;              /**< running mean. */
+    float32_t m2;                /**< running sum of squared deviations from the mean. */
+    float32_t power;             /**< running sum of the squares of the samples. */
+    float32_t min;               /**< running minimum. */
+    float32_t max;               /**< running maximum. */
+    uint32_t minIndex;           /**< stream position of the first minimum. */
+    uint32_t maxIndex;           /**< stream position of the first maximum. */
+  } arm_stats_instance_f32;
+
+
+/**
+ * @brief Fused statistics of a floating-point vector.
+ * @param[in]  pSrc       points to the input buffer
+ * @param[in]  blockSize  length of the input vector
+ * @param[out] pResult    statistics returned here
+ */
+  void arm_stats_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_f32 * pResult);
+
+
+/**
+ * @brief Initialization function for the floating-point statistics accumulator.
+ * @param[in,out] S  points to an instance of the floating-point statistics accumulator.
+ */
+  void arm_stats_init_f32(
+  arm_stats_instance_f32 * S);
+
+
+/**
+ * @brief Adds a block of samples to the floating-point statistics accumulator.
+ * @param[in,out] S          points to an instance of the floating-point statistics accumulator.
+ * @param[in]     pSrc       points to the block of input samples.
+ * @param[in]     blockSize  number of samples in the block.
+ */
+  void arm_stats_update_f32(
+  arm_stats_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize);
+
+
+/**
+ * @brief Reads the statistics of the floating-point statistics accumulator.
+ * @param[in]  S        points to an instance of the floating-point statistics accumulator.
+ * @param[out] pResult  statistics of all samples added since initialization.
+ */
+  void arm_stats_get_f32(
+  const arm_stats_instance_f32 * S,
+  arm_stats_result_f32 * pResult);
+
+
+  /**
+   * @brief Instance structure for the floating-point moving window statistics.
+   */
+  typedef struct
+  {
+    uint16_t winLen;             /**< number of samples in the window. */
+    uint16_t pos;                /**< position of the oldest sample in the history. */
+    float32_t *pState;           /**< points to the history array of length winLen. */
+    float32_t mean;              /**< running mean of the window. */
+    float32_t m2;                /**< running sum of squared deviations from the mean. */
+    float32_t m2Peak;            /**< peak of m2 since the last re-normalization. */
+  } arm_mov_stats_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q15 moving window statistics.
+   */
+  typedef struct
+  {
+    uint16_t winLen;             /**< number of samples in the window. */
+    uint16_t pos;                /**< position of the oldest sample in the history. */
+    q15_t *pState;               /**< points to the history array of length winLen. */
+    q31_t sum;                   /**< running sum of the window. */
+    q63_t sumOfSquares;          /**< running sum of squares of the window. */
+  } arm_mov_stats_instance_q15;
+
+  /**
+   * @brief Instance structure for the floating-point moving minimum and maximum.
+   */
+  typedef struct
+  {
+    uint16_t winLen;             /**< number of samples in the window. */
+    uint16_t minHead;            /**< front of the minimum queue. */
+    uint16_t minLen;             /**< length of the minimum queue. */
+    uint16_t maxHead;            /**< front of the maximum queue. */
+    uint16_t maxLen;             /**< length of the maximum queue. */
+    uint32_t count;              /**< stream position of the next sample. */
+    float32_t *pState;           /**< points to the queue values, of length 2*winLen. */
+    uint32_t *pIndex;            /**< points to the queue stream positions, of length 2*winLen. */
+  } arm_mov_minmax_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q15 moving minimum and maximum.
+   */
+  typedef struct
+  {
+    uint16_t winLen;             /**< number of samples in the window. */
+    uint16_t minHead;            /**< front of the minimum queue. */
+    uint16_t minLen;             /**< length of the minimum queue. */
+    uint16_t maxHead;            /**< front of the maximum queue. */
+    uint16_t maxLen;             /**< length of the maximum queue. */
+    uint32_t count;              /**< stream position of the next sample. */
+    q15_t *pState;               /**< points to the queue values, of length 2*winLen. */
+    uint32_t *pIndex;            /**< points to the queue stream positions, of length 2*winLen. */
+  } arm_mov_minmax_instance_q15;
+
+  /**
+   * @brief Instance structure for the floating-point moving rank filter.
+   */
+  typedef struct
+  {
+    uint16_t winLen;             /**< number of samples in the window. */
+    uint16_t rank;               /**< rank of the output, 0 for the smallest sample. */
+    uint16_t slot;               /**< position of the oldest sample in the history. */
+    float32_t *pState;           /**< points to the history array of length winLen. */
+    uint16_t *pHeap;             /**< history positions in heap order, the first rank+1 form a max-heap. */
+    uint16_t *pPos;              /**< heap position of each history sample. */
+  } arm_mov_rank_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q15 moving rank filter.
+   */
+  typedef struct
+  {
+    uint16_t winLen;             /**< number of samples in the window. */
+    uint16_t rank;               /**< rank of the output, 0 for the smallest sample. */
+    uint16_t slot;               /**< position of the oldest sample in the history. */
+    q15_t *pState;               /**< points to the history array of length winLen. */
+    uint16_t *pHeap;             /**< history positions in heap order, the first rank+1 form a max-heap. */
+    uint16_t *pPos;              /**< heap position of each history sample. */
+  } arm_mov_rank_instance_q15;
+
+
+/**
+ * @brief Initialization function for the floating-point moving window statistics.
+ * @param[in,out] S       points to an instance of the floating-point moving window statistics structure.
+ * @param[in]     winLen  number of samples in the window.
+ * @param[in]     pState  points to the state buffer of length winLen.
+ * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if winLen is 0.
+ */
+  arm_status arm_mov_stats_init_f32(
+  arm_mov_stats_instance_f32 * S,
+  uint16_t winLen,
+  float32_t * pState);
+
+
+/**
+ * @brief Moving window mean and variance of floating-point data.
+ * @param[in,out] S          points to an instance of the floating-point moving window statistics structure.
+ * @param[in]     pSrc       points to the block of input samples.
+ * @param[out]    pMean      points to the block of window means.
+ * @param[out]    pVar       points to the block of window variances.
+ * @param[in]     blockSize  number of samples to process.
+ */
+  void arm_mov_stats_f32(
+  arm_mov_stats_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pMean,
+  float32_t * pVar,
+  uint32_t blockSize);
+
+
+/**
+ * @brief Initialization function for the floating-point moving minimum and maximum.
+ * @param[in,out] S       points to an instance of the floating-point moving minimum and maximum structure.
+ * @param[in]     winLen  number of samples in the window.
+ * @param[in]     pState  points to the queue value buffer of length 2*winLen.
+ * @param[in]     pIndex  points to the queue position buffer of length 2*winLen.
+ * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if winLen is 0.
+ */
+  arm_status arm_mov_minmax_init_f32(
+  arm_mov_minmax_instance_f32 * S,
+  uint16_t winLen,
+  float32_t * pState,
+  uint32_t * pIndex);
+
+
+/**
+ * @brief Moving window minimum and maximum of floating-point data.
+ * @param[in,out] S          points to an instance of the floating-point moving minimum and maximum structure.
+ * @param[in]     pSrc       points to the block of input samples.
+ * @param[out]    pMin       points to the block of window minima.
+ * @param[out]    pMax       points to the block of window maxima.
+ * @param[in]     blockSize  number of samples to process.
+ */
+  void arm_mov_minmax_f32(
+  arm_mov_minmax_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pMin,
+  float32_t * pMax,
+  uint32_t blockSize);
+
+
+/**
+ * @brief Initialization function for the floating-point moving rank filter.
+ * @param[in,out] S       points to an instance of the floating-point moving rank filter structure.
+ * @param[in]     winLen  number of samples in the window.
+ * @param[in]     rank    rank of the output within the window, 0 for the smallest sample.
+ * @param[in]     pState  points to the state buffer of length winLen.
+ * @param[in]     pIndex  points to the heap index buffer of length 2*winLen.
+ * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if winLen is 0 or rank is not smaller than winLen.
+ */
+  arm_status arm_mov_rank_init_f32(
+  arm_mov_rank_instance_f32 * S,
+  uint16_t winLen,
+  uint16_t rank,
+  float32_t * pState,
+  uint16_t * pIndex);
+
+
+/**
+ * @brief Moving window rank filter for floating-point data.
+ * @param[in,out] S          points to an instance of the floating-point moving rank filter structure.
+ * @param[in]     pSrc       points to the block of input samples.
+ * @param[out]    pDst       points to the block of output samples.
+ * @param[in]     blockSize  number of samples to process.
+ */
+  void arm_mov_rank_f32(
+  arm_mov_rank_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+/**
+ * @brief Initialization function for the Q15 moving window statistics.
+ * @param[in,out] S       points to an instance of the Q15 moving window statistics structure.
+ * @param[in]     winLen  number of samples in the window.
+ * @param[in]     pState  points to the state buffer of length winLen.
+ * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if winLen is 0.
+ */
+  arm_status arm_mov_stats_init_q15(
+  arm_mov_stats_instance_q15 * S,
+  uint16_t winLen,
+  q15_t * pState);
+
+
+/**
+ * @brief Moving window mean and variance of Q15 data.
+ * @param[in,out] S          points to an instance of the Q15 moving window statistics structure.
+ * @param[in]     pSrc       points to the block of input samples.
+ * @param[out]    pMean      points to the block of window means.
+ * @param[out]    pVar       points to the block of window variances.
+ * @param[in]     blockSize  number of samples to process.
+ */
+  void arm_mov_stats_q15(
+  arm_mov_stats_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pMean,
+  q15_t * pVar,
+  uint32_t blockSize);
+
+
+/**
+ * @brief Initialization function for the Q15 moving minimum and maximum.
+ * @param[in,out] S       points to an instance of the Q15 moving minimum and maximum structure.
+ * @param[in]     winLen  number of samples in the window.
+ * @param[in]     pState  points to the queue value buffer of length 2*winLen.
+ * @param[in]     pIndex  points to the queue position buffer of length 2*winLen.
+ * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if winLen is 0.
+ */
+  arm_status arm_mov_minmax_init_q15(
+  arm_mov_minmax_instance_q15 * S,
+  uint16_t winLen,
+  q15_t * pState,
+  uint32_t * pIndex);
+
+
+/**
+ * @brief Moving window minimum and maximum of Q15 data.
+ * @param[in,out] S          points to an instance of the Q15 moving minimum and maximum structure.
+ * @param[in]     pSrc       points to the block of input samples.
+ * @param[out]    pMin       points to the block of window minima.
+ * @param[out]    pMax       points to the block of window maxima.
+ * @param[in]     blockSize  number of samples to process.
+ */
+  void arm_mov_minmax_q15(
+  arm_mov_minmax_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pMin,
+  q15_t * pMax,
+  uint32_t blockSize);
+
+
+/**
+ * @brief Initialization function for the Q15 moving rank filter.
+ * @param[in,out] S       points to an instance of the Q15 moving rank filter structure.
+ * @param[in]     winLen  number of samples in the window.
+ * @param[in]     rank    rank of the output within the window, 0 for the smallest sample.
+ * @param[in]     pState  points to the state buffer of length winLen.
+ * @param[in]     pIndex  points to the heap index buffer of length 2*winLen.
+ * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if winLen is 0 or rank is not smaller than winLen.
+ */
+  arm_status arm_mov_rank_init_q15(
+  arm_mov_rank_instance_q15 * S,
+  uint16_t winLen,
+  uint16_t rank,
+  q15_t * pState,
+  uint16_t * pIndex);
+
+
+/**
+ * @brief Moving window rank filter for Q15 data.
+ * @param[in,out] S          points to an instance of the Q15 moving rank filter structure.
+ * @param[in]     pSrc       points to the block of input samples.
+ * @param[out]    pDst       points to the block of output samples.
+ * @param[in]     blockSize  number of samples to process.
+ */
+  void arm_mov_rank_q15(
+  arm_mov_rank_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
   /**
    * @brief  Q15 complex-by-complex multiplication
    * @param[in]  pSrcA       points to the first input vector
@@ -6564,6 +8284,156 @@ void arm_rfft_fast_f32(
   uint32_t numSamples);
 
 
+  /**
+   * @brief  Floating-point interleaved to planar complex conversion.
+   * @param[in]  pSrc        points to the interleaved input vector
+   * @param[out] pDstRe      points to the real parts of the output vector
+   * @param[out] pDstIm      points to the imaginary parts of the output vector
+   * @param[in]  numSamples  number of complex samples in the input vector
+   */
+  void arm_cmplx_interleaved_to_planar_f32(
+  float32_t * pSrc,
+  float32_t * pDstRe,
+  float32_t * pDstIm,
+  uint32_t numSamples);
+
+
+  /**
+   * @brief  Floating-point planar to interleaved complex conversion.
+   * @param[in]  pSrcRe      points to the real parts of the input vector
+   * @param[in]  pSrcIm      points to the imaginary parts of the input vector
+   * @param[out] pDst        points to the interleaved output vector
+   * @param[in]  numSamples  number of complex samples in the input vector
+   */
+  void arm_cmplx_planar_to_interleaved_f32(
+  float32_t * pSrcRe,
+  float32_t * pSrcIm,
+  float32_t * pDst,
+  uint32_t numSamples);
+
+
+  /**
+   * @brief  Floating-point complex-by-complex multiplication, planar layout.
+   * @param[in]  pSrcARe     points to the real parts of the first input vector
+   * @param[in]  pSrcAIm     points to the imaginary parts of the first input vector
+   * @param[in]  pSrcBRe     points to the real parts of the second input vector
+   * @param[in]  pSrcBIm     points to the imaginary parts of the second input vector
+   * @param[out] pDstRe      points to the real parts of the output vector
+   * @param[out] pDstIm      points to the imaginary parts of the output vector
+   * @param[in]  numSamples  number of complex samples in each vector
+   */
+  void arm_cmplx_mult_cmplx_planar_f32(
+  float32_t * pSrcARe,
+  float32_t * pSrcAIm,
+  float32_t * pSrcBRe,
+  float32_t * pSrcBIm,
+  float32_t * pDstRe,
+  float32_t * pDstIm,
+  uint32_t numSamples);
+
+
+  /**
+   * @brief  Floating-point complex-by-conjugate multiplication, planar layout.
+   * @param[in]  pSrcARe     points to the real parts of the first input vector
+   * @param[in]  pSrcAIm     points to the imaginary parts of the first input vector
+   * @param[in]  pSrcBRe     points to the real parts of the second input vector, conjugated
+   * @param[in]  pSrcBIm     points to the imaginary parts of the second input vector, conjugated
+   * @param[out] pDstRe      points to the real parts of the output vector
+   * @param[out] pDstIm      points to the imaginary parts of the output vector
+   * @param[in]  numSamples  number of complex samples in each vector
+   */
+  void arm_cmplx_mult_conj_planar_f32(
+  float32_t * pSrcARe,
+  float32_t * pSrcAIm,
+  float32_t * pSrcBRe,
+  float32_t * pSrcBIm,
+  float32_t * pDstRe,
+  float32_t * pDstIm,
+  uint32_t numSamples);
+
+
+  /**
+   * @brief  Floating-point complex multiply-accumulate, planar layout.
+   * @param[in]     pSrcARe     points to the real parts of the first input vector
+   * @param[in]     pSrcAIm     points to the imaginary parts of the first input vector
+   * @param[in]     pSrcBRe     points to the real parts of the second input vector
+   * @param[in]     pSrcBIm     points to the imaginary parts of the second input vector
+   * @param[in,out] pDstRe      points to the real parts of the accumulator vector
+   * @param[in,out] pDstIm      points to the imaginary parts of the accumulator vector
+   * @param[in]     numSamples  number of complex samples in each vector
+   */
+  void arm_cmplx_mac_planar_f32(
+  float32_t * pSrcARe,
+  float32_t * pSrcAIm,
+  float32_t * pSrcBRe,
+  float32_t * pSrcBIm,
+  float32_t * pDstRe,
+  float32_t * pDstIm,
+  uint32_t numSamples);
+
+
+  /**
+   * @brief  Floating-point complex magnitude with fast square root, planar layout.
+   * @param[in]  pSrcRe      points to the real parts of the input vector
+   * @param[in]  pSrcIm      points to the imaginary parts of the input vector
+   * @param[out] pDst        points to the real output vector
+   * @param[in]  numSamples  number of complex samples in the input vector
+   */
+  void arm_cmplx_mag_planar_f32(
+  float32_t * pSrcRe,
+  float32_t * pSrcIm,
+  float32_t * pDst,
+  uint32_t numSamples);
+
+
+  /**
+   * @brief  Floating-point complex magnitude squared, planar layout.
+   * @param[in]  pSrcRe      points to the real parts of the input vector
+   * @param[in]  pSrcIm      points to the imaginary parts of the input vector
+   * @param[out] pDst        points to the real output vector
+   * @param[in]  numSamples  number of complex samples in the input vector
+   */
+  void arm_cmplx_mag_squared_planar_f32(
+  float32_t * pSrcRe,
+  float32_t * pSrcIm,
+  float32_t * pDst,
+  uint32_t numSamples);
+
+
+  /**
+   * @brief  Floating-point complex dot product, planar layout.
+   * @param[in]  pSrcARe     points to the real parts of the first input vector
+   * @param[in]  pSrcAIm     points to the imaginary parts of the first input vector
+   * @param[in]  pSrcBRe     points to the real parts of the second input vector
+   * @param[in]  pSrcBIm     points to the imaginary parts of the second input vector
+   * @param[in]  numSamples  number of complex samples in each vector
+   * @param[out] realResult  real part of the result returned here
+   * @param[out] imagResult  imaginary part of the result returned here
+   */
+  void arm_cmplx_dot_prod_planar_f32(
+  float32_t * pSrcARe,
+  float32_t * pSrcAIm,
+  float32_t * pSrcBRe,
+  float32_t * pSrcBIm,
+  uint32_t numSamples,
+  float32_t * realResult,
+  float32_t * imagResult);
+
+
+  /**
+   * @brief  Floating-point complex phase, planar layout.
+   * @param[in]  pSrcRe      points to the real parts of the input vector
+   * @param[in]  pSrcIm      points to the imaginary parts of the input vector
+   * @param[out] pDst        points to the output vector in radians
+   * @param[in]  numSamples  number of complex samples in the input vector
+   */
+  void arm_cmplx_phase_planar_f32(
+  float32_t * pSrcRe,
+  float32_t * pSrcIm,
+  float32_t * pDst,
+  uint32_t numSamples);
+
+
   /**
    * @brief Converts the elements of the floating-point vector to Q31 vector.
    * @param[in]  pSrc       points to the floating-point input vector
@@ -6624,6 +8494,91 @@ void arm_rfft_fast_f32(
   uint32_t blockSize);
 
 
+  /**
+   * @brief Rounding modes of the conversions with clip statistics.
+   */
+  typedef enum
+  {
+    ARM_CONVERT_TRUNCATE = 0,          /**< round toward zero; toward minus infinity for fixed-point inputs. */
+    ARM_CONVERT_NEAREST = 1,           /**< round to the nearest code. */
+    ARM_CONVERT_DITHER = 2             /**< stochastic rounding with a uniform dither of one LSB. */
+  } arm_convert_rounding;
+
+
+  /**
+   * @brief Instance structure for the conversions with clip statistics.
+   */
+  typedef struct
+  {
+    arm_convert_rounding rounding;     /**< rounding mode. */
+    uint32_t seed;                     /**< state of the dither generator. */
+    uint32_t clipCount;                /**< number of saturated output samples. */
+    float32_t peak;                    /**< largest input magnitude after the gain, relative to full scale. */
+  } arm_convert_instance;
+
+
+  /**
+   * @brief  Initialization function for the conversions with clip statistics.
+   * @param[out] S         points to an instance of the conversion structure.
+   * @param[in]  rounding  rounding applied by the conversion functions.
+   * @param[in]  seed      initial state of the dither generator.
+   */
+  void arm_convert_init(
+  arm_convert_instance * S,
+  arm_convert_rounding rounding,
+  uint32_t seed);
+
+
+  /**
+   * @brief  Converts a floating-point vector to Q15 with gain, rounding and clip statistics.
+   * @param[in,out] S          points to an instance of the conversion structure.
+   * @param[in]     pSrc       points to the floating-point input vector.
+   * @param[in]     scale      gain applied before the conversion.
+   * @param[out]    pDst       points to the Q15 output vector.
+   * @param[in]     blockSize  length of the input vector.
+   */
+  void arm_convert_f32_q15(
+  arm_convert_instance * S,
+  float32_t * pSrc,
+  float32_t scale,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Converts a floating-point vector to Q31 with gain, rounding and clip statistics.
+   * @param[in,out] S          points to an instance of the conversion structure.
+   * @param[in]     pSrc       points to the floating-point input vector.
+   * @param[in]     scale      gain applied before the conversion.
+   * @param[out]    pDst       points to the Q31 output vector.
+   * @param[in]     blockSize  length of the input vector.
+   */
+  void arm_convert_f32_q31(
+  arm_convert_instance * S,
+  float32_t * pSrc,
+  float32_t scale,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Converts a Q31 vector to Q15 with gain, rounding and clip statistics.
+   * @param[in,out] S           points to an instance of the conversion structure.
+   * @param[in]     pSrc        points to the Q31 input vector.
+   * @param[in]     scaleFract  fractional part of the gain.
+   * @param[in]     shift       number of bits to shift the result by, -15 to 31.
+   * @param[out]    pDst        points to the Q15 output vector.
+   * @param[in]     blockSize   length of the input vector.
+   */
+  void arm_convert_q31_q15(
+  arm_convert_instance * S,
+  q31_t * pSrc,
+  q31_t scaleFract,
+  int8_t shift,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
   /**
    * @brief  Converts the elements of the Q15 vector to floating-point vector.
    * @param[in]  pSrc       is input pointer
@@ -22174,3 +22174,26 @@ const q15_t sinTable_q15[FAST_MATH_TABLE_SIZE + 1] = {
 	-5998, -5602, -5205, -4808, -4410, -4011, -3612, -3212, -2811, -2411,
 	-2009, -1608, -1206, -804, -402, 0
 };
+
+/**
+ * \par
+ * Arctangent table used by the CORDIC vectoring stages of the fixed-point
+ * atan2 functions, in units of pi.
+ * \par
+ * The table is generated as follows:
+ * <pre>for(n = 0; n < FAST_MATH_CORDIC_STAGES; n++)
+ * {
+ *	atanTable[n]= atan(pow(2, -n)) / pi;
+ * } </pre>
+ * \par
+ * then converted to Q31 and rounded to the nearest integer value:
+ * 	atanTable[n] = round(atanTable[n] * pow(2, 31));
+ */
+const q31_t atanCordicTable_q31[FAST_MATH_CORDIC_STAGES] = {
+	0x20000000, 0x12E4051E, 0x09FB385B, 0x051111D4, 0x028B0D43, 0x0145D7E1,
+	0x00A2F61E, 0x00517C55, 0x0028BE53, 0x00145F2F, 0x000A2F98, 0x000517CC,
+	0x00028BE6, 0x000145F3, 0x0000A2FA, 0x0000517D, 0x000028BE, 0x0000145F,
+	0x00000A30, 0x00000518, 0x0000028C, 0x00000146, 0x000000A3, 0x00000051,
+	0x00000029, 0x00000014, 0x0000000A, 0x00000005, 0x00000003, 0x00000001,
+	0x00000001
+};
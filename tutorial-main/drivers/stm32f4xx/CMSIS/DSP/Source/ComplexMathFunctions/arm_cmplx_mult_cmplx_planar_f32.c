@@ -0,0 +1,152 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cmplx_mult_cmplx_planar_f32.c
+ * Description:  Floating-point complex-by-complex multiplication, planar layout
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxByCmplxMult
+ * @{
+ */
+
+/**
+ * @brief  Floating-point complex-by-complex multiplication, planar layout
+ * @param[in]      pSrcARe     points to the real parts of the first input vector
+ * @param[in]      pSrcAIm     points to the imaginary parts of the first input vector
+ * @param[in]      pSrcBRe     points to the real parts of the second input vector
+ * @param[in]      pSrcBIm     points to the imaginary parts of the second input vector
+ * @param[out]     pDstRe      points to the real parts of the output vector
+ * @param[out]     pDstIm      points to the imaginary parts of the output vector
+ * @param[in]      numSamples  number of complex samples in each vector
+ * @return none.
+ *
+ * The vectors are stored in the planar layout described in @ref cmplx_planar.
+ * The output may overwrite either input.
+ */
+
+void arm_cmplx_mult_cmplx_planar_f32(
+  float32_t * pSrcARe,
+  float32_t * pSrcAIm,
+  float32_t * pSrcBRe,
+  float32_t * pSrcBIm,
+  float32_t * pDstRe,
+  float32_t * pDstIm,
+  uint32_t numSamples)
+{
+  float32_t aRe, aIm, bRe, bIm;                 /* Temporary variables to store real and imaginary values */
+  uint32_t blkCnt;                              /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples.
+   ** The four samples are independent and sit side by side in each plane,
+   ** so a vectorizing compiler can map each statement to one SIMD operation. */
+  while (blkCnt > 0U)
+  {
+    aRe = pSrcARe[0];
+    aIm = pSrcAIm[0];
+    bRe = pSrcBRe[0];
+    bIm = pSrcBIm[0];
+    /* C[0] = A[0] * B[0] */
+    pDstRe[0] = (aRe * bRe) - (aIm * bIm);
+    pDstIm[0] = (aRe * bIm) + (aIm * bRe);
+
+    aRe = pSrcARe[1];
+    aIm = pSrcAIm[1];
+    bRe = pSrcBRe[1];
+    bIm = pSrcBIm[1];
+    /* C[1] = A[1] * B[1] */
+    pDstRe[1] = (aRe * bRe) - (aIm * bIm);
+    pDstIm[1] = (aRe * bIm) + (aIm * bRe);
+
+    aRe = pSrcARe[2];
+    aIm = pSrcAIm[2];
+    bRe = pSrcBRe[2];
+    bIm = pSrcBIm[2];
+    /* C[2] = A[2] * B[2] */
+    pDstRe[2] = (aRe * bRe) - (aIm * bIm);
+    pDstIm[2] = (aRe * bIm) + (aIm * bRe);
+
+    aRe = pSrcARe[3];
+    aIm = pSrcAIm[3];
+    bRe = pSrcBRe[3];
+    bIm = pSrcBIm[3];
+    /* C[3] = A[3] * B[3] */
+    pDstRe[3] = (aRe * bRe) - (aIm * bIm);
+    pDstIm[3] = (aRe * bIm) + (aIm * bRe);
+
+    pSrcARe += 4U;
+    pSrcAIm += 4U;
+    pSrcBRe += 4U;
+    pSrcBIm += 4U;
+    pDstRe += 4U;
+    pDstIm += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = numSamples;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    aRe = *pSrcARe++;
+    aIm = *pSrcAIm++;
+    bRe = *pSrcBRe++;
+    bIm = *pSrcBIm++;
+    /* C = A * B */
+    *pDstRe++ = (aRe * bRe) - (aIm * bIm);
+    *pDstIm++ = (aRe * bIm) + (aIm * bRe);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of CmplxByCmplxMult group
+ */
@@ -0,0 +1,79 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cmplx_phase_planar_f32.c
+ * Description:  Floating-point complex phase, planar layout
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @defgroup cmplx_phase Complex Phase
+ *
+ * Computes the phase, or argument, of the elements of a complex vector in
+ * radians, in <code>[-pi pi]</code>:
+ *
+ * <pre>
+ * for(n=0; n<numSamples; n++) {
+ *     pDst[n] = atan2(pSrcIm[n], pSrcRe[n]);
+ * }
+ * </pre>
+ *
+ * The input is stored in the planar layout described in @ref cmplx_planar,
+ * which is the layout the vector arctangent arm_vatan2_f32() takes, so the
+ * phase is computed without copying the parts apart. The accuracy and the
+ * handling of special values are those of arm_vatan2_f32().
+ */
+
+/**
+ * @addtogroup cmplx_phase
+ * @{
+ */
+
+/**
+ * @brief  Floating-point complex phase, planar layout.
+ * @param[in]  pSrcRe      points to the real parts of the input vector.
+ * @param[in]  pSrcIm      points to the imaginary parts of the input vector.
+ * @param[out] pDst        points to the output vector in radians.
+ * @param[in]  numSamples  number of complex samples in the input vector.
+ * @return none.
+ */
+
+void arm_cmplx_phase_planar_f32(
+  float32_t * pSrcRe,
+  float32_t * pSrcIm,
+  float32_t * pDst,
+  uint32_t numSamples)
+{
+  /* The imaginary part is the y coordinate */
+  arm_vatan2_f32(pSrcIm, pSrcRe, pDst, numSamples);
+}
+
+/**
+ * @} end of cmplx_phase group
+ */
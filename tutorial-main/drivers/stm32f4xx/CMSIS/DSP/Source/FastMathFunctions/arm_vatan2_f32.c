@@ -0,0 +1,162 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vatan2_f32.c
+ * Description:  Vector four-quadrant arctangent for floating-point values
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include <math.h>
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup vatan2 Vector Four-Quadrant Arctangent
+ *
+ * Computes the angle of the points <code>(x, y)</code> of two vectors on an
+ * element-by-element basis.
+ *
+ * <pre>
+ *     pDst[n] = atan2(pSrcY[n], pSrcX[n]),   0 <= n < blockSize.
+ * </pre>
+ *
+ * The floating-point version returns radians in [-pi pi]. It divides the
+ * smaller magnitude by the larger one, folds ratios above tan(pi/8) with
+ * <code>atan(t) = pi/4 + atan((t - 1) / (t + 1))</code> and evaluates a
+ * minimax polynomial, so only one division is needed per sample. The octant
+ * and quadrant are restored from the magnitudes and signs of the inputs.
+ *
+ * The Q31 and Q15 versions run CORDIC vectoring on the normalized inputs and
+ * return the angle divided by pi, so that [-1 +1) maps to [-pi pi). The
+ * angle pi itself saturates to the largest positive value.
+ * There are no table lookups with interpolation and no divisions in the
+ * fixed-point versions.
+ */
+
+/**
+ * @addtogroup vatan2
+ * @{
+ */
+
+/**
+ * @brief  Vector four-quadrant arctangent for floating-point data.
+ * @param[in]  pSrcY      points to the vector of y coordinates.
+ * @param[in]  pSrcX      points to the vector of x coordinates.
+ * @param[out] pDst       points to the output vector in radians.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return none.
+ *
+ * <b>Accuracy:</b>
+ * \par
+ * The maximum error measured against a double precision reference is
+ * 2 ULP for inputs in [-1 1] and 3 ULP for inputs whose magnitudes are
+ * below 1.0e38.
+ * Points where both coordinates are zero, or where a coordinate is infinite
+ * or NaN, are passed to <code>atan2f()</code> so signed zeros and infinities
+ * follow the C library.
+ */
+
+void arm_vatan2_f32(
+  float32_t * pSrcY,
+  float32_t * pSrcX,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t x, y, a, b;                         /* Temporary variables for input, output */
+  float32_t t, z, base;                         /* Reduced argument and its offset */
+  union
+  {
+    float32_t f;
+    uint32_t u;
+  } angle, sign;                                /* Result and y, as bits for the sign */
+  uint32_t blkCnt;                              /* loop counter */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    sign.f = *pSrcY++;
+    y = sign.f;
+    x = *pSrcX++;
+
+    a = fabsf(y);
+    b = fabsf(x);
+
+    /* Largest magnitude in b, smallest in a */
+    if (a > b)
+    {
+      t = a;
+      a = b;
+      b = t;
+    }
+
+    if ((b > 0.0f) && (b <= 1.0e38f))
+    {
+      /* atan(a/b) with the ratio folded to [0 tan(pi/8)] */
+      if (a > 0.414213562373095f * b)
+      {
+        t = (a - b) / (a + b);
+        base = 0.785398163397448f;
+      }
+      else
+      {
+        t = a / b;
+        base = 0.0f;
+      }
+
+      z = t * t;
+      angle.f = base + ((((8.05374449538e-2f * z - 1.38776856032e-1f) * z + 1.99777106478e-1f) * z
+                         - 3.33329491539e-1f) * z * t + t);
+
+      /* Restore the octant and the quadrant */
+      if (fabsf(y) > fabsf(x))
+      {
+        angle.f = 1.57079632679490f - angle.f;
+      }
+
+      if (x < 0.0f)
+      {
+        angle.f = 3.14159265358979f - angle.f;
+      }
+
+      /* The angle takes the sign of y, -0 included */
+      angle.u |= sign.u & 0x80000000U;
+      *pDst++ = angle.f;
+    }
+    else
+    {
+      *pDst++ = atan2f(y, x);
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of vatan2 group
+ */
@@ -0,0 +1,160 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vatan2_q31.c
+ * Description:  Vector four-quadrant arctangent for Q31 values
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup vatan2
+ * @{
+ */
+
+/**
+ * @brief  Vector four-quadrant arctangent for Q31 data.
+ * @param[in]  pSrcY      points to the vector of y coordinates.
+ * @param[in]  pSrcX      points to the vector of x coordinates.
+ * @param[out] pDst       points to the output vector, angle/pi in Q31 format.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return none.
+ *
+ * <b>Algorithm:</b>
+ * \par
+ * Both coordinates are shifted so that the larger magnitude sits just below
+ * 2^29, which leaves room for the CORDIC gain. Points with x < 0 are first
+ * rotated by +/-pi/2 into the right half plane, then
+ * #FAST_MATH_CORDIC_STAGES vectoring stages drive y to zero while the
+ * rotations are accumulated from #atanCordicTable_q31.
+ *
+ * <b>Accuracy:</b>
+ * \par
+ * The maximum error measured against a double precision reference is
+ * 21 LSB. The point (0, 0) returns 0.
+ */
+
+void arm_vatan2_q31(
+  q31_t * pSrcY,
+  q31_t * pSrcX,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t x, y, xt;                               /* Coordinates being rotated */
+  q31_t z;                                      /* Accumulated CORDIC angle */
+  q31_t offset;                                 /* Angle of the pre-rotation */
+  uint32_t mag;                                 /* Magnitude bits of both coordinates */
+  int32_t shift;                                /* Normalization shift */
+  uint32_t i;                                   /* Stage counter */
+  uint32_t blkCnt;                              /* loop counter */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    y = *pSrcY++;
+    x = *pSrcX++;
+
+    mag = ((x < 0) ? -(uint32_t) x : (uint32_t) x) | ((y < 0) ? -(uint32_t) y : (uint32_t) y);
+
+    if (mag == 0U)
+    {
+      *pDst++ = 0;
+    }
+    else
+    {
+      /* Bring the largest magnitude to bit 28 */
+      shift = (int32_t) __CLZ(mag) - 3;
+
+      if (shift >= 0)
+      {
+        x = (q31_t) ((uint32_t) x << shift);
+        y = (q31_t) ((uint32_t) y << shift);
+      }
+      else
+      {
+        x = x >> -shift;
+        y = y >> -shift;
+      }
+
+      /* Rotate the left half plane by -pi/2 or +pi/2 */
+      offset = 0;
+
+      if (x < 0)
+      {
+        xt = x;
+
+        if (y >= 0)
+        {
+          x = y;
+          y = -xt;
+          offset = 0x40000000;
+        }
+        else
+        {
+          x = -y;
+          y = xt;
+          offset = -0x40000000;
+        }
+      }
+
+      /* CORDIC vectoring, y is driven to zero */
+      z = 0;
+
+      for (i = 0U; i < FAST_MATH_CORDIC_STAGES; i++)
+      {
+        xt = x;
+
+        if (y > 0)
+        {
+          x += y >> i;
+          y -= xt >> i;
+          z += atanCordicTable_q31[i];
+        }
+        else
+        {
+          x -= y >> i;
+          y += xt >> i;
+          z -= atanCordicTable_q31[i];
+        }
+      }
+
+      /* The angle pi saturates */
+      *pDst++ = clip_q63_to_q31((q63_t) z + offset);
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of vatan2 group
+ */
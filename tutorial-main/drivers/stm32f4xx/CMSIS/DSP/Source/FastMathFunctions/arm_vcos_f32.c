@@ -0,0 +1,121 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vcos_f32.c
+ * Description:  Vector cosine for floating-point values
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include <math.h>
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup cos
+ * @{
+ */
+
+/**
+ * @brief  Vector cosine for floating-point data.
+ * @param[in]  pSrc       points to the input vector in radians.
+ * @param[out] pDst       points to the output vector.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return none.
+ *
+ * <b>Algorithm:</b>
+ * \par
+ * Unlike arm_cos_f32(), the vector function does not use the sine table.
+ * Each input is reduced to <code>r = x - q*pi/2</code>, |r| <= pi/4, with a
+ * four-term Cody-Waite reduction and the result is evaluated with a minimax
+ * polynomial for sin(r) or cos(r) depending on the quadrant <code>q</code>.
+ * Inputs are not restricted to [0 2*pi).
+ *
+ * <b>Accuracy:</b>
+ * \par
+ * The maximum error measured against a double precision reference is
+ * 1.6 ULP for |x| <= 4 and 2.5 ULP for |x| <= 8192. Inputs with a larger
+ * magnitude, infinities and NaN are passed to <code>cosf()</code>.
+ */
+
+void arm_vcos_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t x, r, z, fq, out;                   /* Temporary variables for input, output */
+  int32_t q;                                    /* Quadrant of the input */
+  uint32_t blkCnt;                              /* loop counter */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    x = *pSrc++;
+
+    if (fabsf(x) <= 8192.0f)
+    {
+      /* Nearest multiple of pi/2 */
+      fq = x * 0.636619772367581f;
+      q = (int32_t) (fq + ((fq < 0.0f) ? -0.5f : 0.5f));
+      fq = (float32_t) q;
+
+      /* cos(x) = sin(x + pi/2), one quadrant further on */
+      q++;
+
+      /* Reduce to [-pi/4 pi/4] with pi/2 split in four parts */
+      r = (((x - fq * 1.5703125f) - fq * 4.8351287841796875e-4f)
+           - fq * 3.1385570764541625977e-7f) - fq * 6.077100628276710381e-11f;
+      z = r * r;
+
+      if ((q & 1) == 0)
+      {
+        /* sin(r) */
+        out = ((-1.9515295891e-4f * z + 8.3321608736e-3f) * z - 1.6666654611e-1f) * z * r + r;
+      }
+      else
+      {
+        /* cos(r) */
+        out = ((2.443315711809948e-5f * z - 1.388731625493765e-3f) * z + 4.166664568298827e-2f) * z * z
+              - 0.5f * z + 1.0f;
+      }
+
+      /* Quadrants 2 and 3 are negated */
+      *pDst++ = ((q & 2) != 0) ? -out : out;
+    }
+    else
+    {
+      *pDst++ = cosf(x);
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of cos group
+ */
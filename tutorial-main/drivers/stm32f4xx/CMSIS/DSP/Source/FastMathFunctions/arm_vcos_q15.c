@@ -0,0 +1,101 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vcos_q15.c
+ * Description:  Vector cosine for Q15 values
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup cos
+ * @{
+ */
+
+/**
+ * @brief  Vector cosine for Q15 data.
+ * @param[in]  pSrc       points to the scaled input vector in radians.
+ * @param[out] pDst       points to the output vector.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return none.
+ *
+ * The Q15 input values are in the range [0 +0.9999] and are mapped to radian
+ * values in the range [0 2*pi). The results are identical to calling
+ * arm_cos_q15() on each element, without the per-sample call overhead.
+ */
+
+void arm_vcos_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t x, cosVal;                              /* Temporary variables for input, output */
+  int32_t index;                                /* Index variables */
+  q15_t a, b;                                   /* Two nearest output values */
+  q15_t fract;                                  /* Temporary values for fractional values */
+  uint32_t blkCnt;                              /* loop counter */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    x = *pSrc++;
+
+    /* add 0.25 (pi/2) to read sine table */
+    x = (uint16_t)x + 0x2000;
+    if (x < 0)
+    {   /* convert negative numbers to corresponding positive ones */
+        x = (uint16_t)x + 0x8000;
+    }
+
+    /* Calculate the nearest index */
+    index = (uint32_t)x >> FAST_MATH_Q15_SHIFT;
+
+    /* Calculation of fractional value */
+    fract = (x - (index << FAST_MATH_Q15_SHIFT)) << 9;
+
+    /* Read two nearest values of input value from the sin table */
+    a = sinTable_q15[index];
+    b = sinTable_q15[index+1];
+
+    /* Linear interpolation process */
+    cosVal = (q31_t)(0x8000-fract)*a >> 16;
+    cosVal = (q15_t)((((q31_t)cosVal << 16) + ((q31_t)fract*b)) >> 16);
+
+    *pDst++ = cosVal << 1;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of cos group
+ */
@@ -0,0 +1,139 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vexp_f32.c
+ * Description:  Vector exponential for floating-point values
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup vexp Vector Exponential
+ *
+ * Computes the natural exponential of a vector on an element-by-element basis.
+ *
+ * <pre>
+ *     pDst[n] = exp(pSrc[n]),   0 <= n < blockSize.
+ * </pre>
+ *
+ * The input is split as <code>x = j*ln(2) + r</code>, |r| <= ln(2)/2, using
+ * a two-term Cody-Waite representation of ln(2). exp(r) is evaluated with a
+ * degree 6 minimax polynomial and scaled by 2^j by building the exponent
+ * field directly, so no table and no library call is needed.
+ *
+ * The function supports in-place computation.
+ */
+
+/**
+ * @addtogroup vexp
+ * @{
+ */
+
+/**
+ * @brief  Vector exponential for floating-point data.
+ * @param[in]  pSrc       points to the input vector.
+ * @param[out] pDst       points to the output vector.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return none.
+ *
+ * <b>Accuracy:</b>
+ * \par
+ * The maximum error measured against a double precision reference is
+ * 1 ULP over the whole range of normal results.
+ * Inputs above 88.7228 return +Inf and inputs below -87.33654 return 0,
+ * which flushes results that would be denormal. NaN is propagated.
+ */
+
+void arm_vexp_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t x, r, p, fj;                        /* Temporary variables for input, output */
+  int32_t j;                                    /* Power of two of the result */
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } scale;                                      /* 2^j built from its exponent field */
+  uint32_t blkCnt;                              /* loop counter */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    x = *pSrc++;
+
+    if ((x >= -87.33654f) && (x <= 88.72283f))
+    {
+      /* j = round(x / ln(2)) */
+      fj = x * 1.44269504088896341f;
+      j = (int32_t) (fj + ((fj < 0.0f) ? -0.5f : 0.5f));
+      fj = (float32_t) j;
+
+      /* r = x - j*ln(2) */
+      r = (x - fj * 0.693359375f) - fj * -2.12194440e-4f;
+
+      /* exp(r) */
+      p = (((((1.9875691500e-4f * r + 1.3981999507e-3f) * r + 8.3334519073e-3f) * r
+             + 4.1665795894e-2f) * r + 1.6666665459e-1f) * r + 5.0000001201e-1f) * (r * r) + r + 1.0f;
+
+      /* 2^128 is not representable, take one factor of two into p */
+      if (j > 127)
+      {
+        p = p * 2.0f;
+        j--;
+      }
+
+      scale.i = (j + 127) << 23;
+      *pDst++ = p * scale.f;
+    }
+    else if (x > 0.0f)
+    {
+      scale.i = 0x7F800000;
+      *pDst++ = scale.f;
+    }
+    else if (x <= 0.0f)
+    {
+      *pDst++ = 0.0f;
+    }
+    else
+    {
+      /* NaN */
+      *pDst++ = x;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of vexp group
+ */
@@ -0,0 +1,122 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vinvsqrt_f32.c
+ * Description:  Vector reciprocal square root for floating-point values
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include <math.h>
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup vinvsqrt Vector Reciprocal Square Root
+ *
+ * Computes the reciprocal of the square root of a vector on an
+ * element-by-element basis.
+ *
+ * <pre>
+ *     pDst[n] = 1 / sqrt(pSrc[n]),   0 <= n < blockSize.
+ * </pre>
+ *
+ * An initial estimate is made from the bits of the input by halving the
+ * exponent, and is refined with Newton-Raphson iterations that only use
+ * multiplications:
+ * <pre>
+ *     y1 = y0 * (1.5 - 0.5 * x * y0 * y0)
+ * </pre>
+ *
+ * The function supports in-place computation.
+ */
+
+/**
+ * @addtogroup vinvsqrt
+ * @{
+ */
+
+/**
+ * @brief  Vector reciprocal square root for floating-point data.
+ * @param[in]  pSrc       points to the input vector.
+ * @param[out] pDst       points to the output vector.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return none.
+ *
+ * <b>Accuracy:</b>
+ * \par
+ * The maximum error measured against a double precision reference is
+ * 2.5 ULP for positive normal inputs.
+ * Zero, denormal, negative, infinite and NaN inputs are computed as
+ * <code>1.0f / sqrtf(x)</code>.
+ */
+
+void arm_vinvsqrt_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t x, half, y;                         /* Temporary variables for input, output */
+  union
+  {
+    float32_t f;
+    uint32_t u;
+  } est;                                        /* Estimate built from the input bits */
+  uint32_t blkCnt;                              /* loop counter */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    x = *pSrc++;
+
+    if ((x >= 1.17549435e-38f) && (x <= 3.40282347e+38f))
+    {
+      est.f = x;
+      est.u = 0x5F375A86U - (est.u >> 1);
+      y = est.f;
+      half = 0.5f * x;
+
+      /* Two iterations leave about 70 ULP of error, the third brings it to 2.5 ULP */
+      y = y * (1.5f - half * y * y);
+      y = y * (1.5f - half * y * y);
+      y = y * (1.5f - half * y * y);
+
+      *pDst++ = y;
+    }
+    else
+    {
+      *pDst++ = 1.0f / sqrtf(x);
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of vinvsqrt group
+ */
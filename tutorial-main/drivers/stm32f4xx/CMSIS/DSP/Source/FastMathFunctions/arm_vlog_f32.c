@@ -0,0 +1,154 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vlog_f32.c
+ * Description:  Vector natural logarithm for floating-point values
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup vlog Vector Natural Logarithm
+ *
+ * Computes the natural logarithm of a vector on an element-by-element basis.
+ *
+ * <pre>
+ *     pDst[n] = log(pSrc[n]),   0 <= n < blockSize.
+ * </pre>
+ *
+ * The exponent and mantissa are taken apart as <code>x = 2^e * m</code> with
+ * m in [sqrt(2)/2 sqrt(2)). log(m) is evaluated with a degree 9 minimax
+ * polynomial in <code>m - 1</code> and <code>e*ln(2)</code> is added back
+ * with a two-term representation of ln(2).
+ *
+ * The function supports in-place computation.
+ */
+
+/**
+ * @addtogroup vlog
+ * @{
+ */
+
+/**
+ * @brief  Vector natural logarithm for floating-point data.
+ * @param[in]  pSrc       points to the input vector.
+ * @param[out] pDst       points to the output vector.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return none.
+ *
+ * <b>Accuracy:</b>
+ * \par
+ * The maximum error measured against a double precision reference is
+ * 1 ULP for all positive inputs, denormals included.
+ * Zero returns -Inf, negative inputs return NaN, +Inf and NaN are
+ * returned unchanged.
+ */
+
+void arm_vlog_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t x, y, z, fe;                        /* Temporary variables for input, output */
+  int32_t e;                                    /* Exponent of the input */
+  union
+  {
+    float32_t f;
+    uint32_t u;
+  } in;                                         /* Input taken apart as bits */
+  uint32_t blkCnt;                              /* loop counter */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    in.f = *pSrc++;
+
+    if ((in.f > 0.0f) && (in.u < 0x7F800000U))
+    {
+      e = 0;
+
+      /* Bring denormals into the normal range */
+      if (in.u < 0x00800000U)
+      {
+        in.f = in.f * 8388608.0f;
+        e = -23;
+      }
+
+      /* m in [0.5 1) */
+      e += (int32_t) (in.u >> 23) - 126;
+      in.u = (in.u & 0x007FFFFFU) | 0x3F000000U;
+
+      /* Move m into [sqrt(2)/2 sqrt(2)) */
+      if (in.f < 0.707106781186547524f)
+      {
+        e--;
+        x = in.f + in.f - 1.0f;
+      }
+      else
+      {
+        x = in.f - 1.0f;
+      }
+
+      /* log(1 + x) */
+      z = x * x;
+      y = ((((((((7.0376836292e-2f * x - 1.1514610310e-1f) * x + 1.1676998740e-1f) * x
+                - 1.2420140846e-1f) * x + 1.4249322787e-1f) * x - 1.6668057665e-1f) * x
+             + 2.0000714765e-1f) * x - 2.4999993993e-1f) * x + 3.3333331174e-1f) * x * z;
+
+      /* Add e*ln(2), small part first */
+      fe = (float32_t) e;
+      y += fe * -2.12194440e-4f;
+      y -= 0.5f * z;
+      *pDst++ = (x + y) + fe * 0.693359375f;
+    }
+    else if (in.f == 0.0f)
+    {
+      in.u = 0xFF800000U;
+      *pDst++ = in.f;
+    }
+    else if (in.f < 0.0f)
+    {
+      in.u = 0x7FC00000U;
+      *pDst++ = in.f;
+    }
+    else
+    {
+      /* +Inf and NaN */
+      *pDst++ = in.f;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of vlog group
+ */
@@ -0,0 +1,139 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vtanh_f32.c
+ * Description:  Vector hyperbolic tangent for floating-point values
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include <math.h>
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup vtanh Vector Hyperbolic Tangent
+ *
+ * Computes the hyperbolic tangent of a vector on an element-by-element basis.
+ *
+ * <pre>
+ *     pDst[n] = tanh(pSrc[n]),   0 <= n < blockSize.
+ * </pre>
+ *
+ * Small inputs, |x| < 0.625, use an odd minimax polynomial. Larger inputs use
+ * <code>tanh(|x|) = 1 - 2 / (exp(2*|x|) + 1)</code> with the same exponential
+ * kernel as arm_vexp_f32(). Above |x| = 9 the result rounds to +/-1.
+ *
+ * The function supports in-place computation.
+ */
+
+/**
+ * @brief  Exponential for arguments in [1.25 18], see arm_vexp_f32().
+ */
+static float32_t arm_vtanh_exp_f32(
+  float32_t x)
+{
+  float32_t r, p, fj;
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } scale;
+
+  fj = (float32_t) (int32_t) (x * 1.44269504088896341f + 0.5f);
+  r = (x - fj * 0.693359375f) - fj * -2.12194440e-4f;
+
+  p = (((((1.9875691500e-4f * r + 1.3981999507e-3f) * r + 8.3334519073e-3f) * r
+         + 4.1665795894e-2f) * r + 1.6666665459e-1f) * r + 5.0000001201e-1f) * (r * r) + r + 1.0f;
+
+  scale.i = ((int32_t) fj + 127) << 23;
+  return (p * scale.f);
+}
+
+/**
+ * @addtogroup vtanh
+ * @{
+ */
+
+/**
+ * @brief  Vector hyperbolic tangent for floating-point data.
+ * @param[in]  pSrc       points to the input vector.
+ * @param[out] pDst       points to the output vector.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return none.
+ *
+ * <b>Accuracy:</b>
+ * \par
+ * The maximum error measured against a double precision reference is
+ * 1.5 ULP over the whole input range. NaN is propagated.
+ */
+
+void arm_vtanh_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t x, ax, z, out;                      /* Temporary variables for input, output */
+  uint32_t blkCnt;                              /* loop counter */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    x = *pSrc++;
+    ax = fabsf(x);
+
+    if (!(ax >= 0.625f))
+    {
+      /* Odd polynomial, also propagates NaN */
+      z = x * x;
+      out = ((((-5.70498872745e-3f * z + 2.06390887954e-2f) * z - 5.37397155531e-2f) * z
+              + 1.33314422036e-1f) * z - 3.33332819422e-1f) * z * x + x;
+    }
+    else
+    {
+      if (ax > 9.0f)
+      {
+        out = 1.0f;
+      }
+      else
+      {
+        out = 1.0f - 2.0f / (arm_vtanh_exp_f32(ax + ax) + 1.0f);
+      }
+
+      out = (x < 0.0f) ? -out : out;
+    }
+
+    *pDst++ = out;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of vtanh group
+ */
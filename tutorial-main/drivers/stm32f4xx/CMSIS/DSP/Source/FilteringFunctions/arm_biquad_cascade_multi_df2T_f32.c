@@ -0,0 +1,530 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_multi_df2T_f32.c
+ * Description:  Processing function for floating-point multi-channel transposed direct form II Biquad cascade filter
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @brief  Runs one Biquad stage with fixed coefficients over all channels.
+ * @param[in]     *pIn          points to the interleaved input samples.
+ * @param[out]    *pOut         points to the interleaved output samples.
+ * @param[in,out] *pState       points to the stage state, d1 of all channels followed by d2 of all channels.
+ * @param[in]     *pCoeffs      points to the stage coefficients {b0, b1, b2, a1, a2}.
+ * @param[in]     numChannels   number of interleaved channels.
+ * @param[in]     blockSize     number of samples per channel to process.
+ * @return none.
+ */
+static void arm_biquad_multi_df2T_stage_f32(
+  const float32_t * pIn,
+  float32_t * pOut,
+  float32_t * pState,
+  const float32_t * pCoeffs,
+  uint32_t numChannels,
+  uint32_t blockSize)
+{
+  const float32_t *px;                           /* input pointer */
+  float32_t *py;                                 /* output pointer */
+  float32_t *pD1 = pState;                       /* d1 state pointer */
+  float32_t *pD2 = pState + numChannels;         /* d2 state pointer */
+  float32_t b0 = pCoeffs[0];                     /* Filter coefficients */
+  float32_t b1 = pCoeffs[1];
+  float32_t b2 = pCoeffs[2];
+  float32_t a1 = pCoeffs[3];
+  float32_t a2 = pCoeffs[4];
+  float32_t Xn1, acc1, d1a, d2a;                 /* channel a variables */
+  uint32_t sample, chCnt;                        /* loop counters */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t Xn2, Xn3, Xn4;                       /* channel b, c, d inputs */
+  float32_t acc2, acc3, acc4;                    /* channel b, c, d outputs */
+  float32_t d1b, d2b, d1c, d2c, d1d, d2d;        /* channel b, c, d states */
+
+  /* Four channels are filtered together. The four recurrences are independent,
+   * so their multiply-accumulates are interleaved to hide the FPU latency of
+   * the y[n] -> d1 -> y[n+1] dependency chain. */
+  chCnt = numChannels >> 2U;
+
+  while (chCnt > 0U)
+  {
+    /* Reading the state values */
+    d1a = pD1[0];
+    d1b = pD1[1];
+    d1c = pD1[2];
+    d1d = pD1[3];
+    d2a = pD2[0];
+    d2b = pD2[1];
+    d2c = pD2[2];
+    d2d = pD2[3];
+
+    px = pIn;
+    py = pOut;
+    sample = blockSize;
+
+    while (sample > 0U)
+    {
+      /* Read the inputs */
+      Xn1 = px[0];
+      Xn2 = px[1];
+      Xn3 = px[2];
+      Xn4 = px[3];
+
+      /* y[n] = b0 * x[n] + d1 */
+      acc1 = (b0 * Xn1) + d1a;
+      acc2 = (b0 * Xn2) + d1b;
+      acc3 = (b0 * Xn3) + d1c;
+      acc4 = (b0 * Xn4) + d1d;
+
+      /* Store the results in the destination buffer. */
+      py[0] = acc1;
+      py[1] = acc2;
+      py[2] = acc3;
+      py[3] = acc4;
+
+      /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+      d1a = ((b1 * Xn1) + (a1 * acc1)) + d2a;
+      d1b = ((b1 * Xn2) + (a1 * acc2)) + d2b;
+      d1c = ((b1 * Xn3) + (a1 * acc3)) + d2c;
+      d1d = ((b1 * Xn4) + (a1 * acc4)) + d2d;
+
+      /* d2 = b2 * x[n] + a2 * y[n] */
+      d2a = (b2 * Xn1) + (a2 * acc1);
+      d2b = (b2 * Xn2) + (a2 * acc2);
+      d2c = (b2 * Xn3) + (a2 * acc3);
+      d2d = (b2 * Xn4) + (a2 * acc4);
+
+      px += numChannels;
+      py += numChannels;
+
+      /* Decrement the loop counter */
+      sample--;
+    }
+
+    /* Store the updated state variables back into the state array */
+    pD1[0] = d1a;
+    pD1[1] = d1b;
+    pD1[2] = d1c;
+    pD1[3] = d1d;
+    pD2[0] = d2a;
+    pD2[1] = d2b;
+    pD2[2] = d2c;
+    pD2[3] = d2d;
+
+    pIn += 4U;
+    pOut += 4U;
+    pD1 += 4U;
+    pD2 += 4U;
+
+    /* Decrement the loop counter */
+    chCnt--;
+  }
+
+  /* If the number of channels is not a multiple of 4, filter the remaining channels here. */
+  chCnt = numChannels % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  chCnt = numChannels;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (chCnt > 0U)
+  {
+    /* Reading the state values */
+    d1a = *pD1;
+    d2a = *pD2;
+
+    px = pIn;
+    py = pOut;
+    sample = blockSize;
+
+    while (sample > 0U)
+    {
+      /* Read the input */
+      Xn1 = *px;
+
+      /* y[n] = b0 * x[n] + d1 */
+      acc1 = (b0 * Xn1) + d1a;
+
+      /* Store the result in the destination buffer. */
+      *py = acc1;
+
+      /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+      d1a = ((b1 * Xn1) + (a1 * acc1)) + d2a;
+
+      /* d2 = b2 * x[n] + a2 * y[n] */
+      d2a = (b2 * Xn1) + (a2 * acc1);
+
+      px += numChannels;
+      py += numChannels;
+
+      /* Decrement the loop counter */
+      sample--;
+    }
+
+    /* Store the updated state variables back into the state array */
+    *pD1++ = d1a;
+    *pD2++ = d2a;
+
+    pIn++;
+    pOut++;
+
+    /* Decrement the loop counter */
+    chCnt--;
+  }
+}
+
+/**
+ * @brief  Runs one Biquad stage over all channels while the coefficients are crossfaded.
+ * @param[in]     *pIn          points to the interleaved input samples.
+ * @param[out]    *pOut         points to the interleaved output samples.
+ * @param[in,out] *pState       points to the stage state, d1 of all channels followed by d2 of all channels.
+ * @param[in,out] *pCoeffs      points to the stage coefficients {b0, b1, b2, a1, a2}, advanced by blockSize steps on return.
+ * @param[in]     *pStep        points to the per-sample coefficient increments.
+ * @param[in]     numChannels   number of interleaved channels.
+ * @param[in]     blockSize     number of samples per channel to process.
+ * @return none.
+ */
+static void arm_biquad_multi_df2T_ramp_stage_f32(
+  const float32_t * pIn,
+  float32_t * pOut,
+  float32_t * pState,
+  float32_t * pCoeffs,
+  const float32_t * pStep,
+  uint32_t numChannels,
+  uint32_t blockSize)
+{
+  const float32_t *px;                           /* input pointer */
+  float32_t *py;                                 /* output pointer */
+  float32_t *pD1 = pState;                       /* d1 state pointer */
+  float32_t *pD2 = pState + numChannels;         /* d2 state pointer */
+  float32_t b0, b1, b2, a1, a2;                  /* Filter coefficients */
+  float32_t db0 = pStep[0];                      /* Coefficient increments */
+  float32_t db1 = pStep[1];
+  float32_t db2 = pStep[2];
+  float32_t da1 = pStep[3];
+  float32_t da2 = pStep[4];
+  float32_t Xn1, acc1, d1a, d2a;                 /* channel a variables */
+  uint32_t sample, chCnt;                        /* loop counters */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t Xn2, Xn3, Xn4;                       /* channel b, c, d inputs */
+  float32_t acc2, acc3, acc4;                    /* channel b, c, d outputs */
+  float32_t d1b, d2b, d1c, d2c, d1d, d2d;        /* channel b, c, d states */
+
+  /* Same channel grouping as the fixed coefficient stage. The coefficient
+   * update is shared by the four channels of a group. */
+  chCnt = numChannels >> 2U;
+
+  while (chCnt > 0U)
+  {
+    /* Every channel group starts from the same coefficients */
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[1];
+    b2 = pCoeffs[2];
+    a1 = pCoeffs[3];
+    a2 = pCoeffs[4];
+
+    /* Reading the state values */
+    d1a = pD1[0];
+    d1b = pD1[1];
+    d1c = pD1[2];
+    d1d = pD1[3];
+    d2a = pD2[0];
+    d2b = pD2[1];
+    d2c = pD2[2];
+    d2d = pD2[3];
+
+    px = pIn;
+    py = pOut;
+    sample = blockSize;
+
+    while (sample > 0U)
+    {
+      /* Read the inputs */
+      Xn1 = px[0];
+      Xn2 = px[1];
+      Xn3 = px[2];
+      Xn4 = px[3];
+
+      /* y[n] = b0 * x[n] + d1 */
+      acc1 = (b0 * Xn1) + d1a;
+      acc2 = (b0 * Xn2) + d1b;
+      acc3 = (b0 * Xn3) + d1c;
+      acc4 = (b0 * Xn4) + d1d;
+
+      /* Store the results in the destination buffer. */
+      py[0] = acc1;
+      py[1] = acc2;
+      py[2] = acc3;
+      py[3] = acc4;
+
+      /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+      d1a = ((b1 * Xn1) + (a1 * acc1)) + d2a;
+      d1b = ((b1 * Xn2) + (a1 * acc2)) + d2b;
+      d1c = ((b1 * Xn3) + (a1 * acc3)) + d2c;
+      d1d = ((b1 * Xn4) + (a1 * acc4)) + d2d;
+
+      /* d2 = b2 * x[n] + a2 * y[n] */
+      d2a = (b2 * Xn1) + (a2 * acc1);
+      d2b = (b2 * Xn2) + (a2 * acc2);
+      d2c = (b2 * Xn3) + (a2 * acc3);
+      d2d = (b2 * Xn4) + (a2 * acc4);
+
+      /* Move the coefficients one step towards the target */
+      b0 += db0;
+      b1 += db1;
+      b2 += db2;
+      a1 += da1;
+      a2 += da2;
+
+      px += numChannels;
+      py += numChannels;
+
+      /* Decrement the loop counter */
+      sample--;
+    }
+
+    /* Store the updated state variables back into the state array */
+    pD1[0] = d1a;
+    pD1[1] = d1b;
+    pD1[2] = d1c;
+    pD1[3] = d1d;
+    pD2[0] = d2a;
+    pD2[1] = d2b;
+    pD2[2] = d2c;
+    pD2[3] = d2d;
+
+    pIn += 4U;
+    pOut += 4U;
+    pD1 += 4U;
+    pD2 += 4U;
+
+    /* Decrement the loop counter */
+    chCnt--;
+  }
+
+  /* If the number of channels is not a multiple of 4, filter the remaining channels here. */
+  chCnt = numChannels % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  chCnt = numChannels;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (chCnt > 0U)
+  {
+    /* Every channel starts from the same coefficients */
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[1];
+    b2 = pCoeffs[2];
+    a1 = pCoeffs[3];
+    a2 = pCoeffs[4];
+
+    /* Reading the state values */
+    d1a = *pD1;
+    d2a = *pD2;
+
+    px = pIn;
+    py = pOut;
+    sample = blockSize;
+
+    while (sample > 0U)
+    {
+      /* Read the input */
+      Xn1 = *px;
+
+      /* y[n] = b0 * x[n] + d1 */
+      acc1 = (b0 * Xn1) + d1a;
+
+      /* Store the result in the destination buffer. */
+      *py = acc1;
+
+      /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+      d1a = ((b1 * Xn1) + (a1 * acc1)) + d2a;
+
+      /* d2 = b2 * x[n] + a2 * y[n] */
+      d2a = (b2 * Xn1) + (a2 * acc1);
+
+      /* Move the coefficients one step towards the target */
+      b0 += db0;
+      b1 += db1;
+      b2 += db2;
+      a1 += da1;
+      a2 += da2;
+
+      px += numChannels;
+      py += numChannels;
+
+      /* Decrement the loop counter */
+      sample--;
+    }
+
+    /* Store the updated state variables back into the state array */
+    *pD1++ = d1a;
+    *pD2++ = d2a;
+
+    pIn++;
+    pOut++;
+
+    /* Decrement the loop counter */
+    chCnt--;
+  }
+
+  /* All channels went through the same coefficient sequence. Advance the
+   * stored coefficients with the same additions so that the next block
+   * continues from exactly the same values. */
+  sample = blockSize;
+
+  while (sample > 0U)
+  {
+    pCoeffs[0] += db0;
+    pCoeffs[1] += db1;
+    pCoeffs[2] += db2;
+    pCoeffs[3] += da1;
+    pCoeffs[4] += da2;
+
+    /* Decrement the loop counter */
+    sample--;
+  }
+}
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF2T
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point multi-channel transposed direct form II Biquad cascade filter.
+ * @param[in,out] *S          points to an instance of the filter data structure.
+ * @param[in]     *pSrc       points to the block of interleaved input data.
+ * @param[out]    *pDst       points to the block of interleaved output data.
+ * @param[in]     blockSize   number of samples per channel to process.
+ * @return none.
+ *
+ * \par
+ * <code>pSrc</code> and <code>pDst</code> hold <code>blockSize</code> frames of
+ * <code>numChannels</code> interleaved samples. All channels are filtered with the
+ * same coefficients and each channel has its own state.
+ * \par
+ * arm_biquad_cascade_stereo_df2T_f32() is limited to two channels. This function
+ * handles any number of channels without calling the single channel filter once per
+ * channel: each stage is run over all channels before the next stage, and channels are
+ * processed four at a time so that four independent recurrences share the coefficient
+ * registers and fill the floating-point pipeline.
+ * \par
+ * While a coefficient crossfade started by arm_biquad_cascade_multi_df2T_update_f32()
+ * is in progress, the coefficients move by one step per sample. When the crossfade
+ * ends inside the block, the rest of the block runs with the target coefficients.
+ */
+void arm_biquad_cascade_multi_df2T_f32(
+  arm_biquad_cascade_multi_df2T_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pIn = pSrc;                         /* source pointer */
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* coefficient pointer */
+  float32_t *pStep = S->pCoeffsStep;             /* coefficient increment pointer */
+  uint32_t numChannels = S->numChannels;         /* number of channels */
+  uint32_t rampSamples;                          /* samples filtered during the crossfade */
+  uint32_t stage;                                /* loop counter */
+
+  /* Part of the block that is filtered while the coefficients are crossfaded */
+  rampSamples = (blockSize < S->rampCount) ? blockSize : S->rampCount;
+
+  if (rampSamples > 0U)
+  {
+    stage = S->numStages;
+
+    do
+    {
+      arm_biquad_multi_df2T_ramp_stage_f32(pIn, pDst, pState, pCoeffs, pStep,
+                                           numChannels, rampSamples);
+
+      /* The next stage works in place on the output buffer */
+      pIn = pDst;
+      pState += 2U * numChannels;
+      pCoeffs += 5U;
+      pStep += 5U;
+
+      /* Decrement the loop counter */
+      stage--;
+
+    } while (stage > 0U);
+
+    S->rampCount -= rampSamples;
+
+    if (S->rampCount == 0U)
+    {
+      /* Remove the rounding errors accumulated during the crossfade */
+      memcpy(S->pCoeffs, S->pCoeffsTarget, (5U * (uint32_t) S->numStages) * sizeof(float32_t));
+    }
+
+    /* Remaining part of the block */
+    blockSize -= rampSamples;
+    pIn = pSrc + (rampSamples * numChannels);
+    pDst += rampSamples * numChannels;
+    pState = S->pState;
+    pCoeffs = S->pCoeffs;
+  }
+
+  if (blockSize > 0U)
+  {
+    stage = S->numStages;
+
+    do
+    {
+      arm_biquad_multi_df2T_stage_f32(pIn, pDst, pState, pCoeffs,
+                                      numChannels, blockSize);
+
+      /* The next stage works in place on the output buffer */
+      pIn = pDst;
+      pState += 2U * numChannels;
+      pCoeffs += 5U;
+
+      /* Decrement the loop counter */
+      stage--;
+
+    } while (stage > 0U);
+  }
+}
+
+/**
+ * @} end of BiquadCascadeDF2T group
+ */
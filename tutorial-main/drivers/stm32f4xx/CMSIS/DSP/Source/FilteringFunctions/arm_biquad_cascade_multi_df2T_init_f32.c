@@ -0,0 +1,112 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_multi_df2T_init_f32.c
+ * Description:  Initialization function for floating-point multi-channel transposed direct form II Biquad cascade filter
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF2T
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point multi-channel transposed direct form II Biquad cascade filter.
+ * @param[in,out] *S             points to an instance of the filter data structure.
+ * @param[in]     numStages      number of 2nd order stages in the filter.
+ * @param[in]     numChannels    number of interleaved channels.
+ * @param[in]     *pCoeffs       points to the filter coefficients.
+ * @param[in]     *pCoeffsStep   points to the coefficient increment buffer, or NULL if coefficients are never crossfaded.
+ * @param[in]     *pState        points to the state buffer.
+ * @return        none
+ *
+ * <b>Coefficient and State Ordering:</b>
+ * \par
+ * The coefficients are stored in the array <code>pCoeffs</code> in the following order:
+ * <pre>
+ *     {b10, b11, b12, a11, a12, b20, b21, b22, a21, a22, ...}
+ * </pre>
+ *
+ * \par
+ * where <code>b1x</code> and <code>a1x</code> are the coefficients for the first stage,
+ * <code>b2x</code> and <code>a2x</code> are the coefficients for the second stage,
+ * and so on.  The <code>pCoeffs</code> array contains a total of <code>5*numStages</code> values.
+ * The coefficients are shared by all channels.
+ * During a crossfade started by arm_biquad_cascade_multi_df2T_update_f32() the filter
+ * writes the intermediate coefficients to <code>pCoeffs</code>, so the array must not
+ * be placed in a const data section in that case.
+ *
+ * \par
+ * <code>pCoeffsStep</code> holds the per-sample coefficient increments of a crossfade
+ * and has the same length as <code>pCoeffs</code>.
+ *
+ * \par
+ * The <code>pState</code> is a pointer to state array.
+ * Each Biquad stage has 2 state variables <code>d1</code> and <code>d2</code> for each channel.
+ * The states of a stage are stored channel by channel, first <code>d1</code> of all channels
+ * and then <code>d2</code> of all channels:
+ * <pre>
+ *     {d11[0], d11[1], ..., d11[numChannels-1], d12[0], ..., d12[numChannels-1], d21[0], ...}
+ * </pre>
+ * The state array has a total length of <code>2*numStages*numChannels</code> values.
+ * The state variables are updated after each block of data is processed.
+ */
+void arm_biquad_cascade_multi_df2T_init_f32(
+  arm_biquad_cascade_multi_df2T_instance_f32 * S,
+  uint8_t numStages,
+  uint16_t numChannels,
+  float32_t * pCoeffs,
+  float32_t * pCoeffsStep,
+  float32_t * pState)
+{
+  /* Assign filter stages */
+  S->numStages = numStages;
+
+  /* Assign number of channels */
+  S->numChannels = numChannels;
+
+  /* Assign coefficient pointers */
+  S->pCoeffs = pCoeffs;
+  S->pCoeffsStep = pCoeffsStep;
+  S->pCoeffsTarget = pCoeffs;
+
+  /* No crossfade in progress */
+  S->rampCount = 0U;
+
+  /* Clear state buffer and size is always 2 * numStages * numChannels */
+  memset(pState, 0, (2U * (uint32_t) numStages * numChannels) * sizeof(float32_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+}
+
+/**
+ * @} end of BiquadCascadeDF2T group
+ */
@@ -0,0 +1,109 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_multi_df2T_update_f32.c
+ * Description:  Coefficient crossfade for floating-point multi-channel transposed direct form II Biquad cascade filter
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF2T
+ * @{
+ */
+
+/**
+ * @brief  Coefficient update function for the floating-point multi-channel transposed direct form II Biquad cascade filter.
+ * @param[in,out] *S             points to an instance of the filter data structure.
+ * @param[in]     *pNewCoeffs    points to the new filter coefficients, same ordering as <code>pCoeffs</code>.
+ * @param[in]     rampLength     number of samples over which the coefficients are crossfaded.
+ * @return        The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if a crossfade
+ *                is requested and the instance has no coefficient increment buffer.
+ *
+ * \par
+ * Switching all coefficients of a running filter at once produces audible clicks when
+ * the response changes a lot, for example when an equalizer band is moved. With a
+ * non-zero <code>rampLength</code> the coefficients move linearly from their current
+ * values to <code>pNewCoeffs</code>, one step per sample, over the next
+ * <code>rampLength</code> samples processed by arm_biquad_cascade_multi_df2T_f32().
+ * At the end of the crossfade the coefficients are set exactly to <code>pNewCoeffs</code>.
+ * <code>pNewCoeffs</code> is read again at that point and must stay valid until then.
+ * \par
+ * Calling this function while a crossfade is in progress starts a new crossfade from
+ * the current intermediate coefficients. With <code>rampLength = 0</code> the new
+ * coefficients are copied and take effect immediately.
+ * \par
+ * Linear interpolation keeps each intermediate section stable when the start and end
+ * sections are stable and close together, which is the case for the small steps of a
+ * parameter change. Large jumps between very different responses should use a longer
+ * ramp or a crossfade of two filter outputs instead.
+ */
+arm_status arm_biquad_cascade_multi_df2T_update_f32(
+  arm_biquad_cascade_multi_df2T_instance_f32 * S,
+  const float32_t * pNewCoeffs,
+  uint32_t rampLength)
+{
+  float32_t *pCoeffs = S->pCoeffs;               /* coefficient pointer */
+  float32_t *pStep = S->pCoeffsStep;             /* coefficient increment pointer */
+  float32_t scale;                               /* 1 / rampLength */
+  uint32_t i;                                    /* loop counter */
+  uint32_t numCoeffs = 5U * (uint32_t) S->numStages;
+
+  if (rampLength == 0U)
+  {
+    /* Take the new coefficients immediately */
+    memcpy(pCoeffs, pNewCoeffs, numCoeffs * sizeof(float32_t));
+
+    S->pCoeffsTarget = pCoeffs;
+    S->rampCount = 0U;
+
+    return (ARM_MATH_SUCCESS);
+  }
+
+  if (pStep == NULL)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  scale = 1.0f / (float32_t) rampLength;
+
+  /* step = (new - current) / rampLength */
+  for (i = 0U; i < numCoeffs; i++)
+  {
+    pStep[i] = (pNewCoeffs[i] - pCoeffs[i]) * scale;
+  }
+
+  S->pCoeffsTarget = pNewCoeffs;
+  S->rampCount = rampLength;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of BiquadCascadeDF2T group
+ */
@@ -0,0 +1,152 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_correlate_fft_f32.c
+ * Description:  Floating-point correlation and GCC-PHAT with real FFTs
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Corr
+ * @{
+ */
+
+/**
+ * @brief Correlation of floating-point sequences computed with real FFTs.
+ * @param[in]  S          points to an instance of the floating-point FFT correlation structure.
+ * @param[in]  pSrcA      points to the first input sequence.
+ * @param[in]  srcALen    length of the first input sequence.
+ * @param[in]  pSrcB      points to the second input sequence.
+ * @param[in]  srcBLen    length of the second input sequence.
+ * @param[in]  lagLo      first lag to output.
+ * @param[in]  lagHi      last lag to output, <code>lagHi >= lagLo</code>.
+ * @param[in]  weighting  ARM_CORRELATE_PLAIN for the correlation or ARM_CORRELATE_PHAT for GCC-PHAT.
+ * @param[out] pDst       points to the output, of length <code>lagHi - lagLo + 1</code>.
+ * @return none.
+ *
+ * \par
+ * With ARM_CORRELATE_PLAIN, the output is the correlation of
+ * arm_correlate_lags_f32(), computed as
+ * <pre>
+ *     r = IFFT(FFT(a) * conj(FFT(b)))
+ * </pre>
+ * on sequences zero padded to <code>S->fftLen</code>. The cost is three real
+ * FFTs whatever the number of lags, which is faster than the direct
+ * correlation when many lags are needed.
+ * \par
+ * With ARM_CORRELATE_PHAT, each bin of the cross spectrum is divided by its
+ * magnitude before the inverse transform (generalized cross-correlation with
+ * phase transform). Only the phase, and thus the delay, is kept, which gives a
+ * sharp peak for colored or reverberant signals. The peak is then 1 for a pure
+ * delay.
+ * \par
+ * The result is exact when <code>srcALen + srcBLen - 1 <= S->fftLen</code>.
+ * Longer inputs are truncated to <code>S->fftLen</code> samples, and with
+ * <code>srcALen + srcBLen - 1 > S->fftLen</code> the correlation is circular:
+ * the lags <code>m</code> and <code>m - fftLen</code> overlap, which is
+ * harmless for delay estimation when both sequences are windows of the same
+ * signal and <code>|m|</code> stays well below <code>fftLen / 2</code>.
+ * Lags must satisfy <code>-fftLen < lagLo <= lagHi < fftLen</code>.
+ */
+
+void arm_correlate_fft_f32(
+  arm_correlate_fft_instance_f32 * S,
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  int32_t lagLo,
+  int32_t lagHi,
+  arm_correlate_weighting weighting,
+  float32_t * pDst)
+{
+  uint32_t fftLen = S->fftLen;                  /* Length of the real FFTs */
+  float32_t *pBuf = S->pScratch;                /* Time domain buffer */
+  float32_t *pSpecA = pBuf + fftLen;            /* Spectrum of the first sequence */
+  float32_t *pSpecB = pSpecA + fftLen;          /* Spectrum of the second sequence */
+  float32_t aRe, aIm, bRe, bIm, re, im, mag;    /* Temporary variables */
+  uint32_t k;                                   /* Loop counter */
+  int32_t lag;                                  /* Current lag */
+
+  srcALen = (srcALen < fftLen) ? srcALen : fftLen;
+  srcBLen = (srcBLen < fftLen) ? srcBLen : fftLen;
+
+  /* Spectra of the zero padded sequences */
+  memcpy(pBuf, pSrcA, srcALen * sizeof(float32_t));
+  memset(pBuf + srcALen, 0, (fftLen - srcALen) * sizeof(float32_t));
+  arm_rfft_fast_f32(&S->Srfft, pBuf, pSpecA, 0U);
+
+  memcpy(pBuf, pSrcB, srcBLen * sizeof(float32_t));
+  memset(pBuf + srcBLen, 0, (fftLen - srcBLen) * sizeof(float32_t));
+  arm_rfft_fast_f32(&S->Srfft, pBuf, pSpecB, 0U);
+
+  /* Cross spectrum A * conj(B), the DC and Nyquist bins are real */
+  pSpecA[0] *= pSpecB[0];
+  pSpecA[1] *= pSpecB[1];
+
+  for (k = 1U; k < fftLen / 2U; k++)
+  {
+    aRe = pSpecA[2U * k];
+    aIm = pSpecA[(2U * k) + 1U];
+    bRe = pSpecB[2U * k];
+    bIm = pSpecB[(2U * k) + 1U];
+
+    re = (aRe * bRe) + (aIm * bIm);
+    im = (aIm * bRe) - (aRe * bIm);
+
+    if (weighting == ARM_CORRELATE_PHAT)
+    {
+      arm_sqrt_f32((re * re) + (im * im), &mag);
+      mag = (mag > 0.0f) ? (1.0f / mag) : 0.0f;
+      re *= mag;
+      im *= mag;
+    }
+
+    pSpecA[2U * k] = re;
+    pSpecA[(2U * k) + 1U] = im;
+  }
+
+  if (weighting == ARM_CORRELATE_PHAT)
+  {
+    pSpecA[0] = (pSpecA[0] > 0.0f) ? 1.0f : ((pSpecA[0] < 0.0f) ? -1.0f : 0.0f);
+    pSpecA[1] = (pSpecA[1] > 0.0f) ? 1.0f : ((pSpecA[1] < 0.0f) ? -1.0f : 0.0f);
+  }
+
+  arm_rfft_fast_f32(&S->Srfft, pSpecA, pBuf, 1U);
+
+  /* Negative lags wrap to the end of the circular correlation */
+  for (lag = lagLo; lag <= lagHi; lag++)
+  {
+    *pDst++ = pBuf[(lag < 0) ? (lag + (int32_t) fftLen) : lag];
+  }
+}
+
+/**
+ * @} end of Corr group
+ */
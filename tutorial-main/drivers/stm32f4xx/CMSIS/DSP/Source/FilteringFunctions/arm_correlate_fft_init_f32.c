@@ -0,0 +1,74 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_correlate_fft_init_f32.c
+ * Description:  Floating-point FFT correlation initialization function
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Corr
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point FFT correlation.
+ * @param[in,out] S         points to an instance of the floating-point FFT correlation structure.
+ * @param[in]     fftLen    length of the real FFTs, a length supported by arm_rfft_fast_init_f32().
+ * @param[in]     pScratch  points to the scratch buffer of length <code>3*fftLen</code>.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or
+ * ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported value.
+ *
+ * <b>Description:</b>
+ * \par
+ * For an exact correlation, <code>fftLen</code> must be at least
+ * <code>srcALen + srcBLen - 1</code>.
+ */
+
+arm_status arm_correlate_fft_init_f32(
+  arm_correlate_fft_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pScratch)
+{
+  arm_status status;
+
+  status = arm_rfft_fast_init_f32(&S->Srfft, fftLen);
+
+  if (status == ARM_MATH_SUCCESS)
+  {
+    S->fftLen = fftLen;
+    S->pScratch = pScratch;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of Corr group
+ */
@@ -0,0 +1,130 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_correlate_lags_f32.c
+ * Description:  Correlation of floating-point sequences over a window of lags
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Corr
+ * @{
+ */
+
+/**
+ * @brief Correlation of floating-point sequences over a window of lags.
+ * @param[in]  pSrcA    points to the first input sequence.
+ * @param[in]  srcALen  length of the first input sequence.
+ * @param[in]  pSrcB    points to the second input sequence.
+ * @param[in]  srcBLen  length of the second input sequence.
+ * @param[in]  lagLo    first lag to compute.
+ * @param[in]  lagHi    last lag to compute, <code>lagHi >= lagLo</code>.
+ * @param[out] pDst     points to the output, of length <code>lagHi - lagLo + 1</code>.
+ * @return none.
+ *
+ * \par
+ * Computes only the lags <code>m = lagLo, ..., lagHi</code> of
+ * <pre>
+ *     r[m] = sum(a[n + m] * b[n])
+ * </pre>
+ * where the sum runs over the samples of both sequences. <code>r[m]</code>
+ * is <code>pDst[maxLen - 1 + m]</code> of arm_correlate_f32(), with
+ * <code>maxLen = max(srcALen, srcBLen)</code>, so a positive lag means that
+ * <code>pSrcA</code> is delayed with respect to <code>pSrcB</code>. Lags
+ * without overlap give zero.
+ * \par
+ * When only the peak within a known range of delays is needed, this costs
+ * <code>(lagHi - lagLo + 1) / (2 * maxLen - 1)</code> of the full correlation.
+ */
+
+void arm_correlate_lags_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  int32_t lagLo,
+  int32_t lagHi,
+  float32_t * pDst)
+{
+  float32_t *px, *py;                           /* Input pointers */
+  float32_t sum;                                /* Accumulator */
+  int32_t lag;                                  /* Current lag */
+  int32_t start, end;                           /* Overlap of the sequences in pSrcB */
+  uint32_t count;                               /* loop counter */
+
+  for (lag = lagLo; lag <= lagHi; lag++)
+  {
+    /* 0 <= n < srcBLen and 0 <= n + lag < srcALen */
+    start = (lag < 0) ? -lag : 0;
+    end = (int32_t) srcALen - lag;
+    end = (end < (int32_t) srcBLen) ? end : (int32_t) srcBLen;
+
+    sum = 0.0f;
+
+    if (end > start)
+    {
+      px = pSrcA + (start + lag);
+      py = pSrcB + start;
+      count = (uint32_t) (end - start);
+
+#if defined (ARM_MATH_DSP)
+
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+      /* Loop unrolling.  Process 4 products at a time. */
+      while (count >= 4U)
+      {
+        sum += px[0] * py[0];
+        sum += px[1] * py[1];
+        sum += px[2] * py[2];
+        sum += px[3] * py[3];
+
+        px += 4U;
+        py += 4U;
+        count -= 4U;
+      }
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+      while (count > 0U)
+      {
+        sum += (*px++) * (*py++);
+
+        /* Decrement the loop counter */
+        count--;
+      }
+    }
+
+    *pDst++ = sum;
+  }
+}
+
+/**
+ * @} end of Corr group
+ */
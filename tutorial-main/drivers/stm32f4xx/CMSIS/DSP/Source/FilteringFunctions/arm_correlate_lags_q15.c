@@ -0,0 +1,133 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_correlate_lags_q15.c
+ * Description:  Correlation of Q15 sequences over a window of lags
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Corr
+ * @{
+ */
+
+/**
+ * @brief Correlation of Q15 sequences over a window of lags.
+ * @param[in]  pSrcA    points to the first input sequence.
+ * @param[in]  srcALen  length of the first input sequence.
+ * @param[in]  pSrcB    points to the second input sequence.
+ * @param[in]  srcBLen  length of the second input sequence.
+ * @param[in]  lagLo    first lag to compute.
+ * @param[in]  lagHi    last lag to compute, <code>lagHi >= lagLo</code>.
+ * @param[out] pDst     points to the output, of length <code>lagHi - lagLo + 1</code>.
+ * @return none.
+ *
+ * \par
+ * Computes only the lags <code>m = lagLo, ..., lagHi</code> of
+ * <pre>
+ *     r[m] = sum(a[n + m] * b[n])
+ * </pre>
+ * where the sum runs over the samples of both sequences. <code>r[m]</code>
+ * is <code>pDst[maxLen - 1 + m]</code> of arm_correlate_q15(), with
+ * <code>maxLen = max(srcALen, srcBLen)</code>, so a positive lag means that
+ * <code>pSrcA</code> is delayed with respect to <code>pSrcB</code>. Lags
+ * without overlap give zero.
+ * \par
+ * When only the peak within a known range of delays is needed, this costs
+ * <code>(lagHi - lagLo + 1) / (2 * maxLen - 1)</code> of the full correlation.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * As for arm_correlate_q15(), the products are accumulated in a 64-bit
+ * accumulator in 34.30 format and the result is truncated to 34.15 and
+ * saturated to 1.15.
+ */
+
+void arm_correlate_lags_q15(
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  int32_t lagLo,
+  int32_t lagHi,
+  q15_t * pDst)
+{
+  q15_t *px, *py;                               /* Input pointers */
+  q63_t sum;                                    /* Accumulator */
+  int32_t lag;                                  /* Current lag */
+  int32_t start, end;                           /* Overlap of the sequences in pSrcB */
+  uint32_t count;                               /* loop counter */
+
+  for (lag = lagLo; lag <= lagHi; lag++)
+  {
+    /* 0 <= n < srcBLen and 0 <= n + lag < srcALen */
+    start = (lag < 0) ? -lag : 0;
+    end = (int32_t) srcALen - lag;
+    end = (end < (int32_t) srcBLen) ? end : (int32_t) srcBLen;
+
+    sum = 0;
+
+    if (end > start)
+    {
+      px = pSrcA + (start + lag);
+      py = pSrcB + start;
+      count = (uint32_t) (end - start);
+
+#if defined (ARM_MATH_DSP)
+
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+      /* Loop unrolling.  Process 4 products at a time with two dual multiplies. */
+      while (count >= 4U)
+      {
+        sum = __SMLALD(*__SIMD32(px)++, *__SIMD32(py)++, sum);
+        sum = __SMLALD(*__SIMD32(px)++, *__SIMD32(py)++, sum);
+
+        count -= 4U;
+      }
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+      while (count > 0U)
+      {
+        sum += (q31_t) (*px++) * (*py++);
+
+        /* Decrement the loop counter */
+        count--;
+      }
+    }
+
+    /* Store the result in 1.15 format, as arm_correlate_q15() */
+    *pDst++ = (q15_t) __SSAT((q31_t) (sum >> 15), 16);
+  }
+}
+
+/**
+ * @} end of Corr group
+ */
@@ -0,0 +1,94 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_correlate_peak_f32.c
+ * Description:  Interpolated peak of a floating-point correlation
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Corr
+ * @{
+ */
+
+/**
+ * @brief Peak of a floating-point correlation with sub-sample interpolation.
+ * @param[in]  pSrc     points to the correlation, as returned by arm_correlate_lags_f32() or arm_correlate_fft_f32().
+ * @param[in]  numLags  number of lags in pSrc.
+ * @param[in]  lagLo    lag of pSrc[0].
+ * @param[out] pLag     lag of the peak, with a fractional part.
+ * @param[out] pPeak    interpolated value of the peak.
+ * @return none.
+ *
+ * \par
+ * The largest value is located as with arm_max_f32(), the first one on ties,
+ * and refined by fitting a parabola through it and its two neighbours:
+ * <pre>
+ *     d    = 0.5 * (r[m-1] - r[m+1]) / (r[m-1] - 2 * r[m] + r[m+1])
+ *     lag  = m + d
+ *     peak = r[m] - 0.25 * (r[m-1] - r[m+1]) * d
+ * </pre>
+ * A peak on the first or last lag of the window is not interpolated.
+ */
+
+void arm_correlate_peak_f32(
+  float32_t * pSrc,
+  uint32_t numLags,
+  int32_t lagLo,
+  float32_t * pLag,
+  float32_t * pPeak)
+{
+  float32_t maxVal, prev, next, denom, d;       /* Peak and its neighbours */
+  uint32_t index;                               /* Position of the peak */
+
+  arm_max_f32(pSrc, numLags, &maxVal, &index);
+
+  d = 0.0f;
+
+  if ((index > 0U) && (index + 1U < numLags))
+  {
+    prev = pSrc[index - 1U];
+    next = pSrc[index + 1U];
+    denom = prev - (2.0f * maxVal) + next;
+
+    /* A flat top is not interpolated */
+    if (denom < 0.0f)
+    {
+      d = 0.5f * (prev - next) / denom;
+      maxVal -= 0.25f * (prev - next) * d;
+    }
+  }
+
+  *pLag = (float32_t) ((int32_t) index + lagLo) + d;
+  *pPeak = maxVal;
+}
+
+/**
+ * @} end of Corr group
+ */
@@ -0,0 +1,182 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_farrow_resample_f32.c
+ * Description:  Floating-point Farrow fractional resampler
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+#define ONE_BY_3 (0.333333333333333f)
+#define ONE_BY_6 (0.166666666666667f)
+#define MU_SCALE (1.0f / 16777216.0f)
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup Farrow_Resample Farrow Fractional Resampler
+ *
+ * These functions change the sample rate of a signal by an arbitrary ratio, which does
+ * not need to be a ratio of small integers and may be changed at run time, for example
+ * to follow a drifting clock in an asynchronous sample rate converter.
+ * \par
+ * The output samples are computed by cubic Lagrange interpolation between the input
+ * samples, implemented with a Farrow structure: four fixed 4-tap FIR branches compute
+ * the coefficients of a cubic polynomial in the fractional delay <code>mu</code>,
+ * which is then evaluated with Horner's rule.
+ * <pre>
+ *    c0 = x[n-1]
+ *    c1 = -x[n-2]/3 - x[n-1]/2 + x[n] - x[n+1]/6
+ *    c2 = x[n-2]/2 - x[n-1] + x[n]/2
+ *    c3 = -x[n-2]/6 + x[n-1]/2 - x[n]/2 + x[n+1]/6
+ *    y  = ((c3 * mu + c2) * mu + c1) * mu + c0
+ * </pre>
+ * Only the coefficient evaluation depends on <code>mu</code>, so the cost per output
+ * sample is fixed at about 13 multiply-accumulates whatever the resampling ratio.
+ * \par
+ * Cubic interpolation has a limited image rejection. It is accurate for signals
+ * well below the Nyquist frequency, or after a polyphase stage (see
+ * \ref FIR_Resample) has oversampled the signal. For full band signals with large
+ * ratios use the polyphase sample rate converter.
+ *
+ * \par Algorithm:
+ * The position of the next output sample is kept as an integer input sample index and
+ * a fractional part <code>mu</code> in 0.24 format. After each output sample the
+ * position advances by <code>step</code> in 8.24 format. Output samples are delayed by
+ * two input samples with respect to the input.
+ * The number of output samples of a call depends on the position reached by the previous
+ * call and is returned by the processing function. It is at most
+ * <code>ceil(blockSize*2^24/step)</code>.
+ * \par
+ * <code>pState</code> points to a state array of size <code>blockSize + 3</code>.
+ *
+ * \par Instance Structure
+ * The state variables of a resampler are stored in an instance data structure.
+ * A separate instance structure must be defined for each resampler.
+ * There are separate instance structure declarations for each of the 3 supported data types.
+ *
+ * \par Initialization Functions
+ * There is also an associated initialization function for each data type.
+ * The initialization function performs the following operations:
+ * - Sets the values of the internal structure fields.
+ * - Zeros out the values in the state buffer.
+ * - Checks that <code>step</code> is not zero.
+ */
+
+/**
+ * @addtogroup Farrow_Resample
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point Farrow fractional resampler.
+ * @param[in,out] *S          points to an instance of the floating-point Farrow resampler structure.
+ * @param[in]     *pSrc       points to the block of input data.
+ * @param[out]    *pDst       points to the block of output data.
+ * @param[in]     blockSize   number of input samples to process.
+ * @return        number of output samples written to <code>pDst</code>.
+ */
+uint32_t arm_farrow_resample_f32(
+  arm_farrow_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                /* State pointer */
+  float32_t *pStateCurnt;                       /* Points to the current sample of the state */
+  float32_t *px;                                /* Points to the interpolation window */
+  float32_t xm1, x0, x1, x2;                    /* Input samples around the output sample */
+  float32_t c0, c1, c2, c3;                     /* Farrow branch outputs */
+  float32_t mu;                                 /* Fractional position */
+  uint32_t n = S->inputOffset;                  /* Input sample of the next output sample */
+  uint32_t frac = S->mu;                        /* Fractional position, 0.24 format */
+  uint32_t stepInt = S->step >> 24;             /* Whole input samples per output sample */
+  uint32_t stepFrac = S->step & 0x00FFFFFFU;    /* Fractional input samples per output sample */
+  uint32_t numOut = 0U;                         /* Number of output samples */
+  uint32_t i;                                   /* Loop counter */
+
+  /* S->pState buffer contains the 3 last samples of the previous frame */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + 3U;
+
+  /* Copy the new input samples into the state buffer */
+  i = blockSize;
+
+  while (i > 0U)
+  {
+    *pStateCurnt++ = *pSrc++;
+
+    /* Decrement the loop counter */
+    i--;
+  }
+
+  /* Compute only the output samples that fall inside this block */
+  while (n < blockSize)
+  {
+    /* The window of the output sample ends at input sample n */
+    px = pState + n;
+    xm1 = px[0];
+    x0 = px[1];
+    x1 = px[2];
+    x2 = px[3];
+
+    /* Farrow branches */
+    c0 = x0;
+    c1 = ((x1 - (ONE_BY_3 * xm1)) - (0.5f * x0)) - (ONE_BY_6 * x2);
+    c2 = (0.5f * (xm1 + x1)) - x0;
+    c3 = (ONE_BY_6 * (x2 - xm1)) + (0.5f * (x0 - x1));
+
+    /* Fractional position */
+    mu = (float32_t) frac * MU_SCALE;
+
+    /* Horner evaluation of the cubic polynomial */
+    *pDst++ = (((c3 * mu) + c2) * mu + c1) * mu + c0;
+
+    numOut++;
+
+    /* Advance by step */
+    frac += stepFrac;
+    n += stepInt + (frac >> 24);
+    frac &= 0x00FFFFFFU;
+  }
+
+  /* Position of the next output sample relative to the next block */
+  S->inputOffset = n - blockSize;
+  S->mu = frac;
+
+  /* Processing is complete.
+   ** Now copy the last 3 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+  pState[0] = pState[blockSize];
+  pState[1] = pState[blockSize + 1U];
+  pState[2] = pState[blockSize + 2U];
+
+  return (numOut);
+}
+
+/**
+ * @} end of Farrow_Resample group
+ */
@@ -0,0 +1,98 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_farrow_resample_init_q31.c
+ * Description:  Q31 Farrow fractional resampler initialization function
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Farrow_Resample
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 Farrow fractional resampler.
+ * @param[in,out] *S          points to an instance of the Q31 Farrow resampler structure.
+ * @param[in]     step        input samples advanced per output sample, in 8.24 format.
+ * @param[in]     *pState     points to the state buffer.
+ * @param[in]     blockSize   number of input samples to process per call.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or
+ * ARM_MATH_ARGUMENT_ERROR if <code>step</code> is zero.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>step</code> is the ratio of the input sample rate to the output sample rate.
+ * For example 44.1 kHz to 48 kHz uses <code>step = 0.91875 * 2^24 = 0x00EB3333</code>.
+ * The step may be changed between calls by writing <code>S->step</code>, which allows
+ * the resampler to track a drifting clock.
+ * \par
+ * <code>pState</code> points to the array of state variables.
+ * <code>pState</code> is of length <code>blockSize+3</code> words
+ * where <code>blockSize</code> is the maximum number of input samples processed by each call to <code>arm_farrow_resample_q31()</code>.
+ */
+
+arm_status arm_farrow_resample_init_q31(
+  arm_farrow_resample_instance_q31 * S,
+  uint32_t step,
+  q31_t * pState,
+  uint32_t blockSize)
+{
+  arm_status status;
+
+  if (step == 0U)
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Assign step */
+    S->step = step;
+
+    /* Start at the beginning of the first block */
+    S->mu = 0U;
+    S->inputOffset = 0U;
+
+    /* Clear state buffer and size of buffer is always blockSize + 3 */
+    memset(pState, 0, (blockSize + 3U) * sizeof(q31_t));
+
+    /* Assign state pointer */
+    S->pState = pState;
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+
+}
+
+/**
+ * @} end of Farrow_Resample group
+ */
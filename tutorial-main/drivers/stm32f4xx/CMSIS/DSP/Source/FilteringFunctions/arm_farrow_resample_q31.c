@@ -0,0 +1,143 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_farrow_resample_q31.c
+ * Description:  Q31 Farrow fractional resampler
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+#define ONE_BY_3_Q31 ((q63_t) 0x2AAAAAAB)
+#define ONE_BY_6_Q31 ((q63_t) 0x15555555)
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Farrow_Resample
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 Farrow fractional resampler.
+ * @param[in,out] *S          points to an instance of the Q31 Farrow resampler structure.
+ * @param[in]     *pSrc       points to the block of input data.
+ * @param[out]    *pDst       points to the block of output data.
+ * @param[in]     blockSize   number of input samples to process.
+ * @return        number of output samples written to <code>pDst</code>.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The branch outputs and the polynomial evaluation use 64-bit intermediate values in 1.31
+ * scale, so the overshoot of the interpolation between full scale samples does not wrap.
+ * The result is saturated to 1.31 format.
+ */
+uint32_t arm_farrow_resample_q31(
+  arm_farrow_resample_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pState = S->pState;                    /* State pointer */
+  q31_t *pStateCurnt;                           /* Points to the current sample of the state */
+  q31_t *px;                                    /* Points to the interpolation window */
+  q31_t xm1, x0, x1, x2;                        /* Input samples around the output sample */
+  q63_t c0, c1, c2, c3;                         /* Farrow branch outputs */
+  q63_t mu;                                     /* Fractional position */
+  q63_t acc;                                    /* Accumulator */
+  uint32_t n = S->inputOffset;                  /* Input sample of the next output sample */
+  uint32_t frac = S->mu;                        /* Fractional position, 0.24 format */
+  uint32_t stepInt = S->step >> 24;             /* Whole input samples per output sample */
+  uint32_t stepFrac = S->step & 0x00FFFFFFU;    /* Fractional input samples per output sample */
+  uint32_t numOut = 0U;                         /* Number of output samples */
+  uint32_t i;                                   /* Loop counter */
+
+  /* S->pState buffer contains the 3 last samples of the previous frame */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + 3U;
+
+  /* Copy the new input samples into the state buffer */
+  i = blockSize;
+
+  while (i > 0U)
+  {
+    *pStateCurnt++ = *pSrc++;
+
+    /* Decrement the loop counter */
+    i--;
+  }
+
+  /* Compute only the output samples that fall inside this block */
+  while (n < blockSize)
+  {
+    /* The window of the output sample ends at input sample n */
+    px = pState + n;
+    xm1 = px[0];
+    x0 = px[1];
+    x1 = px[2];
+    x2 = px[3];
+
+    /* Farrow branches in 1.31 scale, with integer headroom */
+    c0 = (q63_t) x0;
+    c1 = (((q63_t) x1 - (((q63_t) xm1 * ONE_BY_3_Q31) >> 31)) - ((q63_t) x0 >> 1)) - (((q63_t) x2 * ONE_BY_6_Q31) >> 31);
+    c2 = (((q63_t) xm1 + x1) >> 1) - x0;
+    c3 = ((((q63_t) x2 - xm1) * ONE_BY_6_Q31) >> 31) + (((q63_t) x0 - x1) >> 1);
+
+    /* Fractional position in 3.29 format */
+    mu = (q63_t) frac << 5;
+
+    /* Horner evaluation of the cubic polynomial */
+    acc = ((c3 * mu) >> 29) + c2;
+    acc = ((acc * mu) >> 29) + c1;
+    acc = ((acc * mu) >> 29) + c0;
+
+    /* Store the result after saturating to 1.31 format in the destination buffer. */
+    *pDst++ = clip_q63_to_q31(acc);
+
+    numOut++;
+
+    /* Advance by step */
+    frac += stepFrac;
+    n += stepInt + (frac >> 24);
+    frac &= 0x00FFFFFFU;
+  }
+
+  /* Position of the next output sample relative to the next block */
+  S->inputOffset = n - blockSize;
+  S->mu = frac;
+
+  /* Processing is complete.
+   ** Now copy the last 3 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+  pState[0] = pState[blockSize];
+  pState[1] = pState[blockSize + 1U];
+  pState[2] = pState[blockSize + 2U];
+
+  return (numOut);
+}
+
+/**
+ * @} end of Farrow_Resample group
+ */
@@ -0,0 +1,307 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fdaf_f32.c
+ * Description:  Floating-point frequency domain adaptive filter
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FDAF Frequency Domain Adaptive Filter
+ *
+ * Partitioned block frequency domain adaptive filter, also known as the
+ * multi-delay filter (MDF).
+ *
+ * The LMS and normalized LMS filters update every coefficient on every sample,
+ * which costs about <code>2*numTaps</code> multiply-accumulates per sample and
+ * converges slowly when the input is colored. The FDAF processes the input in
+ * blocks of <code>blockLen</code> samples and computes both the filtering and
+ * the gradient with real FFTs of length <code>2*blockLen</code>, so the cost
+ * per sample grows with the logarithm of the block length instead of the
+ * filter length. Each frequency bin is normalized by its own power estimate,
+ * which decorrelates colored input and speeds up convergence.
+ *
+ * The <code>numTaps = blockLen * numPartitions</code> coefficients are split
+ * in <code>numPartitions</code> partitions of <code>blockLen</code> taps. Long
+ * filters are thus handled with a short block, which keeps the latency at
+ * <code>blockLen</code> samples.
+ *
+ * \par Algorithm:
+ * For every block of <code>blockLen</code> input samples, with <code>X_p</code>
+ * the spectrum of the <code>2*blockLen</code> most recent input samples
+ * <code>p</code> blocks ago and <code>W_p</code> the spectrum of partition
+ * <code>p</code>:
+ * <pre>
+ *     y    = last blockLen samples of IFFT(sum(X_p * W_p))
+ *     e    = d - y
+ *     E    = FFT([0 ... 0, e])
+ *     P[k] = beta * P[k] + (1 - beta) * |X_0[k]|^2
+ *     W_p  = W_p + FFT([first blockLen samples of IFFT(mu * conj(X_p) * E / (numPartitions * P)), 0 ... 0])
+ * </pre>
+ * The gradient constraint of the last line keeps each partition a linear
+ * convolution of <code>blockLen</code> taps. During the first blocks the
+ * power estimate is a plain running average, so that it does not start from
+ * zero.
+ *
+ * \par
+ * <code>mu</code> is normalized: the filter is stable for <code>0 < mu < 2</code>
+ * and <code>mu = 0.5</code> is a good starting point.
+ *
+ * \par
+ * The functions operate on blocks of data. <code>blockSize</code> of each call
+ * must be a multiple of <code>blockLen</code>, and the output is the same as
+ * with calls of <code>blockLen</code> samples.
+ *
+ * \par Cycle count
+ * Each block costs <code>2*numPartitions + 3</code> real FFTs of length
+ * <code>2*blockLen</code> and <code>2*numPartitions</code> complex
+ * multiplications of <code>blockLen</code> bins, against
+ * <code>2*blockLen*numTaps</code> multiply-accumulates for arm_lms_norm_f32().
+ *
+ * \par Instance Structure
+ * The coefficient spectra, the state and the FFT instance are stored together
+ * in an instance data structure. A separate instance structure must be
+ * defined for each filter. The coefficients are held in the frequency domain,
+ * arm_fdaf_get_coeffs_f32() returns them as time domain taps.
+ *
+ * \par Initialization Functions
+ * arm_fdaf_init_f32() initializes the FFT, sets the coefficients to zero and
+ * clears the state.
+ */
+
+/**
+ * @addtogroup FDAF
+ * @{
+ */
+
+/**
+ * @brief  Accumulate the product of two packed spectra of blockLen bins.
+ *         The first two values are the real DC and Nyquist bins.
+ */
+static void arm_fdaf_cmplx_mac_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst,
+  uint32_t blockLen)
+{
+  float32_t aRe, aIm, bRe, bIm;                 /* Temporary variables */
+  uint32_t k;                                   /* Loop counter */
+
+  pDst[0] += pSrcA[0] * pSrcB[0];
+  pDst[1] += pSrcA[1] * pSrcB[1];
+
+  for (k = 1U; k < blockLen; k++)
+  {
+    aRe = pSrcA[2U * k];
+    aIm = pSrcA[(2U * k) + 1U];
+    bRe = pSrcB[2U * k];
+    bIm = pSrcB[(2U * k) + 1U];
+
+    pDst[2U * k] += (aRe * bRe) - (aIm * bIm);
+    pDst[(2U * k) + 1U] += (aRe * bIm) + (aIm * bRe);
+  }
+}
+
+/**
+ * @brief  Product of the conjugate of the first packed spectrum with the second.
+ */
+static void arm_fdaf_cmplx_conj_mult_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst,
+  uint32_t blockLen)
+{
+  float32_t aRe, aIm, bRe, bIm;                 /* Temporary variables */
+  uint32_t k;                                   /* Loop counter */
+
+  pDst[0] = pSrcA[0] * pSrcB[0];
+  pDst[1] = pSrcA[1] * pSrcB[1];
+
+  for (k = 1U; k < blockLen; k++)
+  {
+    aRe = pSrcA[2U * k];
+    aIm = pSrcA[(2U * k) + 1U];
+    bRe = pSrcB[2U * k];
+    bIm = pSrcB[(2U * k) + 1U];
+
+    pDst[2U * k] = (aRe * bRe) + (aIm * bIm);
+    pDst[(2U * k) + 1U] = (aRe * bIm) - (aIm * bRe);
+  }
+}
+
+/**
+ * @brief Processing function for the floating-point frequency domain adaptive filter.
+ * @param[in,out] S          points to an instance of the floating-point FDAF structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[in]     pRef       points to the block of reference data.
+ * @param[out]    pOut       points to the block of output data.
+ * @param[out]    pErr       points to the block of error data.
+ * @param[in]     blockSize  number of samples to process, a multiple of <code>S->blockLen</code>.
+ * @return none.
+ */
+
+void arm_fdaf_f32(
+  arm_fdaf_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pRef,
+  float32_t * pOut,
+  float32_t * pErr,
+  uint32_t blockSize)
+{
+  uint32_t blockLen = S->blockLen;              /* Partition length */
+  uint32_t fftLen = 2U * blockLen;              /* Length of the real FFTs */
+  uint32_t numPartitions = S->numPartitions;    /* Number of partitions */
+  float32_t *pInput = S->pState;                /* Last fftLen input samples */
+  float32_t *pSpectra = pInput + fftLen;        /* Ring of input spectra */
+  float32_t *pErrSpec = pSpectra + (numPartitions * fftLen);  /* Error spectrum */
+  float32_t *pScratch1 = pErrSpec + fftLen;     /* Scratch spectrum */
+  float32_t *pScratch2 = pScratch1 + fftLen;    /* Scratch spectrum */
+  float32_t *pPower = pScratch2 + fftLen;       /* Power estimate of bins 0 to blockLen */
+  float32_t *pX, *pW;                           /* Spectra of one partition */
+  float32_t beta, power, meanPower, delta;      /* Power estimate */
+  float32_t scale;                              /* Normalized step size of one bin */
+  uint32_t p, k, slot;                          /* Loop counters */
+  uint32_t blkCnt;                              /* Number of blocks */
+
+  blkCnt = blockSize / blockLen;
+
+  while (blkCnt > 0U)
+  {
+    /* Append the new block to the input and transform the last fftLen samples */
+    memmove(pInput, pInput + blockLen, blockLen * sizeof(float32_t));
+    memcpy(pInput + blockLen, pSrc, blockLen * sizeof(float32_t));
+
+    S->head = (S->head == 0U) ? (uint16_t) (numPartitions - 1U) : (uint16_t) (S->head - 1U);
+    memcpy(pScratch1, pInput, fftLen * sizeof(float32_t));
+    arm_rfft_fast_f32(&S->Srfft, pScratch1, pSpectra + (S->head * fftLen), 0U);
+
+    /* Filter output, sum of the partitions */
+    memset(pScratch1, 0, fftLen * sizeof(float32_t));
+    slot = S->head;
+
+    for (p = 0U; p < numPartitions; p++)
+    {
+      arm_fdaf_cmplx_mac_f32(pSpectra + (slot * fftLen), S->pCoeffs + (p * fftLen), pScratch1, blockLen);
+      slot = (slot + 1U == numPartitions) ? 0U : slot + 1U;
+    }
+
+    arm_rfft_fast_f32(&S->Srfft, pScratch1, pScratch2, 1U);
+
+    /* The last blockLen samples are the linear convolution */
+    for (k = 0U; k < blockLen; k++)
+    {
+      pOut[k] = pScratch2[blockLen + k];
+      pErr[k] = pRef[k] - pOut[k];
+    }
+
+    /* Error spectrum */
+    memset(pScratch1, 0, blockLen * sizeof(float32_t));
+    memcpy(pScratch1 + blockLen, pErr, blockLen * sizeof(float32_t));
+    arm_rfft_fast_f32(&S->Srfft, pScratch1, pErrSpec, 0U);
+
+    /* Power estimate of the newest spectrum, a running average until it is primed */
+    if (S->blockCount < 0xFFFFFFFFU)
+    {
+      S->blockCount++;
+    }
+
+    beta = ((float32_t) (S->blockCount - 1U) / (float32_t) S->blockCount);
+    beta = (beta < S->beta) ? beta : S->beta;
+    pX = pSpectra + (S->head * fftLen);
+    meanPower = 0.0f;
+
+    for (k = 0U; k <= blockLen; k++)
+    {
+      if (k == 0U)
+      {
+        power = pX[0] * pX[0];
+      }
+      else if (k == blockLen)
+      {
+        power = pX[1] * pX[1];
+      }
+      else
+      {
+        power = (pX[2U * k] * pX[2U * k]) + (pX[(2U * k) + 1U] * pX[(2U * k) + 1U]);
+      }
+
+      pPower[k] = (beta * pPower[k]) + ((1.0f - beta) * power);
+      meanPower += pPower[k];
+    }
+
+    /* Bins without excitation are regularized by a fraction of the mean power */
+    delta = (meanPower / (float32_t) (blockLen + 1U)) * 1.0e-3f + 1.0e-30f;
+
+    /* Normalize the error spectrum by the power of each bin */
+    pErrSpec[0] *= S->mu / ((numPartitions * pPower[0]) + delta);
+    pErrSpec[1] *= S->mu / ((numPartitions * pPower[blockLen]) + delta);
+
+    for (k = 1U; k < blockLen; k++)
+    {
+      scale = S->mu / ((numPartitions * pPower[k]) + delta);
+      pErrSpec[2U * k] *= scale;
+      pErrSpec[(2U * k) + 1U] *= scale;
+    }
+
+    /* Constrained gradient of each partition */
+    slot = S->head;
+
+    for (p = 0U; p < numPartitions; p++)
+    {
+      pX = pSpectra + (slot * fftLen);
+      pW = S->pCoeffs + (p * fftLen);
+
+      arm_fdaf_cmplx_conj_mult_f32(pX, pErrSpec, pScratch1, blockLen);
+      arm_rfft_fast_f32(&S->Srfft, pScratch1, pScratch2, 1U);
+
+      /* Keep the first blockLen taps */
+      memset(pScratch2 + blockLen, 0, blockLen * sizeof(float32_t));
+      arm_rfft_fast_f32(&S->Srfft, pScratch2, pScratch1, 0U);
+
+      for (k = 0U; k < fftLen; k++)
+      {
+        pW[k] += pScratch1[k];
+      }
+
+      slot = (slot + 1U == numPartitions) ? 0U : slot + 1U;
+    }
+
+    pSrc += blockLen;
+    pRef += blockLen;
+    pOut += blockLen;
+    pErr += blockLen;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of FDAF group
+ */
@@ -0,0 +1,73 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fdaf_get_coeffs_f32.c
+ * Description:  Time domain coefficients of the floating-point frequency domain adaptive filter
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FDAF
+ * @{
+ */
+
+/**
+ * @brief  Time domain coefficients of the floating-point frequency domain adaptive filter.
+ * @param[in,out] S      points to an instance of the floating-point FDAF structure.
+ * @param[out]    pDst   points to the output buffer of <code>blockLen*numPartitions</code> taps.
+ * @return none.
+ *
+ * <b>Description:</b>
+ * \par
+ * The taps are returned in natural order <code>{b[0], b[1], ..., b[numTaps-1]}</code>,
+ * unlike the time reversed coefficients of the LMS filters. The FFT scratch
+ * buffers of the state are used, the filter itself is not modified.
+ */
+
+void arm_fdaf_get_coeffs_f32(
+  arm_fdaf_instance_f32 * S,
+  float32_t * pDst)
+{
+  uint32_t blockLen = S->blockLen;              /* Partition length */
+  uint32_t fftLen = 2U * blockLen;              /* Length of the real FFTs */
+  float32_t *pScratch1 = S->pState + (fftLen * (S->numPartitions + 2U));  /* Scratch spectrum */
+  float32_t *pScratch2 = pScratch1 + fftLen;    /* Scratch spectrum */
+  uint32_t p;                                   /* Loop counter */
+
+  for (p = 0U; p < S->numPartitions; p++)
+  {
+    memcpy(pScratch1, S->pCoeffs + (p * fftLen), fftLen * sizeof(float32_t));
+    arm_rfft_fast_f32(&S->Srfft, pScratch1, pScratch2, 1U);
+    memcpy(pDst + (p * blockLen), pScratch2, blockLen * sizeof(float32_t));
+  }
+}
+
+/**
+ * @} end of FDAF group
+ */
@@ -0,0 +1,108 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fdaf_init_f32.c
+ * Description:  Floating-point frequency domain adaptive filter initialization function
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FDAF
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point frequency domain adaptive filter.
+ * @param[in,out] S              points to an instance of the floating-point FDAF structure.
+ * @param[in]     blockLen       partition length, <code>2*blockLen</code> must be a length supported by arm_rfft_fast_init_f32().
+ * @param[in]     numPartitions  number of partitions, the filter has <code>blockLen*numPartitions</code> taps.
+ * @param[in]     pCoeffs        points to the coefficient spectra buffer.
+ * @param[in]     pState         points to the state buffer.
+ * @param[in]     mu             normalized step size, <code>0 < mu < 2</code>.
+ * @param[in]     beta           forgetting factor of the power estimate, <code>0 <= beta < 1</code>.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or
+ * ARM_MATH_ARGUMENT_ERROR if <code>numPartitions</code> is zero or <code>2*blockLen</code> is not a supported FFT length.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pCoeffs</code> points to an array of <code>2*blockLen*numPartitions</code> values
+ * holding the spectra of the partitions. It is cleared by this function.
+ * \par
+ * <code>pState</code> points to an array of <code>2*blockLen*(numPartitions+4)+blockLen+1</code> values
+ * holding the input history, the ring of input spectra, the FFT scratch buffers and the power estimate.
+ * \par
+ * A forgetting factor <code>beta</code> of <code>0.9</code> averages the power over about ten blocks.
+ */
+
+arm_status arm_fdaf_init_f32(
+  arm_fdaf_instance_f32 * S,
+  uint16_t blockLen,
+  uint16_t numPartitions,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  float32_t mu,
+  float32_t beta)
+{
+  arm_status status;
+
+  if ((numPartitions == 0U) || (blockLen > 0x7FFFU) ||
+      (arm_rfft_fast_init_f32(&S->Srfft, (uint16_t) (2U * blockLen)) != ARM_MATH_SUCCESS))
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Assign filter size and step sizes */
+    S->blockLen = blockLen;
+    S->numPartitions = numPartitions;
+    S->mu = mu;
+    S->beta = beta;
+
+    /* The power estimate starts as a running average */
+    S->head = 0U;
+    S->blockCount = 0U;
+
+    /* Clear coefficient and state buffers */
+    memset(pCoeffs, 0, 2U * blockLen * numPartitions * sizeof(float32_t));
+    memset(pState, 0, ((2U * blockLen * (numPartitions + 4U)) + blockLen + 1U) * sizeof(float32_t));
+
+    /* Assign coefficient and state pointers */
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of FDAF group
+ */
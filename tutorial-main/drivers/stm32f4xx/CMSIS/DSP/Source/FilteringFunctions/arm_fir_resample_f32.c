@@ -0,0 +1,262 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_f32.c
+ * Description:  Floating-point polyphase sample rate converter
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIR_Resample Finite Impulse Response (FIR) Sample Rate Converter
+ *
+ * These functions change the sample rate of a signal by a rational factor <code>L/M</code>.
+ * Conceptually, they are equivalent to an FIR interpolator by <code>L</code> followed by
+ * a decimator by <code>M</code>:
+ * zero stuffing by <code>L</code>, lowpass filtering at the rate <code>L*fs</code> and
+ * keeping one sample out of <code>M</code>.
+ * \par
+ * Chaining arm_fir_interpolate_f32() and arm_fir_decimate_f32() does exactly that and
+ * computes all <code>L</code> interpolated samples per input sample although only one
+ * in <code>M</code> is kept. For 44.1 kHz to 48 kHz (<code>L=160, M=147</code>) 147 of
+ * every 148 computed samples are thrown away. The sample rate converter only computes the
+ * output samples that are kept: each output sample is one polyphase branch of
+ * <code>phaseLength</code> taps applied to the most recent input samples, so the cost is
+ * <code>phaseLength</code> multiply-accumulates per output sample whatever the values of
+ * <code>L</code> and <code>M</code>.
+ *
+ * \par Algorithm:
+ * Output sample <code>m</code> lies at time <code>t = m*M</code> on the interpolated grid.
+ * With <code>n = floor(t/L)</code> and the polyphase branch <code>p = t mod L</code>:
+ * <pre>
+ *    y[m] = b[p] * x[n] + b[p+L] * x[n-1] + ... + b[p+L*(phaseLength-1)] * x[n-phaseLength+1]
+ * </pre>
+ * The first output sample is aligned with the first input sample.
+ * The number of output samples of a call depends on the position reached by the previous
+ * call and is returned by the processing function. It is at most
+ * <code>ceil(blockSize*L/M)</code>.
+ * \par
+ * <code>pCoeffs</code> points to a coefficient array of size <code>numTaps = L*phaseLength</code>.
+ * The coefficients are the ones of an FIR interpolator by <code>L</code>: a lowpass filter
+ * designed at the rate <code>L*fs</code> with a cutoff frequency of
+ * <code>min(1/L, 1/M)</code> of the Nyquist frequency and a passband gain of <code>L</code>.
+ * Coefficients are stored in time reversed order.
+ * \par
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], b[numTaps-3], ..., b[1], b[0]}
+ * </pre>
+ * \par
+ * <code>pState</code> points to a state array of size <code>blockSize + phaseLength - 1</code>.
+ * The state variables are updated after each block of data is processed, the coefficients are untouched.
+ *
+ * \par Instance Structure
+ * The coefficients and state variables for a filter are stored together in an instance data structure.
+ * A separate instance structure must be defined for each filter.
+ * Coefficient arrays may be shared among several instances while state variable array should be allocated separately.
+ * There are separate instance structure declarations for each of the 3 supported data types.
+ *
+ * \par Initialization Functions
+ * There is also an associated initialization function for each data type.
+ * The initialization function performs the following operations:
+ * - Sets the values of the internal structure fields.
+ * - Zeros out the values in the state buffer.
+ * - Checks that <code>L</code> and <code>M</code> are not zero and that the length of the filter is a multiple of <code>L</code>.
+ *
+ * \par Fixed-Point Behavior
+ * Care must be taken when using the fixed-point versions of the sample rate converter functions.
+ * In particular, the overflow and saturation behavior of the accumulator used in each function must be considered.
+ * Refer to the function specific documentation below for usage guidelines.
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point polyphase sample rate converter.
+ * @param[in,out] *S          points to an instance of the floating-point resampler structure.
+ * @param[in]     *pSrc       points to the block of input data.
+ * @param[out]    *pDst       points to the block of output data.
+ * @param[in]     blockSize   number of input samples to process.
+ * @return        number of output samples written to <code>pDst</code>.
+ */
+uint32_t arm_fir_resample_f32(
+  arm_fir_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;              /* Coefficient pointer */
+  float32_t *pStateCurnt;                       /* Points to the current sample of the state */
+  float32_t *ptr1, *ptr2;                       /* Temporary pointers for state and coefficient buffers */
+  float32_t sum;                                /* Accumulator */
+  float32_t x0, c0;                             /* Temporary variables to hold state and coefficient values */
+  uint32_t L = S->L;                            /* Upsample factor */
+  uint32_t phaseLen = S->phaseLength;           /* Length of each polyphase filter component */
+  uint32_t n = S->inputOffset;                  /* Input sample of the next output sample */
+  uint32_t p = S->phase;                        /* Polyphase branch of the next output sample */
+  uint32_t stepInt = S->M / L;                  /* Whole input samples per output sample */
+  uint32_t stepFrac = S->M % L;                 /* Remaining branches per output sample */
+  uint32_t numOut = 0U;                         /* Number of output samples */
+  uint32_t i, tapCnt;                           /* Loop counters */
+
+  /* S->pState buffer contains previous frame (phaseLen - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + (phaseLen - 1U);
+
+  /* Copy the new input samples into the state buffer */
+  i = blockSize;
+
+  while (i > 0U)
+  {
+    *pStateCurnt++ = *pSrc++;
+
+    /* Decrement the loop counter */
+    i--;
+  }
+
+  /* Compute only the output samples that fall inside this block */
+  while (n < blockSize)
+  {
+    /* Set accumulator to zero */
+    sum = 0.0f;
+
+    /* The window of the output sample ends at input sample n */
+    ptr1 = pState + n;
+
+    /* Coefficients of the polyphase branch p */
+    ptr2 = pCoeffs + ((L - 1U) - p);
+
+#if defined (ARM_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling.  Process 4 taps at a time. */
+    tapCnt = phaseLen >> 2U;
+
+    while (tapCnt > 0U)
+    {
+      c0 = *ptr2;
+      ptr2 += L;
+      x0 = *ptr1++;
+      sum += c0 * x0;
+
+      c0 = *ptr2;
+      ptr2 += L;
+      x0 = *ptr1++;
+      sum += c0 * x0;
+
+      c0 = *ptr2;
+      ptr2 += L;
+      x0 = *ptr1++;
+      sum += c0 * x0;
+
+      c0 = *ptr2;
+      ptr2 += L;
+      x0 = *ptr1++;
+      sum += c0 * x0;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* If the polyPhase length is not a multiple of 4, compute the remaining taps here.
+     ** No loop unrolling is used. */
+    tapCnt = phaseLen % 0x4U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+    tapCnt = phaseLen;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (tapCnt > 0U)
+    {
+      /* Read the coefficient */
+      c0 = *ptr2;
+
+      /* Increment the coefficient pointer by interpolation factor times. */
+      ptr2 += L;
+
+      /* Read the input sample */
+      x0 = *ptr1++;
+
+      /* Perform the multiply-accumulate */
+      sum += c0 * x0;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* Store the result in the destination buffer. */
+    *pDst++ = sum;
+
+    numOut++;
+
+    /* Advance by M on the interpolated grid */
+    p += stepFrac;
+    n += stepInt;
+
+    if (p >= L)
+    {
+      p -= L;
+      n++;
+    }
+  }
+
+  /* Position of the next output sample relative to the next block */
+  S->inputOffset = n - blockSize;
+  S->phase = (uint16_t) p;
+
+  /* Processing is complete.
+   ** Now copy the last phaseLen - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+  pState = S->pState + blockSize;
+
+  i = phaseLen - 1U;
+
+  while (i > 0U)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement the loop counter */
+    i--;
+  }
+
+  return (numOut);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
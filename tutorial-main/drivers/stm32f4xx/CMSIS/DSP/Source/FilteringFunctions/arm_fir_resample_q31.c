@@ -0,0 +1,209 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_q31.c
+ * Description:  Q31 polyphase sample rate converter
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 polyphase sample rate converter.
+ * @param[in,out] *S          points to an instance of the Q31 resampler structure.
+ * @param[in]     *pSrc       points to the block of input data.
+ * @param[out]    *pDst       points to the block of output data.
+ * @param[in]     blockSize   number of input samples to process.
+ * @return        number of output samples written to <code>pDst</code>.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using an internal 64-bit accumulator.
+ * The accumulator has a 2.62 format and maintains full precision of the intermediate multiplication results but provides only a single guard bit.
+ * Thus, if the accumulator result overflows it wraps around rather than clip.
+ * In order to avoid overflows completely the input signal must be scaled down by log2(phaseLength) bits.
+ * After all multiply-accumulates are performed, the 2.62 accumulator is truncated to 1.32 format and then saturated to 1.31 format.
+ */
+uint32_t arm_fir_resample_q31(
+  arm_fir_resample_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pState = S->pState;                    /* State pointer */
+  q31_t *pCoeffs = S->pCoeffs;                  /* Coefficient pointer */
+  q31_t *pStateCurnt;                           /* Points to the current sample of the state */
+  q31_t *ptr1, *ptr2;                           /* Temporary pointers for state and coefficient buffers */
+  q63_t sum;                                    /* Accumulator */
+  q31_t x0, c0;                                 /* Temporary variables to hold state and coefficient values */
+  uint32_t L = S->L;                            /* Upsample factor */
+  uint32_t phaseLen = S->phaseLength;           /* Length of each polyphase filter component */
+  uint32_t n = S->inputOffset;                  /* Input sample of the next output sample */
+  uint32_t p = S->phase;                        /* Polyphase branch of the next output sample */
+  uint32_t stepInt = S->M / L;                  /* Whole input samples per output sample */
+  uint32_t stepFrac = S->M % L;                 /* Remaining branches per output sample */
+  uint32_t numOut = 0U;                         /* Number of output samples */
+  uint32_t i, tapCnt;                           /* Loop counters */
+
+  /* S->pState buffer contains previous frame (phaseLen - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + (phaseLen - 1U);
+
+  /* Copy the new input samples into the state buffer */
+  i = blockSize;
+
+  while (i > 0U)
+  {
+    *pStateCurnt++ = *pSrc++;
+
+    /* Decrement the loop counter */
+    i--;
+  }
+
+  /* Compute only the output samples that fall inside this block */
+  while (n < blockSize)
+  {
+    /* Set accumulator to zero */
+    sum = 0;
+
+    /* The window of the output sample ends at input sample n */
+    ptr1 = pState + n;
+
+    /* Coefficients of the polyphase branch p */
+    ptr2 = pCoeffs + ((L - 1U) - p);
+
+#if defined (ARM_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling.  Process 4 taps at a time. */
+    tapCnt = phaseLen >> 2U;
+
+    while (tapCnt > 0U)
+    {
+      c0 = *ptr2;
+      ptr2 += L;
+      x0 = *ptr1++;
+      sum += (q63_t) x0 * c0;
+
+      c0 = *ptr2;
+      ptr2 += L;
+      x0 = *ptr1++;
+      sum += (q63_t) x0 * c0;
+
+      c0 = *ptr2;
+      ptr2 += L;
+      x0 = *ptr1++;
+      sum += (q63_t) x0 * c0;
+
+      c0 = *ptr2;
+      ptr2 += L;
+      x0 = *ptr1++;
+      sum += (q63_t) x0 * c0;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* If the polyPhase length is not a multiple of 4, compute the remaining taps here.
+     ** No loop unrolling is used. */
+    tapCnt = phaseLen % 0x4U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+    tapCnt = phaseLen;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (tapCnt > 0U)
+    {
+      /* Read the coefficient */
+      c0 = *ptr2;
+
+      /* Increment the coefficient pointer by interpolation factor times. */
+      ptr2 += L;
+
+      /* Read the input sample */
+      x0 = *ptr1++;
+
+      /* Perform the multiply-accumulate */
+      sum += (q63_t) x0 * c0;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* Store the result after converting to 1.31 format in the destination buffer. */
+    *pDst++ = (q31_t) (sum >> 31);
+
+    numOut++;
+
+    /* Advance by M on the interpolated grid */
+    p += stepFrac;
+    n += stepInt;
+
+    if (p >= L)
+    {
+      p -= L;
+      n++;
+    }
+  }
+
+  /* Position of the next output sample relative to the next block */
+  S->inputOffset = n - blockSize;
+  S->phase = (uint16_t) p;
+
+  /* Processing is complete.
+   ** Now copy the last phaseLen - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+  pState = S->pState + blockSize;
+
+  i = phaseLen - 1U;
+
+  while (i > 0U)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement the loop counter */
+    i--;
+  }
+
+  return (numOut);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
@@ -0,0 +1,208 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_sparse_gather_f32.c
+ * Description:  Floating-point sparse FIR filter with gather offsets processing function
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIR_Sparse_Gather Sparse FIR Filters with Gather Offsets
+ *
+ * A sparse FIR filter for fixed tap patterns on long delay lines.
+ *
+ * The filter computes the same output as arm_fir_sparse_f32():
+ * <pre>
+ *     y[n] = b[0] * x[n-pTapDelay[0]] + b[1] * x[n-pTapDelay[1]] + ... + b[numTaps-1] * x[n-pTapDelay[numTaps-1]]
+ * </pre>
+ * arm_fir_sparse_f32() recomputes the read position of every tap on each call
+ * and copies <code>blockSize</code> samples out of its circular delay line
+ * into a scratch buffer, for every tap, before multiplying them. Here the
+ * initialization turns the tap delays into gather offsets once, and the
+ * delay line mirrors its first <code>blockSize</code> samples behind its end,
+ * so that the samples of every tap are contiguous in the state buffer. Each
+ * tap then costs one offset addition and a plain multiply-accumulate over
+ * the block; no scratch buffer is needed. Taps are processed in pairs so the
+ * output is loaded and stored once for every two taps.
+ *
+ * The delay line holds <code>delaySize = maxDelay + blockSize</code> samples
+ * and <code>pState</code> points to an array of
+ * <code>maxDelay + 2*blockSize</code> values.
+ *
+ * The tap pattern can be replaced between blocks with
+ * arm_fir_sparse_gather_set_taps_f32(), which recomputes the offsets and
+ * keeps the delay line. The coefficients are read through
+ * <code>pCoeffs</code> on every call and may be updated at any time.
+ */
+
+/**
+ * @addtogroup FIR_Sparse_Gather
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point sparse FIR filter with gather offsets.
+ * @param[in,out] S          points to an instance of the floating-point sparse gather FIR structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of samples to process, at most the blockSize given at initialization.
+ * @return none.
+ */
+
+void arm_fir_sparse_gather_f32(
+  arm_fir_sparse_gather_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;              /* Coefficient pointer */
+  uint32_t *pOffsets = S->pOffsets;             /* Gather offset pointer */
+  float32_t *px0, *px1;                         /* Read pointers of the two taps of a pair */
+  float32_t *pOut;                              /* Destination pointer */
+  float32_t c0, c1;                             /* Coefficients of the two taps of a pair */
+  uint32_t delaySize = S->delaySize;            /* Length of the delay line */
+  uint32_t writeIndex = S->stateIndex;          /* Position of the first sample of the block */
+  uint32_t readIndex;                           /* Position of the first sample of a tap */
+  uint32_t numFirst;                            /* Samples written before the wraparound */
+  uint32_t tapCnt, blkCnt;                      /* loop counters */
+
+  /* Write the block into the delay line, in at most two pieces */
+  numFirst = delaySize - writeIndex;
+  numFirst = (numFirst < blockSize) ? numFirst : blockSize;
+
+  memcpy(pState + writeIndex, pSrc, numFirst * sizeof(float32_t));
+  memcpy(pState, pSrc + numFirst, (blockSize - numFirst) * sizeof(float32_t));
+
+  /* Refresh the mirror of the first samples if any of them was written */
+  if ((writeIndex < S->blockSize) || (numFirst < blockSize))
+  {
+    memcpy(pState + delaySize, pState, S->blockSize * sizeof(float32_t));
+  }
+
+  /* Taps in pairs. The first pair, or a single first tap, sets the output */
+  tapCnt = S->numTaps;
+
+  if ((tapCnt & 1U) != 0U)
+  {
+    readIndex = writeIndex + *pOffsets++;
+    readIndex = (readIndex >= delaySize) ? (readIndex - delaySize) : readIndex;
+    px0 = pState + readIndex;
+    c0 = *pCoeffs++;
+    pOut = pDst;
+
+    blkCnt = blockSize;
+
+    while (blkCnt > 0U)
+    {
+      *pOut++ = *px0++ * c0;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    tapCnt--;
+  }
+  else
+  {
+    memset(pDst, 0, blockSize * sizeof(float32_t));
+  }
+
+  tapCnt >>= 1U;
+
+  while (tapCnt > 0U)
+  {
+    /* The gather offsets are delaySize - pTapDelay[k], so a single
+     * subtraction wraps the read position */
+    readIndex = writeIndex + *pOffsets++;
+    readIndex = (readIndex >= delaySize) ? (readIndex - delaySize) : readIndex;
+    px0 = pState + readIndex;
+
+    readIndex = writeIndex + *pOffsets++;
+    readIndex = (readIndex >= delaySize) ? (readIndex - delaySize) : readIndex;
+    px1 = pState + readIndex;
+
+    c0 = *pCoeffs++;
+    c1 = *pCoeffs++;
+    pOut = pDst;
+
+#if defined (ARM_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop over the blockSize. Unroll by a factor of 4.
+     * Compute 8 MACS at a time. */
+    blkCnt = blockSize >> 2U;
+
+    while (blkCnt > 0U)
+    {
+      pOut[0] += (px0[0] * c0) + (px1[0] * c1);
+      pOut[1] += (px0[1] * c0) + (px1[1] * c1);
+      pOut[2] += (px0[2] * c0) + (px1[2] * c1);
+      pOut[3] += (px0[3] * c0) + (px1[3] * c1);
+      pOut += 4U;
+      px0 += 4U;
+      px1 += 4U;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the blockSize is not a multiple of 4,
+     * compute the remaining samples */
+    blkCnt = blockSize % 0x4U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (blkCnt > 0U)
+    {
+      *pOut++ += (*px0++ * c0) + (*px1++ * c1);
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Decrement the loop counter */
+    tapCnt--;
+  }
+
+  /* Advance the write position */
+  writeIndex += blockSize;
+  S->stateIndex = (writeIndex >= delaySize) ? (writeIndex - delaySize) : writeIndex;
+}
+
+/**
+ * @} end of FIR_Sparse_Gather group
+ */
@@ -0,0 +1,101 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_sparse_gather_init_f32.c
+ * Description:  Floating-point sparse FIR filter with gather offsets initialization function
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Sparse_Gather
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point sparse FIR filter with gather offsets.
+ * @param[in,out] S          points to an instance of the floating-point sparse gather FIR structure.
+ * @param[in]     numTaps    number of nonzero coefficients in the filter.
+ * @param[in]     pCoeffs    points to the array of filter coefficients.
+ * @param[in]     pState     points to the state buffer.
+ * @param[in]     pTapDelay  points to the array of tap delays.
+ * @param[in]     pOffsets   points to the array the gather offsets are computed into.
+ * @param[in]     maxDelay   largest tap delay supported.
+ * @param[in]     blockSize  largest number of samples processed per call.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or
+ * ARM_MATH_ARGUMENT_ERROR if <code>blockSize</code> is zero or a tap delay is
+ * outside <code>[0, maxDelay]</code>.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pCoeffs</code>, <code>pTapDelay</code> and <code>pOffsets</code>
+ * have length <code>numTaps</code>; <code>pTapDelay</code> is only read
+ * during the call. <code>pState</code> has length
+ * <code>maxDelay + 2*blockSize</code> and is cleared.
+ */
+
+arm_status arm_fir_sparse_gather_init_f32(
+  arm_fir_sparse_gather_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  int32_t * pTapDelay,
+  uint32_t * pOffsets,
+  uint32_t maxDelay,
+  uint32_t blockSize)
+{
+  arm_status status = ARM_MATH_ARGUMENT_ERROR;
+
+  if (blockSize > 0U)
+  {
+    /* Assign filter taps and block size */
+    S->numTaps = numTaps;
+    S->blockSize = blockSize;
+    S->delaySize = maxDelay + blockSize;
+    S->maxDelay = maxDelay;
+
+    /* reset the stateIndex to 0 */
+    S->stateIndex = 0U;
+
+    /* Clear state buffer and size is always maxDelay + 2 * blockSize */
+    memset(pState, 0, (maxDelay + (2U * blockSize)) * sizeof(float32_t));
+
+    /* Assign pointers */
+    S->pState = pState;
+    S->pOffsets = pOffsets;
+
+    /* Compute the gather offsets */
+    status = arm_fir_sparse_gather_set_taps_f32(S, pCoeffs, pTapDelay);
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of FIR_Sparse_Gather group
+ */
@@ -0,0 +1,85 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_sparse_gather_set_taps_f32.c
+ * Description:  Floating-point sparse FIR filter with gather offsets tap update function
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Sparse_Gather
+ * @{
+ */
+
+/**
+ * @brief  Tap update for the floating-point sparse FIR filter with gather offsets.
+ * @param[in,out] S          points to an instance of the floating-point sparse gather FIR structure.
+ * @param[in]     pCoeffs    points to the array of numTaps filter coefficients.
+ * @param[in]     pTapDelay  points to the array of numTaps tap delays.
+ * @return        The function returns ARM_MATH_SUCCESS if the taps were updated or
+ * ARM_MATH_ARGUMENT_ERROR if a tap delay is outside <code>[0, maxDelay]</code>,
+ * in which case the filter is left unchanged.
+ *
+ * <b>Description:</b>
+ * \par
+ * The offsets are written to the array given at initialization. The delay
+ * line is kept, so the new taps act on past input from the next block on.
+ */
+
+arm_status arm_fir_sparse_gather_set_taps_f32(
+  arm_fir_sparse_gather_instance_f32 * S,
+  float32_t * pCoeffs,
+  int32_t * pTapDelay)
+{
+  uint32_t i;
+
+  /* Check all delays before touching the offsets */
+  for (i = 0U; i < S->numTaps; i++)
+  {
+    if ((pTapDelay[i] < 0) || ((uint32_t) pTapDelay[i] > S->maxDelay))
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+  }
+
+  /* Sample n - delay of the block starting at stateIndex sits at
+   * stateIndex + n + delaySize - delay, modulo delaySize */
+  for (i = 0U; i < S->numTaps; i++)
+  {
+    S->pOffsets[i] = S->delaySize - (uint32_t) pTapDelay[i];
+  }
+
+  S->pCoeffs = pCoeffs;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of FIR_Sparse_Gather group
+ */
@@ -0,0 +1,199 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_xfade_f32.c
+ * Description:  Floating-point crossfading FIR filter processing function
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIR_Xfade Crossfading FIR Filters
+ *
+ * An FIR filter whose coefficients can be replaced while it runs.
+ *
+ * Switching the coefficients of arm_fir_f32() between two blocks steps the
+ * output, which is heard as a click, and resetting the state to avoid
+ * stale samples is worse. The crossfading filter keeps one delay line and
+ * two coefficient sets: after arm_fir_xfade_set_coeffs_f32() the output of
+ * the old set is faded into the output of the new one over
+ * <code>fadeLen</code> samples:
+ * <pre>
+ *     y[n] = (1 - g[n]) * sum(bOld[k] * x[n-k]) + g[n] * sum(bNew[k] * x[n-k])
+ *     g[n] = (n + 1) / fadeLen,  n = 0 ... fadeLen-1
+ * </pre>
+ * Both sums are computed in the same pass over the delay line, so a fade
+ * costs one extra multiply-accumulate per tap and no extra loads of the
+ * state. Outside of fades the filter runs a single set.
+ *
+ * The fade may start and end anywhere within a block. A set passed while a
+ * fade is running is queued and faded in as soon as the current fade ends;
+ * a later set replaces a queued one. The caller owns the coefficient arrays:
+ * the active, incoming and queued sets must stay unchanged until they have
+ * been faded out, which a double-buffered steering table does naturally.
+ *
+ * Coefficients are stored in time reversed order and the state buffer has
+ * the layout of arm_fir_f32(), of length <code>numTaps+blockSize-1</code>.
+ * With no fade running the output matches arm_fir_f32().
+ */
+
+/**
+ * @addtogroup FIR_Xfade
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point crossfading FIR filter.
+ * @param[in,out] S          points to an instance of the floating-point crossfading FIR structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ */
+
+void arm_fir_xfade_f32(
+  arm_fir_xfade_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                /* State pointer */
+  float32_t *pStateCurnt;                       /* Points to the current sample of the state */
+  float32_t *px;                                /* Temporary pointer for state buffer */
+  float32_t *pb, *pc;                           /* Temporary pointers for the two coefficient sets */
+  float32_t acc0, acc1;                         /* Accumulators of the outgoing and incoming sets */
+  float32_t x0;                                 /* Temporary state sample */
+  float32_t g;                                  /* Gain of the incoming set */
+  uint32_t numTaps = S->numTaps;                /* Number of filter coefficients in the filter */
+  uint32_t tapCnt, blkCnt;                      /* loop counters */
+
+  /* S->pState points to state array which contains previous frame (numTaps - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = &(S->pState[(numTaps - 1U)]);
+
+  /* Copy the new input samples into the state buffer */
+  memcpy(pStateCurnt, pSrc, blockSize * sizeof(float32_t));
+
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    px = pState;
+    pb = S->pCoeffs;
+    acc0 = 0.0f;
+
+    if (S->pCoeffsNext == NULL)
+    {
+      /* Single set, loop unrolled by 4 */
+      tapCnt = numTaps >> 2U;
+
+      while (tapCnt > 0U)
+      {
+        acc0 += px[0] * pb[0];
+        acc0 += px[1] * pb[1];
+        acc0 += px[2] * pb[2];
+        acc0 += px[3] * pb[3];
+        px += 4U;
+        pb += 4U;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+      }
+
+      tapCnt = numTaps % 0x4U;
+
+      while (tapCnt > 0U)
+      {
+        acc0 += *px++ * *pb++;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+      }
+
+      *pDst++ = acc0;
+    }
+    else
+    {
+      /* Both sets in one pass over the state */
+      pc = S->pCoeffsNext;
+      acc1 = 0.0f;
+
+      tapCnt = numTaps >> 1U;
+
+      while (tapCnt > 0U)
+      {
+        x0 = *px++;
+        acc0 += x0 * *pb++;
+        acc1 += x0 * *pc++;
+        x0 = *px++;
+        acc0 += x0 * *pb++;
+        acc1 += x0 * *pc++;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+      }
+
+      if ((numTaps & 1U) != 0U)
+      {
+        x0 = *px;
+        acc0 += x0 * *pb;
+        acc1 += x0 * *pc;
+      }
+
+      /* Linear fade from the outgoing to the incoming output */
+      S->fadeCnt++;
+      g = (float32_t) S->fadeCnt * S->fadeStep;
+      *pDst++ = acc0 + g * (acc1 - acc0);
+
+      /* At the end of the fade the incoming set becomes active
+       * and a queued set, if any, starts fading in */
+      if (S->fadeCnt >= S->fadeLen)
+      {
+        S->pCoeffs = S->pCoeffsNext;
+        S->pCoeffsNext = S->pCoeffsPending;
+        S->pCoeffsPending = NULL;
+        S->fadeCnt = 0U;
+      }
+    }
+
+    /* Advance the state pointer by 1 to process the next sample */
+    pState++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+   ** Now copy the last numTaps - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+  memmove(S->pState, pState, (numTaps - 1U) * sizeof(float32_t));
+}
+
+/**
+ * @} end of FIR_Xfade group
+ */
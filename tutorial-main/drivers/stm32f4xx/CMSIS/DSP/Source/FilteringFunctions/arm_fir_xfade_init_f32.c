@@ -0,0 +1,101 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_xfade_init_f32.c
+ * Description:  Floating-point crossfading FIR filter initialization function
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Xfade
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point crossfading FIR filter.
+ * @param[in,out] S          points to an instance of the floating-point crossfading FIR structure.
+ * @param[in]     numTaps    number of filter coefficients in the filter.
+ * @param[in]     pCoeffs    points to the initial coefficient set.
+ * @param[in]     pState     points to the state buffer.
+ * @param[in]     blockSize  largest number of samples processed per call.
+ * @param[in]     fadeLen    length of a crossfade in samples.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or
+ * ARM_MATH_ARGUMENT_ERROR if <code>numTaps</code> is zero.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pCoeffs</code> points to an array of <code>numTaps</code> coefficients
+ * stored in time reversed order.
+ * <code>pState</code> points to an array of <code>numTaps+blockSize-1</code> values.
+ * A <code>fadeLen</code> of zero switches sets at the next sample, without a fade.
+ */
+
+arm_status arm_fir_xfade_init_f32(
+  arm_fir_xfade_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize,
+  uint32_t fadeLen)
+{
+  arm_status status;
+
+  if (numTaps == 0U)
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Assign filter taps and coefficient sets */
+    S->numTaps = numTaps;
+    S->pCoeffs = pCoeffs;
+    S->pCoeffsNext = NULL;
+    S->pCoeffsPending = NULL;
+
+    /* No fade is running */
+    S->fadeLen = fadeLen;
+    S->fadeCnt = 0U;
+    S->fadeStep = (fadeLen > 0U) ? (1.0f / (float32_t) fadeLen) : 1.0f;
+
+    /* Clear state buffer and size is always numTaps + blockSize - 1 */
+    memset(pState, 0, (numTaps + (blockSize - 1U)) * sizeof(float32_t));
+
+    /* Assign state pointer */
+    S->pState = pState;
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of FIR_Xfade group
+ */
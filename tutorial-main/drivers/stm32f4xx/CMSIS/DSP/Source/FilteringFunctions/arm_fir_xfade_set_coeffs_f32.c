@@ -0,0 +1,77 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_xfade_set_coeffs_f32.c
+ * Description:  Floating-point crossfading FIR filter coefficient update function
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Xfade
+ * @{
+ */
+
+/**
+ * @brief  Coefficient update for the floating-point crossfading FIR filter.
+ * @param[in,out] S        points to an instance of the floating-point crossfading FIR structure.
+ * @param[in]     pCoeffs  points to the new coefficient set, numTaps values in time reversed order.
+ * @return none.
+ *
+ * <b>Description:</b>
+ * \par
+ * The new set starts fading in at the next processed sample. If a fade is
+ * already running, the set is queued and fades in when the running fade
+ * ends; it replaces any set queued before. The state is left untouched.
+ */
+
+void arm_fir_xfade_set_coeffs_f32(
+  arm_fir_xfade_instance_f32 * S,
+  float32_t * pCoeffs)
+{
+  if (S->fadeLen == 0U)
+  {
+    /* Switch at once */
+    S->pCoeffs = pCoeffs;
+  }
+  else if (S->pCoeffsNext == NULL)
+  {
+    /* Start a fade */
+    S->pCoeffsNext = pCoeffs;
+    S->fadeCnt = 0U;
+  }
+  else
+  {
+    /* Queue behind the running fade */
+    S->pCoeffsPending = pCoeffs;
+  }
+}
+
+/**
+ * @} end of FIR_Xfade group
+ */
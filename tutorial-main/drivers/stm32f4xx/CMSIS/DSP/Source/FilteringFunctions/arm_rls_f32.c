@@ -0,0 +1,187 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rls_f32.c
+ * Description:  Floating-point RLS filter
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup RLS Recursive Least Squares Filter
+ *
+ * Exponentially weighted recursive least squares (RLS) adaptive filter.
+ *
+ * The RLS filter has the same structure and interface as the LMS filters: an
+ * FIR filter whose coefficients are adapted so that its output follows the
+ * reference input. Instead of a gradient step, every sample solves the
+ * weighted least squares problem over all past samples, using a recursive
+ * update of the inverse input correlation matrix <code>P</code>. The
+ * convergence is therefore independent of the coloring of the input and is
+ * typically reached in about <code>2*numTaps</code> samples, at a cost of
+ * about <code>2*numTaps^2</code> multiply-accumulates per sample. It suits
+ * short filters, long filters are better served by the FDAF.
+ *
+ * \par Algorithm:
+ * With <code>u[n]</code> the vector of the last <code>numTaps</code> inputs:
+ * <pre>
+ *     pi   = P * u[n]
+ *     k    = pi / (lambda + u[n]' * pi)
+ *     e[n] = d[n] - b' * u[n]
+ *     b    = b + k * e[n]
+ *     P    = (P - k * pi') / lambda
+ * </pre>
+ * where <code>lambda</code> is the forgetting factor, typically between
+ * <code>0.99</code> and <code>1</code>. <code>P</code> is kept symmetric by
+ * updating its upper triangle and mirroring it.
+ *
+ * \par
+ * Coefficients and state are stored as for the LMS filters:
+ * <code>pCoeffs</code> holds the coefficients in time reversed order
+ * <code>{b[numTaps-1], ..., b[1], b[0]}</code> and <code>pState</code> is of
+ * length <code>numTaps + blockSize - 1</code>.
+ *
+ * \par Initialization Functions
+ * arm_rls_init_f32() clears the coefficients and the state and sets
+ * <code>P</code> to the identity matrix divided by <code>delta</code>, a
+ * small multiple of the input power.
+ */
+
+/**
+ * @addtogroup RLS
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point RLS filter.
+ * @param[in,out] S          points to an instance of the floating-point RLS filter structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[in]     pRef       points to the block of reference data.
+ * @param[out]    pOut       points to the block of output data.
+ * @param[out]    pErr       points to the block of error data.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ */
+
+void arm_rls_f32(
+  arm_rls_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pRef,
+  float32_t * pOut,
+  float32_t * pErr,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;              /* Coefficient pointer */
+  float32_t *pP = S->pP;                        /* Inverse correlation matrix */
+  float32_t *pPi = S->pScratch;                 /* P * u, then the gain vector */
+  float32_t *pStateCurnt;                       /* Points to the current sample of the state */
+  float32_t *px, *pRow;                         /* Temporary pointers for state and matrix */
+  float32_t invLambda = 1.0f / S->lambda;       /* Inverse of the forgetting factor */
+  uint32_t numTaps = S->numTaps;                /* Number of filter coefficients in the filter */
+  float32_t sum, e, gamma, ki;                  /* Accumulator, error, denominator and gain */
+  uint32_t i, j;                                /* Loop counters */
+  uint32_t blkCnt;                              /* Loop counter */
+
+  /* S->pState points to buffer which contains previous frame (numTaps - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = &(S->pState[(numTaps - 1U)]);
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    /* Copy the new input sample into the state buffer */
+    *pStateCurnt++ = *pSrc++;
+    px = pState;
+
+    /* pi = P * u and gamma = lambda + u' * pi, filter output */
+    gamma = S->lambda;
+    sum = 0.0f;
+    pRow = pP;
+
+    for (i = 0U; i < numTaps; i++)
+    {
+      pPi[i] = 0.0f;
+
+      for (j = 0U; j < numTaps; j++)
+      {
+        pPi[i] += pRow[j] * px[j];
+      }
+
+      gamma += px[i] * pPi[i];
+      sum += pCoeffs[i] * px[i];
+      pRow += numTaps;
+    }
+
+    /* Compute and store output and error */
+    *pOut++ = sum;
+    e = *pRef++ - sum;
+    *pErr++ = e;
+
+    /* Gain vector k = pi / gamma, coefficient update */
+    gamma = 1.0f / gamma;
+
+    for (i = 0U; i < numTaps; i++)
+    {
+      pCoeffs[i] += pPi[i] * gamma * e;
+    }
+
+    /* P = (P - k * pi') / lambda on the upper triangle, mirrored to the lower one */
+    pRow = pP;
+
+    for (i = 0U; i < numTaps; i++)
+    {
+      ki = pPi[i] * gamma;
+
+      for (j = i; j < numTaps; j++)
+      {
+        pRow[j] = (pRow[j] - (ki * pPi[j])) * invLambda;
+        pP[(j * numTaps) + i] = pRow[j];
+      }
+
+      pRow += numTaps;
+    }
+
+    /* Advance state pointer by 1 for the next sample */
+    pState = pState + 1;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Processing is complete. Now copy the last numTaps - 1 samples to the
+     start of the state buffer. This prepares the state buffer for the
+     next function call. */
+  memmove(S->pState, pState, (numTaps - 1U) * sizeof(float32_t));
+}
+
+/**
+ * @} end of RLS group
+ */
@@ -0,0 +1,116 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rls_init_f32.c
+ * Description:  Floating-point RLS filter initialization function
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup RLS
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point RLS filter.
+ * @param[in,out] S          points to an instance of the floating-point RLS filter structure.
+ * @param[in]     numTaps    number of filter coefficients.
+ * @param[in]     pCoeffs    points to the coefficient buffer.
+ * @param[in]     pState     points to the state buffer.
+ * @param[in]     pP         points to the inverse correlation matrix buffer.
+ * @param[in]     pScratch   points to the scratch buffer.
+ * @param[in]     lambda     forgetting factor, <code>0 < lambda <= 1</code>.
+ * @param[in]     delta      regularization, P starts as the identity matrix divided by delta.
+ * @param[in]     blockSize  number of samples to process per call.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or
+ * ARM_MATH_ARGUMENT_ERROR if <code>numTaps</code> is zero or <code>delta</code> is not positive.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pCoeffs</code> points to an array of <code>numTaps</code> values, which is cleared.
+ * <code>pState</code> points to an array of <code>numTaps+blockSize-1</code> values,
+ * <code>pP</code> to an array of <code>numTaps*numTaps</code> values and
+ * <code>pScratch</code> to an array of <code>numTaps</code> values.
+ * \par
+ * A small <code>delta</code>, about a hundredth of the input power, gives the
+ * fastest convergence.
+ */
+
+arm_status arm_rls_init_f32(
+  arm_rls_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  float32_t * pP,
+  float32_t * pScratch,
+  float32_t lambda,
+  float32_t delta,
+  uint32_t blockSize)
+{
+  arm_status status;
+  uint32_t i;
+
+  if ((numTaps == 0U) || (delta <= 0.0f))
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Assign filter taps and forgetting factor */
+    S->numTaps = numTaps;
+    S->lambda = lambda;
+
+    /* Clear coefficient and state buffers */
+    memset(pCoeffs, 0, numTaps * sizeof(float32_t));
+    memset(pState, 0, (numTaps + (blockSize - 1U)) * sizeof(float32_t));
+
+    /* P = I / delta */
+    memset(pP, 0, (uint32_t) numTaps * numTaps * sizeof(float32_t));
+
+    for (i = 0U; i < numTaps; i++)
+    {
+      pP[(i * numTaps) + i] = 1.0f / delta;
+    }
+
+    /* Assign pointers */
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    S->pP = pP;
+    S->pScratch = pScratch;
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of RLS group
+ */
@@ -0,0 +1,127 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_cholesky_f64.c
+ * Description:  Double-precision floating-point Cholesky decomposition
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixChol
+ * @{
+ */
+
+/**
+ * @brief Double-precision floating-point Cholesky decomposition.
+ * @param[in]       *pSrc points to the symmetric positive definite input matrix structure
+ * @param[out]      *pDst points to the lower triangular factor, which can be the same as pSrc
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the matrices are not square and of the same size,
+ * <code>ARM_MATH_DECOMPOSITION_FAILURE</code> if the input matrix is not positive definite and
+ * <code>ARM_MATH_SUCCESS</code> otherwise.
+ */
+
+arm_status arm_mat_cholesky_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pDst)
+{
+  float64_t *pIn = pSrc->pData;                 /* input data matrix pointer */
+  float64_t *pOut = pDst->pData;                /* output data matrix pointer */
+  float64_t *pRowI, *pRowJ;                     /* rows of the factor */
+  float64_t sum;                                /* Accumulator */
+  uint32_t n = pSrc->numRows;                   /* size of the matrix */
+  uint32_t i, j, k;                             /* loop counters */
+  arm_status status;                            /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pSrc->numCols) ||
+     (pDst->numRows != pDst->numCols) || (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    /* The factor is computed column by column. Column j only reads the input on
+     ** and below the diagonal and the columns of the factor already computed,
+     ** so the factor can overwrite the input. */
+    for (j = 0U; j < n; j++)
+    {
+      pRowJ = pOut + j * n;
+
+      for (i = j; i < n; i++)
+      {
+        pRowI = pOut + i * n;
+
+        /* a(i,j) - l(i,0) * l(j,0) - ... - l(i,j-1) * l(j,j-1) */
+        sum = pIn[i * n + j];
+
+        for (k = 0U; k < j; k++)
+        {
+          sum -= pRowI[k] * pRowJ[k];
+        }
+
+        if (i == j)
+        {
+          /* The matrix is not positive definite */
+          if (sum <= 0.0)
+          {
+            return (ARM_MATH_DECOMPOSITION_FAILURE);
+          }
+
+          pRowJ[j] = sqrt(sum);
+        }
+        else
+        {
+          pRowI[j] = sum / pRowJ[j];
+        }
+      }
+
+      /* Clear the upper triangle of the row */
+      for (k = j + 1U; k < n; k++)
+      {
+        pRowJ[k] = 0.0;
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixChol group
+ */
@@ -0,0 +1,108 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_cholesky_solve_f32.c
+ * Description:  Floating-point linear system solve with a Cholesky factor
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixChol
+ * @{
+ */
+
+/**
+ * @brief Solves a linear system with a floating-point Cholesky factor.
+ * @param[in]       *pSrcL points to the lower triangular factor computed by arm_mat_cholesky_f32()
+ * @param[in]       *pSrcB points to the right-hand side matrix structure
+ * @param[out]      *pDst points to the solution matrix structure, which can be the same as pSrcB
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the dimensions do not match,
+ * <code>ARM_MATH_SINGULAR</code> if a diagonal element of the factor is zero and
+ * <code>ARM_MATH_SUCCESS</code> otherwise.
+ *
+ * \par
+ * Solves <code>L * y = b</code> by forward substitution and then
+ * <code>L<sup>T</sup> * x = y</code> by backward substitution, reading
+ * the transpose directly from <code>L</code>.
+ */
+
+arm_status arm_mat_cholesky_solve_f32(
+  const arm_matrix_instance_f32 * pSrcL,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pInL = pSrcL->pData;               /* factor pointer */
+  float32_t *pOut = pDst->pData;                /* solution pointer */
+  float32_t *pRowI, *pRowJ;                     /* rows of the solution */
+  float32_t coeff;                              /* element of the factor */
+  uint32_t n = pSrcL->numRows;                  /* size of the factor */
+  uint32_t numCols = pSrcB->numCols;            /* number of right-hand sides */
+  uint32_t i, j, c;                             /* loop counters */
+  arm_status status;                            /* status of the solve */
+
+  /* L * y = b */
+  status = arm_mat_solve_lower_triangular_f32(pSrcL, pSrcB, pDst);
+
+  if (status == ARM_MATH_SUCCESS)
+  {
+    /* x(i) = (y(i) - l(i+1,i) * x(i+1) - ... - l(n-1,i) * x(n-1)) / l(i,i) */
+    for (i = n; i > 0U; i--)
+    {
+      pRowI = pOut + (i - 1U) * numCols;
+      pRowJ = pRowI + numCols;
+
+      for (j = i; j < n; j++)
+      {
+        coeff = pInL[j * n + (i - 1U)];
+
+        for (c = 0U; c < numCols; c++)
+        {
+          pRowI[c] -= coeff * pRowJ[c];
+        }
+
+        pRowJ += numCols;
+      }
+
+      coeff = pInL[(i - 1U) * n + (i - 1U)];
+
+      for (c = 0U; c < numCols; c++)
+      {
+        pRowI[c] /= coeff;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixChol group
+ */
@@ -0,0 +1,145 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_ldlt_f32.c
+ * Description:  Floating-point LDLT decomposition
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixLDLT LDLT Decomposition
+ *
+ * Computes the decomposition <code>A = L * D * L<sup>T</sup></code> of a symmetric
+ * matrix, with <code>L</code> unit lower triangular and <code>D</code> diagonal,
+ * and solves linear systems with it.
+ *
+ * Unlike the Cholesky decomposition it needs no square roots and also applies to
+ * symmetric matrices that are not positive definite, as long as their leading
+ * principal minors are non-zero. No pivoting is done.
+ *
+ * The result is stored in a single matrix: <code>D</code> on the diagonal and
+ * <code>L</code>, without its unit diagonal, below it. The upper triangle is cleared.
+ * The decomposition only reads the lower triangle of the input and may overwrite it.
+ *
+ * If a pivot is zero, the function returns <code>ARM_MATH_DECOMPOSITION_FAILURE</code>.
+ */
+
+/**
+ * @addtogroup MatrixLDLT
+ * @{
+ */
+
+/**
+ * @brief Floating-point LDLT decomposition.
+ * @param[in]       *pSrc points to the symmetric input matrix structure
+ * @param[out]      *pDst points to the packed factors, which can be the same as pSrc
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the matrices are not square and of the same size,
+ * <code>ARM_MATH_DECOMPOSITION_FAILURE</code> if a pivot is zero and
+ * <code>ARM_MATH_SUCCESS</code> otherwise.
+ */
+
+arm_status arm_mat_ldlt_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pIn = pSrc->pData;                 /* input data matrix pointer */
+  float32_t *pOut = pDst->pData;                /* output data matrix pointer */
+  float32_t *pRowI, *pRowJ;                     /* rows of the factor */
+  float32_t sum;                                /* Accumulator */
+  float32_t pivot;                              /* d(j) */
+  uint32_t n = pSrc->numRows;                   /* size of the matrix */
+  uint32_t i, j, k;                             /* loop counters */
+  arm_status status;                            /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pSrc->numCols) ||
+     (pDst->numRows != pDst->numCols) || (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    /* The factors are computed column by column, so they can overwrite the input */
+    for (j = 0U; j < n; j++)
+    {
+      pRowJ = pOut + j * n;
+
+      /* d(j) = a(j,j) - l(j,0)^2 * d(0) - ... - l(j,j-1)^2 * d(j-1) */
+      pivot = pIn[j * n + j];
+
+      for (k = 0U; k < j; k++)
+      {
+        pivot -= pRowJ[k] * pRowJ[k] * pOut[k * n + k];
+      }
+
+      if (pivot == 0.0f)
+      {
+        return (ARM_MATH_DECOMPOSITION_FAILURE);
+      }
+
+      pRowJ[j] = pivot;
+
+      /* l(i,j) = (a(i,j) - l(i,0) * l(j,0) * d(0) - ... ) / d(j) */
+      for (i = j + 1U; i < n; i++)
+      {
+        pRowI = pOut + i * n;
+        sum = pIn[i * n + j];
+
+        for (k = 0U; k < j; k++)
+        {
+          sum -= pRowI[k] * pRowJ[k] * pOut[k * n + k];
+        }
+
+        pRowI[j] = sum / pivot;
+      }
+
+      /* Clear the upper triangle of the row */
+      for (k = j + 1U; k < n; k++)
+      {
+        pRowJ[k] = 0.0f;
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixLDLT group
+ */
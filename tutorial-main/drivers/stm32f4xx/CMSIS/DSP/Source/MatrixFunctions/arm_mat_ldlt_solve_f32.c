@@ -0,0 +1,147 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_ldlt_solve_f32.c
+ * Description:  Floating-point linear system solve with LDLT factors
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixLDLT
+ * @{
+ */
+
+/**
+ * @brief Solves a linear system with floating-point LDLT factors.
+ * @param[in]       *pSrcLD points to the packed factors computed by arm_mat_ldlt_f32()
+ * @param[in]       *pSrcB points to the right-hand side matrix structure
+ * @param[out]      *pDst points to the solution matrix structure, which can be the same as pSrcB
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the dimensions do not match and
+ * <code>ARM_MATH_SUCCESS</code> otherwise.
+ */
+
+arm_status arm_mat_ldlt_solve_f32(
+  const arm_matrix_instance_f32 * pSrcLD,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pInLD = pSrcLD->pData;             /* factors pointer */
+  float32_t *pIn = pSrcB->pData;                /* right-hand side pointer */
+  float32_t *pOut = pDst->pData;                /* solution pointer */
+  float32_t *pRowI, *pRowJ;                     /* rows of the solution */
+  float32_t coeff;                              /* element of the factors */
+  uint32_t n = pSrcLD->numRows;                 /* size of the factors */
+  uint32_t numCols = pSrcB->numCols;            /* number of right-hand sides */
+  uint32_t i, j, c;                             /* loop counters */
+  arm_status status;                            /* status of the solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcLD->numRows != pSrcLD->numCols) || (pSrcLD->numRows != pSrcB->numRows) ||
+     (pDst->numRows != pSrcB->numRows) || (pDst->numCols != pSrcB->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    /* Start from the right-hand sides unless the solution overwrites them */
+    if (pOut != pIn)
+    {
+      for (i = 0U; i < n * numCols; i++)
+      {
+        pOut[i] = pIn[i];
+      }
+    }
+
+    /* L * z = b, with a unit diagonal */
+    for (i = 0U; i < n; i++)
+    {
+      pRowI = pOut + i * numCols;
+      pRowJ = pOut;
+
+      for (j = 0U; j < i; j++)
+      {
+        coeff = pInLD[i * n + j];
+
+        for (c = 0U; c < numCols; c++)
+        {
+          pRowI[c] -= coeff * pRowJ[c];
+        }
+
+        pRowJ += numCols;
+      }
+    }
+
+    /* y = z / d */
+    for (i = 0U; i < n; i++)
+    {
+      pRowI = pOut + i * numCols;
+      coeff = pInLD[i * n + i];
+
+      for (c = 0U; c < numCols; c++)
+      {
+        pRowI[c] /= coeff;
+      }
+    }
+
+    /* L' * x = y, with a unit diagonal */
+    for (i = n; i > 0U; i--)
+    {
+      pRowI = pOut + (i - 1U) * numCols;
+      pRowJ = pRowI + numCols;
+
+      for (j = i; j < n; j++)
+      {
+        coeff = pInLD[j * n + (i - 1U)];
+
+        for (c = 0U; c < numCols; c++)
+        {
+          pRowI[c] -= coeff * pRowJ[c];
+        }
+
+        pRowJ += numCols;
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixLDLT group
+ */
@@ -0,0 +1,167 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_lu_f32.c
+ * Description:  Floating-point LU decomposition with partial pivoting
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixLU LU Decomposition
+ *
+ * Computes the decomposition <code>P * A = L * U</code> of a square matrix with
+ * partial pivoting, where <code>L</code> is unit lower triangular, <code>U</code> is upper
+ * triangular and <code>P</code> is a permutation, and solves linear systems with it.
+ *
+ * The factors are stored in a single matrix: <code>U</code> on and above the diagonal and
+ * <code>L</code>, without its unit diagonal, below it. The permutation is stored as the
+ * sequence of row exchanges: at step <code>k</code> row <code>k</code> was exchanged with row
+ * <code>pPivots[k]</code>. The decomposition may overwrite its input.
+ *
+ * If the matrix is singular, the function returns <code>ARM_MATH_SINGULAR</code>.
+ */
+
+/**
+ * @addtogroup MatrixLU
+ * @{
+ */
+
+/**
+ * @brief Floating-point LU decomposition with partial pivoting.
+ * @param[in]       *pSrc points to the input matrix structure
+ * @param[out]      *pDst points to the packed factors, which can be the same as pSrc
+ * @param[out]      *pPivots points to the row exchanges, an array of pSrc->numRows values
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the matrices are not square and of the same size,
+ * <code>ARM_MATH_SINGULAR</code> if the matrix is singular and
+ * <code>ARM_MATH_SUCCESS</code> otherwise.
+ */
+
+arm_status arm_mat_lu_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst,
+  uint16_t * pPivots)
+{
+  float32_t *pIn = pSrc->pData;                 /* input data matrix pointer */
+  float32_t *pOut = pDst->pData;                /* output data matrix pointer */
+  float32_t *pRowI, *pRowK;                     /* rows of the factors */
+  float32_t maxVal, absVal;                     /* pivot search */
+  float32_t pivot, factor, tmp;                 /* elimination values */
+  uint32_t n = pSrc->numRows;                   /* size of the matrix */
+  uint32_t i, j, k, p;                          /* loop counters */
+  arm_status status;                            /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pSrc->numCols) ||
+     (pDst->numRows != pDst->numCols) || (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    /* Start from a copy of the input unless it is decomposed in place */
+    if (pOut != pIn)
+    {
+      for (i = 0U; i < n * n; i++)
+      {
+        pOut[i] = pIn[i];
+      }
+    }
+
+    for (k = 0U; k < n; k++)
+    {
+      /* Find the largest element of the column on or below the diagonal */
+      p = k;
+      maxVal = fabsf(pOut[k * n + k]);
+
+      for (i = k + 1U; i < n; i++)
+      {
+        absVal = fabsf(pOut[i * n + k]);
+
+        if (absVal > maxVal)
+        {
+          maxVal = absVal;
+          p = i;
+        }
+      }
+
+      pPivots[k] = (uint16_t) p;
+
+      if (maxVal == 0.0f)
+      {
+        return (ARM_MATH_SINGULAR);
+      }
+
+      pRowK = pOut + k * n;
+
+      /* Exchange the rows so that the pivot is on the diagonal */
+      if (p != k)
+      {
+        pRowI = pOut + p * n;
+
+        for (j = 0U; j < n; j++)
+        {
+          tmp = pRowK[j];
+          pRowK[j] = pRowI[j];
+          pRowI[j] = tmp;
+        }
+      }
+
+      pivot = pRowK[k];
+
+      /* Eliminate the column below the pivot */
+      for (i = k + 1U; i < n; i++)
+      {
+        pRowI = pOut + i * n;
+        factor = pRowI[k] / pivot;
+        pRowI[k] = factor;
+
+        for (j = k + 1U; j < n; j++)
+        {
+          pRowI[j] -= factor * pRowK[j];
+        }
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixLU group
+ */
@@ -46,6 +46,13 @@
  * When matrix size checking is enabled, the functions check: (1) that the inner dimensions of
  * <code>pSrcA</code> and <code>pSrcB</code> are equal; and (2) that the size of the output
  * matrix equals the outer dimensions of <code>pSrcA</code> and <code>pSrcB</code>.
+ *
+ * The floating-point function computes the output in blocks of 4 x 4 values kept in
+ * registers and walks <code>pSrcB</code> in strips of 4 columns. When the same second
+ * matrix is used in many multiplications, as the constant matrices of a Kalman filter are,
+ * it can be packed once with <code>arm_mat_pack_f32()</code> and passed to
+ * <code>arm_mat_mult_packed_f32()</code>, which then reads it contiguously.
+ * Both functions give the same results as a plain dot-product per output value.
  */
 
 
@@ -82,8 +89,16 @@ arm_status arm_mat_mult_f32(
 
   /* Run the below code for Cortex-M4 and Cortex-M3 */
 
-  float32_t in1, in2, in3, in4;
-  uint16_t col, i = 0U, j, row = numRowsA, colCnt;      /* loop counters */
+  float32_t *pInB = pSrcB->pData;                /* input data matrix pointer B */
+  float32_t *pIn3, *pIn4, *pIn5;                 /* pointers to the other rows of the A block */
+  float32_t a0, a1, a2, a3;                      /* A block operands */
+  float32_t b0, b1, b2, b3;                      /* B block operands */
+  float32_t acc00, acc01, acc02, acc03;          /* Accumulators of the first output row */
+  float32_t acc10, acc11, acc12, acc13;          /* Accumulators of the second output row */
+  float32_t acc20, acc21, acc22, acc23;          /* Accumulators of the third output row */
+  float32_t acc30, acc31, acc32, acc33;          /* Accumulators of the fourth output row */
+  uint32_t rowStrideA = 4U * numColsA;           /* distance between two blocks of rows of A */
+  uint16_t col, row, colCnt;                     /* loop counters */
   arm_status status;                             /* status of matrix multiplication */
 
 #ifdef ARM_MATH_MATRIX_CHECK
@@ -101,64 +116,224 @@ arm_status arm_mat_mult_f32(
 #endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
 
   {
-    /* The following loop performs the dot-product of each row in pSrcA with each column in pSrcB */
-    /* row loop */
-    do
+    /* The output is computed in blocks of 4 x 4 values held in registers.
+     ** Each step of the inner loop loads 4 values of A and 4 values of B
+     ** and performs 16 MACs, instead of 2 loads per MAC for a single dot-product.
+     ** The outer loop runs over strips of 4 columns of B so that a strip is
+     ** reused by all the rows of A while it is still in the cache.
+     ** Every output is still accumulated in the natural order, so the results
+     ** are the same as those of a plain dot-product. */
+
+    /* column strip loop */
+    col = numColsB >> 2U;
+
+    while (col > 0U)
     {
-      /* Output pointer is set to starting address of the row being processed */
-      px = pOut + i;
+      /* Start from the first rows of A for every strip of B */
+      pInA = pSrcA->pData;
+      px = pOut;
 
-      /* For every row wise process, the column loop counter is to be initiated */
-      col = numColsB;
+      /* Process the rows of A in blocks of 4 */
+      row = numRowsA >> 2U;
 
-      /* For every row wise process, the pIn2 pointer is set
-       ** to the starting address of the pSrcB data */
-      pIn2 = pSrcB->pData;
+      while (row > 0U)
+      {
+        /* Initialize the pointers to the 4 rows of A and the strip of B */
+        pIn1 = pInA;
+        pIn3 = pIn1 + numColsA;
+        pIn4 = pIn3 + numColsA;
+        pIn5 = pIn4 + numColsA;
+        pIn2 = pInB;
 
-      j = 0U;
+        /* Set the accumulators to zero */
+        acc00 = acc01 = acc02 = acc03 = 0.0f;
+        acc10 = acc11 = acc12 = acc13 = 0.0f;
+        acc20 = acc21 = acc22 = acc23 = 0.0f;
+        acc30 = acc31 = acc32 = acc33 = 0.0f;
 
-      /* column loop */
-      do
-      {
-        /* Set the variable sum, that acts as accumulator, to zero */
-        sum = 0.0f;
+        colCnt = numColsA;
 
-        /* Initiate the pointer pIn1 to point to the starting address of the column being processed */
+        while (colCnt > 0U)
+        {
+          /* Read 4 consecutive values from a row of B */
+          b0 = pIn2[0];
+          b1 = pIn2[1];
+          b2 = pIn2[2];
+          b3 = pIn2[3];
+          pIn2 += numColsB;
+
+          /* Read one value from each row of A */
+          a0 = *pIn1++;
+          a1 = *pIn3++;
+          a2 = *pIn4++;
+          a3 = *pIn5++;
+
+          /* c(m,n) += a(m,k) * b(k,n) for the 4 x 4 block */
+          acc00 += a0 * b0;
+          acc01 += a0 * b1;
+          acc02 += a0 * b2;
+          acc03 += a0 * b3;
+
+          acc10 += a1 * b0;
+          acc11 += a1 * b1;
+          acc12 += a1 * b2;
+          acc13 += a1 * b3;
+
+          acc20 += a2 * b0;
+          acc21 += a2 * b1;
+          acc22 += a2 * b2;
+          acc23 += a2 * b3;
+
+          acc30 += a3 * b0;
+          acc31 += a3 * b1;
+          acc32 += a3 * b2;
+          acc33 += a3 * b3;
+
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        /* Store the 4 x 4 block in the destination buffer */
+        px[0] = acc00;
+        px[1] = acc01;
+        px[2] = acc02;
+        px[3] = acc03;
+        px += numColsB;
+
+        px[0] = acc10;
+        px[1] = acc11;
+        px[2] = acc12;
+        px[3] = acc13;
+        px += numColsB;
+
+        px[0] = acc20;
+        px[1] = acc21;
+        px[2] = acc22;
+        px[3] = acc23;
+        px += numColsB;
+
+        px[0] = acc30;
+        px[1] = acc31;
+        px[2] = acc32;
+        px[3] = acc33;
+        px += numColsB;
+
+        /* Update the pointer pInA to point to the next block of rows */
+        pInA += rowStrideA;
+
+        /* Decrement the row loop counter */
+        row--;
+      }
+
+      /* If the rows of pSrcA is not a multiple of 4, compute the remaining rows here
+       ** against the same strip of B. */
+      row = numRowsA % 0x4U;
+
+      while (row > 0U)
+      {
         pIn1 = pInA;
+        pIn2 = pInB;
 
-        /* Apply loop unrolling and compute 4 MACs simultaneously. */
-        colCnt = numColsA >> 2U;
+        acc00 = acc01 = acc02 = acc03 = 0.0f;
+
+        colCnt = numColsA;
 
-        /* matrix multiplication        */
         while (colCnt > 0U)
         {
-          /* c(m,n) = a(1,1)*b(1,1) + a(1,2) * b(2,1) + .... + a(m,p)*b(p,n) */
-          in3 = *pIn2;
-          pIn2 += numColsB;
-          in1 = pIn1[0];
-          in2 = pIn1[1];
-          sum += in1 * in3;
-          in4 = *pIn2;
-          pIn2 += numColsB;
-          sum += in2 * in4;
+          a0 = *pIn1++;
 
-          in3 = *pIn2;
+          acc00 += a0 * pIn2[0];
+          acc01 += a0 * pIn2[1];
+          acc02 += a0 * pIn2[2];
+          acc03 += a0 * pIn2[3];
           pIn2 += numColsB;
-          in1 = pIn1[2];
-          in2 = pIn1[3];
-          sum += in1 * in3;
-          in4 = *pIn2;
+
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        px[0] = acc00;
+        px[1] = acc01;
+        px[2] = acc02;
+        px[3] = acc03;
+        px += numColsB;
+
+        pInA += numColsA;
+
+        /* Decrement the row loop counter */
+        row--;
+      }
+
+      /* Update the pointers to the next strip of B and of the output */
+      pInB += 4U;
+      pOut += 4U;
+
+      /* Decrement the column loop counter */
+      col--;
+    }
+
+    /* If the columns of pSrcB is not a multiple of 4, compute the remaining columns here.
+     ** The rows of A are still processed in blocks of 4. */
+    col = numColsB % 0x4U;
+
+    while (col > 0U)
+    {
+      pInA = pSrcA->pData;
+      px = pOut;
+
+      row = numRowsA >> 2U;
+
+      while (row > 0U)
+      {
+        pIn1 = pInA;
+        pIn3 = pIn1 + numColsA;
+        pIn4 = pIn3 + numColsA;
+        pIn5 = pIn4 + numColsA;
+        pIn2 = pInB;
+
+        acc00 = acc10 = acc20 = acc30 = 0.0f;
+
+        colCnt = numColsA;
+
+        while (colCnt > 0U)
+        {
+          b0 = *pIn2;
           pIn2 += numColsB;
-          sum += in2 * in4;
-          pIn1 += 4U;
 
-          /* Decrement the loop count */
+          acc00 += *pIn1++ * b0;
+          acc10 += *pIn3++ * b0;
+          acc20 += *pIn4++ * b0;
+          acc30 += *pIn5++ * b0;
+
+          /* Decrement the loop counter */
           colCnt--;
         }
 
-        /* If the columns of pSrcA is not a multiple of 4, compute any remaining MACs here.
-         ** No loop unrolling is used. */
-        colCnt = numColsA % 0x4U;
+        px[0] = acc00;
+        px += numColsB;
+        px[0] = acc10;
+        px += numColsB;
+        px[0] = acc20;
+        px += numColsB;
+        px[0] = acc30;
+        px += numColsB;
+
+        pInA += rowStrideA;
+
+        /* Decrement the row loop counter */
+        row--;
+      }
+
+      row = numRowsA % 0x4U;
+
+      while (row > 0U)
+      {
+        pIn1 = pInA;
+        pIn2 = pInB;
+
+        sum = 0.0f;
+
+        colCnt = numColsA;
 
         while (colCnt > 0U)
         {
@@ -170,25 +345,30 @@ arm_status arm_mat_mult_f32(
           colCnt--;
         }
 
-        /* Store the result in the destination buffer */
-        *px++ = sum;
+        *px = sum;
+        px += numColsB;
 
-        /* Update the pointer pIn2 to point to the  starting address of the next column */
-        j++;
-        pIn2 = pSrcB->pData + j;
+        pInA += numColsA;
 
-        /* Decrement the column loop counter */
-        col--;
+        /* Decrement the row loop counter */
+        row--;
+      }
 
-      } while (col > 0U);
+      /* Update the pointers to the next column of B and of the output */
+      pInB++;
+      pOut++;
+
+      /* Decrement the column loop counter */
+      col--;
+    }
 
 #else
 
   /* Run the below code for Cortex-M0 */
 
-  float32_t *pInB = pSrcB->pData;                /* input data matrix pointer B */
-  uint16_t col, i = 0U, row = numRowsA, colCnt;  /* loop counters */
-  arm_status status;                             /* status of matrix multiplication */
+  float32_t *pInB = pSrcB->pData;               /* input data matrix pointer B */
+  uint16_t col, i = 0U, row = numRowsA, colCnt; /* loop counters */
+  arm_status status;                            /* status of matrix multiplication */
 
 #ifdef ARM_MATH_MATRIX_CHECK
 
@@ -251,8 +431,6 @@ arm_status arm_mat_mult_f32(
 
       } while (col > 0U);
 
-#endif /* #if defined (ARM_MATH_DSP) */
-
       /* Update the pointer pInA to point to the  starting address of the next row */
       i = i + numColsB;
       pInA = pInA + numColsA;
@@ -261,6 +439,9 @@ arm_status arm_mat_mult_f32(
       row--;
 
     } while (row > 0U);
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
     /* Set status as ARM_MATH_SUCCESS */
     status = ARM_MATH_SUCCESS;
   }
@@ -0,0 +1,293 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_packed_f32.c
+ * Description:  Floating-point matrix multiplication with a packed second operand
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixMult
+ * @{
+ */
+
+/**
+ * @brief Stores the first cnt values of an output row computed against a strip of 4 columns.
+ * @param[out]      *px    points to the output row.
+ * @param[in]       c0..c3 output values.
+ * @param[in]       cnt    number of valid columns in the strip.
+ * @return none.
+ */
+static void arm_mat_store_strip_f32(
+  float32_t * px,
+  float32_t c0,
+  float32_t c1,
+  float32_t c2,
+  float32_t c3,
+  uint16_t cnt)
+{
+  px[0] = c0;
+
+  if (cnt > 1U)
+  {
+    px[1] = c1;
+  }
+
+  if (cnt > 2U)
+  {
+    px[2] = c2;
+  }
+
+  if (cnt > 3U)
+  {
+    px[3] = c3;
+  }
+}
+
+/**
+ * @brief Floating-point matrix multiplication with a packed second operand.
+ * @param[in]       *pSrcA points to the first input matrix structure
+ * @param[in]       *pSrcB points to the second input matrix packed by arm_mat_pack_f32()
+ * @param[out]      *pDst points to output matrix structure
+ * @return     		The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * \par
+ * The result is the same as that of <code>arm_mat_mult_f32()</code> with the unpacked matrix.
+ * Each strip of 4 columns of <code>pSrcB</code> is read contiguously and is reused by all the
+ * rows of <code>pSrcA</code> before moving to the next strip.
+ */
+
+arm_status arm_mat_mult_packed_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_packed_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pIn1;                              /* input data matrix pointer A */
+  float32_t *pIn2;                              /* packed data pointer B */
+  float32_t *pInA;                              /* start of the current rows of A */
+  float32_t *pInB = pSrcB->pData;               /* start of the current strip of B */
+  float32_t *pOut = pDst->pData;                /* output data matrix pointer */
+  float32_t *px;                                /* Temporary output data matrix pointer */
+  float32_t a0;                                 /* A operand */
+  float32_t b0, b1, b2, b3;                     /* B strip operands */
+  float32_t acc00, acc01, acc02, acc03;         /* Accumulators of the first output row */
+  uint16_t numRowsA = pSrcA->numRows;           /* number of rows of input matrix A */
+  uint16_t numColsB = pSrcB->numCols;           /* number of columns of input matrix B */
+  uint16_t numColsA = pSrcA->numCols;           /* number of columns of input matrix A */
+  uint32_t stripSize = 4U * pSrcB->numRows;     /* number of values in a packed strip */
+  uint16_t col, row, colCnt, cnt;               /* loop counters */
+  arm_status status;                            /* status of matrix multiplication */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  float32_t *pIn3, *pIn4, *pIn5;                /* pointers to the other rows of the A block */
+  float32_t a1, a2, a3;                         /* A block operands */
+  float32_t acc10, acc11, acc12, acc13;         /* Accumulators of the second output row */
+  float32_t acc20, acc21, acc22, acc23;         /* Accumulators of the third output row */
+  float32_t acc30, acc31, acc32, acc33;         /* Accumulators of the fourth output row */
+  uint32_t rowStrideA = 4U * numColsA;          /* distance between two blocks of rows of A */
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    /* column strip loop */
+    col = numColsB;
+
+    while (col > 0U)
+    {
+      /* Number of valid columns in this strip */
+      cnt = (col < 4U) ? col : 4U;
+
+      /* Start from the first rows of A for every strip of B */
+      pInA = pSrcA->pData;
+      px = pOut;
+
+#if defined (ARM_MATH_DSP)
+
+      /* Process the rows of A in blocks of 4 */
+      row = numRowsA >> 2U;
+
+      while (row > 0U)
+      {
+        /* Initialize the pointers to the 4 rows of A and the strip of B */
+        pIn1 = pInA;
+        pIn3 = pIn1 + numColsA;
+        pIn4 = pIn3 + numColsA;
+        pIn5 = pIn4 + numColsA;
+        pIn2 = pInB;
+
+        /* Set the accumulators to zero */
+        acc00 = acc01 = acc02 = acc03 = 0.0f;
+        acc10 = acc11 = acc12 = acc13 = 0.0f;
+        acc20 = acc21 = acc22 = acc23 = 0.0f;
+        acc30 = acc31 = acc32 = acc33 = 0.0f;
+
+        colCnt = numColsA;
+
+        while (colCnt > 0U)
+        {
+          /* Read the next 4 values of the strip */
+          b0 = pIn2[0];
+          b1 = pIn2[1];
+          b2 = pIn2[2];
+          b3 = pIn2[3];
+          pIn2 += 4U;
+
+          /* Read one value from each row of A */
+          a0 = *pIn1++;
+          a1 = *pIn3++;
+          a2 = *pIn4++;
+          a3 = *pIn5++;
+
+          /* c(m,n) += a(m,k) * b(k,n) for the 4 x 4 block */
+          acc00 += a0 * b0;
+          acc01 += a0 * b1;
+          acc02 += a0 * b2;
+          acc03 += a0 * b3;
+
+          acc10 += a1 * b0;
+          acc11 += a1 * b1;
+          acc12 += a1 * b2;
+          acc13 += a1 * b3;
+
+          acc20 += a2 * b0;
+          acc21 += a2 * b1;
+          acc22 += a2 * b2;
+          acc23 += a2 * b3;
+
+          acc30 += a3 * b0;
+          acc31 += a3 * b1;
+          acc32 += a3 * b2;
+          acc33 += a3 * b3;
+
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        /* Store the valid columns of the 4 x 4 block */
+        arm_mat_store_strip_f32(px, acc00, acc01, acc02, acc03, cnt);
+        px += numColsB;
+        arm_mat_store_strip_f32(px, acc10, acc11, acc12, acc13, cnt);
+        px += numColsB;
+        arm_mat_store_strip_f32(px, acc20, acc21, acc22, acc23, cnt);
+        px += numColsB;
+        arm_mat_store_strip_f32(px, acc30, acc31, acc32, acc33, cnt);
+        px += numColsB;
+
+        /* Update the pointer pInA to point to the next block of rows */
+        pInA += rowStrideA;
+
+        /* Decrement the row loop counter */
+        row--;
+      }
+
+      /* If the rows of pSrcA is not a multiple of 4, compute the remaining rows here */
+      row = numRowsA % 0x4U;
+
+#else
+
+      /* Run the below code for Cortex-M0 */
+
+      /* All the rows of A are processed one at a time */
+      row = numRowsA;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+      while (row > 0U)
+      {
+        pIn1 = pInA;
+        pIn2 = pInB;
+
+        acc00 = acc01 = acc02 = acc03 = 0.0f;
+
+        colCnt = numColsA;
+
+        while (colCnt > 0U)
+        {
+          b0 = pIn2[0];
+          b1 = pIn2[1];
+          b2 = pIn2[2];
+          b3 = pIn2[3];
+          pIn2 += 4U;
+
+          a0 = *pIn1++;
+
+          acc00 += a0 * b0;
+          acc01 += a0 * b1;
+          acc02 += a0 * b2;
+          acc03 += a0 * b3;
+
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        arm_mat_store_strip_f32(px, acc00, acc01, acc02, acc03, cnt);
+        px += numColsB;
+
+        pInA += numColsA;
+
+        /* Decrement the row loop counter */
+        row--;
+      }
+
+      /* Update the pointers to the next strip of B and of the output */
+      pInB += stripSize;
+      pOut += cnt;
+
+      /* Decrement the column loop counter */
+      col -= cnt;
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixMult group
+ */
@@ -0,0 +1,108 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_pack_f32.c
+ * Description:  Packs a floating-point matrix for matrix multiplication
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixMult
+ * @{
+ */
+
+/**
+ * @brief Packs a floating-point matrix for use as the second operand of arm_mat_mult_packed_f32().
+ * @param[out]      *S     points to an instance of the packed matrix structure.
+ * @param[in]       *pSrc  points to the matrix to pack.
+ * @param[out]      *pData points to the packed data array of <code>pSrc->numRows * ARM_MAT_PACKED_COLS(pSrc->numCols)</code> values.
+ * @return none.
+ *
+ * \par
+ * The columns of the matrix are split into strips of 4 and each strip is stored
+ * row after row, so that the multiplication reads it with unit stride.
+ * The last strip is padded with zeros when the number of columns is not a multiple of 4.
+ * A matrix that is used in many multiplications only needs to be packed once,
+ * and packed again only when its values change.
+ */
+
+void arm_mat_pack_f32(
+  arm_matrix_packed_instance_f32 * S,
+  const arm_matrix_instance_f32 * pSrc,
+  float32_t * pData)
+{
+  float32_t *pIn;                               /* input data matrix pointer */
+  float32_t *pInB = pSrc->pData;                /* start of the current strip */
+  float32_t *pOut = pData;                      /* packed data pointer */
+  uint16_t numRows = pSrc->numRows;             /* number of rows of the matrix */
+  uint16_t numCols = pSrc->numCols;             /* number of columns of the matrix */
+  uint16_t col, row, cnt;                       /* loop counters */
+
+  /* Assign the dimensions of the original matrix and the packed data */
+  S->numRows = numRows;
+  S->numCols = numCols;
+  S->pData = pData;
+
+  /* Strip loop */
+  col = numCols;
+
+  while (col > 0U)
+  {
+    /* Number of valid columns in this strip */
+    cnt = (col < 4U) ? col : 4U;
+
+    pIn = pInB;
+    row = numRows;
+
+    while (row > 0U)
+    {
+      /* Copy the valid columns and pad the strip to 4 values */
+      pOut[0] = pIn[0];
+      pOut[1] = (cnt > 1U) ? pIn[1] : 0.0f;
+      pOut[2] = (cnt > 2U) ? pIn[2] : 0.0f;
+      pOut[3] = (cnt > 3U) ? pIn[3] : 0.0f;
+
+      pOut += 4U;
+      pIn += numCols;
+
+      /* Decrement the row loop counter */
+      row--;
+    }
+
+    /* Update the pointer to the next strip */
+    pInB += cnt;
+
+    /* Decrement the column loop counter */
+    col -= cnt;
+  }
+}
+
+/**
+ * @} end of MatrixMult group
+ */
@@ -0,0 +1,151 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_qr_f64.c
+ * Description:  Double-precision floating-point QR decomposition
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixQR
+ * @{
+ */
+
+/**
+ * @brief Double-precision floating-point QR decomposition.
+ * @param[in]       *pSrc points to the input matrix structure with numRows >= numCols
+ * @param[out]      *pDst points to the packed factors, which can be the same as pSrc
+ * @param[out]      *pTau points to the reflection factors, an array of pSrc->numCols values
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the input has fewer rows than columns or
+ * if the output does not have the size of the input, and
+ * <code>ARM_MATH_SUCCESS</code> otherwise.
+ */
+
+arm_status arm_mat_qr_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pDst,
+  float64_t * pTau)
+{
+  float64_t *pIn = pSrc->pData;                 /* input data matrix pointer */
+  float64_t *pOut = pDst->pData;                /* output data matrix pointer */
+  float64_t norm, alpha, beta, tau, w;          /* reflection values */
+  uint32_t numRows = pSrc->numRows;             /* number of rows of the matrix */
+  uint32_t n = pSrc->numCols;                   /* number of columns of the matrix */
+  uint32_t i, j, k;                             /* loop counters */
+  arm_status status;                            /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows < pSrc->numCols) ||
+     (pDst->numRows != pSrc->numRows) || (pDst->numCols != pSrc->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    /* Start from a copy of the input unless it is decomposed in place */
+    if (pOut != pIn)
+    {
+      for (i = 0U; i < numRows * n; i++)
+      {
+        pOut[i] = pIn[i];
+      }
+    }
+
+    for (k = 0U; k < n; k++)
+    {
+      /* Norm of the column on and below the diagonal */
+      norm = 0.0;
+
+      for (i = k; i < numRows; i++)
+      {
+        norm += pOut[i * n + k] * pOut[i * n + k];
+      }
+
+      norm = sqrt(norm);
+
+      /* Nothing to reflect */
+      if (norm == 0.0)
+      {
+        pTau[k] = 0.0;
+        continue;
+      }
+
+      /* The reflection maps the column to (beta, 0, ..., 0), with the sign of
+       ** beta chosen to avoid cancellation in alpha - beta */
+      alpha = pOut[k * n + k];
+      beta = (alpha > 0.0) ? -norm : norm;
+      tau = (beta - alpha) / beta;
+      w = alpha - beta;
+
+      /* Scale the vector so that its leading element is one */
+      for (i = k + 1U; i < numRows; i++)
+      {
+        pOut[i * n + k] /= w;
+      }
+
+      pOut[k * n + k] = beta;
+      pTau[k] = tau;
+
+      /* Apply I - tau * v * v' to the remaining columns */
+      for (j = k + 1U; j < n; j++)
+      {
+        w = pOut[k * n + j];
+
+        for (i = k + 1U; i < numRows; i++)
+        {
+          w += pOut[i * n + k] * pOut[i * n + j];
+        }
+
+        w *= tau;
+        pOut[k * n + j] -= w;
+
+        for (i = k + 1U; i < numRows; i++)
+        {
+          pOut[i * n + j] -= w * pOut[i * n + k];
+        }
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixQR group
+ */
@@ -0,0 +1,129 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_qr_solve_f32.c
+ * Description:  Floating-point least-squares solve with QR factors
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixQR
+ * @{
+ */
+
+/**
+ * @brief Solves a linear least-squares problem with floating-point QR factors.
+ * @param[in]       *pSrcQR points to the packed factors computed by arm_mat_qr_f32()
+ * @param[in]       *pTau points to the reflection factors computed by arm_mat_qr_f32()
+ * @param[in,out]   *pSrcB points to the right-hand side matrix structure, which is overwritten by Q' * b
+ * @param[out]      *pDst points to the solution matrix structure, which can be the same as pSrcB
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the dimensions do not match,
+ * <code>ARM_MATH_SINGULAR</code> if R has a zero diagonal element and
+ * <code>ARM_MATH_SUCCESS</code> otherwise.
+ *
+ * \par
+ * <code>pSrcB</code> has as many rows as the factored matrix and <code>pDst</code> as many
+ * rows as it has columns. When <code>pDst</code> uses the data of <code>pSrcB</code>, the
+ * solution is stored in its first rows.
+ */
+
+arm_status arm_mat_qr_solve_f32(
+  const arm_matrix_instance_f32 * pSrcQR,
+  const float32_t * pTau,
+  arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  arm_matrix_instance_f32 matR;                 /* upper square part of the factors */
+  arm_matrix_instance_f32 matQtB;               /* upper rows of Q' * b */
+  float32_t *pInQR = pSrcQR->pData;             /* factors pointer */
+  float32_t *pOut = pSrcB->pData;               /* right-hand side pointer */
+  float32_t w;                                  /* projection on a reflection vector */
+  uint32_t numRows = pSrcQR->numRows;           /* number of rows of the factors */
+  uint32_t n = pSrcQR->numCols;                 /* number of columns of the factors */
+  uint32_t numCols = pSrcB->numCols;            /* number of right-hand sides */
+  uint32_t i, k, c;                             /* loop counters */
+  arm_status status;                            /* status of the solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcB->numRows != numRows) ||
+     (pDst->numRows != n) || (pDst->numCols != numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    /* b = H(n-1) * ... * H(0) * b */
+    for (k = 0U; k < n; k++)
+    {
+      for (c = 0U; c < numCols; c++)
+      {
+        w = pOut[k * numCols + c];
+
+        for (i = k + 1U; i < numRows; i++)
+        {
+          w += pInQR[i * n + k] * pOut[i * numCols + c];
+        }
+
+        w *= pTau[k];
+        pOut[k * numCols + c] -= w;
+
+        for (i = k + 1U; i < numRows; i++)
+        {
+          pOut[i * numCols + c] -= w * pInQR[i * n + k];
+        }
+      }
+    }
+
+    /* R is the upper square part of the factors and the first rows of Q' * b
+     ** are the first values of its data */
+    matR.numRows = (uint16_t) n;
+    matR.numCols = (uint16_t) n;
+    matR.pData = pInQR;
+
+    matQtB.numRows = (uint16_t) n;
+    matQtB.numCols = (uint16_t) numCols;
+    matQtB.pData = pOut;
+
+    /* R * x = Q' * b */
+    status = arm_mat_solve_upper_triangular_f32(&matR, &matQtB, pDst);
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixQR group
+ */
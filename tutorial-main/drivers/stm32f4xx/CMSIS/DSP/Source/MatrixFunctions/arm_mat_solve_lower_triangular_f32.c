@@ -0,0 +1,145 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_solve_lower_triangular_f32.c
+ * Description:  Floating-point lower triangular solve
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixTriangularSolve Triangular Solve
+ *
+ * Solves <code>T * X = B</code> for <code>X</code> when <code>T</code> is a lower or
+ * upper triangular matrix, by forward or backward substitution.
+ * <code>B</code> may have several columns, each of them being a right-hand side.
+ *
+ * Only the triangle of <code>T</code> named by the function is read, so the factors
+ * produced by the decomposition functions can be used directly.
+ * The output matrix may be the same as <code>B</code>, in which case the
+ * right-hand sides are replaced by the solution.
+ *
+ * If a diagonal element of <code>T</code> is zero, the functions return
+ * <code>ARM_MATH_SINGULAR</code>.
+ */
+
+/**
+ * @addtogroup MatrixTriangularSolve
+ * @{
+ */
+
+/**
+ * @brief Floating-point lower triangular solve.
+ * @param[in]       *pSrcA points to the lower triangular matrix structure
+ * @param[in]       *pSrcB points to the right-hand side matrix structure
+ * @param[out]      *pDst points to the solution matrix structure, which can be the same as pSrcB
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the dimensions do not match,
+ * <code>ARM_MATH_SINGULAR</code> if a diagonal element is zero and
+ * <code>ARM_MATH_SUCCESS</code> otherwise.
+ */
+
+arm_status arm_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pInA = pSrcA->pData;               /* triangular matrix pointer */
+  float32_t *pIn = pSrcB->pData;                /* right-hand side pointer */
+  float32_t *pOut = pDst->pData;                /* solution pointer */
+  float32_t *pRowI, *pRowJ;                     /* rows of the solution */
+  float32_t coeff;                              /* element of the triangular matrix */
+  uint32_t n = pSrcA->numRows;                  /* size of the triangular matrix */
+  uint32_t numCols = pSrcB->numCols;            /* number of right-hand sides */
+  uint32_t i, j, c;                             /* loop counters */
+  arm_status status;                            /* status of the solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numRows != pSrcA->numCols) || (pSrcA->numRows != pSrcB->numRows) ||
+     (pDst->numRows != pSrcB->numRows) || (pDst->numCols != pSrcB->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    /* Start from the right-hand sides unless the solution overwrites them */
+    if (pOut != pIn)
+    {
+      for (i = 0U; i < n * numCols; i++)
+      {
+        pOut[i] = pIn[i];
+      }
+    }
+
+    /* x(i) = (b(i) - t(i,0) * x(0) - ... - t(i,i-1) * x(i-1)) / t(i,i) */
+    for (i = 0U; i < n; i++)
+    {
+      pRowI = pOut + i * numCols;
+      pRowJ = pOut;
+
+      for (j = 0U; j < i; j++)
+      {
+        coeff = pInA[i * n + j];
+
+        for (c = 0U; c < numCols; c++)
+        {
+          pRowI[c] -= coeff * pRowJ[c];
+        }
+
+        pRowJ += numCols;
+      }
+
+      coeff = pInA[i * n + i];
+
+      if (coeff == 0.0f)
+      {
+        return (ARM_MATH_SINGULAR);
+      }
+
+      for (c = 0U; c < numCols; c++)
+      {
+        pRowI[c] /= coeff;
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixTriangularSolve group
+ */
@@ -0,0 +1,99 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mov_minmax_init_q15.c
+ * Description:  Q15 moving minimum and maximum initialization function
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup MovMinMax
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 moving minimum and maximum.
+ * @param[in,out] S       points to an instance of the Q15 moving minimum and maximum structure.
+ * @param[in]     winLen  number of samples in the window.
+ * @param[in]     pState  points to the queue value buffer.
+ * @param[in]     pIndex  points to the queue position buffer.
+ * @return The function returns ARM_MATH_SUCCESS if initialization was successful or
+ * ARM_MATH_ARGUMENT_ERROR if <code>winLen</code> is 0.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pState</code> points to an array of <code>2*winLen</code> samples and
+ * <code>pIndex</code> to an array of <code>2*winLen</code> stream positions,
+ * the first half for the minimum queue and the second half for the maximum
+ * queue. The window initially holds zeros.
+ */
+
+arm_status arm_mov_minmax_init_q15(
+  arm_mov_minmax_instance_q15 * S,
+  uint16_t winLen,
+  q15_t * pState,
+  uint32_t * pIndex)
+{
+  arm_status status;
+
+  if (winLen == 0U)
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Assign window length and buffers */
+    S->winLen = winLen;
+    S->pState = pState;
+    S->pIndex = pIndex;
+
+    /* The most recent of the initial zeros dominates the others */
+    pState[0] = 0;
+    pState[winLen] = 0;
+    pIndex[0] = (uint32_t) winLen - 1U;
+    pIndex[winLen] = (uint32_t) winLen - 1U;
+
+    S->minHead = 0U;
+    S->minLen = 1U;
+    S->maxHead = 0U;
+    S->maxLen = 1U;
+
+    /* Stream position of the first sample */
+    S->count = winLen;
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of MovMinMax group
+ */
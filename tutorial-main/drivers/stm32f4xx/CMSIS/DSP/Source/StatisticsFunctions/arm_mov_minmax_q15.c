@@ -0,0 +1,149 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mov_minmax_q15.c
+ * Description:  Q15 moving window minimum and maximum
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup MovMinMax
+ * @{
+ */
+
+/**
+ * @brief  Moving window minimum and maximum of Q15 data.
+ * @param[in,out] S          points to an instance of the Q15 moving minimum and maximum structure.
+ * @param[in]     pSrc       points to the block of input samples.
+ * @param[out]    pMin       points to the block of window minima.
+ * @param[out]    pMax       points to the block of window maxima.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ */
+
+void arm_mov_minmax_q15(
+  arm_mov_minmax_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pMin,
+  q15_t * pMax,
+  uint32_t blockSize)
+{
+  q15_t *pMinVal = S->pState;                   /* Values in the minimum queue */
+  q15_t *pMaxVal = S->pState + S->winLen;       /* Values in the maximum queue */
+  uint32_t *pMinIdx = S->pIndex;                /* Stream positions in the minimum queue */
+  uint32_t *pMaxIdx = S->pIndex + S->winLen;    /* Stream positions in the maximum queue */
+  uint32_t winLen = S->winLen;                  /* Window length and queue capacity */
+  uint32_t count = S->count;                    /* Stream position of the current sample */
+  uint32_t minHead = S->minHead, minLen = S->minLen;  /* Minimum queue front and length */
+  uint32_t maxHead = S->maxHead, maxLen = S->maxLen;  /* Maximum queue front and length */
+  uint32_t back;                                /* Back of a queue */
+  q15_t in;                                     /* Temporary variable */
+  uint32_t blkCnt;                              /* loop counter */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    /* Remove the fronts that leave the window */
+    if ((minLen > 0U) && ((count - pMinIdx[minHead]) >= winLen))
+    {
+      minHead = (minHead + 1U == winLen) ? 0U : (minHead + 1U);
+      minLen--;
+    }
+
+    if ((maxLen > 0U) && ((count - pMaxIdx[maxHead]) >= winLen))
+    {
+      maxHead = (maxHead + 1U == winLen) ? 0U : (maxHead + 1U);
+      maxLen--;
+    }
+
+    /* Remove the samples the new one dominates */
+    while (minLen > 0U)
+    {
+      back = minHead + minLen - 1U;
+      back = (back >= winLen) ? (back - winLen) : back;
+
+      if (pMinVal[back] < in)
+      {
+        break;
+      }
+
+      minLen--;
+    }
+
+    while (maxLen > 0U)
+    {
+      back = maxHead + maxLen - 1U;
+      back = (back >= winLen) ? (back - winLen) : back;
+
+      if (pMaxVal[back] > in)
+      {
+        break;
+      }
+
+      maxLen--;
+    }
+
+    /* Append the new sample */
+    back = minHead + minLen;
+    back = (back >= winLen) ? (back - winLen) : back;
+    pMinVal[back] = in;
+    pMinIdx[back] = count;
+    minLen++;
+
+    back = maxHead + maxLen;
+    back = (back >= winLen) ? (back - winLen) : back;
+    pMaxVal[back] = in;
+    pMaxIdx[back] = count;
+    maxLen++;
+
+    /* The fronts are the extremes of the window */
+    *pMin++ = pMinVal[minHead];
+    *pMax++ = pMaxVal[maxHead];
+
+    count++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Save the queues for the next call */
+  S->count = count;
+  S->minHead = (uint16_t) minHead;
+  S->minLen = (uint16_t) minLen;
+  S->maxHead = (uint16_t) maxHead;
+  S->maxLen = (uint16_t) maxLen;
+}
+
+/**
+ * @} end of MovMinMax group
+ */
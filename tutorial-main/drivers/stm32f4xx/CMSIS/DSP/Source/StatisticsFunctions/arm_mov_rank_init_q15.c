@@ -0,0 +1,105 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mov_rank_init_q15.c
+ * Description:  Q15 moving rank filter initialization function
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup MovRank
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 moving rank filter.
+ * @param[in,out] S       points to an instance of the Q15 moving rank filter structure.
+ * @param[in]     winLen  number of samples in the window.
+ * @param[in]     rank    rank of the output within the window, 0 for the smallest sample.
+ * @param[in]     pState  points to the state buffer.
+ * @param[in]     pIndex  points to the heap index buffer.
+ * @return The function returns ARM_MATH_SUCCESS if initialization was successful or
+ * ARM_MATH_ARGUMENT_ERROR if <code>winLen</code> is 0 or <code>rank</code> is
+ * not smaller than <code>winLen</code>.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pState</code> points to an array of <code>winLen</code> samples that
+ * holds the history and <code>pIndex</code> to an array of
+ * <code>2*winLen</code> halfwords that holds the heaps. The window initially
+ * holds zeros.
+ */
+
+arm_status arm_mov_rank_init_q15(
+  arm_mov_rank_instance_q15 * S,
+  uint16_t winLen,
+  uint16_t rank,
+  q15_t * pState,
+  uint16_t * pIndex)
+{
+  arm_status status;
+  uint32_t i;
+
+  if ((winLen == 0U) || (rank >= winLen))
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Assign window length and rank */
+    S->winLen = winLen;
+    S->rank = rank;
+
+    /* Clear state buffer, the window holds zeros */
+    memset(pState, 0, winLen * sizeof(q15_t));
+
+    /* Assign buffer pointers */
+    S->pState = pState;
+    S->pHeap = pIndex;
+    S->pPos = pIndex + winLen;
+
+    /* Equal samples form valid heaps in any order */
+    for (i = 0U; i < winLen; i++)
+    {
+      S->pHeap[i] = (uint16_t) i;
+      S->pPos[i] = (uint16_t) i;
+    }
+
+    S->slot = 0U;
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of MovRank group
+ */
@@ -0,0 +1,184 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mov_rank_q15.c
+ * Description:  Q15 moving window rank filter
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @brief  Exchanges two heap entries and updates their positions.
+ */
+static void arm_mov_rank_swap_q15(
+  arm_mov_rank_instance_q15 * S,
+  uint32_t a,
+  uint32_t b)
+{
+  uint16_t slot = S->pHeap[a];
+
+  S->pHeap[a] = S->pHeap[b];
+  S->pHeap[b] = slot;
+  S->pPos[S->pHeap[a]] = (uint16_t) a;
+  S->pPos[S->pHeap[b]] = (uint16_t) b;
+}
+
+/**
+ * @brief  Compares two heap entries, true if the entry at a belongs above the
+ * entry at b. The heap of the smallest samples is a max-heap.
+ */
+static int32_t arm_mov_rank_above_q15(
+  const arm_mov_rank_instance_q15 * S,
+  uint32_t a,
+  uint32_t b,
+  uint32_t isLow)
+{
+  q15_t va = S->pState[S->pHeap[a]];
+  q15_t vb = S->pState[S->pHeap[b]];
+
+  return (isLow ? (va > vb) : (va < vb));
+}
+
+/**
+ * @brief  Restores a heap after the value of the entry at position pos changed.
+ * The heap occupies positions base to base + size - 1.
+ */
+static void arm_mov_rank_sift_q15(
+  arm_mov_rank_instance_q15 * S,
+  uint32_t base,
+  uint32_t size,
+  uint32_t pos,
+  uint32_t isLow)
+{
+  uint32_t i = pos - base;                      /* Position within the heap */
+  uint32_t parent, child;                       /* Neighbouring positions */
+
+  /* Sift up */
+  while (i > 0U)
+  {
+    parent = (i - 1U) >> 1U;
+
+    if (!arm_mov_rank_above_q15(S, base + i, base + parent, isLow))
+    {
+      break;
+    }
+
+    arm_mov_rank_swap_q15(S, base + i, base + parent);
+    i = parent;
+  }
+
+  /* Sift down */
+  while ((child = 2U * i + 1U) < size)
+  {
+    if ((child + 1U < size) && arm_mov_rank_above_q15(S, base + child + 1U, base + child, isLow))
+    {
+      child++;
+    }
+
+    if (!arm_mov_rank_above_q15(S, base + child, base + i, isLow))
+    {
+      break;
+    }
+
+    arm_mov_rank_swap_q15(S, base + i, base + child);
+    i = child;
+  }
+}
+
+/**
+ * @addtogroup MovRank
+ * @{
+ */
+
+/**
+ * @brief  Moving window rank filter for Q15 data.
+ * @param[in,out] S          points to an instance of the Q15 moving rank filter structure.
+ * @param[in]     pSrc       points to the block of input samples.
+ * @param[out]    pDst       points to the block of output samples.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ */
+
+void arm_mov_rank_q15(
+  arm_mov_rank_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t winLen = S->winLen;                  /* Window length */
+  uint32_t lowLen = S->rank + 1U;               /* Size of the heap of the smallest samples */
+  uint32_t highLen = winLen - lowLen;           /* Size of the heap of the largest samples */
+  uint32_t slot = S->slot;                      /* Oldest sample in the history */
+  uint32_t pos;                                 /* Heap position of the oldest sample */
+  uint32_t blkCnt;                              /* loop counter */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    /* Replace the oldest sample in its heap */
+    S->pState[slot] = *pSrc++;
+    pos = S->pPos[slot];
+
+    if (pos < lowLen)
+    {
+      arm_mov_rank_sift_q15(S, 0U, lowLen, pos, 1U);
+    }
+    else
+    {
+      arm_mov_rank_sift_q15(S, lowLen, highLen, pos, 0U);
+    }
+
+    /* Exchange the tops if they are out of order */
+    if ((highLen > 0U) && (S->pState[S->pHeap[0]] > S->pState[S->pHeap[lowLen]]))
+    {
+      arm_mov_rank_swap_q15(S, 0U, lowLen);
+      arm_mov_rank_sift_q15(S, 0U, lowLen, 0U, 1U);
+      arm_mov_rank_sift_q15(S, lowLen, highLen, lowLen, 0U);
+    }
+
+    *pDst++ = S->pState[S->pHeap[0]];
+
+    slot++;
+
+    if (slot == winLen)
+    {
+      slot = 0U;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  S->slot = (uint16_t) slot;
+}
+
+/**
+ * @} end of MovRank group
+ */
@@ -0,0 +1,201 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mov_stats_f32.c
+ * Description:  Floating-point moving window mean and variance
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup MovStats Moving Window Mean and Variance
+ *
+ * Computes the mean and variance of the last <code>winLen</code> samples for
+ * every new input sample:
+ * <pre>
+ *     pMean[n] = sum(x[n-k], k = 0..winLen-1) / winLen
+ *     pVar[n]  = sum((x[n-k] - pMean[n])^2, k = 0..winLen-1) / (winLen - 1)
+ * </pre>
+ * Calling arm_mean_f32() and arm_var_f32() on the window for every sample
+ * costs <code>O(winLen)</code> per sample. The moving window functions keep
+ * running values and update them with the sample entering and the sample
+ * leaving the window, which costs <code>O(1)</code> per sample.
+ *
+ * The history of the last <code>winLen</code> samples is kept in a state
+ * buffer that the init function clears, as for the FIR filters: the first
+ * <code>winLen - 1</code> outputs include the initial zeros.
+ *
+ * The variance is normalized by <code>winLen - 1</code> as in arm_var_f32().
+ * A window of length 1 has a variance of 0.
+ *
+ * \par Instance Structure
+ * The history and the running values are stored in an instance structure.
+ * A separate instance structure must be defined for each window and can be
+ * shared by no other data stream.
+ *
+ * \par Fixed-Point Behavior
+ * The Q15 version keeps the running sum and sum of squares in integers, so it
+ * never drifts. Its outputs are bit exact with arm_mean_q15() and
+ * arm_var_q15() applied to the window.
+ */
+
+/**
+ * @brief  Mean and sum of squared deviations of the history, in two passes.
+ */
+static float32_t arm_mov_stats_renorm_f32(
+  const float32_t * pState,
+  uint32_t winLen,
+  float32_t invLen,
+  float32_t * pM2)
+{
+  float32_t mean = 0.0f, m2 = 0.0f, d;
+  uint32_t i;
+
+  for (i = 0U; i < winLen; i++)
+  {
+    mean += pState[i];
+  }
+
+  mean *= invLen;
+
+  for (i = 0U; i < winLen; i++)
+  {
+    d = pState[i] - mean;
+    m2 += d * d;
+  }
+
+  *pM2 = m2;
+
+  return (mean);
+}
+
+/**
+ * @addtogroup MovStats
+ * @{
+ */
+
+/**
+ * @brief  Moving window mean and variance of floating-point data.
+ * @param[in,out] S          points to an instance of the floating-point moving window statistics structure.
+ * @param[in]     pSrc       points to the block of input samples.
+ * @param[out]    pMean      points to the block of window means.
+ * @param[out]    pVar       points to the block of window variances.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ *
+ * <b>Algorithm:</b>
+ * \par
+ * The mean and the sum of squared deviations <code>M2</code> are updated
+ * with the sliding form of Welford's update. With <code>xi</code> the sample
+ * entering and <code>xo</code> the sample leaving the window:
+ * <pre>
+ *     mean' = mean + (xi - xo) / winLen
+ *     M2'   = M2 + (xi - xo) * ((xi - mean') + (xo - mean))
+ * </pre>
+ * Rounding errors of the update accumulate, so every <code>winLen</code>
+ * samples, when the history wraps, the mean and <code>M2</code> are
+ * recomputed from the history with two passes. <code>M2</code> also loses
+ * precision when it falls far below an earlier value, for example after a
+ * step has left the window, so the history is also re-normalized when
+ * <code>M2</code> drops below 1/256 of its peak since the last
+ * re-normalization. A large value has to enter and leave the window for
+ * this to happen, so both cases add <code>O(1)</code> work per sample on
+ * average and bound the relative error of the variance.
+ */
+
+void arm_mov_stats_f32(
+  arm_mov_stats_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pMean,
+  float32_t * pVar,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                /* State pointer */
+  float32_t mean = S->mean;                     /* Running mean */
+  float32_t m2 = S->m2;                         /* Running sum of squared deviations */
+  float32_t m2Peak = S->m2Peak;                 /* Peak of M2 since the last re-normalization */
+  float32_t invLen, invLenM1;                   /* Normalization factors */
+  float32_t xi, xo, delta, meanOld;             /* Temporary variables */
+  uint32_t winLen = S->winLen;                  /* Window length */
+  uint32_t pos = S->pos;                        /* Oldest sample in the history */
+  uint32_t blkCnt;                              /* loop counter */
+
+  invLen = 1.0f / (float32_t) winLen;
+  invLenM1 = (winLen > 1U) ? (1.0f / (float32_t) (winLen - 1U)) : 0.0f;
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    /* Replace the oldest sample */
+    xi = *pSrc++;
+    xo = pState[pos];
+    pState[pos] = xi;
+
+    /* Sliding Welford update */
+    delta = xi - xo;
+    meanOld = mean;
+    mean += delta * invLen;
+    m2 += delta * ((xi - mean) + (xo - meanOld));
+
+    pos++;
+
+    if (pos == winLen)
+    {
+      pos = 0U;
+    }
+
+    /* Re-normalize once per window or when M2 collapses */
+    if ((pos == 0U) || (m2 < m2Peak * 0.00390625f))
+    {
+      mean = arm_mov_stats_renorm_f32(pState, winLen, invLen, &m2);
+      m2Peak = m2;
+    }
+    else if (m2 > m2Peak)
+    {
+      m2Peak = m2;
+    }
+
+    *pMean++ = mean;
+    *pVar++ = (m2 > 0.0f) ? (m2 * invLenM1) : 0.0f;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Save the running values for the next call */
+  S->mean = mean;
+  S->m2 = m2;
+  S->m2Peak = m2Peak;
+  S->pos = (uint16_t) pos;
+}
+
+/**
+ * @} end of MovStats group
+ */
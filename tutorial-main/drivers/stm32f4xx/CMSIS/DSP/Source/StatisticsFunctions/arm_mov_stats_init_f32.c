@@ -0,0 +1,91 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mov_stats_init_f32.c
+ * Description:  Floating-point moving window statistics initialization function
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup MovStats
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point moving window statistics.
+ * @param[in,out] S       points to an instance of the floating-point moving window statistics structure.
+ * @param[in]     winLen  number of samples in the window.
+ * @param[in]     pState  points to the state buffer.
+ * @return The function returns ARM_MATH_SUCCESS if initialization was successful or
+ * ARM_MATH_ARGUMENT_ERROR if <code>winLen</code> is 0.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pState</code> points to an array of <code>winLen</code> words that
+ * holds the history. It is cleared, so the window initially holds zeros.
+ */
+
+arm_status arm_mov_stats_init_f32(
+  arm_mov_stats_instance_f32 * S,
+  uint16_t winLen,
+  float32_t * pState)
+{
+  arm_status status;
+
+  if (winLen == 0U)
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Assign window length */
+    S->winLen = winLen;
+
+    /* Clear state buffer, the window holds zeros */
+    memset(pState, 0, winLen * sizeof(float32_t));
+
+    /* Assign state pointer */
+    S->pState = pState;
+
+    /* Running values of an all-zero window */
+    S->pos = 0U;
+    S->mean = 0.0f;
+    S->m2 = 0.0f;
+    S->m2Peak = 0.0f;
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of MovStats group
+ */
@@ -0,0 +1,122 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mov_stats_q15.c
+ * Description:  Q15 moving window mean and variance
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup MovStats
+ * @{
+ */
+
+/**
+ * @brief  Moving window mean and variance of Q15 data.
+ * @param[in,out] S          points to an instance of the Q15 moving window statistics structure.
+ * @param[in]     pSrc       points to the block of input samples.
+ * @param[out]    pMean      points to the block of window means.
+ * @param[out]    pVar       points to the block of window variances.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The running sum is kept in a 32-bit accumulator and the running sum of
+ * squares in a 64-bit accumulator. Both are exact for window lengths up to
+ * 65535, so the update <code>sum += xi - xo</code> never drifts and needs no
+ * re-normalization. The outputs are computed from the sums with the same
+ * integer arithmetic as arm_mean_q15() and arm_var_q15(), and are bit exact
+ * with these functions applied to the window.
+ */
+
+void arm_mov_stats_q15(
+  arm_mov_stats_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pMean,
+  q15_t * pVar,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                    /* State pointer */
+  q31_t sum = S->sum;                           /* Running sum */
+  q63_t sumOfSquares = S->sumOfSquares;         /* Running sum of squares */
+  q31_t meanOfSquares, squareOfMean;            /* square of mean and mean of square */
+  q31_t xi, xo;                                 /* Entering and leaving samples */
+  uint32_t winLen = S->winLen;                  /* Window length */
+  uint32_t pos = S->pos;                        /* Oldest sample in the history */
+  uint32_t blkCnt;                              /* loop counter */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    /* Replace the oldest sample */
+    xi = *pSrc++;
+    xo = pState[pos];
+    pState[pos] = (q15_t) xi;
+
+    pos++;
+
+    if (pos == winLen)
+    {
+      pos = 0U;
+    }
+
+    /* Exact update of the sums */
+    sum += xi - xo;
+    sumOfSquares += (q63_t) (xi * xi) - (xo * xo);
+
+    *pMean++ = (q15_t) (sum / (q31_t) winLen);
+
+    if (winLen == 1U)
+    {
+      *pVar++ = 0;
+    }
+    else
+    {
+      /* Same arithmetic as arm_var_q15() */
+      meanOfSquares = (q31_t) (sumOfSquares / (q63_t) (winLen - 1U));
+      squareOfMean = (q31_t) ((q63_t) sum * sum / (q63_t) (winLen * (winLen - 1U)));
+      *pVar++ = (q15_t) ((meanOfSquares - squareOfMean) >> 15);
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Save the running values for the next call */
+  S->sum = sum;
+  S->sumOfSquares = sumOfSquares;
+  S->pos = (uint16_t) pos;
+}
+
+/**
+ * @} end of MovStats group
+ */
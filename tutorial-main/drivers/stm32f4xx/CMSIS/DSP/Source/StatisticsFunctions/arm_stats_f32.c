@@ -0,0 +1,248 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_f32.c
+ * Description:  Fused single-pass statistics of a floating-point vector
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup FusedStats Fused Statistics
+ *
+ * Computes the mean, variance, standard deviation, RMS, power, minimum and
+ * maximum of a vector, with the positions of the minimum and maximum, in a
+ * single pass over the data.
+ *
+ * Calling arm_mean_f32(), arm_var_f32(), arm_std_f32(), arm_rms_f32(),
+ * arm_power_f32(), arm_min_f32() and arm_max_f32() on the same buffer reads
+ * it nine times, because the variance and standard deviation are two-pass.
+ * arm_stats_f32() reads every sample once and keeps all accumulators in
+ * registers.
+ *
+ * The variance is computed on data shifted by the first sample:
+ * <pre>
+ *     d[n]  = pSrc[n] - pSrc[0]
+ *     M2    = sum(d[n]^2) - sum(d[n])^2 / blockSize
+ *     var   = M2 / (blockSize - 1)
+ * </pre>
+ * This is a single-pass formula that does not suffer from the cancellation of
+ * the textbook <code>sum(x^2) - sum(x)^2/N</code> when the mean is large
+ * compared with the spread.
+ *
+ * For data that arrives in blocks, the accumulator functions
+ * arm_stats_init_f32(), arm_stats_update_f32() and arm_stats_get_f32()
+ * combine the per-block results with the pairwise update of Chan, Golub and
+ * LeVeque, the block form of Welford's algorithm. The statistics of a stream
+ * of any length are then available without buffering it.
+ *
+ * The results are consistent with the individual functions: the variance is
+ * normalized by <code>blockSize - 1</code>, the power is the sum of squares
+ * and ties for the minimum or maximum report the first position.
+ */
+
+/**
+ * @addtogroup FusedStats
+ * @{
+ */
+
+/**
+ * @brief Fused statistics of a floating-point vector.
+ * @param[in]  pSrc       points to the input vector
+ * @param[in]  blockSize  length of the input vector
+ * @param[out] pResult    statistics returned here
+ * @return none.
+ */
+
+void arm_stats_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_f32 * pResult)
+{
+  float32_t shift;                              /* First sample, subtracted before squaring */
+  float32_t in, d;                              /* Temporary variables */
+  float32_t sum = 0.0f;                         /* Sum of shifted samples */
+  float32_t sumSq = 0.0f;                       /* Sum of squared shifted samples */
+  float32_t power = 0.0f;                       /* Sum of squared samples */
+  float32_t minVal, maxVal;                     /* Running minimum and maximum */
+  float32_t n, m2;                              /* Length and sum of squared deviations */
+  uint32_t minIndex = 0U, maxIndex = 0U;        /* Positions of the minimum and maximum */
+  uint32_t index;                               /* Position of the current sample */
+  uint32_t blkCnt;                              /* loop counter */
+
+  if (blockSize == 0U)
+  {
+    memset(pResult, 0, sizeof(arm_stats_result_f32));
+    return;
+  }
+
+  /* The first sample initializes all accumulators */
+  shift = *pSrc++;
+  minVal = shift;
+  maxVal = shift;
+  power = shift * shift;
+  index = 1U;
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = (blockSize - 1U) >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 samples at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+    d = in - shift;
+    sum += d;
+    sumSq += d * d;
+    power += in * in;
+    if (in < minVal)
+    {
+      minVal = in;
+      minIndex = index;
+    }
+    if (in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = index;
+    }
+
+    in = *pSrc++;
+    d = in - shift;
+    sum += d;
+    sumSq += d * d;
+    power += in * in;
+    if (in < minVal)
+    {
+      minVal = in;
+      minIndex = index + 1U;
+    }
+    if (in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = index + 1U;
+    }
+
+    in = *pSrc++;
+    d = in - shift;
+    sum += d;
+    sumSq += d * d;
+    power += in * in;
+    if (in < minVal)
+    {
+      minVal = in;
+      minIndex = index + 2U;
+    }
+    if (in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = index + 2U;
+    }
+
+    in = *pSrc++;
+    d = in - shift;
+    sum += d;
+    sumSq += d * d;
+    power += in * in;
+    if (in < minVal)
+    {
+      minVal = in;
+      minIndex = index + 3U;
+    }
+    if (in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = index + 3U;
+    }
+
+    index += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize - 1 is not a multiple of 4, compute any remaining samples here.
+   ** No loop unrolling is used. */
+  blkCnt = (blockSize - 1U) % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over the remaining blockSize - 1 samples */
+  blkCnt = blockSize - 1U;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+    d = in - shift;
+    sum += d;
+    sumSq += d * d;
+    power += in * in;
+    if (in < minVal)
+    {
+      minVal = in;
+      minIndex = index;
+    }
+    if (in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = index;
+    }
+
+    index++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  n = (float32_t) blockSize;
+
+  /* Sum of squared deviations from the mean, never negative */
+  m2 = sumSq - sum * (sum / n);
+  m2 = (m2 > 0.0f) ? m2 : 0.0f;
+
+  pResult->mean = shift + sum / n;
+  pResult->var = (blockSize > 1U) ? (m2 / (n - 1.0f)) : 0.0f;
+  arm_sqrt_f32(pResult->var, &pResult->std);
+  pResult->power = power;
+  arm_sqrt_f32(power / n, &pResult->rms);
+  pResult->min = minVal;
+  pResult->max = maxVal;
+  pResult->minIndex = minIndex;
+  pResult->maxIndex = maxIndex;
+}
+
+/**
+ * @} end of FusedStats group
+ */
@@ -0,0 +1,77 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_get_f32.c
+ * Description:  Result of the floating-point statistics accumulator
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup FusedStats
+ * @{
+ */
+
+/**
+ * @brief  Reads the statistics of the floating-point statistics accumulator.
+ * @param[in]  S        points to an instance of the floating-point statistics accumulator.
+ * @param[out] pResult  statistics of all samples added since initialization.
+ * @return none.
+ *
+ * The accumulator is not modified, so intermediate results can be read while
+ * the stream continues. An empty accumulator returns all zeros.
+ */
+
+void arm_stats_get_f32(
+  const arm_stats_instance_f32 * S,
+  arm_stats_result_f32 * pResult)
+{
+  float32_t n;                                  /* Sample count as floating-point */
+
+  if (S->count == 0U)
+  {
+    memset(pResult, 0, sizeof(arm_stats_result_f32));
+    return;
+  }
+
+  n = (float32_t) S->count;
+
+  pResult->mean = S->mean;
+  pResult->var = (S->count > 1U) ? (S->m2 / (n - 1.0f)) : 0.0f;
+  arm_sqrt_f32(pResult->var, &pResult->std);
+  pResult->power = S->power;
+  arm_sqrt_f32(S->power / n, &pResult->rms);
+  pResult->min = S->min;
+  pResult->max = S->max;
+  pResult->minIndex = S->minIndex;
+  pResult->maxIndex = S->maxIndex;
+}
+
+/**
+ * @} end of FusedStats group
+ */
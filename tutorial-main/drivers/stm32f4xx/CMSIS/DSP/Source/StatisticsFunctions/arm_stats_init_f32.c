@@ -0,0 +1,64 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_init_f32.c
+ * Description:  Initialization function for the floating-point statistics accumulator
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup FusedStats
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point statistics accumulator.
+ * @param[in,out] S  points to an instance of the floating-point statistics accumulator.
+ * @return none.
+ *
+ * The accumulator is emptied. It can be re-initialized at any time to start
+ * a new measurement.
+ */
+
+void arm_stats_init_f32(
+  arm_stats_instance_f32 * S)
+{
+  S->count = 0U;
+  S->mean = 0.0f;
+  S->m2 = 0.0f;
+  S->power = 0.0f;
+  S->min = 0.0f;
+  S->max = 0.0f;
+  S->minIndex = 0U;
+  S->maxIndex = 0U;
+}
+
+/**
+ * @} end of FusedStats group
+ */
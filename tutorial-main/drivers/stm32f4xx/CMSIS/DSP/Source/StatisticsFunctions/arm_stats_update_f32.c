@@ -0,0 +1,115 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_update_f32.c
+ * Description:  Block update of the floating-point statistics accumulator
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup FusedStats
+ * @{
+ */
+
+/**
+ * @brief  Adds a block of samples to the floating-point statistics accumulator.
+ * @param[in,out] S          points to an instance of the floating-point statistics accumulator.
+ * @param[in]     pSrc       points to the block of input samples.
+ * @param[in]     blockSize  number of samples in the block.
+ * @return none.
+ *
+ * \par
+ * The block is reduced with arm_stats_f32() and merged into the accumulator:
+ * <pre>
+ *     delta = meanB - meanA
+ *     mean  = meanA + delta * nB / (nA + nB)
+ *     M2    = M2A + M2B + delta^2 * nA * nB / (nA + nB)
+ * </pre>
+ * Only the merge involves divisions, so the cost per sample is the same as
+ * arm_stats_f32(). Blocks may have any length, and the minimum and maximum
+ * positions count samples from the last call to arm_stats_init_f32().
+ */
+
+void arm_stats_update_f32(
+  arm_stats_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize)
+{
+  arm_stats_result_f32 block;                   /* Statistics of this block */
+  float32_t nA, nB, n;                          /* Sample counts as floating-point */
+  float32_t delta;                              /* Difference of the means */
+
+  if (blockSize == 0U)
+  {
+    return;
+  }
+
+  arm_stats_f32(pSrc, blockSize, &block);
+
+  nA = (float32_t) S->count;
+  nB = (float32_t) blockSize;
+  n = nA + nB;
+
+  if (S->count == 0U)
+  {
+    S->mean = block.mean;
+    S->m2 = block.var * (nB - 1.0f);
+    S->min = block.min;
+    S->max = block.max;
+    S->minIndex = block.minIndex;
+    S->maxIndex = block.maxIndex;
+  }
+  else
+  {
+    /* Pairwise update of the mean and the sum of squared deviations */
+    delta = block.mean - S->mean;
+    S->mean += delta * (nB / n);
+    S->m2 += block.var * (nB - 1.0f) + delta * delta * (nA * (nB / n));
+
+    /* Earlier samples win ties, as in arm_min_f32() and arm_max_f32() */
+    if (block.min < S->min)
+    {
+      S->min = block.min;
+      S->minIndex = S->count + block.minIndex;
+    }
+
+    if (block.max > S->max)
+    {
+      S->max = block.max;
+      S->maxIndex = S->count + block.maxIndex;
+    }
+  }
+
+  S->power += block.power;
+  S->count += blockSize;
+}
+
+/**
+ * @} end of FusedStats group
+ */
@@ -0,0 +1,184 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_convert_f32_q15.c
+ * Description:  Converts floating-point to Q15 with rounding and clip statistics
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @defgroup convert_stats Conversion with Rounding and Clip Statistics
+ *
+ * Converts vectors between formats like the plain converters of
+ * @ref float_to_x and @ref q31_to_x, with three additions:
+ *
+ * - The rounding is chosen at run time instead of with the
+ *   <code>ARM_MATH_ROUNDING</code> build option:
+ *   #ARM_CONVERT_TRUNCATE, #ARM_CONVERT_NEAREST or #ARM_CONVERT_DITHER.
+ * - The number of saturated samples and the peak input magnitude are
+ *   gathered in the same pass, so a front end can report clipping without a
+ *   second pass over the data.
+ * - A gain is applied before the conversion at no extra cost, since it is
+ *   folded into the scaling the conversion needs anyway.
+ *
+ * #ARM_CONVERT_DITHER adds a uniformly distributed offset of one LSB before
+ * rounding down. This is stochastic rounding: the output is one of the two
+ * nearest codes, with the expected value equal to the input. The error has
+ * no bias and no correlation with the signal, so low level signals are not
+ * lost in a dead band. The offsets come from a linear congruential
+ * generator kept in the instance.
+ *
+ * The statistics accumulate in the instance over calls until
+ * arm_convert_init() is called again or the fields are cleared by the user:
+ * - <code>clipCount</code> counts the saturated output samples.
+ * - <code>peak</code> holds the largest input magnitude after the gain,
+ *   relative to the full scale of the output. A value above 1.0 means the
+ *   output clipped.
+ */
+
+/**
+ * @addtogroup convert_stats
+ * @{
+ */
+
+/**
+ * @brief  Converts a floating-point vector to Q15 with gain, rounding and clip statistics.
+ * @param[in,out] S          points to an instance of the conversion structure.
+ * @param[in]     pSrc       points to the floating-point input vector.
+ * @param[in]     scale      gain applied before the conversion.
+ * @param[out]    pDst       points to the Q15 output vector.
+ * @param[in]     blockSize  length of the input vector.
+ * @return none.
+ *
+ * \par Description:
+ * <pre>
+ *     pDst[n] = saturate(round(pSrc[n] * scale * 32768)),   0 <= n < blockSize.
+ * </pre>
+ * #ARM_CONVERT_TRUNCATE rounds toward zero and #ARM_CONVERT_NEAREST rounds
+ * half away from zero, so with a scale of 1.0 they match
+ * arm_float_to_q15() built without and with <code>ARM_MATH_ROUNDING</code>.
+ * A NaN input saturates and is counted as clipped.
+ */
+
+void arm_convert_f32_q15(
+  arm_convert_instance * S,
+  float32_t * pSrc,
+  float32_t scale,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t k = scale * 32768.0f;                /* Gain to Q15 units */
+  float32_t v, t;                                /* Scaled input and rounded value */
+  union
+  {
+    float32_t f;
+    uint32_t u;
+  } bits;                                        /* Scaled input and largest magnitude as bits */
+  uint32_t maxBits = 0U;                         /* Largest magnitude of this call, as bits */
+  float32_t posOfs, negOfs;                      /* Rounding offsets for either sign */
+  uint32_t seed = S->seed;                       /* Dither generator state */
+  uint32_t clipCount = 0U;                       /* Saturated samples of this call */
+  q31_t out;                                     /* Converted sample */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  /* The loops have no branches, so the mode is chosen outside of them.
+   * Samples are clipped in floating point, where the bounds are exact:
+   * a value is saturated when it is at least one code outside the range.
+   * NaN fails both comparisons, is counted and ends up at the upper bound. */
+  if (S->rounding == ARM_CONVERT_DITHER)
+  {
+    while (blkCnt > 0U)
+    {
+      v = *pSrc++ * k;
+
+      /* Peak magnitude. Positive floats order like their bits, which keeps
+       * the loop free of floating-point compares that cannot be reordered. */
+      bits.f = v;
+      maxBits = ((bits.u & 0x7FFFFFFFU) > maxBits) ? (bits.u & 0x7FFFFFFFU) : maxBits;
+
+      /* Add a uniform offset in [0 1) and round toward minus infinity */
+      seed = seed * 1664525U + 1013904223U;
+      t = v + (float32_t) (seed >> 8) * 5.96046448e-8f;
+
+      clipCount += (uint32_t) ((t < 32768.0f) & (t >= -32768.0f)) ^ 1U;
+      t = (t < 32767.0f) ? t : 32767.0f;
+      t = (t > -32768.0f) ? t : -32768.0f;
+
+      out = (q31_t) t;
+      out -= ((float32_t) out > t);
+
+      *pDst++ = (q15_t) out;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+  else
+  {
+    /* Truncation has no offset, rounding to nearest adds half an LSB
+     * away from zero */
+    posOfs = (S->rounding == ARM_CONVERT_NEAREST) ? 0.5f : 0.0f;
+    negOfs = -posOfs;
+
+    while (blkCnt > 0U)
+    {
+      v = *pSrc++ * k;
+
+      /* Peak magnitude */
+      bits.f = v;
+      maxBits = ((bits.u & 0x7FFFFFFFU) > maxBits) ? (bits.u & 0x7FFFFFFFU) : maxBits;
+
+      /* Round toward zero after the offset */
+      t = v + ((v > 0.0f) ? posOfs : negOfs);
+
+      clipCount += (uint32_t) ((t < 32768.0f) & (t > -32769.0f)) ^ 1U;
+      t = (t < 32767.0f) ? t : 32767.0f;
+      t = (t > -32768.0f) ? t : -32768.0f;
+
+      *pDst++ = (q15_t) t;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+
+  /* Update the statistics */
+  S->seed = seed;
+  S->clipCount += clipCount;
+  bits.u = maxBits;
+  bits.f *= 3.05175781e-5f;
+  S->peak = (bits.f > S->peak) ? bits.f : S->peak;
+}
+
+/**
+ * @} end of convert_stats group
+ */
@@ -0,0 +1,161 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_convert_f32_q31.c
+ * Description:  Converts floating-point to Q31 with rounding and clip statistics
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup convert_stats
+ * @{
+ */
+
+/**
+ * @brief  Converts a floating-point vector to Q31 with gain, rounding and clip statistics.
+ * @param[in,out] S          points to an instance of the conversion structure.
+ * @param[in]     pSrc       points to the floating-point input vector.
+ * @param[in]     scale      gain applied before the conversion.
+ * @param[out]    pDst       points to the Q31 output vector.
+ * @param[in]     blockSize  length of the input vector.
+ * @return none.
+ *
+ * \par Description:
+ * <pre>
+ *     pDst[n] = saturate(round(pSrc[n] * scale * 2147483648)),   0 <= n < blockSize.
+ * </pre>
+ * #ARM_CONVERT_TRUNCATE rounds toward zero and #ARM_CONVERT_NEAREST rounds
+ * half away from zero, so with a scale of 1.0 they match
+ * arm_float_to_q31() built without and with <code>ARM_MATH_ROUNDING</code>.
+ * Unlike arm_float_to_q31(), no 64-bit conversion is needed: the range is
+ * checked in floating point, where values of 2^24 and above are integers.
+ * A NaN input saturates and is counted as clipped.
+ */
+
+void arm_convert_f32_q31(
+  arm_convert_instance * S,
+  float32_t * pSrc,
+  float32_t scale,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t k = scale * 2147483648.0f;           /* Gain to Q31 units */
+  float32_t v, t;                                /* Scaled input and rounded value */
+  union
+  {
+    float32_t f;
+    uint32_t u;
+  } bits;                                        /* Scaled input and largest magnitude as bits */
+  uint32_t maxBits = 0U;                         /* Largest magnitude of this call, as bits */
+  float32_t posOfs, negOfs;                      /* Rounding offsets for either sign */
+  uint32_t seed = S->seed;                       /* Dither generator state */
+  uint32_t clipCount = 0U;                       /* Saturated samples of this call */
+  q31_t out;                                     /* Converted sample */
+  q31_t sat;                                     /* Positive saturation mask */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  /* The loops have no branches, so the mode is chosen outside of them.
+   * Floats next to +/-2^31 are 128 or 256 apart, so a value is saturated
+   * when it is not below 2^31 or is below -2^31. Values at the top are
+   * converted as zero and ORed with 0x7FFFFFFF, values at the bottom are
+   * clamped to -2^31. NaN fails both comparisons, is counted and ends up at
+   * the upper bound. */
+  if (S->rounding == ARM_CONVERT_DITHER)
+  {
+    while (blkCnt > 0U)
+    {
+      v = *pSrc++ * k;
+
+      /* Peak magnitude. Positive floats order like their bits, which keeps
+       * the loop free of floating-point compares that cannot be reordered. */
+      bits.f = v;
+      maxBits = ((bits.u & 0x7FFFFFFFU) > maxBits) ? (bits.u & 0x7FFFFFFFU) : maxBits;
+
+      /* Add a uniform offset in [0 1) and round toward minus infinity */
+      seed = seed * 1664525U + 1013904223U;
+      t = v + (float32_t) (seed >> 8) * 5.96046448e-8f;
+
+      clipCount += (uint32_t) ((t < 2147483648.0f) & (t >= -2147483648.0f)) ^ 1U;
+      sat = (t < 2147483648.0f) ? 0 : 0x7FFFFFFF;
+      t = (t < 2147483648.0f) ? t : 0.0f;
+      t = (t >= -2147483648.0f) ? t : -2147483648.0f;
+
+      out = (q31_t) t;
+      out -= ((float32_t) out > t);
+
+      *pDst++ = out | sat;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+  else
+  {
+    /* Truncation has no offset, rounding to nearest adds half an LSB
+     * away from zero */
+    posOfs = (S->rounding == ARM_CONVERT_NEAREST) ? 0.5f : 0.0f;
+    negOfs = -posOfs;
+
+    while (blkCnt > 0U)
+    {
+      v = *pSrc++ * k;
+
+      /* Peak magnitude */
+      bits.f = v;
+      maxBits = ((bits.u & 0x7FFFFFFFU) > maxBits) ? (bits.u & 0x7FFFFFFFU) : maxBits;
+
+      /* Round toward zero after the offset */
+      t = v + ((v > 0.0f) ? posOfs : negOfs);
+
+      clipCount += (uint32_t) ((t < 2147483648.0f) & (t >= -2147483648.0f)) ^ 1U;
+      sat = (t < 2147483648.0f) ? 0 : 0x7FFFFFFF;
+      t = (t < 2147483648.0f) ? t : 0.0f;
+      t = (t >= -2147483648.0f) ? t : -2147483648.0f;
+
+      *pDst++ = (q31_t) t | sat;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+
+  /* Update the statistics */
+  S->seed = seed;
+  S->clipCount += clipCount;
+  bits.u = maxBits;
+  bits.f *= 4.65661287e-10f;
+  S->peak = (bits.f > S->peak) ? bits.f : S->peak;
+}
+
+/**
+ * @} end of convert_stats group
+ */
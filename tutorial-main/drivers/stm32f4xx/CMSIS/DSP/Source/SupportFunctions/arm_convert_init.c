@@ -0,0 +1,65 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_convert_init.c
+ * Description:  Initialization function for the conversion with clip statistics
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup convert_stats
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the conversion with rounding and clip statistics.
+ * @param[out] S         points to an instance of the conversion structure.
+ * @param[in]  rounding  rounding applied by the conversion functions.
+ * @param[in]  seed      initial state of the dither generator.
+ * @return none.
+ *
+ * \par Description:
+ * Clears the clip count and the peak. The seed only matters for
+ * #ARM_CONVERT_DITHER; the same seed gives the same output.
+ */
+
+void arm_convert_init(
+  arm_convert_instance * S,
+  arm_convert_rounding rounding,
+  uint32_t seed)
+{
+  S->rounding = rounding;
+  S->seed = seed;
+  S->clipCount = 0U;
+  S->peak = 0.0f;
+}
+
+/**
+ * @} end of convert_stats group
+ */
@@ -0,0 +1,152 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_convert_q31_q15.c
+ * Description:  Converts Q31 to Q15 with gain, rounding and clip statistics
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup convert_stats
+ * @{
+ */
+
+/**
+ * @brief  Converts a Q31 vector to Q15 with gain, rounding and clip statistics.
+ * @param[in,out] S           points to an instance of the conversion structure.
+ * @param[in]     pSrc        points to the Q31 input vector.
+ * @param[in]     scaleFract  fractional part of the gain.
+ * @param[in]     shift       number of bits to shift the result by, -15 to 31.
+ * @param[out]    pDst        points to the Q15 output vector.
+ * @param[in]     blockSize   length of the input vector.
+ * @return none.
+ *
+ * \par Description:
+ * <pre>
+ *     pDst[n] = saturate(round(pSrc[n] * scaleFract * 2^shift)),   0 <= n < blockSize.
+ * </pre>
+ * The product is formed in 64 bits and rounded once, so the gain adds no
+ * error of its own. With <code>scaleFract = 0x40000000</code>,
+ * <code>shift = 1</code> and #ARM_CONVERT_TRUNCATE the output is identical
+ * to arm_q31_to_q15(), which rounds toward minus infinity.
+ * #ARM_CONVERT_NEAREST rounds half up.
+ */
+
+void arm_convert_q31_q15(
+  arm_convert_instance * S,
+  q31_t * pSrc,
+  q31_t scaleFract,
+  int8_t shift,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  int32_t s = 46 - shift;                        /* Right shift from the halved product to Q15 */
+  q63_t p;                                       /* Halved product, Q61 */
+  q63_t half;                                    /* Rounding offset */
+  uint32_t seed = S->seed;                       /* Dither generator state */
+  uint32_t clipCount = 0U;                       /* Saturated samples of this call */
+  uint32_t mag, maxMag = 0U;                     /* Input magnitudes */
+  q31_t in;                                      /* Input sample */
+  float32_t peak;                                /* Largest output magnitude of this call */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  /* The product is halved so the rounding offset cannot overflow. The
+   * floor of the final shift is not changed by this. The loops have no
+   * branches, so the mode is chosen outside of them. */
+  if (S->rounding == ARM_CONVERT_DITHER)
+  {
+    while (blkCnt > 0U)
+    {
+      in = *pSrc++;
+
+      /* Peak magnitude, -1.0 included */
+      mag = (in < 0) ? (0U - (uint32_t) in) : (uint32_t) in;
+      maxMag = (mag > maxMag) ? mag : maxMag;
+
+      /* Add a uniform offset of one LSB of the output */
+      seed = seed * 1664525U + 1013904223U;
+      p = ((q63_t) in * scaleFract) >> 1;
+      p += (s >= 32) ? ((q63_t) seed << (s - 32)) : (q63_t) (seed >> (32 - s));
+
+      /* Arithmetic shift rounds toward minus infinity, then saturate */
+      p >>= s;
+      clipCount += (uint32_t) ((p > 32767) | (p < -32768));
+      p = (p < 32767) ? p : 32767;
+      p = (p > -32768) ? p : -32768;
+
+      *pDst++ = (q15_t) p;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+  else
+  {
+    /* Truncation has no offset, rounding to nearest adds half an LSB */
+    half = (S->rounding == ARM_CONVERT_NEAREST) ? ((q63_t) 1 << (s - 1)) : 0;
+
+    while (blkCnt > 0U)
+    {
+      in = *pSrc++;
+
+      /* Peak magnitude, -1.0 included */
+      mag = (in < 0) ? (0U - (uint32_t) in) : (uint32_t) in;
+      maxMag = (mag > maxMag) ? mag : maxMag;
+
+      p = (((q63_t) in * scaleFract) >> 1) + half;
+
+      /* Arithmetic shift rounds toward minus infinity, then saturate */
+      p >>= s;
+      clipCount += (uint32_t) ((p > 32767) | (p < -32768));
+      p = (p < 32767) ? p : 32767;
+      p = (p > -32768) ? p : -32768;
+
+      *pDst++ = (q15_t) p;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+
+  /* Update the statistics */
+  S->seed = seed;
+  S->clipCount += clipCount;
+  peak = (float32_t) maxMag * 4.65661287e-10f;
+  peak *= ((scaleFract < 0) ? -(float32_t) scaleFract : (float32_t) scaleFract) * 4.65661287e-10f;
+  peak = (shift >= 0) ? (peak * (float32_t) (1U << shift)) :
+                        (peak / (float32_t) (1U << -shift));
+  S->peak = (peak > S->peak) ? peak : S->peak;
+}
+
+/**
+ * @} end of convert_stats group
+ */
@@ -0,0 +1,401 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_bfp_q31.c
+ * Description:  Block floating point Q31 complex fast Fourier transform
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+extern void arm_bitreversal_32(
+    uint32_t * pSrc,
+    const uint16_t bitRevLen,
+    const uint16_t * pBitRevTable);
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @brief  Largest magnitude of the real and imaginary parts of a Q31 buffer.
+ */
+static uint32_t arm_cfft_bfp_absmax_q31(
+  const q31_t * pSrc,
+  uint32_t numSamples)
+{
+  uint32_t maxVal = 0U, in;
+  uint32_t i;
+
+  for (i = 0U; i < numSamples; i++)
+  {
+    in = (pSrc[i] < 0) ? -(uint32_t) pSrc[i] : (uint32_t) pSrc[i];
+    maxVal = (in > maxVal) ? in : maxVal;
+  }
+
+  return (maxVal);
+}
+
+/**
+ * @brief  Updates a running maximum with the magnitudes of a complex value.
+ */
+static __INLINE uint32_t arm_cfft_bfp_max_q31(
+  uint32_t maxVal,
+  q31_t re,
+  q31_t im)
+{
+  uint32_t absRe = (re < 0) ? -(uint32_t) re : (uint32_t) re;
+  uint32_t absIm = (im < 0) ? -(uint32_t) im : (uint32_t) im;
+
+  maxVal = (absRe > maxVal) ? absRe : maxVal;
+  maxVal = (absIm > maxVal) ? absIm : maxVal;
+
+  return (maxVal);
+}
+
+/**
+ * @brief  Smallest right shift that keeps the outputs of a stage in range.
+ * @param[in] maxVal  largest input magnitude of the stage.
+ * @param[in] gain32  bound on the stage gain, times 32.
+ */
+static uint32_t arm_cfft_bfp_shift_q31(
+  uint32_t maxVal,
+  q63_t gain32)
+{
+  uint32_t shift = 0U;
+
+  while (((q63_t) maxVal * gain32) > ((q63_t) 0x7FFFFFFF << (shift + 5U)))
+  {
+    shift++;
+  }
+
+  return (shift);
+}
+
+/**
+ * @brief  Rounding arithmetic right shift.
+ */
+static __INLINE q31_t arm_cfft_bfp_rshift_q31(
+  q63_t in,
+  uint32_t shift)
+{
+  return ((q31_t) ((shift == 0U) ? in : ((in + ((q63_t) 1 << (shift - 1U))) >> shift)));
+}
+
+/**
+ * @brief  Loads a twiddle factor, conjugated for the inverse transform.
+ * The factor of index 0 is exactly 1 instead of the table value 0x7FFFFFFF.
+ */
+static __INLINE void arm_cfft_bfp_twiddle_q31(
+  const q31_t * pCoef,
+  uint32_t index,
+  uint8_t ifftFlag,
+  q63_t * pCo,
+  q63_t * pSi)
+{
+  if (index == 0U)
+  {
+    *pCo = 0x80000000LL;
+    *pSi = 0;
+  }
+  else
+  {
+    *pCo = pCoef[2U * index];
+    *pSi = (ifftFlag == 1U) ? -(q63_t) pCoef[(2U * index) + 1U] : pCoef[(2U * index) + 1U];
+  }
+}
+
+/**
+ * @brief  Scales a butterfly output, rotates it by a twiddle factor and stores it.
+ * @return updated largest output magnitude.
+ */
+static __INLINE uint32_t arm_cfft_bfp_store_q31(
+  q31_t * pDst,
+  q63_t re,
+  q63_t im,
+  q63_t co,
+  q63_t si,
+  uint32_t shift,
+  uint32_t maxVal)
+{
+  q63_t vr, vi;
+  q31_t outR, outI;
+
+  vr = arm_cfft_bfp_rshift_q31(re, shift);
+  vi = arm_cfft_bfp_rshift_q31(im, shift);
+
+  /* (vr + j*vi) * (co - j*si), the shift bounds the magnitude below 1.0 */
+  outR = clip_q63_to_q31(((vr * co) + (vi * si) + 0x40000000LL) >> 31);
+  outI = clip_q63_to_q31(((vi * co) - (vr * si) + 0x40000000LL) >> 31);
+
+  pDst[0] = (q31_t) outR;
+  pDst[1] = (q31_t) outI;
+
+  return (arm_cfft_bfp_max_q31(maxVal, outR, outI));
+}
+
+/**
+ * @brief  One radix-2 decimation in frequency stage with block scaling.
+ * @param[in,out] pSrc      points to the complex data.
+ * @param[in]     fftLen    length of the whole transform.
+ * @param[in]     len       length of the sub-transforms split by this stage.
+ * @param[in]     pCoef     points to the twiddle table of the fftLen transform.
+ * @param[in]     shift     right shift applied to the butterfly outputs.
+ * @param[in]     ifftFlag  1 for the inverse transform.
+ * @return largest magnitude of the stage outputs.
+ */
+static uint32_t arm_cfft_bfp_radix2_q31(
+  q31_t * pSrc,
+  uint32_t fftLen,
+  uint32_t len,
+  const q31_t * pCoef,
+  uint32_t shift,
+  uint8_t ifftFlag)
+{
+  q63_t ar, ai, br, bi;                         /* Butterfly inputs */
+  q63_t co, si;                                 /* Twiddle factor */
+  uint32_t maxVal = 0U;                         /* Largest output magnitude */
+  uint32_t half = len >> 1U;                    /* Distance of the butterfly inputs */
+  uint32_t twStep = fftLen / len;               /* Twiddle index step */
+  uint32_t g, k, i0, i1;                        /* Loop counters and indices */
+
+  for (k = 0U; k < half; k++)
+  {
+    arm_cfft_bfp_twiddle_q31(pCoef, k * twStep, ifftFlag, &co, &si);
+
+    for (g = k; g < fftLen; g += len)
+    {
+      i0 = 2U * g;
+      i1 = 2U * (g + half);
+
+      ar = pSrc[i0];
+      ai = pSrc[i0 + 1U];
+      br = pSrc[i1];
+      bi = pSrc[i1 + 1U];
+
+      maxVal = arm_cfft_bfp_store_q31(&pSrc[i0], ar + br, ai + bi, 0x80000000LL, 0, shift, maxVal);
+      maxVal = arm_cfft_bfp_store_q31(&pSrc[i1], ar - br, ai - bi, co, si, shift, maxVal);
+    }
+  }
+
+  return (maxVal);
+}
+
+/**
+ * @brief  One radix-4 decimation in frequency stage with block scaling.
+ * @param[in,out] pSrc      points to the complex data.
+ * @param[in]     fftLen    length of the whole transform.
+ * @param[in]     len       length of the sub-transforms split by this stage.
+ * @param[in]     pCoef     points to the twiddle table of the fftLen transform.
+ * @param[in]     shift     right shift applied to the butterfly outputs.
+ * @param[in]     ifftFlag  1 for the inverse transform.
+ * @return largest magnitude of the stage outputs.
+ *
+ * The second and third outputs are exchanged, as in arm_radix4_butterfly_q31(),
+ * so that the transform output is in bit reversed order.
+ */
+static uint32_t arm_cfft_bfp_radix4_q31(
+  q31_t * pSrc,
+  uint32_t fftLen,
+  uint32_t len,
+  const q31_t * pCoef,
+  uint32_t shift,
+  uint8_t ifftFlag)
+{
+  q63_t ar, ai, br, bi, cr, ci, dr, di;         /* Butterfly inputs */
+  q63_t t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i; /* Partial sums */
+  q63_t co1, si1, co2, si2, co3, si3;           /* Twiddle factors */
+  uint32_t maxVal = 0U;                         /* Largest output magnitude */
+  uint32_t quarter = len >> 2U;                 /* Distance of the butterfly inputs */
+  uint32_t twStep = fftLen / len;               /* Twiddle index step */
+  uint32_t g, k, i0, i1, i2, i3;                /* Loop counters and indices */
+
+  for (k = 0U; k < quarter; k++)
+  {
+    arm_cfft_bfp_twiddle_q31(pCoef, k * twStep, ifftFlag, &co1, &si1);
+    arm_cfft_bfp_twiddle_q31(pCoef, 2U * k * twStep, ifftFlag, &co2, &si2);
+    arm_cfft_bfp_twiddle_q31(pCoef, 3U * k * twStep, ifftFlag, &co3, &si3);
+
+    for (g = k; g < fftLen; g += len)
+    {
+      i0 = 2U * g;
+      i1 = i0 + (2U * quarter);
+      i2 = i1 + (2U * quarter);
+      i3 = i2 + (2U * quarter);
+
+      ar = pSrc[i0];
+      ai = pSrc[i0 + 1U];
+      br = pSrc[i1];
+      bi = pSrc[i1 + 1U];
+      cr = pSrc[i2];
+      ci = pSrc[i2 + 1U];
+      dr = pSrc[i3];
+      di = pSrc[i3 + 1U];
+
+      t0r = ar + cr;
+      t0i = ai + ci;
+      t1r = ar - cr;
+      t1i = ai - ci;
+      t2r = br + dr;
+      t2i = bi + di;
+      t3r = br - dr;
+      t3i = bi - di;
+
+      /* a + b + c + d */
+      maxVal = arm_cfft_bfp_store_q31(&pSrc[i0], t0r + t2r, t0i + t2i, 0x80000000LL, 0, shift, maxVal);
+
+      /* (a - b + c - d) * W^2k */
+      maxVal = arm_cfft_bfp_store_q31(&pSrc[i1], t0r - t2r, t0i - t2i, co2, si2, shift, maxVal);
+
+      if (ifftFlag == 1U)
+      {
+        /* (a + jb - c - jd) * W^-k and (a - jb - c + jd) * W^-3k */
+        maxVal = arm_cfft_bfp_store_q31(&pSrc[i2], t1r - t3i, t1i + t3r, co1, si1, shift, maxVal);
+        maxVal = arm_cfft_bfp_store_q31(&pSrc[i3], t1r + t3i, t1i - t3r, co3, si3, shift, maxVal);
+      }
+      else
+      {
+        /* (a - jb - c + jd) * W^k and (a + jb - c - jd) * W^3k */
+        maxVal = arm_cfft_bfp_store_q31(&pSrc[i2], t1r + t3i, t1i - t3r, co1, si1, shift, maxVal);
+        maxVal = arm_cfft_bfp_store_q31(&pSrc[i3], t1r - t3i, t1i + t3r, co3, si3, shift, maxVal);
+      }
+    }
+  }
+
+  return (maxVal);
+}
+
+/**
+ * @addtogroup ComplexFFT
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q31 complex FFT in block floating point.
+ * @param[in]      S               points to an instance of the Q31 CFFT structure.
+ * @param[in, out] p1              points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
+ * @param[in]      ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+ * @param[in]      bitReverseFlag  flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.
+ * @param[out]     pExponent       block exponent of the output.
+ * @return none.
+ *
+ * <b>Block Floating Point:</b>
+ * \par
+ * arm_cfft_q31() scales the data down at every stage, whatever its level,
+ * so the output is the transform divided by <code>fftLen</code> and a small
+ * input loses most of its significant bits. This function keeps one exponent
+ * for the whole buffer instead:
+ * - the input is first shifted left until its largest sample uses the full range,
+ * - before each stage, the largest magnitude of the data gives the smallest
+ *   right shift, from 0 to 3 bits, that cannot overflow the stage,
+ * - the shifts are added to the exponent.
+ * The largest magnitude of a stage output is tracked while it is written, so
+ * the only extra pass over the data is the one on the input.
+ * \par
+ * On return, <code>p1[n] * 2^(*pExponent)</code> is the unnormalized
+ * transform of the input, in the same Q31 units:
+ * <pre>
+ *     X[k] = sum(x[n] * exp(-j*2*pi*k*n/fftLen)),   n = 0..fftLen-1
+ * </pre>
+ * for the forward transform and the same sum with <code>+j</code> for the
+ * inverse transform, without the <code>1/fftLen</code> factor. The exponent
+ * can be negative for a small input. A buffer of zeros returns an exponent of
+ * 0.
+ * \par
+ * The butterflies are computed with 64-bit intermediate results and rounded.
+ * The same instances, twiddle factors and bit reversal tables as
+ * arm_cfft_q31() are used, so any of the <code>arm_cfft_sR_q31_lenXXX</code>
+ * structures can be passed.
+ */
+
+void arm_cfft_bfp_q31(
+  const arm_cfft_instance_q31 * S,
+  q31_t * p1,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag,
+  int32_t * pExponent)
+{
+  uint32_t fftLen = S->fftLen;                  /* Length of the transform */
+  uint32_t len;                                 /* Length of the current sub-transforms */
+  uint32_t shift;                               /* Shift of the current stage */
+  int32_t exponent;                             /* Block exponent */
+  int32_t norm;                                 /* Normalization shift of the input */
+  uint32_t maxVal;                              /* Largest magnitude of the data */
+  uint32_t i;                                   /* loop counter */
+
+  maxVal = arm_cfft_bfp_absmax_q31(p1, 2U * fftLen);
+
+  if (maxVal == 0U)
+  {
+    *pExponent = 0;
+    return;
+  }
+
+  /* Use the full range, the largest magnitude becomes at least 0x40000000 */
+  norm = (int32_t) __CLZ(maxVal) - 1;
+
+  if (norm > 0)
+  {
+    for (i = 0U; i < 2U * fftLen; i++)
+    {
+      p1[i] = (q31_t) ((uint32_t) p1[i] << norm);
+    }
+
+    maxVal <<= norm;
+  }
+  else
+  {
+    norm = 0;
+  }
+
+  exponent = -norm;
+  len = fftLen;
+
+  /* One radix-2 stage when the length is not a power of 4 */
+  if ((fftLen & 0x55555555U) == 0U)
+  {
+    /* |(a - b) * W| <= 2 * sqrt(2) * maxVal */
+    shift = arm_cfft_bfp_shift_q31(maxVal, 91);
+    maxVal = arm_cfft_bfp_radix2_q31(p1, fftLen, len, S->pTwiddle, shift, ifftFlag);
+    exponent += (int32_t) shift;
+    len >>= 1U;
+  }
+
+  while (len > 1U)
+  {
+    /* |(a - jb - c + jd) * W| <= 4 * sqrt(2) * maxVal */
+    shift = arm_cfft_bfp_shift_q31(maxVal, 182);
+    maxVal = arm_cfft_bfp_radix4_q31(p1, fftLen, len, S->pTwiddle, shift, ifftFlag);
+    exponent += (int32_t) shift;
+    len >>= 2U;
+  }
+
+  if (bitReverseFlag)
+    arm_bitreversal_32((uint32_t*)p1,S->bitRevLength,S->pBitRevTable);
+
+  *pExponent = exponent;
+}
+
+/**
+ * @} end of ComplexFFT group
+ */
@@ -0,0 +1,250 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_istft_f32.c
+ * Description:  Floating-point inverse short-time Fourier transform with overlap-add
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @brief  Completes the oldest output samples of the overlap-add accumulator.
+ * @param[in,out] *pAcc       points to the accumulator, cleared after reading.
+ * @param[in]     *pWin       points to the window coefficients.
+ * @param[in]     *pSrc       points to the time domain frame.
+ * @param[out]    *pDst       points to the output buffer.
+ * @param[in]     blockSize   number of samples to process.
+ * @return none.
+ */
+static void arm_istft_output_f32(
+  float32_t * pAcc,
+  const float32_t * pWin,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t acc1, acc2, acc3, acc4;              /* temporary accumulator variables */
+
+  /* loop Unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* y = acc + w * x, acc = 0 */
+    acc1 = pAcc[0] + (pWin[0] * pSrc[0]);
+    acc2 = pAcc[1] + (pWin[1] * pSrc[1]);
+    acc3 = pAcc[2] + (pWin[2] * pSrc[2]);
+    acc4 = pAcc[3] + (pWin[3] * pSrc[3]);
+
+    pDst[0] = acc1;
+    pDst[1] = acc2;
+    pDst[2] = acc3;
+    pDst[3] = acc4;
+
+    pAcc[0] = 0.0f;
+    pAcc[1] = 0.0f;
+    pAcc[2] = 0.0f;
+    pAcc[3] = 0.0f;
+
+    pAcc += 4U;
+    pWin += 4U;
+    pSrc += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* y = acc + w * x, acc = 0 */
+    *pDst++ = *pAcc + ((*pWin++) * (*pSrc++));
+    *pAcc++ = 0.0f;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @brief  Adds a windowed block of the time domain frame to the overlap-add accumulator.
+ * @param[in,out] *pAcc       points to the accumulator.
+ * @param[in]     *pWin       points to the window coefficients.
+ * @param[in]     *pSrc       points to the time domain frame.
+ * @param[in]     blockSize   number of samples to process.
+ * @return none.
+ */
+static void arm_istft_accumulate_f32(
+  float32_t * pAcc,
+  const float32_t * pWin,
+  const float32_t * pSrc,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* loop Unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* acc += w * x */
+    pAcc[0] += pWin[0] * pSrc[0];
+    pAcc[1] += pWin[1] * pSrc[1];
+    pAcc[2] += pWin[2] * pSrc[2];
+    pAcc[3] += pWin[3] * pSrc[3];
+
+    pAcc += 4U;
+    pWin += 4U;
+    pSrc += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* acc += w * x */
+    *pAcc++ += (*pWin++) * (*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup STFT
+ * @{
+ */
+
+/**
+* @brief Processing function for the floating-point inverse STFT with overlap-add.
+* @param[in,out] *S             points to an arm_stft_instance_f32 structure.
+* @param[in]     *pSrc          points to the packed complex spectrum of length <code>fftLen</code>.
+* @param[in]     *pScratch      points to a scratch buffer of length <code>fftLen</code>.
+* @param[out]    *pDst          points to <code>hopSize</code> output samples.
+* @return none.
+*
+* \par
+* The spectrum uses the layout produced by arm_stft_f32() with ARM_STFT_COMPLEX.
+* The inverse frame is multiplied by the synthesis window and added to the overlap-add
+* accumulator in the same pass that completes and outputs the oldest <code>hopSize</code>
+* samples. The output is delayed by <code>fftLen - hopSize</code> samples with respect
+* to the frame start.
+*/
+void arm_istft_f32(
+  arm_stft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pScratch,
+  float32_t * pDst)
+{
+  float32_t *pAcc = S->pState;                   /* Accumulator pointer */
+  const float32_t *pWin = S->pWindow;            /* Window pointer */
+  uint32_t fftLen = S->fftLen;                   /* Frame length */
+  uint32_t hopSize = S->hopSize;                 /* Number of output samples */
+  uint32_t idx = S->stateIndex;                  /* Ring buffer position of the oldest sample */
+  uint32_t i;                                    /* Frame position */
+  uint32_t seg;                                  /* Contiguous segment length */
+
+  /* Inverse transform of the spectrum into the scratch buffer */
+  arm_rfft_fast_f32(&S->Srfft, pSrc, pScratch, 1U);
+
+  /* Walk the frame in segments that neither cross the end of the ring
+   * buffer nor the boundary between completed and pending samples. */
+  i = 0U;
+  while (i < fftLen)
+  {
+    seg = ((i < hopSize) ? hopSize : fftLen) - i;
+    if (seg > (fftLen - idx))
+    {
+      seg = fftLen - idx;
+    }
+
+    if (i < hopSize)
+    {
+      arm_istft_output_f32(pAcc + idx, pWin + i, pScratch + i, pDst + i, seg);
+    }
+    else
+    {
+      arm_istft_accumulate_f32(pAcc + idx, pWin + i, pScratch + i, seg);
+    }
+
+    i += seg;
+    idx += seg;
+    if (idx == fftLen)
+    {
+      idx = 0U;
+    }
+  }
+
+  /* The next output starts hopSize samples later */
+  idx = S->stateIndex + hopSize;
+  if (idx >= fftLen)
+  {
+    idx -= fftLen;
+  }
+  S->stateIndex = (uint16_t) idx;
+}
+
+/**
+ * @} end of STFT group
+ */
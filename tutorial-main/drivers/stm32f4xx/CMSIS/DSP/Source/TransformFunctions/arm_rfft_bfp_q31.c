@@ -0,0 +1,186 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_bfp_q31.c
+ * Description:  Block floating point Q31 real fast Fourier transform
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup RealFFT
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q31 RFFT/RIFFT in block floating point.
+ * @param[in]  S          points to an instance of the Q31 RFFT/RIFFT structure.
+ * @param[in]  pSrc       points to the input buffer, which is modified.
+ * @param[out] pDst       points to the output buffer.
+ * @param[out] pExponent  block exponent of the output.
+ * @return none.
+ *
+ * \par
+ * The block floating point counterpart of arm_rfft_q31(), with the same
+ * instance structure and buffer layouts. The complex transform is computed by
+ * arm_cfft_bfp_q31() and the split step between the complex and real
+ * transforms shifts its outputs right by one bit only when they could
+ * overflow. The inverse transform normalizes its input before the split step,
+ * so small spectra keep their precision.
+ * \par
+ * On return, <code>pDst[n] * 2^(*pExponent)</code> is the unnormalized
+ * transform, in the same Q31 units: the forward transform returns
+ * <code>X[k] = sum(x[n] * exp(-j*2*pi*k*n/fftLenReal))</code> and the
+ * inverse transform returns <code>x[n] = sum(X[k] * exp(j*2*pi*k*n/fftLenReal))</code>,
+ * without the <code>1/fftLenReal</code> factor.
+ */
+
+void arm_rfft_bfp_q31(
+  const arm_rfft_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  int32_t * pExponent)
+{
+  const q31_t *pCoefA, *pCoefB;                 /* Split twiddle factors */
+  uint32_t L2 = S->fftLenReal >> 1U;            /* Length of the complex transform */
+  uint32_t modifier = S->twidCoefRModifier;     /* Split twiddle table step */
+  q63_t s1r, s1i, s2r, s2i;                     /* Split inputs */
+  q63_t outR, outI;                             /* Split outputs */
+  uint32_t maxVal = 0U, in;                     /* Largest magnitude of the split inputs */
+  uint32_t shift;                               /* Shift of the split step */
+  int32_t norm;                                 /* Normalization of the inverse input */
+  int32_t exponent;                             /* Block exponent */
+  uint32_t i;                                   /* loop counter */
+
+  if (S->ifftFlagR == 1U)
+  {
+    /* The outputs of the split are bounded by twice its inputs */
+    for (i = 0U; i < (2U * L2) + 2U; i++)
+    {
+      in = (pSrc[i] < 0) ? -(uint32_t) pSrc[i] : (uint32_t) pSrc[i];
+      maxVal = (in > maxVal) ? in : maxVal;
+    }
+
+    /* Scale the input so that its largest magnitude is just below 0x40000000 */
+    norm = (int32_t) __CLZ((uint32_t) maxVal) - 2;
+
+    if (norm > 0)
+    {
+      for (i = 0U; i < (2U * L2) + 2U; i++)
+      {
+        pSrc[i] = (q31_t) ((uint32_t) pSrc[i] << norm);
+      }
+    }
+
+    shift = (norm < 0) ? (uint32_t) -norm : 0U;
+
+    /* Real IFFT core process, Z[k] = X[k] * conj(A[k]) + conj(X[L2-k]) * conj(B[k]) */
+    pCoefA = S->pTwiddleAReal;
+    pCoefB = S->pTwiddleBReal;
+
+    for (i = 0U; i < L2; i++)
+    {
+      s1r = pSrc[2U * i];
+      s1i = pSrc[(2U * i) + 1U];
+      s2r = pSrc[2U * (L2 - i)];
+      s2i = pSrc[(2U * (L2 - i)) + 1U];
+
+      outR = (s2r * pCoefB[0]) - (s2i * pCoefB[1]) + (s1r * pCoefA[0]) + (s1i * pCoefA[1]);
+      outI = (s1i * pCoefA[0]) - (s1r * pCoefA[1]) - (s2r * pCoefB[1]) - (s2i * pCoefB[0]);
+
+      pDst[2U * i] = clip_q63_to_q31((outR + ((q63_t) 1 << (30U + shift))) >> (31U + shift));
+      pDst[(2U * i) + 1U] = clip_q63_to_q31((outI + ((q63_t) 1 << (30U + shift))) >> (31U + shift));
+
+      pCoefA += 2U * modifier;
+      pCoefB += 2U * modifier;
+    }
+
+    /* Complex IFFT process */
+    arm_cfft_bfp_q31(S->pCfft, pDst, 1U, S->bitReverseFlagR, &exponent);
+
+    /* The inverse of the half length transform is half the real inverse */
+    exponent += 1 - norm;
+  }
+  else
+  {
+    /* Complex FFT process */
+    arm_cfft_bfp_q31(S->pCfft, pSrc, 0U, S->bitReverseFlagR, &exponent);
+
+    /* The outputs of the split are bounded by twice its inputs */
+    for (i = 0U; i < 2U * L2; i++)
+    {
+      in = (pSrc[i] < 0) ? -(uint32_t) pSrc[i] : (uint32_t) pSrc[i];
+      maxVal = (in > maxVal) ? in : maxVal;
+    }
+
+    shift = (maxVal > 0x3FFFFFFFU) ? 1U : 0U;
+
+    /* Real FFT core process, X[k] = Z[k] * A[k] + conj(Z[L2-k]) * B[k] */
+    pCoefA = &S->pTwiddleAReal[2U * modifier];
+    pCoefB = &S->pTwiddleBReal[2U * modifier];
+
+    for (i = 1U; i < L2; i++)
+    {
+      s1r = pSrc[2U * i];
+      s1i = pSrc[(2U * i) + 1U];
+      s2r = pSrc[2U * (L2 - i)];
+      s2i = pSrc[(2U * (L2 - i)) + 1U];
+
+      outR = (s1r * pCoefA[0]) - (s1i * pCoefA[1]) + (s2r * pCoefB[0]) + (s2i * pCoefB[1]);
+      outI = (s2r * pCoefB[1]) - (s2i * pCoefB[0]) + (s1i * pCoefA[0]) + (s1r * pCoefA[1]);
+
+      outR = clip_q63_to_q31((outR + ((q63_t) 1 << (30U + shift))) >> (31U + shift));
+      outI = clip_q63_to_q31((outI + ((q63_t) 1 << (30U + shift))) >> (31U + shift));
+
+      /* Output and its complex conjugate */
+      pDst[2U * i] = (q31_t) outR;
+      pDst[(2U * i) + 1U] = (q31_t) outI;
+      pDst[(4U * L2) - (2U * i)] = (q31_t) outR;
+      pDst[(4U * L2) - (2U * i) + 1U] = clip_q63_to_q31(-outI);
+
+      pCoefA += 2U * modifier;
+      pCoefB += 2U * modifier;
+    }
+
+    /* DC and Nyquist */
+    outR = (q63_t) pSrc[0] + pSrc[1];
+    outI = (q63_t) pSrc[0] - pSrc[1];
+    pDst[0] = clip_q63_to_q31((outR + (q63_t) shift) >> shift);
+    pDst[1] = 0;
+    pDst[2U * L2] = clip_q63_to_q31((outI + (q63_t) shift) >> shift);
+    pDst[(2U * L2) + 1U] = 0;
+
+    exponent += (int32_t) shift;
+  }
+
+  *pExponent = exponent;
+}
+
+/**
+ * @} end of RealFFT group
+ */
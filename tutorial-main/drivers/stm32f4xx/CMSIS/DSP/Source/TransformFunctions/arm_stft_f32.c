@@ -0,0 +1,367 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stft_f32.c
+ * Description:  Floating-point short-time Fourier transform
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @brief  Multiplies a block of samples by a block of window coefficients.
+ * @param[in]  *pSrc       points to the input samples.
+ * @param[in]  *pWin       points to the window coefficients.
+ * @param[out] *pDst       points to the output buffer.
+ * @param[in]  blockSize   number of samples to process.
+ * @return none.
+ */
+static void arm_stft_window_f32(
+  const float32_t * pSrc,
+  const float32_t * pWin,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t in1, in2, in3, in4;                  /* temporary input variables */
+  float32_t w1, w2, w3, w4;                      /* temporary window variables */
+
+  /* loop Unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* C = A * W */
+    in1 = pSrc[0];
+    w1 = pWin[0];
+    in2 = pSrc[1];
+    w2 = pWin[1];
+    in3 = pSrc[2];
+    w3 = pWin[2];
+    in4 = pSrc[3];
+    w4 = pWin[3];
+
+    pDst[0] = in1 * w1;
+    pDst[1] = in2 * w2;
+    pDst[2] = in3 * w3;
+    pDst[3] = in4 * w4;
+
+    pSrc += 4U;
+    pWin += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * W */
+    *pDst++ = (*pSrc++) * (*pWin++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @brief  Copies a block of new samples to the state buffer and multiplies them by a block of window coefficients.
+ * @param[in]  *pSrc       points to the input samples.
+ * @param[in]  *pWin       points to the window coefficients.
+ * @param[out] *pState     points to the state buffer.
+ * @param[out] *pDst       points to the output buffer.
+ * @param[in]  blockSize   number of samples to process.
+ * @return none.
+ */
+static void arm_stft_store_window_f32(
+  const float32_t * pSrc,
+  const float32_t * pWin,
+  float32_t * pState,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+  float32_t in;                                  /* temporary input variable */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t in2, in3, in4;                       /* temporary input variables */
+
+  /* loop Unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* S = A, C = A * W */
+    in = pSrc[0];
+    in2 = pSrc[1];
+    in3 = pSrc[2];
+    in4 = pSrc[3];
+
+    pState[0] = in;
+    pState[1] = in2;
+    pState[2] = in3;
+    pState[3] = in4;
+
+    pDst[0] = in * pWin[0];
+    pDst[1] = in2 * pWin[1];
+    pDst[2] = in3 * pWin[2];
+    pDst[3] = in4 * pWin[3];
+
+    pSrc += 4U;
+    pWin += 4U;
+    pState += 4U;
+    pDst += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* S = A, C = A * W */
+    in = *pSrc++;
+    *pState++ = in;
+    *pDst++ = in * (*pWin++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup STFT Short-Time Fourier Transform
+ *
+ * \par
+ * The short-time Fourier transform computes the spectrum of overlapping, windowed
+ * frames of a continuous real signal. Each call to arm_stft_f32() consumes
+ * <code>hopSize</code> new samples and produces the spectrum of the last
+ * <code>fftLen</code> samples. arm_istft_f32() performs the inverse operation: each
+ * call takes one spectrum, applies the synthesis window and overlap-adds the frame
+ * into an accumulator, producing <code>hopSize</code> output samples.
+ * \par
+ * The usual way to get the same result with the other library functions is a chain
+ * of calls: shift the history buffer with arm_copy_f32(), window it into a second
+ * buffer with arm_mult_f32(), transform it with arm_rfft_fast_f32() into a third buffer
+ * and finally compute the magnitudes with arm_cmplx_mag_f32() into a fourth buffer.
+ * The STFT functions avoid the intermediate passes:
+ * - The history is kept in a ring buffer, so the <code>fftLen - hopSize</code> old
+ *   samples are never moved. Only the <code>hopSize</code> new samples are written.
+ * - Unwrapping the ring buffer and applying the window is a single pass that writes
+ *   straight into the buffer that is transformed in place by the complex FFT stage.
+ *   The new samples are windowed while they are copied into the ring buffer.
+ * - Magnitude and power spectra are computed in one pass from the packed spectrum,
+ *   which is kept in the second half of the scratch buffer.
+ * \par
+ * Per hop, the chained calls read and write about <code>2*(fftLen-hopSize)</code> values to
+ * shift the history, <code>3*fftLen</code> values for the window multiplication and
+ * <code>1.5*fftLen</code> values for the magnitude, plus the FFT itself, spread over four buffers.
+ * The STFT reads and writes <code>3*fftLen + hopSize</code> values to build the frame
+ * and <code>1.5*fftLen</code> values for the magnitude, using the state buffer,
+ * one scratch buffer and the output buffer.
+ * \par
+ * The spectrum format is selected per call with ::arm_stft_spectrum_type:
+ * - ARM_STFT_COMPLEX: <code>fftLen</code> values packed as in arm_rfft_fast_f32(), that is
+ *   {X[0], X[fftLen/2], real[1], imag[1], ..., real[fftLen/2-1], imag[fftLen/2-1]}.
+ *   This is also the input format of arm_istft_f32().
+ * - ARM_STFT_MAGNITUDE: <code>fftLen/2+1</code> magnitudes from DC to Nyquist.
+ * - ARM_STFT_POWER: <code>fftLen/2+1</code> squared magnitudes from DC to Nyquist.
+ * \par
+ * The forward and inverse transforms are unnormalized and normalized respectively,
+ * as for arm_rfft_fast_f32(). Perfect reconstruction requires the analysis and synthesis
+ * windows to satisfy the constant overlap-add condition for the chosen hop size, for
+ * example a periodic sqrt-Hann window for both with <code>hopSize = fftLen/2</code>.
+ * \par Instance Structure
+ * A separate instance structure must be defined for the analysis and the synthesis
+ * side. The instance holds the internal RFFT instance, the frame and hop sizes, the
+ * window pointer and the state ring buffer.
+ * \par Initialization Function
+ * arm_stft_init_f32() initializes both the forward and the inverse instances and clears
+ * the state buffer.
+ */
+
+/**
+ * @addtogroup STFT
+ * @{
+ */
+
+/**
+* @brief Processing function for the floating-point STFT.
+* @param[in,out] *S             points to an arm_stft_instance_f32 structure.
+* @param[in]     *pSrc          points to <code>hopSize</code> new input samples.
+* @param[in]     *pScratch      points to a scratch buffer, see below for its length.
+* @param[out]    *pDst          points to the output spectrum.
+* @param[in]     spectrumType   selects the output format.
+* @return none.
+*
+* \par
+* <code>pDst</code> must hold <code>fftLen</code> values for ARM_STFT_COMPLEX and
+* <code>fftLen/2+1</code> values otherwise. <code>pScratch</code> must hold
+* <code>fftLen</code> values for ARM_STFT_COMPLEX and <code>2*fftLen</code> values
+* otherwise, as the packed spectrum is then written to its second half.
+* <code>pScratch</code> and <code>pDst</code> must not overlap.
+*/
+void arm_stft_f32(
+  arm_stft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pScratch,
+  float32_t * pDst,
+  arm_stft_spectrum_type spectrumType)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pWin = S->pWindow;            /* Window pointer */
+  uint32_t fftLen = S->fftLen;                   /* Frame length */
+  uint32_t hopSize = S->hopSize;                 /* Number of new samples */
+  uint32_t oldLen = fftLen - hopSize;            /* Number of samples kept from the previous frames */
+  uint32_t idx;                                  /* Ring buffer position of the oldest kept sample */
+  uint32_t seg;                                  /* Contiguous segment length */
+  uint32_t k;                                    /* Loop counter */
+  float32_t re, im, nyquist;                     /* Temporary variables */
+  float32_t *pIn, *pOut;                         /* Temporary pointers */
+  float32_t *pSpec;                              /* Packed spectrum */
+
+  /* The oldest hopSize samples are dropped. The frame starts with the
+   * remaining oldLen samples of the ring buffer followed by the new samples. */
+  idx = S->stateIndex + hopSize;
+  if (idx >= fftLen)
+  {
+    idx -= fftLen;
+  }
+
+  /* Unwrap the kept samples and apply the window in one pass */
+  seg = fftLen - idx;
+  if (seg > oldLen)
+  {
+    seg = oldLen;
+  }
+  arm_stft_window_f32(pState + idx, pWin, pScratch, seg);
+  arm_stft_window_f32(pState, pWin + seg, pScratch + seg, oldLen - seg);
+
+  /* Store the new samples over the dropped ones and window them on the way */
+  idx = S->stateIndex;
+  seg = fftLen - idx;
+  if (seg > hopSize)
+  {
+    seg = hopSize;
+  }
+  arm_stft_store_window_f32(pSrc, pWin + oldLen, pState + idx, pScratch + oldLen, seg);
+  arm_stft_store_window_f32(pSrc + seg, pWin + oldLen + seg, pState, pScratch + oldLen + seg, hopSize - seg);
+
+  /* Update the ring buffer position of the oldest sample */
+  idx += hopSize;
+  if (idx >= fftLen)
+  {
+    idx -= fftLen;
+  }
+  S->stateIndex = (uint16_t) idx;
+
+  /* Transform the windowed frame. The scratch buffer is used in place by the CFFT stage. */
+  if (spectrumType == ARM_STFT_COMPLEX)
+  {
+    arm_rfft_fast_f32(&S->Srfft, pScratch, pDst, 0U);
+    return;
+  }
+
+  /* The packed spectrum holds fftLen values, more than the fftLen/2+1 of pDst,
+   * so it goes to the second half of the scratch buffer. */
+  pSpec = pScratch + fftLen;
+  arm_rfft_fast_f32(&S->Srfft, pScratch, pSpec, 0U);
+
+  /* Unpack DC and Nyquist and compute the spectrum */
+  nyquist = pSpec[1];
+  pIn = pSpec + 2U;
+  pOut = pDst + 1U;
+  k = (fftLen >> 1U) - 1U;
+
+  if (spectrumType == ARM_STFT_POWER)
+  {
+    pDst[0] = pSpec[0] * pSpec[0];
+
+    while (k > 0U)
+    {
+      re = *pIn++;
+      im = *pIn++;
+      *pOut++ = (re * re) + (im * im);
+
+      /* Decrement the loop counter */
+      k--;
+    }
+
+    *pOut = nyquist * nyquist;
+  }
+  else
+  {
+    pDst[0] = fabsf(pSpec[0]);
+
+    while (k > 0U)
+    {
+      re = *pIn++;
+      im = *pIn++;
+      arm_sqrt_f32((re * re) + (im * im), pOut++);
+
+      /* Decrement the loop counter */
+      k--;
+    }
+
+    *pOut = fabsf(nyquist);
+  }
+}
+
+/**
+ * @} end of STFT group
+ */
@@ -0,0 +1,95 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stft_init_f32.c
+ * Description:  Initialization function for the floating-point STFT/ISTFT
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup STFT
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the floating-point STFT/ISTFT.
+* @param[in,out] *S             points to an arm_stft_instance_f32 structure.
+* @param[in]     fftLen         length of the analysis/synthesis frame.
+* @param[in]     hopSize        frame advance in samples.
+* @param[in]     *pWindow       points to the window coefficients of length <code>fftLen</code>.
+* @param[in]     *pState        points to the state buffer of length <code>fftLen</code>.
+* @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported value or <code>hopSize</code> is not in the range [1, fftLen].
+*
+* \par Description:
+* \par
+* Supported lengths for <code>fftLen</code> are the ones supported by arm_rfft_fast_init_f32(): 32, 64, 128, 256, 512, 1024, 2048, 4096.
+* \par
+* The same instance type is used by arm_stft_f32() and arm_istft_f32(). For the forward
+* transform <code>pWindow</code> is the analysis window and <code>pState</code> holds the
+* last <code>fftLen</code> input samples. For the inverse transform <code>pWindow</code>
+* is the synthesis window and <code>pState</code> holds the overlap-add accumulator.
+* The state buffer is cleared by this function.
+*/
+arm_status arm_stft_init_f32(
+  arm_stft_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t hopSize,
+  const float32_t * pWindow,
+  float32_t * pState)
+{
+  arm_status status;
+
+  if ((hopSize == 0U) || (hopSize > fftLen))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Initialise the internal real FFT instance */
+  status = arm_rfft_fast_init_f32(&S->Srfft, fftLen);
+
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  S->fftLen = fftLen;
+  S->hopSize = hopSize;
+  S->stateIndex = 0U;
+  S->pWindow = pWindow;
+  S->pState = pState;
+
+  /* Clear the state buffer */
+  memset(pState, 0, fftLen * sizeof(float32_t));
+
+  return (status);
+}
+
+/**
+ * @} end of STFT group
+ */
@@ -58,6 +58,16 @@
  * This example model implementation needs 32.3 KB to store weights, 40 KB for activations and 
  * 3.1 KB for storing the \c im2col data.
  *
+ * \par
+ * The same network is then run as a graph, described by the layer list \c cifar10_layers.
+ * The graph planner packs the activations and the \c im2col data into one 40 KB arena,
+ * so the graph runs in \c scratch_buffer alone. The outputs of both runs are compared.
+ *
+ * \par
+ * Finally the network is run with the fused convolution, ReLU and max pooling functions,
+ * which do not store the convolution outputs. The largest activation is then the 16x16x32
+ * output of the first pooling layer, and the activations fit in 11 KB.
+ *
  * \image html CIFAR10_CNN.gif "Neural Network model definition"
  *
  * \par Variables Description:
@@ -65,10 +75,13 @@
  * \li \c conv1_wt, \c conv2_wt, \c conv3_wt are convolution layer weight matrices
  * \li \c conv1_bias, \c conv2_bias, \c conv3_bias are convolution layer bias arrays
  * \li \c ip1_wt, ip1_bias point to fully-connected layer weights and biases
+ * \li \c weights holds all of the above in one blob, addressed by offset from the graph layers
+ * \li \c cifar10_layers is the layer list of the graph
  * \li \c input_data points to the input image data
  * \li \c output_data points to the classification output
  * \li \c col_buffer is a buffer to store the \c im2col output
  * \li \c scratch_buffer is used to store the activation data (intermediate layer outputs)
+ * \li \c pool_buffer holds the two output pixels of the fused functions before pooling
  *
  * \par CMSIS DSP Software Library Functions Used:
  * \par
@@ -79,6 +92,10 @@
  * - arm_avepool_q7_HWC()
  * - arm_fully_connected_q7_opt()
  * - arm_fully_connected_q7()
+ * - arm_nn_graph_plan_q7()
+ * - arm_nn_graph_run_q7()
+ * - arm_convolve_HWC_q7_RGB_relu_maxpool()
+ * - arm_convolve_HWC_q7_fast_relu_maxpool()
  *
  * <b> Refer  </b>
  * \link arm_nnexamples_cifar10.cpp \endlink
@@ -86,8 +103,10 @@
  * \par [1] https://github.com/BVLC/caffe
  */
 
+#include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 #include "arm_math.h"
 #include "arm_nnexamples_cifar10_parameter.h"
 #include "arm_nnexamples_cifar10_weights.h"
@@ -104,17 +123,87 @@
 
 // include the input and weights
 
-static q7_t conv1_wt[CONV1_IM_CH * CONV1_KER_DIM * CONV1_KER_DIM * CONV1_OUT_CH] = CONV1_WT;
-static q7_t conv1_bias[CONV1_OUT_CH] = CONV1_BIAS;
+// all weights in one blob, so that the graph layers can address them by offset
+typedef struct
+{
+  q7_t conv1_wt[CONV1_IM_CH * CONV1_KER_DIM * CONV1_KER_DIM * CONV1_OUT_CH];
+  q7_t conv1_bias[CONV1_OUT_CH];
+
+  q7_t conv2_wt[CONV2_IM_CH * CONV2_KER_DIM * CONV2_KER_DIM * CONV2_OUT_CH];
+  q7_t conv2_bias[CONV2_OUT_CH];
+
+  q7_t conv3_wt[CONV3_IM_CH * CONV3_KER_DIM * CONV3_KER_DIM * CONV3_OUT_CH];
+  q7_t conv3_bias[CONV3_OUT_CH];
+
+  q7_t ip1_wt[IP1_DIM * IP1_OUT];
+  q7_t ip1_bias[IP1_OUT];
+} cifar10_weights_t;
+
+static const cifar10_weights_t weights = {
+  CONV1_WT, CONV1_BIAS,
+  CONV2_WT, CONV2_BIAS,
+  CONV3_WT, CONV3_BIAS,
+  IP1_WT, IP1_BIAS
+};
+
+static const q7_t *conv1_wt = weights.conv1_wt;
+static const q7_t *conv1_bias = weights.conv1_bias;
+
+static const q7_t *conv2_wt = weights.conv2_wt;
+static const q7_t *conv2_bias = weights.conv2_bias;
+
+static const q7_t *conv3_wt = weights.conv3_wt;
+static const q7_t *conv3_bias = weights.conv3_bias;
+
+static const q7_t *ip1_wt = weights.ip1_wt;
+static const q7_t *ip1_bias = weights.ip1_bias;
+
+#define WT_OFFSET(x) offsetof(cifar10_weights_t, x)
+
+/*
+ * The same network as a layer list. Tensor 0 is the input image, tensors 1, 3
+ * and 5 are the conv outputs, rectified in-place, tensors 2, 4 and 6 are the
+ * pool outputs and tensor 7 is the output of ip1 and softmax.
+ *
+ * {op, in, out, dimIn, chIn, dimOut, chOut, dimKernel, padding, stride, biasShift, outShift, wtOffset, biasOffset}
+ */
+#define CIFAR10_NUM_TENSORS 8
+#define CIFAR10_NUM_LAYERS 11
+
+static const arm_nn_layer_q7 cifar10_layers[CIFAR10_NUM_LAYERS] = {
+  {ARM_NN_CONV_HWC_Q7_RGB, 0, 1, CONV1_IM_DIM, CONV1_IM_CH, CONV1_OUT_DIM, CONV1_OUT_CH,
+   CONV1_KER_DIM, CONV1_PADDING, CONV1_STRIDE, CONV1_BIAS_LSHIFT, CONV1_OUT_RSHIFT,
+   WT_OFFSET(conv1_wt), WT_OFFSET(conv1_bias)},
+  {ARM_NN_RELU_Q7, 1, 1, CONV1_OUT_DIM, CONV1_OUT_CH, CONV1_OUT_DIM, CONV1_OUT_CH, 0, 0, 0, 0, 0, 0, 0},
+  {ARM_NN_MAXPOOL_HWC_Q7, 1, 2, CONV1_OUT_DIM, CONV1_OUT_CH, POOL1_OUT_DIM, CONV1_OUT_CH,
+   POOL1_KER_DIM, POOL1_PADDING, POOL1_STRIDE, 0, 0, 0, 0},
+
+  {ARM_NN_CONV_HWC_Q7_FAST, 2, 3, CONV2_IM_DIM, CONV2_IM_CH, CONV2_OUT_DIM, CONV2_OUT_CH,
+   CONV2_KER_DIM, CONV2_PADDING, CONV2_STRIDE, CONV2_BIAS_LSHIFT, CONV2_OUT_RSHIFT,
+   WT_OFFSET(conv2_wt), WT_OFFSET(conv2_bias)},
+  {ARM_NN_RELU_Q7, 3, 3, CONV2_OUT_DIM, CONV2_OUT_CH, CONV2_OUT_DIM, CONV2_OUT_CH, 0, 0, 0, 0, 0, 0, 0},
+  {ARM_NN_MAXPOOL_HWC_Q7, 3, 4, CONV2_OUT_DIM, CONV2_OUT_CH, POOL2_OUT_DIM, CONV2_OUT_CH,
+   POOL2_KER_DIM, POOL2_PADDING, POOL2_STRIDE, 0, 0, 0, 0},
+
+  {ARM_NN_CONV_HWC_Q7_FAST, 4, 5, CONV3_IM_DIM, CONV3_IM_CH, CONV3_OUT_DIM, CONV3_OUT_CH,
+   CONV3_KER_DIM, CONV3_PADDING, CONV3_STRIDE, CONV3_BIAS_LSHIFT, CONV3_OUT_RSHIFT,
+   WT_OFFSET(conv3_wt), WT_OFFSET(conv3_bias)},
+  {ARM_NN_RELU_Q7, 5, 5, CONV3_OUT_DIM, CONV3_OUT_CH, CONV3_OUT_DIM, CONV3_OUT_CH, 0, 0, 0, 0, 0, 0, 0},
+  {ARM_NN_MAXPOOL_HWC_Q7, 5, 6, CONV3_OUT_DIM, CONV3_OUT_CH, POOL3_OUT_DIM, CONV3_OUT_CH,
+   POOL3_KER_DIM, POOL3_PADDING, POOL3_STRIDE, 0, 0, 0, 0},
 
-static q7_t conv2_wt[CONV2_IM_CH * CONV2_KER_DIM * CONV2_KER_DIM * CONV2_OUT_CH] = CONV2_WT;
-static q7_t conv2_bias[CONV2_OUT_CH] = CONV2_BIAS;
+  {ARM_NN_FULLY_CONNECTED_Q7_OPT, 6, 7, 1, IP1_DIM, 1, IP1_OUT,
+   0, 0, 0, IP1_BIAS_LSHIFT, IP1_OUT_RSHIFT,
+   WT_OFFSET(ip1_wt), WT_OFFSET(ip1_bias)},
+  {ARM_NN_SOFTMAX_Q7, 7, 7, 1, IP1_OUT, 1, IP1_OUT, 0, 0, 0, 0, 0, 0, 0}
+};
 
-static q7_t conv3_wt[CONV3_IM_CH * CONV3_KER_DIM * CONV3_KER_DIM * CONV3_OUT_CH] = CONV3_WT;
-static q7_t conv3_bias[CONV3_OUT_CH] = CONV3_BIAS;
+static const arm_nn_graph_q7 cifar10_graph = {CIFAR10_NUM_LAYERS, CIFAR10_NUM_TENSORS, cifar10_layers,
+                                              (const q7_t *) &weights};
 
-static q7_t ip1_wt[IP1_DIM * IP1_OUT] = IP1_WT;
-static q7_t ip1_bias[IP1_OUT] = IP1_BIAS;
+uint32_t  tensor_offset[CIFAR10_NUM_TENSORS];
+uint32_t  scratch_offset[CIFAR10_NUM_LAYERS];
+uint32_t  plan_work[ARM_NN_GRAPH_PLAN_WORK_SIZE(CIFAR10_NUM_TENSORS, CIFAR10_NUM_LAYERS)];
 
 /* Here the image_data should be the raw uint8 type RGB image in [RGB, RGB, RGB ... RGB] format */
 uint8_t   image_data[CONV1_IM_CH * CONV1_IM_DIM * CONV1_IM_DIM] = IMG_DATA;
@@ -125,6 +214,24 @@ q7_t      col_buffer[2 * 5 * 5 * 32 * 2];
 
 q7_t      scratch_buffer[32 * 32 * 10 * 4];
 
+// two output pixels of the fused convolution, ReLU and max pooling
+q7_t      pool_buffer[2 * 32];
+
+/* input pre-processing */
+static void preprocess_image(q7_t * img_buffer)
+{
+  int mean_data[3] = INPUT_MEAN_SHIFT;
+  unsigned int scale_data[3] = INPUT_RIGHT_SHIFT;
+  for (int i=0;i<32*32*3; i+=3) {
+    img_buffer[i] =   (q7_t)__SSAT( ((((int)image_data[i]   - mean_data[0])<<7) + (0x1<<(scale_data[0]-1)))
+                             >> scale_data[0], 8);
+    img_buffer[i+1] = (q7_t)__SSAT( ((((int)image_data[i+1] - mean_data[1])<<7) + (0x1<<(scale_data[1]-1)))
+                             >> scale_data[1], 8);
+    img_buffer[i+2] = (q7_t)__SSAT( ((((int)image_data[i+2] - mean_data[2])<<7) + (0x1<<(scale_data[2]-1)))
+                             >> scale_data[2], 8);
+  }
+}
+
 int main()
 {
   #ifdef RTE_Compiler_EventRecorder
@@ -137,17 +244,7 @@ int main()
   q7_t     *img_buffer1 = scratch_buffer;
   q7_t     *img_buffer2 = img_buffer1 + 32 * 32 * 32;
 
-  /* input pre-processing */
-  int mean_data[3] = INPUT_MEAN_SHIFT;
-  unsigned int scale_data[3] = INPUT_RIGHT_SHIFT;
-  for (int i=0;i<32*32*3; i+=3) {
-    img_buffer2[i] =   (q7_t)__SSAT( ((((int)image_data[i]   - mean_data[0])<<7) + (0x1<<(scale_data[0]-1)))
-                             >> scale_data[0], 8);
-    img_buffer2[i+1] = (q7_t)__SSAT( ((((int)image_data[i+1] - mean_data[1])<<7) + (0x1<<(scale_data[1]-1)))
-                             >> scale_data[1], 8);
-    img_buffer2[i+2] = (q7_t)__SSAT( ((((int)image_data[i+2] - mean_data[2])<<7) + (0x1<<(scale_data[2]-1)))
-                             >> scale_data[2], 8);
-  }
+  preprocess_image(img_buffer2);
   
   // conv1 img_buffer2 -> img_buffer1
   arm_convolve_HWC_q7_RGB(img_buffer2, CONV1_IM_DIM, CONV1_IM_CH, conv1_wt, CONV1_OUT_CH, CONV1_KER_DIM, CONV1_PADDING,
@@ -192,5 +289,75 @@ int main()
       printf("%d: %d\n", i, output_data[i]);
   }
 
+  /* run the same network as a graph, with the arena in scratch_buffer */
+  arm_nn_graph_plan plan = {0, tensor_offset, scratch_offset};
+
+  if (arm_nn_graph_plan_q7(&cifar10_graph, &plan, plan_work) != ARM_MATH_SUCCESS
+      || plan.arenaSize > sizeof(scratch_buffer))
+  {
+      printf("graph planning failed\n");
+      return 1;
+  }
+
+  printf("activation RAM: hand-written %d bytes, graph %d bytes\n",
+         (int) (sizeof(scratch_buffer) + sizeof(col_buffer)), (int) plan.arenaSize);
+
+  preprocess_image(scratch_buffer + tensor_offset[0]);
+
+  if (arm_nn_graph_run_q7(&cifar10_graph, &plan, scratch_buffer) != ARM_MATH_SUCCESS)
+  {
+      printf("graph execution failed\n");
+      return 1;
+  }
+
+  if (memcmp(scratch_buffer + tensor_offset[7], output_data, sizeof(output_data)) == 0)
+  {
+      printf("graph output matches\n");
+  } else
+  {
+      printf("graph output mismatch\n");
+  }
+
+  /* run the same network with the fused layers, the convolution outputs are never stored */
+  q7_t     *fused_buffer1 = scratch_buffer;
+  q7_t     *fused_buffer2 = fused_buffer1 + POOL1_OUT_DIM * POOL1_OUT_DIM * CONV1_OUT_CH;
+
+  preprocess_image(fused_buffer2);
+
+  // conv1, relu1 and pool1 fused_buffer2 -> fused_buffer1
+  arm_convolve_HWC_q7_RGB_relu_maxpool(fused_buffer2, CONV1_IM_DIM, CONV1_IM_CH, conv1_wt, CONV1_OUT_CH,
+                                       CONV1_KER_DIM, CONV1_PADDING, CONV1_STRIDE, conv1_bias, CONV1_BIAS_LSHIFT,
+                                       CONV1_OUT_RSHIFT, CONV1_OUT_DIM, POOL1_KER_DIM, POOL1_PADDING, POOL1_STRIDE,
+                                       fused_buffer1, POOL1_OUT_DIM, (q15_t *) col_buffer, pool_buffer);
+
+  // conv2, relu2 and pool2 fused_buffer1 -> fused_buffer2
+  arm_convolve_HWC_q7_fast_relu_maxpool(fused_buffer1, CONV2_IM_DIM, CONV2_IM_CH, conv2_wt, CONV2_OUT_CH,
+                                        CONV2_KER_DIM, CONV2_PADDING, CONV2_STRIDE, conv2_bias, CONV2_BIAS_LSHIFT,
+                                        CONV2_OUT_RSHIFT, CONV2_OUT_DIM, POOL2_KER_DIM, POOL2_PADDING, POOL2_STRIDE,
+                                        fused_buffer2, POOL2_OUT_DIM, (q15_t *) col_buffer, pool_buffer);
+
+  // conv3, relu3 and pool3 fused_buffer2 -> fused_buffer1
+  arm_convolve_HWC_q7_fast_relu_maxpool(fused_buffer2, CONV3_IM_DIM, CONV3_IM_CH, conv3_wt, CONV3_OUT_CH,
+                                        CONV3_KER_DIM, CONV3_PADDING, CONV3_STRIDE, conv3_bias, CONV3_BIAS_LSHIFT,
+                                        CONV3_OUT_RSHIFT, CONV3_OUT_DIM, POOL3_KER_DIM, POOL3_PADDING, POOL3_STRIDE,
+                                        fused_buffer1, POOL3_OUT_DIM, (q15_t *) col_buffer, pool_buffer);
+
+  arm_fully_connected_q7_opt(fused_buffer1, ip1_wt, IP1_DIM, IP1_OUT, IP1_BIAS_LSHIFT, IP1_OUT_RSHIFT, ip1_bias,
+                             fused_buffer2, (q15_t *) col_buffer);
+
+  arm_softmax_q7(fused_buffer2, IP1_OUT, fused_buffer2);
+
+  printf("activation RAM: fused %d bytes\n",
+         (int) (POOL1_OUT_DIM * POOL1_OUT_DIM * CONV1_OUT_CH + CONV1_IM_DIM * CONV1_IM_DIM * CONV1_IM_CH
+                + sizeof(col_buffer) + sizeof(pool_buffer)));
+
+  if (memcmp(fused_buffer2, output_data, sizeof(output_data)) == 0)
+  {
+      printf("fused output matches\n");
+  } else
+  {
+      printf("fused output mismatch\n");
+  }
+
   return 0;
 }
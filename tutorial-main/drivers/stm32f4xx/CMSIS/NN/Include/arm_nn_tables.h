@@ -56,4 +56,7 @@ extern const q15_t sigmoidLTable_q15[128];
 extern const q15_t sigmoidLTable_q15[128];
 extern const q15_t sigmoidHTable_q15[192];
 
+extern const q15_t tanhLTable_q15[128];
+extern const q15_t tanhHTable_q15[192];
+
 #endif                          /*  ARM_NN_TABLES_H */
@@ -43,6 +43,8 @@
    * - Fully-connected Layer Functions
    * - Neural Network Pooling Functions
    * - Softmax Functions
+   * - Neural Network Recurrent Functions
+   * - Neural Network Quantization Functions
    * - Neural Network Support Functions
    *
    * The library has separate functions for operating on different weight and activation data
@@ -431,6 +433,107 @@ extern    "C"
                                        q15_t * bufferA, 
                                        q7_t * bufferB);
 
+  /**
+   * @brief Fast Q7 convolution function with fused ReLU and max pooling
+   * @param[in]       Im_in           pointer to input tensor
+   * @param[in]       dim_im_in       input tensor dimention
+   * @param[in]       ch_im_in        number of input tensor channels
+   * @param[in]       wt              pointer to kernel weights
+   * @param[in]       ch_im_out       number of filters, i.e., output tensor channels
+   * @param[in]       dim_kernel      filter kernel size
+   * @param[in]       padding         padding sizes
+   * @param[in]       stride          convolution stride
+   * @param[in]       bias            pointer to bias
+   * @param[in]       bias_shift      amount of left-shift for bias
+   * @param[in]       out_shift       amount of right-shift for output
+   * @param[in]       dim_conv_out    convolution output dimension
+   * @param[in]       dim_pool_kernel pooling kernel size
+   * @param[in]       pool_padding    pooling padding size
+   * @param[in]       pool_stride     pooling stride
+   * @param[in,out]   Im_out          pointer to output tensor
+   * @param[in]       dim_im_out      output tensor dimension, i.e., pooling output dimension
+   * @param[in,out]   bufferA         pointer to buffer space for input 
+   * @param[in,out]   bufferB         pointer to buffer space for output
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   *
+   * Same results as arm_convolve_HWC_q7_fast followed by arm_relu_q7 and
+   * arm_maxpool_q7_HWC, without storing the convolution output. A pooling
+   * kernel of 1 with stride 1 and no padding disables the pooling.
+   * Same constraints as arm_convolve_HWC_q7_fast, and bufferB holds
+   * 2*ch_im_out bytes when pooling.
+   */
+
+    arm_status arm_convolve_HWC_q7_fast_relu_maxpool(const q7_t * Im_in,
+                                                     const uint16_t dim_im_in,
+                                                     const uint16_t ch_im_in,
+                                                     const q7_t * wt,
+                                                     const uint16_t ch_im_out,
+                                                     const uint16_t dim_kernel,
+                                                     const uint16_t padding,
+                                                     const uint16_t stride,
+                                                     const q7_t * bias,
+                                                     const uint16_t bias_shift,
+                                                     const uint16_t out_shift,
+                                                     const uint16_t dim_conv_out,
+                                                     const uint16_t dim_pool_kernel,
+                                                     const uint16_t pool_padding,
+                                                     const uint16_t pool_stride,
+                                                     q7_t * Im_out,
+                                                     const uint16_t dim_im_out,
+                                                     q15_t * bufferA,
+                                                     q7_t * bufferB);
+
+  /**
+   * @brief Q7 convolution function for RGB image with fused ReLU and max pooling
+   * @param[in]       Im_in           pointer to input tensor
+   * @param[in]       dim_im_in       input tensor dimention
+   * @param[in]       ch_im_in        number of input tensor channels
+   * @param[in]       wt              pointer to kernel weights
+   * @param[in]       ch_im_out       number of filters, i.e., output tensor channels
+   * @param[in]       dim_kernel      filter kernel size
+   * @param[in]       padding         padding sizes
+   * @param[in]       stride          convolution stride
+   * @param[in]       bias            pointer to bias
+   * @param[in]       bias_shift      amount of left-shift for bias
+   * @param[in]       out_shift       amount of right-shift for output
+   * @param[in]       dim_conv_out    convolution output dimension
+   * @param[in]       dim_pool_kernel pooling kernel size
+   * @param[in]       pool_padding    pooling padding size
+   * @param[in]       pool_stride     pooling stride
+   * @param[in,out]   Im_out          pointer to output tensor
+   * @param[in]       dim_im_out      output tensor dimension, i.e., pooling output dimension
+   * @param[in,out]   bufferA         pointer to buffer space for input 
+   * @param[in,out]   bufferB         pointer to buffer space for output
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   *
+   * Same results as arm_convolve_HWC_q7_RGB followed by arm_relu_q7 and
+   * arm_maxpool_q7_HWC, without storing the convolution output. A pooling
+   * kernel of 1 with stride 1 and no padding disables the pooling.
+   * ch_im_in equals 3, and bufferB holds 2*ch_im_out bytes when pooling.
+   */
+
+    arm_status arm_convolve_HWC_q7_RGB_relu_maxpool(const q7_t * Im_in,
+                                                    const uint16_t dim_im_in,
+                                                    const uint16_t ch_im_in,
+                                                    const q7_t * wt,
+                                                    const uint16_t ch_im_out,
+                                                    const uint16_t dim_kernel,
+                                                    const uint16_t padding,
+                                                    const uint16_t stride,
+                                                    const q7_t * bias,
+                                                    const uint16_t bias_shift,
+                                                    const uint16_t out_shift,
+                                                    const uint16_t dim_conv_out,
+                                                    const uint16_t dim_pool_kernel,
+                                                    const uint16_t pool_padding,
+                                                    const uint16_t pool_stride,
+                                                    q7_t * Im_out,
+                                                    const uint16_t dim_im_out,
+                                                    q15_t * bufferA,
+                                                    q7_t * bufferB);
+
   /**
    * @brief Fast Q15 convolution function
    * @param[in]       Im_in       pointer to input tensor
@@ -629,6 +732,323 @@ extern    "C"
                                                              q15_t * bufferA,
                                                              q7_t * bufferB);
 
+  /**
+   * @brief Q7 depthwise convolution function
+   * @param[in]       Im_in       pointer to input tensor
+   * @param[in]       dim_im_in   input tensor dimention
+   * @param[in]       ch_im_in    number of input tensor channels
+   * @param[in]       wt          pointer to kernel weights
+   * @param[in]       ch_im_out   number of filters, i.e., output tensor channels
+   * @param[in]       dim_kernel  filter kernel size
+   * @param[in]       padding     padding sizes
+   * @param[in]       stride      convolution stride
+   * @param[in]       bias        pointer to bias
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for output
+   * @param[in,out]   Im_out      pointer to output tensor
+   * @param[in]       dim_im_out  output tensor dimension
+   * @param[in,out]   bufferA     pointer to buffer space for the tap offsets
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   *
+   * Same results as arm_depthwise_separable_conv_HWC_q7 for any number of
+   * channels, without the im2col copy. bufferA holds 4*dim_kernel*dim_kernel
+   * Q15 values and must be 4-byte aligned.
+   */
+
+    arm_status arm_depthwise_conv_HWC_q7(const q7_t * Im_in,
+                                         const uint16_t dim_im_in,
+                                         const uint16_t ch_im_in,
+                                         const q7_t * wt,
+                                         const uint16_t ch_im_out,
+                                         const uint16_t dim_kernel,
+                                         const uint16_t padding,
+                                         const uint16_t stride,
+                                         const q7_t * bias,
+                                         const uint16_t bias_shift,
+                                         const uint16_t out_shift,
+                                         q7_t * Im_out,
+                                         const uint16_t dim_im_out,
+                                         q15_t * bufferA);
+
+  /**
+   * @brief Q7 depthwise convolution function with a 3x3 kernel
+   * @param[in]       Im_in       pointer to input tensor
+   * @param[in]       dim_im_in   input tensor dimention
+   * @param[in]       ch_im_in    number of input tensor channels
+   * @param[in]       wt          pointer to kernel weights
+   * @param[in]       ch_im_out   number of filters, i.e., output tensor channels
+   * @param[in]       padding     padding sizes
+   * @param[in]       stride      convolution stride, 1 or 2
+   * @param[in]       bias        pointer to bias
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for output
+   * @param[in,out]   Im_out      pointer to output tensor
+   * @param[in]       dim_im_out  output tensor dimension
+   * @return     The function returns <code>ARM_MATH_ARGUMENT_ERROR</code> if stride is not 1 or 2,
+   * <code>ARM_MATH_SIZE_MISMATCH</code> if ch_im_in differs from ch_im_out, or <code>ARM_MATH_SUCCESS</code>.
+   *
+   * Specialization of arm_depthwise_conv_HWC_q7 for the 3x3 layers of
+   * MobileNet-style models. No buffer is needed.
+   */
+
+    arm_status arm_depthwise_conv_3x3_HWC_q7(const q7_t * Im_in,
+                                             const uint16_t dim_im_in,
+                                             const uint16_t ch_im_in,
+                                             const q7_t * wt,
+                                             const uint16_t ch_im_out,
+                                             const uint16_t padding,
+                                             const uint16_t stride,
+                                             const q7_t * bias,
+                                             const uint16_t bias_shift,
+                                             const uint16_t out_shift,
+                                             q7_t * Im_out,
+                                             const uint16_t dim_im_out);
+
+  /**
+   * @brief Per-channel quantized int8 convolution function
+   * @param[in]       Im_in         pointer to input tensor
+   * @param[in]       dim_im_in     input tensor dimention
+   * @param[in]       ch_im_in      number of input tensor channels
+   * @param[in]       wt            pointer to kernel weights
+   * @param[in]       ch_im_out     number of filters, i.e., output tensor channels
+   * @param[in]       dim_kernel    filter kernel size
+   * @param[in]       padding       padding sizes
+   * @param[in]       stride        convolution stride
+   * @param[in]       bias          pointer to the per-channel Q31 bias
+   * @param[in]       out_mult      pointer to the per-channel output multipliers
+   * @param[in]       out_shift     pointer to the per-channel output shifts
+   * @param[in]       input_offset  negated input zero point, in the range [-127, 128]
+   * @param[in]       output_offset output zero point, in the range [-128, 127]
+   * @param[in]       act_min       minimum output value
+   * @param[in]       act_max       maximum output value
+   * @param[in,out]   Im_out        pointer to output tensor
+   * @param[in]       dim_im_out    output tensor dimension
+   * @param[in,out]   bufferA       pointer to buffer space for input 
+   * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+   *
+   * Each output channel has its own multiplier and shift, and the input and
+   * output have zero points. The outputs are clamped to [act_min, act_max].
+   * bufferA holds 2*ch_im_in*dim_kernel*dim_kernel Q15 values.
+   */
+
+    arm_status arm_convolve_HWC_s8(const q7_t * Im_in,
+                                   const uint16_t dim_im_in,
+                                   const uint16_t ch_im_in,
+                                   const q7_t * wt,
+                                   const uint16_t ch_im_out,
+                                   const uint16_t dim_kernel,
+                                   const uint16_t padding,
+                                   const uint16_t stride,
+                                   const q31_t * bias,
+                                   const q31_t * out_mult,
+                                   const int32_t * out_shift,
+                                   const int32_t input_offset,
+                                   const int32_t output_offset,
+                                   const int32_t act_min,
+                                   const int32_t act_max,
+                                   q7_t * Im_out,
+                                   const uint16_t dim_im_out,
+                                   q15_t * bufferA);
+
+  /**
+   * @brief Per-channel quantized int8 depthwise convolution function
+   * @param[in]       Im_in         pointer to input tensor
+   * @param[in]       dim_im_in     input tensor dimention
+   * @param[in]       ch_im_in      number of input tensor channels
+   * @param[in]       wt            pointer to kernel weights
+   * @param[in]       ch_im_out     number of filters, i.e., output tensor channels
+   * @param[in]       dim_kernel    filter kernel size
+   * @param[in]       padding       padding sizes
+   * @param[in]       stride        convolution stride
+   * @param[in]       bias          pointer to the per-channel Q31 bias
+   * @param[in]       out_mult      pointer to the per-channel output multipliers
+   * @param[in]       out_shift     pointer to the per-channel output shifts
+   * @param[in]       input_offset  negated input zero point, in the range [-127, 128]
+   * @param[in]       output_offset output zero point, in the range [-128, 127]
+   * @param[in]       act_min       minimum output value
+   * @param[in]       act_max       maximum output value
+   * @param[in,out]   Im_out        pointer to output tensor
+   * @param[in]       dim_im_out    output tensor dimension
+   * @param[in,out]   bufferA       pointer to buffer space for the accumulators
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   *
+   * ch_im_in equals ch_im_out, the weights are in the order of
+   * arm_depthwise_separable_conv_HWC_q7 and bufferA holds 2*ch_im_in Q15 values.
+   */
+
+    arm_status arm_depthwise_conv_HWC_s8(const q7_t * Im_in,
+                                         const uint16_t dim_im_in,
+                                         const uint16_t ch_im_in,
+                                         const q7_t * wt,
+                                         const uint16_t ch_im_out,
+                                         const uint16_t dim_kernel,
+                                         const uint16_t padding,
+                                         const uint16_t stride,
+                                         const q31_t * bias,
+                                         const q31_t * out_mult,
+                                         const int32_t * out_shift,
+                                         const int32_t input_offset,
+                                         const int32_t output_offset,
+                                         const int32_t act_min,
+                                         const int32_t act_max,
+                                         q7_t * Im_out,
+                                         const uint16_t dim_im_out,
+                                         q15_t * bufferA);
+
+  /**
+   * @brief Q7 convolution function with interleaved weights
+   * @param[in]       Im_in       pointer to input tensor
+   * @param[in]       dim_im_in   input tensor dimention
+   * @param[in]       ch_im_in    number of input tensor channels
+   * @param[in]       wt          pointer to kernel weights, interleaved by arm_nn_gemm_pack_q7
+   * @param[in]       ch_im_out   number of filters, i.e., output tensor channels
+   * @param[in]       dim_kernel  filter kernel size
+   * @param[in]       padding     padding sizes
+   * @param[in]       stride      convolution stride
+   * @param[in]       bias        pointer to bias
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for output
+   * @param[in,out]   Im_out      pointer to output tensor
+   * @param[in]       dim_im_out  output tensor dimension
+   * @param[in,out]   bufferA     pointer to buffer space for input
+   * @param[in,out]   bufferB     pointer to buffer space for the q7 im2col columns
+   * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+   *
+   * Same results as arm_convolve_HWC_q7_basic for any dimensions. bufferA
+   * holds 4*ch_im_in*dim_kernel*dim_kernel Q15 values and bufferB as many
+   * Q7 values.
+   */
+
+    arm_status arm_convolve_HWC_q7_gemm(const q7_t * Im_in,
+                                        const uint16_t dim_im_in,
+                                        const uint16_t ch_im_in,
+                                        const q7_t * wt,
+                                        const uint16_t ch_im_out,
+                                        const uint16_t dim_kernel,
+                                        const uint16_t padding,
+                                        const uint16_t stride,
+                                        const q7_t * bias,
+                                        const uint16_t bias_shift,
+                                        const uint16_t out_shift,
+                                        q7_t * Im_out,
+                                        const uint16_t dim_im_out,
+                                        q15_t * bufferA,
+                                        q7_t * bufferB);
+
+  /**
+   * @brief Q7 3x3 convolution function with Winograd minimal filtering
+   * @param[in]       Im_in       pointer to input tensor
+   * @param[in]       dim_im_in   input tensor dimention
+   * @param[in]       ch_im_in    number of input tensor channels
+   * @param[in]       wt          pointer to the weights transformed by arm_nn_winograd_weights_q7
+   * @param[in]       ch_im_out   number of filters, i.e., output tensor channels
+   * @param[in]       dim_tile    output tile size, 2 for F(2x2,3x3) or 4 for F(4x4,3x3)
+   * @param[in]       padding     padding sizes
+   * @param[in]       bias        pointer to bias
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for output
+   * @param[in,out]   Im_out      pointer to output tensor
+   * @param[in]       dim_im_out  output tensor dimension
+   * @param[in,out]   bufferA     pointer to buffer space for input 
+   * @return     The function returns either
+   * <code>ARM_MATH_ARGUMENT_ERROR</code>, <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code>
+   * based on the outcome of argument and size checking.
+   *
+   * The kernel is 3x3 with stride 1. bufferA holds ch_im_in*(dim_tile+2)*(dim_tile+2)
+   * Q15 values.
+   */
+
+    arm_status arm_convolve_HWC_q7_winograd(const q7_t * Im_in,
+                                            const uint16_t dim_im_in,
+                                            const uint16_t ch_im_in,
+                                            const q15_t * wt,
+                                            const uint16_t ch_im_out,
+                                            const uint16_t dim_tile,
+                                            const uint16_t padding,
+                                            const q7_t * bias,
+                                            const uint16_t bias_shift,
+                                            const uint16_t out_shift,
+                                            q7_t * Im_out,
+                                            const uint16_t dim_im_out,
+                                            q15_t * bufferA);
+
+  /**
+   * @brief Q15 3x3 convolution function with Winograd minimal filtering
+   * @param[in]       Im_in       pointer to input tensor
+   * @param[in]       dim_im_in   input tensor dimention
+   * @param[in]       ch_im_in    number of input tensor channels
+   * @param[in]       wt          pointer to the weights transformed by arm_nn_winograd_weights_q15
+   * @param[in]       ch_im_out   number of filters, i.e., output tensor channels
+   * @param[in]       dim_tile    output tile size, 2 for F(2x2,3x3) or 4 for F(4x4,3x3)
+   * @param[in]       padding     padding sizes
+   * @param[in]       bias        pointer to bias
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for output
+   * @param[in,out]   Im_out      pointer to output tensor
+   * @param[in]       dim_im_out  output tensor dimension
+   * @param[in,out]   bufferA     pointer to buffer space for input 
+   * @return     The function returns either
+   * <code>ARM_MATH_ARGUMENT_ERROR</code>, <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code>
+   * based on the outcome of argument and size checking.
+   *
+   * The kernel is 3x3 with stride 1. bufferA holds 2*ch_im_in*(dim_tile+2)*(dim_tile+2)
+   * Q15 values.
+   */
+
+    arm_status arm_convolve_HWC_q15_winograd(const q15_t * Im_in,
+                                             const uint16_t dim_im_in,
+                                             const uint16_t ch_im_in,
+                                             const q31_t * wt,
+                                             const uint16_t ch_im_out,
+                                             const uint16_t dim_tile,
+                                             const uint16_t padding,
+                                             const q15_t * bias,
+                                             const uint16_t bias_shift,
+                                             const uint16_t out_shift,
+                                             q15_t * Im_out,
+                                             const uint16_t dim_im_out,
+                                             q15_t * bufferA);
+
+  /**
+   * @brief Winograd weight transform for arm_convolve_HWC_q7_winograd
+   * @param[in]       wt          pointer to the 3x3 kernel weights
+   * @param[in]       ch_im_in    number of input tensor channels
+   * @param[in]       ch_im_out   number of filters, i.e., output tensor channels
+   * @param[in]       dim_tile    output tile size, 2 or 4
+   * @param[out]      wt_out      pointer to the transformed weights
+   * @return     The function returns either
+   * <code>ARM_MATH_ARGUMENT_ERROR</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of argument checking.
+   *
+   * The output has (dim_tile+2)*(dim_tile+2)*ch_im_in*ch_im_out values.
+   */
+
+    arm_status arm_nn_winograd_weights_q7(const q7_t * wt,
+                                          const uint16_t ch_im_in,
+                                          const uint16_t ch_im_out,
+                                          const uint16_t dim_tile,
+                                          q15_t * wt_out);
+
+  /**
+   * @brief Winograd weight transform for arm_convolve_HWC_q15_winograd
+   * @param[in]       wt          pointer to the 3x3 kernel weights
+   * @param[in]       ch_im_in    number of input tensor channels
+   * @param[in]       ch_im_out   number of filters, i.e., output tensor channels
+   * @param[in]       dim_tile    output tile size, 2 or 4
+   * @param[out]      wt_out      pointer to the transformed weights
+   * @return     The function returns either
+   * <code>ARM_MATH_ARGUMENT_ERROR</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of argument checking.
+   *
+   * The output has (dim_tile+2)*(dim_tile+2)*ch_im_in*ch_im_out values.
+   */
+
+    arm_status arm_nn_winograd_weights_q15(const q15_t * wt,
+                                           const uint16_t ch_im_in,
+                                           const uint16_t ch_im_out,
+                                           const uint16_t dim_tile,
+                                           q31_t * wt_out);
+
 
 /**
  * @defgroup FC Fully-connected Layer Functions
@@ -696,6 +1116,35 @@ extern    "C"
                                           q7_t * pOut, 
                                           q15_t * vec_buffer);
 
+  /**
+   * @brief Q7 fully-connected layer function for a batch of input vectors
+   * @param[in]       pV          pointer to the input vectors, one after the other
+   * @param[in]       pM          pointer to matrix weights, interleaved as for arm_fully_connected_q7_opt
+   * @param[in]       dim_vec     length of each vector
+   * @param[in]       num_of_rows number of rows in weight matrix
+   * @param[in]       batch       number of input vectors
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for output
+   * @param[in]       bias        pointer to bias
+   * @param[in,out]   pOut        pointer to the output vectors, num_of_rows values each
+   * @param[in,out]   vec_buffer  pointer to buffer space for input
+   * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+   *
+   * Same results as arm_fully_connected_q7_opt for each vector.
+   * vec_buffer holds batch*dim_vec Q15 values.
+   */
+
+    arm_status arm_fully_connected_q7_batch(const q7_t * pV,
+                                            const q7_t * pM,
+                                            const uint16_t dim_vec,
+                                            const uint16_t num_of_rows,
+                                            const uint16_t batch,
+                                            const uint16_t bias_shift,
+                                            const uint16_t out_shift,
+                                            const q7_t * bias,
+                                            q7_t * pOut,
+                                            q15_t * vec_buffer);
+
   /**
    * @brief Q15 basic fully-connected layer function
    * @param[in]       pV          pointer to input vector
@@ -796,6 +1245,97 @@ extern    "C"
                                                       q15_t * pOut, 
                                                       q15_t * vec_buffer);
 
+  /**
+   * @brief Q7 block-sparse fully-connected layer function
+   * @param[in]       pV          pointer to input vector
+   * @param[in]       pM          pointer to the packed non-zero weight blocks
+   * @param[in]       pIdx        pointer to the column index of each block
+   * @param[in]       pCnt        pointer to the number of block pairs of each group of 4 rows
+   * @param[in]       dim_vec     length of the vector
+   * @param[in]       num_of_rows number of rows in weight matrix
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for output
+   * @param[in]       bias        pointer to bias
+   * @param[in,out]   pOut        pointer to output vector
+   * @param[in,out]   vec_buffer  pointer to buffer space for input
+   * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+   *
+   */
+
+    arm_status arm_fully_connected_q7_sparse(const q7_t * pV,
+                                             const q7_t * pM,
+                                             const uint16_t * pIdx,
+                                             const uint16_t * pCnt,
+                                             const uint16_t dim_vec,
+                                             const uint16_t num_of_rows,
+                                             const uint16_t bias_shift,
+                                             const uint16_t out_shift,
+                                             const q7_t * bias,
+                                             q7_t * pOut,
+                                             q15_t * vec_buffer);
+
+  /**
+   * @brief Mixed Q15-Q7 block-sparse fully-connected layer function
+   * @param[in]       pV          pointer to input vector
+   * @param[in]       pM          pointer to the packed non-zero weight blocks
+   * @param[in]       pIdx        pointer to the column index of each block
+   * @param[in]       pCnt        pointer to the number of block pairs of each group of 4 rows
+   * @param[in]       dim_vec     length of the vector
+   * @param[in]       num_of_rows number of rows in weight matrix
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for output
+   * @param[in]       bias        pointer to bias
+   * @param[in,out]   pOut        pointer to output vector
+   * @param[in,out]   vec_buffer  pointer to buffer space for input
+   * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+   *
+   */
+
+    arm_status arm_fully_connected_mat_q7_vec_q15_sparse(const q15_t * pV,
+                                                         const q7_t * pM,
+                                                         const uint16_t * pIdx,
+                                                         const uint16_t * pCnt,
+                                                         const uint16_t dim_vec,
+                                                         const uint16_t num_of_rows,
+                                                         const uint16_t bias_shift,
+                                                         const uint16_t out_shift,
+                                                         const q7_t * bias,
+                                                         q15_t * pOut,
+                                                         q15_t * vec_buffer);
+
+  /**
+   * @brief Per-channel quantized int8 fully-connected layer function
+   * @param[in]       pV            pointer to input vector
+   * @param[in]       pM            pointer to matrix weights
+   * @param[in]       dim_vec       length of the vector
+   * @param[in]       num_of_rows   number of rows in weight matrix
+   * @param[in]       bias          pointer to the per-row Q31 bias
+   * @param[in]       out_mult      pointer to the per-row output multipliers
+   * @param[in]       out_shift     pointer to the per-row output shifts
+   * @param[in]       input_offset  negated input zero point, in the range [-127, 128]
+   * @param[in]       output_offset output zero point, in the range [-128, 127]
+   * @param[in]       act_min       minimum output value
+   * @param[in]       act_max       maximum output value
+   * @param[in,out]   pOut          pointer to output vector
+   * @param[in,out]   vec_buffer    pointer to buffer space for input
+   * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+   *
+   */
+
+    arm_status arm_fully_connected_s8(const q7_t * pV,
+                                      const q7_t * pM,
+                                      const uint16_t dim_vec,
+                                      const uint16_t num_of_rows,
+                                      const q31_t * bias,
+                                      const q31_t * out_mult,
+                                      const int32_t * out_shift,
+                                      const int32_t input_offset,
+                                      const int32_t output_offset,
+                                      const int32_t act_min,
+                                      const int32_t act_max,
+                                      q7_t * pOut,
+                                      q15_t * vec_buffer);
+
 /**
  * @brief Matrix-Multiplication Kernels for Convolution
  *
@@ -806,6 +1346,10 @@ extern    "C"
  * with one Q7 and one Q15 operands. The Q15 operand is the im2col
  * output which is always with 2 columns.
  *
+ * arm_nn_gemm_q7_q15 takes any number of columns, with the weights
+ * interleaved in panels of 4 rows, and is used by both convolution and
+ * fully-connected layers.
+ *
  */
 
   /**
@@ -852,6 +1396,135 @@ extern    "C"
                                                       const q7_t * bias, 
                                                       q7_t * pOut);
 
+  /**
+   * @brief Matrix-multiplication function for convolution with ReLU
+   * @param[in]       pA          pointer to operand A
+   * @param[in]       pInBuffer   pointer to operand B, always conssists of 2 vectors
+   * @param[in]       ch_im_out   numRow of A
+   * @param[in]       numCol_A    numCol of A
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for output
+   * @param[in]       bias        the bias
+   * @param[in,out]   pOut        pointer to output
+   * @return     The function returns the incremented output pointer
+   */
+
+    q7_t     *arm_nn_mat_mult_kernel_q7_q15_relu(const q7_t * pA,
+                                                 const q15_t * pInBuffer,
+                                                 const uint16_t ch_im_out,
+                                                 const uint16_t numCol_A,
+                                                 const uint16_t bias_shift,
+                                                 const uint16_t out_shift,
+                                                 const q7_t * bias,
+                                                 q7_t * pOut);
+
+  /**
+   * @brief Matrix-multiplication function for convolution with reordered columns and ReLU
+   * @param[in]       pA          pointer to operand A
+   * @param[in]       pInBuffer   pointer to operand B, always conssists of 2 vectors
+   * @param[in]       ch_im_out   numRow of A
+   * @param[in]       numCol_A    numCol of A
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for output
+   * @param[in]       bias        the bias
+   * @param[in,out]   pOut        pointer to output
+   * @return     The function returns the incremented output pointer
+   */
+
+    q7_t     *arm_nn_mat_mult_kernel_q7_q15_reordered_relu(const q7_t * pA,
+                                                           const q15_t * pInBuffer,
+                                                           const uint16_t ch_im_out,
+                                                           const uint16_t numCol_A,
+                                                           const uint16_t bias_shift,
+                                                           const uint16_t out_shift,
+                                                           const q7_t * bias,
+                                                           q7_t * pOut);
+
+  /**
+   * @brief Matrix-multiplication function for per-channel quantized convolution
+   * @param[in]       pA            pointer to operand A
+   * @param[in]       pInBuffer     pointer to operand B, always conssists of 2 vectors
+   * @param[in]       ch_im_out     numRow of A
+   * @param[in]       numCol_A      numCol of A
+   * @param[in]       bias          pointer to the per-channel Q31 bias
+   * @param[in]       out_mult      pointer to the per-channel output multipliers
+   * @param[in]       out_shift     pointer to the per-channel output shifts
+   * @param[in]       output_offset output zero point, in the range [-128, 127]
+   * @param[in]       act_min       minimum output value
+   * @param[in]       act_max       maximum output value
+   * @param[in,out]   pOut          pointer to output
+   * @return     The function returns the incremented output pointer
+   */
+
+    q7_t     *arm_nn_mat_mult_kernel_s8_s16(const q7_t * pA,
+                                            const q15_t * pInBuffer,
+                                            const uint16_t ch_im_out,
+                                            const uint16_t numCol_A,
+                                            const q31_t * bias,
+                                            const q31_t * out_mult,
+                                            const int32_t * out_shift,
+                                            const int32_t output_offset,
+                                            const int32_t act_min,
+                                            const int32_t act_max,
+                                            q7_t * pOut);
+
+  /**
+   * @brief Q7 x Q15 matrix multiplication with interleaved weights
+   * @param[in]       pA          pointer to operand A, interleaved by arm_nn_gemm_pack_q7
+   * @param[in]       pB          pointer to operand B, expanded by arm_nn_gemm_expand_q7
+   * @param[in]       num_row_A   numRow of A, i.e., number of outputs of each column
+   * @param[in]       num_col_A   numCol of A, i.e., length of each column of B
+   * @param[in]       num_col_B   numCol of B
+   * @param[in]       bias        pointer to bias
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for output
+   * @param[in,out]   pOut        pointer to output, num_row_A values for each column of B
+   * @return none.
+   *
+   * Shared by arm_convolve_HWC_q7_gemm and arm_fully_connected_q7_batch,
+   * for any number of columns.
+   */
+
+    void      arm_nn_gemm_q7_q15(const q7_t * pA,
+                                 const q15_t * pB,
+                                 const uint16_t num_row_A,
+                                 const uint16_t num_col_A,
+                                 const uint16_t num_col_B,
+                                 const q7_t * bias,
+                                 const uint16_t bias_shift,
+                                 const uint16_t out_shift,
+                                 q7_t * pOut);
+
+  /**
+   * @brief Expands the Q7 columns of operand B of arm_nn_gemm_q7_q15
+   * @param[in]       pSrc        pointer to the Q7 columns
+   * @param[in]       num_col_A   length of each column
+   * @param[in]       num_col_B   number of columns
+   * @param[out]      pDst        pointer to the Q15 columns
+   * @return none.
+   */
+
+    void      arm_nn_gemm_expand_q7(const q7_t * pSrc,
+                                    const uint16_t num_col_A,
+                                    const uint16_t num_col_B,
+                                    q15_t * pDst);
+
+  /**
+   * @brief Interleaves a Q7 weight matrix for arm_nn_gemm_q7_q15
+   * @param[in]       wt          pointer to the weights, one row after the other
+   * @param[in]       num_row     number of rows
+   * @param[in]       num_col     number of columns
+   * @param[out]      wt_out      pointer to the num_row*num_col interleaved weights
+   * @return none.
+   *
+   * The format is that of arm_fully_connected_q7_opt.
+   */
+
+    void      arm_nn_gemm_pack_q7(const q7_t * wt,
+                                  const uint16_t num_row,
+                                  const uint16_t num_col,
+                                  q7_t * wt_out);
+
 #ifdef __cplusplus
 }
 #endif
@@ -871,7 +1544,7 @@ extern    "C"
  * @defgroup Acti Neural Network Activation Functions
  *
  * Perform activation layers, including ReLU (Rectified Linear Unit),
- * sigmoid and tanh
+ * ReLU6, leaky ReLU, sigmoid and tanh
  *
  */
 
@@ -882,7 +1555,7 @@ extern    "C"
    * @return none.
    */
 
-    void      arm_relu_q7(q7_t * data, uint16_t size);
+    void      arm_relu_q7(q7_t * data, uint32_t size);
 
   /**
    * @brief Q15 RELU function
@@ -891,7 +1564,7 @@ extern    "C"
    * @return none.
    */
 
-    void      arm_relu_q15(q15_t * data, uint16_t size);
+    void      arm_relu_q15(q15_t * data, uint32_t size);
 
   /**
    * @brief Q7 neural network activation function using direct table look-up
@@ -902,7 +1575,7 @@ extern    "C"
    * @return none.
    */
 
-    void      arm_nn_activations_direct_q7(q7_t * data, uint16_t size, uint16_t int_width, 
+    void      arm_nn_activations_direct_q7(q7_t * data, uint32_t size, uint16_t int_width, 
                                            arm_nn_activation_type type);
 
   /**
@@ -914,7 +1587,71 @@ extern    "C"
    * @return none.
    */
 
-    void      arm_nn_activations_direct_q15(q15_t * data, uint16_t size, uint16_t int_width,
+    void      arm_nn_activations_direct_q15(q15_t * data, uint32_t size, uint16_t int_width,
+                                            arm_nn_activation_type type);
+
+  /**
+   * @brief Q7 RELU6 function
+   * @param[in,out]   data        pointer to input
+   * @param[in]       size        number of elements
+   * @param[in]       int_width   bit-width of the integer part, at most 7
+   * @return none.
+   */
+
+    void      arm_relu6_q7(q7_t * data, uint32_t size, uint16_t int_width);
+
+  /**
+   * @brief Q15 RELU6 function
+   * @param[in,out]   data        pointer to input
+   * @param[in]       size        number of elements
+   * @param[in]       int_width   bit-width of the integer part, at most 15
+   * @return none.
+   */
+
+    void      arm_relu6_q15(q15_t * data, uint32_t size, uint16_t int_width);
+
+  /**
+   * @brief Q7 leaky RELU function
+   * @param[in,out]   data        pointer to input
+   * @param[in]       size        number of elements
+   * @param[in]       alpha       slope of the negative part in Q15, non-negative
+   * @return none.
+   */
+
+    void      arm_leaky_relu_q7(q7_t * data, uint32_t size, q15_t alpha);
+
+  /**
+   * @brief Q15 leaky RELU function
+   * @param[in,out]   data        pointer to input
+   * @param[in]       size        number of elements
+   * @param[in]       alpha       slope of the negative part in Q15, non-negative
+   * @return none.
+   */
+
+    void      arm_leaky_relu_q15(q15_t * data, uint32_t size, q15_t alpha);
+
+  /**
+   * @brief Q7 neural network activation function using table interpolation
+   * @param[in,out]   data        pointer to input
+   * @param[in]       size        number of elements
+   * @param[in]       int_width   bit-width of the integer part, assume to be smaller than 3
+   * @param[in]       type        type of activation functions
+   * @return none.
+   */
+
+    void      arm_nn_activations_interp_q7(q7_t * data, uint32_t size, uint16_t int_width,
+                                           arm_nn_activation_type type);
+
+  /**
+   * @brief Q15 neural network activation function using table interpolation
+   * @param[in,out]   data        pointer to input
+   * @param[in]       size        number of elements
+   * @param[in]       int_width   bit-width of the integer part, assume to be smaller than 3
+   * @param[in]       type        type of activation functions
+   * @return none.
+   */
+
+    void      arm_nn_activations_interp_q15(q15_t * data, uint32_t size, uint16_t int_width,
                                             arm_nn_activation_type type);
 
 /**
@@ -974,10 +1711,69 @@ extern    "C"
                                  q7_t * bufferA, 
                                  q7_t * Im_out);
 
+  /**
+   * @brief int8 max pooling function
+   * @param[in]       Im_in       pointer to input tensor
+   * @param[in]       dim_im_in   input tensor dimention
+   * @param[in]       ch_im_in    number of input tensor channels
+   * @param[in]       dim_kernel  filter kernel size
+   * @param[in]       padding     padding sizes
+   * @param[in]       stride      convolution stride
+   * @param[in]       dim_im_out  output tensor dimension
+   * @param[in]       act_min     minimum output value
+   * @param[in]       act_max     maximum output value
+   * @param[in,out]   Im_out      pointer to output tensor
+   * @return none.
+   *
+   * The input is not modified.
+   */
+
+    void      arm_maxpool_s8_HWC(const q7_t * Im_in,
+                                 const uint16_t dim_im_in,
+                                 const uint16_t ch_im_in,
+                                 const uint16_t dim_kernel,
+                                 const uint16_t padding,
+                                 const uint16_t stride,
+                                 const uint16_t dim_im_out,
+                                 const int32_t act_min,
+                                 const int32_t act_max,
+                                 q7_t * Im_out);
+
+  /**
+   * @brief int8 average pooling function
+   * @param[in]       Im_in       pointer to input tensor
+   * @param[in]       dim_im_in   input tensor dimention
+   * @param[in]       ch_im_in    number of input tensor channels
+   * @param[in]       dim_kernel  filter kernel size
+   * @param[in]       padding     padding sizes
+   * @param[in]       stride      convolution stride
+   * @param[in]       dim_im_out  output tensor dimension
+   * @param[in]       act_min     minimum output value
+   * @param[in]       act_max     maximum output value
+   * @param[in,out]   bufferA     pointer to buffer space for the sums
+   * @param[in,out]   Im_out      pointer to output tensor
+   * @return none.
+   *
+   * bufferA holds 2*ch_im_in Q15 values.
+   */
+
+    void      arm_avepool_s8_HWC(const q7_t * Im_in,
+                                 const uint16_t dim_im_in,
+                                 const uint16_t ch_im_in,
+                                 const uint16_t dim_kernel,
+                                 const uint16_t padding,
+                                 const uint16_t stride,
+                                 const uint16_t dim_im_out,
+                                 const int32_t act_min,
+                                 const int32_t act_max,
+                                 q15_t * bufferA,
+                                 q7_t * Im_out);
+
 /**
  * @defgroup Softmax Softmax Functions
  *
- * EXP(2) based softmax function
+ * EXP(2) based softmax function, and natural exponent based softmax
+ * functions for int8 and for Q7 and Q15 with a log-sum-exp normalization
  *
  */
 
@@ -1003,6 +1799,314 @@ extern    "C"
 
     void      arm_softmax_q15(const q15_t * vec_in, const uint16_t dim_vec, q15_t * p_out);
 
+  /**
+   * @brief int8 softmax function
+   * @param[in]       vec_in      pointer to input vector
+   * @param[in]       dim_vec     input vector dimention
+   * @param[in]       input_mult  multiplier of the input differences
+   * @param[in]       input_shift amount of left-shift of the input differences
+   * @param[out]      p_out       pointer to output vector
+   * @return none.
+   *
+   * Natural exponent based softmax with an output scale of 1/256 and an
+   * output zero point of -128.
+   */
+
+    void      arm_softmax_s8(const q7_t * vec_in,
+                             const uint16_t dim_vec,
+                             const q31_t input_mult,
+                             const int32_t input_shift,
+                             q7_t * p_out);
+
+  /**
+   * @brief Q7 log-sum-exp softmax function
+   * @param[in]       vec_in      pointer to input vector
+   * @param[in]       dim_vec     input vector dimention
+   * @param[in]       int_width   bit-width of the integer part of the input, at most 4
+   * @param[out]      p_out       pointer to output vector
+   * @return none.
+   *
+   */
+
+    void      arm_softmax_lse_q7(const q7_t * vec_in, const uint32_t dim_vec, const uint16_t int_width, q7_t * p_out);
+
+  /**
+   * @brief Q15 log-sum-exp softmax function
+   * @param[in]       vec_in      pointer to input vector
+   * @param[in]       dim_vec     input vector dimention
+   * @param[in]       int_width   bit-width of the integer part of the input, at most 4
+   * @param[out]      p_out       pointer to output vector
+   * @return none.
+   *
+   */
+
+    void      arm_softmax_lse_q15(const q15_t * vec_in, const uint32_t dim_vec, const uint16_t int_width,
+                                  q15_t * p_out);
+
+/**
+ * @defgroup NNRecurrent Neural Network Recurrent Functions
+ *
+ * Perform recurrent layers (GRU and LSTM) over a sequence
+ *
+ * The weights of all gates are concatenated, and each step computes the
+ * gates in a fused pass over the input and the hidden state. The states
+ * are updated in place, so a sequence is processed in a single call and
+ * consecutive calls continue from the last state.
+ *
+ */
+
+  /**
+   * @brief Mixed Q15-Q7 GRU layer function
+   * @param[in]       pInput      pointer to the input sequence, seq_len vectors of dim_input
+   * @param[in]       seq_len     number of time steps
+   * @param[in]       dim_input   length of the input vector
+   * @param[in]       dim_hidden  length of the hidden state
+   * @param[in]       pWeight     pointer to the concatenated weights of the update, reset and candidate gates
+   * @param[in]       pBias       pointer to the concatenated bias of the update, reset and candidate gates
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for the gate pre-activations
+   * @param[in]       int_width   bit-width of the integer part of the pre-activations, at most 3
+   * @param[in,out]   pHidden     pointer to the hidden state, updated in place
+   * @param[out]      pOutput     pointer to the hidden state of every step, seq_len vectors of dim_hidden, or NULL
+   * @param[in,out]   bufferA     pointer to buffer space for the gates
+   * @return     The function returns either
+   * <code>ARM_MATH_ARGUMENT_ERROR</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of argument checking.
+   *
+   * bufferA holds dim_input + 3*dim_hidden Q15 values.
+   */
+
+    arm_status arm_gru_q7_q15(const q15_t * pInput,
+                              const uint16_t seq_len,
+                              const uint16_t dim_input,
+                              const uint16_t dim_hidden,
+                              const q7_t * pWeight,
+                              const q7_t * pBias,
+                              const uint16_t bias_shift,
+                              const uint16_t out_shift,
+                              const uint16_t int_width,
+                              q15_t * pHidden,
+                              q15_t * pOutput,
+                              q15_t * bufferA);
+
+  /**
+   * @brief Mixed Q15-Q7 LSTM layer function
+   * @param[in]       pInput      pointer to the input sequence, seq_len vectors of dim_input
+   * @param[in]       seq_len     number of time steps
+   * @param[in]       dim_input   length of the input vector
+   * @param[in]       dim_hidden  length of the hidden and cell states
+   * @param[in]       pWeight     pointer to the concatenated weights of the input, forget, cell and output gates
+   * @param[in]       pBias       pointer to the concatenated bias of the input, forget, cell and output gates
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for the gate pre-activations
+   * @param[in]       int_width   bit-width of the integer part of the pre-activations and the cell state, at most 3
+   * @param[in,out]   pHidden     pointer to the hidden state, updated in place
+   * @param[in,out]   pCell       pointer to the cell state, updated in place
+   * @param[out]      pOutput     pointer to the hidden state of every step, seq_len vectors of dim_hidden, or NULL
+   * @param[in,out]   bufferA     pointer to buffer space for the input and hidden vectors
+   * @return     The function returns either
+   * <code>ARM_MATH_ARGUMENT_ERROR</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of argument checking.
+   *
+   * bufferA holds dim_input + dim_hidden Q15 values.
+   */
+
+    arm_status arm_lstm_q7_q15(const q15_t * pInput,
+                               const uint16_t seq_len,
+                               const uint16_t dim_input,
+                               const uint16_t dim_hidden,
+                               const q7_t * pWeight,
+                               const q7_t * pBias,
+                               const uint16_t bias_shift,
+                               const uint16_t out_shift,
+                               const uint16_t int_width,
+                               q15_t * pHidden,
+                               q15_t * pCell,
+                               q15_t * pOutput,
+                               q15_t * bufferA);
+
+/**
+ * @defgroup NNQuant Neural Network Quantization Functions
+ *
+ * Compute the parameters of the per-channel quantized int8 functions
+ *
+ * The int8 functions quantize the weights symmetrically per output channel,
+ * and the activations asymmetrically with a zero point. Each accumulator is
+ * scaled to the output by a Q31 multiplier and a shift per channel.
+ * These functions run offline or at initialization.
+ *
+ */
+
+  /**
+   * @brief Converts a positive real multiplier to a Q31 multiplier and a shift
+   * @param[in]       real        real multiplier
+   * @param[out]      pMult       Q31 multiplier, in the range [0.5, 1)
+   * @param[out]      pShift      amount of left-shift if positive, of right-shift if negative
+   * @return none.
+   */
+
+    void      arm_nn_quantize_multiplier(const float64_t real,
+                                         q31_t * pMult,
+                                         int32_t * pShift);
+
+  /**
+   * @brief Quantizes float weights and bias per output channel
+   * @param[in]       pW            pointer to the float weights
+   * @param[in]       pBias         pointer to the float bias
+   * @param[in]       num_ch        number of output channels
+   * @param[in]       ch_size       number of weights of each output channel
+   * @param[in]       interleaved   0 if the weights of a channel are contiguous, 1 if the channel is the fastest index
+   * @param[in]       input_scale   scale of the input tensor
+   * @param[in]       output_scale  scale of the output tensor
+   * @param[out]      pWOut         pointer to the int8 weights, in the same order as pW
+   * @param[out]      pBiasOut      pointer to the Q31 bias
+   * @param[out]      pMult         pointer to the per-channel output multipliers
+   * @param[out]      pShift        pointer to the per-channel output shifts
+   * @return     The function returns either
+   * <code>ARM_MATH_ARGUMENT_ERROR</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of argument checking.
+   */
+
+    arm_status arm_nn_quantize_weights_s8(const float32_t * pW,
+                                          const float32_t * pBias,
+                                          const uint16_t num_ch,
+                                          const uint32_t ch_size,
+                                          const uint16_t interleaved,
+                                          const float32_t input_scale,
+                                          const float32_t output_scale,
+                                          q7_t * pWOut,
+                                          q31_t * pBiasOut,
+                                          q31_t * pMult,
+                                          int32_t * pShift);
+
+/**
+ * @defgroup NNGraph Neural Network Graph Functions
+ *
+ * Run a network described by a serialized layer list
+ *
+ * A graph is an array of layers executed in order. Each layer names its
+ * input and output tensors by index, and addresses its weights and bias by
+ * byte offset into a single weight blob, so the layer list and the blob can
+ * be generated offline and stored in flash.
+ *
+ * All activation tensors and the im2col buffers of the layers share one
+ * arena. The planner computes the lifetime of every tensor, from the layer
+ * that writes it to the last layer that reads it, and packs buffers with
+ * disjoint lifetimes into the same memory. The plan only depends on the
+ * layer list, so it can be computed on the host and the arena sized
+ * statically.
+ *
+ */
+
+  /**
+   * @brief Layer operations of a graph
+   */
+typedef enum
+{
+    ARM_NN_CONV_HWC_Q7_BASIC = 0,
+                /**< arm_convolve_HWC_q7_basic */
+    ARM_NN_CONV_HWC_Q7_FAST = 1,
+                /**< arm_convolve_HWC_q7_fast */
+    ARM_NN_CONV_HWC_Q7_RGB = 2,
+                /**< arm_convolve_HWC_q7_RGB */
+    ARM_NN_DEPTHWISE_CONV_HWC_Q7 = 3,
+                /**< arm_depthwise_conv_3x3_HWC_q7 for 3x3 kernels with stride 1 or 2, else arm_depthwise_conv_HWC_q7 */
+    ARM_NN_RELU_Q7 = 4,
+                /**< arm_relu_q7, in-place */
+    ARM_NN_MAXPOOL_HWC_Q7 = 5,
+                /**< arm_maxpool_q7_HWC */
+    ARM_NN_AVEPOOL_HWC_Q7 = 6,
+                /**< arm_avepool_q7_HWC */
+    ARM_NN_FULLY_CONNECTED_Q7 = 7,
+                /**< arm_fully_connected_q7 */
+    ARM_NN_FULLY_CONNECTED_Q7_OPT = 8,
+                /**< arm_fully_connected_q7_opt */
+    ARM_NN_SOFTMAX_Q7 = 9,
+                /**< arm_softmax_q7 */
+    ARM_NN_CONV_HWC_Q7_WINOGRAD_F2 = 10,
+                /**< arm_convolve_HWC_q7_winograd with F(2x2,3x3), weights from arm_nn_winograd_weights_q7 */
+    ARM_NN_CONV_HWC_Q7_WINOGRAD_F4 = 11,
+                /**< arm_convolve_HWC_q7_winograd with F(4x4,3x3), weights from arm_nn_winograd_weights_q7 */
+} arm_nn_graph_op;
+
+  /**
+   * @brief Serialized layer of a Q7 graph.
+   *
+   * Tensors are HWC images of dimIn x dimIn x chIn and dimOut x dimOut x chOut.
+   * A vector of length n is described as a 1 x 1 x n image, e.g. the input and
+   * the output of a fully-connected layer, whose chOut is the number of rows.
+   */
+typedef struct
+{
+    uint16_t op;                /**< layer operation, see arm_nn_graph_op. */
+    uint16_t in;                /**< index of the input tensor. */
+    uint16_t out;               /**< index of the output tensor, equal to in for an in-place layer. */
+    uint16_t dimIn;             /**< input tensor dimension. */
+    uint16_t chIn;              /**< number of input tensor channels. */
+    uint16_t dimOut;            /**< output tensor dimension. */
+    uint16_t chOut;             /**< number of output tensor channels. */
+    uint16_t dimKernel;         /**< filter or pooling kernel size. */
+    uint16_t padding;           /**< padding size. */
+    uint16_t stride;            /**< convolution or pooling stride. */
+    uint16_t biasShift;         /**< amount of left-shift for bias. */
+    uint16_t outShift;          /**< amount of right-shift for output. */
+    uint32_t wtOffset;          /**< byte offset of the weights in the weight blob. */
+    uint32_t biasOffset;        /**< byte offset of the bias in the weight blob. */
+} arm_nn_layer_q7;
+
+  /**
+   * @brief Instance structure for a Q7 graph.
+   *
+   * The input of the graph is the input tensor of the first layer and the
+   * output of the graph is the output tensor of the last layer.
+   */
+typedef struct
+{
+    uint16_t numLayers;         /**< number of layers. */
+    uint16_t numTensors;        /**< number of tensors. */
+    const arm_nn_layer_q7 *pLayers;  /**< points to the layer array of length numLayers. */
+    const q7_t *pWeights;       /**< points to the weight blob. */
+} arm_nn_graph_q7;
+
+  /**
+   * @brief Memory plan of a graph.
+   */
+typedef struct
+{
+    uint32_t arenaSize;         /**< size of the arena in bytes. */
+    uint32_t *pTensorOffset;    /**< points to the arena offset of each tensor, array of length numTensors. */
+    uint32_t *pScratchOffset;   /**< points to the arena offset of the im2col buffer of each layer, array of length numLayers. */
+} arm_nn_graph_plan;
+
+/**
+ * @brief Number of words of the work buffer of arm_nn_graph_plan_q7
+ */
+#define ARM_NN_GRAPH_PLAN_WORK_SIZE(numTensors, numLayers) (4 * ((numTensors) + (numLayers)))
+
+  /**
+   * @brief Liveness-based memory planner for a Q7 graph
+   * @param[in]       S           points to an instance of the graph
+   * @param[in,out]   P           points to the plan, pTensorOffset and pScratchOffset are filled in
+   * @param[in,out]   pWork       points to a work buffer of ARM_NN_GRAPH_PLAN_WORK_SIZE words
+   * @return     The function returns either
+   * <code>ARM_MATH_ARGUMENT_ERROR</code>, <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code>
+   * based on the outcome of the graph checking.
+   */
+
+    arm_status arm_nn_graph_plan_q7(const arm_nn_graph_q7 * S,
+                                    arm_nn_graph_plan * P,
+                                    uint32_t * pWork);
+
+  /**
+   * @brief Run a Q7 graph in a planned arena
+   * @param[in]       S           points to an instance of the graph
+   * @param[in]       P           points to the plan computed by arm_nn_graph_plan_q7
+   * @param[in,out]   pArena      points to the arena of P->arenaSize bytes, 4-byte aligned
+   * @return     The function returns the status of the first failing layer, or <code>ARM_MATH_SUCCESS</code>
+   */
+
+    arm_status arm_nn_graph_run_q7(const arm_nn_graph_q7 * S,
+                                   const arm_nn_graph_plan * P,
+                                   q7_t * pArena);
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -93,6 +93,29 @@ void      arm_q7_to_q15_no_shift(const q7_t * pSrc, q15_t * pDst, uint32_t block
 
 void      arm_q7_to_q15_reordered_no_shift(const q7_t * pSrc, q15_t * pDst, uint32_t blockSize);
 
+/**
+ * @brief Converts the elements of the Q7 vector to Q15 vector and adds an offset
+ * @param[in]       *pSrc points to the Q7 input vector    
+ * @param[out]      *pDst points to the Q15 output vector   
+ * @param[in]       blockSize length of the input vector    
+ * @param[in]       offset offset added to each element, in the range [-128, 127]
+ * @return none.    
+ *
+ */
+
+void      arm_q7_to_q15_with_offset(const q7_t * pSrc, q15_t * pDst, uint32_t blockSize, q15_t offset);
+
+/**
+ * @brief Reorders the elements of a Q15 vector for arm_nn_dot4_q7_q15_reordered
+ * @param[in]       *pSrc points to the Q15 input vector    
+ * @param[out]      *pDst points to the Q15 output vector   
+ * @param[in]       blockSize length of the input vector    
+ * @return none.    
+ *
+ */
+
+void      arm_q15_to_q15_reordered(const q15_t * pSrc, q15_t * pDst, uint32_t blockSize);
+
 #if defined (ARM_MATH_DSP)
 
 /**
@@ -185,7 +208,352 @@ void arm_nn_mult_q7(
   q7_t * pDst,
   const uint16_t out_shift,
   uint32_t blockSize);
+
+/**
+ * @brief           Q7 max pooling of one pixel into the pooling windows that contain it
+ * @param[in]       *pSrc         pointer to the ch_im_in channels of the pixel
+ * @param[in]       ch_im_in      number of channels
+ * @param[in]       x             column of the pixel in the pooling input
+ * @param[in]       y             row of the pixel in the pooling input
+ * @param[in]       dim_kernel    pooling kernel size
+ * @param[in]       padding       pooling padding size
+ * @param[in]       stride        pooling stride
+ * @param[in]       dim_im_out    pooling output dimension
+ * @param[in,out]   *pDst         pointer to the pooling output
+ * @return none.
+ *
+ * The pooling output is initialized by the caller, and holds the maximum
+ * of all pixels pooled so far in each window.
+ */
+
+void arm_nn_maxpool_scatter_q7(
+  const q7_t * pSrc,
+  const uint16_t ch_im_in,
+  const int16_t x,
+  const int16_t y,
+  const uint16_t dim_kernel,
+  const uint16_t padding,
+  const uint16_t stride,
+  const uint16_t dim_im_out,
+  q7_t * pDst);
  
+/**
+ * @brief           exp(x) in Q0.31 for x <= 0 in Q5.26
+ * @param[in]       x             input value
+ * @return          the exponential
+ */
+
+q31_t arm_nn_exp_on_negative_values(const q31_t x);
+
+/**
+ * @brief           Natural logarithm of a sum of Q0.31 values
+ * @param[in]       sum           non-zero sum, in Q0.31
+ * @return          ln(sum) in Q5.26
+ */
+
+q31_t arm_nn_log_of_sum(const uint64_t sum);
+
+/**
+ * @brief           Dot products of four Q7 weight rows with one Q15 vector
+ * @param[in]       *pV           pointer to the vector, reordered by arm_q15_to_q15_reordered
+ * @param[in]       **pM          pointers to the four weight rows, in original order
+ * @param[in]       length        number of elements
+ * @param[in,out]   *pSum         accumulators of the four rows
+ * @return none.
+ *
+ * The vector is loaded once for all rows. The rows need no alignment and
+ * may repeat.
+ */
+
+__STATIC_FORCEINLINE void arm_nn_dot4_q7_q15_reordered(const q15_t * pV,
+                                                       const q7_t * const *pM,
+                                                       const uint16_t length,
+                                                       q31_t * pSum)
+{
+    const q7_t *pA = pM[0];
+    const q7_t *pB = pM[1];
+    const q7_t *pC = pM[2];
+    const q7_t *pD = pM[3];
+    q31_t     sumA = pSum[0];
+    q31_t     sumB = pSum[1];
+    q31_t     sumC = pSum[2];
+    q31_t     sumD = pSum[3];
+    uint16_t  colCnt;
+
+#if defined (ARM_MATH_DSP)
+    colCnt = length >> 2;
+    while (colCnt)
+    {
+        q31_t     inV1 = *__SIMD32(pV)++;
+        q31_t     inV2 = *__SIMD32(pV)++;
+        q31_t     inM1, inM2;
+
+        pA = (q7_t *) read_and_pad_reordered((void *)pA, &inM1, &inM2);
+        sumA = __SMLAD(inV1, inM1, sumA);
+        sumA = __SMLAD(inV2, inM2, sumA);
+        pB = (q7_t *) read_and_pad_reordered((void *)pB, &inM1, &inM2);
+        sumB = __SMLAD(inV1, inM1, sumB);
+        sumB = __SMLAD(inV2, inM2, sumB);
+        pC = (q7_t *) read_and_pad_reordered((void *)pC, &inM1, &inM2);
+        sumC = __SMLAD(inV1, inM1, sumC);
+        sumC = __SMLAD(inV2, inM2, sumC);
+        pD = (q7_t *) read_and_pad_reordered((void *)pD, &inM1, &inM2);
+        sumD = __SMLAD(inV1, inM1, sumD);
+        sumD = __SMLAD(inV2, inM2, sumD);
+        colCnt--;
+    }
+    colCnt = length & 0x3;
+#else
+    colCnt = length;
+#endif
+
+    while (colCnt)
+    {
+        q15_t     inV = *pV++;
+        sumA += inV * *pA++;
+        sumB += inV * *pB++;
+        sumC += inV * *pC++;
+        sumD += inV * *pD++;
+        colCnt--;
+    }
+
+    pSum[0] = sumA;
+    pSum[1] = sumB;
+    pSum[2] = sumC;
+    pSum[3] = sumD;
+}
+
+/**
+ * @brief           Q15 activation of one element by direct table look-up
+ * @param[in]       in            input value
+ * @param[in]       lookup_table  sigmoidTable_q15 or tanhTable_q15
+ * @param[in]       int_width     bit-width of the integer part, at most 3
+ * @return          the activation, as computed by arm_nn_activations_direct_q15
+ */
+
+__STATIC_FORCEINLINE q15_t arm_nn_activation_q15(const q15_t in, const q15_t * lookup_table, const uint16_t int_width)
+{
+    const uint16_t shift_size = 8 + 3 - int_width;
+    const uint32_t bit_mask = 0x7FF >> int_width;
+    const uint32_t full_frac = bit_mask + 1;
+    q15_t     frac = (uint32_t) in & bit_mask;
+    uint8_t   index = (uint8_t) (in >> shift_size);
+    q15_t     value = lookup_table[index];
+    q15_t     value2 = lookup_table[index == 127 ? 127 : (uint8_t) (index + 1)];
+
+    return (q15_t) (((q31_t) (full_frac - frac) * value + (q31_t) value2 * frac) >> shift_size);
+}
+
+/**
+ * @brief           Q15 activation of one element by interpolation of the 2-stage tables
+ * @param[in]       in            input value in Q3.15, in the range [-8, 8)
+ * @param[in]       pL            sigmoidLTable_q15 or tanhLTable_q15
+ * @param[in]       pH            sigmoidHTable_q15 or tanhHTable_q15
+ * @return          the activation in Q15
+ *
+ * The L table has a step of 1/32 for inputs in [-2, 2), and the H table a
+ * step of 1/16 for the others. Each value is interpolated linearly between
+ * the two entries around it. Above the last entry it is held.
+ */
+
+__STATIC_FORCEINLINE q15_t arm_nn_activation_hl_q15(const q31_t in, const q15_t * pL, const q15_t * pH)
+{
+    q31_t     value, value2, frac;
+    uint32_t  idx;
+
+    if (in >= -(1 << 16) && in < (1 << 16))
+    {
+        idx = (uint32_t) (in >> 10) & 0x7F;
+        frac = in & 0x3FF;
+        value = pL[idx];
+        value2 = idx == 0x3F ? pH[0] : pL[(idx + 1) & 0x7F];
+
+        return (q15_t) (value + (((value2 - value) * frac + (1 << 9)) >> 10));
+    }
+
+    idx = ((uint32_t) (in >> 11) & 0xFF) - 0x20;
+    frac = in & 0x7FF;
+    value = pH[idx];
+    value2 = idx == 0x5F ? value : idx == 0xBF ? pL[0x40] : pH[idx + 1];
+
+    return (q15_t) (value + (((value2 - value) * frac + (1 << 10)) >> 11));
+}
+
+/**
+ * @brief           Saturating rounding doubling high multiply of two Q31 values
+ * @param[in]       m1            first multiplicand
+ * @param[in]       m2            second multiplicand
+ * @return          the high word of 2*m1*m2, rounded to the nearest
+ *
+ * The only overflow, 0x80000000 times 0x80000000, saturates to 0x7FFFFFFF.
+ */
+
+__STATIC_FORCEINLINE q31_t arm_nn_sat_doubling_high_mult(const q31_t m1, const q31_t m2)
+{
+    q63_t     mult = (q63_t) m1 * m2;
+
+    if (m1 == m2 && m1 == (q31_t) 0x80000000)
+    {
+        return 0x7FFFFFFF;
+    }
+
+    mult += mult >= 0 ? (1LL << 30) : (1 - (1LL << 30));
+
+    return (q31_t) (mult / (1LL << 31));
+}
+
+/**
+ * @brief           Rounding division by a power of two
+ * @param[in]       dividend      value to divide
+ * @param[in]       exponent      power of two, in the range [0, 31]
+ * @return          dividend / 2^exponent, rounded to the nearest, ties away from zero
+ */
+
+__STATIC_FORCEINLINE q31_t arm_nn_divide_by_power_of_two(const q31_t dividend, const int32_t exponent)
+{
+    const q31_t remainder_mask = (q31_t) ((1u << exponent) - 1u);
+    const q31_t remainder = dividend & remainder_mask;
+    q31_t     result = dividend >> exponent;
+    q31_t     threshold = remainder_mask >> 1;
+
+    if (dividend < 0)
+    {
+        threshold++;
+    }
+    if (remainder > threshold)
+    {
+        result++;
+    }
+
+    return result;
+}
+
+/**
+ * @brief           Requantizes a Q31 accumulator with a multiplier and a shift
+ * @param[in]       val           accumulator
+ * @param[in]       multiplier    Q31 multiplier, in the range [0.5, 1)
+ * @param[in]       shift         amount of left-shift if positive, of right-shift if negative
+ * @return          val * multiplier * 2^shift, rounded to the nearest
+ */
+
+__STATIC_FORCEINLINE q31_t arm_nn_requantize(const q31_t val, const q31_t multiplier, const int32_t shift)
+{
+    return arm_nn_divide_by_power_of_two(arm_nn_sat_doubling_high_mult(val * (1 << (shift > 0 ? shift : 0)), multiplier),
+                                         shift < 0 ? -shift : 0);
+}
+
+/**
+ * @brief           Requantizes a Q31 accumulator to an int8 output
+ * @param[in]       val           accumulator
+ * @param[in]       multiplier    Q31 multiplier
+ * @param[in]       shift         amount of left-shift if positive, of right-shift if negative
+ * @param[in]       output_offset output zero point
+ * @param[in]       act_min       minimum output value
+ * @param[in]       act_max       maximum output value
+ * @return          the output, clamped to [act_min, act_max]
+ */
+
+__STATIC_FORCEINLINE q7_t arm_nn_requantize_s8(const q31_t val, const q31_t multiplier, const int32_t shift,
+                                               const int32_t output_offset, const int32_t act_min, const int32_t act_max)
+{
+    q31_t     out = arm_nn_requantize(val, multiplier, shift) + output_offset;
+
+    out = out < act_min ? act_min : out;
+    out = out > act_max ? act_max : out;
+
+    return (q7_t) out;
+}
+
+/**
+ * @brief           Winograd input transform B^T d of one tile column or row, in-place
+ * @param[in,out]   d             dim_tile+2 values
+ * @param[in]       dim_tile      output tile size, 2 or 4
+ */
+
+__STATIC_FORCEINLINE void arm_nn_winograd_input_1d(q31_t * d, const uint16_t dim_tile)
+{
+    q31_t     v0, v1, v2, v3, v4, v5;
+
+    if (dim_tile == 2)
+    {
+        v0 = d[0] - d[2];
+        v1 = d[1] + d[2];
+        v2 = d[2] - d[1];
+        v3 = d[1] - d[3];
+        d[0] = v0;
+        d[1] = v1;
+        d[2] = v2;
+        d[3] = v3;
+    } else
+    {
+        v0 = 4 * d[0] - 5 * d[2] + d[4];
+        v1 = -4 * (d[1] + d[2]) + d[3] + d[4];
+        v2 = 4 * (d[1] - d[2]) - d[3] + d[4];
+        v3 = 2 * (d[3] - d[1]) - d[2] + d[4];
+        v4 = 2 * (d[1] - d[3]) - d[2] + d[4];
+        v5 = 4 * d[1] - 5 * d[3] + d[5];
+        d[0] = v0;
+        d[1] = v1;
+        d[2] = v2;
+        d[3] = v3;
+        d[4] = v4;
+        d[5] = v5;
+    }
+}
+
+/**
+ * @brief           Winograd output transform A^T m of one tile column or row, in-place
+ * @param[in,out]   m             dim_tile+2 values, of which the first dim_tile are the outputs
+ * @param[in]       dim_tile      output tile size, 2 or 4
+ *
+ * For F(4x4,3x3), the columns of A^T are scaled by 24 times the row scales
+ * of G taken out by arm_nn_winograd_weights_q7, so the outputs are 24 times
+ * too large.
+ */
+
+__STATIC_FORCEINLINE void arm_nn_winograd_output_1d(q63_t * m, const uint16_t dim_tile)
+{
+    q63_t     y0, y1, y2, y3;
+
+    if (dim_tile == 2)
+    {
+        y0 = m[0] + m[1] + m[2];
+        y1 = m[1] - m[2] - m[3];
+        m[0] = y0;
+        m[1] = y1;
+    } else
+    {
+        y0 = 6 * m[0] - 4 * (m[1] + m[2]) + m[3] + m[4];
+        y1 = 4 * (m[2] - m[1]) + 2 * (m[3] - m[4]);
+        y2 = 4 * (m[3] + m[4] - m[1] - m[2]);
+        y3 = 4 * (m[2] - m[1]) + 8 * (m[3] - m[4]) + 24 * m[5];
+        m[0] = y0;
+        m[1] = y1;
+        m[2] = y2;
+        m[3] = y3;
+    }
+}
+
+/**
+ * @brief           Removes the scale of a Winograd output
+ * @param[in]       y             output of the 2-D output transform
+ * @param[in]       dim_tile      output tile size, 2 or 4
+ * @return          the convolution output
+ *
+ * y is exactly 4 times the convolution for F(2x2,3x3), and 576 = 64*9 times
+ * for F(4x4,3x3). The exact division by 9 is a multiplication by the
+ * inverse of 9 modulo 2^64.
+ */
+
+__STATIC_FORCEINLINE q63_t arm_nn_winograd_descale(const q63_t y, const uint16_t dim_tile)
+{
+    if (dim_tile == 2)
+    {
+        return y >> 2;
+    }
+    return (q63_t) ((uint64_t) (y >> 6) * 0x8E38E38E38E38E39ULL);
+}
+
 /**
  * @brief defition to adding rouding offset
  */
@@ -0,0 +1,460 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_bench.c
+ * Description:  Host benchmark and regression harness of the NN kernels
+ *
+ * $Date:        13. July 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  host
+ *
+ * -------------------------------------------------------------------- */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "arm_nn_bench.h"
+
+/* Most rows of a baseline file */
+#define NN_BENCH_MAX_BASELINE 4096
+
+/* Longest line of a CSV file */
+#define NN_BENCH_LINE_LEN 256
+
+/**
+ * Settings of a run, from the command line.
+ */
+typedef struct
+{
+    uint32_t  shapes;           /**< random shapes per kernel. */
+    uint32_t  seed;             /**< seed of the shapes and data. */
+    float64_t tolerance;        /**< slowdown against the baseline that is reported, in percent. */
+    const char *csvFile;        /**< results are written here, if not NULL. */
+    const char *baselineFile;   /**< results are compared with this earlier output, if not NULL. */
+} nn_bench_config;
+
+/**
+ * Time of one row of the baseline.
+ */
+typedef struct
+{
+    char      key[NN_BENCH_LINE_LEN];   /**< section, name and shape, separated by commas. */
+    float64_t optUs;
+} nn_bench_baseline;
+
+float64_t nn_bench_min_us = 2000.0;
+
+static uint64_t nn_bench_state;
+static nn_bench_config nn_bench_cfg = { 4, 1, 10.0, NULL, NULL };
+static nn_bench_baseline *nn_bench_base = NULL;
+static uint32_t nn_bench_num_base = 0;
+static FILE *nn_bench_csv = NULL;
+static uint32_t nn_bench_num_results = 0;
+static uint32_t nn_bench_num_mismatch = 0;
+static uint32_t nn_bench_num_slower = 0;
+
+/*
+ * Helper functions
+ */
+
+/**
+ * Bit mixer of SplitMix64.
+ */
+static uint64_t nn_bench_mix64(uint64_t x)
+{
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9ULL;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EBULL;
+    x ^= x >> 31;
+
+    return x;
+}
+
+/**
+ * Seeds the generator from the seed of the run and a name, so the shapes
+ * of a kernel do not depend on which other kernels are run.
+ */
+static void nn_bench_seed(const char *name)
+{
+    uint64_t  h = nn_bench_cfg.seed;
+
+    while (*name)
+    {
+        h = nn_bench_mix64(h ^ (uint8_t) * name++);
+    }
+    nn_bench_state = h;
+}
+
+float64_t nn_bench_now_us(void)
+{
+#if defined(CLOCK_MONOTONIC)
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e6 + t.tv_nsec * 1e-3;
+#else
+    return (float64_t) clock() * 1e6 / CLOCKS_PER_SEC;
+#endif
+}
+
+int32_t nn_bench_rand(int32_t lo, int32_t hi)
+{
+    nn_bench_state += 0x9E3779B97F4A7C15ULL;
+
+    return lo + (int32_t) (nn_bench_mix64(nn_bench_state) % (uint64_t) (hi - lo + 1));
+}
+
+void nn_bench_fill_q7(q7_t * pDst, uint32_t n, int32_t lo, int32_t hi)
+{
+    uint32_t  i;
+
+    for (i = 0; i < n; i++)
+    {
+        pDst[i] = (q7_t) nn_bench_rand(lo, hi);
+    }
+}
+
+void nn_bench_fill_q15(q15_t * pDst, uint32_t n, int32_t lo, int32_t hi)
+{
+    uint32_t  i;
+
+    for (i = 0; i < n; i++)
+    {
+        pDst[i] = (q15_t) nn_bench_rand(lo, hi);
+    }
+}
+
+int32_t nn_bench_mismatch_q7(const q7_t * pRef, const q7_t * pOpt, uint32_t n)
+{
+    int32_t   count = 0;
+    uint32_t  i;
+
+    for (i = 0; i < n; i++)
+    {
+        count += pRef[i] != pOpt[i];
+    }
+
+    return count;
+}
+
+int32_t nn_bench_mismatch_q15(const q15_t * pRef, const q15_t * pOpt, uint32_t n)
+{
+    int32_t   count = 0;
+    uint32_t  i;
+
+    for (i = 0; i < n; i++)
+    {
+        count += pRef[i] != pOpt[i];
+    }
+
+    return count;
+}
+
+void nn_bench_copy(void *pDst, const void *pSrc, uint32_t size)
+{
+    memcpy(pDst, pSrc, size);
+}
+
+void     *nn_bench_alloc(uint32_t size)
+{
+    void     *p = calloc((size + 3) / 4, 4);
+
+    if (p == NULL)
+    {
+        printf("Out of memory\n");
+        exit(2);
+    }
+
+    return p;
+}
+
+/**
+ * Reads the section, name, shape and time of each row of an earlier CSV output.
+ */
+static int nn_bench_load_baseline(const char *file)
+{
+    char      line[NN_BENCH_LINE_LEN];
+    FILE     *f = fopen(file, "r");
+
+    if (f == NULL)
+    {
+        printf("Cannot open %s\n", file);
+        return 0;
+    }
+
+    nn_bench_base = (nn_bench_baseline *) nn_bench_alloc(NN_BENCH_MAX_BASELINE * sizeof(nn_bench_baseline));
+
+    while (fgets(line, sizeof(line), f) != NULL && nn_bench_num_base < NN_BENCH_MAX_BASELINE)
+    {
+        char     *field = line;
+        int       commas = 0;
+
+        /* the key ends at the third comma, the time of the library function is the sixth field */
+        while (*field && commas < 5)
+        {
+            if (*field == ',' && ++commas == 3)
+            {
+                memcpy(nn_bench_base[nn_bench_num_base].key, line, field - line);
+                nn_bench_base[nn_bench_num_base].key[field - line] = 0;
+            }
+            field++;
+        }
+        if (commas == 5 && strncmp(line, "section,", 8) != 0)
+        {
+            nn_bench_base[nn_bench_num_base++].optUs = atof(field);
+        }
+    }
+    fclose(f);
+
+    return 1;
+}
+
+static const nn_bench_baseline *nn_bench_find_baseline(const nn_bench_result * pResult)
+{
+    char      key[NN_BENCH_LINE_LEN];
+    uint32_t  i;
+
+    snprintf(key, sizeof(key), "%s,%s,%s", pResult->section, pResult->name, pResult->shape);
+    for (i = 0; i < nn_bench_num_base; i++)
+    {
+        if (strcmp(nn_bench_base[i].key, key) == 0)
+        {
+            return &nn_bench_base[i];
+        }
+    }
+
+    return NULL;
+}
+
+static void nn_bench_report_header(void)
+{
+    printf("%-8s %-46s %-36s %10s %8s %10s %10s %7s %8s  %s\n",
+           "Section", "Name", "Shape", "Ops", "Mismatch", "Opt us", "Ref us", "Speedup", "MOPS", "Baseline");
+}
+
+/**
+ * Prints a result, writes it to the CSV file and compares it with the baseline.
+ */
+static void nn_bench_report(nn_bench_result * pResult)
+{
+    char      match[16];
+    char      base[32] = "";
+    const nn_bench_baseline *pBase;
+    float64_t speedup = pResult->optUs > 0.0 && pResult->refUs > 0.0 ? pResult->refUs / pResult->optUs : 0.0;
+    float64_t mops = pResult->optUs > 0.0 ? pResult->ops / pResult->optUs : 0.0;
+
+    nn_bench_num_results++;
+
+    if (pResult->mismatch < 0)
+    {
+        strcpy(match, "-");
+    } else
+    {
+        snprintf(match, sizeof(match), "%ld", (long) pResult->mismatch);
+        nn_bench_num_mismatch += pResult->mismatch > 0;
+    }
+
+    if (nn_bench_num_base > 0 && pResult->optUs > 0.0)
+    {
+        pBase = nn_bench_find_baseline(pResult);
+        if (pBase == NULL)
+        {
+            strcpy(base, "new");
+        } else
+        {
+            float64_t change = (pResult->optUs / pBase->optUs - 1.0) * 100.0;
+
+            snprintf(base, sizeof(base), "%+.1f%%%s", change, change > nn_bench_cfg.tolerance ? " SLOWER" : "");
+            nn_bench_num_slower += change > nn_bench_cfg.tolerance;
+        }
+    }
+
+    printf("%-8s %-46s %-36s %10llu %8s %10.2f %10.2f %7.2f %8.1f  %s\n",
+           pResult->section, pResult->name, pResult->shape, (unsigned long long) pResult->ops, match,
+           pResult->optUs, pResult->refUs, speedup, mops, base);
+    fflush(stdout);
+
+    if (nn_bench_csv != NULL)
+    {
+        fprintf(nn_bench_csv, "%s,%s,%s,%llu,%ld,%.3f,%.3f,%.3f\n",
+                pResult->section, pResult->name, pResult->shape, (unsigned long long) pResult->ops,
+                (long) pResult->mismatch, pResult->optUs, pResult->refUs, mops);
+    }
+}
+
+static int nn_bench_selected(const char *name, const char **filters, uint32_t numFilters)
+{
+    uint32_t  j;
+
+    for (j = 0; j < numFilters; j++)
+    {
+        if (strstr(name, filters[j]) != NULL)
+        {
+            return 1;
+        }
+    }
+
+    return numFilters == 0;
+}
+
+static void nn_bench_usage(const char *prog)
+{
+    printf("Usage: %s [options] [name ...]\n"
+           "  Runs the kernels and networks whose names contain one of the given\n"
+           "  strings, or all of them, checks them against the reference\n"
+           "  implementations and times them.\n"
+           "  -n shapes   random shapes per kernel (default 4)\n"
+           "  -r seed     seed of the shapes and data (default 1)\n"
+           "  -m ms       minimum duration of a timed batch (default 2)\n"
+           "  -c          check only, no timing\n"
+           "  -o file     write the results as CSV\n"
+           "  -b file     compare the times with an earlier CSV output\n"
+           "  -t percent  slowdown against the baseline that fails the run (default 10)\n"
+           "  -l          list the kernels and networks\n",
+           prog);
+}
+
+/*
+ * Main
+ */
+
+int main(int argc, char **argv)
+{
+    const char *filters[64];
+    uint32_t  numFilters = 0;
+    uint32_t  k, s;
+    int       i;
+    nn_bench_result result;
+    float64_t start;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+        {
+            nn_bench_cfg.shapes = (uint32_t) atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc)
+        {
+            nn_bench_cfg.seed = (uint32_t) strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(argv[i], "-m") == 0 && i + 1 < argc)
+        {
+            nn_bench_min_us = atof(argv[++i]) * 1000.0;
+        } else if (strcmp(argv[i], "-c") == 0)
+        {
+            nn_bench_min_us = 0.0;
+        } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+        {
+            nn_bench_cfg.csvFile = argv[++i];
+        } else if (strcmp(argv[i], "-b") == 0 && i + 1 < argc)
+        {
+            nn_bench_cfg.baselineFile = argv[++i];
+        } else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+        {
+            nn_bench_cfg.tolerance = atof(argv[++i]);
+        } else if (strcmp(argv[i], "-l") == 0)
+        {
+            for (k = 0; k < nn_bench_num_kernels; k++)
+            {
+                printf("%s\n", nn_bench_kernels[k].name);
+            }
+            for (k = 0; k < nn_bench_num_networks; k++)
+            {
+                printf("%s\n", nn_bench_networks[k].name);
+            }
+            return 0;
+        } else if (argv[i][0] == '-' || numFilters == 64)
+        {
+            nn_bench_usage(argv[0]);
+            return 2;
+        } else
+        {
+            filters[numFilters++] = argv[i];
+        }
+    }
+
+    if (nn_bench_cfg.baselineFile != NULL && !nn_bench_load_baseline(nn_bench_cfg.baselineFile))
+    {
+        return 2;
+    }
+    if (nn_bench_cfg.csvFile != NULL)
+    {
+        nn_bench_csv = fopen(nn_bench_cfg.csvFile, "w");
+        if (nn_bench_csv == NULL)
+        {
+            printf("Cannot open %s\n", nn_bench_cfg.csvFile);
+            return 2;
+        }
+        fprintf(nn_bench_csv, "section,name,shape,ops,mismatch,opt_us,ref_us,mops\n");
+    }
+
+#if defined (ARM_MATH_DSP)
+    printf("DSP code paths, %u shapes per kernel, seed %u\n\n", (unsigned) nn_bench_cfg.shapes,
+           (unsigned) nn_bench_cfg.seed);
+#else
+    printf("Plain C code paths, %u shapes per kernel, seed %u\n\n", (unsigned) nn_bench_cfg.shapes,
+           (unsigned) nn_bench_cfg.seed);
+#endif
+    nn_bench_report_header();
+
+    start = nn_bench_now_us();
+
+    for (k = 0; k < nn_bench_num_kernels; k++)
+    {
+        if (!nn_bench_selected(nn_bench_kernels[k].name, filters, numFilters))
+        {
+            continue;
+        }
+        nn_bench_seed(nn_bench_kernels[k].name);
+        for (s = 0; s < nn_bench_cfg.shapes; s++)
+        {
+            memset(&result, 0, sizeof(result));
+            result.section = "kernel";
+            result.name = nn_bench_kernels[k].name;
+            nn_bench_kernels[k].run(&result);
+            nn_bench_report(&result);
+        }
+    }
+
+    for (k = 0; k < nn_bench_num_networks; k++)
+    {
+        if (nn_bench_selected(nn_bench_networks[k].name, filters, numFilters))
+        {
+            nn_bench_seed(nn_bench_networks[k].name);
+            nn_bench_networks[k].run(nn_bench_report);
+        }
+    }
+
+    if (nn_bench_csv != NULL)
+    {
+        fclose(nn_bench_csv);
+    }
+
+    printf("\n%u results, %u with mismatches", (unsigned) nn_bench_num_results, (unsigned) nn_bench_num_mismatch);
+    if (nn_bench_num_base > 0)
+    {
+        printf(", %u more than %.1f%% slower than the baseline", (unsigned) nn_bench_num_slower,
+               nn_bench_cfg.tolerance);
+    }
+    printf(", elapsed %.1f s\n", (nn_bench_now_us() - start) * 1e-6);
+
+    return nn_bench_num_mismatch > 0 || nn_bench_num_slower > 0;
+}
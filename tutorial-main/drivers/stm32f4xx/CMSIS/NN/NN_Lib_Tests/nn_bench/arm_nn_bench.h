@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_bench.h
+ * Description:  Host benchmark and regression harness of the NN kernels
+ *
+ * $Date:        13. July 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  host
+ *
+ * -------------------------------------------------------------------- */
+
+#ifndef _ARM_NN_BENCH_H_
+#define _ARM_NN_BENCH_H_
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+#ifdef __cplusplus
+extern    "C"
+{
+#endif
+
+/*
+ * The harness runs each kernel of the library next to its counterpart in
+ * Ref_Implementations, on random data and on shapes drawn from a seeded
+ * generator, so the shapes of a run are the same on every host. The
+ * outputs are compared bit by bit and both versions are timed.
+ *
+ * The cifar10 and gru examples are run layer by layer with their weights,
+ * which gives the latency of each layer of a real network.
+ */
+
+/* Longest shape description, including the terminating zero */
+#define NN_BENCH_SHAPE_LEN 80
+
+/**
+ * Measurement of one kernel on one shape, or of one layer of a network.
+ */
+typedef struct
+{
+    const char *section;        /**< "kernel", or the name of the network. */
+    const char *name;           /**< function, or layer of the network. */
+    char      shape[NN_BENCH_SHAPE_LEN];  /**< dimensions, without commas. */
+    uint64_t  ops;              /**< multiply-accumulates, or input elements for pooling and activations. */
+    int32_t   mismatch;         /**< outputs that differ from the reference, -1 if there is no reference. */
+    float64_t optUs;            /**< time of the library function in microseconds. */
+    float64_t refUs;            /**< time of the reference in microseconds, 0 if there is none. */
+} nn_bench_result;
+
+/**
+ * A kernel and the function that benchmarks it on one random shape.
+ */
+typedef struct
+{
+    const char *name;
+    void      (*run) (nn_bench_result * pResult);
+} nn_bench_kernel;
+
+/**
+ * A network, run layer by layer. report is called once per layer.
+ */
+typedef struct
+{
+    const char *name;
+    void      (*run) (void (*report) (nn_bench_result * pResult));
+} nn_bench_network;
+
+extern const nn_bench_kernel nn_bench_kernels[];
+extern const uint32_t nn_bench_num_kernels;
+extern const nn_bench_network nn_bench_networks[];
+extern const uint32_t nn_bench_num_networks;
+
+/* Minimum duration of one timed batch in microseconds, 0 skips the timing */
+extern float64_t nn_bench_min_us;
+
+/**
+ * Current time in microseconds.
+ */
+float64_t nn_bench_now_us(void);
+
+/**
+ * Random integer in [lo, hi], from the seeded generator of the run.
+ */
+int32_t   nn_bench_rand(int32_t lo, int32_t hi);
+
+/**
+ * Fill with random values in [lo, hi].
+ */
+void      nn_bench_fill_q7(q7_t * pDst, uint32_t n, int32_t lo, int32_t hi);
+void      nn_bench_fill_q15(q15_t * pDst, uint32_t n, int32_t lo, int32_t hi);
+
+/**
+ * Number of elements that differ.
+ */
+int32_t   nn_bench_mismatch_q7(const q7_t * pRef, const q7_t * pOpt, uint32_t n);
+int32_t   nn_bench_mismatch_q15(const q15_t * pRef, const q15_t * pOpt, uint32_t n);
+
+/**
+ * memcpy, out of line, so that the copies of a timed batch are not merged.
+ */
+void      nn_bench_copy(void *pDst, const void *pSrc, uint32_t size);
+
+/**
+ * Bytes from the heap, 4-byte aligned and zeroed. Exits if out of memory.
+ */
+void     *nn_bench_alloc(uint32_t size);
+
+/*
+ * Times "call" in microseconds. The batch of calls is doubled until it
+ * takes nn_bench_min_us, then the fastest of three batches is kept.
+ * "prepare" runs before each call, e.g. to restore the input of an
+ * in-place kernel, and its own time is subtracted.
+ */
+#define NN_BENCH_TIME(us, prepare, call)                                        \
+    do                                                                          \
+    {                                                                           \
+        uint32_t  reps_ = 1;                                                    \
+        uint32_t  r_;                                                           \
+        int       k_;                                                           \
+        float64_t t_, best_ = 1e30, bestPrep_ = 1e30;                           \
+                                                                                \
+        if (nn_bench_min_us <= 0.0)                                             \
+        {                                                                       \
+            (us) = 0.0;                                                         \
+            break;                                                              \
+        }                                                                       \
+        for (;;)                                                                \
+        {                                                                       \
+            t_ = nn_bench_now_us();                                             \
+            for (r_ = 0; r_ < reps_; r_++)                                      \
+            {                                                                   \
+                prepare;                                                        \
+                call;                                                           \
+            }                                                                   \
+            if (nn_bench_now_us() - t_ >= nn_bench_min_us || reps_ >= (1u << 30)) \
+            {                                                                   \
+                break;                                                          \
+            }                                                                   \
+            reps_ *= 2;                                                         \
+        }                                                                       \
+        for (k_ = 0; k_ < 3; k_++)                                              \
+        {                                                                       \
+            t_ = nn_bench_now_us();                                             \
+            for (r_ = 0; r_ < reps_; r_++)                                      \
+            {                                                                   \
+                prepare;                                                        \
+                call;                                                           \
+            }                                                                   \
+            t_ = nn_bench_now_us() - t_;                                        \
+            best_ = t_ < best_ ? t_ : best_;                                    \
+            t_ = nn_bench_now_us();                                             \
+            for (r_ = 0; r_ < reps_; r_++)                                      \
+            {                                                                   \
+                prepare;                                                        \
+            }                                                                   \
+            t_ = nn_bench_now_us() - t_;                                        \
+            bestPrep_ = t_ < bestPrep_ ? t_ : bestPrep_;                        \
+        }                                                                       \
+        (us) = best_ > bestPrep_ ? (best_ - bestPrep_) / reps_ : 0.0;           \
+    } while (0)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _ARM_NN_BENCH_H_ */
@@ -0,0 +1,1047 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_bench_kernels.c
+ * Description:  Kernels of the NN benchmark, checked against the reference implementations
+ *
+ * $Date:        13. July 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  host
+ *
+ * -------------------------------------------------------------------- */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "arm_nn_bench.h"
+#include "ref_functions.h"
+
+/*
+ * Random shapes stay small enough for a quick check, and large enough for
+ * the timing to be dominated by the inner loops. The data of the q15
+ * kernels is 13 bits wide, so that the 32-bit accumulators of the
+ * references do not overflow.
+ */
+#define NN_BENCH_MAX_DIM 16
+#define NN_BENCH_MAX_CH 16
+#define NN_BENCH_Q15_MIN -4096
+#define NN_BENCH_Q15_MAX 4095
+
+/* Flags of nn_bench_conv_setup */
+#define NN_BENCH_CONV_SQUARE   0x1
+#define NN_BENCH_CONV_EVEN_OUT 0x2
+
+/**
+ * Shape, parameters and buffers of a convolution.
+ */
+typedef struct
+{
+    uint16_t  dim_in_x, dim_in_y, ch_in, ch_out;
+    uint16_t  ker_x, ker_y, pad_x, pad_y, stride_x, stride_y;
+    uint16_t  dim_out_x, dim_out_y;
+    uint16_t  bias_shift, out_shift;
+    uint32_t  in_size, out_size;
+    void     *pIn;
+    void     *pWt;
+    void     *pBias;
+    void     *pRef;
+    void     *pOpt;
+    q15_t    *bufferA;
+    q7_t     *bufferB;
+    /* int8 kernels */
+    q31_t    *pBias32;
+    q31_t    *pMult;
+    int32_t  *pShift;
+    int32_t   in_offset, out_offset, act_min, act_max;
+} nn_bench_conv;
+
+/**
+ * Shape, parameters and buffers of a fully-connected layer.
+ */
+typedef struct
+{
+    uint16_t  dim_vec, rows;
+    uint16_t  bias_shift, out_shift;
+    void     *pV;
+    q7_t     *pM;
+    void     *pBias;
+    void     *pRef;
+    void     *pOpt;
+    q15_t    *vec_buffer;
+    /* int8 and q15 weights */
+    q15_t    *pM15;
+    q31_t    *pBias32;
+    q31_t    *pMult;
+    int32_t  *pShift;
+    int32_t   in_offset, out_offset, act_min, act_max;
+} nn_bench_fc;
+
+/**
+ * Shape and buffers of a pooling layer or of an element-wise function.
+ */
+typedef struct
+{
+    uint16_t  dim_in, ch, ker, pad, stride, dim_out;
+    uint32_t  in_size, out_size;
+    q7_t     *pIn;
+    q7_t     *pSaved;
+    q7_t     *pRef;
+    q7_t     *pOpt;
+    q15_t    *bufferA;
+} nn_bench_pool;
+
+/*
+ * Helper functions
+ */
+
+/**
+ * Number of significant bits of x.
+ */
+static uint16_t nn_bench_bits(uint32_t x)
+{
+    uint16_t  bits = 0;
+
+    while (x)
+    {
+        bits++;
+        x >>= 1;
+    }
+
+    return bits;
+}
+
+/**
+ * The sum of n random products grows with sqrt(n), so the output shift that
+ * keeps most outputs inside the output range is base + log2(n) / 2.
+ */
+static uint16_t nn_bench_out_shift(uint32_t n, uint16_t base)
+{
+    return base + nn_bench_bits(n) / 2;
+}
+
+/**
+ * Random per-channel requantization: multipliers in [0.5, 1) and shifts
+ * that scale the sum of n products of int8 values to about 7 bits.
+ */
+static void nn_bench_fill_requant(q31_t * pBias, q31_t * pMult, int32_t * pShift, uint32_t ch, uint32_t n)
+{
+    uint32_t  i;
+
+    for (i = 0; i < ch; i++)
+    {
+        pBias[i] = nn_bench_rand(-(1 << 14), 1 << 14);
+        pMult[i] = nn_bench_rand(1 << 30, 0x7FFFFFFF);
+        pShift[i] = -(int32_t) nn_bench_out_shift(n, 6);
+    }
+}
+
+/**
+ * Number of outputs, or all of them if the kernel rejected its arguments.
+ */
+static int32_t nn_bench_check_q7(arm_status status, const void *pRef, const void *pOpt, uint32_t n)
+{
+    return status != ARM_MATH_SUCCESS ? (int32_t) n : nn_bench_mismatch_q7((const q7_t *) pRef, (const q7_t *) pOpt, n);
+}
+
+static int32_t nn_bench_check_q15(arm_status status, const void *pRef, const void *pOpt, uint32_t n)
+{
+    return status != ARM_MATH_SUCCESS ? (int32_t) n : nn_bench_mismatch_q15((const q15_t *) pRef, (const q15_t *) pOpt,
+                                                                              n);
+}
+
+/**
+ * Draws a convolution.
+ * ker is the kernel size, or 0 for random sizes up to 5.
+ * The input channels are a multiple of ch_in_step, or the 3 channels of an
+ * RGB image if ch_in_step is 0. The output channels are a multiple of
+ * ch_out_step, or equal to the input channels if ch_out_step is 0.
+ * flags are NN_BENCH_CONV_SQUARE, and NN_BENCH_CONV_EVEN_OUT for the
+ * kernels that compute the output columns in pairs.
+ * elem is the size of the data, 1 for q7 and 2 for q15.
+ */
+static void nn_bench_conv_setup(nn_bench_conv * c, nn_bench_result * pResult, uint16_t ker, uint16_t stride_max,
+                                uint16_t ch_in_step, uint16_t ch_out_step, int flags, uint32_t elem)
+{
+    int       square = flags & NN_BENCH_CONV_SQUARE;
+    uint32_t  n, wt_size;
+
+    memset(c, 0, sizeof(*c));
+
+    c->ker_x = ker ? ker : (uint16_t) nn_bench_rand(1, 5);
+    c->ker_y = square ? c->ker_x : ker ? ker : (uint16_t) nn_bench_rand(1, 5);
+    c->pad_x = (uint16_t) nn_bench_rand(0, c->ker_x / 2);
+    c->pad_y = square ? c->pad_x : (uint16_t) nn_bench_rand(0, c->ker_y / 2);
+    c->stride_x = (uint16_t) nn_bench_rand(1, stride_max);
+    c->stride_y = square ? c->stride_x : (uint16_t) nn_bench_rand(1, stride_max);
+    do
+    {
+        c->dim_in_x = (uint16_t) nn_bench_rand(c->ker_x > 4 ? c->ker_x : 4, NN_BENCH_MAX_DIM);
+        c->dim_out_x = (c->dim_in_x + 2 * c->pad_x - c->ker_x) / c->stride_x + 1;
+    }
+    while ((flags & NN_BENCH_CONV_EVEN_OUT) && (c->dim_out_x & 0x1));
+    c->dim_in_y = square ? c->dim_in_x : (uint16_t) nn_bench_rand(c->ker_y > 4 ? c->ker_y : 4, NN_BENCH_MAX_DIM);
+    c->ch_in = ch_in_step ? ch_in_step * (uint16_t) nn_bench_rand(1, NN_BENCH_MAX_CH / ch_in_step) : 3;
+    c->ch_out = ch_out_step ? ch_out_step * (uint16_t) nn_bench_rand(1, NN_BENCH_MAX_CH / ch_out_step) : c->ch_in;
+    c->dim_out_y = (c->dim_in_y + 2 * c->pad_y - c->ker_y) / c->stride_y + 1;
+
+    /* depthwise convolutions have one filter per channel */
+    n = c->ker_x * c->ker_y * (ch_out_step ? c->ch_in : 1);
+    wt_size = n * c->ch_out;
+    c->in_size = c->dim_in_x * c->dim_in_y * c->ch_in;
+    c->out_size = c->dim_out_x * c->dim_out_y * c->ch_out;
+
+    c->pIn = nn_bench_alloc(c->in_size * elem);
+    c->pWt = nn_bench_alloc(wt_size * elem);
+    c->pBias = nn_bench_alloc(c->ch_out * elem);
+    c->pRef = nn_bench_alloc(c->out_size * elem);
+    c->pOpt = nn_bench_alloc(c->out_size * elem);
+    c->bufferA = (q15_t *) nn_bench_alloc((2 * c->ch_in + 4) * c->ker_x * c->ker_y * sizeof(q15_t));
+    c->bufferB = (q7_t *) nn_bench_alloc(2 * c->ch_out * c->dim_out_x);
+
+    if (elem == sizeof(q7_t))
+    {
+        nn_bench_fill_q7((q7_t *) c->pIn, c->in_size, -128, 127);
+        nn_bench_fill_q7((q7_t *) c->pWt, wt_size, -128, 127);
+        nn_bench_fill_q7((q7_t *) c->pBias, c->ch_out, -128, 127);
+        c->out_shift = nn_bench_out_shift(n, 7);
+    } else
+    {
+        nn_bench_fill_q15((q15_t *) c->pIn, c->in_size, NN_BENCH_Q15_MIN, NN_BENCH_Q15_MAX);
+        nn_bench_fill_q15((q15_t *) c->pWt, wt_size, NN_BENCH_Q15_MIN, NN_BENCH_Q15_MAX);
+        nn_bench_fill_q15((q15_t *) c->pBias, c->ch_out, NN_BENCH_Q15_MIN, NN_BENCH_Q15_MAX);
+        c->out_shift = nn_bench_out_shift(n, 9);
+    }
+    c->bias_shift = (uint16_t) nn_bench_rand(0, 3);
+
+    if (square)
+    {
+        snprintf(pResult->shape, NN_BENCH_SHAPE_LEN, "%ux%ux%u k%u p%u s%u o%u", c->dim_in_x, c->dim_in_y,
+                 c->ch_in, c->ker_x, c->pad_x, c->stride_x, c->ch_out);
+    } else
+    {
+        snprintf(pResult->shape, NN_BENCH_SHAPE_LEN, "%ux%ux%u k%ux%u p%ux%u s%ux%u o%u", c->dim_in_x,
+                 c->dim_in_y, c->ch_in, c->ker_x, c->ker_y, c->pad_x, c->pad_y, c->stride_x, c->stride_y,
+                 c->ch_out);
+    }
+    pResult->ops = (uint64_t) c->out_size * n;
+}
+
+/**
+ * Adds the per-channel requantization and the zero points of the int8 kernels.
+ */
+static void nn_bench_conv_setup_s8(nn_bench_conv * c, uint32_t n)
+{
+    c->pBias32 = (q31_t *) nn_bench_alloc(c->ch_out * sizeof(q31_t));
+    c->pMult = (q31_t *) nn_bench_alloc(c->ch_out * sizeof(q31_t));
+    c->pShift = (int32_t *) nn_bench_alloc(c->ch_out * sizeof(int32_t));
+    nn_bench_fill_requant(c->pBias32, c->pMult, c->pShift, c->ch_out, n);
+    c->in_offset = nn_bench_rand(-16, 16);
+    c->out_offset = nn_bench_rand(-16, 16);
+    c->act_min = nn_bench_rand(-128, -64);
+    c->act_max = nn_bench_rand(64, 127);
+}
+
+static void nn_bench_conv_free(nn_bench_conv * c)
+{
+    free(c->pIn);
+    free(c->pWt);
+    free(c->pBias);
+    free(c->pRef);
+    free(c->pOpt);
+    free(c->bufferA);
+    free(c->bufferB);
+    free(c->pBias32);
+    free(c->pMult);
+    free(c->pShift);
+}
+
+/**
+ * Draws a fully-connected layer, with q7 or q15 data as for the convolutions.
+ */
+static void nn_bench_fc_setup(nn_bench_fc * f, nn_bench_result * pResult, uint32_t elem_v, uint32_t elem_m,
+                              uint32_t elem_out)
+{
+    uint32_t  size;
+
+    memset(f, 0, sizeof(*f));
+
+    f->dim_vec = (uint16_t) nn_bench_rand(8, 1024);
+    f->rows = (uint16_t) nn_bench_rand(4, 128);
+    size = f->dim_vec * f->rows;
+
+    f->pV = nn_bench_alloc(f->dim_vec * elem_v);
+    f->pBias = nn_bench_alloc(f->rows * elem_m);
+    f->pRef = nn_bench_alloc(f->rows * elem_out);
+    f->pOpt = nn_bench_alloc(f->rows * elem_out);
+    f->vec_buffer = (q15_t *) nn_bench_alloc(2 * f->dim_vec * sizeof(q15_t));
+
+    if (elem_m == sizeof(q7_t))
+    {
+        f->pM = (q7_t *) nn_bench_alloc(size);
+        nn_bench_fill_q7(f->pM, size, -128, 127);
+    } else
+    {
+        f->pM15 = (q15_t *) nn_bench_alloc(size * sizeof(q15_t));
+        nn_bench_fill_q15(f->pM15, size, NN_BENCH_Q15_MIN, NN_BENCH_Q15_MAX);
+    }
+
+    if (elem_v == sizeof(q7_t))
+    {
+        nn_bench_fill_q7((q7_t *) f->pV, f->dim_vec, -128, 127);
+    } else
+    {
+        nn_bench_fill_q15((q15_t *) f->pV, f->dim_vec, NN_BENCH_Q15_MIN, NN_BENCH_Q15_MAX);
+    }
+
+    /* the bias has the type of the weights */
+    if (elem_m == sizeof(q7_t))
+    {
+        nn_bench_fill_q7((q7_t *) f->pBias, f->rows, -128, 127);
+    } else
+    {
+        nn_bench_fill_q15((q15_t *) f->pBias, f->rows, NN_BENCH_Q15_MIN, NN_BENCH_Q15_MAX);
+    }
+
+    /* the products are 14 bits wide for q7 x q7, 20 bits for q7 x q15 and 26 bits for q15 x q15 */
+    f->out_shift = nn_bench_out_shift(f->dim_vec, elem_v + elem_m == 2 ? 7 : elem_v + elem_m == 3 ? 5 : 9);
+    f->bias_shift = (uint16_t) nn_bench_rand(0, 3);
+
+    snprintf(pResult->shape, NN_BENCH_SHAPE_LEN, "%u x %u", f->rows, f->dim_vec);
+    pResult->ops = (uint64_t) size;
+}
+
+static void nn_bench_fc_free(nn_bench_fc * f)
+{
+    free(f->pV);
+    free(f->pM);
+    free(f->pM15);
+    free(f->pBias);
+    free(f->pRef);
+    free(f->pOpt);
+    free(f->vec_buffer);
+    free(f->pBias32);
+    free(f->pMult);
+    free(f->pShift);
+}
+
+/**
+ * Draws a pooling layer, with padding if padded is set. The input is also
+ * saved, for the kernels that work in place.
+ */
+static void nn_bench_pool_setup(nn_bench_pool * p, nn_bench_result * pResult, int padded)
+{
+    memset(p, 0, sizeof(*p));
+
+    p->ker = (uint16_t) nn_bench_rand(2, 3);
+    p->pad = padded ? (uint16_t) nn_bench_rand(0, p->ker / 2) : 0;
+    p->stride = (uint16_t) nn_bench_rand(1, 2);
+    p->dim_in = (uint16_t) nn_bench_rand(4, 2 * NN_BENCH_MAX_DIM);
+    p->ch = (uint16_t) nn_bench_rand(1, 2 * NN_BENCH_MAX_CH);
+    p->dim_out = (p->dim_in + 2 * p->pad - p->ker) / p->stride + 1;
+    p->in_size = p->dim_in * p->dim_in * p->ch;
+    p->out_size = p->dim_out * p->dim_out * p->ch;
+
+    p->pIn = (q7_t *) nn_bench_alloc(p->in_size);
+    p->pSaved = (q7_t *) nn_bench_alloc(p->in_size);
+    p->pRef = (q7_t *) nn_bench_alloc(p->out_size);
+    p->pOpt = (q7_t *) nn_bench_alloc(p->out_size);
+    p->bufferA = (q15_t *) nn_bench_alloc(2 * p->dim_in * p->ch * sizeof(q15_t));
+
+    nn_bench_fill_q7(p->pIn, p->in_size, -128, 127);
+    nn_bench_copy(p->pSaved, p->pIn, p->in_size);
+
+    snprintf(pResult->shape, NN_BENCH_SHAPE_LEN, "%ux%ux%u k%u p%u s%u", p->dim_in, p->dim_in, p->ch, p->ker,
+             p->pad, p->stride);
+    pResult->ops = (uint64_t) p->out_size * p->ker * p->ker;
+}
+
+/**
+ * Draws the length of a vector for the element-wise functions.
+ */
+static void nn_bench_vec_setup(nn_bench_pool * p, nn_bench_result * pResult, uint32_t elem)
+{
+    memset(p, 0, sizeof(*p));
+
+    p->in_size = p->out_size = (uint32_t) nn_bench_rand(16, 4096);
+
+    p->pIn = (q7_t *) nn_bench_alloc(2 * p->in_size * elem);
+    p->pSaved = (q7_t *) nn_bench_alloc(2 * p->in_size * elem);
+    p->pRef = (q7_t *) nn_bench_alloc(p->in_size * elem);
+    p->pOpt = (q7_t *) nn_bench_alloc(p->in_size * elem);
+
+    if (elem == sizeof(q7_t))
+    {
+        nn_bench_fill_q7(p->pIn, 2 * p->in_size, -128, 127);
+    } else
+    {
+        nn_bench_fill_q15((q15_t *) p->pIn, 2 * p->in_size, -32768, 32767);
+    }
+    nn_bench_copy(p->pSaved, p->pIn, 2 * p->in_size * elem);
+
+    snprintf(pResult->shape, NN_BENCH_SHAPE_LEN, "%u", (unsigned) p->in_size);
+    pResult->ops = p->in_size;
+}
+
+static void nn_bench_pool_free(nn_bench_pool * p)
+{
+    free(p->pIn);
+    free(p->pSaved);
+    free(p->pRef);
+    free(p->pOpt);
+    free(p->bufferA);
+}
+
+/*
+ * Convolutions
+ */
+
+/* Arguments shared by the library function and the reference */
+#define CONV_Q7(c)      (const q7_t *) (c).pIn, (c).dim_in_x, (c).ch_in, (const q7_t *) (c).pWt, (c).ch_out,     \
+                        (c).ker_x, (c).pad_x, (c).stride_x, (const q7_t *) (c).pBias, (c).bias_shift, (c).out_shift
+#define CONV_Q15(c)     (const q15_t *) (c).pIn, (c).dim_in_x, (c).ch_in, (const q15_t *) (c).pWt, (c).ch_out,   \
+                        (c).ker_x, (c).pad_x, (c).stride_x, (const q15_t *) (c).pBias, (c).bias_shift, (c).out_shift
+#define CONV_Q7_NS(c)   (const q7_t *) (c).pIn, (c).dim_in_x, (c).dim_in_y, (c).ch_in, (const q7_t *) (c).pWt,  \
+                        (c).ch_out, (c).ker_x, (c).ker_y, (c).pad_x, (c).pad_y, (c).stride_x, (c).stride_y,     \
+                        (const q7_t *) (c).pBias, (c).bias_shift, (c).out_shift
+#define CONV_Q15_NS(c)  (const q15_t *) (c).pIn, (c).dim_in_x, (c).dim_in_y, (c).ch_in, (const q15_t *) (c).pWt, \
+                        (c).ch_out, (c).ker_x, (c).ker_y, (c).pad_x, (c).pad_y, (c).stride_x, (c).stride_y,     \
+                        (const q15_t *) (c).pBias, (c).bias_shift, (c).out_shift
+#define CONV_S8(c)      (const q7_t *) (c).pIn, (c).dim_in_x, (c).ch_in, (const q7_t *) (c).pWt, (c).ch_out,     \
+                        (c).ker_x, (c).pad_x, (c).stride_x, (c).pBias32, (c).pMult, (c).pShift, (c).in_offset,  \
+                        (c).out_offset, (c).act_min, (c).act_max
+
+/*
+ * Defines the benchmark of a square q7 or q15 convolution against the
+ * reference ref, for the channel constraints of the function.
+ */
+#define NN_BENCH_DEFINE_CONV(func, ref, type, args, ker, stride_max, ch_in_step, ch_out_step, flags)      \
+    static void nn_bench_##func(nn_bench_result * pResult)                                               \
+    {                                                                                                    \
+        nn_bench_conv c;                                                                                 \
+        arm_status status;                                                                               \
+                                                                                                         \
+        nn_bench_conv_setup(&c, pResult, ker, stride_max, ch_in_step, ch_out_step,                       \
+                            NN_BENCH_CONV_SQUARE | (flags), sizeof(type##_t));                           \
+        ref(args(c), (type##_t *) c.pRef, c.dim_out_x, c.bufferA, c.bufferB);                            \
+        status = func(args(c), (type##_t *) c.pOpt, c.dim_out_x, c.bufferA, c.bufferB);                  \
+        pResult->mismatch = nn_bench_check_##type(status, c.pRef, c.pOpt, c.out_size);                   \
+        NN_BENCH_TIME(pResult->refUs, , ref(args(c), (type##_t *) c.pRef, c.dim_out_x, c.bufferA, c.bufferB)); \
+        NN_BENCH_TIME(pResult->optUs, , func(args(c), (type##_t *) c.pOpt, c.dim_out_x, c.bufferA, c.bufferB)); \
+        nn_bench_conv_free(&c);                                                                          \
+    }
+
+/* Non-square version */
+#define NN_BENCH_DEFINE_CONV_NS(func, ref, type, args, ker, stride_max, ch_in_step, ch_out_step, flags)   \
+    static void nn_bench_##func(nn_bench_result * pResult)                                               \
+    {                                                                                                    \
+        nn_bench_conv c;                                                                                 \
+        arm_status status;                                                                               \
+                                                                                                         \
+        nn_bench_conv_setup(&c, pResult, ker, stride_max, ch_in_step, ch_out_step, (flags), sizeof(type##_t)); \
+        ref(args(c), (type##_t *) c.pRef, c.dim_out_x, c.dim_out_y, c.bufferA, c.bufferB);               \
+        status = func(args(c), (type##_t *) c.pOpt, c.dim_out_x, c.dim_out_y, c.bufferA, c.bufferB);     \
+        pResult->mismatch = nn_bench_check_##type(status, c.pRef, c.pOpt, c.out_size);                   \
+        NN_BENCH_TIME(pResult->refUs, ,                                                                  \
+                      ref(args(c), (type##_t *) c.pRef, c.dim_out_x, c.dim_out_y, c.bufferA, c.bufferB)); \
+        NN_BENCH_TIME(pResult->optUs, ,                                                                  \
+                      func(args(c), (type##_t *) c.pOpt, c.dim_out_x, c.dim_out_y, c.bufferA, c.bufferB)); \
+        nn_bench_conv_free(&c);                                                                          \
+    }
+
+NN_BENCH_DEFINE_CONV(arm_convolve_HWC_q7_basic, arm_convolve_HWC_q7_ref, q7, CONV_Q7, 0, 2, 1, 1, 0)
+NN_BENCH_DEFINE_CONV(arm_convolve_HWC_q7_fast, arm_convolve_HWC_q7_ref, q7, CONV_Q7, 0, 2, 4, 2, 0)
+NN_BENCH_DEFINE_CONV(arm_convolve_HWC_q7_RGB, arm_convolve_HWC_q7_ref, q7, CONV_Q7, 0, 2, 0, 1, 0)
+NN_BENCH_DEFINE_CONV(arm_convolve_HWC_q15_basic, arm_convolve_HWC_q15_ref, q15, CONV_Q15, 0, 2, 1, 1, 0)
+NN_BENCH_DEFINE_CONV(arm_convolve_HWC_q15_fast, arm_convolve_HWC_q15_ref, q15, CONV_Q15, 0, 2, 2, 2,
+                     NN_BENCH_CONV_EVEN_OUT)
+NN_BENCH_DEFINE_CONV(arm_depthwise_separable_conv_HWC_q7, arm_depthwise_separable_conv_HWC_q7_ref, q7, CONV_Q7,
+                     0, 2, 2, 0, 0)
+NN_BENCH_DEFINE_CONV_NS(arm_convolve_HWC_q7_basic_nonsquare, arm_convolve_HWC_q7_ref_nonsquare, q7, CONV_Q7_NS,
+                        0, 2, 1, 1, 0)
+NN_BENCH_DEFINE_CONV_NS(arm_convolve_HWC_q7_fast_nonsquare, arm_convolve_HWC_q7_ref_nonsquare, q7, CONV_Q7_NS,
+                        0, 2, 4, 2, 0)
+NN_BENCH_DEFINE_CONV_NS(arm_convolve_1x1_HWC_q7_fast_nonsquare, arm_convolve_HWC_q7_ref_nonsquare, q7, CONV_Q7_NS,
+                        1, 1, 4, 2, 0)
+NN_BENCH_DEFINE_CONV_NS(arm_convolve_HWC_q15_fast_nonsquare, arm_convolve_HWC_q15_nonsquare_ref, q15, CONV_Q15_NS,
+                        0, 2, 2, 2, NN_BENCH_CONV_EVEN_OUT)
+NN_BENCH_DEFINE_CONV_NS(arm_depthwise_separable_conv_HWC_q7_nonsquare,
+                        arm_depthwise_separable_conv_HWC_q7_ref_nonsquare, q7, CONV_Q7_NS, 0, 2, 2, 0, 0)
+
+static void nn_bench_arm_depthwise_conv_HWC_q7(nn_bench_result * pResult)
+{
+    nn_bench_conv c;
+    arm_status status;
+
+    nn_bench_conv_setup(&c, pResult, 0, 2, 1, 0, NN_BENCH_CONV_SQUARE, sizeof(q7_t));
+    arm_depthwise_separable_conv_HWC_q7_ref(CONV_Q7(c), (q7_t *) c.pRef, c.dim_out_x, NULL, NULL);
+    status = arm_depthwise_conv_HWC_q7(CONV_Q7(c), (q7_t *) c.pOpt, c.dim_out_x, c.bufferA);
+    pResult->mismatch = nn_bench_check_q7(status, c.pRef, c.pOpt, c.out_size);
+    NN_BENCH_TIME(pResult->refUs, ,
+                  arm_depthwise_separable_conv_HWC_q7_ref(CONV_Q7(c), (q7_t *) c.pRef, c.dim_out_x, NULL, NULL));
+    NN_BENCH_TIME(pResult->optUs, , arm_depthwise_conv_HWC_q7(CONV_Q7(c), (q7_t *) c.pOpt, c.dim_out_x, c.bufferA));
+    nn_bench_conv_free(&c);
+}
+
+static void nn_bench_arm_depthwise_conv_3x3_HWC_q7(nn_bench_result * pResult)
+{
+    nn_bench_conv c;
+    arm_status status;
+
+    nn_bench_conv_setup(&c, pResult, 3, 2, 1, 0, NN_BENCH_CONV_SQUARE, sizeof(q7_t));
+    arm_depthwise_separable_conv_HWC_q7_ref(CONV_Q7(c), (q7_t *) c.pRef, c.dim_out_x, NULL, NULL);
+    status = arm_depthwise_conv_3x3_HWC_q7((const q7_t *) c.pIn, c.dim_in_x, c.ch_in, (const q7_t *) c.pWt, c.ch_out,
+                                           c.pad_x, c.stride_x, (const q7_t *) c.pBias, c.bias_shift, c.out_shift,
+                                           (q7_t *) c.pOpt, c.dim_out_x);
+    pResult->mismatch = nn_bench_check_q7(status, c.pRef, c.pOpt, c.out_size);
+    NN_BENCH_TIME(pResult->refUs, ,
+                  arm_depthwise_separable_conv_HWC_q7_ref(CONV_Q7(c), (q7_t *) c.pRef, c.dim_out_x, NULL, NULL));
+    NN_BENCH_TIME(pResult->optUs, ,
+                  arm_depthwise_conv_3x3_HWC_q7((const q7_t *) c.pIn, c.dim_in_x, c.ch_in, (const q7_t *) c.pWt,
+                                                c.ch_out, c.pad_x, c.stride_x, (const q7_t *) c.pBias, c.bias_shift,
+                                                c.out_shift, (q7_t *) c.pOpt, c.dim_out_x));
+    nn_bench_conv_free(&c);
+}
+
+/*
+ * The fused kernels are checked against the reference convolution,
+ * ReLU and max pooling, run one after the other.
+ */
+static void nn_bench_conv_relu_maxpool(nn_bench_result * pResult, int rgb)
+{
+    nn_bench_conv c;
+    arm_status status;
+    uint16_t  pool_ker, dim_pool;
+    q7_t     *pConv;
+
+    nn_bench_conv_setup(&c, pResult, 0, 2, rgb ? 0 : 4, 2, NN_BENCH_CONV_SQUARE, sizeof(q7_t));
+    pool_ker = (uint16_t) nn_bench_rand(2, 3);
+    pool_ker = c.dim_out_x < pool_ker ? 1 : pool_ker;
+    dim_pool = pool_ker == 1 ? c.dim_out_x : (c.dim_out_x - pool_ker) / 2 + 1;
+    pConv = (q7_t *) nn_bench_alloc(c.out_size);
+    snprintf(pResult->shape + strlen(pResult->shape), NN_BENCH_SHAPE_LEN - strlen(pResult->shape), " pool%u",
+             pool_ker);
+
+#define NN_BENCH_REF_CONV_RELU_MAXPOOL                                                              \
+    arm_convolve_HWC_q7_ref(CONV_Q7(c), pConv, c.dim_out_x, c.bufferA, NULL);                      \
+    arm_relu_q7_ref(pConv, c.out_size);                                                            \
+    if (pool_ker == 1)                                                                             \
+        nn_bench_copy(c.pRef, pConv, c.out_size);                                                  \
+    else                                                                                           \
+        arm_maxpool_q7_HWC_ref(pConv, c.dim_out_x, c.ch_out, pool_ker, 0, 2, dim_pool, NULL, (q7_t *) c.pRef)
+
+#define NN_BENCH_OPT_CONV_RELU_MAXPOOL                                                              \
+    status = rgb                                                                                   \
+        ? arm_convolve_HWC_q7_RGB_relu_maxpool(CONV_Q7(c), c.dim_out_x, pool_ker, 0, pool_ker == 1 ? 1 : 2, \
+                                               (q7_t *) c.pOpt, dim_pool, c.bufferA, c.bufferB)    \
+        : arm_convolve_HWC_q7_fast_relu_maxpool(CONV_Q7(c), c.dim_out_x, pool_ker, 0, pool_ker == 1 ? 1 : 2, \
+                                                (q7_t *) c.pOpt, dim_pool, c.bufferA, c.bufferB)
+
+    NN_BENCH_REF_CONV_RELU_MAXPOOL;
+    NN_BENCH_OPT_CONV_RELU_MAXPOOL;
+    pResult->mismatch = nn_bench_check_q7(status, c.pRef, c.pOpt, dim_pool * dim_pool * c.ch_out);
+    NN_BENCH_TIME(pResult->refUs, , NN_BENCH_REF_CONV_RELU_MAXPOOL);
+    NN_BENCH_TIME(pResult->optUs, , NN_BENCH_OPT_CONV_RELU_MAXPOOL);
+
+#undef NN_BENCH_REF_CONV_RELU_MAXPOOL
+#undef NN_BENCH_OPT_CONV_RELU_MAXPOOL
+
+    free(pConv);
+    nn_bench_conv_free(&c);
+}
+
+static void nn_bench_arm_convolve_HWC_q7_fast_relu_maxpool(nn_bench_result * pResult)
+{
+    nn_bench_conv_relu_maxpool(pResult, 0);
+}
+
+static void nn_bench_arm_convolve_HWC_q7_RGB_relu_maxpool(nn_bench_result * pResult)
+{
+    nn_bench_conv_relu_maxpool(pResult, 1);
+}
+
+/*
+ * The Winograd kernels take a 3x3 kernel with stride 1 and weights
+ * transformed ahead of time, outside of the timing.
+ */
+static void nn_bench_arm_convolve_HWC_q7_winograd(nn_bench_result * pResult)
+{
+    nn_bench_conv c;
+    arm_status status;
+    uint16_t  dim_tile;
+    q15_t    *pWino, *pBuf;
+
+    nn_bench_conv_setup(&c, pResult, 3, 1, 1, 1, NN_BENCH_CONV_SQUARE, sizeof(q7_t));
+    dim_tile = (uint16_t) (2 * nn_bench_rand(1, 2));
+    pWino = (q15_t *) nn_bench_alloc((dim_tile + 2) * (dim_tile + 2) * c.ch_in * c.ch_out * sizeof(q15_t));
+    pBuf = (q15_t *) nn_bench_alloc((dim_tile + 2) * (dim_tile + 2) * c.ch_in * sizeof(q15_t));
+    snprintf(pResult->shape + strlen(pResult->shape), NN_BENCH_SHAPE_LEN - strlen(pResult->shape), " F%u", dim_tile);
+
+    arm_nn_winograd_weights_q7((const q7_t *) c.pWt, c.ch_in, c.ch_out, dim_tile, pWino);
+    arm_convolve_HWC_q7_ref(CONV_Q7(c), (q7_t *) c.pRef, c.dim_out_x, c.bufferA, NULL);
+    status = arm_convolve_HWC_q7_winograd((const q7_t *) c.pIn, c.dim_in_x, c.ch_in, pWino, c.ch_out, dim_tile, c.pad_x,
+                                          (const q7_t *) c.pBias, c.bias_shift, c.out_shift, (q7_t *) c.pOpt,
+                                          c.dim_out_x, pBuf);
+    pResult->mismatch = nn_bench_check_q7(status, c.pRef, c.pOpt, c.out_size);
+    NN_BENCH_TIME(pResult->refUs, , arm_convolve_HWC_q7_ref(CONV_Q7(c), (q7_t *) c.pRef, c.dim_out_x, c.bufferA, NULL));
+    NN_BENCH_TIME(pResult->optUs, ,
+                  arm_convolve_HWC_q7_winograd((const q7_t *) c.pIn, c.dim_in_x, c.ch_in, pWino, c.ch_out, dim_tile,
+                                               c.pad_x, (const q7_t *) c.pBias, c.bias_shift, c.out_shift,
+                                               (q7_t *) c.pOpt, c.dim_out_x, pBuf));
+    free(pWino);
+    free(pBuf);
+    nn_bench_conv_free(&c);
+}
+
+static void nn_bench_arm_convolve_HWC_q15_winograd(nn_bench_result * pResult)
+{
+    nn_bench_conv c;
+    arm_status status;
+    uint16_t  dim_tile;
+    q31_t    *pWino;
+    q15_t    *pBuf;
+
+    nn_bench_conv_setup(&c, pResult, 3, 1, 1, 1, NN_BENCH_CONV_SQUARE, sizeof(q15_t));
+    dim_tile = (uint16_t) (2 * nn_bench_rand(1, 2));
+    pWino = (q31_t *) nn_bench_alloc((dim_tile + 2) * (dim_tile + 2) * c.ch_in * c.ch_out * sizeof(q31_t));
+    pBuf = (q15_t *) nn_bench_alloc(2 * (dim_tile + 2) * (dim_tile + 2) * c.ch_in * sizeof(q15_t));
+    snprintf(pResult->shape + strlen(pResult->shape), NN_BENCH_SHAPE_LEN - strlen(pResult->shape), " F%u", dim_tile);
+
+    arm_nn_winograd_weights_q15((const q15_t *) c.pWt, c.ch_in, c.ch_out, dim_tile, pWino);
+    arm_convolve_HWC_q15_ref(CONV_Q15(c), (q15_t *) c.pRef, c.dim_out_x, c.bufferA, NULL);
+    status = arm_convolve_HWC_q15_winograd((const q15_t *) c.pIn, c.dim_in_x, c.ch_in, pWino, c.ch_out, dim_tile,
+                                           c.pad_x, (const q15_t *) c.pBias, c.bias_shift, c.out_shift,
+                                           (q15_t *) c.pOpt, c.dim_out_x, pBuf);
+    pResult->mismatch = nn_bench_check_q15(status, c.pRef, c.pOpt, c.out_size);
+    NN_BENCH_TIME(pResult->refUs, ,
+                  arm_convolve_HWC_q15_ref(CONV_Q15(c), (q15_t *) c.pRef, c.dim_out_x, c.bufferA, NULL));
+    NN_BENCH_TIME(pResult->optUs, ,
+                  arm_convolve_HWC_q15_winograd((const q15_t *) c.pIn, c.dim_in_x, c.ch_in, pWino, c.ch_out,
+                                                dim_tile, c.pad_x, (const q15_t *) c.pBias, c.bias_shift,
+                                                c.out_shift, (q15_t *) c.pOpt, c.dim_out_x, pBuf));
+    free(pWino);
+    free(pBuf);
+    nn_bench_conv_free(&c);
+}
+
+/*
+ * The GEMM convolution takes weights interleaved ahead of time, outside of
+ * the timing, and one im2col buffer of each type for 4 output pixels.
+ */
+static void nn_bench_arm_convolve_HWC_q7_gemm(nn_bench_result * pResult)
+{
+    nn_bench_conv c;
+    arm_status status;
+    uint32_t  n;
+    q7_t     *pPacked, *pColB;
+    q15_t    *pColA;
+
+    nn_bench_conv_setup(&c, pResult, 0, 2, 1, 1, NN_BENCH_CONV_SQUARE, sizeof(q7_t));
+    n = c.ch_in * c.ker_x * c.ker_y;
+    pPacked = (q7_t *) nn_bench_alloc(n * c.ch_out);
+    pColA = (q15_t *) nn_bench_alloc(4 * n * sizeof(q15_t));
+    pColB = (q7_t *) nn_bench_alloc(4 * n);
+
+    arm_nn_gemm_pack_q7((const q7_t *) c.pWt, c.ch_out, (uint16_t) n, pPacked);
+    arm_convolve_HWC_q7_ref(CONV_Q7(c), (q7_t *) c.pRef, c.dim_out_x, c.bufferA, NULL);
+    status = arm_convolve_HWC_q7_gemm((const q7_t *) c.pIn, c.dim_in_x, c.ch_in, pPacked, c.ch_out, c.ker_x, c.pad_x,
+                                      c.stride_x, (const q7_t *) c.pBias, c.bias_shift, c.out_shift,
+                                      (q7_t *) c.pOpt, c.dim_out_x, pColA, pColB);
+    pResult->mismatch = nn_bench_check_q7(status, c.pRef, c.pOpt, c.out_size);
+    NN_BENCH_TIME(pResult->refUs, , arm_convolve_HWC_q7_ref(CONV_Q7(c), (q7_t *) c.pRef, c.dim_out_x, c.bufferA, NULL));
+    NN_BENCH_TIME(pResult->optUs, ,
+                  arm_convolve_HWC_q7_gemm((const q7_t *) c.pIn, c.dim_in_x, c.ch_in, pPacked, c.ch_out, c.ker_x,
+                                           c.pad_x, c.stride_x, (const q7_t *) c.pBias, c.bias_shift, c.out_shift,
+                                           (q7_t *) c.pOpt, c.dim_out_x, pColA, pColB));
+    free(pPacked);
+    free(pColA);
+    free(pColB);
+    nn_bench_conv_free(&c);
+}
+
+static void nn_bench_arm_convolve_HWC_s8(nn_bench_result * pResult)
+{
+    nn_bench_conv c;
+    arm_status status;
+
+    nn_bench_conv_setup(&c, pResult, 0, 2, 1, 1, NN_BENCH_CONV_SQUARE, sizeof(q7_t));
+    nn_bench_conv_setup_s8(&c, c.ker_x * c.ker_y * c.ch_in);
+    arm_convolve_HWC_s8_ref(CONV_S8(c), (q7_t *) c.pRef, c.dim_out_x, NULL);
+    status = arm_convolve_HWC_s8(CONV_S8(c), (q7_t *) c.pOpt, c.dim_out_x, c.bufferA);
+    pResult->mismatch = nn_bench_check_q7(status, c.pRef, c.pOpt, c.out_size);
+    NN_BENCH_TIME(pResult->refUs, , arm_convolve_HWC_s8_ref(CONV_S8(c), (q7_t *) c.pRef, c.dim_out_x, NULL));
+    NN_BENCH_TIME(pResult->optUs, , arm_convolve_HWC_s8(CONV_S8(c), (q7_t *) c.pOpt, c.dim_out_x, c.bufferA));
+    nn_bench_conv_free(&c);
+}
+
+static void nn_bench_arm_depthwise_conv_HWC_s8(nn_bench_result * pResult)
+{
+    nn_bench_conv c;
+    arm_status status;
+
+    nn_bench_conv_setup(&c, pResult, 0, 2, 1, 0, NN_BENCH_CONV_SQUARE, sizeof(q7_t));
+    nn_bench_conv_setup_s8(&c, c.ker_x * c.ker_y);
+    arm_depthwise_conv_HWC_s8_ref(CONV_S8(c), (q7_t *) c.pRef, c.dim_out_x, NULL);
+    status = arm_depthwise_conv_HWC_s8(CONV_S8(c), (q7_t *) c.pOpt, c.dim_out_x, c.bufferA);
+    pResult->mismatch = nn_bench_check_q7(status, c.pRef, c.pOpt, c.out_size);
+    NN_BENCH_TIME(pResult->refUs, , arm_depthwise_conv_HWC_s8_ref(CONV_S8(c), (q7_t *) c.pRef, c.dim_out_x, NULL));
+    NN_BENCH_TIME(pResult->optUs, , arm_depthwise_conv_HWC_s8(CONV_S8(c), (q7_t *) c.pOpt, c.dim_out_x, c.bufferA));
+    nn_bench_conv_free(&c);
+}
+
+/*
+ * Fully-connected layers
+ */
+
+/* The _opt functions take weights in interleaved order, and their
+ * references read the same order, so random weights serve both. */
+#define FC(f, type_v, pM, type_b)   (const type_v *) (f).pV, (f).pM, (f).dim_vec, (f).rows, (f).bias_shift,      \
+                                    (f).out_shift, (const type_b *) (f).pBias
+
+#define NN_BENCH_DEFINE_FC(func, ref, type_v, type_m, pM, type_out)                                      \
+    static void nn_bench_##func(nn_bench_result * pResult)                                               \
+    {                                                                                                    \
+        nn_bench_fc f;                                                                                   \
+        arm_status status;                                                                               \
+                                                                                                         \
+        nn_bench_fc_setup(&f, pResult, sizeof(type_v##_t), sizeof(type_m##_t), sizeof(type_out##_t));   \
+        ref(FC(f, type_v##_t, pM, type_m##_t), (type_out##_t *) f.pRef, f.vec_buffer);                 \
+        status = func(FC(f, type_v##_t, pM, type_m##_t), (type_out##_t *) f.pOpt, f.vec_buffer);       \
+        pResult->mismatch = nn_bench_check_##type_out(status, f.pRef, f.pOpt, f.rows);                  \
+        NN_BENCH_TIME(pResult->refUs, ,                                                                  \
+                      ref(FC(f, type_v##_t, pM, type_m##_t), (type_out##_t *) f.pRef, f.vec_buffer));  \
+        NN_BENCH_TIME(pResult->optUs, ,                                                                  \
+                      func(FC(f, type_v##_t, pM, type_m##_t), (type_out##_t *) f.pOpt, f.vec_buffer)); \
+        nn_bench_fc_free(&f);                                                                            \
+    }
+
+NN_BENCH_DEFINE_FC(arm_fully_connected_q7, arm_fully_connected_q7_ref, q7, q7, pM, q7)
+NN_BENCH_DEFINE_FC(arm_fully_connected_q7_opt, arm_fully_connected_q7_opt_ref, q7, q7, pM, q7)
+NN_BENCH_DEFINE_FC(arm_fully_connected_q15, arm_fully_connected_q15_ref, q15, q15, pM15, q15)
+NN_BENCH_DEFINE_FC(arm_fully_connected_q15_opt, arm_fully_connected_q15_opt_ref, q15, q15, pM15, q15)
+NN_BENCH_DEFINE_FC(arm_fully_connected_mat_q7_vec_q15, arm_fully_connected_mat_q7_vec_q15_ref, q15, q7, pM, q15)
+NN_BENCH_DEFINE_FC(arm_fully_connected_mat_q7_vec_q15_opt, arm_fully_connected_mat_q7_vec_q15_opt_ref, q15, q7, pM,
+                   q15)
+
+/*
+ * The batched layer runs on 1 to 16 vectors, and its reference on each
+ * vector in turn.
+ */
+static void nn_bench_arm_fully_connected_q7_batch(nn_bench_result * pResult)
+{
+    nn_bench_fc f;
+    arm_status status;
+    uint16_t  batch, b;
+    q7_t     *pV, *pRef, *pOpt;
+    q15_t    *pBuf;
+
+    nn_bench_fc_setup(&f, pResult, sizeof(q7_t), sizeof(q7_t), sizeof(q7_t));
+    batch = (uint16_t) nn_bench_rand(1, 16);
+    pV = (q7_t *) nn_bench_alloc(batch * f.dim_vec);
+    pRef = (q7_t *) nn_bench_alloc(batch * f.rows);
+    pOpt = (q7_t *) nn_bench_alloc(batch * f.rows);
+    pBuf = (q15_t *) nn_bench_alloc(batch * f.dim_vec * sizeof(q15_t));
+    nn_bench_fill_q7(pV, batch * f.dim_vec, -128, 127);
+    snprintf(pResult->shape + strlen(pResult->shape), NN_BENCH_SHAPE_LEN - strlen(pResult->shape), " b%u", batch);
+    pResult->ops *= batch;
+
+#define FC_BATCH_REF                                                                                    \
+    for (b = 0; b < batch; b++)                                                                         \
+        arm_fully_connected_q7_opt_ref(pV + b * f.dim_vec, f.pM, f.dim_vec, f.rows, f.bias_shift,      \
+                                       f.out_shift, (const q7_t *) f.pBias, pRef + b * f.rows, pBuf)
+#define FC_BATCH_OPT                                                                                    \
+    arm_fully_connected_q7_batch(pV, f.pM, f.dim_vec, f.rows, batch, f.bias_shift, f.out_shift,         \
+                                 (const q7_t *) f.pBias, pOpt, pBuf)
+
+    FC_BATCH_REF;
+    status = FC_BATCH_OPT;
+    pResult->mismatch = nn_bench_check_q7(status, pRef, pOpt, batch * f.rows);
+    NN_BENCH_TIME(pResult->refUs, , FC_BATCH_REF);
+    NN_BENCH_TIME(pResult->optUs, , FC_BATCH_OPT);
+
+#undef FC_BATCH_REF
+#undef FC_BATCH_OPT
+
+    free(pV);
+    free(pRef);
+    free(pOpt);
+    free(pBuf);
+    nn_bench_fc_free(&f);
+}
+
+static void nn_bench_arm_fully_connected_s8(nn_bench_result * pResult)
+{
+    nn_bench_fc f;
+    arm_status status;
+
+    nn_bench_fc_setup(&f, pResult, sizeof(q7_t), sizeof(q7_t), sizeof(q7_t));
+    f.pBias32 = (q31_t *) nn_bench_alloc(f.rows * sizeof(q31_t));
+    f.pMult = (q31_t *) nn_bench_alloc(f.rows * sizeof(q31_t));
+    f.pShift = (int32_t *) nn_bench_alloc(f.rows * sizeof(int32_t));
+    nn_bench_fill_requant(f.pBias32, f.pMult, f.pShift, f.rows, f.dim_vec);
+    f.in_offset = nn_bench_rand(-16, 16);
+    f.out_offset = nn_bench_rand(-16, 16);
+    f.act_min = nn_bench_rand(-128, -64);
+    f.act_max = nn_bench_rand(64, 127);
+
+#define FC_S8(f)    (const q7_t *) (f).pV, (f).pM, (f).dim_vec, (f).rows, (f).pBias32, (f).pMult, (f).pShift, \
+                    (f).in_offset, (f).out_offset, (f).act_min, (f).act_max
+
+    arm_fully_connected_s8_ref(FC_S8(f), (q7_t *) f.pRef, f.vec_buffer);
+    status = arm_fully_connected_s8(FC_S8(f), (q7_t *) f.pOpt, f.vec_buffer);
+    pResult->mismatch = nn_bench_check_q7(status, f.pRef, f.pOpt, f.rows);
+    NN_BENCH_TIME(pResult->refUs, , arm_fully_connected_s8_ref(FC_S8(f), (q7_t *) f.pRef, f.vec_buffer));
+    NN_BENCH_TIME(pResult->optUs, , arm_fully_connected_s8(FC_S8(f), (q7_t *) f.pOpt, f.vec_buffer));
+
+#undef FC_S8
+
+    nn_bench_fc_free(&f);
+}
+
+/*
+ * Pooling
+ */
+
+/*
+ * The q7 pooling functions work in place, so the input is restored before
+ * each call. Their DSP code pools each row in place first, which is only
+ * right without padding, as in cifar10.
+ */
+static void nn_bench_arm_maxpool_q7_HWC(nn_bench_result * pResult)
+{
+    nn_bench_pool p;
+
+    nn_bench_pool_setup(&p, pResult, 0);
+    arm_maxpool_q7_HWC_ref(p.pIn, p.dim_in, p.ch, p.ker, p.pad, p.stride, p.dim_out, NULL, p.pRef);
+    arm_maxpool_q7_HWC(p.pIn, p.dim_in, p.ch, p.ker, p.pad, p.stride, p.dim_out, (q7_t *) p.bufferA, p.pOpt);
+    pResult->mismatch = nn_bench_mismatch_q7(p.pRef, p.pOpt, p.out_size);
+    nn_bench_copy(p.pIn, p.pSaved, p.in_size);
+    NN_BENCH_TIME(pResult->refUs, ,
+                  arm_maxpool_q7_HWC_ref(p.pIn, p.dim_in, p.ch, p.ker, p.pad, p.stride, p.dim_out, NULL, p.pRef));
+    NN_BENCH_TIME(pResult->optUs, nn_bench_copy(p.pIn, p.pSaved, p.in_size),
+                  arm_maxpool_q7_HWC(p.pIn, p.dim_in, p.ch, p.ker, p.pad, p.stride, p.dim_out, (q7_t *) p.bufferA,
+                                     p.pOpt));
+    nn_bench_pool_free(&p);
+}
+
+/* The library function averages the rows, then the columns, so as in
+ * nn_test its outputs may be one off the exact average. */
+static void nn_bench_arm_avepool_q7_HWC(nn_bench_result * pResult)
+{
+    nn_bench_pool p;
+    uint32_t  i;
+
+    nn_bench_pool_setup(&p, pResult, 0);
+    arm_avepool_q7_HWC_ref(p.pIn, p.dim_in, p.ch, p.ker, p.pad, p.stride, p.dim_out, NULL, p.pRef);
+    arm_avepool_q7_HWC(p.pIn, p.dim_in, p.ch, p.ker, p.pad, p.stride, p.dim_out, (q7_t *) p.bufferA, p.pOpt);
+    for (i = 0; i < p.out_size; i++)
+    {
+        pResult->mismatch += abs(p.pRef[i] - p.pOpt[i]) > 1;
+    }
+    nn_bench_copy(p.pIn, p.pSaved, p.in_size);
+    NN_BENCH_TIME(pResult->refUs, ,
+                  arm_avepool_q7_HWC_ref(p.pIn, p.dim_in, p.ch, p.ker, p.pad, p.stride, p.dim_out, NULL, p.pRef));
+    NN_BENCH_TIME(pResult->optUs, nn_bench_copy(p.pIn, p.pSaved, p.in_size),
+                  arm_avepool_q7_HWC(p.pIn, p.dim_in, p.ch, p.ker, p.pad, p.stride, p.dim_out, (q7_t *) p.bufferA,
+                                     p.pOpt));
+    nn_bench_pool_free(&p);
+}
+
+static void nn_bench_arm_maxpool_s8_HWC(nn_bench_result * pResult)
+{
+    nn_bench_pool p;
+    int32_t   act_min, act_max;
+
+    nn_bench_pool_setup(&p, pResult, 1);
+    act_min = nn_bench_rand(-128, -64);
+    act_max = nn_bench_rand(64, 127);
+
+#define POOL_S8(p)  (p).pIn, (p).dim_in, (p).ch, (p).ker, (p).pad, (p).stride, (p).dim_out, act_min, act_max
+
+    arm_maxpool_s8_HWC_ref(POOL_S8(p), p.pRef);
+    arm_maxpool_s8_HWC(POOL_S8(p), p.pOpt);
+    pResult->mismatch = nn_bench_mismatch_q7(p.pRef, p.pOpt, p.out_size);
+    NN_BENCH_TIME(pResult->refUs, , arm_maxpool_s8_HWC_ref(POOL_S8(p), p.pRef));
+    NN_BENCH_TIME(pResult->optUs, , arm_maxpool_s8_HWC(POOL_S8(p), p.pOpt));
+    nn_bench_pool_free(&p);
+}
+
+static void nn_bench_arm_avepool_s8_HWC(nn_bench_result * pResult)
+{
+    nn_bench_pool p;
+    int32_t   act_min, act_max;
+
+    nn_bench_pool_setup(&p, pResult, 1);
+    act_min = nn_bench_rand(-128, -64);
+    act_max = nn_bench_rand(64, 127);
+    arm_avepool_s8_HWC_ref(POOL_S8(p), NULL, p.pRef);
+    arm_avepool_s8_HWC(POOL_S8(p), p.bufferA, p.pOpt);
+    pResult->mismatch = nn_bench_mismatch_q7(p.pRef, p.pOpt, p.out_size);
+    NN_BENCH_TIME(pResult->refUs, , arm_avepool_s8_HWC_ref(POOL_S8(p), NULL, p.pRef));
+    NN_BENCH_TIME(pResult->optUs, , arm_avepool_s8_HWC(POOL_S8(p), p.bufferA, p.pOpt));
+
+#undef POOL_S8
+
+    nn_bench_pool_free(&p);
+}
+
+/*
+ * Activations and element-wise functions
+ */
+
+/*
+ * Defines the benchmark of an in-place function against its reference.
+ * The vector is restored before each call.
+ */
+#define NN_BENCH_DEFINE_INPLACE(name, type, ref_call, opt_call)                                         \
+    static void nn_bench_##name(nn_bench_result * pResult)                                              \
+    {                                                                                                   \
+        nn_bench_pool p;                                                                                \
+        type##_t *pData;                                                                                \
+        uint32_t  size;                                                                                 \
+                                                                                                        \
+        nn_bench_vec_setup(&p, pResult, sizeof(type##_t));                                              \
+        pData = (type##_t *) p.pIn;                                                                     \
+        size = p.in_size;                                                                               \
+        ref_call;                                                                                       \
+        nn_bench_copy(p.pRef, pData, size * sizeof(type##_t));                                          \
+        nn_bench_copy(pData, p.pSaved, size * sizeof(type##_t));                                        \
+        opt_call;                                                                                       \
+        pResult->mismatch = nn_bench_mismatch_##type((type##_t *) p.pRef, pData, size);                 \
+        NN_BENCH_TIME(pResult->refUs, nn_bench_copy(pData, p.pSaved, size * sizeof(type##_t)), ref_call); \
+        NN_BENCH_TIME(pResult->optUs, nn_bench_copy(pData, p.pSaved, size * sizeof(type##_t)), opt_call); \
+        nn_bench_pool_free(&p);                                                                         \
+    }
+
+/* The parameters are derived from the random size, so they are the same for both calls */
+#define NN_BENCH_INT_WIDTH_Q7  (uint16_t) (3 + size % 3)
+#define NN_BENCH_INT_WIDTH_Q15 (uint16_t) (2 + size % 7)
+#define NN_BENCH_INT_WIDTH_ACT (uint16_t) (size % 3)
+#define NN_BENCH_ALPHA         (q15_t) (((size * 2654435761u) >> 16) & 0x7FFF)
+
+NN_BENCH_DEFINE_INPLACE(arm_relu_q7, q7, arm_relu_q7_ref(pData, size), arm_relu_q7(pData, size))
+NN_BENCH_DEFINE_INPLACE(arm_relu_q15, q15, arm_relu_q15_ref(pData, size), arm_relu_q15(pData, size))
+NN_BENCH_DEFINE_INPLACE(arm_relu6_q7, q7, arm_relu6_q7_ref(pData, size, NN_BENCH_INT_WIDTH_Q7),
+                        arm_relu6_q7(pData, size, NN_BENCH_INT_WIDTH_Q7))
+NN_BENCH_DEFINE_INPLACE(arm_relu6_q15, q15, arm_relu6_q15_ref(pData, size, NN_BENCH_INT_WIDTH_Q15),
+                        arm_relu6_q15(pData, size, NN_BENCH_INT_WIDTH_Q15))
+NN_BENCH_DEFINE_INPLACE(arm_leaky_relu_q7, q7, arm_leaky_relu_q7_ref(pData, size, NN_BENCH_ALPHA),
+                        arm_leaky_relu_q7(pData, size, NN_BENCH_ALPHA))
+NN_BENCH_DEFINE_INPLACE(arm_leaky_relu_q15, q15, arm_leaky_relu_q15_ref(pData, size, NN_BENCH_ALPHA),
+                        arm_leaky_relu_q15(pData, size, NN_BENCH_ALPHA))
+
+/* The second half of the vector is the second operand */
+NN_BENCH_DEFINE_INPLACE(arm_nn_mult_q7, q7,
+                        arm_nn_mult_q7_ref(pData, pData + size, pData, (uint16_t) (5 + size % 5), size),
+                        arm_nn_mult_q7(pData, pData + size, pData, (uint16_t) (5 + size % 5), size))
+NN_BENCH_DEFINE_INPLACE(arm_nn_mult_q15, q15,
+                        arm_nn_mult_q15_ref(pData, pData + size, pData, (uint16_t) (13 + size % 6), size),
+                        arm_nn_mult_q15(pData, pData + size, pData, (uint16_t) (13 + size % 6), size))
+
+/*
+ * The sigmoid, tanh and softmax functions are checked against floating
+ * point in nn_test and have no bit-exact reference. They are only timed.
+ */
+#define NN_BENCH_DEFINE_TIMED(name, type, call)                                                         \
+    static void nn_bench_##name(nn_bench_result * pResult)                                              \
+    {                                                                                                   \
+        nn_bench_pool p;                                                                                \
+        type##_t *pData;                                                                                \
+        uint32_t  size;                                                                                 \
+                                                                                                        \
+        nn_bench_vec_setup(&p, pResult, sizeof(type##_t));                                              \
+        pData = (type##_t *) p.pIn;                                                                     \
+        size = p.in_size;                                                                               \
+        pResult->mismatch = -1;                                                                         \
+        NN_BENCH_TIME(pResult->optUs, nn_bench_copy(pData, p.pSaved, size * sizeof(type##_t)), call);   \
+        nn_bench_pool_free(&p);                                                                         \
+    }
+
+NN_BENCH_DEFINE_TIMED(arm_nn_activations_direct_q7, q7,
+                      arm_nn_activations_direct_q7(pData, size, NN_BENCH_INT_WIDTH_ACT, ARM_SIGMOID))
+NN_BENCH_DEFINE_TIMED(arm_nn_activations_direct_q15, q15,
+                      arm_nn_activations_direct_q15(pData, size, NN_BENCH_INT_WIDTH_ACT, ARM_TANH))
+NN_BENCH_DEFINE_TIMED(arm_nn_activations_interp_q7, q7,
+                      arm_nn_activations_interp_q7(pData, size, NN_BENCH_INT_WIDTH_ACT, ARM_SIGMOID))
+NN_BENCH_DEFINE_TIMED(arm_nn_activations_interp_q15, q15,
+                      arm_nn_activations_interp_q15(pData, size, NN_BENCH_INT_WIDTH_ACT, ARM_TANH))
+NN_BENCH_DEFINE_TIMED(arm_softmax_q7, q7, arm_softmax_q7(pData, (uint16_t) size, pData + size))
+NN_BENCH_DEFINE_TIMED(arm_softmax_q15, q15, arm_softmax_q15(pData, (uint16_t) size, pData + size))
+NN_BENCH_DEFINE_TIMED(arm_softmax_lse_q7, q7, arm_softmax_lse_q7(pData, size, 3, pData + size))
+NN_BENCH_DEFINE_TIMED(arm_softmax_lse_q15, q15, arm_softmax_lse_q15(pData, size, 3, pData + size))
+
+/*
+ * Table of the kernels
+ */
+
+#define NN_BENCH_KERNEL(func) { #func, nn_bench_##func }
+
+const nn_bench_kernel nn_bench_kernels[] = {
+    NN_BENCH_KERNEL(arm_convolve_HWC_q7_basic),
+    NN_BENCH_KERNEL(arm_convolve_HWC_q7_fast),
+    NN_BENCH_KERNEL(arm_convolve_HWC_q7_RGB),
+    NN_BENCH_KERNEL(arm_convolve_HWC_q7_basic_nonsquare),
+    NN_BENCH_KERNEL(arm_convolve_HWC_q7_fast_nonsquare),
+    NN_BENCH_KERNEL(arm_convolve_1x1_HWC_q7_fast_nonsquare),
+    NN_BENCH_KERNEL(arm_convolve_HWC_q7_fast_relu_maxpool),
+    NN_BENCH_KERNEL(arm_convolve_HWC_q7_RGB_relu_maxpool),
+    NN_BENCH_KERNEL(arm_convolve_HWC_q7_winograd),
+    NN_BENCH_KERNEL(arm_convolve_HWC_q7_gemm),
+    NN_BENCH_KERNEL(arm_convolve_HWC_q15_basic),
+    NN_BENCH_KERNEL(arm_convolve_HWC_q15_fast),
+    NN_BENCH_KERNEL(arm_convolve_HWC_q15_fast_nonsquare),
+    NN_BENCH_KERNEL(arm_convolve_HWC_q15_winograd),
+    NN_BENCH_KERNEL(arm_depthwise_separable_conv_HWC_q7),
+    NN_BENCH_KERNEL(arm_depthwise_separable_conv_HWC_q7_nonsquare),
+    NN_BENCH_KERNEL(arm_depthwise_conv_HWC_q7),
+    NN_BENCH_KERNEL(arm_depthwise_conv_3x3_HWC_q7),
+    NN_BENCH_KERNEL(arm_convolve_HWC_s8),
+    NN_BENCH_KERNEL(arm_depthwise_conv_HWC_s8),
+    NN_BENCH_KERNEL(arm_fully_connected_q7),
+    NN_BENCH_KERNEL(arm_fully_connected_q7_opt),
+    NN_BENCH_KERNEL(arm_fully_connected_q7_batch),
+    NN_BENCH_KERNEL(arm_fully_connected_q15),
+    NN_BENCH_KERNEL(arm_fully_connected_q15_opt),
+    NN_BENCH_KERNEL(arm_fully_connected_mat_q7_vec_q15),
+    NN_BENCH_KERNEL(arm_fully_connected_mat_q7_vec_q15_opt),
+    NN_BENCH_KERNEL(arm_fully_connected_s8),
+    NN_BENCH_KERNEL(arm_maxpool_q7_HWC),
+    NN_BENCH_KERNEL(arm_avepool_q7_HWC),
+    NN_BENCH_KERNEL(arm_maxpool_s8_HWC),
+    NN_BENCH_KERNEL(arm_avepool_s8_HWC),
+    NN_BENCH_KERNEL(arm_relu_q7),
+    NN_BENCH_KERNEL(arm_relu_q15),
+    NN_BENCH_KERNEL(arm_relu6_q7),
+    NN_BENCH_KERNEL(arm_relu6_q15),
+    NN_BENCH_KERNEL(arm_leaky_relu_q7),
+    NN_BENCH_KERNEL(arm_leaky_relu_q15),
+    NN_BENCH_KERNEL(arm_nn_mult_q7),
+    NN_BENCH_KERNEL(arm_nn_mult_q15),
+    NN_BENCH_KERNEL(arm_nn_activations_direct_q7),
+    NN_BENCH_KERNEL(arm_nn_activations_direct_q15),
+    NN_BENCH_KERNEL(arm_nn_activations_interp_q7),
+    NN_BENCH_KERNEL(arm_nn_activations_interp_q15),
+    NN_BENCH_KERNEL(arm_softmax_q7),
+    NN_BENCH_KERNEL(arm_softmax_q15),
+    NN_BENCH_KERNEL(arm_softmax_lse_q7),
+    NN_BENCH_KERNEL(arm_softmax_lse_q15),
+};
+
+const uint32_t nn_bench_num_kernels = sizeof(nn_bench_kernels) / sizeof(nn_bench_kernels[0]);
@@ -0,0 +1,435 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_bench_networks.c
+ * Description:  Layer by layer benchmark of the cifar10 and gru examples
+ *
+ * $Date:        13. July 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  host
+ *
+ * -------------------------------------------------------------------- */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "arm_nn_bench.h"
+#include "ref_functions.h"
+#include "arm_nnexamples_cifar10_parameter.h"
+#include "arm_nnexamples_cifar10_weights.h"
+#include "arm_nnexamples_cifar10_inputs.h"
+#include "arm_nnexamples_gru_test_data.h"
+
+/*
+ * Each layer runs on the output of the library function of the layer
+ * before. Its reference runs on the same input, so a mismatch points at
+ * the first layer that differs. The input is restored before every call,
+ * which the layers that work in place need, and the time of the copy is
+ * not counted.
+ */
+
+/**
+ * Adds a layer to the total of the network and reports it.
+ */
+static void nn_bench_layer_report(void (*report) (nn_bench_result * pResult), nn_bench_result * pLayer,
+                                  nn_bench_result * pTotal)
+{
+    pTotal->ops += pLayer->ops;
+    pTotal->optUs += pLayer->optUs;
+    pTotal->refUs += pLayer->refUs;
+    pTotal->mismatch += pLayer->mismatch > 0 ? pLayer->mismatch : 0;
+    report(pLayer);
+}
+
+/*
+ * cifar10
+ */
+
+static const q7_t cifar10_conv1_wt[CONV1_IM_CH * CONV1_KER_DIM * CONV1_KER_DIM * CONV1_OUT_CH] = CONV1_WT;
+static const q7_t cifar10_conv1_bias[CONV1_OUT_CH] = CONV1_BIAS;
+static const q7_t cifar10_conv2_wt[CONV2_IM_CH * CONV2_KER_DIM * CONV2_KER_DIM * CONV2_OUT_CH] = CONV2_WT;
+static const q7_t cifar10_conv2_bias[CONV2_OUT_CH] = CONV2_BIAS;
+static const q7_t cifar10_conv3_wt[CONV3_IM_CH * CONV3_KER_DIM * CONV3_KER_DIM * CONV3_OUT_CH] = CONV3_WT;
+static const q7_t cifar10_conv3_bias[CONV3_OUT_CH] = CONV3_BIAS;
+static const q7_t cifar10_ip1_wt[IP1_DIM * IP1_OUT] = IP1_WT;
+static const q7_t cifar10_ip1_bias[IP1_OUT] = IP1_BIAS;
+static const uint8_t cifar10_image[CONV1_IM_CH * CONV1_IM_DIM * CONV1_IM_DIM] = IMG_DATA;
+
+/* Largest activation of the network */
+#define CIFAR10_MAX_SIZE (CONV1_OUT_DIM * CONV1_OUT_DIM * CONV1_OUT_CH)
+
+/*
+ * Runs a layer of cifar10 that reads in_size bytes of pIn and writes
+ * out_size bytes of pOptOut, and its reference, which writes pRef. An
+ * in-place layer works on pIn, and its reference on a copy of it in pRef.
+ */
+#define NN_BENCH_CIFAR10_LAYER(layer, layer_shape, n_ops, in_size, out_size, pOptOut, ref_call, opt_call) \
+    do                                                                                     \
+    {                                                                                      \
+        nn_bench_result layer_;                                                            \
+        q7_t     *pNext_ = (pOptOut);                                                      \
+                                                                                           \
+        memset(&layer_, 0, sizeof(layer_));                                                \
+        layer_.section = "cifar10";                                                        \
+        layer_.name = layer;                                                               \
+        strcpy(layer_.shape, layer_shape);                                                 \
+        layer_.ops = n_ops;                                                                \
+        nn_bench_copy(pSaved, pIn, in_size);                                               \
+        NN_BENCH_CIFAR10_RESTORE_REF(in_size);                                             \
+        ref_call;                                                                          \
+        nn_bench_copy(pIn, pSaved, in_size);                                               \
+        opt_call;                                                                          \
+        layer_.mismatch = nn_bench_mismatch_q7(pRef, pNext_, out_size);                    \
+        NN_BENCH_TIME(layer_.refUs, NN_BENCH_CIFAR10_RESTORE_REF(in_size), ref_call);      \
+        NN_BENCH_TIME(layer_.optUs, nn_bench_copy(pIn, pSaved, in_size), opt_call);        \
+        nn_bench_copy(pIn, pSaved, in_size);                                               \
+        opt_call;                                                                          \
+        nn_bench_layer_report(report, &layer_, &total);                                    \
+        if (pNext_ != pIn)                                                                 \
+        {                                                                                  \
+            pOut = pIn;                                                                    \
+            pIn = pNext_;                                                                  \
+        }                                                                                  \
+    } while (0)
+
+#define NN_BENCH_CIFAR10_RESTORE_REF(in_size)                                              \
+    nn_bench_copy(pIn, pSaved, in_size);                                                   \
+    nn_bench_copy(pRef, pSaved, in_size)
+
+static void nn_bench_cifar10(void (*report) (nn_bench_result * pResult))
+{
+    const int mean[3] = INPUT_MEAN_SHIFT;
+    const int scale[3] = INPUT_RIGHT_SHIFT;
+    q7_t     *pIn = (q7_t *) nn_bench_alloc(CIFAR10_MAX_SIZE);
+    q7_t     *pOut = (q7_t *) nn_bench_alloc(CIFAR10_MAX_SIZE);
+    q7_t     *pRef = (q7_t *) nn_bench_alloc(CIFAR10_MAX_SIZE);
+    q7_t     *pSaved = (q7_t *) nn_bench_alloc(CIFAR10_MAX_SIZE);
+    q15_t    *pCol = (q15_t *) nn_bench_alloc(2 * 2 * CONV2_KER_DIM * CONV2_KER_DIM * CONV2_IM_CH);
+    q7_t     *pOutput;
+    nn_bench_result total;
+    int       i;
+
+    memset(&total, 0, sizeof(total));
+    total.section = "cifar10";
+    total.name = "total";
+    strcpy(total.shape, "32x32x3 -> 10");
+
+    /* input pre-processing of the example */
+    for (i = 0; i < CONV1_IM_CH * CONV1_IM_DIM * CONV1_IM_DIM; i++)
+    {
+        pIn[i] = (q7_t) __SSAT(((((int) cifar10_image[i] - mean[i % 3]) << 7) + (0x1 << (scale[i % 3] - 1)))
+                               >> scale[i % 3], 8);
+    }
+
+    NN_BENCH_CIFAR10_LAYER("conv1", "32x32x3 k5 p2 s1 o32",
+                           (uint64_t) CONV1_OUT_DIM * CONV1_OUT_DIM * CONV1_OUT_CH * CONV1_KER_DIM * CONV1_KER_DIM * CONV1_IM_CH,
+                           CONV1_IM_DIM * CONV1_IM_DIM * CONV1_IM_CH, CONV1_OUT_DIM * CONV1_OUT_DIM * CONV1_OUT_CH, pOut,
+                           arm_convolve_HWC_q7_ref(pIn, CONV1_IM_DIM, CONV1_IM_CH, cifar10_conv1_wt, CONV1_OUT_CH,
+                                                   CONV1_KER_DIM, CONV1_PADDING, CONV1_STRIDE, cifar10_conv1_bias,
+                                                   CONV1_BIAS_LSHIFT, CONV1_OUT_RSHIFT, pRef, CONV1_OUT_DIM, pCol,
+                                                   NULL),
+                           arm_convolve_HWC_q7_RGB(pIn, CONV1_IM_DIM, CONV1_IM_CH, cifar10_conv1_wt, CONV1_OUT_CH,
+                                                   CONV1_KER_DIM, CONV1_PADDING, CONV1_STRIDE, cifar10_conv1_bias,
+                                                   CONV1_BIAS_LSHIFT, CONV1_OUT_RSHIFT, pOut, CONV1_OUT_DIM, pCol,
+                                                   NULL));
+
+    NN_BENCH_CIFAR10_LAYER("relu1", "32x32x32", CONV1_OUT_DIM * CONV1_OUT_DIM * CONV1_OUT_CH,
+                           CONV1_OUT_DIM * CONV1_OUT_DIM * CONV1_OUT_CH, CONV1_OUT_DIM * CONV1_OUT_DIM * CONV1_OUT_CH,
+                           pIn, arm_relu_q7_ref(pRef, CONV1_OUT_DIM * CONV1_OUT_DIM * CONV1_OUT_CH),
+                           arm_relu_q7(pIn, CONV1_OUT_DIM * CONV1_OUT_DIM * CONV1_OUT_CH));
+
+    NN_BENCH_CIFAR10_LAYER("pool1", "32x32x32 k3 p0 s2",
+                           POOL1_OUT_DIM * POOL1_OUT_DIM * CONV1_OUT_CH * POOL1_KER_DIM * POOL1_KER_DIM,
+                           CONV1_OUT_DIM * CONV1_OUT_DIM * CONV1_OUT_CH, POOL1_OUT_DIM * POOL1_OUT_DIM * CONV1_OUT_CH,
+                           pOut,
+                           arm_maxpool_q7_HWC_ref(pIn, CONV1_OUT_DIM, CONV1_OUT_CH, POOL1_KER_DIM, POOL1_PADDING,
+                                                  POOL1_STRIDE, POOL1_OUT_DIM, NULL, pRef),
+                           arm_maxpool_q7_HWC(pIn, CONV1_OUT_DIM, CONV1_OUT_CH, POOL1_KER_DIM, POOL1_PADDING,
+                                              POOL1_STRIDE, POOL1_OUT_DIM, NULL, pOut));
+
+    NN_BENCH_CIFAR10_LAYER("conv2", "16x16x32 k5 p2 s1 o16",
+                           (uint64_t) CONV2_OUT_DIM * CONV2_OUT_DIM * CONV2_OUT_CH * CONV2_KER_DIM * CONV2_KER_DIM * CONV2_IM_CH,
+                           CONV2_IM_DIM * CONV2_IM_DIM * CONV2_IM_CH, CONV2_OUT_DIM * CONV2_OUT_DIM * CONV2_OUT_CH, pOut,
+                           arm_convolve_HWC_q7_ref(pIn, CONV2_IM_DIM, CONV2_IM_CH, cifar10_conv2_wt, CONV2_OUT_CH,
+                                                   CONV2_KER_DIM, CONV2_PADDING, CONV2_STRIDE, cifar10_conv2_bias,
+                                                   CONV2_BIAS_LSHIFT, CONV2_OUT_RSHIFT, pRef, CONV2_OUT_DIM, pCol,
+                                                   NULL),
+                           arm_convolve_HWC_q7_fast(pIn, CONV2_IM_DIM, CONV2_IM_CH, cifar10_conv2_wt, CONV2_OUT_CH,
+                                                    CONV2_KER_DIM, CONV2_PADDING, CONV2_STRIDE, cifar10_conv2_bias,
+                                                    CONV2_BIAS_LSHIFT, CONV2_OUT_RSHIFT, pOut, CONV2_OUT_DIM, pCol,
+                                                    NULL));
+
+    NN_BENCH_CIFAR10_LAYER("relu2", "16x16x16", CONV2_OUT_DIM * CONV2_OUT_DIM * CONV2_OUT_CH,
+                           CONV2_OUT_DIM * CONV2_OUT_DIM * CONV2_OUT_CH, CONV2_OUT_DIM * CONV2_OUT_DIM * CONV2_OUT_CH,
+                           pIn, arm_relu_q7_ref(pRef, CONV2_OUT_DIM * CONV2_OUT_DIM * CONV2_OUT_CH),
+                           arm_relu_q7(pIn, CONV2_OUT_DIM * CONV2_OUT_DIM * CONV2_OUT_CH));
+
+    NN_BENCH_CIFAR10_LAYER("pool2", "16x16x16 k3 p0 s2",
+                           POOL2_OUT_DIM * POOL2_OUT_DIM * CONV2_OUT_CH * POOL2_KER_DIM * POOL2_KER_DIM,
+                           CONV2_OUT_DIM * CONV2_OUT_DIM * CONV2_OUT_CH, POOL2_OUT_DIM * POOL2_OUT_DIM * CONV2_OUT_CH,
+                           pOut,
+                           arm_maxpool_q7_HWC_ref(pIn, CONV2_OUT_DIM, CONV2_OUT_CH, POOL2_KER_DIM, POOL2_PADDING,
+                                                  POOL2_STRIDE, POOL2_OUT_DIM, NULL, pRef),
+                           arm_maxpool_q7_HWC(pIn, CONV2_OUT_DIM, CONV2_OUT_CH, POOL2_KER_DIM, POOL2_PADDING,
+                                              POOL2_STRIDE, POOL2_OUT_DIM, NULL, pOut));
+
+    NN_BENCH_CIFAR10_LAYER("conv3", "8x8x16 k5 p2 s1 o32",
+                           (uint64_t) CONV3_OUT_DIM * CONV3_OUT_DIM * CONV3_OUT_CH * CONV3_KER_DIM * CONV3_KER_DIM * CONV3_IM_CH,
+                           CONV3_IM_DIM * CONV3_IM_DIM * CONV3_IM_CH, CONV3_OUT_DIM * CONV3_OUT_DIM * CONV3_OUT_CH, pOut,
+                           arm_convolve_HWC_q7_ref(pIn, CONV3_IM_DIM, CONV3_IM_CH, cifar10_conv3_wt, CONV3_OUT_CH,
+                                                   CONV3_KER_DIM, CONV3_PADDING, CONV3_STRIDE, cifar10_conv3_bias,
+                                                   CONV3_BIAS_LSHIFT, CONV3_OUT_RSHIFT, pRef, CONV3_OUT_DIM, pCol,
+                                                   NULL),
+                           arm_convolve_HWC_q7_fast(pIn, CONV3_IM_DIM, CONV3_IM_CH, cifar10_conv3_wt, CONV3_OUT_CH,
+                                                    CONV3_KER_DIM, CONV3_PADDING, CONV3_STRIDE, cifar10_conv3_bias,
+                                                    CONV3_BIAS_LSHIFT, CONV3_OUT_RSHIFT, pOut, CONV3_OUT_DIM, pCol,
+                                                    NULL));
+
+    NN_BENCH_CIFAR10_LAYER("relu3", "8x8x32", CONV3_OUT_DIM * CONV3_OUT_DIM * CONV3_OUT_CH,
+                           CONV3_OUT_DIM * CONV3_OUT_DIM * CONV3_OUT_CH, CONV3_OUT_DIM * CONV3_OUT_DIM * CONV3_OUT_CH,
+                           pIn, arm_relu_q7_ref(pRef, CONV3_OUT_DIM * CONV3_OUT_DIM * CONV3_OUT_CH),
+                           arm_relu_q7(pIn, CONV3_OUT_DIM * CONV3_OUT_DIM * CONV3_OUT_CH));
+
+    NN_BENCH_CIFAR10_LAYER("pool3", "8x8x32 k3 p0 s2",
+                           POOL3_OUT_DIM * POOL3_OUT_DIM * CONV3_OUT_CH * POOL3_KER_DIM * POOL3_KER_DIM,
+                           CONV3_OUT_DIM * CONV3_OUT_DIM * CONV3_OUT_CH, POOL3_OUT_DIM * POOL3_OUT_DIM * CONV3_OUT_CH,
+                           pOut,
+                           arm_maxpool_q7_HWC_ref(pIn, CONV3_OUT_DIM, CONV3_OUT_CH, POOL3_KER_DIM, POOL3_PADDING,
+                                                  POOL3_STRIDE, POOL3_OUT_DIM, NULL, pRef),
+                           arm_maxpool_q7_HWC(pIn, CONV3_OUT_DIM, CONV3_OUT_CH, POOL3_KER_DIM, POOL3_PADDING,
+                                              POOL3_STRIDE, POOL3_OUT_DIM, NULL, pOut));
+
+    /* the weights of the example are interleaved for the _opt function */
+    NN_BENCH_CIFAR10_LAYER("ip1", "10 x 512", IP1_DIM * IP1_OUT, IP1_DIM, IP1_OUT, pOut,
+                           arm_fully_connected_q7_opt_ref(pIn, cifar10_ip1_wt, IP1_DIM, IP1_OUT, IP1_BIAS_LSHIFT,
+                                                          IP1_OUT_RSHIFT, cifar10_ip1_bias, pRef, pCol),
+                           arm_fully_connected_q7_opt(pIn, cifar10_ip1_wt, IP1_DIM, IP1_OUT, IP1_BIAS_LSHIFT,
+                                                      IP1_OUT_RSHIFT, cifar10_ip1_bias, pOut, pCol));
+
+    /* the softmax has no bit-exact reference */
+    {
+        nn_bench_result r;
+
+        memset(&r, 0, sizeof(r));
+        r.section = "cifar10";
+        r.name = "softmax";
+        strcpy(r.shape, "10");
+        r.ops = IP1_OUT;
+        r.mismatch = -1;
+        NN_BENCH_TIME(r.optUs, , arm_softmax_q7(pIn, IP1_OUT, pOut));
+        arm_softmax_q7(pIn, IP1_OUT, pOut);
+        nn_bench_layer_report(report, &r, &total);
+        pOutput = pOut;
+    }
+
+    report(&total);
+
+    printf("%-8s class scores:", "cifar10");
+    for (i = 0; i < IP1_OUT; i++)
+    {
+        printf(" %d", pOutput[i]);
+    }
+    printf("\n");
+
+    free(pIn);
+    free(pOut);
+    free(pRef);
+    free(pSaved);
+    free(pCol);
+}
+
+#undef NN_BENCH_CIFAR10_LAYER
+#undef NN_BENCH_CIFAR10_RESTORE
+
+/*
+ * ip1 of cifar10 on batches of 1 to 16 images, with the batched layer
+ * against the per-image calls of arm_fully_connected_q7_opt it replaces.
+ * There is no total, as each row runs the same layer.
+ */
+
+#define FC_BATCH_MAX 16
+
+static void nn_bench_fc_batch(void (*report) (nn_bench_result * pResult))
+{
+    q7_t     *pIn = (q7_t *) nn_bench_alloc(FC_BATCH_MAX * IP1_DIM);
+    q7_t     *pRef = (q7_t *) nn_bench_alloc(FC_BATCH_MAX * IP1_OUT);
+    q7_t     *pOut = (q7_t *) nn_bench_alloc(FC_BATCH_MAX * IP1_OUT);
+    q15_t    *pBuf = (q15_t *) nn_bench_alloc(FC_BATCH_MAX * IP1_DIM * sizeof(q15_t));
+    nn_bench_result r;
+    uint16_t  batch, b;
+
+    nn_bench_fill_q7(pIn, FC_BATCH_MAX * IP1_DIM, -128, 127);
+
+#define FC_BATCH_REF                                                                                    \
+    for (b = 0; b < batch; b++)                                                                         \
+        arm_fully_connected_q7_opt(pIn + b * IP1_DIM, cifar10_ip1_wt, IP1_DIM, IP1_OUT, IP1_BIAS_LSHIFT,  \
+                                   IP1_OUT_RSHIFT, cifar10_ip1_bias, pRef + b * IP1_OUT, pBuf)
+#define FC_BATCH_OPT                                                                                    \
+    arm_fully_connected_q7_batch(pIn, cifar10_ip1_wt, IP1_DIM, IP1_OUT, batch, IP1_BIAS_LSHIFT,         \
+                                 IP1_OUT_RSHIFT, cifar10_ip1_bias, pOut, pBuf)
+
+    for (batch = 1; batch <= FC_BATCH_MAX; batch++)
+    {
+        memset(&r, 0, sizeof(r));
+        r.section = "fc_batch";
+        r.name = "ip1";
+        snprintf(r.shape, NN_BENCH_SHAPE_LEN, "%u x %u b%u", IP1_OUT, IP1_DIM, batch);
+        r.ops = (uint64_t) IP1_DIM * IP1_OUT * batch;
+        FC_BATCH_REF;
+        FC_BATCH_OPT;
+        r.mismatch = nn_bench_mismatch_q7(pRef, pOut, batch * IP1_OUT);
+        NN_BENCH_TIME(r.refUs, , FC_BATCH_REF);
+        NN_BENCH_TIME(r.optUs, , FC_BATCH_OPT);
+        report(&r);
+    }
+
+#undef FC_BATCH_REF
+#undef FC_BATCH_OPT
+
+    free(pIn);
+    free(pRef);
+    free(pOut);
+    free(pBuf);
+}
+
+/*
+ * gru
+ */
+
+#define GRU_DIM_HISTORY 32
+#define GRU_DIM_INPUT 32
+#define GRU_DIM_VEC (GRU_DIM_INPUT + GRU_DIM_HISTORY)
+
+static const q7_t gru_update_weights[GRU_DIM_VEC * GRU_DIM_HISTORY] = UPDATE_GATE_WEIGHT_X4;
+static const q7_t gru_reset_weights[GRU_DIM_VEC * GRU_DIM_HISTORY] = RESET_GATE_WEIGHT_X4;
+static const q7_t gru_hidden_weights[GRU_DIM_VEC * GRU_DIM_HISTORY] = HIDDEN_STATE_WEIGHT_X4;
+static const q7_t gru_update_bias[GRU_DIM_HISTORY] = UPDATE_GATE_BIAS;
+static const q7_t gru_reset_bias[GRU_DIM_HISTORY] = RESET_GATE_BIAS;
+static const q7_t gru_hidden_bias[GRU_DIM_HISTORY] = HIDDEN_STATE_BIAS;
+static const q15_t gru_input[GRU_DIM_INPUT] = INPUT_DATA1;
+static const q15_t gru_history[GRU_DIM_HISTORY] = HISTORY_DATA;
+
+/*
+ * Runs a step of the gru example, with the whole scratch buffer restored
+ * before each call. Only the fully-connected layers have a reference, the
+ * reference is skipped if pRefOut is NULL.
+ */
+#define NN_BENCH_GRU_LAYER(layer, n_ops, pOptOut, pRefOut, ref_call, opt_call)                 \
+    do                                                                                     \
+    {                                                                                      \
+        nn_bench_result layer_;                                                            \
+                                                                                           \
+        memset(&layer_, 0, sizeof(layer_));                                                \
+        layer_.section = "gru";                                                            \
+        layer_.name = layer;                                                               \
+        if ((n_ops) > GRU_DIM_HISTORY)                                                     \
+            snprintf(layer_.shape, NN_BENCH_SHAPE_LEN, "%u x %u", GRU_DIM_HISTORY, GRU_DIM_VEC); \
+        else                                                                               \
+            snprintf(layer_.shape, NN_BENCH_SHAPE_LEN, "%u", GRU_DIM_HISTORY);             \
+        layer_.ops = n_ops;                                                                \
+        layer_.mismatch = -1;                                                              \
+        nn_bench_copy(saved, scratch, sizeof(scratch));                                    \
+        if ((pRefOut) != NULL)                                                             \
+        {                                                                                  \
+            ref_call;                                                                      \
+            opt_call;                                                                      \
+            layer_.mismatch = nn_bench_mismatch_q15(pRefOut, pOptOut, GRU_DIM_HISTORY);    \
+            NN_BENCH_TIME(layer_.refUs, nn_bench_copy(scratch, saved, sizeof(scratch)), ref_call); \
+        }                                                                                  \
+        NN_BENCH_TIME(layer_.optUs, nn_bench_copy(scratch, saved, sizeof(scratch)), opt_call); \
+        nn_bench_copy(scratch, saved, sizeof(scratch));                                    \
+        opt_call;                                                                          \
+        nn_bench_layer_report(report, &layer_, &total);                                    \
+    } while (0)
+
+static void nn_bench_gru(void (*report) (nn_bench_result * pResult))
+{
+    q15_t     scratch[GRU_DIM_HISTORY * 4 + GRU_DIM_INPUT];
+    q15_t     saved[GRU_DIM_HISTORY * 4 + GRU_DIM_INPUT];
+    q15_t     ref_out[GRU_DIM_HISTORY];
+    q15_t    *pRef = ref_out;
+    q15_t    *reset = scratch;
+    q15_t    *input = scratch + GRU_DIM_HISTORY;
+    q15_t    *history = scratch + GRU_DIM_HISTORY + GRU_DIM_INPUT;
+    q15_t    *update = scratch + 2 * GRU_DIM_HISTORY + GRU_DIM_INPUT;
+    q15_t    *hidden = scratch + 3 * GRU_DIM_HISTORY + GRU_DIM_INPUT;
+    nn_bench_result total;
+
+    memset(&total, 0, sizeof(total));
+    total.section = "gru";
+    total.name = "total";
+    snprintf(total.shape, NN_BENCH_SHAPE_LEN, "%u + %u", GRU_DIM_INPUT, GRU_DIM_HISTORY);
+
+    memset(scratch, 0, sizeof(scratch));
+    nn_bench_copy(input, gru_input, sizeof(gru_input));
+    nn_bench_copy(history, gru_history, sizeof(gru_history));
+
+    NN_BENCH_GRU_LAYER("reset_fc", GRU_DIM_VEC * GRU_DIM_HISTORY, reset, pRef,
+                       arm_fully_connected_mat_q7_vec_q15_opt_ref(input, gru_reset_weights, GRU_DIM_VEC,
+                                                                  GRU_DIM_HISTORY, 0, 15, gru_reset_bias, pRef, NULL),
+                       arm_fully_connected_mat_q7_vec_q15_opt(input, gru_reset_weights, GRU_DIM_VEC,
+                                                              GRU_DIM_HISTORY, 0, 15, gru_reset_bias, reset, NULL));
+    NN_BENCH_GRU_LAYER("reset_sigmoid", GRU_DIM_HISTORY, reset, NULL, ,
+                       arm_nn_activations_direct_q15(reset, GRU_DIM_HISTORY, 0, ARM_SIGMOID));
+    NN_BENCH_GRU_LAYER("reset_mult", GRU_DIM_HISTORY, reset, NULL, ,
+                       arm_mult_q15(history, reset, reset, GRU_DIM_HISTORY));
+
+    NN_BENCH_GRU_LAYER("update_fc", GRU_DIM_VEC * GRU_DIM_HISTORY, update, pRef,
+                       arm_fully_connected_mat_q7_vec_q15_opt_ref(input, gru_update_weights, GRU_DIM_VEC,
+                                                                  GRU_DIM_HISTORY, 0, 15, gru_update_bias, pRef, NULL),
+                       arm_fully_connected_mat_q7_vec_q15_opt(input, gru_update_weights, GRU_DIM_VEC,
+                                                              GRU_DIM_HISTORY, 0, 15, gru_update_bias, update, NULL));
+    NN_BENCH_GRU_LAYER("update_sigmoid", GRU_DIM_HISTORY, update, NULL, ,
+                       arm_nn_activations_direct_q15(update, GRU_DIM_HISTORY, 0, ARM_SIGMOID));
+
+    NN_BENCH_GRU_LAYER("hidden_fc", GRU_DIM_VEC * GRU_DIM_HISTORY, hidden, pRef,
+                       arm_fully_connected_mat_q7_vec_q15_opt_ref(reset, gru_hidden_weights, GRU_DIM_VEC,
+                                                                  GRU_DIM_HISTORY, 0, 15, gru_hidden_bias, pRef, NULL),
+                       arm_fully_connected_mat_q7_vec_q15_opt(reset, gru_hidden_weights, GRU_DIM_VEC,
+                                                              GRU_DIM_HISTORY, 0, 15, gru_hidden_bias, hidden, NULL));
+    NN_BENCH_GRU_LAYER("hidden_tanh", GRU_DIM_HISTORY, hidden, NULL, ,
+                       arm_nn_activations_direct_q15(hidden, GRU_DIM_HISTORY, 0, ARM_TANH));
+    NN_BENCH_GRU_LAYER("hidden_mult", GRU_DIM_HISTORY, hidden, NULL, ,
+                       arm_mult_q15(update, hidden, hidden, GRU_DIM_HISTORY));
+
+    NN_BENCH_GRU_LAYER("update_offset", GRU_DIM_HISTORY, update, NULL, ,
+                       arm_offset_q15(update, (q15_t) 0x8000, update, GRU_DIM_HISTORY));
+    NN_BENCH_GRU_LAYER("history_mult", GRU_DIM_HISTORY, update, NULL, ,
+                       arm_mult_q15(history, update, update, GRU_DIM_HISTORY));
+    NN_BENCH_GRU_LAYER("history_sub", GRU_DIM_HISTORY, history, NULL, ,
+                       arm_sub_q15(hidden, update, history, GRU_DIM_HISTORY));
+
+    report(&total);
+}
+
+#undef NN_BENCH_GRU_LAYER
+
+/*
+ * Table of the networks
+ */
+
+const nn_bench_network nn_bench_networks[] = {
+    {"cifar10", nn_bench_cifar10},
+    {"gru", nn_bench_gru},
+    {"fc_batch", nn_bench_fc_batch},
+};
+
+const uint32_t nn_bench_num_networks = sizeof(nn_bench_networks) / sizeof(nn_bench_networks[0]);
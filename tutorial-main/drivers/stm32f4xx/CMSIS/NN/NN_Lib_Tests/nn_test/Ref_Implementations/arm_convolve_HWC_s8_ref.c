@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ref_functions.h"
+
+q7_t arm_nn_requantize_s8_ref(const q31_t val,  // accumulator
+                              const q31_t multiplier,   // Q31 multiplier
+                              const int32_t shift,  // amount of left-shift if positive, of right-shift if negative
+                              const int32_t output_offset,  // output zero point
+                              const int32_t act_min, const int32_t act_max)
+{
+    int64_t   prod = (int64_t) (q31_t) ((uint32_t) val << (shift > 0 ? shift : 0)) * multiplier;
+    int64_t   high, mag;
+    int32_t   right = shift < 0 ? -shift : 0;
+    int64_t   out;
+
+    // doubling high multiply rounds ties up, the right-shift rounds ties away from zero
+    if (prod == (1LL << 62))
+    {
+        high = 0x7FFFFFFF;
+    } else
+    {
+        high = (prod + (1LL << 30)) >> 31;
+    }
+    mag = high < 0 ? -high : high;
+    if (right > 0)
+    {
+        mag = (mag + (1LL << (right - 1))) >> right;
+    }
+    out = (high < 0 ? -mag : mag) + output_offset;
+
+    if (out < act_min)
+    {
+        out = act_min;
+    }
+    if (out > act_max)
+    {
+        out = act_max;
+    }
+    return (q7_t) out;
+}
+
+void arm_convolve_HWC_s8_ref(const q7_t * Im_in,    // input image
+                             const uint16_t dim_im_in,  // input image dimention
+                             const uint16_t ch_im_in,   // number of input image channels
+                             const q7_t * wt,   // kernel weights
+                             const uint16_t ch_im_out,  // number of filters, i.e., output image channels
+                             const uint16_t dim_kernel, // filter kernel size
+                             const uint16_t padding,    // padding sizes
+                             const uint16_t stride, // stride
+                             const q31_t * bias,    // per-channel bias
+                             const q31_t * out_mult,    // per-channel output multipliers
+                             const int32_t * out_shift, // per-channel output shifts
+                             const int32_t input_offset, const int32_t output_offset,   // zero points
+                             const int32_t act_min, const int32_t act_max,  // output range
+                             q7_t * Im_out, // output image
+                             const uint16_t dim_im_out, // output image dimension
+                             q15_t * bufferA    //buffer space for input
+    )
+{
+    int       i, j, k, l, m, n;
+    q31_t     conv_out;
+    int       in_row, in_col;
+
+    for (i = 0; i < ch_im_out; i++)
+    {
+        for (j = 0; j < dim_im_out; j++)
+        {
+            for (k = 0; k < dim_im_out; k++)
+            {
+                conv_out = bias[i];
+                for (m = 0; m < dim_kernel; m++)
+                {
+                    for (n = 0; n < dim_kernel; n++)
+                    {
+                        in_row = stride * j + m - padding;
+                        in_col = stride * k + n - padding;
+                        if (in_row >= 0 && in_col >= 0 && in_row < dim_im_in && in_col < dim_im_in)
+                        {
+                            for (l = 0; l < ch_im_in; l++)
+                            {
+                                conv_out += (Im_in[(in_row * dim_im_in + in_col) * ch_im_in + l] + input_offset) *
+                                    wt[i * ch_im_in * dim_kernel * dim_kernel + (m * dim_kernel + n) * ch_im_in + l];
+                            }
+                        }
+                    }
+                }
+                Im_out[i + (j * dim_im_out + k) * ch_im_out] =
+                    arm_nn_requantize_s8_ref(conv_out, out_mult[i], out_shift[i], output_offset, act_min, act_max);
+            }
+        }
+    }
+}
+
+void arm_depthwise_conv_HWC_s8_ref(const q7_t * Im_in,  // input image
+                                   const uint16_t dim_im_in,    // input image dimention
+                                   const uint16_t ch_im_in, // number of input image channels
+                                   const q7_t * wt, // kernel weights
+                                   const uint16_t ch_im_out,    // number of filters, i.e., output image channels
+                                   const uint16_t dim_kernel,   // filter kernel size
+                                   const uint16_t padding,  // padding sizes
+                                   const uint16_t stride,   // stride
+                                   const q31_t * bias,  // per-channel bias
+                                   const q31_t * out_mult,  // per-channel output multipliers
+                                   const int32_t * out_shift,   // per-channel output shifts
+                                   const int32_t input_offset, const int32_t output_offset, // zero points
+                                   const int32_t act_min, const int32_t act_max,    // output range
+                                   q7_t * Im_out,   // output image
+                                   const uint16_t dim_im_out,   // output image dimension
+                                   q15_t * bufferA  //buffer space for input
+    )
+{
+    int       i_out_y, i_out_x, i_ch_out;
+    int       i_ker_y, i_ker_x;
+    int       in_row, in_col;
+    q31_t     conv_out;
+
+    for (i_out_y = 0; i_out_y < dim_im_out; i_out_y++)
+    {
+        for (i_out_x = 0; i_out_x < dim_im_out; i_out_x++)
+        {
+            for (i_ch_out = 0; i_ch_out < ch_im_out; i_ch_out++)
+            {
+                conv_out = bias[i_ch_out];
+                for (i_ker_y = 0; i_ker_y < dim_kernel; i_ker_y++)
+                {
+                    for (i_ker_x = 0; i_ker_x < dim_kernel; i_ker_x++)
+                    {
+                        in_row = stride * i_out_y + i_ker_y - padding;
+                        in_col = stride * i_out_x + i_ker_x - padding;
+                        if (in_row >= 0 && in_col >= 0 && in_row < dim_im_in && in_col < dim_im_in)
+                        {
+                            conv_out += (Im_in[(in_row * dim_im_in + in_col) * ch_im_in + i_ch_out] + input_offset) *
+                                wt[(i_ker_y * dim_kernel + i_ker_x) * ch_im_out + i_ch_out];
+                        }
+                    }
+                }
+                Im_out[(i_out_y * dim_im_out + i_out_x) * ch_im_out + i_ch_out] =
+                    arm_nn_requantize_s8_ref(conv_out, out_mult[i_ch_out], out_shift[i_ch_out], output_offset,
+                                             act_min, act_max);
+            }
+        }
+    }
+}
@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ref_functions.h"
+
+void arm_fully_connected_s8_ref(const q7_t * pV,    // pointer to vector
+                                const q7_t * pM,    // pointer to matrix
+                                const uint16_t dim_vec, // length of the vector
+                                const uint16_t num_of_rows, // numCol of A
+                                const q31_t * bias, // per-row bias
+                                const q31_t * out_mult, // per-row output multipliers
+                                const int32_t * out_shift,  // per-row output shifts
+                                const int32_t input_offset, const int32_t output_offset,   // zero points
+                                const int32_t act_min, const int32_t act_max,  // output range
+                                q7_t * pOut,    // output operand
+                                q15_t * vec_buffer)
+{
+    for (int i = 0; i < num_of_rows; i++)
+    {
+        q31_t     ip_out = bias[i];
+
+        for (int j = 0; j < dim_vec; j++)
+        {
+            ip_out += (pV[j] + input_offset) * pM[i * dim_vec + j];
+        }
+        pOut[i] = arm_nn_requantize_s8_ref(ip_out, out_mult[i], out_shift[i], output_offset, act_min, act_max);
+    }
+}
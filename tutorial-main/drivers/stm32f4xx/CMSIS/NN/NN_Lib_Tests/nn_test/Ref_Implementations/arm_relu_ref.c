@@ -40,3 +40,55 @@ void arm_relu_q15_ref(q15_t * data, uint16_t size)
             data[i] = 0;
     }
 }
+
+void arm_relu6_q7_ref(q7_t * data, uint32_t size, uint16_t int_width)
+{
+    uint32_t  i;
+    int32_t   six = 6 << (7 - int_width);
+
+    six = six > 127 ? 127 : six;
+    for (i = 0; i < size; i++)
+    {
+        if (data[i] < 0)
+            data[i] = 0;
+        if (data[i] > six)
+            data[i] = six;
+    }
+}
+
+void arm_relu6_q15_ref(q15_t * data, uint32_t size, uint16_t int_width)
+{
+    uint32_t  i;
+    int32_t   six = 6 << (15 - int_width);
+
+    six = six > 32767 ? 32767 : six;
+    for (i = 0; i < size; i++)
+    {
+        if (data[i] < 0)
+            data[i] = 0;
+        if (data[i] > six)
+            data[i] = six;
+    }
+}
+
+void arm_leaky_relu_q7_ref(q7_t * data, uint32_t size, q15_t alpha)
+{
+    uint32_t  i;
+
+    for (i = 0; i < size; i++)
+    {
+        if (data[i] < 0)
+            data[i] = (q7_t) ((data[i] * alpha + (1 << 14)) >> 15);
+    }
+}
+
+void arm_leaky_relu_q15_ref(q15_t * data, uint32_t size, q15_t alpha)
+{
+    uint32_t  i;
+
+    for (i = 0; i < size; i++)
+    {
+        if (data[i] < 0)
+            data[i] = (q15_t) ((data[i] * alpha + (1 << 14)) >> 15);
+    }
+}
@@ -5,3 +5,12 @@
 #define IP4_q7_q15_WEIGHT {18,-44,-12,78,104,61,-34,92,-120,40,-75,-19,29,-56,-80,21,60,107,-92,-118,58,94,-104,47,62,11,106,-105,-6,-32,-20,24,43,-116,43,48,53,-50,-86,-38,-108,0,-80,-73,-5,-26,115,111,78,-101,76,-55,94,-61,39,118,94,-20,13,-81,100,-111,70,94,-125,71,63,-121,-70,-14,-69,-74,54,60,-121,107,-121,51,-106,-38,-61,110,26,103,-43,-116,94,111,60,-28,-125,88,83,62,120,-39,-79,-85,112,34,121,-121,-93,97,-45,-90,-97,12,-97,109,90,-45,-59,-105,-100,-21,0,-122,-26,-37,28,-10,35,-115,-87,-62,6,108,-15,118,26,-84,-26,-74,1,73,-41,97,-65,86,94,34,67,59,-99,-67,106,-80,-26,-21,-71,-20,115,-43,109,-107,-21,37,64,-2,-20,115,-75,108,53,-102,35,45,83,-49,-106,-59,-46,121,-102,-41,51,22,-55,19,-58,-116,-103,80,25,122,-126,-76,-7,-2,-34,110,15,82,-46,-16,15,-52,-19,-39,-73,93,62,67,117,62,-27,-12,-89,-100,-15,-57,59,-127,20,52,-37,-41,-79,-43,111,99,-31,13,-12,99,43,-1,-31,124,43,-15,-30,-69,120,-79,-36,-89,-19,89,46,54,116,-46,49,85,94,67,113,24,11,-59,-17,-119,119,110,-57,-1,-81,77,32,-38,118,-13,113,-94,-53,111,110,-14,-19,-53,4,-20,117,-35,121,-97,24,119,18,108,-31,54,30,-121,-74,16,101,3,65,107,-12,14,-38,-53,125,-59,60,17,52,-65,21,-118,76,-112,91,106,-38,26,98,-4,-53,-108,-63,95,-58,19,63,111,-74,37,73,63,-115,-44,-84,22,-47,60,-51,9,29,-57,22,81,-87,-65,-27,-63,-93,110,63,-26,-126,7,-12,-118,-127,-70,-113,45,107,-69,103,-48,56,55,25,-55,79,111,113,120,-2,108,43,-122,-41,40,93,44,88,-78,107,-34,124,63,122,-67,29,24,14,-69,-72,108,67,26,116,90,88,-48,93,-37,-103,127,-24,-76,115,-80,-97,96,-61,-54,-22,-123,-14,-49,62,-1,-17,21,-65,10,116,113,10,88,30,-24,-119,89,-95,58,124,-112,-119,-115,88,119,57,68,-17,-27,31,-9,-64,-26,18,109,-60,59,4,-89,-127,-35,8,-90,88,22,-76,109,-123,88,-51,-90,18,45,25,47,-80,-66,75,-24,-109,-42,-47,68,-8,78,-98,-122,19,-72,33,94,2,-84,-109,82,102,55,71,-121,19,76,76,93,66,-23,-42,-2,40,106,3,123,-111,83,8,105,117,-52,121,2,-4,-18,-4,-19,-125,80,38,83,25,123,-64,47,36,29,105,-71,-72,-41,-127,-82,31,-43,3,9,73,91,124,-3,-99,101,-27,77,-51,60,-96,15,74,35,54,-119,116,-4,53,46,-29,2,8,93,75,38,-18,49,40,-30,30,22,97,-8,97,-35,-111,-62,21,97,-96,82,-12,28,-118,-12,87,29,-16,110,46,8,95,40,58,41,29,-58,105,-108,-29,36,-117,106,-118,-124,11,60,84,-87,-83,21,53,125,-31,-5,114,93,-75,-41,-127,49,-98,31,96,-112,64,60,-126,69,2,-73,94,-100,-23,81,-115,94,-116,-25,-44,91,46,-89,12,75,-47,107,-77,-10,-82,79,-70,75,-106,-1,62,-69,104,-7,-41,53,73,-32,74,-113,26,111,-115,66,-55,20,-91,-47,7,51,-96,121,126,-75,63,-23,81,14,-124,-39,-41,-13,14,16,-27,-56,-48,-84,-43,120,33,98,41,26,-6,15,18,8,31,-50,-9,121,-107,-33,-106,-46,64,127,-19,-104,-59,-30,86,-121,60,39,-79,-38,-5,-119,85,-17,21,44,-120,-22,89,73,-17,-102,49,-73,26,-69,91,-36,-71,103,63,125,-8,61,103,-20,-116,11,105,15,-116,-78,-122,-62,-80,-80,-58,-119,65,-47,99,-111,-26,69,87,-15,-38,-44,-87,-84,-14,-37,-27,-90,109,-72,-4,38,-110,82,-97,29,-50,61,52,-87,-44,8,63,92,83,109,-124,69,-47,-110,-70,-10,111,25,15,80,104,66,32,-16,-70,-49,-52,-41,-16,122,104,-31,22,-109,18,102,62,125,-123,121,74,5,92,-90,-92,72,-61,-2,98,-125,-81,109,101,-120,60,10,58,53,94,-25,38,-56,-13,80,-80,-13,45,-43,-77,-44,-37,46,-62,38,-103,-93,-124,48,76,1,-82,73,74,63,67,-59,-26,116,76,66,70,-30,-113,106,109,75,25,-18,25,85,25,-83,81,-50,78,99,-53,-68,-125,44,-104,-44,96,-126,124,112,33,-75,-29,-60,-9,-126,-84,-61,-119,-127,-6,-26,-46,-57,118,-4,105,21,-120,-121,54,-35,-70,-124,-101,-79,-33,105,-30,57,-108,-111,-48,-65,-108,77,41,112,111,68,118,0,22,44,110,56,-91,-111,-49,62,-54,83,78,66,38,-14,102,41,52,-94,14,106,105,27,24,53,-40,60,-70,-119,56,68,-95,69,59,-124,-101,-25,-119,102,-45,-55,-38,57,61,104,-96,122,88,99,-122,106,77,122,33,-5,126,-74,46,-52,116,-51,-101,74,74,2,-3,-38,-21,68,-30,96,17,71,-124,47,-23,64,-35,107,24,49,41,-50,-23,88,19,-30,55,-91,3,-14,-54,125,10,-96,84,100,100,-116,67,-40,-124,53,2,-62,45,21,72,82,10,-126,-47,54,-84,13,-50,-2,-66,103,-1,96,-17,59,123,-111,-61,-20,-70,-57,54,-110,-94,-125,3,14,-101,-128,-86,-44,80,-94,37,123,113,-104,-9,109,-87,111,120,-7,33,-62,-51,49,-57,-71,3,-49,18,-94,-32,40,-92,-52,3,105,52,108,123,1,40,2,-86,-104,38,52,-93,-73,-44,-62,91,5,-88,-91,-61,-40,-24,-30,-48,114,-115,62,-128,-93,-85,-43,104,102,-20,-103,-52,25,-56,-103,49,10,-25,84,-52,-94,51,-110,26,1,-108,30,32,126,-23,-112,-82,-102,86,-17,-108,78,-32,32,80,-112,-125,91,8,24,-69,-95,-86,-115,-73,14,9,-121,-2,101,-109,1,-72,54,84,25,-36,95,-49,-110,108,4,24,66,126,-63,56,99,-8,-10,-80,5,-73,72,-103,-35,-10,78,3,-61,42,-83,-115,84,-99,78,20,-66,30,-88,97,-66,-120,120,-46,-57,-29,118,15,-110,-94,-29,25,113,89,-110,-52,-92,90,105,-30,92,48,-44,-1,-96,-39,118,115,-3,37,15,-1,64,-2,81,57,24,-47,-14,89,48,-103,-127,-95,-114,-100,14,-69,-32,-82,-9,-77,33,-38,-76,-63,51,-32,69,-8,-75,26,80,59,-31,101,40,-37,76,-23,-110,-23,-84,-83,111,-31,122,124,-56,-67,4,-112,-123,65,101,67,12,-23,-43,-12,54,-87,66,35,-89,-47,55,-105,100,19,21,-80,-76,-85,-61,-117,19,107,42,-71,86,-9,33,-80,-65,120,-49,106,77,-34,-50,-38,-27,21,65,-28,97,108,42,-77,120,69,127,24,-20,89,-66,112,-126,-110,43,103,0,-63,-17,28,36,-43,-117,-68,115,-69,107,70,2,94,9,95,-83,-99,53,47,80,-105,-27,28,119,59,95,82,-94,-16,15,-49,-122,16,17,-89,64,-6,4,88,21,47,50,-78,-25,121,-47,-36,72,-21,29,-101,9,-83,-113,28,-68,23,-67,115,-101,-101,-98,102,-124,-98,-24,-89,82,-28,-89,40,125,23,97,83,-53,-7,-90,-108,-83,-113,-58,-26,-119,28,35,97,-74,6,-40,-15,-10,11,79,-98,101,101,8,-72,-99,117,-65,80,127,95,60,15,-29,2,60,-92,-118,-116,79,46,-79,-62,104,-43,73,107,-43,117,-127,-67,44,113,-41,67,-73,-98,26,74,-111,59,79,45,-60,21,-26,18,54,-72,-70,-30,114,10,-82,-124,-52,-126,-97,108,-19,120,-111,-52,10,102,18,99,49,-128,-17,91,83,-46,-76,-3,45,-41,47,-72,-19,3,112,-104,14,122,-77,-35,121,-23,41,-123,-60,-2,50,44,-45,84,69,-58,43,-69,-98,-11,112,-17,-95,-36,67,-69,-52,-11,98,-45,-126,-33,51,81,101,-38,68,67,-37,-78,107,12,105,75,-109,-100,-55,0,45,11,-24,3,-70,54,77,-63,52,125,93,-16,-97,-22,35,97,46,58,-61,66,-61,-98,12,-43,-45,-63,-36,-79,-58,41,54,-49,-63,48,-33,-110,-36,-49,93,73,-33,-78,50,-76,-48,-6,4,-87,-81,-88,-30,-33,10,-109,104,-94,38,94,-124,30,102,6,37,97,73,56,-106,-18,70,84,4,-31,-90,-27,54,63,10,50,-18,-113,-116,125,-86,-119,33,64,26,-128,-77,-25,76,-127,0,-79,60,-65,-63,5,-5,101,69,-91,-49,67,121,71,-22,59,26,-87,66,-26,-79,7,-73,-51,-114,0,-22,40,-87,-115,29,-18,-72,-23,-96,-55,69,-119,68,-102,124,-99,16,74,5,-34,87,120,-6,-28,-92,-111,-85,-42,-36,123,-52,-86,83,-77,43,-15,124,59,103,-81,96,-80,0,41,-62,-22,77,-13,-99,71,104,-121,72,43,4,107,80,-62,-98,54,-63,-13,10,-92,-119,-95,-90,-76,76,78,-108,95,-117,122,88,-115,52,-10,122,26,39,101,12,-80,107,-108,-13,36,-72,36,63,82,119,-57,-7,-44,77,-55,-54,-25,102,-118,-91,-93,58,11,-30,11,80,-62,111,-77,3,105,-63,39,-50,-33,29,-6,52,-98,51,-80,-5,-50,93,-122,116,-77,79,-45,110,-103,-123,-20,-16,-58,-101,93,-11,57,44,24,-60,-118,32,64,80,3,107,-25,60,126,-90,124,-22,-95,-57,-91,83,-46,-28,1,78,-47,15,74,42,26,42,113,-76,14,33,20,-93,37,89,107,-22,16,-16,23,60,108,74,-117,111,52,-97,78,53,-127,9,123,-78,-15,86,-17,5,-17,28,-120,-76,69,-76,13,120,-64,-17,-35,20,-98,-42,126,-88,-99,-113,10,44,84,-35,115,18,81,99,2,-82,74,12,-125,110,55,31,-110,-94,23,-4,62,-62,-122,40,-120,42,110,84,34,2,-3,-75,-24,-10,124,-46,-38,-14,-11,57,109,27,111,-99,6,27,126,41,72,-29,106,96,-24,96,60,42,-18,-104,82,-69,53,15,92,127,-79,-70,-102,102,-53,79,32,-119,84,115,-36,-84,7,-24,2,-77,103,54,60,-7,1,-64,-7,114,-22,-5,19,-49,80,107,-7,89,-2,-63,-26,-51,-111,17,-108,9,-40,-51,58,108,-55,-68,-117,-51,99,-117,-17,-33,46,69,13,4,-23,-71,-110,-95,4,119,103,31,-30,23,76,-36,39,6,-117,6,76,80,106,-124,18,-3,78,3,112,40,23,-100,-55,75,-118,-52,-16,18,69,-91,-77,126,-87,103,41,-127,7,106,105,77,-23,50,72,75,-16,126,-19,112,67,-102,-4,-56,53,-72,38,-60,-69,0,30,47,-95,53,100,-127,-16,-16,-18,29,46,90,73,-112,-97,-15,-111,-38,23,45,44,115,-93,-32,-68,-10,86,69,19,32,-104,97,-112,60,64,61,87,69,55,-4,-92,-77,-28,-82,76,56,123,-105,52,-38,-1,80,81,-40,-14,115,-78,32,-59,-115,-123,50,3,-14,69,5,-39,-124,70,34,61,-57,-35,34,127,-13,-120,109,-108,-22,68,-125,81,35,89,-21,88,107,87,-32,110,-19,-27,-82,-114,99,-81,115,-54,90,-92,65,-126,64,26,-114,36,-93,70,10,-94,-90,-111,118,-45,-121,-3,106,80,-101,10,-25,-12,39,-72,114,47,125,43,33,88,-81,-109,10,98,-98,28,105,96,-43,123,-58,-115,-88,-122,85,-80,91,26,-26,103,-121,-88,-66,101,-88,87,125,20,-62,-58,-46,-113,-36,-100,93,79,-108,33,49,-45,-19,0,70,103,-19,-48,-15,29,40,122,121,118,86,102,-83,111,-26,-86,-124,6,49,86,50,-67,-28,-104,-28,35,42,52,-25,-87,-70,-6,18,126,-128,123,-3,-109,-94,-49,-120,-62,-89,62,-107,94,109,110,10,-37,99,-126,-116,-85,100,113,-19,-52,-101,65,-45,93,96,-49,-78,84,-44,28,5,-110,-26,-48,62,127,-53,49,57,67,127,-85,60,120,-96,-67,107,34,91,-60,-6,-80,-77,-8,-119,50,-52,89,-64,96,127,-60,-76,-34,-52,-1,34,-25,99,100,-94,-46,-47,12,47,-47,45,-14,59,3,-85,-74,-49,103,-6,-79,-1,-25,-2,0,-44,-29,6,-11,108,-23,91,-48,56,75,-71,-77,-46,-100,-100,-98,90,-29,-35,-56,-3,54,-62,-126,124,1,-26,-88,4,101,-113,95,-67,75,104,39,-106,68,-127,127,-15,-36,23,-12,-51,-118,-67,-22,-39,-71,52,-77,104,9,10,-106,53,34,-67,-98,-74,84,87,95,38,-35,-38,-103,-125,-124,41,-31,3,-89,-107,-41,-9,-90,-58,-39,83,-106,-24,-86,-93,18,14,23,36,-56,75,-36,-123,10,109,7,13,-119,80,113,-68,45,57,35,32,-17,28,-1,-98,52,-37,6,-97,118,-119,48,-69,-102,-18,37,-4,-59,15,101,91,40,3,-31,5,-9,105,-9,-33,-31,-71,-7,-112,-71,70,-2,98,46,-99,73,42,-77,-38,53,48,-1,76,-120,-33,-62,117,-35,67,-117,58,33,2,-127,-66,-100,-117,-82,115,91,-111,33,-125,24,-89,76,15,84,27,-5,49,-87,-72,-35,-49,-128,114,65,-71,82,127,100,74,41,-63,52,-67,0,8,117,5,-102,123,87,8,-37,36,126,-108,71,-73,20,-76,104,-71,-50,-56,18,8,-62,-105,-52,-127,41,-26,16,-122,31,70,11,-100,-109,-35,117,88,29,-78,-45,115,-86,40,102,18,-58,-84,-54,32,-36,51,56,52,107,38,126,78,-66,20,-77,65,-119,26,-113,85,-92,-35,-67,-24,-47,43,-9,62,-70,-41,-66,-7,-72,-79,-77,56,75,67,49,65,43,-78,102,113,98,-47,53,20,-116,-2,-4,-12,-36,8,50,-118,-79,-37,-120,4,103,51,62,107,-90,49,79,-17,61,36,-15,17,-117,123,39,-87,61,96,11,-108,1,51,53,36,-19,-69,-51,-40,-91,-90,127,-62,126,-72,79,-61,123,-27,41,11,14,-67,76,-17,-70,47,-104,73,32,-109,-120,61,38,-1,31,-37,35,-26,-21,59,-53,18,-85,75,106,-83,93,-31,-18,18,-127,19,66,10,-74,-25,45,-109,18,30,4,-62,13,-47,13,44,-59,-96,19,-113,-18,65,-5,91,-75,-21,68,46,-90,25,-110,-115,1,-88,-91,13,55,86,24,85,-60,108,93,-61,27,-14,28,-17,-110,-18,68,113,70,-52,58,52,-9,111,-64,64,-97,-100,0,32,43,-88,13,0,-32,110,-104,108,92,66,-112,34,65,-64,-125,-9,106,113,-116,-35,91,-88,-91,13,-16,-117,3,121,37,-84,-75,-44,-1,-49,13,81,-77,46,113,15,-115,-37,21,33,-17,-19,-83,27,-95,28,83,22,53,-23,66,-57,-25,-15,-56,106,69,49,63,125,-120,106,-86,40,55,4,-96,43,-26,60,-107,-76,-116,-89,101,98,51,-21,106,53,-49,110,83,-119,27,36,2,86,-5,-50,47,42,-75,52,-59,-71,63,-67,60,6,83,65,124,28,16,14,63,52,-58,23,30,49,-81,-123,-26,-39,42,60,-27,-66,-61,-18,-88,-46,-22,-61,-60,66,65,-100,111,100,116,50,92,-83,103,111,-72,116,-5,111,72,101,39,54,-65,8,-44,-128,-88,18,113,-70,-78,87,-70,29,112,63,-31,9,12,-27,-109,-42,-52,-48,55,-70,95,93,-71,122,-46,-115,53,-22,-27,125,125,50,-58,21,-50,-71,9,-82,-6,45,50,-14,51,-74,-72,95,104,-86,57,65,-39,6,-10,-76,21,-52,127,17,-128,-36,-23,103,87,24,-95,10,95,95,21,-96,61,-24,-8,74,0,126,-14,-44,-102,107,-119,-123,83,51,27,-17,-64,124,24,79,-96,118,43,-95,8,-75,-106,115,-84,69,3,122,-118,-64,96,-106,-29,-78,-97,122,-82,51,14,65,-80,121,-66,74,-119,121,82,77,-120,96,-82,106,56,-45,-28,78,-116,-70,-13,41,90,-77,-55,-49,-78,91,-109,-91,-36,97,-31,27,95,-91,-116,-17,-21,87,112,-51,-82,62,-42,111,64,106,68,53,92,-68,-38,-25,-55,-38,-121,5,74,-96,-77,-109,-14,-87,75,-108,-62,12,-97,-91,93,42,24,-45,-5,79,126,-71,-10,-97,97,-19,6,-80,77,-111,39,-69,42,-61,-123,-30,-78,18,64,77,-99,-40,82,127,-39,66,46,46,-82,-117,-70,77,-17,96,27,10,56,83,16,22,114,24,114,-89,118,116,-84,19,-88,16,80,-25,66,-70,111,70,-86,10,-88,-1,80,-95,-82,95,-20,-114,-121,26,-15,-77,-104,-120,-7,123,97,68,69,59,-12,24,-20,46,100,75,-76,-41,-23,79,82,-115,-3,44,-69,-100,-55,95,81,-125,-108,-121,-46,-112,-48,-22,-10,-60,-40,112,22,89,79,-99,53,48,-54,-110,16,77,-51,94,59,-50,-103,-10,34,60,-115,84,31,-55,-58,-10,64,-5,23,112,96,75,85,4,-106,55,-77,-33,87,-79,-76,53,71,-92,-8,63,118,-84,-60,99,107,88,46,-89,24,98,-41,-36,-22,-88,34,-23,78,56,84,52,-14,123,60,-20,38,-66,-56,67,-80,-6,117,115,121,-126,39,-77,-8,22,89,29,-101,29,55,-31,-108,125,123,-46,6,-88,103,-35,25,65,-58,-118,40,26,-39,62,15,77,-25,-50,117,79,44,-79,64,94,-114,-31,-26,-10,-67,-114,-19,24,69,111,14,-52,-33,110,50,-107,95,63,-71,-21,36,-22,-7,19,-95,-71,-38,124,-88,47,120,22,98,-69,73,-114,-5,-18,106,-102,-41,-26,28,-101,-41,-105,-31,-26,-120,22,-21,-44,-31,-50,-127,85,88,111,33,-114,-53,-12,71,126,53,-55,82,-104,93,-77,41,46,-50,90,54,-38,-28,-128,-68,-13,-80,34,-63,60,31,-81,40,77,55,-5,-17,-110,94,30,96,61,26,43,-48,101,-128,13,-8,-29,-6,-60,115,107,-62,-57,54,13,96,114,-89,-69,36,-40,106,107,98,19,-28,14,-4,-97,-60,-64,-71,-107,-48,-50,75,-54,90,108,60,-101,-104,92,25,-60,-17,-63,48,103,113,59,24,51,32,-101,-26,121,71,-83,-21,-68,79,42,-115,5,89,65,-38,28,-91,4,22,89,7,122,-57,-51,-120,-110,-58,-42,-70,102,105,-112,33,21,-83,-14,62,123,-116,-55,-114,-110,95,-46,76,-6,-12,-88,-48,49,-126,-67,95,42,-94,76,84,-64,-112,-20,114,-8,9,-96,-38,-85,-38,72,55,127,7,117,54,41,-52,-89,-46,-121,-95,-97,-113,95,46,79,-105,36,96,62,111,89,-38,-97,61,120,24,90,-111,43,-69,48,88,-58,25,-89,55,14,26,121,-126,79,42,56,-43,109,-88,-53,31,-114,69,-1,-81,-50,94,35,20,62,-93,69,-96,-35,120,-103,-86,-44,126,-96,102,12,54,-97,-79,-49,97,-18,80,-111,-68,-17,39,102,87,6,-10,2,11,-89,-74,-43,-104,-9,53,28,-68,-126,-71,-26,66,34,102,-36,32,-96,-83,-127,87,83,-50,-98,-60,71,-81,-97,108,-74,50,-98,20,-9,75,-48,8,0,124,74,-27,-59,1,118,-121,52,-57,112,15,81,120,-66,-10,42,87,-89,-92,-123,-1,-74,-29,126,57,31,-50,115,-47,-89,-20,-107,51,28,49,110,38,-37,-73,-72,-70,-20,-124,-109,67,-114,7,64,32,101,-76,-107,52,-109,-89,51,-51,-98,-3,122,100,-2,-57,34,-38,-101,22,15,92,-104,9,47,-9,47,-18,27,-38,-122,-58,-20,102,-63,-78,-19,-71,65,-112,-48,49,85,27,-113,-57,24,108,81,-96,99,-47,-67,-121,2,-17,-29,-9,109,89,-45,-127,122,-59,44,-81,55,-39,5,40,-11,0,61,37,18,-82,-97,-69,27,-45,11,-70,31,-88,117,-98,114,115,75,-104,-3,46,104,-67,21,49,18,95,-8,31,11,55,22,-76,39,-17,24,10,-63,-97,114,57,-46,-62,34,-66,-86,-94,-109,-67,124,68,42,26,-65,-60,-41,97,59,118,55,-104,16,-25,-99,-13,-28,-50,103,-50,51,-77,55,91,53,-17,-82,-108,-121,-54,24,118,77,24,73,-120,-61,36,-63,-122,51,-88,104,22,76,14,118,63,122,-31,-115,59,-92,29,101,-66,-48,-7,30,-5,86,-41,11,-87,71,-15,-30,75,-110,2,91,9,18,101,-51,-102,-115,-83,37,14,-41,-17,-43,106,-108,-42,-86,34,65,57,-13,12,114,25,-69,-36,-48,93,-89,-99,-104,54,15,19,-101,-105,-51,24,-26,93,-2,95,-43,51,-112,-14,-83,69,122,77,20,-7,-29,107,79,115,-102,115,-58,-111,8,46,112,-67,-97,-20,-88,98,-30,75,-47,90,25,110,3,-8,94,70,47,22,-103,-91,-54,58,-12,-38,-50,51,72,37,27,7,-50,-112,31,-14,-76,70,-95,-109,48,-111,-75,118,30,-2,-7,-123,33,32,-89,-47,-6,25,67,73,-7,-29,-93,49,112,111,76,-65,-76,8,-95,45,-79,83,84,23,-96,20,-52,15,-56,-70,7,-58,85,106,122,-96,-84,8,85,-101,35,-30,-14,23,33,112,-86,20,73,-93,-30,-8,-39,-79,-77,-36,-107,-38,-112,-89,-27,49,103,48,127,31,-22,68,100,-35,99,57,74,-26,85,118,-43,101,105,-76,-127,-93,44,-1,68,39,12,93,13,-33,-78,11,85,-51,44,-99,-85,12,-63,98,-92,-5,76,25,-86,-68,-121,-67,-109,-64,31,64,-58,-90,126,52,20,-41,27,120,-117,-86,71,-128,-28,-128,-39,82,113,-102,59,30,78,-128,30,103,-95,-11,117,74,94,113,46,56,41,-96,48,-85,-28,-25,-79,104,-73,3,2,30,76,-22,-103,101,-89,83,34,2,-26,127,25,-82,18,8,-3,-20,52,13,-21,36,90,-38,112,-85,-79,-92,9,-72,15,98,-26,-32,26,-4,-26,-94,-5,112,69,-21,-84,31,-17,-112,46,-83,-24,-105,-102,3,15,-60,99,-123,-6,-47,-120,22,70,125,35,86,38,35,-100,5,89,96,-33,64,-55,29,55,-82,-3,17,52,89,104,126,-125,62,-80,113,53,34,77,83,-65,-28,-27,2,-114,68,-37,-4,89,-94,-41,51,43,-85,-36,93,74,-93,-8,109,-70,-92,114,-120,-63,44,77,102,36,50,88,16,99,19,-9,64,-43,-57,-81,-67,-9,-70,89,-64,53,114,-99,5,87,-31,74,66,75,-37,108,-100,-101,85,-44,-120,-70,-32,92,80,-16,30,112,-102,99,96,-6,123,100,-89,102,-38,102,-90,-80,-9,9,52,-47,-114,-128,-81,-112,2,-40,87,-41,46,119,-15,-107,79,15,105,-53,108,-22,72,36,45,-88,82,59,19,27,118,123,-93,-44,-46,93,-98,105,64,-80,99,-8,-110,-51,33,76,-58,-103,87,26,-13,76,-93,83,-13,127,-4,-54,-52,21,70,20,-93,-7,19,102,7,94,41,14,67,-52,17,23,54,-81,93,76,-61,-23,-92,9,-118,110,99,-128,-53,123,-127,-125,-24,-76,88,63,-79,-65,71,59,-79,-45,-64,-111,-85,-53,55,22,-102,-78,48,25,-67,100,0,72,30,19,56,-6,-54,40,-71,98,-42,127,-46,40,58,34,-6,21,-112,-113,2,-42,-14,-25,-78,12,-55,62,58,-44,-127,-40,85,-80,29,-27,-72,8,73,-36,-32,-21,34,-46,84,75,41,109,-41,-92,123,20,-123,72,106,47,41,-12,-73,-38,117,44,-89,-128,-102,49,-65,-43,69,-119,-53,60,-97,9,-39,-118,-33,28,-58,105,-41,111,70,39,-41,58,90,20,-25,110,-21,50,-114,-104,-68,-35,96,-16,58,98,26,-98,-80,63,74,-85,119,21,-124,118,8,-61,-125,23,-112,30,-77,-11,92,-28,-101,-9,-57,93,-49,32,103,-97,87,-96,116,77,-48,92,-27,57,-29,52,-25,-107,-77,114,-50,99,-79,-58,24,-19,-96,47,-113,-80,8,-72,-83,69,-6,92,55,39,17,21,76,-127,-5,-115,-60,-55,-28,-43,40,-43,106,-35,112,-57,25,19,80,-39,-6,-79,-111,4,-59,121,-77,-103,-89,-113,-127,28,61,-125,-50,58,-38,43,-33,124,41,-105,69,2,99,-31,83,-119,-21,90,38,92,-88,-83,113,56,-56,-49,61,-74,-2,101,-23,-114,26,-95,114,-52,-73,-53,-7,116,32,119,49,81,-88,-102,-49,-126,50,38,-47,-13,76,-73,69,-124,5,-63,-53,11,-42,-97,35,46,29,112,-43,-2,46,83,58,-17,41,125,-5,-34,-96,49,67,-17,-80,-82,38,81,29,-13,84,96,-112,13,49,65,117,23,52,3,49,-43,-26,-88,-97,-60,93,-93,-34,-74,-54,5,-113,-73,64,23,-95,17,50,-112,123,4,-90,-35,103,-41,16,26,-104,-119,109,-71,95,60,28,-71,-41,5,-26,-118,-31,58,-126,-93,-50,30,-48,-51,-31,-92,-2,-75,85,71,-52,112,-48,-65,74,-24,41,121,104,-95,122,-49,-83,119,-20,97,38,23,-73,55,-22,-118,45,-37,25,47,-122,-4,89,125,-105,55,37,102,52,34,-12,7,85,-6,15,17,13,97,18,20,-92,107,79,-16,117,60,-80,-3,-23,-70,81,124,52,105,-36,-44,-125,-81,-40,28,88,-111,-57,-96,-49,-5,18,71,-37,-73,32,53,1,77,-124,-70,-107,-79,33,-83,-34,43,-125,20,-55,-53,15,59,59,71,-97,44,78,33,80,-20,65,-72,68,-125,23,-3,-30,-89,93,88,64,123,-44,117,126,59,38,32,-5,40,125,98,124,-104,-31,-27,-59,98,12,-43,125,-48,-74,62,43,-6,73,19,-3,100,-104,35,-62,47,-8,60,37,-125,-100,49,95,-74,-15,76,8,58,14,20,-85,-56,29,-125,70,94,-60,-112,-56,82,73,78,92,-40,-37,-50,37,22,19,23,63,-49,116,113,27,82,-5,46,24,85,41,-11,106,102,-123,45,60,-108,63,-67,124,114,53,-126,-14,-108,64,-6,-27,-19,-101,102,-27,112,-45,-4,93,-36,-68,93,-111,-64,69,-109,-128,-78,-16,-79,-62,-51,-8,-40,-39,-94,-4,-117,123,70,87,-79,-91,15,18,11,98,-51,-104,-59,-76,40,-82,100,110,102,13,42,71,117,-81,-120,-41,-48,-17,44,-20,-44,-120,79,76,123,-128,-51,111,71,-41,-86,-76,-32,80,124,-43,-65,123,5,21,5,55,73,34,-46,-55,-108,58,116,110,59,85,-61,-24,111,-86,-34,-128,59,-111,45,-125,-47,-94,-90,48,-56,-109,-95,-37,79,-127,-17,102,-96,-52,16,-77,40,31,-59,-93,10,-26,-28,108,-85,-2,95,-25,-94,-88,120,30,-69,-24,-9,90,67,81,-92,123,42,116,12,123,86,88,-86,10,-77,-16,54,-119,-43,-54,-7,104,-75,-111,-3,63,-95,-96,112,-68,68,80,-128,3,-37,-13,74,-113,-88,62,-32,-40,55,-48,-21,-64,118,64,-126,-41,-75,-79,-112,-78,19,-81,20,-10,97,86,-20,127,56,101,118,69,73,-62,52,125,-84,-15,-30,65,-53,105,-59,-54,-87,87,87,-116,-120,49,71,-48,99,-108,-19,-107,-40,-98,58,86,-125,-119,-62,-38,91,23,85,-55,-31,52,123,-76,77,120,49,122,-19,-118,-56,86,-15,-74,-82,47,-83,-121,21,-69,-86,119,-39,59,87,-84,1,19,-67,-58,-122,-45,-38,54,-96,-13,-91,100,-118,-97,73,-72,-30,23,-30,-121,-36,94,20,-38,22,-4,-7,-85,50,114,95,-105,35,-85,-89,-41,93,8,45,-53,87,93,30,117,17,-61,-61,69,48,-52,-99,-75,-104,-113,10,-27,80,89,107,119,-76,-30,125,75,122,55,8,-13,-37,-37,24,13,33,31,-14,98,101,-51,27,24,37,-51,-15,110,83,-49,85,-122,-30,18,92,-17,101,12,-54,97,-99,4,-82,73,-46,111,-7,29,-75,90,-91,106,45,68,68,-111,-63,99,-74,86,-122,-35,-28,21,-22,74,-70,-80,-93,50,14,-9,-84,45,-41,-18,-50,-105,82,-94,-89,102,-38,74,120,90,-17,43,-82,-83,-17,-119,-106,52,-63,-80,123,124,-118,75,98,0,-76,-100,77,-72,80,-18,-49,61,107,100,89,-27,-70,93,-52,-68,-46,-89,49,-9,13,-77,-29,103,-69,-52,-88,-65,39,-33,-119,-105,96,29,48,86,55,-76,62,-128,5,109,73,-94,-43,-11,-82,-32,122,52,33,29,-40,63,-89,-88,-16,77,67,-69,-59,-106,112,59,-67,6,-92,-115,-120,107,40,38,-33,69,87,81,8,9,9,-31,-68,-110,113,-117,-81,44,-62,-85,-23,77,-6,84,-126,-63,58,105,75,-48,38,80,-45,-2,34,-62,-8,107,-16,-82,-128,-17,57,-113,-99,12,-110,-47,-44,100,-23,121,-29,42,34,-64,-124,100,123,105,-128,-7,117,5,-13,13,-125,112,-4,86,53,-128,-87,-81,-75,-18,-77,116,-110,-122,-60,100,-124,117,-35,82,77,87,125,29,-127,123,100,-54,-117,-100,-105,-49,-77,2,-4,-110,-101,6,63,53,-103,76,-40,-118,108,-103,122,52,-3,54,-86,57,65,86,-106,4,-99,82,-44,68,15,-41,51,17,4,92,-63,22,-83,-126,65,63,-115,76,80,-109,-50,16,105,79,-115,96,34,-71,-61,-89,98,92,-36,-88,113,56,18,-123,32,120,110,81,-29,108,-31,34,-24,-102,-33,-8,25,76,-128,77,84,90,76,-98,-4,-104,-105,-65,10,-62,29,-80,89,-116,120,101,22,-36,-85,77,3,-44,-107,63,45,-19,-126,16,-29,1,31,-125,-108,113,30,-103,-38,-127,26,-18,-56,-120,-121,32,102,-25,-7,-85,47,-50,-121,-109,-6,-127,-34,55,-114,-34,82,-6,-44,83,-2,-69,-34,101,-21,123,25,33,-23,-108,-107,-46,-46,56,-30,38,108,106,60,-31,-78,8,25,4,124,12,29,37,2,89,100,40,-48,21,-87,-53,109,-116,-46,77,-60,-64,-68,122,-25,-109,-71,28,62,121,-84,-73,80,12,-118,-88,-89,109,106,-74,-62,89,58,-65,-73,-74,-64,-110,-73,-27,96,-87,-128,-122,-72,54,42,22,73,-37,-87,6,29,31,-46,62,-99,23,63,114,10,-20,-43,68,-24,15,124,-63,76,-25,-12,30,-86,-43,38,111,-121,69,-5,-49,34,-42,-51,119,39,80,86,-32,27,-74,-71,-24,73,-25,74,-11,53,104,117,87,-32,-11,-115,-24,99,-78,-7,-113,-99,-76,112,-20,121,50,-9,-103,-10,111,-68,-9,-35,96,-108,10,-38,2,-18,-73,-64,90,-105,94,103,-22,22,116,99,-68,-42,124,-122,-117,-119,-43,-6,47,72,90,-52,52,-76,2,-22,-84,-19,-85,-124,92,13,-115,36,2,107,15,127,-76,47,-39,-109,3,90,-24,1,-74,-29,-17,-27,-21,32,102,26,-57,-108,-114,-112,-104,76,-47,-17,86,-86,38,106,114,-81,-77,52,67,-28,-68,-63,23,-57,-110,-81,95,-35,-97,-29,-96,-11,64,-1,-118,-99,-25,-24,68,-118,-84,68,-113,94,-39,77,93,-80,-1,12,-123,97,80,111,-117,-52,5,-24,5,-98,-27,48,-96,-37,-108,70,-28,63,-21,123,23,67,-33,-96,47,-58,-50,-124,-109,-64,20,-37,44,-101,34,95,100,94,-57,39,-4,-21,-62,-76,-37,-72,-51,10,114,-21,113,45,-68,27,-77,47,105,18,122,-117,43,-99,-82,40,-15,-7,112,27,-86,-37,83,-8,-53,1,-110,47,64,-58,44,-50,14,18,-33,69,-17,-90,51,35,-58,-103,29,100,38,107,-44,-99,106,-49,-90,23,107,-44,-79,7,-21,-10,40,-76,-58,-50,-106,84,-47,34,91,-9,23,113,114,-11,-91,-62,64,20,58,44,-76,-105,-55,38,-101,121,94,-125,81,-55,-128,-101,-22,100,78,43,94,-46,118,-103,-36,81,48,45,90,-3,2,44,-8,-66,-49,104,116,-90,-69,-78,28,-65,15,-31,103,-71,14,-103,-90,-54,36,-81,-62,70,-35,-60,103,-13,45,20,-32,-93,127,59,127,-54,-89,-23,117,48,77,3,-84,-35,-56,37,87,60,-115,11,-27,44,103,78,-16,-112,-3,-44,45,61,-112,-102,-104,88,-67,102,121,-106,104,46,-39,52,-91,-77,-13,-79,118,-52,61,-90,-5,46,24,-59,-84,57,-34,101,-62,47,-66,-18,122,28,102,32,-123,-19,121,81,12,-110,89,-78,-38,8,-78,-94,-2,44,111,-36,-2,-66,22,83,-59,-43,92,60,-29,-71,92,-51,7,19,-2,39,-66,-100,116,-78,92,7,124,103,107,127,-115,80,62,99,98,-95,-74,109,-3,59,-126,-61,-93,11,-58,87,-24,100,113,21,-65,-71,-103,-106,122,96,-71,100,-38,-118,-23,72,0,-55,-68,-108,88,73,82,119,-105,-90,59,-41,99,37,76,-41,-62,94,18,-37,67,68,56,-41,110,53,-24,14,-62,38,-121,-84,13,48,48,116,-17,110,-80,-63,50,-4,8,111,-77,77,-4,112,19,-9,64,-32,-45,72,77,-90,-127,88,74,-61,-85,63,-75,125,-46,-15,-86,79,116,76,7,46,-99,36,14,-55,0,95,76,101,-115,67,-18,-35,71,95,-104,8,-124,38,-42,13,-70,18,98,77,51,-82,-27,-61,-66,2,26,2,-26,-61,-119,-70,44,114,27,99,-99,14,97,34,63,-88,-44,65,82,30,-47,-99,-97,13,-13,48,47,4,117,-29,37,11,-7,28,78,41,-59,-94,8,99,-125,32,-109,14,-13,-58,11,101,100,-94,-61,45,-49,90,47,84,77,19,12,-24,-86,-63,112,-48,73,4,-91,54,47,3,67,5,68,-26,-64,110,-71,113,-96,105,23,-14,-79,-18,67,36,-35,-36,48,68,-33,-5,56,39,-56,-20,-11,-43,6,82,-33,121,29,8,-78,28,-29,-101,-76,-81,116,-98,-72,97,-16,107,123,-89,-47,-84,102,-113,-107,105,-24,-112,-67,-77,-41,-18,29,49,-19,54,49,41,20,63,84,15,103,33,50,-25,-118,42,87,61,48,-48,-121,16,-74,-85,-13,6,-14,-76,82,90,-68,-4,-40,2,17,-101,81,-80,102,-2,-64,-54,-74,8,7,-117,99,21,21,-50,74,-36,-89,-75,85,-35,-29,-105,2,-55,2,28,71,-118,53,126,-84,2,9,-20,-104,45,4,76,-113,10,124,83,81,88,50,95,66,44,-110,122,17,30,92,-85,26,-53,73,-78,-32,-127,5,3,34,-75,81,54,-15,-13,9,-42,-126,-102,7,96,119,34,109,6,67,-70,116,9,-26,103,19,-9,116,88,-12,-88,39,92,85,91,-87,33,-43,120,96,-59,-53,84,12,-18,-68,-87,3,48,-99,-28,87,21,-88,86,-93,116,63,33,100,-65,-56,-36,-36,-38,-80,-97,-62,-87,66,-65,77,103,85,73,-99,103,102,104,-80,-70,60,-96,-6,-67,1,-1,-44,90,-80,93,-59,39,-81,66,63,-35,17,-58,-56,-49,83,71,-80,-54,-111,92,-7,-48,29,-7,56,-107,-114,-75,21,54,-124,-3,-60,-78,-13,61,-110,123,80,-49,96,-105,-115,-29,112,-68,126,-87,-74,82,70,16,-70,-84,53,22,-16,29,-40,-90,-47,14,-117,-3,6,-13,64,-84,87,-100,52,23,-57,108,74,-37,59,82,45,87,20,-65,52,57,-96,-61,2,-39,-33,78,-79,84,-61,63,34,37,27,-13,12,101,32,9,-16,-19,21,59,-119,-97,57,-124,127,6,76,83,80,-31,27,102,-105,118,56,85,89,98,16,-57,68,3,6,58,-95,-77,-78,26,-26,5,-21,-113,23,-110,90,-16,35,-23,-108,-47,-14,102,-42,119,46,58,10,83,-117,80,-49,-38,-58,25,80,-85,40,-54,-2,-35,-100,-80,-77,87,-122,-45,-94,-115,63,86,-10,84,-47,-114,101,123,111,-75,71,-111,-47,-35,43,-99,-22,106,-3,-89,-94,111,22,-52,95,-17,104,71,96,10,7,-99,-90,32,-38,-81,-7,-112,30,-16,-11,106,-104,-30,78,99,-110,30,-31,-125,111,-50,-19,-50,-66,109,-113,95,26,-74,-86,-66,4,70,-4,-14,-2,-86,-83,48,118,-62,-30,-78,-2,102,-105,-45,83,37,58,53,100,-66,46,-25,-104,125,-112,89,49,95,75,22,88,19,-76,-35,101,39,20,54,-82,61,-40,-83,-106,32,-106,116,-80,-52,-45,-86,-126,-56,-71,108,52,70,39,103,-24,71,121,120,117,9,5,110,-97,-79,-39,-56,77,71,-90,-97,3,-8,-64,-102,-5,105,59,-100,-76,-65,-99,-6,-7,85,115,112,14,118,65,10,-60,116,68,69,-83,-118,23,24,13,40,68,-78,-2,-43,79,96,-63,-5,-19,-56,19,94,-79,-7,96,19,-93,-47,31,30,22,43,89,-104,61,-49,29,-111,61,121,-41,32,116,-17,121,-109,-51,7,51,-6,-80,-105,-84,-41,88,16,-61,91,115,-25,69,-80,-12,-70,45,80,75,-38,-22,111,15,39,-71,62,68,40,-51,11,-9,44,51,29,-27,112,-106,-95,29,-114,-105,68,105,-68,-109,-13,-82,51,33,50,-48,-103,-65,-46,13,-51,-29,17,54,-91,123,108,-73,-120,43,27,100,32,-13,52,123,-52,33,-43,-110,-76,-79,-30,-86,109,-90,49,103,39,-28,-52,41,0,106,-13,10,-57,124,-15,10,74,-124,26,91,-63,114,-48,52,83,11,-44,95,-23,13,-57,114,-108,82,96,39,27,-34,29,-60,99,30,5,-101,117,-128,-74,-47,-33,-118,-69,-121,-112,-18,20,-6,-35,117,-80,-35,109,-102,24,-33,47,-5,-13,101,4,-127,25,1,-117,-57,-65,74,-64,-107,125,0,-78,-60,110,-100,-1,-19,-63,27,61,-17,-75,-84,-29,-56,-25,21,107,46,88,-33,-89,109,83,-83,-100,-121,-55,-48,-3,29,28,98,-64,-59,-73,-65,-63,-86,30,92,-29,4,65,-26,47,-111,1,-21,26,-109,-86,-119,-1,113,-29,-88,77,75,-54,-35,22,-95,24,-40,127,80,-56,-24,43,125,-18,97,-77,-32,61,-85,69,-105,19,9,65,127,10,9,90,-76,-37,-2,-18,-15,-57,2,27,11,-51,109,28,17,2,90,69,22,98,-55,-63,-53,125,48,-13,44,-96,-94,-116,65,88,-2,72,76,61,79,12,64,-112,-11,44,72,-103,-29,106,-24,78,91,72,-93,74,-123,-36,-121,4,79,92,-28,83,-109,-98,-99,63,92,98,-39,94,-43,-57,10,83,-23,92,50,79,-111,-32,-79,40,-34,-26,91,115,-124,-19,68,-72,56,60,-101,-73,-55,36,-83,-59,-86,-73,3,-98,-85,3,103,10,-113,34,53,-90,112,-114,-122,26,46,58,52,51,-101,-1,29,-87,-108,-77,25,-51,0,32,97,-36,57,67,117,-124,-61,13,-67,8,-108,-50,-59,28,95,-112,10,124,105,-54,-127,-43,-86,-50,53,-1,-108,-111,65,35,-42,-28,-119,-47,-92,-97,15,-50,12,63,-42,10,-71,22,-23,83,-24,-28,20,69,114,98,108,29,3,-42,123,-101,120,13,-36,-44,87,15,74,-89,77,56,-23,65,-12,19,54,66,-31,-16,-111,109,-43,111,-87,69,79,-8,124,-17,-46,-48,15,61,-28,108,-72,-58,-55,53,83,-80,118,43,-88,-54,74,-102,-38,56,116,-80,-125,-75,-3,105,43,88,-66,117,-120,-58,82,74,-5,6,78,-72,-79,-51,85,-49,-100,123,-42,4,90,-33,-55,88,127,60,-115,20,-123,123,117,9,-75,122,-19,-97,-98,-15,90,-32,92,94,-86,41,68,93,106,-60,-41,-80,40,24,-91,-86,-39,73,-120,-27,125,-87,65,-123,-41,-9,35,113,91,-40,-111,2,5,34,83,-66,114,-111,90,57,126,-93,62,-117,5,60,-68,11,-105,-35,-33,51,-52,-45,97,83,117,36,-81,45,59,-43,64,-62,69,-95,110,88,102,-125,107,-97,43,95,-122,4,1,-51,25,-12,43,-22,100,98,-64,94,64,-74,45,-38,-46,102,-21,-37,29,-123,-104,119,-2,-40,115,-31,15,2,21,-115,75,82,-8,18,74,8,27,-80,90,88,10,37,-104,-1,-82,77,80,-97,-99,-105,35,40,110,-49,24,99,-94,43,20,40,-40,10,113,-71,43,-63,-22,77,64,-3,-79,-82,-44,-53,23,86,110,-124,97,-27,-106,-95,104,-96,-121,25,-14,74,54,120,72,107,-128,-9,-60,21,49,-67,-12,18,-30,-33,-91,77,40,38,33,-70,7,-43,-89,44,-12,111,-108,14,36,-15,85,112,-85,-109,-48,98,57,100,-17,85,-123,-72,-111,60,15,-124,11,90,-105,7,-107,-121,91,-10,-98,83,-116,-10,54,-128,64,59,38,64,-25,36,-17,101,-96,-108,67,-89,46,20,26,126,-71,-1,0,77,32,-72,-31,-29,44,-14,-8,-74,42,-11,-21,95,119,84,123,-128,30,27,20,-74,38,-11,-122,41,94,-51,-33,-115,45,74,7,80,35,18,-30,-101,-6,95,-92,-69,33,16,15,-59,-111,3,-67,-86,28,-43,40,68,27,-111,-95,-26,98,38,83,106,-126,-34,86,-54,-102,-110,-88,38,40,-37,46,81,11,-122,-8,-46,30,112,90,-40,95,-61,-73,77,-123,-44,105,32,-109,-110,81,-23,127,-83,81,-55,77,62,-44,-33,-70,-62,4,52,115,32,-36,-96,-123,-33,86,127,86,38,43,53,21,106,-125,-69,-16,84,-98,-80,-12,17,-25,-70,-72,34,-33,-115,-119,48,42,-34,6,91,-18,-19,22,0,46,-92,-27,106,-116,35,78,44,50,-110,-113,7,14,18,-123,22,-112,113,-91,-51,-17,88,-83,-51,-19,30,28,109,-64,-114,86,73,-33,30,-1,-121,-58,51,-109,86,104,89,119,-76,-28,-90,-95,-100,69,-55,-23,-14,58,-112,30,-77,125,72,-99,55,39,67,54,-6,4,52,50,92,-47,-26,6,76,3,96,89,97,126,80,-80,-100,-76,67,-119,-36,58,-13,16,53,53,5,123,106,31,33,-67,111,-27,48,7,-111,23,-110,-42,-16,-105,38,43,51,-17,-12,-98,89,-32,3,64,118,65,21,-66,-1,-93,-115,93,-75,7,-25,126,59,107,-19,-26,14,-107,75,45,-16,-110,-34,50,2,-11,-109,19,-61,125,-94,-63,123,-24,-11,54,-115,121,-16,-39,98,2,77,102,90,52,-110,-55,109,-119,-47,-121,116,119,65,68,6,6,22,103,-121,49,-117,119,-38,-90,124,-32,104,90,109,-16,-100,-92,61,-115,-107,60,-26,93,27,111,-124,54,-72,-77,123,-79,89,-89,-54,-94,108,59,-49,78,-108,-4,-28,-119,55,42,36,95,123,-7,-99,-42,-100,-6,91,-65,-24,32,-77,106,59,-5,-93,-100,115,35,70,-90,-7,-6,40,-20,105,76,-32,-74,77,-32,-91,114,49,-126,-83,-81,84,113,80,-69,-99,-13,-29,-103,102,-69,-108,-127,87,-43,-11,-126,-113,119,-104,-11,79,62,26,-90,-22,7,-64,-107,77,77,-83,24,-90,52,-57,10,-22,114,-38,115,-37,-52,-63,-76,-13,94,-56,-96,78,59,33,85,-82,-97,10,74,-95,-113,-78,99,-66,50,4,32,102,69,20,-76,-69,-57,-26,5,-105,127,94,-72,-19,-117,-7,-38,24,-91,59,86,91,9,-58,126,-81,-126,-39,28,35,124,101,74,120,-90,54,14,-31,-108,80,94,-40,50,-56,26,-5,19,-37,-39,-45,-117,9,37,53,83,-73,-22,-107,-102,-104,38,-126,-125,90,-106,74,-98,72,21,-76,-56,20,109,29,52,-45,-42,-51,51,-1,122,91,12,-18,-69,55,-3,51,-111,-106,123,11,-108,-93,51,96,-100,91,-87,-51,70,-39,15,-81,35,62,-54,-87,33,-64,-125,-111,14,-109,-89,70,-36,65,-122,-47,126,126,-119,-49,-34,46,126,-87,88,-117,-107,119,29,-65,25,-89,62,-89,-88,-117,103,100,9,-36,56,79,95,-124,66,-5,-126,-9,9,-95,-95,-93,54,-2,-54,81,-106,21,-25,108,105,-37,-9,-97,69,122,84,39,-124,98,59,-25,-67,18,35,48,-105,117,78,-75,-42,3,-76,-107,76,79,3,-81,-61,30,-99,-99,101,-118,-94,112,-88,-19,-82,103,-67,76,-71,-105,-24,-91,-20,83,90,120,-7,34,-26,-110,75,41,62,-116,-77,23,109,107,74,-78,94,-125,26,-13,27,99,49,77,-73,100,87,77,0,88,93,-23,-115,-36,-108,-24,123,-65,-60,-63,-44,0,19,102,-19,89,69,85,-96,88,-103,123,108,119,-68,-99,89,11,-56,116,-106,97,-68,6,-60,47,52,-1,-53,94,-55,-107,-3,-9,-105,-3,-21,-69,-37,18,-59,78,37,127,118,107,-117,-79,-43,-108,124,33,-121,-25,52,-71,76,64,-2,27,-52,68,88,14,25,-115,57,30,-36,-16,63,-75,92,110,-57,-105,-82,-21,-72,30,113,-92,-20,-15,-77,-20,-25,106,22,56,79,21,68,98,115,71,32,20,122,-70,112,38,62,105,48,15,115,47,-124,48,-71,-41,-85,127,-6,9,122,110,-68,-45,-35,-21,-103,122,30,-70,42,68,9,83,13,105,110,8,98,-42,93,117,-26,21,-42,-82,27,110,-123,10,-98,-5,22,29,-112,-32,109,31,7,-91,22,71,-56,60,29,-126,4,63,-64,-77,74,-53,92,-7,-54,-128,72,-20,-92,6,-89,-20,52,46,32,-94,-119,-90,-92,106,74,22,-50,88,-69,107,8,3,55,-102,-64,28,-106,74,13,96,97,110,-59,58,83,-95,-49,-106,87,71,9,-19,125,26,-26,-93,-28,-52,20,-63,49,-73,-11,112,14,121,-65,88,-128,4,72,-117,-29,-74,-33,21,102,125,112,-49,-82,-7,-28,82,46,-71,12,118,4,121,97,16,28,85,50,78,-24,76,74,107,-47,-67,63,-94,-112,93,-59,-48,-32,119,84,108,74,52,-113,-17,-96,27,122,-67,23,-10,33,-63,-54,49,57,-103,-58,54,20,102,-18,-78,-125,62,20,109,7,-20,107,31,-85,5,104,81,-61,98,51,125,-32,-90,125,-100,6,64,104,56,126,24,-86,109,23,-100,15,23,50,22,-83,30,-128,-82,123,-89,14,-48,-82,-36,-92,-65,-12,10,107,-61,-124,-36,-75,49,0,-105,26,119,101,120,-37,-38,-89,18,-55,-47,-118,-92,-17,48,-14,-50,-72,112,-100,-125,-106,-114,126,-23,-105,-41,102,-7,-5,87,-25,71,-111,-11,-76,-106,57,-84,39,-28,123,50,47,-23,-66,-101,102,-65,103,32,10,84,82,34,32,-112,-14,-125,-109,79,28,-18,97,38,56,-36,-70,-6,-78,-80,33,-120,104,68,27,41,93,-95,125,90,-18,-97,-33,-102,53,-79,4,-27,30,-51,41,-72,-74,92,-102,28,-56,114,122,-105,121,8,-51,63,-117,126,-56,-127,-126,49,84,30,-76,-13,-45,53,57,3,34,-85,49,-112,41,-71,127,-111,22,-114,-34,38,-45,44,97,52,4,-111,-35,-98,-24,-53,42,74,-118,-86,-19,-119,-52,-88,22,-89,119,71,112,-21,26,52,35,126,65,117,-110,4,47,-66,21,-51,-8,-72,-120,-107,72,85,3,73,72,-27,-36,-114,19,71,-89,-100,-111,116,-97,87,-53,-68,-121,17,-29,-60,-28,116,-64,11,45,-83,-125,-55,71,-3,4,-123,53,42,-122,-45,104,-22,101,81,-24,-37,49,91,-2,-77,44,-72,-64,-100,-80,-75,-26,108,-102,19,-107,-51,-23,-11,-4,118,-18,-18,125,90,-84,41,8,-54,30,21,-91,102,-115,-99,-35,-35,6,24,102,-108,26,-8,39,1,-93,76,124,28,-9,114,-39,9,44,72,-72,-24,67,-41,-3,-58,-92,-31,-57,127,29,36,16,-1,-87,-124,-34,-23,57,118,-38,-19,51,121,15,-44,-2,8,-87,-47,-82,71,-14,-41,16,48,79,118,17,-83,-84,-62,5,-127,-20,-12,28,54,-95,-89,115,124,-18,40,-118,-125,-97,3,15,89,-21,45,-19,23,-58,-1,39,19,-18,-121,127,-46,2,38,-24,-64,-48,81,19,-16,80,-128,-37,123,-43,-73,36,-127,55,121,-62,14,93,56,42,-117,-43,-99,24,-79,-46,-112,-34,-99,38,-19,11,23,-70,-128,-121,-81,-110,88,-76,-53,-51,51,-128,52,54,-80,-58,-35,83,10,20,27,-109,119,112,38,-19,97,120,67,24,51,-65,84,37,112,-8,67,6,-104,-127,-50,118,-1,58,-97,-94,-103,78,10,30,-94,-95,-42,107,-41,-67,-39,63,27,-108,91,21,-88,-23,-118,-55,-28,-1,-9,16,-37,-29,-55,-80,-82,78,-112,62,46,48,-41,1,50,34,12,-53,123,46,1,37,108,71,3,41,-94,-123,-50,-16,-42,8,86,-39,-24,51,119,20,22,-55,115,-82,-86,114,-110,8,-72,-15,74,83,93,14,59,122,3,107,-17,93,51,41,-56,-125,28,-21,38,-59,71,69,-48,111,79,38,-29,-23,0,-17,-110,75,113,87,32,50,4,-113,-4,12,-27,-20,-61,-41,-56,-117,-99,-77,-87,115,-99,40,-99,-95,-31,26,119,-102,-53,2,29,4,-21,-86,112,94,-82,45,-65,23,-23,-85,-17,-97,100,75,116,-110,1,-109,-111,29,80,-90,93,74,3,95,112,-48,-106,-18,25,77,-29,-22,72,-117,94,9,95,113,-1,-104,-124,-28,12,97,-109,66,33,-94,-29,91,-88,-102,77,-76,21,-65,95,51,54,-16,-116,78,78,-79,-107,-51,-123,2,40,49,-124,-90,64,97,-3,-105,14,71,-114,112,124,3,-83,-105,-50,94,35,59,-63,73,120,-43,116,16,-91,-46,-18,-117,-108,-26,84,-84,75,123,-97,-21,-118,-119,72,34,-59,-108,-104,-65,21,70,63,-108,-35,-26,-11,-63,-55,53,-81,-125,-58,-115,-16,-54,59,7,0,-12,-67,126,-72,81,-118,-76,-13,121,5,27,-23,80,87,-125,-14,-85,-37,-6,-79,-56,-118,-19,-45,-43,72,71,-49,-91,31,-121,-90,34,89,-22,116,46,-62,-59,49,-4,12,23,40,-39,88,-54,120,12,34,26,-7,42,-18,-89,-37,67,123,61,-91,74,-36,-38,-104,15,113,46,54,0,28,100,-75,-44,25,-56,103,28,44,-92,-100,34,-113,28,-16,-75,-121,-7,58,38,-99,66,-2,-20,-122,-19,11,110,-58,45,17,-72,38,-45,41,6,64,-86,44,36,91,-45,-93,17,43,-73,-70,-41,52,121,53,-71,-90,14,110,115,29,36,-75,-46,92,97,-53,102,-88,-32,122,53,-39,20,-102,55,-101,117,-26,82,14,46,-91,-120,85,36,-108,101,-81,-26,115,-18,-50,-47,18,7,-125,-24,33,-46,-24,-108,33,-71,41,99,-66,47,-43,-25,10,117,53,-2,-14,10,126,-112,-74,104,-77,-57,-30,24,81,93,69,115,89,10,34,90,88,-116,65,-90,72,43,51,123,-85,55,-12,8,13,10,-37,-90,123,-4,40,109,105,112,64,99,-74,-83,44,104,-20,-16,25,54,-82,-54,-109,64,-37,-3,-17,107,124,14,-64,60,-47,-72,40,-84,-74,89,36,6,-98,-125,63,30,14,-70,-62,109,-38,112,-41,127,52,115,-56,27,-112,76,-65,-107,-118,26,-53,-74,-96,114,78,-120,24,77,60,48,29,49,-15,-117,-91,1,58,-26,-84,-9,-115,-109,-89,-21,104,82,36,116,121,-103,93,-50,-103,-39,37,52,-28,-108,49,-87,-93,-115,38,-37,-28,-68,14,-26,19,-41,107,-2,-37,-107,-49,11,-120,17,24,24,-100,-110,93,46,-122,-84,38,6,-7,-53,98,102,35,65,-8,-6,-99,44,86,-5,-4,67,-65,13,23,66,-111,24,7,19,9,-92,114,29,58,-43,-61,-105,-33,34,-26,-57,5,-11,48,77,0,-41,22,-49,-20,-44,-99,-30,10,45,-51,47,-29,20,-61,-11,104,99,21,-15,-67,44,108,-71,-83,-11,57,-104,39,-84,122,2,14,127,5,-110,-79,98,23,95,89,3,-87,68,94,-9,104,40,107,24,26,-97,-36,-111,-100,-95,31,-97,77,49,-69,112,-111,-96,-45,89,127,-9,114,85,-5,-102,16,-1,31,-53,-69,-53,-6,113,84,-6,62,-18,-44,-73,-15,68,-105,-36,127,12,-27,-28,-42,-31,51,-121,-19,86,-111,-86,93,-119,-74,67,51,32,73,35,18,-106,70,44,-82,72,50,-19,98,-45,-60,-84,-84,-67,-126,-5,-67,38,-2,-62,-23,-54,-110,113,-89,-14,52,28,11,-61,4,70,-35,-100,0,-46,-11,-124,49,118,-80,39,-70,-100,-54,-120,-69,102,39,59,16,-49,-50,53,-27,44,-115,90,69,-102,65,-113,20,-47,-115,59,127,-19,-19,-54,-27,-28,39,-94,65,-114,75,-115,-46,-85,-4,75,-67,127,-98,27,-42,1,-43,-124,22,-21,-74,-27,53,-45,127,-90,-83,-44,-23,-86,10,36,59,86,99,-126,-59,108,-99,-45,91,-16,-33,110,106,-120,-87,19,115,122,-86,85,-83,67,-4,-57,4,-111,-5,-58,-2,-91,95,11,107,-53,-68,-128,-12,-68,85,19,-40,-36,-56,10,58,-64,-12,-32,20,79,37,-65,-9,-33,88,123,94,114,31,67,-2,-32,86,-124,-62,-116,-100,41,35,-17,-81,67,-85,-110,83,45,5,-121,-120,-3,14,47,-65,-78,-87,-114,-9,-19,-7,-21,106,74,-40,117,78,-33,61,63,-70,26,-9,56,76,-121,-77,14,87,-125,-32,69,-101,50,104,30,-59,-117,80,43,-98,-11,-23,-94,-108,52,97,-38,24,-10,125,-41,-119,-19,-56,-42,25,65,-39,7,-102,-4,109,110,74,18,-126,13,96,95,99,-89,15,-3,6,106,72,35,-78,82,-15,73,61,116,-127,-83,98,54,-17,2,88,-7,-57,-37,-102,-39,-79,31,111,-6,-62,-24,69,103,74,113,65,-15,68,37,123,-65,94,117,-32,-121,-78,-5,59,120,104,60,5,68,-65,4,-85,64,-80,117,61,-101,46,-88,-123,69,-19,-57,97,-15,125,54,84,-23,-124,-27,-47,114,16,104,44,-100,-87,36,81,-27,-20,-73,95,-80,-64,-34,-77,29,66,-126,-120,77,105,-100,44,79,116,-18,-27,-15,-71,19,-80,12,-18,27,-92,45,116,-27,14,-14,-77,1,-110,-40,-26,-4,-88,-120,60,51,-101,108,-123,116,111,-83,1,-74,87,-69,11,124,93,2,-64,121,62,-45,-79,110,-55,-37,97,27,-79,110,-91,67,53,99,26,-74,98,43,9,-43,80,-103,-23,60,-36,68,-112,-64,20,-31,-52,-79,-113,-7,94,-30,73,-100,55,-111,87,-1,-29,-25,42,-94,-13,-63,108,-59,38,-16,-85,-62,-17,0,47,-90,116,-80,-11,12,-54,96,-110,-12,-6,-128,-31,-64,-109,103,-11,58,-118,-3,-102,0,64,39,-67,-18,93,95,-87,102,104,88,-31,-62,-36,-61,-105,-26,46,-53,93,117,-70,-54,121,-103,52,-24,-10,82,-124,-22,29,-122,84,-76,-64,121,-65,-6,52,80,-27,7,-118,108,64,-82,73,-44,81,-107,-88,84,-100,-59,9,-56,35,-39,-68,-82,26,65,-73,-66,-15,75,-44,-31,51,-65,-62,-73,100,51,-51,78,-112,-84,-19,82,93,-92,53,-69,-38,-66,5,127,-30,61,43,26,48,-63,31,24,-71,-67,-60,-127,-55,-26,-43,38,-63,-49,-101,-37,116,105,10,-109,3,-67,-42,17,-89,110,-103,62,-41,78,-59,-47,-47,-17,10,-51,-16,-31,-41,68,37,15,94,-123,101,77,-122,116,61,-96,-8,-122,-11,105,109,-74,-97,-111,44,114,105,45,-94,42,-99,-52,-113,122,87,-59,85,-109,-128,120,21,-49,-75,-89,11,-10,120,-51,30,-19,-79,-26,-32,64,-71,28,-44,-11,55,-28,59,109,-84,-22,-113,-55,-105,114,50,80,-26,77,36,54,42,-71,-111,-64,118,99,-100,-121,-128,56,-10,-75,-74,30,93,36,-122,16,-105,-50,85,19,-99,-84,-72,-20,-63,96,75,-53,-86,59,90,-23,-73,-39,96,-118,-9,-127,-106,42,-122,-84,108,-18,29,81,-58,46,12,94,-2,-94,33,-75,85,61,122,-100,2,101,45,106,-49,-43,22,-63,-128,94,-115,5,38,35,-8,54,15,35,-114,87,-76,110,-50,37,20,-114,115,84,-13,48,14,54,-58,-93,43,112,77,9,-99,32,-91,-55,-82,34,23,-40,62,17,66,84,-3,82,117,-100,32,33,19,-100,93,102,101,-33,112,-103,-38,114,-1,38,-89,-90,-9,-86,-101,-66,-71,41,-113,5,-40,21,50,89,123,-73,5,45,68,-75,58,-107,3,-67,-64,89,-117,45,51,16,36,-119,69,-78,94,-18,-18,61,-124,22,97,-55,112,-97,19,119,65,7,-109,23,88,-15,-47,-103,-62,-84,106,-5,73,-108,-109,34,33,-116,81,-41,81,-102,67,20,-46,67,-40,-9,-49,10,121,-57,-33,61,28,42,-67,-36,-113,-38,-89,-94,-67,-28,52,-17,-116,-96,117,-51,29,-84,-38,-53,-53,-44,-110,54,98,-76,18,117,83,10,-36,-62,102,104,124,80,34,15,47,108,91,-112,-116,-10,66,-68,55,-123,-67,87,74,51,-47,25,-34,-122,57,32,-96,96,-64,67,31,-41,-124,-87,76,-15,-125,1,13,-77,99,47,74,-44,97,67,108,-4,-9,-16,36,44,-53,3,105,-120,99,-55,-30,-34,118,8,40,106,-95,-122,14,-65,-23,86,-64,-26,114,89,97,-59,-10,71,-108,10,-60,61,-87,-19,-4,-28,-32,-1,35,-123,109,55,-47,-126,-124,-1,-36,120,-107,3,-17,121,31,-80,25,79,127,-32,-19,103,118,-4,21,-55,125,70,-95,-104,-2,-78,-24,90,97,-33,-79,-92,126,20,49,60,41,121,56,120,-102,113,74,1,44,-28,46,-19,100,-46,-127,77,-8,-64,-12,-13,-15,11,89,22,86,-95,36,-105,84,110,-83,37,-56,-40,-92,19,-17,-82,-25,83,4,33,-111,76,-54,-85,35,-107,127,-72,76,89,-123,-103,28,-96,95,-47,77,107,-98,-35,52,59,75,-76,87,-14,-27,-56,75,117,67,-34,91,-92,-45,-95,-116,-13,5,-81,-35,83,85,10,-112,-38,89,117,43,123,-43,-73,104,36,-80,-106,47,113,51,-82,36,93,-84,33,11,-53,-84,-128,82,-86,0,-118,-33,-6,-122,44,35,81,-44,-71,-73,-64,98,126,-20,-49,-104,-126,46,44,-17,-63,-62,-74,-48,-61,-28,67,-99,-25,92,66,-38,73,49,45,92,-69,-26,-91,105,80,-30,48,85,-76,108,-98,-95,-56,102,47,-70,6,-118,-31,-112,60,-62,89,-78,115,-85,4,-1,36,72,-17,-56,-100,-2,-104,-54,24,-56,-92,-60,-106,-115,-53,49,-106,85,33,54,-79,-77,44,47,-120,41,-60,-8,44,-28,5,114,90,42,74,-57,106,-81,79,-67,83,-97,-90,-16,-120,-57,-88,9,34,7,-107,-92,-59,40,71,113,-32,-85,89,89,33,-58,-78,-22,-50,58,96,-19,66,-125,-39,90,-42,25,70,-31,-104,-90,-21,118,98,-111,102,44,-35,-117,60,-62,86,-47,-4,-88,14,46,79,-81,6,-5,101,-12,99,96,43,42,-27,65,-3,-93,-120,112,32,-111,-6,89,105,-67,122,50,57,-126,-54,-46,35,-41,48,0,-98,-22,71,45,-125,81,7,-26,23,118,-60,25,101,-128,-95,117,22,-29,-126,74,86,-53,-39,65,-86,-62,64,-77,-8,-85,90,54,-28,124,-128,-1,-112,105,127,-124,-40,123,63,123,-77,-84,13,-5,53,-46,-31,-74,-36,-16,27,13,-124,-24,-98,-115,-83,101,48,92,13,-5,-98,-111,-10,-51,-40,-115,-81,-82,-52,24,102,98,97,109,107,-1,-46,109,50,40,-48,-23,71,-70,34,-13,-111,43,110,-41,-9,-1,108,37,45,-28,-72,-45,-50,121,9,-66,-4,-10,-86,18,16,-119,64,-36,33,5,-13,-125,93,19,-6,-61,126,48,95,-116,11,-62,125,-6,67,111,-1,-54,2,82,45,-103,-4,19,-66,20,18,48,15,94,-91,33,119,82,-15,-24,116,15,67,30,111,-106,90,80,13,-20,71,66,65,108,124,-104,-94,-124,120,59,-95,-80,16,-101,83,90,14,25,-96,-64,-38,-24,98,-17,-69,108,-89,-29,-30,-11,-101,99,13,53,-56,72,52,105,105,88,2,75,26,23,-13,122,3,-114,71,-29,-70,-9,-98,67,58,-122,87,7,126,-30,111,69,-61,7,11,103,-6,-6,-16,56,-32,23,94,29,-31,-63,-47,67,5,61,110,57,43,54,41,74,28,-65,97,74,-22,-115,-126,0,86,-50,-83,-3,-93,116,5,-29,22,21,-79,-54,34,68,77,-76,-34,84,-116,-31,-102,-13,-55,85,64,-42,44,-115,43,85,100,-60,-104,103,-54,120,-65,-69,44,-102,59,107,81,-79,89,-44,121,-24,70,-110,51,75,76,117,-7,61,110,-102,42,-28,-28,-67,-12,102,-19,-27,18,121,115,-46,68,-81,-124,-110,-33,56,108,-83,30,4,-97,-79,-17,114,88,-86,105,-9,17,0,61,11,101,7,14,58,-100,-38,-42,121,27,119,-48,62,56,94,39,-49,-20,7,26,-99,108,-44,120,87,-2,-117,-78,64,-56,76,-83,-105,26,21,-3,8,81,-74,-100,50,67,9,58,-118,-14,-96,-13,65,27,-122,-73,102,-83,-40,-60,-13,-120,16,51,112,-51,-81,-15,127,-7,100,-116,83,-20,-72,59,121,-39,-43,114,97,55,-9,-53,56,107,45,49,-102,106,-126,-54,59,-44,18,-64,101,-75,62,-123,-70,-110,-17,24,-44,57,-122,104,43,-119,-40,18,-107,-113,25,122,-19,-90,123,74,-35,-86,107,102,-22,-51,56,-14,-100,109,-124,1,35,-85,-16,-124,-65,-21,1,30,55,-75,67,-121,109,-78,-102,82,-23,-94,-60,46,0,-104,-96,6,12,39,101,62,37,-39,-84,-92,48,3,68,34,26,-47,-67,60,25,-2,118,-110,91,77,46,2,103,43,-85,-107,83,-23,-23,-71,-7,-110,42,43,16,-82,57,-55,-52,-102,-32,32,-70,-111,75,116,-11,116,-44,-75,-14,1,-123,-128,31,-85,71,33,-72,78,-102,70,-72,48,-15,60,38,56,79,93,114,-83,75,-6,-78,120,25,-127,112,82,-37,-90,-121,-92,-112,-35,8,119,-32,-35,58,77,-9,109,69,-107,-21,11,-128,-42,-70,48,-30,-23,-78,-81,30,-123,-40,-8,106,-127,9,64,-51,-78,122,95,-109,81,-15,-43,27,118,-92,88,37,-109,-106,52,-8,-62,119,-45,65,73,127,-96,-115,53,-125,46,47,89,115,8,71,70,-40,-107,24,15,-119,-64,115,41,54,-11,-103,-108,-20,6,104,-67,-8,95,102,90,19,15,73,-22,13,-7,55,113,-53,-123,-110,51,40,37,-83,-103,-61,34,59,114,-25,-113,-103,87,-26,-10,-121,88,-65,-79,-63,92,123,-62,31,59,-87,-11,113,31,14,88,25,23,35,-49,-83,-21,-59,53,-72,109,-22,-64,59,89,-104,-42,52,24,-60,62,3,91,7,-21,15,61,-117,-109,-1,65,-39,25,-37,-34,26,-2,-51,62,61,24,-15,50,-32,-48,25,-55,36,24,99,6,94,-25,-84,86,-30,-95,-94,-102,-53,29,65,-81,69,-85,117,65,-7,0,-66,-23,-75,127,-108,62,10,-5,66,-4,29,-59,-82,41,-55,58,9,65,-128,55,-58,-67,-28,123,99,-121,-70,-99,-6,11,122,-108,-18,119,1,78,103,61,121,-104,-68,117,-22,-108,31,64,-68,-68,-96,52,41,58,11,-54,-26,118,14,75,-54,21,60,-119,-66,-19,11,-64,-5,76,-97,-9,81,-126,62,72,-115,64,117,23,65,73,-87,-121,-40,-48,90,-82,73,-91,57,42,-53,54,-11,6,102,-104,-117,0,70,52,-56,103,104,-1,-12,-103,32,59,12,123,-75,-104,-123,16,31,-35,20,55,-116,-109,-44,-50,-63,24,76,35,-116,-29,16,-32,-43,-68,-115,-56,32,109,-34,-9,126,-39,74,-74,-46,-19,-82,-105,-115,32,94,17,105,-103,68,-50,-121,-29,53,-7,74,77,98,-123,-68,37,-8,62,-21,-23,4,-99,-80,-103,45,-58,-2,-95,5,58,35,19,-65,-37,108,-14,35,-90,-53,-123,-5,28,39,-21,17,-38,70,-53,94,30,62,24,34,-74,14,101,20,46,-61,94,125,-121,-122,88,36,-127,-97,-98,80,110,80,14,10,72,8,95,50,4,113,27,54,-124,-117,-48,-39,122,52,8,61,94,40,-69,-34,21,7,-56,-123,-90,24,23,89,57,-87,-97,-16,-80,63,-50,-118,76,-25,-17,24,90,-4,-112,-94,32,58,-32,11,-12,28,48,118,-38,-69,107,61,92,-104,116,-112,-62,55,-110,127,0,-46,-54,17,-57,116,54,-90,-36,114,-39,53,-32,33,-69,72,37,-70,121,-84,60,22,-95,-105,-74,-7,-67,-49,-41,55,98,60,-57,-51,-107,48,31,48,-72,-35,-38,-5,29,-102,65,78,79,71,-8,-113,122,76,90,-55,-31,102,77,-66,107,112,-128,101,122,-83,-62,111,126,-75,101,-55,-118,52,68,-128,115,63,76,32,-6,6,90,100,-109,98,-59,19,109,114,-1,84,-58,79,-52,95,121,-77,114,-52,56,-13,-114,67,91,50,-51,-94,-115,113,-58,-33,56,-92,55,-120,80,-125,-85,126,-114,-126,44,22,-29,-82,113,-92,91,-39,63,-34,-90,43,-21,-3,113,-81,-5,-91,69,-59,120,-126,127,43,66,113,-111,-99,47,-46,-73,-13,55,-7,73,37,110,-76,68,105,13,94,-36,10,108,-127,-76,126,10,100,21,-80,-117,21,-95,-79,94,77,-72,98,-63,24,93,7,-124,25,-15,-62,84,-99,28,-99,-82,113,-65,62,13,-51,-117,115,37,-125,-40,85,-96,70,31,26,-27,2,57,43,-15,-112,-36,-5,-72,106,44,-97,126,111,-31,-89,-66,76,-114,-111,51,120,69,-106,56,-70,1,-54,105,-56,-8,-92,-123,-71,40,-52,-20,-93,-102,-104,76,48,77,-30,76,53,-113,-16,40,88,44,-107,34,53,18,-21,95,123,-115,53,-28,21,47,82,76,-58,-114,-104,22,-97,-90,109,73,7,-108,-30,-96,89,-84,-47,-46,-62,110,25,-128,-54,-75,-62,55,121,42,-62,69,54,25,-75,7,122,87,88,-68,-83,-95,-100,38,-103,-96,74,-57,109,-34,51,72,86,89,120,66,85,18,95,-84,101,-86,15,-32,48,-104,-99,62,115,43,76,-14,76,-92,27,-5,-8,41,-74,-114,50,-77,-97,-67,-109,16,-36,106,-52,85,50,16,-68,-27,-99,-22,-112,122,-15,63,64,23,121,23,54,-31,126,64,76,16,18,-57,-75,97,-94,-23,-94,72,-40,-53,30,-55,87,-63,-13,116,-64,9,-72,11,-45,-90,11,59,110,44,28,-105,62,-80,-27,20,-7,46,45,57,35,5,126,29,-91,77,-65,-60,-56,10,-115,-42,115,-17,-67,34,12,56,39,-119,-20,-66,22,-39,54,-102,108,1,107,-75,14,-104,-127,-87,-17,-88,103,33,-71,-85,-76,23,-95,-94,-102,107,92,-96,61,121,-98,78,-33,-28,33,75,-10,32,-14,-125,-72,-96,-4,10,-65,7,-52,-27,92,-71,100,61,87,45,9,-43,110,-52,-70,19,45,-110,-66,-74,91,-126,-27,106,-110,58,114,-86,-52,-77,-63,-50,-65,67,-54,33,116,37,64,49,-7,76,-115,22,-124,-105,50,19,-126,81,86,124,-37,-5,-48,19,32,-65,-21,80,-93,-124,-23,-25,24,16,97,65,51,29,56,-79,-117,80,-50,14,-77,-23,87,96,-52,125,49,2,55,13,61,107,-106,93,-116,102,-37,-11,-23,-119,53,-43,-39,-86,-96,0,19,13,15,15,112,24,-73,76,79,-76,99,-127,90,-18,119,63,3,-29,111,38,34,-66,-34,111,31,-29,24,-95,-70,5,65,-15,86,-43,16,76,-127,-120,6,21,-29,97,-31,53,-57,-39,83,-117,-48,-99,126,38,56,-78,67,-18,43,72,-96,100,-37,109,-92,89,94,-88,36,121,112,-33,-69,-42,-99,112,-80,116,-42,49,20,5,124,26,26,-32,-118,-28,22,65,13,-105,81,-98,124,40,-76,52,-104,97,59,82,96,-99,-46,-27,-74,-125,-36,64,-31,114,-83,-28,-61,81,8,-81,-49,42,48,36,-81,12,-80,68,83,38,-115,-46,93,-86,62,-56,-52,-36,7,-88,-85,-80,38,5,-106,-8,-125,-94,-81,123,122,21,-112,45,-37,116,81,48,93,-122,32,-120,-28,48,-85,-99,-47,50,-67,-109,-14,78,-79,10,56,-98,41,-22,10,-20,74,94,-120,-30,110,50,86,74,91,51,43,-86,-44,11,65,-11,127,-97,-31,-24,119,-16,-66,-73,87,-95,-64,109,98,-127,-30,45,24,-11,54,61,76,109,126,24,45,-1,64,-24,-28,28,114,-113,-32,-103,122,-125,95,102,-7,-33,-25,-28,-7,-101,63,109,-9,111,-45,73,-41,-111,-48,-70,-113,-40,28,-32,-95,-41,76,33,-53,-112,-106,75,71,117,-94,81,19,19,53,96,125,-9,-82,40,85,6,65,36,-91,68,59,9,91,65,-67,-34,65,121,125,-25,-107,-38,-106,-122,20,-83,109,45,-103,122,-31,-42,-42,84,23,-57,49,-69,27,41,78,-116,3,-65,59,-28,-52,-101,-91,-29,-29,37,113,86,119,-51,-19,-104,-84,42,90,-113,125,-32,37,65,-21,119,126,11,-13,-37,59,-49,-80,60,90,-114,7,-117,-84,-22,-50,4,58,69,-93,106,-77,110,-46,125,78,93,-124,-20,-42,73,75,-60,-59,-52,80,-5,6,-105,-14,-58,-59,-72,34,59,-46,-96,-102,76,105,-8,-49,-79,-81,-47,-94,93,-100,77,-119,-115,-102,-115,-68,69,-126,107,-86,-103,91,83,-26,-42,73,-84,-54,5,-85,-104,-61,-28,22,100,-71,-126,-43,97,-128,38,88,41,112,94,-84,39,-55,-119,36,-115,60,107,87,1,-45,-114,-9,-80,88,-105,-67,-91,90,-111,-96,95,-113,-103,-24,-70,91,-113,-70,-122,-83,-92,-20,121,117,37,-105,-10,126,82,81,89,-2,-118,36,-21,-9,-85,124,-103,65,-6,118,-45,-33,-5,-113,122,124,87,58,-30,-47,-43,54,-10,-116,88,-17,44,29,94,-106,-59,41,54,-86,101,98,-116,106,-12,-12,95,13,-29,-103,72,55,-73,6,122,-106,124,79,54,-93,17,7,-101,69,-72,-102,-43,31,71,-44,92,37,28,-104,127,54,-7,-50,-74,-35,-125,-16,-119,28,-17,-44,122,63,117,92,-23,82,14,-28,122,-38,-90,26,88,-74,22,127,115,111,-128,61,-41,-104,-9,31,112,37,29,53,-3,58,52,-27,66,-76,-73,27,78,92,-33,-125,39,110,95,-96,-61,-125,-16,80,-107,101,44,63,114,47,-101,-47,124,21,-31,-99,-57,24,46,-24,18,121,-104,68,-113,37,-76,-71,102,-10,59,-124,112,123,121,91,78,-17,-14,32,-82,49,2,102,-47,-83,-30,-19,-3,67,-50,-42,41,-92,-21,-72,117,-111,-74,97,26,-26,18,-78,104,41,67,48,122,108,-19,105,64,-111,-45,-45,43,-80,-66,115,84,81,-36,-31,59,60,28,-10,125,72,30,-64,105,52,45,-74,11,38,-16,-118,-3,-46,98,-77,40,70,-69,-114,-77,-70,60,123,83,-102,-80,42,100,109,81,-77,115,7,-127,-87,-22,-48,8,57,-72,-41,-41,-9,3,-54,80,-30,103,-54,-16,118,105,-37,-87,22,71,-48,-33,121,62,-90,116,66,-38,-105,22,19,-21,-41,83,112,-39,-28,-81,-109,31,-125,-95,-1,54,-84,72,-108,112,89,-114,120,-73,110,20,-55,-126,-93,-58,68,-105,-107,65,122,8,-103,121,-97,61,-74,97,99,-65,1,46,7,57,69,-122,100,-112,94,-94,116,23,85,106,-105,79,-108,-128,39,-111,83,-87,-66,112,-102,24,-7,-72,-78,-97,-8,99,-113,-114,79,115,-51,89,-88,83,-90,28,56,113,-102,57,40,-104,-76,89,-8,38,-5,-67,-9,-18,38,-121,27,-25,-110,-29,3,-10,123,16,-40,-93,-36,116,-20,-73,-111,-18,87,-123,120,113,-121,-97,-47,69,105,-68,-97,-111,-53,-94,114,-81,77,92,-37,46,-80,-18,-9,108,-69,-25,-46,27,-101,-86,54,53,-109,-44,85,-11,-61,-87,34,-17,-25,79,-46,101,-22,-30,85,99,-65,-30,117,12,-80,-23,-16,54,106,-89,-120,-29,64,1,-94,-111,-75,82,-3,68,120,11,-103,-52,87,22,-46,-17,-117,-63,12,112,-123,-52,-121,71,-122,-55,101,-125,-41,105,-53,52,-9,60,-3,56,-1,85,15,-112,127,70,-7,4,48,-72,-29,34,11,-103,-46,114,56,-109,-32,17,9,89,-1,114,92,86,11,-55,-87,-80,-18,53,-4,42,86,-90,15,-50,120,49,-46,22,57,67,-59,90,110,-97,96,119,100,43,-90,-54,81,-89,21,-80,64,-14,-47,126,92,-17,-37,51,121,40,-34,110,-54,-99,36,-73,-43,85,52,-30,121,-9,-18,-51,91,102,-116,-71,86,95,-55,95,-35,74,118,101,-114,87,20,-48,-60,117,-76,55,-108,49,74,-22,20,-43,41,79,114,-96,-12,-68,43,-44,126,-28,83,19,111,-128,-19,102,-110,56,-77,71,89,17,-26,-16,32,-27,-14,-127,-37,62,-107,-34,126,110,74,104,6,85,8,79,-74,107,126,30,-52,80,29,-11,108,65,29,-128,109,-2,59,123,28,-107,62,110,110,-123,71,-68,-39,-20,-108,-57,38,-36,-12,126,100,112,-32,-103,55,98,-82,-5,89,-41,36,88,-92,99,118,-56,97,12,-16,113,88,71,-96,76,-77,117,60,-5,-84,23,-41,45,31,46,0,33,-3,69,4,38,-119,-20,96,-115,-50,28,-38,-9,85,-113,36,-106,3,-96,-23,-80,7,-19,-111,101,92,-107,116,-9,53,-120,-3,5,-13,-87,-115,1,-35,-125,-23,-89,19,53,117,69,-67,-107,-122,-33,-32,-10,-122,-69,75,-116,-35,-69,43,-74,109,-107,18,107,-48,-85,52,-38,50,83,115,-101,5,-39,62,-7,99,-46,97,44,78,31,27,105,-72,-117,-94,-69,-86,108,-59,-30,-48,49,-22,-124,-114,-2,-19,-126,-122,-29,-21,67,60,15,-111,-55,-22,35,81,37,-75,32,0,56,47,-18,108,41,-120,0,122,-4,51,95,-68,-20,125,78,77,119,-115,-9,109,59,-128,79,-124,-114,7,9,91,-8,11,-80,-112,29,-56,-32,11,-50,29,-82,74,-19,-6,-55,12,-115,18,-6,15,-123,-15,72,-62,12,43,1,82,-30,2,-17,26,-30,58,-85,63,-56,-100,-117,52,-90,-69,7,-26,121,111,-92,5,-61,-90,96,63,-18,60,-11,-52,-81,125,99,25,67,82,-71,110,97,122,51,39,33,93,28,-116,123,48,-107,-64,-9,-31,92,-62,-68,-103,-102,-107,48,-2,-100,83,127,41,-82,-105,-7,113,-120,10,58,-122,23,84,-18,20,-37,-82,11,46,42,-95,16,-58,-105,-78,62,-57,-82,39,-18,0,106,52,-51,36,-59,76,98,-108,124,-67,-40,-3,73,19,45,121,-45,20,76,-21,0,-57,46,-18,90,79,66,-56,-42,-47,-39,90,-120,79,103,34,-104,-30,-67,94,120,35,59,-41,25,-128,125,88,88,68,-48,-47,-25,-10,-12,92,125,20,-99,66,55,118,-42,46,114,67,-9,37,43,119,-84,79,-8,-21,123,48,82,76,-63,-23,-17,27,-108,97,53,95,-109,68,41,-50,-32,-119,-20,-71,80,-9,-57,-16,-4,17,-36,66,19,-113,82,-76,39,-128,23,47,9,30,-87,-35,-48,96,100,15,-4,-86,-58,-10,-1,83,-52,17,-102,37,-88,-13,-2,-23,-92,-52,-89,-33,-112,-47,60,122,28,-101,-99,92,-67,-88,77,101,118,-96,-123,-108,-108,-43,102,44,45,-48,84,-25,110,-74,86,-7,50,-109,-9,59,-92,-67,79,23,29,53,-57,-89,73,9,1,65,81,17,31,8,-107,92,126,-119,53,52,98,-126,60,-82,15,-15,79,110,111,22,-82,88,-110,-49,-113,-124,-127,-51,88,-48,-87,-17,-55,62,45,41,64,-111,-95,-122,-46,-91,116,-55,-125,103,75,95,-29,-56,29,-36,-115,-41,-56,-100,88,-81,-33,29,-81,-11,-90,77,-17,-10,-127,-6,-121,30,-4,30,-24,-124,109,67,112,25,-57,34,4,79,126,-109,126,-47,-101,-9,-38,117,-76,-43,37,-120,-86,85,54,-70,56,-15,39,-40,-80,3,26,-64,-45,-69,-35,-120,70,24,-97,-29,-53,19,69,-113,-112,-78,-53,-106,-74,-61,94,78,-57,97,-58,46,58,-21,62,-121,-97,-16,-38,35,35,-127,-120,125,2,54,-30,-44,-17,30,9,-20,30,117,-53,52,29,95,-92,16,60,-29,102,54,-66,122,-110,10,-113,68,-78,-120,-71,111,-96,-37,9,-11,39,111,-52,107,-25,-77,-9,81,28,0,-55,43,-98,-97,-37,-123,69,-4,23,-98,102,106,-11,-42,98,5,115,-121,-84,-86,-78,-69,11,34,-115,-94,3,-104,-9,51,-38,-113,29,-39,83,86,54,-116,-27,-108,61,10,27,-44,65,-91,-86,34,-40,99,38,-14,101,126,-82,-56,-8,37,-102,-52,102,126,-36,74,95,113,-83,-37,-66,-20,-55,-98,-115,-49,96,-44,-123,20,-1,75,-2,10,-90,-61,107,87,94,-63,74,-55,0,2,41,-123,-103,-85,-13,-107,-39,36,-47,6,-21,-70,98,78,-119,52,26,8,-40,72,117,115,-78,76,-57,-60,43,-25,-87,83,36,54,127,-78,127,19,98,125,-30,86,121,62,124,-32,-96,20,-110,97,-126,13,-104,6,-122,36,-105,55,105,-48,-121,-83,0,18,-113,-114,-39,20,9,-20,-23,-49,-115,83,-107,70,121,-30,86,-48,31,-23,125,-114,-67,48,-86,-90,21,83,-79,-107,64,-60,-91,69,54,-73,-77,99,88,-10,15,57,-29,-128,-47,101,-96,-50,112,-85,120,-16,-78,7,27,116,-128,-11,18,49,-19,-33,41,15,-35,84,-67,-15,-57,-73,36,41,15,9,77,83,39,27,-54,-82,33,4,115,-60,101,-117,46,-56,-18,100,74,126,-27,-25,-48,10,-51,-41,126,-81,-95,9,-60,85,99,80,-6,-16,27,108,77,44,46,114,-26,20,-69,15,92,98,107,-59,-114,-87,28,-121,-61,84,125,-125,-44,-13,116,-120,-55,94,-84,-86,-75,34,1,121,-25,-80,26,43,-97,-12,31,-58,75,84,2,-109,12,-61,-68,110,-21,92,-27,13,-117,36,21,107,-3,-125,80,87,45,-108,22,-61,41,75,-115,29,-29,33,-111,-4,-22,-94,8,24,97,-124,25,-52,25,-7,-74,-36,108,-114,12,3,-32,84,75,34,-60,-88,-10,96,84,12,17,114,-119,-41,41,-48,-3,-16,1,21,-14,-115,-11,-25,96,-36,10,-71,-14,-3,-83,6,85,-91,-18,-108,81,36,-33,70,-59,-80,-81,-31,11,19,74,-22,107,91,8,57,29,-95,-80,61,-40,-82,-110,97,122,-114,-102,-77,123,83,122,46,-24,-121,-28,111,18,-47,-35,-102,-120,114,-93,22,115,-82,113,77,-78,76,-66,65,117,28,86,82,27,79,-128,119,-88,63,-31,11,87,124,-10,-71,-99,94,-89,-82,76,-124,101,-53,58,-74,9,-50,-114,31,-3,-119,-51,57,-29,92,-75,113,-47,-103,40,-81,-43,-100,-12,-102,4,12,-36,-26,-70,27,-118,-88,50,-73,28,-113,-94,122,-1,4,-57,124,-126,100,70,-87,62,7,-91,-91,100,-102,-56,102,34,118,44,-90,-47,24,-32,30,-99,-98,36,113,-124,11,-126,-84,-15,72,117,3,-46,-18,97,-73,-38,24,-47,-4,109,-50,-86,-112,88,-97,-65,-73,112,72,-37,-125,20,-29,-43,-2,51,-16,94,58,119,-101,-48,121,-116,94,103,52,64,48,51,-70,-113,106,41,82,-44,111,-106,-62,71,-105,-66,78,-78,71,115,-50,-123,4,33,88,22,-40,-111,-46,-82,-34,-67,-58,120,-28,-18,-52,-126,-31,-109,11,84,-94,10,-15,94,-89,-106,125,-62,-6,98,62,-39,-11,-34,12,12,-18,-50,-78,-60,43,104,50,36,-62,-58,-36,-14,-104,-88,78,21,-18,43,-118,-124,-68,-35,-62,52,102,18,87,25,-106,-78,29,74,127,98,-2,-99,-86,37,80,6,-31,86,112,77,-51,121,-126,70,7,35,3,-85,-24,-78,114,-109,-25,-58,120,-127,-78,26,-100,8,-116,10,-20,-23,14,-18,120,42,-75,79,44,60,-58,102,69,-104,25,119,103,28,-70,22,26,25,124,3,-15,-11,10,87,-23,120,-68,-44,93,7,9,-8,-15,125,-79,-70,15,108,-66,-90,-5,-82,-14,115,-75,-122,74,127,108,-100,4,58,-106,66,-117,1,11,6,-69,-96,-65,55,-8,102,-41,-72,75,76,16,-2,-10,78,59,-42,-72,-1,-31,-100,113,26,-66,48,-4,103,57,71,-94,-2,14,-28,-36,22,-8,-25,39,-51,25,99,91,70,63,11,-124,69,46,-34,-21,99,-70,-110,-90,32,116,34,-74,82,43,-104,-56,31,-117,-43,67,12,-72,115,-84,-62,-9,21,-30,105,82,94,86,12,40,-47,-39,40,-114,-67,-89,-72,-64,-62,-124,-105,32,95,-124,-41,-14,48,26,8,-116,-57,24,-45,-45,-75,-40,-111,-118,107,116,66,-97,-57,-79,-96,-85,-55,49,-55,-32,-87,-76,-12,42,-85,85,-16,75,-41,-112,49,-29,-28,-124,-10,-60,62,-2,-112,15,-36,-33,81,-95,117,120,51,99,-64,30,11,106,-21,-42,43,-59,51,117,12,45,3,-116,110,88,104,60,67,102,-74,108,80,-58,-108,28,38,-108,16,63,100,-24,-36,-1,70,97,7,32,118,-112,-122,-31,-36,106,10,115,-89,35,58,-15,-5,63,19,-123,-99,-11,-94,108,-18,-13,70,-12,-1,126,-15,-9,-25,113,111,66,-59,81,-88,-114,97,-121,-76,16,8,72,62,3,-107,106,-43,92,-91,63,60,-90,-61,96,-9,93,-24,-17,-22,38,-24,29,-27,-36,-25,117,99,-10,76,66,-77,-71,33,-87,100,48,-13,-122,-49,56,-104,72,72,-84,103,72,115,-10,45,19,-22,52,-97,-77,-107,50,-81,-93,-79,102,-71,46,73,6,-21,-52,5,-96,32,112,15,-44,-4,110,5,-26,-85,89,-87,35,73,-17,59,-95,-5,-123,94,127,-83,9,-122,-64,-58,-72,-111,33,-91,-82,56,63,1,6,-67,-106,-55,26,-12,-105,-32,115,-38,-95,118,117,67,-17,95,99,120,-75,2,28,-113,-105,117,-15,111,22,-46,116,25,-91,40,44,84,37,-4,-66,-125,15,69,-14,49,-12,-11,87,-68,20,91,110,117,125,-65,-34,-36,84,-29,-87,-27,60,-66,-118,-125,49,69,81,54,7,-119,53,-23,-60,-9,22,-116,-125,-58}
 
 #define IP4_WEIGHT_Q15 {18,-12,-44,78,104,-34,61,92,-120,-75,40,-19,29,-80,-56,21,60,-92,107,-118,58,-104,94,47,62,106,11,-105,-6,-20,-32,24,43,43,-116,48,53,-86,-50,-38,-108,-80,0,-73,-5,115,-26,111,78,76,-101,-55,94,39,-61,118,94,13,-20,-81,100,70,-111,94,-125,63,71,-121,-70,-69,-14,-74,54,-121,60,107,-121,-106,51,-38,-61,26,110,103,-43,94,-116,111,60,-125,-28,88,83,120,62,-39,-79,112,-85,34,121,-93,-121,97,-45,-97,-90,12,-97,90,109,-45,-59,-100,-105,-21,0,-26,-122,-37,28,35,-10,-115,-87,6,-62,108,-15,26,118,-84,-26,1,-74,73,-41,-65,97,86,94,67,34,59,-99,106,-67,-80,-26,-71,-21,-20,115,109,-43,-107,-21,64,37,-2,-20,-75,115,108,53,35,-102,45,83,-106,-49,-59,-46,-102,121,-41,51,-55,22,19,-58,-103,-116,80,25,-126,122,-76,-7,-34,-2,110,15,-46,82,-16,15,-19,-52,-39,-73,62,93,67,117,-27,62,-12,-89,-15,-100,-57,59,20,-127,52,-37,-79,-41,-43,111,-31,99,13,-12,43,99,-1,-31,43,124,-15,-30,120,-69,-79,-36,-19,-89,89,46,116,54,-46,49,94,85,67,113,11,24,-59,-17,119,-119,110,-57,-81,-1,77,32,118,-38,-13,113,-53,-94,111,110,-19,-14,-53,4,117,-20,-35,121,24,-97,119,18,-31,108,54,30,-74,-121,16,101,65,3,107,-12,-38,14,-53,125,60,-59,17,52,21,-65,-118,76,91,-112,106,-38,98,26,-4,-53,-63,-108,95,-58,63,19,111,-74,73,37,63,-115,-84,-44,22,-47,-51,60,9,29,22,-57,81,-87,-27,-65,-63,-93,63,110,-26,-126,-12,7,-118,-127,-113,-70,45,107,103,-69,-48,56,25,55,-55,79,113,111,120,-2,43,108,-122,-41,93,40,44,88,107,-78,-34,124,122,63,-67,29,14,24,-69,-72,67,108,26,116,88,90,-48,93,-103,-37,127,-24,115,-76,-80,-97,-61,96,-54,-22,-14,-123,-49,62,-17,-1,21,-65,116,10,113,10,30,88,-24,-119,-95,89,58,124,-119,-112,-115,88,57,119,68,-17,31,-27,-9,-64,18,-26,109,-60,4,59,-89,-127,8,-35,-90,88,-76,22,109,-123,-51,88,-90,18,25,45,47,-80,75,-66,-24,-109,-47,-42,68,-8,-98,78,-122,19,33,-72,94,2,-109,-84,82,102,71,55,-121,19,76,76,93,66,-42,-23,-2,40,3,106,123,-111,8,83,105,117,121,-52,2,-4,-18,-4,-19,-125,38,80,83,25,-64,123,47,36,105,29,-71,-72,-127,-41,-82,31,3,-43,9,73,124,91,-3,-99,-27,101,77,-51,-96,60,15,74,54,35,-119,116,53,-4,46,-29,8,2,93,75,-18,38,49,40,30,-30,22,97,97,-8,-35,-111,21,-62,97,-96,-12,82,28,-118,87,-12,29,-16,46,110,8,95,58,40,41,29,105,-58,-108,-29,-117,36,106,-118,11,-124,60,84,-83,-87,21,53,-31,125,-5,114,-75,93,-41,-127,-98,49,31,96,64,-112,60,-126,2,69,-73,94,-23,-100,81,-115,-116,94,-25,-44,46,91,-89,12,-47,75,107,-77,-82,-10,79,-70,-106,75,-1,62,104,-69,-7,-41,73,53,-32,74,26,-113,111,-115,-55,66,20,-91,7,-47,51,-96,126,121,-75,63,81,-23,14,-124,-41,-39,-13,14,-27,16,-56,-48,-43,-84,120,33,41,98,26,-6,18,15,8,31,-9,-50,121,-107,-106,-33,-46,64,-19,127,-104,-59,86,-30,-121,60,-79,39,-38,-5,85,-119,-17,21,-120,44,-22,89,-17,73,-102,49,26,-73,-69,91,-71,-36,103,63,-8,125,61,103,-116,-20,11,105,-116,15,-78,-122,-80,-62,-80,-58,65,-119,-47,99,-26,-111,69,87,-38,-15,-44,-87,-14,-84,-37,-27,109,-90,-72,-4,-110,38,82,-97,-50,29,61,52,-44,-87,8,63,83,92,109,-124,-47,69,-110,-70,111,-10,25,15,104,80,66,32,-70,-16,-49,-52,-16,-41,122,104,22,-31,-109,18,62,102,125,-123,74,121,5,92,-92,-90,72,-61,98,-2,-125,-81,101,109,-120,60,58,10,53,94,38,-25,-56,-13,-80,80,-13,45,-77,-43,-44,-37,-62,46,38,-103,-124,-93,48,76,-82,1,73,74,67,63,-59,-26,76,116,66,70,-113,-30,106,109,25,75,-18,25,25,85,-83,81,78,-50,99,-53,-125,-68,44,-104,96,-44,-126,124,33,112,-75,-29,-9,-60,-126,-84,-119,-61,-127,-6,-46,-26,-57,118,105,-4,21,-120,54,-121,-35,-70,-101,-124,-79,-33,-30,105,57,-108,-48,-111,-65,-108,41,77,112,111,118,68,0,22,110,44,56,-91,-49,-111,62,-54,78,83,66,38,102,-14,41,52,14,-94,106,105,24,27,53,-40,-70,60,-119,56,-95,68,69,59,-101,-124,-25,-119,-45,102,-55,-38,61,57,104,-96,88,122,99,-122,77,106,122,33,126,-5,-74,46,116,-52,-51,-101,74,74,2,-3,-21,-38,68,-30,17,96,71,-124,-23,47,64,-35,24,107,49,41,-50,-23,88,19,55,-30,-91,3,-54,-14,125,10,84,-96,100,100,67,-116,-40,-124,2,53,-62,45,72,21,82,10,-47,-126,54,-84,-50,13,-2,-66,-1,103,96,-17,123,59,-111,-61,-70,-20,-57,54,-94,-110,-125,3,-101,14,-128,-86,80,-44,-94,37,113,123,-104,-9,-87,109,111,120,33,-7,-62,-51,-57,49,-71,3,18,-49,-94,-32,-92,40,-52,3,52,105,108,123,40,1,2,-86,38,-104,52,-93,-44,-73,-62,91,-88,5,-91,-61,-24,-40,-30,-48,-115,114,62,-128,-85,-93,-43,104,-20,102,-103,-52,-56,25,-103,49,-25,10,84,-52,51,-94,-110,26,-108,1,30,32,-23,126,-112,-82,86,-102,-17,-108,-32,78,32,80,-125,-112,91,8,-69,24,-95,-86,-73,-115,14,9,-2,-121,101,-109,-72,1,54,84,-36,25,95,-49,108,-110,4,24,126,66,-63,56,-8,99,-10,-80,-73,5,72,-103,-10,-35,78,3,42,-61,-83,-115,-99,84,78,20,30,-66,-88,97,-120,-66,120,-46,-29,-57,118,15,-94,-110,-29,25,89,113,-110,-52,90,-92,105,-30,48,92,-44,-1,-39,-96,118,115,37,-3,15,-1,-2,64,81,57,-47,24,-14,89,-103,48,-127,-95,-100,-114,14,-69,-82,-32,-9,-77,-38,33,-76,-63,-32,51,69,-8,26,-75,80,59,101,-31,40,-37,-23,76,-110,-23,-83,-84,111,-31,124,122,-56,-67,-112,4,-123,65,67,101,12,-23,-12,-43,54,-87,35,66,-89,-47,-105,55,100,19,-80,21,-76,-85,-117,-61,19,107,-71,42,86,-9,-80,33,-65,120,106,-49,77,-34,-38,-50,-27,21,-28,65,97,108,-77,42,120,69,24,127,-20,89,112,-66,-126,-110,103,43,0,-63,28,-17,36,-43,-68,-117,115,-69,70,107,2,94,95,9,-83,-99,47,53,80,-105,28,-27,119,59,82,95,-94,-16,-49,15,-122,16,-89,17,64,-6,88,4,21,47,-78,50,-25,121,-36,-47,72,-21,-101,29,9,-83,28,-113,-68,23,115,-67,-101,-101,102,-98,-124,-98,-89,-24,82,-28,40,-89,125,23,83,97,-53,-7,-108,-90,-83,-113,-26,-58,-119,28,97,35,-74,6,-15,-40,-10,11,-98,79,101,101,-72,8,-99,117,80,-65,127,95,15,60,-29,2,-92,60,-118,-116,46,79,-79,-62,-43,104,73,107,117,-43,-127,-67,113,44,-41,67,-98,-73,26,74,59,-111,79,45,21,-60,-26,18,-72,54,-70,-30,10,114,-82,-124,-126,-52,-97,108,120,-19,-111,-52,102,10,18,99,49,-128,-17,91,-46,83,-76,-3,-41,45,47,-72,3,-19,112,-104,122,14,-77,-35,-23,121,41,-123,-2,-60,50,44,84,-45,69,-58,-69,43,-98,-11,-17,112,-95,-36,-69,67,-52,-11,-45,98,-126,-33,81,51,101,-38,67,68,-37,-78,12,107,105,75,-100,-109,-55,0,11,45,-24,3,54,-70,77,-63,125,52,93,-16,-22,-97,35,97,58,46,-61,66,-98,-61,12,-43,-63,-45,-36,-79,41,-58,54,-49,48,-63,-33,-110,-49,-36,93,73,-78,-33,50,-76,-6,-48,4,-87,-88,-81,-30,-33,-109,10,104,-94,94,38,-124,30,6,102,37,97,56,73,-106,-18,84,70,4,-31,-27,-90,54,63,50,10,-18,-113,125,-116,-86,-119,64,33,26,-128,-25,-77,76,-127,-79,0,60,-65,5,-63,-5,101,-91,69,-49,67,71,121,-22,59,-87,26,66,-26,7,-79,-73,-51,0,-114,-22,40,-115,-87,29,-18,-23,-72,-96,-55,-119,69,68,-102,-99,124,16,74,-34,5,87,120,-28,-6,-92,-111,-42,-85,-36,123,-86,-52,83,-77,-15,43,124,59,-81,103,96,-80,41,0,-62,-22,-13,77,-99,71,-121,104,72,43,107,4,80,-62,54,-98,-63,-13,-92,10,-119,-95,-76,-90,76,78,95,-108,-117,122,-115,88,52,-10,26,122,39,101,-80,12,107,-108,36,-13,-72,36,82,63,119,-57,-44,-7,77,-55,-25,-54,102,-118,-93,-91,58,11,11,-30,80,-62,-77,111,3,105,39,-63,-50,-33,-6,29,52,-98,-80,51,-5,-50,-122,93,116,-77,-45,79,110,-103,-20,-123,-16,-58,93,-101,-11,57,24,44,-60,-118,64,32,80,3,-25,107,60,126,124,-90,-22,-95,-91,-57,83,-46,1,-28,78,-47,74,15,42,26,113,42,-76,14,20,33,-93,37,107,89,-22,16,23,-16,60,108,-117,74,111,52,78,-97,53,-127,123,9,-78,-15,-17,86,5,-17,-120,28,-76,69,13,-76,120,-64,-35,-17,20,-98,126,-42,-88,-99,10,-113,44,84,115,-35,18,81,2,99,-82,74,-125,12,110,55,-110,31,-94,23,62,-4,-62,-122,-120,40,42,110,34,84,2,-3,-24,-75,-10,124,-38,-46,-14,-11,109,57,27,111,6,-99,27,126,72,41,-29,106,-24,96,96,60,-18,42,-104,82,53,-69,15,92,-79,127,-70,-102,-53,102,79,32,84,-119,115,-36,7,-84,-24,2,103,-77,54,60,1,-7,-64,-7,-22,114,-5,19,80,-49,107,-7,-2,89,-63,-26,-111,-51,17,-108,-40,9,-51,58,108,-55,-68,-117,99,-51,-117,-17,46,-33,69,13,-23,4,-71,-110,4,-95,119,103,-30,31,23,76,39,-36,6,-117,76,6,80,106,18,-124,-3,78,112,3,40,23,-55,-100,75,-118,-16,-52,18,69,-77,-91,126,-87,41,103,-127,7,105,106,77,-23,72,50,75,-16,-19,126,112,67,-4,-102,-56,53,38,-72,-60,-69,30,0,47,-95,100,53,-127,-16,-18,-16,29,46,73,90,-112,-97,-111,-15,-38,23,44,45,115,-93,-68,-32,-10,86,19,69,32,-104,-112,97,60,64,87,61,69,55,-92,-4,-77,-28,76,-82,56,123,52,-105,-38,-1,81,80,-40,-14,-78,115,32,-59,-123,-115,50,3,69,-14,5,-39,70,-124,34,61,-35,-57,34,127,-120,-13,109,-108,68,-22,-125,81,89,35,-21,88,87,107,-32,110,-27,-19,-82,-114,-81,99,115,-54,-92,90,65,-126,26,64,-114,36,70,-93,10,-94,-111,-90,118,-45,-3,-121,106,80,10,-101,-25,-12,-72,39,114,47,43,125,33,88,-109,-81,10,98,28,-98,105,96,123,-43,-58,-115,-122,-88,85,-80,26,91,-26,103,-88,-121,-66,101,87,-88,125,20,-58,-62,-46,-113,-100,-36,93,79,33,-108,49,-45,0,-19,70,103,-48,-19,-15,29,122,40,121,118,102,86,-83,111,-86,-26,-124,6,86,49,50,-67,-104,-28,-28,35,52,42,-25,-87,-6,-70,18,126,123,-128,-3,-109,-49,-94,-120,-62,62,-89,-107,94,110,109,10,-37,-126,99,-116,-85,113,100,-19,-52,65,-101,-45,93,-49,96,-78,84,28,-44,5,-110,-48,-26,62,127,49,-53,57,67,-85,127,60,120,-67,-96,107,34,-60,91,-6,-80,-8,-77,-119,50,89,-52,-64,96,-60,127,-76,-34,-1,-52,34,-25,100,99,-94,-46,12,-47,47,-47,-14,45,59,3,-74,-85,-49,103,-79,-6,-1,-25,0,-2,-44,-29,-11,6,108,-23,-48,91,56,75,-77,-71,-46,-100,-98,-100,90,-29,-56,-35,-3,54,-126,-62,124,1,-88,-26,4,101,95,-113,-67,75,39,104,-106,68,127,-127,-15,-36,-12,23,-51,-118,-22,-67,-39,-71,-77,52,104,9,-106,10,53,34,-98,-67,-74,84,95,87,38,-35,-103,-38,-125,-124,-31,41,3,-89,-41,-107,-9,-90,-39,-58,83,-106,-86,-24,-93,18,23,14,36,-56,-36,75,-123,10,7,109,13,-119,113,80,-68,45,35,57,32,-17,-1,28,-98,52,6,-37,-97,118,48,-119,-69,-102,37,-18,-4,-59,101,15,91,40,-31,3,5,-9,105,-9,-33,-31,-7,-71,-112,-71,-2,70,98,46,73,-99,42,-77,53,-38,48,-1,-120,76,-33,-62,-35,117,67,-117,33,58,2,-127,-100,-66,-117,-82,91,115,-111,33,24,-125,-89,76,84,15,27,-5,-87,49,-72,-35,-128,-49,114,65,82,-71,127,100,41,74,-63,52,0,-67,8,117,-102,5,123,87,-37,8,36,126,71,-108,-73,20,104,-76,-71,-50,18,-56,8,-62,-52,-105,-127,41,16,-26,-122,31,11,70,-100,-109,117,-35,88,29,-45,-78,115,-86,102,40,18,-58,-54,-84,32,-36,56,51,52,107,126,38,78,-66,-77,20,65,-119,-113,26,85,-92,-67,-35,-24,-47,-9,43,62,-70,-66,-41,-7,-72,-77,-79,56,75,49,67,65,43,102,-78,113,98,53,-47,20,-116,-4,-2,-12,-36,50,8,-118,-79,-120,-37,4,103,62,51,107,-90,79,49,-17,61,-15,36,17,-117,39,123,-87,61,11,96,-108,1,53,51,36,-19,-51,-69,-40,-91,127,-90,-62,126,79,-72,-61,123,41,-27,11,14,76,-67,-17,-70,-104,47,73,32,-120,-109,61,38,31,-1,-37,35,-21,-26,59,-53,-85,18,75,106,93,-83,-31,-18,-127,18,19,66,-74,10,-25,45,18,-109,30,4,13,-62,-47,13,-59,44,-96,19,-18,-113,65,-5,-75,91,-21,68,-90,46,25,-110,1,-115,-88,-91,55,13,86,24,-60,85,108,93,27,-61,-14,28,-110,-17,-18,68,70,113,-52,58,-9,52,111,-64,-97,64,-100,0,43,32,-88,13,-32,0,110,-104,92,108,66,-112,65,34,-64,-125,106,-9,113,-116,91,-35,-88,-91,-16,13,-117,3,37,121,-84,-75,-1,-44,-49,13,-77,81,46,113,-115,15,-37,21,-17,33,-19,-83,-95,27,28,83,53,22,-23,66,-25,-57,-15,-56,69,106,49,63,-120,125,106,-86,55,40,4,-96,-26,43,60,-107,-116,-76,-89,101,51,98,-21,106,-49,53,110,83,27,-119,36,2,-5,86,-50,47,-75,42,52,-59,63,-71,-67,60,83,6,65,124,16,28,14,63,-58,52,23,30,-81,49,-123,-26,42,-39,60,-27,-61,-66,-18,-88,-22,-46,-61,-60,65,66,-100,111,116,100,50,92,103,-83,111,-72,-5,116,111,72,39,101,54,-65,-44,8,-128,-88,113,18,-70,-78,-70,87,29,112,-31,63,9,12,-109,-27,-42,-52,55,-48,-70,95,-71,93,122,-46,53,-115,-22,-27,125,125,50,-58,-50,21,-71,9,-6,-82,45,50,51,-14,-74,-72,104,95,-86,57,65,-39,6,-10,21,-76,-52,127,-128,17,-36,-23,87,103,24,-95,95,10,95,21,61,-96,-24,-8,0,74,126,-14,-102,-44,107,-119,83,-123,51,27,-64,-17,124,24,-96,79,118,43,8,-95,-75,-106,-84,115,69,3,-118,122,-64,96,-29,-106,-78,-97,-82,122,51,14,-80,65,121,-66,-119,74,121,82,-120,77,96,-82,56,106,-45,-28,-116,78,-70,-13,90,41,-77,-55,-78,-49,91,-109,-36,-91,97,-31,95,27,-91,-116,-21,-17,87,112,-82,-51,62,-42,64,111,106,68,92,53,-68,-38,-55,-25,-38,-121,74,5,-96,-77,-14,-109,-87,75,-62,-108,12,-97,93,-91,42,24,-5,-45,79,126,-10,-71,-97,97,6,-19,-80,77,39,-111,-69,42,-123,-61,-30,-78,64,18,77,-99,82,-40,127,-39,46,66,46,-82,-70,-117,77,-17,27,96,10,56,16,83,22,114,114,24,-89,118,-84,116,19,-88,80,16,-25,66,111,-70,70,-86,-88,10,-1,80,-82,-95,95,-20,-121,-114,26,-15,-104,-77,-120,-7,97,123,68,69,-12,59,24,-20,100,46,75,-76,-23,-41,79,82,-3,-115,44,-69,-55,-100,95,81,-108,-125,-121,-46,-48,-112,-22,-10,-40,-60,112,22,79,89,-99,53,-54,48,-110,16,-51,77,94,59,-103,-50,-10,34,-115,60,84,31,-58,-55,-10,64,23,-5,112,96,85,75,4,-106,-77,55,-33,87,-76,-79,53,71,-8,-92,63,118,-60,-84,99,107,46,88,-89,24,-41,98,-36,-22,34,-88,-23,78,84,56,52,-14,60,123,-20,38,-56,-66,67,-80,117,-6,115,121,39,-126,-77,-8,89,22,29,-101,55,29,-31,-108,123,125,-46,6,103,-88,-35,25,-58,65,-118,40,-39,26,62,15,-25,77,-50,117,44,79,-79,64,-114,94,-31,-26,-67,-10,-114,-19,69,24,111,14,-33,-52,110,50,95,-107,63,-71,36,-21,-22,-7,-95,19,-71,-38,-88,124,47,120,98,22,-69,73,-5,-114,-18,106,-41,-102,-26,28,-41,-101,-105,-31,-120,-26,22,-21,-31,-44,-50,-127,88,85,111,33,-53,-114,-12,71,53,126,-55,82,93,-104,-77,41,-50,46,90,54,-28,-38,-128,-68,-80,-13,34,-63,31,60,-81,40,55,77,-5,-17,94,-110,30,96,26,61,43,-48,-128,101,13,-8,-6,-29,-60,115,-62,107,-57,54,96,13,114,-89,36,-69,-40,106,98,107,19,-28,-4,14,-97,-60,-71,-64,-107,-48,75,-50,-54,90,60,108,-101,-104,25,92,-60,-17,48,-63,103,113,59,24,51,32,-26,-101,121,71,-21,-83,-68,79,-115,42,5,89,-38,65,28,-91,22,4,89,7,-57,122,-51,-120,-58,-110,-42,-70,105,102,-112,33,-83,21,-14,62,-116,123,-55,-114,95,-110,-46,76,-12,-6,-88,-48,-126,49,-67,95,-94,42,76,84,-112,-64,-20,114,9,-8,-96,-38,-38,-85,72,55,7,127,117,54,-52,41,-89,-46,-95,-121,-97,-113,46,95,79,-105,96,36,62,111,-38,89,-97,61,24,120,90,-111,-69,43,48,88,25,-58,-89,55,26,14,121,-126,42,79,56,-43,-88,109,-53,31,69,-114,-1,-81,94,-50,35,20,-93,62,69,-96,120,-35,-103,-86,126,-44,-96,102,54,12,-97,-79,97,-49,-18,80,-68,-111,-17,39,87,102,6,-10,11,2,-89,-74,-104,-43,-9,53,-68,28,-126,-71,66,-26,34,102,32,-36,-96,-83,87,-127,83,-50,-60,-98,71,-81,108,-97,-74,50,20,-98,-9,75,8,-48,0,124,-27,74,-59,1,-121,118,52,-57,15,112,81,120,-10,-66,42,87,-92,-89,-123,-1,-29,-74,126,57,-50,31,115,-47,-20,-89,-107,51,49,28,110,38,-73,-37,-72,-70,-124,-20,-109,67,7,-114,64,32,-76,101,-107,52,-89,-109,51,-51,-3,-98,122,100,-57,-2,34,-38,22,-101,15,92,9,-104,47,-9,-18,47,27,-38,-58,-122,-20,102,-78,-63,-19,-71,-112,65,-48,49,27,85,-113,-57,108,24,81,-96,-47,99,-67,-121,-17,2,-29,-9,89,109,-45,-127,-59,122,44,-81,-39,55,5,40,0,-11,61,37,-82,18,-97,-69,-45,27,11,-70,-88,31,117,-98,115,114,75,-104,46,-3,104,-67,49,21,18,95,31,-8,11,55,-76,22,39,-17,10,24,-63,-97,57,114,-46,-62,-66,34,-86,-94,-67,-109,124,68,26,42,-65,-60,97,-41,59,118,-104,55,16,-25,-13,-99,-28,-50,-50,103,51,-77,91,55,53,-17,-108,-82,-121,-54,118,24,77,24,-120,73,-61,36,-122,-63,51,-88,22,104,76,14,63,118,122,-31,59,-115,-92,29,-66,101,-48,-7,-5,30,86,-41,-87,11,71,-15,75,-30,-110,2,9,91,18,101,-102,-51,-115,-83,14,37,-41,-17,106,-43,-108,-42,34,-86,65,57,12,-13,114,25,-36,-69,-48,93,-99,-89,-104,54,19,15,-101,-105,24,-51,-26,93,95,-2,-43,51,-14,-112,-83,69,77,122,20,-7,107,-29,79,115,115,-102,-58,-111,46,8,112,-67,-20,-97,-88,98,75,-30,-47,90,110,25,3,-8,94,70,47,22,-91,-103,-54,58,-38,-12,-50,51,37,72,27,7,-112,-50,31,-14,70,-76,-95,-109,-111,48,-75,118,-2,30,-7,-123,32,33,-89,-47,25,-6,67,73,-29,-7,-93,49,111,112,76,-65,8,-76,-95,45,83,-79,84,23,20,-96,-52,15,-70,-56,7,-58,106,85,122,-96,8,-84,85,-101,-30,35,-14,23,112,33,-86,20,-93,73,-30,-8,-79,-39,-77,-36,-38,-107,-112,-89,49,-27,103,48,31,127,-22,68,-35,100,99,57,-26,74,85,118,101,-43,105,-76,-93,-127,44,-1,39,68,12,93,-33,13,-78,11,-51,85,44,-99,12,-85,-63,98,-5,-92,76,25,-68,-86,-121,-67,-64,-109,31,64,-90,-58,126,52,-41,20,27,120,-86,-117,71,-128,-128,-28,-39,82,-102,113,59,30,-128,78,30,103,-11,-95,117,74,113,94,46,56,-96,41,48,-85,-25,-28,-79,104,3,-73,2,30,-22,76,-103,101,83,-89,34,2,127,-26,25,-82,8,18,-3,-20,13,52,-21,36,-38,90,112,-85,-92,-79,9,-72,98,15,-26,-32,-4,26,-26,-94,112,-5,69,-21,31,-84,-17,-112,-83,46,-24,-105,3,-102,15,-60,-123,99,-6,-47,22,-120,70,125,86,35,38,35,5,-100,89,96,64,-33,-55,29,-82,55,-3,17,89,52,104,126,62,-125,-80,113,34,53,77,83,-28,-65,-27,2,68,-114,-37,-4,-94,89,-41,51,-85,43,-36,93,-93,74,-8,109,-92,-70,114,-120,44,-63,77,102,50,36,88,16,19,99,-9,64,-57,-43,-81,-67,-70,-9,89,-64,114,53,-99,5,-31,87,74,66,-37,75,108,-100,85,-101,-44,-120,-32,-70,92,80,30,-16,112,-102,96,99,-6,123,-89,100,102,-38,-90,102,-80,-9,52,9,-47,-114,-81,-128,-112,2,87,-40,-41,46,-15,119,-107,79,105,15,-53,108,72,-22,36,45,82,-88,59,19,118,27,123,-93,-46,-44,93,-98,64,105,-80,99,-110,-8,-51,33,-58,76,-103,87,-13,26,76,-93,-13,83,127,-4,-52,-54,21,70,-93,20,-7,19,7,102,94,41,67,14,-52,17,54,23,-81,93,-61,76,-23,-92,-118,9,110,99,-53,-128,123,-127,-24,-125,-76,88,-79,63,-65,71,-79,59,-45,-64,-85,-111,-53,55,-102,22,-78,48,-67,25,100,0,30,72,19,56,-54,-6,40,-71,-42,98,127,-46,58,40,34,-6,-112,21,-113,2,-14,-42,-25,-78,-55,12,62,58,-127,-44,-40,85,29,-80,-27,-72,73,8,-36,-32,-21,34,-46,84,41,75,109,-41,123,-92,20,-123,106,72,47,41,-73,-12,-38,117,-89,44,-128,-102,-65,49,-43,69,-53,-119,60,-97,-39,9,-118,-33,-58,28,105,-41,70,111,39,-41,90,58,20,-25,-21,110,50,-114,-68,-104,-35,96,58,-16,98,26,-80,-98,63,74,119,-85,21,-124,8,118,-61,-125,-112,23,30,-77,92,-11,-28,-101,-57,-9,93,-49,103,32,-97,87,116,-96,77,-48,-27,92,57,-29,-25,52,-107,-77,-50,114,99,-79,24,-58,-19,-96,-113,47,-80,8,-83,-72,69,-6,55,92,39,17,76,21,-127,-5,-60,-115,-55,-28,40,-43,-43,106,112,-35,-57,25,80,19,-39,-6,-111,-79,4,-59,-77,121,-103,-89,-127,-113,28,61,-50,-125,58,-38,-33,43,124,41,69,-105,2,99,83,-31,-119,-21,38,90,92,-88,113,-83,56,-56,61,-49,-74,-2,-23,101,-114,26,114,-95,-52,-73,-7,-53,116,32,49,119,81,-88,-49,-102,-126,50,-47,38,-13,76,69,-73,-124,5,-53,-63,11,-42,35,-97,46,29,-43,112,-2,46,58,83,-17,41,-5,125,-34,-96,67,49,-17,-80,38,-82,81,29,84,-13,96,-112,49,13,65,117,52,23,3,49,-26,-43,-88,-97,93,-60,-93,-34,-54,-74,5,-113,64,-73,23,-95,50,17,-112,123,-90,4,-35,103,16,-41,26,-104,109,-119,-71,95,28,60,-71,-41,-26,5,-118,-31,-126,58,-93,-50,-48,30,-51,-31,-2,-92,-75,85,-52,71,112,-48,74,-65,-24,41,104,121,-95,122,-83,-49,119,-20,38,97,23,-73,-22,55,-118,45,25,-37,47,-122,89,-4,125,-105,37,55,102,52,-12,34,7,85,15,-6,17,13,18,97,20,-92,79,107,-16,117,-80,60,-3,-23,81,-70,124,52,-36,105,-44,-125,-40,-81,28,88,-57,-111,-96,-49,18,-5,71,-37,32,-73,53,1,-124,77,-70,-107,33,-79,-83,-34,-125,43,20,-55,15,-53,59,59,-97,71,44,78,80,33,-20,65,68,-72,-125,23,-30,-3,-89,93,64,88,123,-44,126,117,59,38,-5,32,40,125,124,98,-104,-31,-59,-27,98,12,125,-43,-48,-74,43,62,-6,73,-3,19,100,-104,-62,35,47,-8,37,60,-125,-100,95,49,-74,-15,8,76,58,14,-85,20,-56,29,70,-125,94,-60,-56,-112,82,73,92,78,-40,-37,37,-50,22,19,63,23,-49,116,27,113,82,-5,24,46,85,41,106,-11,102,-123,60,45,-108,63,124,-67,114,53,-14,-126,-108,64,-6,-27,-19,-101,-27,102,112,-45,93,-4,-36,-68,-111,93,-64,69,-128,-109,-78,-16,-62,-79,-51,-8,-39,-40,-94,-4,123,-117,70,87,-91,-79,15,18,98,11,-51,-104,-76,-59,40,-82,110,100,102,13,71,42,117,-81,-41,-120,-48,-17,-20,44,-44,-120,76,79,123,-128,111,-51,71,-41,-76,-86,-32,80,-43,124,-65,123,21,5,5,55,34,73,-46,-55,58,-108,116,110,85,59,-61,-24,-86,111,-34,-128,-111,59,45,-125,-94,-47,-90,48,-109,-56,-95,-37,-127,79,-17,102,-52,-96,16,-77,31,40,-59,-93,-26,10,-28,108,-2,-85,95,-25,-88,-94,120,30,-24,-69,-9,90,81,67,-92,123,116,42,12,123,88,86,-86,10,-16,-77,54,-119,-54,-43,-7,104,-111,-75,-3,63,-96,-95,112,-68,80,68,-128,3,-13,-37,74,-113,62,-88,-32,-40,-48,55,-21,-64,64,118,-126,-41,-79,-75,-112,-78,-81,19,20,-10,86,97,-20,127,101,56,118,69,-62,73,52,125,-15,-84,-30,65,105,-53,-59,-54,87,-87,87,-116,49,-120,71,-48,-108,99,-19,-107,-98,-40,58,86,-119,-125,-62,-38,23,91,85,-55,52,-31,123,-76,120,77,49,122,-118,-19,-56,86,-74,-15,-82,47,-121,-83,21,-69,119,-86,-39,59,-84,87,1,19,-58,-67,-122,-45,54,-38,-96,-13,100,-91,-118,-97,-72,73,-30,23,-121,-30,-36,94,-38,20,22,-4,-85,-7,50,114,-105,95,35,-85,-41,-89,93,8,-53,45,87,93,117,30,17,-61,69,-61,48,-52,-75,-99,-104,-113,-27,10,80,89,119,107,-76,-30,75,125,122,55,-13,8,-37,-37,13,24,33,31,98,-14,101,-51,24,27,37,-51,110,-15,83,-49,-122,85,-30,18,-17,92,101,12,97,-54,-99,4,73,-82,-46,111,29,-7,-75,90,106,-91,45,68,-111,68,-63,99,86,-74,-122,-35,21,-28,-22,74,-80,-70,-93,50,-9,14,-84,45,-18,-41,-50,-105,-94,82,-89,102,74,-38,120,90,43,-17,-82,-83,-119,-17,-106,52,-80,-63,123,124,75,-118,98,0,-100,-76,77,-72,-18,80,-49,61,100,107,89,-27,93,-70,-52,-68,-89,-46,49,-9,-77,13,-29,103,-52,-69,-88,-65,-33,39,-119,-105,29,96,48,86,-76,55,62,-128,109,5,73,-94,-11,-43,-82,-32,52,122,33,29,63,-40,-89,-88,77,-16,67,-69,-106,-59,112,59,6,-67,-92,-115,107,-120,40,38,69,-33,87,81,9,8,9,-31,-110,-68,113,-117,44,-81,-62,-85,-23,77,-6,84,-63,-126,58,105,-48,75,38,80,-2,-45,34,-62,107,-8,-16,-82,-17,-128,57,-113,12,-99,-110,-47,100,-44,-23,121,42,-29,34,-64,100,-124,123,105,-7,-128,117,5,13,-13,-125,112,86,-4,53,-128,-81,-87,-75,-18,116,-77,-110,-122,100,-60,-124,117,82,-35,77,87,29,125,-127,123,-54,100,-117,-100,-49,-105,-77,2,-110,-4,-101,6,53,63,-103,76,-118,-40,108,-103,52,122,-3,54,57,-86,65,86,4,-106,-99,82,68,-44,15,-41,17,51,4,92,22,-63,-83,-126,63,65,-115,76,-109,80,-50,16,79,105,-115,96,-71,34,-61,-89,92,98,-36,-88,56,113,18,-123,120,32,110,81,108,-29,-31,34,-102,-24,-33,-8,76,25,-128,77,90,84,76,-98,-104,-4,-105,-65,-62,10,29,-80,-116,89,120,101,-36,22,-85,77,-44,3,-107,63,-19,45,-126,16,1,-29,31,-125,113,-108,30,-103,-127,-38,26,-18,-120,-56,-121,32,-25,102,-7,-85,-50,47,-121,-109,-127,-6,-34,55,-34,-114,82,-6,83,-44,-2,-69,101,-34,-21,123,33,25,-23,-108,-46,-107,-46,56,38,-30,108,106,-31,60,-78,8,4,25,124,12,37,29,2,89,40,100,-48,21,-53,-87,109,-116,77,-46,-60,-64,122,-68,-25,-109,28,-71,62,121,-73,-84,80,12,-88,-118,-89,109,-74,106,-62,89,-65,58,-73,-74,-110,-64,-73,-27,-87,96,-128,-122,54,-72,42,22,-37,73,-87,6,31,29,-46,62,23,-99,63,114,-20,10,-43,68,15,-24,124,-63,-25,76,-12,30,-43,-86,38,111,69,-121,-5,-49,-42,34,-51,119,80,39,86,-32,-74,27,-71,-24,-25,73,74,-11,104,53,117,87,-11,-32,-115,-24,-78,99,-7,-113,-76,-99,112,-20,50,121,-9,-103,111,-10,-68,-9,96,-35,-108,10,2,-38,-18,-73,90,-64,-105,94,-22,103,22,116,-68,99,-42,124,-117,-122,-119,-43,47,-6,72,90,52,-52,-76,2,-84,-22,-19,-85,92,-124,13,-115,2,36,107,15,-76,127,47,-39,3,-109,90,-24,-74,1,-29,-17,-21,-27,32,102,-57,26,-108,-114,-104,-112,76,-47,86,-17,-86,38,114,106,-81,-77,67,52,-28,-68,23,-63,-57,-110,95,-81,-35,-97,-96,-29,-11,64,-118,-1,-99,-25,68,-24,-118,-84,-113,68,94,-39,93,77,-80,-1,-123,12,97,80,-117,111,-52,5,5,-24,-98,-27,-96,48,-37,-108,-28,70,63,-21,23,123,67,-33,47,-96,-58,-50,-109,-124,-64,20,-37,44,-101,34,100,95,94,-57,-4,39,-21,-62,-37,-76,-72,-51,114,10,-21,113,-68,45,27,-77,105,47,18,122,43,-117,-99,-82,-15,40,-7,112,-86,27,-37,83,-53,-8,1,-110,64,47,-58,44,14,-50,18,-33,-17,69,-90,51,-58,35,-103,29,38,100,107,-44,106,-99,-49,-90,107,23,-44,-79,-21,7,-10,40,-58,-76,-50,-106,-47,84,34,91,23,-9,113,114,-91,-11,-62,64,58,20,44,-76,-55,-105,38,-101,94,121,-125,81,-128,-55,-101,-22,78,100,43,94,118,-46,-103,-36,48,81,45,90,2,-3,44,-8,-49,-66,104,116,-69,-90,-78,28,15,-65,-31,103,14,-71,-103,-90,36,-54,-81,-62,-35,70,-60,103,45,-13,20,-32,127,-93,59,127,-89,-54,-23,117,77,48,3,-84,-56,-35,37,87,-115,60,11,-27,103,44,78,-16,-3,-112,-44,45,-112,61,-102,-104,-67,88,102,121,104,-106,46,-39,-91,52,-77,-13,118,-79,-52,61,-5,-90,46,24,-84,-59,57,-34,-62,101,47,-66,122,-18,28,102,-123,32,-19,121,12,81,-110,89,-38,-78,8,-78,-2,-94,44,111,-2,-36,-66,22,-59,83,-43,92,-29,60,-71,92,7,-51,19,-2,-66,39,-100,116,92,-78,7,124,107,103,127,-115,62,80,99,98,-74,-95,109,-3,-126,59,-61,-93,-58,11,87,-24,113,100,21,-65,-103,-71,-106,122,-71,96,100,-38,-23,-118,72,0,-68,-55,-108,88,82,73,119,-105,59,-90,-41,99,76,37,-41,-62,18,94,-37,67,56,68,-41,110,-24,53,14,-62,-121,38,-84,13,48,48,116,-17,-80,110,-63,50,8,-4,111,-77,-4,77,112,19,64,-9,-32,-45,77,72,-90,-127,74,88,-61,-85,-75,63,125,-46,-86,-15,79,116,7,76,46,-99,14,36,-55,0,76,95,101,-115,-18,67,-35,71,-104,95,8,-124,-42,38,13,-70,98,18,77,51,-27,-82,-61,-66,26,2,2,-26,-119,-61,-70,44,27,114,99,-99,97,14,34,63,-44,-88,65,82,-47,30,-99,-97,-13,13,48,47,117,4,-29,37,-7,11,28,78,-59,41,-94,8,-125,99,32,-109,-13,14,-58,11,100,101,-94,-61,-49,45,90,47,77,84,19,12,-86,-24,-63,112,73,-48,4,-91,47,54,3,67,68,5,-26,-64,-71,110,113,-96,23,105,-14,-79,67,-18,36,-35,48,-36,68,-33,56,-5,39,-56,-11,-20,-43,6,-33,82,121,29,-78,8,28,-29,-76,-101,-81,116,-72,-98,97,-16,107,123,-89,-47,102,-84,-113,-107,-24,105,-112,-67,-41,-77,-18,29,-19,49,54,49,20,41,63,84,103,15,33,50,-118,-25,42,87,48,61,-48,-121,-74,16,-85,-13,-14,6,-76,82,-68,90,-4,-40,17,2,-101,81,102,-80,-2,-64,-74,-54,8,7,99,-117,21,21,74,-50,-36,-89,85,-75,-35,-29,2,-105,-55,2,71,28,-118,53,-84,126,2,9,-104,-20,45,4,-113,76,10,124,81,83,88,50,66,95,44,-110,17,122,30,92,26,-85,-53,73,-32,-78,-127,5,34,3,-75,81,-15,54,-13,9,-126,-42,-102,7,119,96,34,109,67,6,-70,116,-26,9,103,19,116,-9,88,-12,39,-88,92,85,-87,91,33,-43,96,120,-59,-53,12,84,-18,-68,3,-87,48,-99,87,-28,21,-88,-93,86,116,63,100,33,-65,-56,-36,-36,-38,-80,-62,-97,-87,66,77,-65,103,85,-99,73,103,102,-80,104,-70,60,-6,-96,-67,1,-44,-1,90,-80,-59,93,39,-81,63,66,-35,17,-56,-58,-49,83,-80,71,-54,-111,-7,92,-48,29,56,-7,-107,-114,21,-75,54,-124,-60,-3,-78,-13,-110,61,123,80,96,-49,-105,-115,112,-29,-68,126,-74,-87,82,70,-70,16,-84,53,-16,22,29,-40,-47,-90,14,-117,6,-3,-13,64,87,-84,-100,52,-57,23,108,74,59,-37,82,45,20,87,-65,52,-96,57,-61,2,-33,-39,78,-79,-61,84,63,34,27,37,-13,12,32,101,9,-16,21,-19,59,-119,57,-97,-124,127,76,6,83,80,27,-31,102,-105,56,118,85,89,16,98,-57,68,6,3,58,-95,-78,-77,26,-26,-21,5,-113,23,90,-110,-16,35,-108,-23,-47,-14,-42,102,119,46,10,58,83,-117,-49,80,-38,-58,80,25,-85,40,-2,-54,-35,-100,-77,-80,87,-122,-94,-45,-115,63,-10,86,84,-47,101,-114,123,111,71,-75,-111,-47,43,-35,-99,-22,-3,106,-89,-94,22,111,-52,95,104,-17,71,96,7,10,-99,-90,-38,32,-81,-7,30,-112,-16,-11,-104,106,-30,78,-110,99,30,-31,111,-125,-50,-19,-66,-50,109,-113,26,95,-74,-86,4,-66,70,-4,-2,-14,-86,-83,118,48,-62,-30,-2,-78,102,-105,83,-45,37,58,100,53,-66,46,-104,-25,125,-112,49,89,95,75,88,22,19,-76,101,-35,39,20,-82,54,61,-40,-106,-83,32,-106,-80,116,-52,-45,-126,-86,-56,-71,52,108,70,39,-24,103,71,121,117,120,9,5,-97,110,-79,-39,77,-56,71,-90,-97,3,-8,-64,-5,-102,105,59,-76,-100,-65,-99,-7,-6,85,115,14,112,118,65,-60,10,116,68,-83,69,-118,23,13,24,40,68,-2,-78,-43,79,-63,96,-5,-19,19,-56,94,-79,96,-7,19,-93,31,-47,30,22,89,43,-104,61,29,-49,-111,61,-41,121,32,116,121,-17,-109,-51,51,7,-6,-80,-84,-105,-41,88,-61,16,91,115,69,-25,-80,-12,45,-70,80,75,-22,-38,111,15,-71,39,62,68,-51,40,11,-9,51,44,29,-27,-106,112,-95,29,-105,-114,68,105,-109,-68,-13,-82,33,51,50,-48,-65,-103,-46,13,-29,-51,17,54,123,-91,108,-73,43,-120,27,100,-13,32,52,123,33,-52,-43,-110,-79,-76,-30,-86,-90,109,49,103,-28,39,-52,41,106,0,-13,10,124,-57,-15,10,-124,74,26,91,114,-63,-48,52,11,83,-44,95,13,-23,-57,114,82,-108,96,39,-34,27,29,-60,30,99,5,-101,-128,117,-74,-47,-118,-33,-69,-121,-18,-112,20,-6,117,-35,-80,-35,-102,109,24,-33,-5,47,-13,101,-127,4,25,1,-57,-117,-65,74,-107,-64,125,0,-60,-78,110,-100,-19,-1,-63,27,-17,61,-75,-84,-56,-29,-25,21,46,107,88,-33,109,-89,83,-83,-121,-100,-55,-48,29,-3,28,98,-59,-64,-73,-65,-86,-63,30,92,4,-29,65,-26,-111,47,1,-21,-109,26,-86,-119,113,-1,-29,-88,75,77,-54,-35,-95,22,24,-40,80,127,-56,-24,125,43,-18,97,-32,-77,61,-85,-105,69,19,9,127,65,10,9,-76,90,-37,-2,-15,-18,-57,2,11,27,-51,109,17,28,2,90,22,69,98,-55,-53,-63,125,48,44,-13,-96,-94,65,-116,88,-2,76,72,61,79,64,12,-112,-11,72,44,-103,-29,-24,106,78,91,-93,72,74,-123,-121,-36,4,79,-28,92,83,-109,-99,-98,63,92,-39,98,94,-43,10,-57,83,-23,50,92,79,-111,-79,-32,40,-34,91,-26,115,-124,68,-19,-72,56,-101,60,-73,-55,-83,36,-59,-86,3,-73,-98,-85,103,3,10,-113,53,34,-90,112,-122,-114,26,46,52,58,51,-101,29,-1,-87,-108,25,-77,-51,0,97,32,-36,57,117,67,-124,-61,-67,13,8,-108,-59,-50,28,95,10,-112,124,105,-127,-54,-43,-86,53,-50,-1,-108,65,-111,35,-42,-119,-28,-47,-92,15,-97,-50,12,-42,63,10,-71,-23,22,83,-24,20,-28,69,114,108,98,29,3,123,-42,-101,120,-36,13,-44,87,74,15,-89,77,-23,56,65,-12,19,54,66,-31,-111,-16,109,-43,-87,111,69,79,124,-8,-17,-46,15,-48,61,-28,-72,108,-58,-55,83,53,-80,118,-88,43,-54,74,-38,-102,56,116,-125,-80,-75,-3,43,105,88,-66,-120,117,-58,82,-5,74,6,78,-79,-72,-51,85,-100,-49,123,-42,90,4,-33,-55,127,88,60,-115,-123,20,123,117,-75,9,122,-19,-98,-97,-15,90,92,-32,94,-86,68,41,93,106,-41,-60,-80,40,-91,24,-86,-39,-120,73,-27,125,65,-87,-123,-41,35,-9,113,91,-111,-40,2,5,83,34,-66,114,90,-111,57,126,62,-93,-117,5,-68,60,11,-105,-33,-35,51,-52,97,-45,83,117,-81,36,45,59,64,-43,-62,69,110,-95,88,102,107,-125,-97,43,-122,95,4,1,25,-51,-12,43,100,-22,98,-64,64,94,-74,45,-46,-38,102,-21,29,-37,-123,-104,-2,119,-40,115,15,-31,2,21,75,-115,82,-8,74,18,8,27,90,-80,88,10,-104,37,-1,-82,80,77,-97,-99,35,-105,40,110,24,-49,99,-94,20,43,40,-40,113,10,-71,43,-22,-63,77,64,-79,-3,-82,-44,23,-53,86,110,97,-124,-27,-106,104,-95,-96,-121,-14,25,74,54,72,120,107,-128,-60,-9,21,49,-12,-67,18,-30,-91,-33,77,40,33,38,-70,7,-89,-43,44,-12,-108,111,14,36,85,-15,112,-85,-48,-109,98,57,-17,100,85,-123,-111,-72,60,15,11,-124,90,-105,-107,7,-121,91,-98,-10,83,-116,54,-10,-128,64,38,59,64,-25,-17,36,101,-96,67,-108,-89,46,26,20,126,-71,0,-1,77,32,-31,-72,-29,44,-8,-14,-74,42,-21,-11,95,119,123,84,-128,30,20,27,-74,38,-122,-11,41,94,-33,-51,-115,45,7,74,80,35,-30,18,-101,-6,-92,95,-69,33,15,16,-59,-111,-67,3,-86,28,40,-43,68,27,-95,-111,-26,98,83,38,106,-126,86,-34,-54,-102,-88,-110,38,40,46,-37,81,11,-8,-122,-46,30,90,112,-40,95,-73,-61,77,-123,105,-44,32,-109,81,-110,-23,127,81,-83,-55,77,-44,62,-33,-70,4,-62,52,115,-36,32,-96,-123,86,-33,127,86,43,38,53,21,-125,106,-69,-16,-98,84,-80,-12,-25,17,-70,-72,-33,34,-115,-119,42,48,-34,6,-18,91,-19,22,46,0,-92,-27,-116,106,35,78,50,44,-110,-113,14,7,18,-123,-112,22,113,-91,-17,-51,88,-83,-19,-51,30,28,-64,109,-114,86,-33,73,30,-1,-58,-121,51,-109,104,86,89,119,-76,-28,-90,-95,69,-100,-55,-23,58,-14,-112,30,125,-77,72,-99,39,55,67,54,4,-6,52,50,-47,92,-26,6,3,76,96,89,126,97,80,-80,-76,-100,67,-119,58,-36,-13,16,53,53,5,123,31,106,33,-67,-27,111,48,7,23,-111,-110,-42,-105,-16,38,43,-17,51,-12,-98,-32,89,3,64,65,118,21,-66,-93,-1,-115,93,7,-75,-25,126,107,59,-19,-26,-107,14,75,45,-110,-16,-34,50,-11,2,-109,19,125,-61,-94,-63,-24,123,-11,54,121,-115,-16,-39,2,98,77,102,52,90,-110,-55,-119,109,-47,-121,119,116,65,68,6,6,22,103,49,-121,-117,119,-90,-38,124,-32,90,104,109,-16,-92,-100,61,-115,60,-107,-26,93,111,27,-124,54,-77,-72,123,-79,-89,89,-54,-94,59,108,-49,78,-4,-108,-28,-119,42,55,36,95,-7,123,-99,-42,-6,-100,91,-65,32,-24,-77,106,-5,59,-93,-100,35,115,70,-90,-6,-7,40,-20,76,105,-32,-74,-32,77,-91,114,-126,49,-83,-81,113,84,80,-69,-13,-99,-29,-103,-69,102,-108,-127,-43,87,-11,-126,119,-113,-104,-11,62,79,26,-90,7,-22,-64,-107,77,77,-83,24,52,-90,-57,10,114,-22,-38,115,-52,-37,-63,-76,94,-13,-56,-96,59,78,33,85,-97,-82,10,74,-113,-95,-78,99,50,-66,4,32,69,102,20,-76,-57,-69,-26,5,127,-105,94,-72,-117,-19,-7,-38,-91,24,59,86,9,91,-58,126,-126,-81,-39,28,124,35,101,74,-90,120,54,14,-108,-31,80,94,50,-40,-56,26,19,-5,-37,-39,-117,-45,9,37,83,53,-73,-22,-102,-107,-104,38,-125,-126,90,-106,-98,74,72,21,-56,-76,20,109,52,29,-45,-42,51,-51,-1,122,12,91,-18,-69,-3,55,51,-111,123,-106,11,-108,51,-93,96,-100,-87,91,-51,70,15,-39,-81,35,-54,62,-87,33,-125,-64,-111,14,-89,-109,70,-36,-122,65,-47,126,-119,126,-49,-34,126,46,-87,88,-107,-117,119,29,25,-65,-89,62,-88,-89,-117,103,9,100,-36,56,95,79,-124,66,-126,-5,-9,9,-95,-95,-93,54,-54,-2,81,-106,-25,21,108,105,-9,-37,-97,69,84,122,39,-124,59,98,-25,-67,35,18,48,-105,78,117,-75,-42,-76,3,-107,76,3,79,-81,-61,-99,30,-99,101,-94,-118,112,-88,-82,-19,103,-67,-71,76,-105,-24,-20,-91,83,90,-7,120,34,-26,75,-110,41,62,-77,-116,23,109,74,107,-78,94,26,-125,-13,27,99,49,77,-73,87,100,77,0,93,88,-23,-115,-108,-36,-24,123,-60,-65,-63,-44,19,0,102,-19,69,89,85,-96,-103,88,123,108,-68,119,-99,89,-56,11,116,-106,-68,97,6,-60,52,47,-1,-53,-55,94,-107,-3,-105,-9,-3,-21,-37,-69,18,-59,37,78,127,118,-117,107,-79,-43,124,-108,33,-121,52,-25,-71,76,-2,64,27,-52,88,68,14,25,57,-115,30,-36,63,-16,-75,92,-57,110,-105,-82,-72,-21,30,113,-20,-92,-15,-77,-25,-20,106,22,79,56,21,68,115,98,71,32,122,20,-70,112,62,38,105,48,115,15,47,-124,-71,48,-41,-85,-6,127,9,122,-68,110,-45,-35,-103,-21,122,30,42,-70,68,9,13,83,105,110,98,8,-42,93,-26,117,21,-42,27,-82,110,-123,-98,10,-5,22,-112,29,-32,109,7,31,-91,22,-56,71,60,29,4,-126,63,-64,74,-77,-53,92,-54,-7,-128,72,-92,-20,6,-89,52,-20,46,32,-119,-94,-90,-92,74,106,22,-50,-69,88,107,8,55,3,-102,-64,-106,28,74,13,97,96,110,-59,83,58,-95,-49,87,-106,71,9,125,-19,26,-26,-28,-93,-52,20,49,-63,-73,-11,14,112,121,-65,-128,88,4,72,-29,-117,-74,-33,102,21,125,112,-82,-49,-7,-28,46,82,-71,12,4,118,121,97,28,16,85,50,-24,78,76,74,-47,107,-67,63,-112,-94,93,-59,-32,-48,119,84,74,108,52,-113,-96,-17,27,122,23,-67,-10,33,-54,-63,49,57,-58,-103,54,20,-18,102,-78,-125,20,62,109,7,107,-20,31,-85,104,5,81,-61,51,98,125,-32,125,-90,-100,6,104,64,56,126,-86,24,109,23,15,-100,23,50,-83,22,30,-128,123,-82,-89,14,-82,-48,-36,-92,-12,-65,10,107,-124,-61,-36,-75,0,49,-105,26,101,119,120,-37,-89,-38,18,-55,-118,-47,-92,-17,-14,48,-50,-72,-100,112,-125,-106,126,-114,-23,-105,102,-41,-7,-5,-25,87,71,-111,-76,-11,-106,57,39,-84,-28,123,47,50,-23,-66,102,-101,-65,103,10,32,84,82,32,34,-112,-14,-109,-125,79,28,97,-18,38,56,-70,-36,-6,-78,33,-80,-120,104,27,68,41,93,125,-95,90,-18,-33,-97,-102,53,4,-79,-27,30,41,-51,-72,-74,-102,92,28,-56,122,114,-105,121,-51,8,63,-117,-56,126,-127,-126,84,49,30,-76,-45,-13,53,57,34,3,-85,49,41,-112,-71,127,22,-111,-114,-34,-45,38,44,97,4,52,-111,-35,-98,-24,-53,42,-118,74,-86,-19,-52,-119,-88,22,119,-89,71,112,26,-21,52,35,65,126,117,-110,47,4,-66,21,-8,-51,-72,-120,72,-107,85,3,72,73,-27,-36,19,-114,71,-89,-111,-100,116,-97,-53,87,-68,-121,-29,17,-60,-28,-64,116,11,45,-125,-83,-55,71,4,-3,-123,53,-122,42,-45,104,101,-22,81,-24,49,-37,91,-2,44,-77,-72,-64,-80,-100,-75,-26,-102,108,19,-107,-23,-51,-11,-4,-18,118,-18,125,-84,90,41,8,30,-54,21,-91,-115,102,-99,-35,6,-35,24,102,26,-108,-8,39,-93,1,76,124,-9,28,114,-39,44,9,72,-72,67,-24,-41,-3,-92,-58,-31,-57,29,127,36,16,-87,-1,-124,-34,57,-23,118,-38,51,-19,121,15,-2,-44,8,-87,-82,-47,71,-14,16,-41,48,79,17,118,-83,-84,5,-62,-127,-20,28,-12,54,-95,115,-89,124,-18,-118,40,-125,-97,15,3,89,-21,-19,45,23,-58,39,-1,19,-18,127,-121,-46,2,-24,38,-64,-48,19,81,-16,80,-37,-128,123,-43,36,-73,-127,55,-62,121,14,93,42,56,-117,-43,24,-99,-79,-46,-34,-112,-99,38,11,-19,23,-70,-121,-128,-81,-110,-76,88,-53,-51,-128,51,52,54,-58,-80,-35,83,20,10,27,-109,112,119,38,-19,120,97,67,24,-65,51,84,37,-8,112,67,6,-127,-104,-50,118,58,-1,-97,-94,78,-103,10,30,-95,-94,-42,107,-67,-41,-39,63,-108,27,91,21,-23,-88,-118,-55,-1,-28,-9,16,-29,-37,-55,-80,78,-82,-112,62,48,46,-41,1,34,50,12,-53,46,123,1,37,71,108,3,41,-123,-94,-50,-16,8,-42,86,-39,51,-24,119,20,-55,22,115,-82,114,-86,-110,8,-15,-72,74,83,14,93,59,122,107,3,-17,93,41,51,-56,-125,-21,28,38,-59,69,71,-48,111,38,79,-29,-23,-17,0,-110,75,87,113,32,50,-113,4,-4,12,-20,-27,-61,-41,-117,-56,-99,-77,115,-87,-99,40,-95,-99,-31,26,-102,119,-53,2,4,29,-21,-86,94,112,-82,45,23,-65,-23,-85,-97,-17,100,75,-110,116,1,-109,29,-111,80,-90,74,93,3,95,-48,112,-106,-18,77,25,-29,-22,-117,72,94,9,113,95,-1,-104,-28,-124,12,97,66,-109,33,-94,91,-29,-88,-102,-76,77,21,-65,51,95,54,-16,78,-116,78,-79,-51,-107,-123,2,49,40,-124,-90,97,64,-3,-105,71,14,-114,112,3,124,-83,-105,94,-50,35,59,73,-63,120,-43,116,16,-91,-46,-117,-18,-108,-26,-84,84,75,123,-21,-97,-118,-119,34,72,-59,-108,-65,-104,21,70,-108,63,-35,-26,-63,-11,-55,53,-125,-81,-58,-115,-54,-16,59,7,-12,0,-67,126,81,-72,-118,-76,121,-13,5,27,80,-23,87,-125,-85,-14,-37,-6,-56,-79,-118,-19,-43,-45,72,71,-91,-49,31,-121,34,-90,89,-22,46,116,-62,-59,-4,49,12,23,-39,40,88,-54,12,120,34,26,42,-7,-18,-89,67,-37,123,61,74,-91,-36,-38,15,-104,113,46,0,54,28,100,-44,-75,25,-56,28,103,44,-92,34,-100,-113,28,-75,-16,-121,-7,38,58,-99,66,-20,-2,-122,-19,110,11,-58,45,-72,17,38,-45,6,41,64,-86,36,44,91,-45,17,-93,43,-73,-41,-70,52,121,-71,53,-90,14,115,110,29,36,-46,-75,92,97,102,-53,-88,-32,53,122,-39,20,55,-102,-101,117,82,-26,14,46,-120,-91,85,36,101,-108,-81,-26,-18,115,-50,-47,7,18,-125,-24,-46,33,-24,-108,-71,33,41,99,47,-66,-43,-25,117,10,53,-2,10,-14,126,-112,104,-74,-77,-57,24,-30,81,93,115,69,89,10,90,34,88,-116,-90,65,72,43,123,51,-85,55,8,-12,13,10,-90,-37,123,-4,109,40,105,112,99,64,-74,-83,104,44,-20,-16,54,25,-82,-54,64,-109,-37,-3,107,-17,124,14,60,-64,-47,-72,-84,40,-74,89,6,36,-98,-125,30,63,14,-70,109,-62,-38,112,127,-41,52,115,27,-56,-112,76,-107,-65,-118,26,-74,-53,-96,114,-120,78,24,77,48,60,29,49,-117,-15,-91,1,-26,58,-84,-9,-109,-115,-89,-21,82,104,36,116,-103,121,93,-50,-39,-103,37,52,-108,-28,49,-87,-115,-93,38,-37,-68,-28,14,-26,-41,19,107,-2,-107,-37,-49,11,17,-120,24,24,-110,-100,93,46,-84,-122,38,6,-53,-7,98,102,65,35,-8,-6,44,-99,86,-5,67,-4,-65,13,66,23,-111,24,19,7,9,-92,29,114,58,-43,-105,-61,-33,34,-57,-26,5,-11,77,48,0,-41,-49,22,-20,-44,-30,-99,10,45,47,-51,-29,20,-11,-61,104,99,-15,21,-67,44,-71,108,-83,-11,-104,57,39,-84,2,122,14,127,-110,5,-79,98,95,23,89,3,68,-87,94,-9,40,104,107,24,-97,26,-36,-111,-95,-100,31,-97,49,77,-69,112,-96,-111,-45,89,-9,127,114,85,-102,-5,16,-1,-53,31,-69,-53,113,-6,84,-6,-18,62,-44,-73,68,-15,-105,-36,127,12,-27,-28,-31,-42,51,-121,86,-19,-111,-86,-119,93,-74,67,32,51,73,35,-106,18,70,44,72,-82,50,-19,-45,98,-60,-84,-67,-84,-126,-5,38,-67,-2,-62,-54,-23,-110,113,-14,-89,52,28,-61,11,4,70,-100,-35,0,-46,-124,-11,49,118,39,-80,-70,-100,-120,-54,-69,102,59,39,16,-49,53,-50,-27,44,90,-115,69,-102,-113,65,20,-47,59,-115,127,-19,-54,-19,-27,-28,-94,39,65,-114,-115,75,-46,-85,75,-4,-67,127,27,-98,-42,1,-124,-43,22,-21,-27,-74,53,-45,-90,127,-83,-44,-86,-23,10,36,86,59,99,-126,108,-59,-99,-45,-16,91,-33,110,-120,106,-87,19,122,115,-86,85,67,-83,-4,-57,-111,4,-5,-58,-91,-2,95,11,-53,107,-68,-128,-68,-12,85,19,-36,-40,-56,10,-64,58,-12,-32,79,20,37,-65,-33,-9,88,123,114,94,31,67,-32,-2,86,-124,-116,-62,-100,41,-17,35,-81,67,-110,-85,83,45,-121,5,-120,-3,47,14,-65,-78,-114,-87,-9,-19,-21,-7,106,74,117,-40,78,-33,63,61,-70,26,56,-9,76,-121,14,-77,87,-125,69,-32,-101,50,30,104,-59,-117,43,80,-98,-11,-94,-23,-108,52,-38,97,24,-10,-41,125,-119,-19,-42,-56,25,65,7,-39,-102,-4,110,109,74,18,13,-126,96,95,-89,99,15,-3,106,6,72,35,82,-78,-15,73,116,61,-127,-83,54,98,-17,2,-7,88,-57,-37,-39,-102,-79,31,-6,111,-62,-24,103,69,74,113,-15,65,68,37,-65,123,94,117,-121,-32,-78,-5,120,59,104,60,68,5,-65,4,64,-85,-80,117,-101,61,46,-88,69,-123,-19,-57,-15,97,125,54,-23,84,-124,-27,114,-47,16,104,-100,44,-87,36,-27,81,-20,-73,-80,95,-64,-34,29,-77,66,-126,77,-120,105,-100,79,44,116,-18,-15,-27,-71,19,12,-80,-18,27,45,-92,116,-27,-14,14,-77,1,-40,-110,-26,-4,-120,-88,60,51,108,-101,-123,116,-83,111,1,-74,-69,87,11,124,2,93,-64,121,-45,62,-79,110,-37,-55,97,27,110,-79,-91,67,99,53,26,-74,43,98,9,-43,-103,80,-23,60,68,-36,-112,-64,-31,20,-52,-79,-7,-113,94,-30,-100,73,55,-111,-1,87,-29,-25,-94,42,-13,-63,-59,108,38,-16,-62,-85,-17,0,-90,47,116,-80,12,-11,-54,96,-12,-110,-6,-128,-64,-31,-109,103,58,-11,-118,-3,0,-102,64,39,-18,-67,93,95,102,-87,104,88,-62,-31,-36,-61,-105,-26,46,-53,117,93,-70,-54,-103,121,52,-24,82,-10,-124,-22,-122,29,84,-76,121,-64,-65,-6,80,52,-27,7,108,-118,64,-82,-44,73,81,-107,84,-88,-100,-59,-56,9,35,-39,-82,-68,26,65,-66,-73,-15,75,-31,-44,51,-65,-73,-62,100,51,78,-51,-112,-84,82,-19,93,-92,-69,53,-38,-66,127,5,-30,61,26,43,48,-63,24,31,-71,-67,-127,-60,-55,-26,38,-43,-63,-49,-37,-101,116,105,-109,10,3,-67,17,-42,-89,110,62,-103,-41,78,-47,-59,-47,-17,-51,10,-16,-31,68,-41,37,15,-123,94,101,77,116,-122,61,-96,-122,-8,-11,105,-74,109,-97,-111,114,44,105,45,42,-94,-99,-52,122,-113,87,-59,-109,85,-128,120,-49,21,-75,-89,-10,11,120,-51,-19,30,-79,-26,64,-32,-71,28,-11,-44,55,-28,109,59,-84,-22,-55,-113,-105,114,80,50,-26,77,54,36,42,-71,-64,-111,118,99,-121,-100,-128,56,-75,-10,-74,30,36,93,-122,16,-50,-105,85,19,-84,-99,-72,-20,96,-63,75,-53,59,-86,90,-23,-39,-73,96,-118,-127,-9,-106,42,-84,-122,108,-18,81,29,-58,46,94,12,-2,-94,-75,33,85,61,-100,122,2,101,106,45,-49,-43,-63,22,-128,94,5,-115,38,35,54,-8,15,35,87,-114,-76,110,37,-50,20,-114,84,115,-13,48,54,14,-58,-93,112,43,77,9,32,-99,-91,-55,34,-82,23,-40,17,62,66,84,82,-3,117,-100,33,32,19,-100,102,93,101,-33,-103,112,-38,114,38,-1,-89,-90,-86,-9,-101,-66,41,-71,-113,5,21,-40,50,89,-73,123,5,45,-75,68,58,-107,-67,3,-64,89,45,-117,51,16,-119,36,69,-78,-18,94,-18,61,22,-124,97,-55,-97,112,19,119,7,65,-109,23,-15,88,-47,-103,-84,-62,106,-5,-108,73,-109,34,-116,33,81,-41,-102,81,67,20,67,-46,-40,-9,10,-49,121,-57,61,-33,28,42,-36,-67,-113,-38,-94,-89,-67,-28,-17,52,-116,-96,-51,117,29,-84,-53,-38,-53,-44,54,-110,98,-76,117,18,83,10,-62,-36,102,104,80,124,34,15,108,47,91,-112,-10,-116,66,-68,-123,55,-67,87,51,74,-47,25,-122,-34,57,32,96,-96,-64,67,-41,31,-124,-87,-15,76,-125,1,-77,13,99,47,-44,74,97,67,-4,108,-9,-16,44,36,-53,3,-120,105,99,-55,-34,-30,118,8,106,40,-95,-122,-65,14,-23,86,-26,-64,114,89,-59,97,-10,71,10,-108,-60,61,-87,-19,-4,-28,-1,-32,35,-123,55,109,-47,-126,-1,-124,-36,120,3,-107,-17,121,-80,31,25,79,-32,127,-19,103,-4,118,21,-55,70,125,-95,-104,-78,-2,-24,90,-33,97,-79,-92,20,126,49,60,121,41,56,120,113,-102,74,1,-28,44,46,-19,-46,100,-127,77,-64,-8,-12,-13,11,-15,89,22,-95,86,36,-105,110,84,-83,37,-40,-56,-92,19,-82,-17,-25,83,33,4,-111,76,-85,-54,35,-107,-72,127,76,89,-103,-123,28,-96,-47,95,77,107,-35,-98,52,59,-76,75,87,-14,-56,-27,75,117,-34,67,91,-92,-95,-45,-116,-13,-81,5,-35,83,10,85,-112,-38,117,89,43,123,-73,-43,104,36,-106,-80,47,113,-82,51,36,93,33,-84,11,-53,-128,-84,82,-86,-118,0,-33,-6,44,-122,35,81,-71,-44,-73,-64,126,98,-20,-49,-126,-104,46,44,-63,-17,-62,-74,-61,-48,-28,67,-25,-99,92,66,73,-38,49,45,-69,92,-26,-91,80,105,-30,48,-76,85,108,-98,-56,-95,102,47,6,-70,-118,-31,60,-112,-62,89,115,-78,-85,4,36,-1,72,-17,-100,-56,-2,-104,24,-54,-56,-92,-106,-60,-115,-53,-106,49,85,33,-79,54,-77,44,-120,47,41,-60,44,-8,-28,5,90,114,42,74,106,-57,-81,79,83,-67,-97,-90,-120,-16,-57,-88,34,9,7,-107,-59,-92,40,71,-32,113,-85,89,33,89,-58,-78,-50,-22,58,96,66,-19,-125,-39,-42,90,25,70,-104,-31,-90,-21,98,118,-111,102,-35,44,-117,60,86,-62,-47,-4,14,-88,46,79,6,-81,-5,101,99,-12,96,43,-27,42,65,-3,-120,-93,112,32,-6,-111,89,105,122,-67,50,57,-54,-126,-46,35,48,-41,0,-98,71,-22,45,-125,7,81,-26,23,-60,118,25,101,-95,-128,117,22,-126,-29,74,86,-39,-53,65,-86,64,-62,-77,-8,90,-85,54,-28,-128,124,-1,-112,127,105,-124,-40,63,123,123,-77,13,-84,-5,53,-31,-46,-74,-36,27,-16,13,-124,-98,-24,-115,-83,48,101,92,13,-98,-5,-111,-10,-40,-51,-115,-81,-52,-82,24,102,97,98,109,107,-46,-1,109,50,-48,40,-23,71,34,-70,-13,-111,110,43,-41,-9,108,-1,37,45,-72,-28,-45,-50,9,121,-66,-4,-86,-10,18,16,64,-119,-36,33,-13,5,-125,93,-6,19,-61,126,95,48,-116,11,125,-62,-6,67,-1,111,-54,2,45,82,-103,-4,-66,19,20,18,15,48,94,-91,119,33,82,-15,116,-24,15,67,30,111,-106,90,13,80,-20,71,65,66,108,124,-94,-104,-124,120,-95,59,-80,16,83,-101,90,14,-96,25,-64,-38,98,-24,-17,-69,-89,108,-29,-30,-101,-11,99,13,-56,53,72,52,105,105,88,2,26,75,23,-13,3,122,-114,71,-70,-29,-9,-98,58,67,-122,87,126,7,-30,111,-61,69,7,11,-6,103,-6,-16,-32,56,23,94,-31,29,-63,-47,5,67,61,110,43,57,54,41,28,74,-65,97,-22,74,-115,-126,86,0,-50,-83,-93,-3,116,5,22,-29,21,-79,34,-54,68,77,-34,-76,84,-116,-102,-31,-13,-55,64,85,-42,44,43,-115,85,100,-104,-60,103,-54,-65,120,-69,44,59,-102,107,81,89,-79,-44,121,70,-24,-110,51,76,75,117,-7,110,61,-102,42,-28,-28,-67,-12,-19,102,-27,18,115,121,-46,68,-124,-81,-110,-33,108,56,-83,30,-97,4,-79,-17,88,114,-86,105,17,-9,0,61,101,11,7,14,-100,58,-38,-42,27,121,119,-48,56,62,94,39,-20,-49,7,26,108,-99,-44,120,-2,87,-117,-78,-56,64,76,-83,26,-105,21,-3,81,8,-74,-100,67,50,9,58,-14,-118,-96,-13,27,65,-122,-73,-83,102,-40,-60,-120,-13,16,51,-51,112,-81,-15,-7,127,100,-116,-20,83,-72,59,-39,121,-43,114,55,97,-9,-53,107,56,45,49,106,-102,-126,-54,-44,59,18,-64,-75,101,62,-123,-110,-70,-17,24,57,-44,-122,104,-119,43,-40,18,-113,-107,25,122,-90,-19,123,74,-86,-35,107,102,-51,-22,56,-14,109,-100,-124,1,-85,35,-16,-124,-21,-65,1,30,-75,55,67,-121,-78,109,-102,82,-94,-23,-60,46,-104,0,-96,6,39,12,101,62,-39,37,-84,-92,3,48,68,34,-47,26,-67,60,-2,25,118,-110,77,91,46,2,43,103,-85,-107,-23,83,-23,-71,-110,-7,42,43,-82,16,57,-55,-102,-52,-32,32,-111,-70,75,116,116,-11,-44,-75,1,-14,-123,-128,-85,31,71,33,78,-72,-102,70,48,-72,-15,60,56,38,79,93,-83,114,75,-6,120,-78,25,-127,82,112,-37,-90,-92,-121,-112,-35,119,8,-32,-35,77,58,-9,109,-107,69,-21,11,-42,-128,-70,48,-23,-30,-78,-81,-123,30,-40,-8,-127,106,9,64,-78,-51,122,95,81,-109,-15,-43,118,27,-92,88,-109,37,-106,52,-62,-8,119,-45,73,65,127,-96,53,-115,-125,46,89,47,115,8,70,71,-40,-107,15,24,-119,-64,41,115,54,-11,-108,-103,-20,6,104,-67,-8,95,90,102,19,15,-22,73,13,-7,113,55,-53,-123,51,-110,40,37,-103,-83,-61,34,114,59,-25,-113,87,-103,-26,-10,88,-121,-65,-79,92,-63,123,-62,59,31,-87,-11,31,113,14,88,23,25,35,-49,-21,-83,-59,53,109,-72,-22,-64,89,59,-104,-42,24,52,-60,62,91,3,7,-21,61,15,-117,-109,65,-1,-39,25,-34,-37,26,-2,62,-51,61,24,50,-15,-32,-48,-55,25,36,24,6,99,94,-25,86,-84,-30,-95,-102,-94,-53,29,-81,65,69,-85,65,117,-7,0,-23,-66,-75,127,62,-108,10,-5,-4,66,29,-59,41,-82,-55,58,65,9,-128,55,-67,-58,-28,123,-121,99,-70,-99,11,-6,122,-108,119,-18,1,78,61,103,121,-104,117,-68,-22,-108,64,31,-68,-68,52,-96,41,58,-54,11,-26,118,75,14,-54,21,-119,60,-66,-19,-64,11,-5,76,-9,-97,81,-126,72,62,-115,64,23,117,65,73,-121,-87,-40,-48,-82,90,73,-91,42,57,-53,54,6,-11,102,-104,0,-117,70,52,103,-56,104,-1,-103,-12,32,59,123,12,-75,-104,16,-123,31,-35,55,20,-116,-109,-50,-44,-63,24,35,76,-116,-29,-32,16,-43,-68,-56,-115,32,109,-9,-34,126,-39,-74,74,-46,-19,-105,-82,-115,32,17,94,105,-103,-50,68,-121,-29,-7,53,74,77,-123,98,-68,37,62,-8,-21,-23,-99,4,-80,-103,-58,45,-2,-95,58,5,35,19,-37,-65,108,-14,-90,35,-53,-123,28,-5,39,-21,-38,17,70,-53,30,94,62,24,-74,34,14,101,46,20,-61,94,-121,125,-122,88,-127,36,-97,-98,110,80,80,14,72,10,8,95,4,50,113,27,-124,54,-117,-48,122,-39,52,8,94,61,40,-69,21,-34,7,-56,-90,-123,24,23,57,89,-87,-97,-80,-16,63,-50,76,-118,-25,-17,90,24,-4,-112,32,-94,58,-32,-12,11,28,48,-38,118,-69,107,92,61,-104,116,-62,-112,55,-110,0,127,-46,-54,-57,17,116,54,-36,-90,114,-39,-32,53,33,-69,37,72,-70,121,60,-84,22,-95,-74,-105,-7,-67,-41,-49,55,98,-57,60,-51,-107,31,48,48,-72,-38,-35,-5,29,65,-102,78,79,-8,71,-113,122,90,76,-55,-31,77,102,-66,107,-128,112,101,122,-62,-83,111,126,101,-75,-55,-118,68,52,-128,115,76,63,32,-6,90,6,100,-109,-59,98,19,109,-1,114,84,-58,-52,79,95,121,114,-77,-52,56,-114,-13,67,91,-51,50,-94,-115,113,-58,-33,56,55,-92,-120,80,-85,-125,126,-114,44,-126,22,-29,113,-82,-92,91,63,-39,-34,-90,-21,43,-3,113,-5,-81,-91,69,120,-59,-126,127,66,43,113,-111,47,-99,-46,-73,55,-13,-7,73,110,37,-76,68,13,105,94,-36,108,10,-127,-76,10,126,100,21,-117,-80,21,-95,94,-79,77,-72,-63,98,24,93,-124,7,25,-15,84,-62,-99,28,-82,-99,113,-65,13,62,-51,-117,37,115,-125,-40,-96,85,70,31,-27,26,2,57,-15,43,-112,-36,-72,-5,106,44,126,-97,111,-31,-66,-89,76,-114,51,-111,120,69,56,-106,-70,1,105,-54,-56,-8,-123,-92,-71,40,-20,-52,-93,-102,76,-104,48,77,76,-30,53,-113,40,-16,88,44,34,-107,53,18,95,-21,123,-115,-28,53,21,47,76,82,-58,-114,22,-104,-97,-90,73,109,7,-108,-96,-30,89,-84,-46,-47,-62,110,-128,25,-54,-75,55,-62,121,42,69,-62,54,25,7,-75,122,87,-68,88,-83,-95,38,-100,-103,-96,-57,74,109,-34,72,51,86,89,66,120,85,18,-84,95,101,-86,-32,15,48,-104,62,-99,115,43,-14,76,76,-92,-5,27,-8,41,-114,-74,50,-77,-67,-97,-109,16,106,-36,-52,85,16,50,-68,-27,-22,-99,-112,122,63,-15,64,23,23,121,54,-31,64,126,76,16,-57,18,-75,97,-23,-94,-94,72,-53,-40,30,-55,-63,87,-13,116,9,-64,-72,11,-90,-45,11,59,44,110,28,-105,-80,62,-27,20,46,-7,45,57,5,35,126,29,77,-91,-65,-60,10,-56,-115,-42,-17,115,-67,34,56,12,39,-119,-66,-20,22,-39,-102,54,108,1,-75,107,14,-104,-87,-127,-17,-88,33,103,-71,-85,23,-76,-95,-94,107,-102,92,-96,121,61,-98,78,-28,-33,33,75,32,-10,-14,-125,-96,-72,-4,10,7,-65,-52,-27,-71,92,100,61,45,87,9,-43,-52,110,-70,19,-110,45,-66,-74,-126,91,-27,106,58,-110,114,-86,-77,-52,-63,-50,67,-65,-54,33,37,116,64,49,76,-7,-115,22,-105,-124,50,19,81,-126,86,124,-5,-37,-48,19,-65,32,-21,80,-124,-93,-23,-25,16,24,97,65,29,51,56,-79,80,-117,-50,14,-23,-77,87,96,125,-52,49,2,13,55,61,107,93,-106,-116,102,-11,-37,-23,-119,-43,53,-39,-86,0,-96,19,13,15,15,112,24,76,-73,79,-76,-127,99,90,-18,63,119,3,-29,38,111,34,-66,111,-34,31,-29,-95,24,-70,5,-15,65,86,-43,16,76,-127,-120,21,6,-29,97,53,-31,-57,-39,-117,83,-48,-99,38,126,56,-78,-18,67,43,72,100,-96,-37,109,89,-92,94,-88,121,36,112,-33,-42,-69,-99,112,116,-80,-42,49,5,20,124,26,-32,26,-118,-28,65,22,13,-105,-98,81,124,40,52,-76,-104,97,82,59,96,-99,-27,-46,-74,-125,64,-36,-31,114,-28,-83,-61,81,-81,8,-49,42,36,48,-81,12,68,-80,83,38,-46,-115,93,-86,-56,62,-52,-36,-88,7,-85,-80,5,38,-106,-8,-94,-125,-81,123,21,122,-112,45,116,-37,81,48,-122,93,32,-120,48,-28,-85,-99,50,-47,-67,-109,78,-14,-79,10,-98,56,41,-22,-20,10,74,94,-30,-120,110,50,74,86,91,51,-86,43,-44,11,-11,65,127,-97,-24,-31,119,-16,-73,-66,87,-95,109,-64,98,-127,45,-30,24,-11,61,54,76,109,24,126,45,-1,-24,64,-28,28,-113,114,-32,-103,-125,122,95,102,-33,-7,-25,-28,-101,-7,63,109,111,-9,-45,73,-111,-41,-48,-70,-40,-113,28,-32,-41,-95,76,33,-112,-53,-106,75,117,71,-94,81,19,19,53,96,-9,125,-82,40,6,85,65,36,68,-91,59,9,65,91,-67,-34,121,65,125,-25,-38,-107,-106,-122,-83,20,109,45,122,-103,-31,-42,84,-42,23,-57,-69,49,27,41,-116,78,3,-65,-28,59,-52,-101,-29,-91,-29,37,86,113,119,-51,-104,-19,-84,42,-113,90,125,-32,65,37,-21,119,11,126,-13,-37,-49,59,-80,60,-114,90,7,-117,-22,-84,-50,4,69,58,-93,106,110,-77,-46,125,93,78,-124,-20,73,-42,75,-60,-52,-59,80,-5,-105,6,-14,-58,-72,-59,34,59,-96,-46,-102,76,-8,105,-49,-79,-47,-81,-94,93,77,-100,-119,-115,-115,-102,-68,69,107,-126,-86,-103,83,91,-26,-42,-84,73,-54,5,-104,-85,-61,-28,100,22,-71,-126,97,-43,-128,38,41,88,112,94,39,-84,-55,-119,-115,36,60,107,1,87,-45,-114,-80,-9,88,-105,-91,-67,90,-111,95,-96,-113,-103,-70,-24,91,-113,-122,-70,-83,-92,121,-20,117,37,-10,-105,126,82,89,81,-2,-118,-21,36,-9,-85,-103,124,65,-6,-45,118,-33,-5,122,-113,124,87,-30,58,-47,-43,-10,54,-116,88,44,-17,29,94,-59,-106,41,54,101,-86,98,-116,-12,106,-12,95,-29,13,-103,72,-73,55,6,122,124,-106,79,54,17,-93,7,-101,-72,69,-102,-43,71,31,-44,92,28,37,-104,127,-7,54,-50,-74,-35,-125,-16,-119,-17,28,-44,122,117,63,92,-23,14,82,-28,122,-90,-38,26,88,22,-74,127,115,-128,111,61,-41,-9,-104,31,112,29,37,53,-3,52,58,-27,66,-73,-76,27,78,-33,92,-125,39,95,110,-96,-61,-16,-125,80,-107,44,101,63,114,-101,47,-47,124,-31,21,-99,-57,46,24,-24,18,-104,121,68,-113,-76,37,-71,102,59,-10,-124,112,121,123,91,78,-14,-17,32,-82,2,49,102,-47,-30,-83,-19,-3,-50,67,-42,41,-21,-92,-72,117,-74,-111,97,26,18,-26,-78,104,67,41,48,122,-19,108,105,64,-45,-111,-45,43,-66,-80,115,84,-36,81,-31,59,28,60,-10,125,30,72,-64,105,45,52,-74,11,-16,38,-118,-3,98,-46,-77,40,-69,70,-114,-77,60,-70,123,83,-80,-102,42,100,81,109,-77,115,-127,7,-87,-22,8,-48,57,-72,-41,-41,-9,3,80,-54,-30,103,-16,-54,118,105,-87,-37,22,71,-33,-48,121,62,116,-90,66,-38,22,-105,19,-21,83,-41,112,-39,-81,-28,-109,31,-95,-125,-1,54,72,-84,-108,112,-114,89,120,-73,20,110,-55,-126,-58,-93,68,-105,65,-107,122,8,121,-103,-97,61,97,-74,99,-65,46,1,7,57,-122,69,100,-112,-94,94,116,23,106,85,-105,79,-128,-108,39,-111,-87,83,-66,112,24,-102,-7,-72,-97,-78,-8,99,-114,-113,79,115,89,-51,-88,83,28,-90,56,113,57,-102,40,-104,89,-76,-8,38,-67,-5,-9,-18,-121,38,27,-25,-29,-110,3,-10,16,123,-40,-93,116,-36,-20,-73,-18,-111,87,-123,113,120,-121,-97,69,-47,105,-68,-111,-97,-53,-94,-81,114,77,92,46,-37,-80,-18,108,-9,-69,-25,27,-46,-101,-86,53,54,-109,-44,-11,85,-61,-87,-17,34,-25,79,101,-46,-22,-30,99,85,-65,-30,12,117,-80,-23,54,-16,106,-89,-29,-120,64,1,-111,-94,-75,82,68,-3,120,11,-52,-103,87,22,-17,-46,-117,-63,112,12,-123,-52,71,-121,-122,-55,-125,101,-41,105,52,-53,-9,60,56,-3,-1,85,-112,15,127,70,4,-7,48,-72,34,-29,11,-103,114,-46,56,-109,17,-32,9,89,114,-1,92,86,-55,11,-87,-80,53,-18,-4,42,-90,86,15,-50,49,120,-46,22,67,57,-59,90,-97,110,96,119,43,100,-90,-54,-89,81,21,-80,-14,64,-47,126,-17,92,-37,51,40,121,-34,110,-99,-54,36,-73,85,-43,52,-30,-9,121,-18,-51,102,91,-116,-71,95,86,-55,95,-35,74,118,101,87,-114,20,-48,117,-60,-76,55,49,-108,74,-22,-43,20,41,79,-96,114,-12,-68,-44,43,126,-28,19,83,111,-128,102,-19,-110,56,71,-77,89,17,-16,-26,32,-27,-127,-14,-37,62,-34,-107,126,110,104,74,6,85,79,8,-74,107,30,126,-52,80,-11,29,108,65,-128,29,109,-2,123,59,28,-107,110,62,110,-123,-68,71,-39,-20,-57,-108,38,-36,126,-12,100,112,-103,-32,55,98,-5,-82,89,-41,88,36,-92,99,-56,118,97,12,113,-16,88,71,76,-96,-77,117,-5,60,-84,23,45,-41,31,46,33,0,-3,69,38,4,-119,-20,-115,96,-50,28,-9,-38,85,-113,-106,36,3,-96,-80,-23,7,-19,101,-111,92,-107,-9,116,53,-120,5,-3,-13,-87,1,-115,-35,-125,-89,-23,19,53,69,117,-67,-107,-33,-122,-32,-10,-69,-122,75,-116,-69,-35,43,-74,-107,109,18,107,-85,-48,52,-38,83,50,115,-101,-39,5,62,-7,-46,99,97,44,31,78,27,105,-117,-72,-94,-69,108,-86,-59,-30,49,-48,-22,-124,-2,-114,-19,-126,-29,-122,-21,67,15,60,-111,-55,35,-22,81,37,32,-75,0,56,-18,47,108,41,0,-120,122,-4,95,51,-68,-20,78,125,77,119,-9,-115,109,59,79,-128,-124,-114,9,7,91,-8,-80,11,-112,29,-32,-56,11,-50,-82,29,74,-19,-55,-6,12,-115,-6,18,15,-123,72,-15,-62,12,1,43,82,-30,-17,2,26,-30,-85,58,63,-56,-117,-100,52,-90,7,-69,-26,121,-92,111,5,-61,96,-90,63,-18,-11,60,-52,-81,99,125,25,67,-71,82,110,97,51,122,39,33,28,93,-116,123,-107,48,-64,-9,92,-31,-62,-68,-102,-103,-107,48,-100,-2,83,127,-82,41,-105,-7,-120,113,10,58,23,-122,84,-18,-37,20,-82,11,42,46,-95,16,-105,-58,-78,62,-82,-57,39,-18,106,0,52,-51,-59,36,76,98,124,-108,-67,-40,73,-3,19,45,-45,121,20,76,0,-21,-57,46,90,-18,79,66,-42,-56,-47,-39,-120,90,79,103,-104,34,-30,-67,120,94,35,59,25,-41,-128,125,88,88,68,-48,-25,-47,-10,-12,125,92,20,-99,55,66,118,-42,114,46,67,-9,43,37,119,-84,-8,79,-21,123,82,48,76,-63,-17,-23,27,-108,53,97,95,-109,41,68,-50,-32,-20,-119,-71,80,-57,-9,-16,-4,-36,17,66,19,82,-113,-76,39,23,-128,47,9,-87,30,-35,-48,100,96,15,-4,-58,-86,-10,-1,83,-52,17,-102,-88,37,-13,-2,-92,-23,-52,-89,-112,-33,-47,60,28,122,-101,-99,-67,92,-88,77,118,101,-96,-123,-108,-108,-43,102,45,44,-48,84,110,-25,-74,86,50,-7,-109,-9,-92,59,-67,79,29,23,53,-57,73,-89,9,1,81,65,17,31,-107,8,92,126,53,-119,52,98,60,-126,-82,15,79,-15,110,111,-82,22,88,-110,-113,-49,-124,-127,88,-51,-48,-87,-55,-17,62,45,64,41,-111,-95,-46,-122,-91,116,-125,-55,103,75,-29,95,-56,29,-115,-36,-41,-56,88,-100,-81,-33,-81,29,-11,-90,-17,77,-10,-127,-121,-6,30,-4,-24,30,-124,109,112,67,25,-57,4,34,79,126,126,-109,-47,-101,-38,-9,117,-76,37,-43,-120,-86,54,85,-70,56,39,-15,-40,-80,26,3,-64,-45,-35,-69,-120,70,-97,24,-29,-53,69,19,-113,-112,-53,-78,-106,-74,94,-61,78,-57,-58,97,46,58,62,-21,-121,-97,-38,-16,35,35,-120,-127,125,2,-30,54,-44,-17,9,30,-20,30,-53,117,52,29,-92,95,16,60,102,-29,54,-66,-110,122,10,-113,-78,68,-120,-71,-96,111,-37,9,39,-11,111,-52,-25,107,-77,-9,28,81,0,-55,-98,43,-97,-37,69,-123,-4,23,102,-98,106,-11,98,-42,5,115,-84,-121,-86,-78,11,-69,34,-115,3,-94,-104,-9,-38,51,-113,29,83,-39,86,54,-27,-116,-108,61,27,10,-44,65,-86,-91,34,-40,38,99,-14,101,-82,126,-56,-8,-102,37,-52,102,-36,126,74,95,-83,113,-37,-66,-55,-20,-98,-115,96,-49,-44,-123,-1,20,75,-2,-90,10,-61,107,94,87,-63,74,0,-55,2,41,-103,-123,-85,-13,-39,-107,36,-47,-21,6,-70,98,-119,78,52,26,-40,8,72,117,-78,115,76,-57,43,-60,-25,-87,36,83,54,127,127,-78,19,98,-30,125,86,121,124,62,-32,-96,-110,20,97,-126,-104,13,6,-122,-105,36,55,105,-121,-48,-83,0,-113,18,-114,-39,9,20,-20,-23,-115,-49,83,-107,121,70,-30,86,31,-48,-23,125,-67,-114,48,-86,21,-90,83,-79,64,-107,-60,-91,54,69,-73,-77,88,99,-10,15,-29,57,-128,-47,-96,101,-50,112,120,-85,-16,-78,27,7,116,-128,18,-11,49,-19,41,-33,15,-35,-67,84,-15,-57,36,-73,41,15,77,9,83,39,-54,27,-82,33,115,4,-60,101,46,-117,-56,-18,74,100,126,-27,-48,-25,10,-51,126,-41,-81,-95,-60,9,85,99,-6,80,-16,27,77,108,44,46,114,-26,20,-69,92,15,98,107,-114,-59,-87,28,-61,-121,84,125,-44,-125,-13,116,-55,-120,94,-84,-75,-86,34,1,-25,121,-80,26,-97,43,-12,31,75,-58,84,2,12,-109,-61,-68,-21,110,92,-27,-117,13,36,21,-3,107,-125,80,45,87,-108,22,41,-61,75,-115,-29,29,33,-111,-22,-4,-94,8,97,24,-124,25,25,-52,-7,-74,108,-36,-114,12,-32,3,84,75,-60,34,-88,-10,84,96,12,17,-119,114,-41,41,-3,-48,-16,1,-14,21,-115,-11,96,-25,-36,10,-14,-71,-3,-83,85,6,-91,-18,81,-108,36,-33,-59,70,-80,-81,11,-31,19,74,107,-22,91,8,29,57,-95,-80,-40,61,-82,-110,122,97,-114,-102,123,-77,83,122,-24,46,-121,-28,18,111,-47,-35,-120,-102,114,-93,115,22,-82,113,-78,77,76,-66,117,65,28,86,27,82,79,-128,-88,119,63,-31,87,11,124,-10,-99,-71,94,-89,76,-82,-124,101,58,-53,-74,9,-114,-50,31,-3,-51,-119,57,-29,-75,92,113,-47,40,-103,-81,-43,-12,-100,-102,4,-36,12,-26,-70,-118,27,-88,50,28,-73,-113,-94,-1,122,4,-57,-126,124,100,70,62,-87,7,-91,100,-91,-102,-56,34,102,118,44,-47,-90,24,-32,-99,30,-98,36,-124,113,11,-126,-15,-84,72,117,-46,3,-18,97,-38,-73,24,-47,109,-4,-50,-86,88,-112,-97,-65,112,-73,72,-37,20,-125,-29,-43,51,-2,-16,94,119,58,-101,-48,-116,121,94,103,64,52,48,51,-113,-70,106,41,-44,82,111,-106,71,-62,-105,-66,-78,78,71,115,-123,-50,4,33,22,88,-40,-111,-82,-46,-34,-67,120,-58,-28,-18,-126,-52,-31,-109,84,11,-94,10,94,-15,-89,-106,-62,125,-6,98,-39,62,-11,-34,12,12,-18,-50,-60,-78,43,104,36,50,-62,-58,-14,-36,-104,-88,21,78,-18,43,-124,-118,-68,-35,52,-62,102,18,25,87,-106,-78,74,29,127,98,-99,-2,-86,37,6,80,-31,86,77,112,-51,121,70,-126,7,35,-85,3,-24,-78,-109,114,-25,-58,-127,120,-78,26,8,-100,-116,10,-23,-20,14,-18,42,120,-75,79,60,44,-58,102,-104,69,25,119,28,103,-70,22,25,26,124,3,-11,-15,10,87,120,-23,-68,-44,7,93,9,-8,125,-15,-79,-70,108,15,-66,-90,-82,-5,-14,115,-122,-75,74,127,-100,108,4,58,66,-106,-117,1,6,11,-69,-96,55,-65,-8,102,-72,-41,75,76,-2,16,-10,78,-42,59,-72,-1,-31,-100,113,26,-66,48,-4,103,57,71,-94,-2,14,-28,-36,22,-8,-25,39,-51,25,99,91,70,63,11,-124,69,46,-34,-21,99,-70,-110,-90,32,116,34,-74,82,43,-104,-56,31,-117,-43,67,12,-72,115,-84,-62,-9,21,-30,105,82,94,86,12,40,-47,-39,40,-114,-67,-89,-72,-64,-62,-124,-105,32,95,-124,-41,-14,48,26,8,-116,-57,24,-45,-45,-75,-40,-111,-118,107,116,66,-97,-57,-79,-96,-85,-55,49,-55,-32,-87,-76,-12,42,-85,85,-16,75,-41,-112,49,-29,-28,-124,-10,-60,62,-2,-112,15,-36,-33,81,-95,117,120,51,99,-64,30,11,106,-21,-42,43,-59,51,117,12,45,3,-116,110,88,104,60,67,102,-74,108,80,-58,-108,28,38,-108,16,63,100,-24,-36,-1,70,97,7,32,118,-112,-122,-31,-36,106,10,115,-89,35,58,-15,-5,63,19,-123,-99,-11,-94,108,-18,-13,70,-12,-1,126,-15,-9,-25,113,111,66,-59,81,-88,-114,97,-121,-76,16,8,72,62,3,-107,106,-43,92,-91,63,60,-90,-61,96,-9,93,-24,-17,-22,38,-24,29,-27,-36,-25,117,99,-10,76,66,-77,-71,33,-87,100,48,-13,-122,-49,56,-104,72,72,-84,103,72,115,-10,45,19,-22,52,-97,-77,-107,50,-81,-93,-79,102,-71,46,73,6,-21,-52,5,-96,32,112,15,-44,-4,110,5,-26,-85,89,-87,35,73,-17,59,-95,-5,-123,94,127,-83,9,-122,-64,-58,-72,-111,33,-91,-82,56,63,1,6,-67,-106,-55,26,-12,-105,-32,115,-38,-95,118,117,67,-17,95,99,120,-75,2,28,-113,-105,117,-15,111,22,-46,116,25,-91,40,44,84,37,-4,-66,-125,15,69,-14,49,-12,-11,87,-68,20,91,110,117,125,-65,-34,-36,84,-29,-87,-27,60,-66,-118,-125,49,69,81,54,7,-119,53,-23,-60,-9,22,-116,-125,-58}
+
+#define IP2_PRUNED_WEIGHT {0,0,0,0,60,-92,0,0,0,0,0,-80,78,0,94,0,0,63,0,-121,-61,26,0,-125,-79,112,-45,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-106,0,0,0,-126,0,0,-73,0,-89,0,0,0,0,0,0,120,0,116,0,0,0,0,113,0,0,0,0,0,0,0,0,0,0,0,0,-63,0,0,0,0,-87,0,-126,0,0,0,0,113,0,0,0,0,-72,0,0,-103,-97,0,0,0,0,0,124,-119,0,0,0,0,88,-76,0,0,0,-47,0,33,0,71,0,0,-111,0,0,0,0,0,0,107,-118,0,0,0,0,0,-73,-101,0,-20,0,0,-121,0,107,110,103,0,88,-85,34,-90,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-59,0,0,0,-76,0,0,93,0,-100,0,0,0,0,0,0,-79,0,-46,0,0,0,0,-94,0,0,0,0,0,0,0,0,0,0,0,0,95,0,0,0,0,-65,0,7,0,0,0,0,120,0,0,0,0,108,0,0,127,96,0,0,0,0,0,-112,-115,0,0,0,0,22,109,0,0,0,68,0,94,0,-121,0,0,83,0,0,0,0,0,0,58,-104,0,0,0,0,0,115,94,0,100,0,0,-69,0,-106,-43,94,0,120,121,-93,-97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-102,0,0,0,-34,0,0,117,0,59,0,0,0,0,0,0,-19,0,94,0,0,0,0,110,0,0,0,0,0,0,0,0,0,0,0,0,63,0,0,0,0,-93,0,-127,0,0,0,0,43,0,0,0,0,116,0,0,115,-22,0,0,0,0,0,88,57,0,0,0,0,-123,-51,0,0,0,-98,0,-109,0,76,0,0,117,0,0,0,0,0,0,94,47,0,0,0,0,0,111,-61,0,-111,0,0,-74,0,-38,-116,111,0,-39,-121,97,109,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-41,0,0,0,110,0,0,62,0,-127,0,0,0,0,0,0,89,0,67,0,0,0,0,-14,0,0,0,0,0,0,0,0,0,0,0,0,111,0,0,0,0,110,0,-70,0,0,0,0,-122,0,0,0,0,90,0,0,-80,-123,0,0,0,0,0,119,68,0,0,0,0,88,-90,0,0,0,-122,0,82,0,93,0,0,-52,0,0,-125,0,0,105,0,0,-99,0,0,0,0,0,0,0,-111,0,0,0,0,58,-29,0,84,0,114,0,96,0,94,0,0,0,0,0,0,0,74,0,-91,0,0,0,0,0,0,0,0,0,0,-19,0,0,0,0,0,0,63,0,0,-116,-58,0,0,0,0,109,0,0,63,83,0,0,0,0,0,22,-123,0,0,98,0,0,0,0,0,0,0,0,0,76,0,0,0,78,-104,96,0,-9,0,0,-120,0,-33,0,-108,0,0,0,0,0,0,0,0,-70,59,0,-38,61,0,77,0,0,0,0,-124,0,0,80,0,0,-71,0,0,101,0,0,0,0,0,0,0,-62,0,0,0,0,41,36,0,-87,0,93,0,-112,0,-100,0,0,0,0,0,0,0,-113,0,-47,0,0,0,0,0,0,0,0,0,0,-104,0,0,0,0,0,0,125,0,0,-78,-119,0,0,0,0,-72,0,0,92,109,0,0,0,0,0,-109,121,0,0,-125,0,0,0,0,0,0,0,0,0,66,0,0,0,99,-44,-126,0,-126,0,0,-121,0,105,0,77,0,0,0,0,0,0,0,0,-119,-124,0,57,104,0,122,0,0,0,0,47,0,0,25,0,0,-127,0,0,-51,0,0,0,0,0,0,0,-96,0,0,0,0,105,-118,0,53,0,-127,0,-126,0,-115,0,0,0,0,0,0,0,-115,0,-96,0,0,0,0,0,0,0,0,0,0,86,0,0,0,0,0,0,103,0,0,-80,99,0,0,0,0,-110,0,0,-124,-47,0,0,0,0,0,62,92,0,0,101,0,0,0,0,0,0,0,0,0,-113,0,0,0,-125,124,33,0,-119,0,0,-70,0,-108,0,111,0,0,0,0,0,0,0,0,-95,-119,0,-96,88,0,126,0,0,0,0,-35,0,0,123,0,0,-82,0,0,60,0,0,0,0,0,0,0,82,0,0,0,0,-108,-124,0,125,0,49,0,69,0,94,0,0,0,0,0,0,0,66,0,121,0,0,0,0,0,0,0,0,0,0,-121,0,0,0,0,0,0,-20,0,0,-80,-111,0,0,0,0,82,0,0,69,-110,0,0,0,0,0,125,-90,0,0,-120,0,0,0,0,0,0,0,0,0,106,0,0,0,44,112,-75,0,-127,0,0,-124,0,-111,0,68,0,0,0,0,0,0,0,0,69,102,0,122,99,0,-74,0,0,0,0,107,0,0,0,55,10,0,0,0,0,0,0,-1,0,-70,0,-101,0,113,0,0,0,0,0,0,-86,0,0,0,-48,0,0,0,0,0,0,0,-82,0,0,-125,-86,0,0,0,0,0,0,0,0,0,0,0,0,-120,0,-94,0,0,0,0,0,0,89,-103,0,0,0,0,0,0,0,-83,0,-112,0,0,0,-105,0,0,0,-80,0,0,108,0,89,112,0,0,0,0,0,0,0,82,0,0,0,0,0,0,0,115,0,-89,0,83,0,-26,0,0,0,-72,0,0,-116,0,0,117,67,0,0,0,-30,10,0,120,0,0,-91,-96,0,0,0,0,0,0,96,0,-57,0,-128,0,-104,0,0,0,0,0,0,-104,0,0,0,114,0,0,0,0,0,0,0,-102,0,0,91,-115,0,0,0,0,0,0,0,0,0,0,0,0,120,0,-29,0,0,0,0,0,0,48,-127,0,0,0,0,0,0,0,111,0,-123,0,0,0,100,0,0,0,-65,0,0,42,0,-66,-126,0,0,0,0,0,0,0,-94,0,0,0,0,0,0,0,-101,0,82,0,-53,0,-119,0,0,0,-99,0,0,79,0,0,-127,-73,0,0,0,114,-82,0,-111,0,0,-54,100,0,0,0,0,0,0,123,0,-94,0,80,0,-87,0,0,0,0,0,0,-93,0,0,0,-128,0,0,0,0,0,0,0,-108,0,0,-69,9,0,0,0,0,0,0,0,0,0,0,0,0,-29,0,89,0,0,0,0,0,0,-95,-100,0,0,0,0,0,0,0,124,0,67,0,0,0,-80,0,0,0,106,0,0,69,0,-110,103,0,0,0,0,0,0,0,-49,0,0,0,0,0,0,0,102,0,40,0,-108,0,97,0,0,0,80,0,0,-62,0,0,113,74,0,0,0,-124,-126,0,102,0,0,125,-116,0,0,0,0,0,0,-111,0,-125,0,-94,0,111,0,0,0,0,0,0,-73,0,0,0,-93,0,0,0,0,0,0,0,78,0,0,-95,-121,0,0,0,0,0,0,0,0,0,0,0,0,118,0,-110,0,0,0,0,0,0,-114,14,0,0,0,0,0,0,0,-56,0,12,0,0,0,-76,0,0,0,77,0,0,127,0,43,0,0,0,0,0,0,0,0,-122,0,0,0,0,0,0,0,-124,0,125,0,-83,0,-74,0,0,0,127,0,0,104,0,0,-41,-111,0,0,0,-52,-97,0,18,0,0,0,0,3,-35,0,0,84,0,0,0,-45,0,0,0,0,0,54,0,0,0,0,0,0,0,0,0,0,0,-109,0,0,0,0,0,0,-119,0,0,0,101,0,0,0,0,0,0,0,0,0,120,0,0,-86,0,0,0,0,0,0,0,-92,78,95,0,0,0,36,0,0,0,0,-62,0,0,0,0,-122,-103,0,0,0,3,0,0,0,0,0,0,0,0,23,0,78,0,0,0,0,-98,0,0,0,0,-125,0,0,0,0,0,0,111,0,0,0,82,0,-102,-53,0,0,0,0,0,0,0,0,0,0,0,0,112,121,0,0,69,0,0,0,-126,0,0,0,0,0,77,0,0,0,0,0,0,0,0,0,0,0,104,0,0,0,0,0,0,33,0,0,0,69,0,0,0,0,0,0,0,0,0,-6,0,0,83,0,0,0,0,0,0,0,-119,-108,-117,0,0,0,-72,0,0,0,0,111,0,0,0,0,116,-123,0,0,0,107,0,0,0,0,0,0,0,0,60,0,53,0,0,0,0,-42,0,0,0,0,110,0,0,0,0,0,0,-99,0,0,0,-69,0,102,79,0,0,0,0,0,0,0,0,0,0,0,0,122,-123,0,0,-69,0,0,0,81,0,0,0,0,0,125,0,0,0,0,0,0,0,0,0,0,0,94,0,0,0,0,0,0,-128,0,0,0,67,0,0,0,0,0,0,0,0,0,-111,0,0,-15,0,0,0,0,0,0,0,-76,122,-115,0,0,0,82,0,0,0,0,105,0,0,0,0,-45,-58,0,0,0,126,0,0,0,0,0,0,0,0,-117,0,123,0,0,0,0,-99,0,0,0,0,-110,0,0,0,0,0,0,126,0,0,0,92,0,32,84,0,0,0,0,0,0,0,0,0,0,0,0,-77,-60,0,0,-98,0,0,0,101,0,0,0,0,0,93,0,0,0,0,0,0,0,0,0,0,0,-124,0,0,0,0,0,0,-77,0,0,0,121,0,0,0,0,0,0,0,0,0,-85,0,0,124,0,0,0,0,0,0,0,76,88,52,0,0,0,119,0,0,0,0,-63,0,0,0,0,110,-101,0,0,0,-90,0,0,0,0,0,0,0,0,111,0,-78,0,0,0,0,-113,0,0,0,0,-94,0,0,0,0,0,0,41,0,0,0,127,0,-119,115,0,0,0,0,0,0,0,0,0,0,99,0,0,0,0,-117,0,0,0,-118,0,0,41,0,0,0,0,0,0,0,0,0,-111,0,0,-104,-112,0,0,123,0,0,0,0,0,0,0,0,0,88,0,-114,-81,-126,0,-94,-111,0,0,47,0,98,28,-115,0,103,-88,0,0,0,0,0,0,118,102,0,0,0,0,126,0,-62,0,-37,-126,-52,0,0,0,127,0,120,0,0,0,96,0,0,0,0,0,0,0,0,0,75,-77,0,-56,0,0,75,0,0,0,0,-77,0,0,0,0,-89,0,0,0,0,0,0,0,0,0,118,0,0,0,0,0,-117,0,0,0,0,6,0,0,0,-52,0,0,-127,0,0,0,0,0,0,0,0,0,-38,0,0,97,60,0,0,-105,0,0,0,0,0,0,0,0,0,107,0,99,115,64,0,-90,118,0,0,125,0,-98,105,-88,0,-121,-66,0,0,0,0,0,0,86,-83,0,0,0,0,-128,0,-89,0,99,-116,-101,0,0,0,-53,0,-96,0,0,0,127,0,0,0,0,0,0,0,0,0,-71,-46,0,-3,0,0,104,0,0,0,0,104,0,0,0,0,-107,0,0,0,0,0,0,0,0,0,-119,0,0,0,0,0,46,0,0,0,0,106,0,0,0,69,0,0,105,0,0,0,0,0,0,0,0,0,44,0,0,64,87,0,0,-1,0,0,0,0,0,0,0,0,0,110,0,-54,-92,36,0,-45,-3,0,0,88,0,96,123,-80,0,101,87,0,0,0,0,0,0,111,-86,0,0,0,0,-109,0,94,0,-85,113,93,0,0,0,67,0,34,0,0,0,-34,0,0,0,0,0,0,0,0,0,-100,-98,0,-126,0,0,68,0,0,0,0,-106,0,0,0,0,-90,0,0,0,0,0,0,0,0,0,-102,0,0,0,0,0,69,0,0,0,0,-124,0,0,0,-91,0,0,77,0,0,0,0,0,0,0,0,0,115,0,0,61,69,0,0,80,0,0,0,0,0,0,0,0,0,-19,0,90,65,-93,0,-121,106,0,0,-81,0,-43,-58,91,0,-88,125,0,0,0,0,0,0,-26,-124,0,0,0,0,-94,0,109,0,100,-19,96,0,0,0,127,0,91,0,0,0,-52,0,0,0,0,0,0,0,0,0,-100,90,0,124,0,0,-127,0,0,0,0,53,0,0,0,0,-58,0,0,0,0,0,0,0,0,0,-18,0,0,0,0,0,0,0,0,0,0,-117,0,-82,91,0,0,0,-128,0,0,0,0,126,71,0,0,0,0,0,117,0,0,0,56,0,-77,0,0,0,0,0,49,0,0,0,0,0,0,61,0,0,0,0,0,126,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,0,0,55,0,0,0,0,0,-97,0,0,0,65,0,91,0,0,0,0,0,0,0,0,-56,69,0,0,-107,0,106,0,0,0,0,0,0,0,0,0,0,0,-60,65,92,103,0,0,0,0,0,0,0,55,-46,0,0,0,0,51,0,0,0,0,0,0,0,58,0,115,-111,0,0,0,114,0,0,0,0,-108,-73,0,0,0,0,0,88,0,0,0,52,0,65,0,0,0,0,0,65,0,0,0,0,0,0,36,0,0,0,0,0,-72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,46,0,0,86,0,0,0,0,0,-100,0,0,0,-64,0,-88,0,0,0,0,0,0,0,0,106,49,0,0,-76,0,53,0,0,0,0,0,0,0,0,0,0,0,66,-100,-83,111,0,0,0,0,0,0,0,-70,-115,0,0,0,0,-74,0,0,0,0,0,0,0,-127,0,33,24,0,0,0,82,0,0,0,0,20,104,0,0,0,0,0,-45,0,0,0,126,0,-113,0,0,0,0,0,102,0,0,0,0,0,0,-117,0,0,0,0,0,123,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-110,0,0,-60,0,0,0,0,0,43,0,0,0,106,0,-16,0,0,0,0,0,0,0,0,63,-120,0,0,101,0,83,0,0,0,0,0,0,0,0,0,0,0,111,116,-72,-5,0,0,0,0,0,0,0,-71,-27,0,0,0,0,104,0,0,0,0,0,0,0,-66,0,-125,-89,0,0,0,127,0,0,0,0,-76,-71,0,0,0,0,0,115,0,0,0,78,0,85,0,0,0,0,0,113,0,0,0,0,0,0,123,0,0,0,0,0,-27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-115,0,0,108,0,0,0,0,0,-88,0,0,0,113,0,-117,0,0,0,0,0,0,0,0,125,106,0,0,98,0,-119,0,0,0,0,0,0,0,0,0,0,0,100,50,116,111,0,0,0,0,0,0,0,122,125,0,0,0,0,-86,0,0,0,0,0,0,0,0,-102,0,-64,43,0,3,0,0,-82,0,-119,0,0,0,90,0,-36,0,0,0,64,0,0,-77,0,0,0,126,0,0,0,0,64,0,0,0,0,114,0,0,0,0,0,0,-121,0,0,0,0,82,0,81,0,0,-40,0,-54,0,-103,0,0,96,0,87,0,118,0,0,0,0,0,0,-56,0,0,-101,0,0,103,0,0,117,0,0,-67,0,0,0,0,0,0,73,0,0,0,0,0,33,0,0,93,0,0,0,0,0,0,0,0,0,-62,-89,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,107,0,124,-95,0,122,0,0,51,0,121,0,0,0,-77,0,97,0,0,0,106,0,0,-109,0,0,0,-71,0,0,0,0,77,0,0,0,0,24,0,0,0,0,0,0,26,0,0,0,0,-115,0,-125,0,0,112,0,-110,0,-10,0,0,75,0,-79,0,-84,0,0,0,0,0,0,67,0,0,29,0,0,-35,0,0,79,0,0,-114,0,0,0,0,0,0,-114,0,0,0,0,0,-114,0,0,-77,0,0,0,0,0,0,0,0,0,-57,-69,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,83,0,-96,-106,0,96,0,0,-80,0,-120,0,0,0,-78,0,95,0,0,0,92,0,0,75,0,0,0,97,0,0,0,0,82,0,0,0,0,118,0,0,0,0,0,0,-104,0,0,0,0,-69,0,-46,0,0,79,0,-51,0,-115,0,0,-106,0,71,0,107,0,0,0,0,0,0,117,0,0,-108,0,0,-58,0,0,64,0,0,69,0,0,0,0,0,0,106,0,0,0,0,0,71,0,0,-50,0,0,0,0,0,0,0,0,0,96,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,118,115,0,-106,0,0,121,0,96,0,0,0,91,0,-91,0,0,0,-68,0,0,-108,0,0,0,-19,0,0,0,0,127,0,0,0,0,116,0,0,0,0,0,0,-120,0,0,0,0,-100,0,-112,0,0,-99,0,94,0,84,0,0,55,0,-92,0,88,0,0,0,0,0,0,115,0,0,125,0,0,-118,0,0,94,0,0,111,0,0,0,0,0,0,-102,0,0,0,0,0,126,0,0,90,0,0,0,0,0,0,0,0,0,114,107,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-120,-58,0,0,0,0,0,-126,0,0,0,0,0,-52,-113,0,111,0,0,0,0,0,0,0,0,0,0,120,0,0,80,0,0,0,0,0,102,0,-50,-60,0,0,124,0,-57,0,0,-92,0,0,0,0,0,0,0,-76,0,0,-38,0,0,0,0,0,0,27,-96,0,-9,0,0,0,0,0,-70,-88,0,0,0,0,0,0,0,-66,0,0,0,0,0,0,0,-108,0,-120,-88,0,0,0,0,0,0,0,0,0,0,106,0,0,0,-99,0,0,51,0,0,107,0,0,0,0,0,0,0,0,0,0,0,-110,-42,0,0,0,0,0,-67,0,0,0,0,0,-89,95,0,89,0,0,0,0,0,0,0,0,0,0,-103,0,0,-111,0,0,0,0,0,-36,0,-98,71,0,0,74,0,112,0,0,-123,0,0,0,0,0,0,0,-107,0,0,-101,0,0,0,0,0,0,-113,99,0,109,0,0,0,0,0,31,117,0,0,0,0,0,0,0,-86,0,0,0,0,0,0,0,-121,0,-61,104,0,0,0,0,0,0,0,0,0,0,-108,0,0,0,-104,0,0,-112,0,0,79,0,0,0,0,0,0,0,0,0,0,0,-70,105,0,0,0,0,0,-94,0,0,0,0,0,-95,-105,0,61,0,0,0,0,0,0,0,0,0,0,126,0,0,39,0,0,0,0,0,-83,0,-81,108,0,0,1,0,120,0,0,-29,0,0,0,0,0,0,0,-89,0,0,92,0,0,0,0,0,0,108,-121,0,-127,0,0,0,0,0,-98,115,0,0,0,0,0,0,0,-67,0,0,0,0,0,0,0,118,0,-122,14,0,0,0,0,0,0,0,0,0,0,34,0,0,0,19,0,0,69,0,0,115,0,0,0,0,0,0,0,0,0,0,0,102,-112,0,0,0,0,0,76,0,0,0,0,0,-97,36,0,120,0,0,0,0,0,0,0,0,0,0,-96,0,0,102,0,0,0,0,0,-127,0,-97,-74,0,0,118,0,-66,0,0,126,0,0,0,0,0,0,0,51,0,0,-104,0,0,0,0,0,0,81,2,0,122,0,0,0,0,0,114,75,0,0,0,0,0,0,0,124,0,0,0,0,0,0,0,77,0,51,118,0,0,0,0,0,0,0,0,0,0,65,0,0,0,-101,0,0,122,0,0,-58,0,0,0,0,0,0,0,0,0,0,70,0,0,0,0,0,0,0,0,0,0,-96,0,0,112,0,0,0,0,0,0,118,101,0,0,0,0,0,0,0,-64,52,0,-128,-128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-105,0,-47,0,0,0,0,0,126,0,0,0,0,0,93,-93,-120,0,0,0,0,-70,0,0,-100,0,0,0,123,-89,0,0,0,0,0,0,0,82,-93,0,0,-110,0,0,0,0,0,0,0,0,-92,-118,-127,0,0,0,0,-102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-95,0,0,0,0,0,0,0,0,0,0,-84,0,0,-86,0,0,0,0,0,0,-43,105,0,0,0,0,0,0,0,31,20,0,-28,-39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-102,0,-120,0,0,0,0,0,-125,0,0,0,0,0,74,-8,-63,0,0,0,0,89,0,0,-101,0,0,0,100,102,0,0,0,0,0,0,0,59,-44,0,0,-51,0,0,0,0,0,0,0,0,9,110,-125,0,0,0,0,-78,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-111,0,0,0,0,0,0,0,0,0,0,-101,0,0,-93,0,0,0,0,0,0,-76,-93,0,0,0,0,0,0,0,-90,120,0,82,-102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-60,0,125,0,0,0,0,0,113,0,0,0,0,0,109,-92,102,0,0,0,0,114,0,0,-120,0,0,0,-38,-90,0,0,0,0,0,0,0,118,-98,0,0,-58,0,0,0,0,0,0,0,0,99,-53,88,0,0,0,0,-67,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-75,0,0,0,0,0,0,0,0,0,0,35,0,0,-30,0,0,0,0,0,0,-127,44,0,0,0,0,0,0,0,126,-117,0,113,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,99,0,35,0,0,0,0,0,53,0,0,0,0,0,-70,114,36,0,0,0,0,-99,0,0,-70,0,0,0,102,-80,0,0,0,0,0,0,0,123,105,0,0,-103,0,0,0,0,0,0,0,0,-128,123,63,0,0,0,0,100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,117,-89,0,0,0,0,0,0,-114,0,0,0,-124,0,0,0,0,103,0,0,-77,0,0,-113,0,0,0,0,0,0,0,0,-89,0,0,0,0,83,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-96,0,0,0,0,0,0,0,0,0,0,0,-104,0,0,-26,0,0,0,0,41,104,0,0,0,0,0,0,0,0,-92,0,0,0,-125,0,0,0,0,-124,0,0,0,0,0,68,93,64,0,0,0,-59,0,0,0,0,0,0,0,0,-60,0,0,0,0,0,0,106,63,124,0,0,0,0,0,44,-128,0,0,0,0,0,0,-104,0,0,0,118,0,0,0,0,-97,0,0,114,0,0,-80,0,0,0,0,0,0,0,0,-113,0,0,0,0,-119,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,0,0,0,0,0,0,0,0,0,0,0,-119,0,0,-118,0,0,0,0,121,-95,0,0,0,0,0,0,0,0,107,0,0,0,-81,0,0,0,0,-70,0,0,0,0,0,-125,88,123,0,0,0,98,0,0,0,0,0,0,0,0,-112,0,0,0,0,0,0,102,-67,114,0,0,0,0,0,-102,-65,0,0,0,0,0,0,96,0,0,0,-125,0,0,0,0,116,0,0,-79,0,0,-83,0,0,0,0,0,0,0,0,61,0,0,0,0,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-80,0,0,0,0,0,0,0,0,0,0,0,95,0,0,-126,0,0,0,0,122,-83,0,0,0,0,0,0,0,0,117,0,0,0,88,0,0,0,0,33,0,0,0,0,0,-30,-44,126,0,0,0,125,0,0,0,0,0,0,0,0,73,0,0,0,0,0,0,60,53,-14,0,0,0,0,0,49,-43,0,0,0,0,0,0,-16,0,0,0,23,0,0,0,0,77,0,0,-58,0,0,69,0,0,0,0,0,0,0,0,-125,0,0,0,0,92,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-82,0,0,0,0,0,0,0,0,0,0,0,60,0,0,-93,0,0,0,0,-49,119,0,0,0,0,0,0,0,0,60,0,0,0,-111,0,0,0,0,-83,0,0,0,0,0,-89,117,59,0,0,0,-48,0,0,0,0,0,0,0,0,78,0,0,0,0,0,0,-108,-126,-108,0,0,0,-68,-111,0,0,0,0,0,0,0,110,0,0,-120,76,-41,0,0,0,-55,58,-24,0,0,-94,-37,0,0,0,108,0,0,0,123,0,0,0,104,-111,0,0,0,0,0,64,0,0,127,101,125,0,-54,0,0,0,86,0,0,52,0,-118,0,0,0,0,0,54,0,0,0,0,114,0,0,0,0,0,-113,0,0,0,0,0,0,0,0,0,0,97,0,0,68,-111,0,0,0,0,-105,-94,0,43,52,-80,0,0,0,100,0,0,0,0,-105,0,0,0,0,0,0,77,59,0,0,0,0,-110,0,0,0,93,-64,0,0,0,0,0,0,0,102,0,0,79,123,-86,0,0,0,-108,116,111,0,0,-90,79,0,0,0,-85,0,0,0,42,0,0,0,-75,-3,0,0,0,0,0,-126,0,0,56,118,-84,0,-87,0,0,0,-125,0,0,123,0,-56,0,0,0,0,0,-96,0,0,0,0,95,0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,-99,0,0,68,-63,0,0,0,0,82,-89,0,-82,-63,123,0,0,0,89,0,0,0,0,96,0,0,0,0,0,0,67,-67,0,0,0,0,113,0,0,0,69,-128,0,0,0,0,0,0,0,71,0,0,-128,111,80,0,0,0,110,85,-128,0,0,-109,102,0,0,0,-25,0,0,0,123,0,0,0,63,-96,0,0,0,0,0,-79,0,0,69,-62,65,0,-116,0,0,0,-38,0,0,120,0,-74,0,0,0,0,0,100,0,0,0,0,-85,0,0,0,0,0,89,0,0,0,0,0,0,0,0,0,0,73,0,0,99,86,0,0,0,0,102,74,0,-119,124,75,0,0,0,93,0,0,0,0,86,0,0,0,0,0,0,-106,-115,0,0,0,0,44,0,0,0,-109,-78,0,0,0,0,0,0,0,117,0,0,-51,71,124,0,0,0,59,-61,59,0,0,-95,-96,0,0,0,-94,0,0,0,86,0,0,0,-95,112,0,0,0,0,0,-112,0,0,73,52,-53,0,-120,0,0,0,91,0,0,49,0,-82,0,0,0,0,0,-118,0,0,0,0,-89,0,0,0,0,0,107,0,0,0,0,0,0,0,0,0,0,-46,0,0,-74,-122,0,0,0,0,-38,120,0,-106,-118,98,0,0,0,-52,0,0,0,0,55,0,0,0,0,0,0,112,-120,0,0,0,0,-62,0,84,0,0,0,-82,0,0,0,-64,100,0,0,-128,-81,-122,100,87,29,0,-49,0,53,-103,0,86,0,0,0,-126,63,0,79,-89,0,0,120,0,-102,0,90,0,-62,0,0,0,0,-125,0,0,0,0,-50,0,0,0,0,0,0,0,0,0,0,0,0,-64,0,121,-73,109,0,0,-110,0,0,0,0,0,0,0,0,111,0,0,80,0,-25,0,0,-113,0,0,111,0,0,94,0,0,-117,0,0,-85,0,0,0,0,0,102,-57,0,86,0,0,-110,0,0,-118,0,-113,0,-123,0,0,-108,0,0,0,0,-126,0,0,0,-128,0,0,0,-124,123,0,0,-87,-75,-60,-124,125,-127,0,-77,0,-103,122,0,-106,0,0,0,65,-115,0,-115,98,0,0,110,0,-33,0,76,0,29,0,0,0,0,-108,0,0,0,0,-121,0,0,0,0,0,0,0,0,0,0,0,0,-68,0,-84,80,106,0,0,-73,0,0,0,0,0,0,0,0,-121,0,0,86,0,74,0,0,-99,0,0,-68,0,0,103,0,0,-119,0,0,-124,0,0,0,0,0,26,-108,0,-86,0,0,-81,0,0,-99,0,94,0,97,0,0,70,0,0,0,0,105,0,0,0,-113,0,0,0,105,-7,0,0,-18,116,117,82,123,-54,0,-110,0,-118,54,0,82,0,0,0,76,-109,0,-71,-88,0,0,108,0,76,0,-104,0,-116,0,0,0,0,-103,0,0,0,0,-127,0,0,0,0,0,0,0,0,0,0,0,0,-109,0,12,-88,89,0,0,-87,0,0,0,0,0,0,0,0,-49,0,0,-74,0,104,0,0,-20,0,0,96,0,0,116,0,0,47,0,0,-115,0,0,0,0,0,-114,-104,0,114,0,0,-97,0,0,68,0,93,0,-117,0,0,-21,0,0,0,0,75,0,0,0,-99,0,0,0,-128,117,0,0,-77,-110,-35,77,100,-117,0,-101,0,108,-86,0,-44,0,0,0,80,-50,0,-61,113,0,0,-31,0,-128,0,-105,0,120,0,0,0,0,-38,0,0,0,0,-34,0,0,0,0,0,0,0,0,0,0,0,0,-71,0,-118,-89,58,0,0,-128,0,0,0,0,0,0,0,0,34,0,0,-71,0,117,0,0,121,0,0,-108,0,0,99,0,0,72,0,0,36,0,0,0,0,0,-112,76,0,-81,0,0,-29,0,0,-118,0,-80,0,-52,0,0,123,0,0,0,0,0,0,0,0,0,0,122,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-101,94,0,78,0,0,0,0,0,0,0,0,0,0,127,0,0,0,0,0,0,-112,121,104,0,0,0,0,0,0,121,0,-78,0,0,0,0,0,116,92,-115,62,0,-126,0,113,122,0,0,-68,-105,0,0,0,0,0,0,48,0,0,0,0,-127,74,0,0,0,0,-115,0,0,0,0,0,0,-119,0,0,0,0,0,0,0,-59,0,0,0,0,0,0,0,0,-64,0,0,0,0,0,0,0,-29,-76,-16,0,0,0,0,0,0,-117,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,121,-125,0,43,0,0,0,0,0,0,0,0,0,0,-54,0,0,0,0,0,0,-102,-106,46,0,0,0,0,0,0,81,0,-94,0,0,0,0,0,-78,7,80,99,0,-61,0,21,96,0,0,-108,-90,0,0,0,0,0,0,116,0,0,0,0,88,-61,0,0,0,0,67,0,0,0,0,0,0,-70,0,0,0,0,0,0,0,-94,0,0,0,0,0,0,0,0,110,0,0,0,0,0,0,0,-101,-81,107,0,0,0,0,0,0,-82,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,-128,0,118,0,0,0,0,0,0,0,0,0,0,117,0,0,0,0,0,0,-67,-39,-91,0,0,0,0,0,0,89,0,111,0,0,0,0,0,124,107,98,-74,0,-58,0,-103,-38,0,0,82,99,0,0,0,0,0,0,-80,0,0,0,0,-85,-75,0,0,0,0,71,0,0,0,0,0,0,27,0,0,0,0,0,0,0,-125,0,0,0,0,0,0,0,0,-96,0,0,0,0,0,0,0,116,-72,123,0,0,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-55,-101,0,-103,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,102,52,-77,0,0,0,0,0,0,-78,0,-36,0,0,0,0,0,103,127,-95,109,0,87,0,-106,-118,0,0,119,37,0,0,0,0,0,0,-63,0,0,0,0,63,125,0,0,0,0,95,0,0,0,0,0,0,99,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,105,0,0,0,0,0,0,0,-98,97,-89,-47,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,124,0,-110,0,0,0,0,0,0,0,0,-26,0,0,0,0,0,0,0,-93,0,0,0,77,102,0,0,0,0,0,83,0,0,0,0,-60,0,96,0,-74,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-105,0,0,0,0,0,0,-108,0,0,0,0,-100,-77,63,-10,0,71,-22,0,0,0,0,0,0,0,0,111,-113,0,0,0,0,0,0,100,0,0,0,0,-40,0,-45,0,39,0,0,-97,0,-84,-113,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,83,0,122,0,0,0,0,0,0,0,0,103,0,0,0,0,0,0,0,116,0,0,0,103,104,0,0,0,0,0,71,0,0,0,0,-78,0,-105,0,82,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,118,0,0,0,0,0,0,-47,0,0,0,0,-80,87,86,84,0,-111,106,0,0,0,0,0,0,0,0,-50,95,0,0,0,0,0,0,-66,0,0,0,0,-83,0,-86,0,103,0,0,-79,0,-107,-24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,50,0,92,0,0,0,0,0,0,0,0,116,0,0,0,0,0,0,0,100,0,0,0,-99,60,0,0,0,0,0,-111,0,0,0,0,-110,0,112,0,-70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,89,0,0,0,0,0,0,-42,0,0,0,0,-122,-94,-47,101,0,43,-94,0,0,0,0,0,0,0,0,-66,-86,0,0,0,0,0,0,-104,0,0,0,0,-106,0,-71,0,121,0,0,77,0,105,-112,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,95,0,-85,0,0,0,0,0,0,0,0,88,0,0,0,0,0,0,0,-65,0,0,0,103,-96,0,0,0,0,0,92,0,0,0,0,123,0,-68,0,-84,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,98,0,0,0,0,0,0,119,0,0,0,0,-45,-115,-114,123,0,-99,111,0,0,0,0,0,0,0,0,109,-66,0,0,0,0,0,0,125,0,0,0,0,116,0,108,0,120,0,0,71,0,-64,0,-99,0,0,-60,0,0,0,0,0,0,0,89,61,0,0,0,0,0,0,0,0,0,0,0,29,0,0,0,0,0,-73,0,123,0,-86,0,0,0,0,-124,0,0,0,0,-60,0,-47,0,0,117,0,0,0,-57,0,0,0,0,0,46,0,0,0,0,0,0,0,-109,0,0,0,0,97,0,0,0,0,0,0,0,0,-53,0,0,0,64,0,0,-123,0,-109,0,0,0,0,-79,0,68,0,0,0,0,112,0,0,0,0,97,0,0,95,0,-86,0,0,0,0,0,0,0,0,0,0,0,0,-102,0,-6,0,0,116,0,0,0,0,0,0,0,-104,121,0,0,0,0,0,0,0,0,0,0,0,-114,0,0,0,0,0,-120,0,-52,0,109,0,0,0,0,26,0,0,0,0,99,0,-33,0,0,-80,0,0,0,-65,0,0,0,0,0,88,0,0,0,0,0,0,0,-86,0,0,0,0,-77,0,0,0,0,0,0,0,0,125,0,0,0,-112,0,0,-36,0,-98,0,0,0,0,40,0,-72,0,0,0,0,-114,0,0,0,0,-36,0,0,-112,0,-50,0,0,0,0,0,0,0,0,0,0,0,0,59,0,115,0,0,-83,0,0,0,0,0,0,0,29,116,0,0,0,0,0,0,0,0,0,0,0,105,0,0,0,0,0,100,0,-110,0,103,0,0,0,0,114,0,0,0,0,-101,0,-121,0,0,-102,0,0,0,-107,0,0,0,0,0,109,0,0,0,0,0,0,0,113,0,0,0,0,-85,0,0,0,0,0,0,0,0,44,0,0,0,72,0,0,79,0,92,0,0,0,0,91,0,-101,0,0,0,0,46,0,0,0,0,117,0,0,105,0,-108,0,0,0,0,0,0,0,0,0,0,0,0,-100,0,112,0,0,-118,0,0,0,0,0,0,0,-111,-17,0,0,0,0,0,0,0,0,0,0,0,-68,0,0,0,0,0,32,0,-76,0,39,0,0,0,0,-48,0,0,0,0,117,0,-112,0,0,24,0,0,0,125,0,0,0,0,0,83,0,0,0,0,0,0,0,-29,0,0,0,0,69,0,0,0,0,0,0,0,0,-96,0,0,0,-103,0,0,92,0,98,0,0,0,0,115,0,-73,0,0,0,0,58,0,0,0,0,-124,0,0,-54,0,-111,0,0,0,0,0,0,0,0,0,0,0,0,0,-111,0,0,0,0,118,0,0,-125,-66,0,0,-79,0,90,0,-123,0,0,0,0,0,-91,0,65,0,0,114,90,0,0,0,97,0,64,102,107,0,0,0,0,0,0,0,0,0,0,0,0,-99,0,0,0,0,0,-44,0,-106,0,54,0,0,0,0,0,0,-108,-85,0,-123,0,0,-107,0,0,0,0,0,0,0,0,0,-21,0,0,0,0,0,0,0,0,0,0,0,83,0,0,0,0,95,0,-109,0,0,0,0,-36,0,0,0,0,0,0,0,0,0,-116,0,0,0,0,0,0,-1,0,119,0,109,0,0,0,0,43,0,0,-75,117,0,0,-51,0,-33,0,123,0,0,0,0,0,-86,0,-123,0,0,-111,57,0,0,0,83,0,-62,-125,-97,0,0,0,0,0,0,0,0,0,0,0,0,-105,0,0,0,0,0,-53,0,-95,0,120,0,0,0,0,0,0,14,-109,0,-72,0,0,-121,0,0,0,0,0,0,0,0,0,95,0,0,0,0,0,0,0,0,0,0,0,106,0,0,0,0,-61,0,-110,0,0,0,0,-96,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,-121,0,-76,0,-87,0,0,0,0,74,0,0,43,82,0,0,-100,0,127,0,-75,0,0,0,0,0,-120,0,35,0,0,126,62,0,0,0,-81,0,110,43,-122,0,0,0,0,0,0,0,0,0,0,0,0,110,0,0,0,0,0,110,0,-121,0,-128,0,0,0,0,0,0,85,57,0,15,0,0,-98,0,0,0,0,0,0,0,0,0,123,0,0,0,0,0,0,0,0,0,0,0,86,0,0,0,0,-123,0,127,0,0,0,0,86,0,0,0,0,0,0,0,0,0,50,0,0,0,0,0,0,-109,0,-28,0,69,0,0,0,0,-102,0,0,88,74,0,0,123,0,60,0,122,0,0,0,0,0,-27,0,113,0,0,-93,-117,0,0,0,45,0,88,95,4,0,0,0,0,0,0,0,0,0,0,0,0,-49,0,0,0,0,0,-124,0,25,0,-9,0,0,0,0,0,0,112,100,0,-124,0,0,83,0,0,0,0,0,0,0,0,0,-128,0,0,0,0,0,0,0,0,0,0,0,-54,0,0,0,0,-44,0,-83,0,0,0,0,127,0,0,0,0,0,0,0,0,0,-110,0,0,0,0,0,0,86,0,-90,0,0,0,0,0,0,0,0,-80,0,0,0,0,0,0,0,-98,0,0,0,0,107,0,0,0,0,54,0,102,52,-121,0,103,49,0,90,-115,60,0,-77,-94,0,-119,0,0,0,106,0,0,0,-74,-32,-81,0,-103,0,-126,119,0,0,0,0,0,0,-96,0,74,0,0,0,0,127,0,0,0,-126,0,-90,0,0,0,0,0,-102,0,0,0,0,122,0,-111,0,0,0,0,-54,0,-89,126,-119,0,-107,62,0,0,95,0,-95,0,0,69,0,-67,0,0,0,-61,-99,0,-82,-24,0,-26,0,109,0,0,0,0,0,0,0,0,0,0,-100,0,0,0,0,0,0,0,89,0,0,0,0,-19,0,0,0,0,-115,0,90,-110,116,0,-121,-117,0,109,-107,-26,0,123,108,0,55,0,0,0,59,0,0,0,77,-91,84,0,102,0,-113,-104,0,0,0,0,0,0,78,0,-95,0,0,0,0,94,0,0,0,-39,0,54,0,0,0,0,0,-104,0,0,0,0,91,0,-106,0,0,0,0,-87,0,70,126,-49,0,119,-89,0,0,-124,0,-93,0,0,122,0,18,0,0,0,30,-99,0,103,-91,0,-110,0,107,0,0,0,0,0,0,0,0,0,0,-119,0,0,0,0,0,0,0,64,0,0,0,0,-107,0,0,0,0,-39,0,-55,-119,68,0,119,-90,0,-92,93,111,0,-89,78,0,95,0,0,0,-100,0,0,0,114,-126,-69,0,-127,0,-11,62,0,0,0,0,0,0,85,0,99,0,0,0,0,-117,0,0,0,124,0,-108,0,0,0,0,0,-125,0,0,0,0,-69,0,-108,0,0,0,0,-125,0,-122,-34,126,0,25,103,0,0,-126,0,-54,0,0,-124,0,-105,0,0,0,101,-94,0,-71,90,0,62,0,94,0,0,0,0,0,0,0,0,0,0,-36,0,0,0,0,0,0,0,118,0,0,0,0,75,0,0,0,0,98,0,109,-47,6,0,-38,124,0,61,27,-124,0,-54,-108,0,123,0,0,0,115,0,0,0,49,-83,-99,0,87,0,79,26,0,0,0,0,0,0,-82,0,-66,0,0,0,0,-7,0,0,0,101,0,80,0,0,0,0,0,90,0,0,0,0,55,0,-93,0,0,0,0,-111,0,-47,46,-87,0,-89,100,0,0,-9,0,81,0,0,98,0,117,0,0,0,-118,112,0,-105,120,0,-116,0,-125,0,0,0,0,-115,0,0,0,-96,-103,0,0,0,0,0,0,-59,37,0,0,0,0,0,0,0,0,0,0,0,0,0,122,0,0,-85,0,0,-103,0,0,93,0,0,0,0,0,0,0,0,0,0,52,-92,0,0,55,0,97,0,87,0,0,0,0,0,-29,0,0,0,0,50,0,0,-112,84,0,0,0,0,0,0,0,0,104,0,125,0,0,0,-83,0,0,0,0,0,101,0,0,-72,-100,0,0,0,0,123,0,0,0,0,-109,0,0,104,0,0,0,0,0,0,122,-117,0,0,0,49,0,0,0,0,0,0,-36,0,0,0,88,123,0,0,0,0,0,0,78,127,0,0,0,0,0,0,0,0,0,0,0,0,0,-70,0,0,127,0,0,122,0,0,117,0,0,0,0,0,0,0,0,0,0,46,106,0,0,-102,0,110,0,71,0,0,0,0,0,-74,0,0,0,0,78,0,0,93,108,0,0,0,0,0,0,0,0,81,0,-100,0,0,0,30,0,0,0,0,0,120,0,0,112,-125,0,0,0,0,50,0,0,0,0,79,0,0,68,0,0,0,0,0,0,-105,126,0,0,0,-112,0,0,0,0,0,0,123,0,0,0,108,-68,0,0,0,0,0,0,118,-117,0,0,0,0,0,0,0,0,0,0,0,0,0,62,0,0,122,0,0,42,0,0,-42,0,0,0,0,0,0,0,0,0,0,-119,-50,0,0,-106,0,83,0,125,0,0,0,0,0,102,0,0,0,0,74,0,0,-32,-113,0,0,0,0,0,0,0,0,51,0,104,0,0,0,123,0,0,0,0,0,-89,0,0,-106,126,0,0,0,0,-66,0,0,0,0,97,0,0,93,0,0,0,0,0,0,-51,-126,0,0,0,127,0,0,0,0,0,0,-65,0,0,0,119,-99,0,0,0,0,0,0,107,-79,0,0,0,0,0,0,0,0,0,0,0,0,0,105,0,0,110,0,0,68,0,0,-82,0,0,0,0,0,0,0,0,0,0,-90,88,0,0,74,0,-95,0,26,0,0,0,0,0,125,0,0,0,0,107,0,0,119,-17,0,0,0,0,0,0,0,0,125,0,56,0,0,0,-89,0,0,0,0,0,18,0,0,-114,-23,0,0,0,0,-101,0,0,0,0,38,0,0,-95,0,0,0,0,0,0,63,49,0,0,0,-111,0,0,0,0,0,-118,0,0,0,0,0,0,0,0,-89,-111,0,0,0,-125,0,-122,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,0,0,0,0,0,0,0,115,0,0,0,0,0,0,80,-37,55,0,0,0,0,0,0,-76,0,0,-109,112,0,0,0,-127,-94,0,0,0,0,0,0,0,0,0,-53,0,0,0,0,51,0,114,0,0,0,0,-59,0,0,0,0,0,0,-117,0,0,0,0,0,0,75,0,-90,0,0,77,9,0,97,0,-102,0,-16,78,0,0,-105,0,0,94,0,0,-86,0,0,0,0,0,0,0,0,-100,116,0,0,0,-55,0,-45,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,118,0,0,0,0,0,0,0,124,0,0,0,0,0,0,-128,123,121,0,0,0,0,0,0,-53,0,0,119,38,0,0,0,-50,-103,0,0,0,0,0,0,0,0,0,123,0,0,0,0,119,0,-110,0,0,0,0,71,0,0,0,0,0,0,-99,0,0,0,0,0,0,116,0,93,0,0,-29,95,0,-109,0,77,0,-116,78,0,0,14,0,0,35,0,0,-52,0,0,0,0,0,0,0,0,-97,-53,0,0,0,4,0,101,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,0,0,0,0,0,0,-118,0,0,0,0,0,0,-43,36,93,0,0,0,0,0,0,-128,0,0,-19,120,0,0,0,58,30,0,0,0,0,0,0,0,0,0,37,0,0,0,0,-55,0,-15,0,0,0,0,111,0,0,0,0,0,0,115,0,0,0,0,0,0,-109,0,95,0,0,-117,-104,0,-94,0,-65,0,-79,-51,0,0,112,0,0,73,0,0,-88,0,0,0,0,0,0,0,0,87,-68,0,0,0,-123,0,81,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,121,0,0,0,0,0,0,0,-125,0,0,0,0,0,0,-73,-127,56,0,0,0,0,0,0,52,0,0,97,67,0,0,0,-97,-94,0,0,0,0,0,0,0,0,0,108,0,0,0,0,115,0,74,0,0,0,0,79,0,0,0,0,0,0,-99,0,0,0,0,0,0,-111,0,112,0,0,94,-124,0,-29,0,95,0,-107,-123,0,0,124,0,0,120,0,0,-117,123,0,-108,0,0,0,0,0,0,81,0,0,0,0,71,0,0,0,0,0,0,0,0,0,0,0,-56,0,0,-75,0,-20,0,0,0,0,-73,0,0,0,0,0,0,0,0,-120,0,0,0,0,0,0,0,10,0,24,0,90,0,0,0,-90,0,0,0,0,0,107,0,0,-125,0,112,127,0,-107,114,0,0,-117,0,-109,116,0,0,-108,0,0,0,0,0,-110,0,0,0,0,0,0,-92,0,0,0,0,0,0,0,0,0,0,0,0,-110,0,68,0,0,-97,0,89,0,0,-53,0,0,0,0,-108,-97,0,-104,0,0,0,0,0,0,-118,0,0,0,0,-49,0,0,0,0,0,0,0,0,0,0,0,103,0,0,-121,0,-122,0,0,0,0,-70,0,0,0,0,0,0,0,0,85,0,0,0,0,0,0,0,126,0,81,0,88,0,0,0,123,0,0,0,0,0,124,0,0,63,0,-41,52,0,-118,78,0,0,-91,0,-89,121,0,0,49,0,0,0,0,0,93,0,0,0,0,0,0,114,0,0,0,0,0,0,0,0,0,0,0,0,-79,0,94,0,0,77,0,127,0,0,-69,0,0,0,0,-84,-119,0,70,0,0,0,0,0,0,121,0,0,0,0,-121,0,0,0,0,0,0,0,0,0,0,0,-92,0,0,38,0,110,0,0,0,0,121,0,0,0,0,0,0,0,0,101,0,0,0,0,0,0,0,104,0,115,0,-90,0,0,0,109,0,0,0,0,0,60,0,0,-70,0,115,27,0,-74,77,0,0,-26,0,82,-50,0,0,-115,0,0,0,0,0,-84,0,0,0,0,0,0,-43,0,0,0,0,0,0,0,0,0,0,0,0,95,0,40,0,0,112,0,85,0,0,113,0,0,0,0,75,72,0,63,0,0,0,0,0,0,5,0,0,0,0,-90,0,0,0,0,0,0,0,0,0,0,0,-100,0,0,-99,0,-58,0,0,0,0,53,0,0,0,0,0,0,0,0,-81,0,0,0,0,0,0,0,-77,0,89,0,72,0,0,0,105,0,0,0,0,0,-47,0,0,-62,0,-56,-112,0,-96,60,0,0,-84,0,36,-103,0,0,38,0,0,0,0,0,38,0,0,0,0,0,0,-61,0,0,0,0,0,0,0,0,0,0,0,0,89,0,107,0,0,-111,0,-5,0,0,84,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,118,0,0,0,44,0,0,0,0,-94,-85,0,0,0,0,0,0,86,-45,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-116,0,-110,0,0,0,-21,0,0,-121,0,50,0,0,0,0,0,0,0,18,0,0,0,73,116,0,0,0,0,113,0,0,-121,0,0,117,0,0,0,0,114,0,0,-34,0,0,0,0,0,0,0,0,-120,116,0,124,0,0,-37,0,0,0,-103,0,0,0,0,0,0,0,0,0,0,0,-64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-80,0,0,0,-115,0,0,0,0,65,-4,0,0,0,0,0,0,99,91,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-100,0,83,0,0,0,106,0,0,-77,0,104,0,0,0,0,0,0,0,-126,0,0,0,61,-127,0,0,0,0,65,0,0,-78,0,0,61,0,0,0,0,16,0,0,-77,0,0,0,0,0,0,0,0,60,111,0,93,0,0,97,0,0,0,-23,0,0,0,0,0,0,0,0,0,0,0,-109,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-100,0,0,0,-102,0,0,0,0,-115,127,0,0,0,0,0,0,108,110,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-17,0,-121,0,0,0,117,0,0,-125,0,-117,0,0,0,0,0,0,0,95,0,0,0,-83,54,0,0,0,0,37,0,0,120,0,0,-88,0,0,0,0,-100,0,0,-126,0,0,0,0,0,0,0,0,108,-74,0,121,0,0,110,0,0,0,68,0,0,0,0,0,0,0,0,0,0,0,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-54,0,0,0,65,0,0,0,0,-46,-98,0,0,0,0,0,0,-99,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-81,0,-120,0,0,0,78,0,0,-32,0,80,0,0,0,0,0,0,0,99,0,0,0,98,-17,0,0,0,0,123,0,0,104,0,0,-123,0,0,0,0,-87,0,0,-120,0,0,0,0,0,0,0,0,-123,87,0,62,0,0,-91,0,0,0,-112,0,0,0,0,0,0,0,0,0,0,0,-118,0,0,0,0,0,-53,117,0,82,0,0,0,0,0,0,0,0,0,0,0,78,0,0,0,0,0,0,0,0,-67,0,0,0,0,68,0,116,105,-74,0,42,0,-109,0,0,0,0,0,109,0,0,-71,-64,0,-75,0,0,0,96,0,-39,0,-84,0,0,61,0,0,0,0,0,110,0,0,0,0,0,0,0,-100,0,0,0,0,-86,0,0,0,0,0,0,-78,0,-55,0,0,0,0,-108,0,0,0,0,0,-36,0,0,0,0,0,117,0,80,-112,0,0,0,0,96,0,-15,0,0,0,44,0,-34,0,0,89,0,0,93,-70,0,-124,0,0,0,0,0,0,0,0,0,0,0,-112,0,0,0,0,0,0,0,0,-42,0,0,0,0,37,0,61,109,-97,0,-99,0,-128,0,0,0,0,0,-84,0,0,-111,118,0,-74,0,0,0,75,0,96,0,108,0,0,122,0,0,0,0,0,-50,0,0,0,0,0,0,0,32,0,0,0,0,-101,0,0,0,0,0,0,94,0,112,0,0,0,0,-109,0,0,0,0,0,-113,0,0,0,0,0,83,0,34,-116,0,0,0,0,-64,0,-125,0,0,0,-53,0,118,0,0,97,0,0,-54,-103,0,-122,0,0,0,0,0,0,0,0,0,0,0,82,0,0,0,0,0,0,0,0,110,0,0,0,0,-123,0,-122,-111,114,0,122,0,-49,0,0,0,0,0,-55,0,0,99,-121,0,36,0,0,0,59,0,-127,0,81,0,0,101,0,0,0,0,0,-114,0,0,0,0,0,0,0,-100,0,0,0,0,41,0,0,0,0,0,0,61,0,119,0,0,0,0,-116,0,0,0,0,0,-94,0,0,0,0,0,-62,0,108,-68,0,0,0,0,-41,0,-77,0,0,0,-120,0,106,0,0,71,0,0,121,52,0,84,0,0,0,0,0,0,0,0,0,0,0,93,0,0,0,0,0,0,0,0,-103,0,0,0,0,101,0,-11,44,105,0,87,0,-75,0,0,0,0,0,-105,0,0,-100,-128,0,-122,0,0,0,90,0,-106,0,-58,0,0,45,0,0,0,0,0,115,0,0,0,0,0,0,0,93,0,0,0,0,-113,0,0,0,0,0,0,-124,0,65,0,0,0,0,81,0,0,0,0,0,-67,0,0,0,0,0,102,0,91,55,0,0,0,0,-124,0,99,0,0,0,99,0,-95,0,0,-108,0,0,0,0,-126,0,121,0,103,0,0,0,-92,0,0,0,0,0,0,0,0,110,0,0,76,0,89,0,107,0,0,0,0,-95,0,0,0,-73,113,0,0,-128,0,0,-64,126,0,0,0,0,45,0,48,-76,0,0,0,115,0,0,0,-106,0,-79,0,0,0,106,0,0,-107,0,0,0,0,0,0,-104,0,0,0,0,0,0,0,-120,105,0,0,0,-125,0,0,-95,0,0,0,0,-112,127,0,0,0,0,0,48,0,0,102,97,0,0,0,0,0,0,0,0,0,0,0,95,0,0,0,0,0,119,67,0,0,-124,0,31,0,118,0,0,0,126,0,0,0,0,0,0,0,0,-83,0,0,-54,0,-123,0,-98,0,0,0,0,-116,0,0,0,104,51,0,0,82,0,0,98,-20,0,0,0,0,92,0,85,108,0,0,0,-85,0,0,0,-115,0,-77,0,0,0,-81,0,0,-92,0,0,0,0,0,0,-90,0,0,0,0,0,0,0,112,-67,0,0,0,81,0,0,117,0,0,0,0,105,-124,0,0,0,0,0,92,0,0,98,109,0,0,0,0,0,0,0,0,0,0,0,-116,0,0,0,0,0,82,30,0,0,120,0,79,0,-55,0,0,0,60,0,0,0,0,0,0,0,0,-40,0,0,-107,0,-96,0,59,0,0,0,0,-81,0,0,0,-106,93,0,0,-118,0,0,-49,-126,0,0,0,0,-91,0,-98,-56,0,0,0,36,0,0,0,-106,0,-120,0,0,0,83,0,0,71,0,0,0,0,0,0,98,0,0,0,0,0,0,0,-6,57,0,0,0,23,0,0,-126,0,0,0,0,-40,63,0,0,0,0,0,-98,0,0,107,-46,0,0,0,0,0,0,0,0,0,0,0,125,0,0,0,0,0,116,111,0,0,-107,0,127,0,125,0,0,0,41,0,0,0,0,0,0,0,0,-92,0,0,127,0,95,0,75,0,0,0,0,-35,0,0,0,47,-84,0,0,-33,0,0,-104,46,0,0,0,0,105,0,-95,102,0,0,0,72,0,0,0,85,0,41,0,0,0,-97,0,0,113,0,0,0,0,0,0,-111,0,0,0,0,0,0,0,89,-126,0,0,0,118,0,0,74,0,0,0,0,123,123,0,0,0,0,0,-111,0,0,-1,109,0,0,0,0,0,0,0,0,0,0,0,-6,0,0,0,0,0,15,-106,90,0,124,-94,0,83,0,0,0,-101,0,0,0,0,0,58,0,0,0,0,0,0,0,0,0,86,0,0,0,0,0,0,100,-104,44,0,0,70,0,110,0,0,0,-124,0,-97,0,0,0,0,0,0,26,0,-78,0,0,0,0,0,0,0,0,0,-116,0,114,0,0,0,-64,0,0,57,0,-113,0,0,0,109,0,0,-121,-78,0,-104,0,0,0,0,-110,0,0,0,0,0,0,-111,0,0,0,0,0,0,-6,0,0,-92,0,0,0,0,0,0,64,0,0,118,0,-62,0,53,0,0,0,0,0,80,0,-104,-124,0,90,0,0,0,99,0,0,0,0,0,-122,0,0,0,0,0,0,0,0,0,-50,0,0,0,0,0,0,-60,103,-102,0,0,-110,0,-102,0,0,0,-110,0,-79,0,0,0,0,0,0,-99,0,64,0,0,0,0,0,0,0,0,0,83,0,97,0,0,0,101,0,0,-122,0,25,0,0,0,-124,0,0,109,-102,0,-96,0,0,0,0,91,0,0,0,0,0,0,75,0,0,0,0,0,0,-78,0,0,-112,0,0,0,0,0,0,-51,0,0,-92,0,119,0,-125,0,0,0,0,0,71,0,120,-95,0,-96,0,0,0,-56,0,0,0,0,0,126,0,0,0,0,0,0,0,0,0,-93,0,0,0,0,0,0,-54,-65,81,0,0,76,0,-28,0,0,0,108,0,88,0,0,0,0,0,0,120,0,-83,0,0,0,0,0,0,0,0,0,59,0,-53,0,0,0,-123,0,0,-119,0,-90,0,0,0,-85,0,0,82,-94,0,39,0,0,0,0,2,0,0,0,0,0,0,116,0,0,0,0,0,0,-127,0,0,119,0,0,0,0,0,0,95,0,0,-109,0,73,0,89,0,0,0,0,0,66,0,59,-80,0,-64,0,0,0,72,0,0,0,0,0,-30,0,0,0,0,0,0,0,0,0,116,0,0,0,0,0,0,120,-69,-79,0,0,117,0,-67,0,0,0,-83,0,-86,0,0,0,0,0,0,87,0,-105,0,0,0,0,0,0,0,0,0,121,0,56,0,0,0,-70,0,0,-40,0,123,0,0,0,-16,0,0,-23,-60,0,101,0,0,0,0,103,0,0,0,0,0,0,-44,0,0,0,0,0,0,112,0,0,-32,0,0,0,0,0,0,-109,0,0,-106,0,127,0,115,0,0,0,0,0,0,0,0,0,0,0,-113,0,0,92,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,123,-121,-108,0,-104,0,0,0,0,75,0,0,-126,0,0,-121,0,0,-104,0,0,-103,0,0,0,0,0,0,0,0,0,-105,0,0,0,0,0,0,0,0,0,0,0,0,0,0,94,-121,0,0,0,4,0,122,0,0,0,0,0,0,0,0,48,0,116,0,0,-57,0,0,121,0,0,0,0,0,0,0,122,0,107,-128,126,101,0,0,-109,0,-58,-52,0,-114,-115,0,0,0,0,0,0,-103,0,0,123,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,99,-70,-18,0,-68,0,0,0,0,-54,0,0,62,0,0,-40,0,0,-117,0,0,32,0,0,0,0,0,0,0,0,0,-115,0,0,0,0,0,0,0,0,0,0,0,0,0,0,125,-122,0,0,0,113,0,52,0,0,0,0,0,0,0,0,118,0,-112,0,0,116,0,0,-84,0,0,0,0,0,0,0,76,0,112,101,-75,-55,0,0,98,0,79,95,0,67,113,0,0,0,0,0,0,-10,0,0,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-99,11,78,0,-108,0,0,0,0,-119,0,0,64,0,0,-82,0,0,52,0,0,123,0,0,0,0,0,0,0,0,0,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,88,-127,0,0,0,-124,0,94,0,0,0,0,0,0,0,0,107,0,-110,0,0,-36,0,0,-95,0,0,0,0,0,0,0,-31,0,122,-62,-118,68,0,0,109,0,121,114,0,-51,-58,0,0,0,0,0,0,-121,0,0,-87,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-6,122,103,0,31,0,0,0,0,-66,0,0,117,0,0,73,0,0,-56,0,0,-75,0,0,0,0,0,0,0,0,0,105,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,-97,0,0,0,-117,0,40,0,0,0,0,0,0,0,0,61,0,127,0,0,114,0,0,-105,0,0,0,0,0,0,0,102,0,-83,111,52,-128,0,0,114,0,-77,-52,0,-94,-33,56,55,-114,0,0,0,113,-5,127,0,0,0,0,13,0,0,-95,0,0,-124,0,0,-117,37,0,0,0,-72,-31,-66,0,0,0,-123,-102,0,0,0,0,0,47,0,-90,0,0,0,0,0,0,0,-95,38,0,72,0,0,-104,0,0,0,0,-67,0,0,0,0,0,0,0,0,-55,0,0,0,0,0,0,0,0,0,0,0,0,0,-104,0,-85,23,0,0,0,0,0,0,0,0,0,-110,106,58,0,0,0,76,19,0,0,0,0,0,0,0,0,0,107,0,-119,0,0,0,-76,0,0,0,0,0,0,-92,-120,-126,0,0,0,-81,-91,43,0,0,0,0,94,0,0,-79,0,0,25,0,0,115,-125,0,0,0,106,-89,76,0,0,0,-71,-104,0,0,0,0,0,82,0,109,0,0,0,0,0,0,0,-100,-103,0,86,0,0,-99,0,0,0,0,-109,0,0,0,0,0,0,0,0,87,0,0,0,0,0,0,0,0,0,0,0,0,0,-127,0,-76,-95,0,0,0,0,0,0,0,0,0,-66,-110,114,0,0,0,-115,-126,0,0,0,0,0,0,0,0,0,-106,0,53,0,0,0,99,0,0,0,0,0,0,80,-85,-29,0,0,0,69,120,-111,0,0,0,0,108,0,0,-72,0,0,84,0,0,-40,-96,0,0,0,126,-114,51,0,0,0,-20,77,0,0,0,0,0,-114,0,-108,0,0,0,0,0,0,0,-96,-57,0,66,0,0,43,0,0,0,0,106,0,0,0,0,0,0,0,0,116,0,0,0,0,0,0,0,0,0,0,0,0,0,-88,0,-94,107,0,0,0,0,0,0,0,0,0,-126,-86,-77,0,0,0,-105,124,0,0,0,0,0,0,0,0,0,102,0,-86,0,0,0,-18,0,0,0,0,0,0,-125,126,-82,0,0,0,-59,-126,-99,0,0,0,0,-127,0,0,98,0,0,-99,0,0,85,70,0,0,0,111,-111,120,0,0,0,-93,-30,0,0,0,0,0,-104,0,-30,0,0,0,0,0,0,0,74,109,0,85,0,0,76,0,0,0,0,-52,0,0,0,0,0,0,0,0,-64,0,0,0,0,0,0,0,0,0,0,0,0,0,103,0,-102,92,0,0,0,0,0,0,0,0,0,-27,-52,-63,0,0,0,50,-37,0,0,0,0,0,0,0,0,0,-37,0,-96,0,0,0,119,0,0,0,0,0,0,0,0,-39,0,-78,0,109,89,0,0,0,0,0,0,0,52,-99,0,0,0,0,0,0,0,0,0,-8,-94,0,116,0,0,0,0,0,0,0,0,0,0,0,-73,0,0,0,0,28,-113,0,0,0,111,-70,0,0,-112,81,0,0,0,0,65,0,-38,0,0,0,0,-65,0,0,86,0,-113,119,0,60,0,0,69,0,93,0,0,0,0,76,0,93,77,69,0,0,0,0,100,0,0,-119,0,0,-80,-111,95,0,-122,0,0,-118,0,0,-45,0,0,0,0,54,0,0,0,122,0,0,0,92,0,0,0,0,83,0,67,0,-92,94,0,0,0,0,0,0,0,-104,-46,0,0,0,0,0,0,0,0,0,-125,-81,0,81,0,0,0,0,0,0,0,0,0,0,0,87,0,0,0,0,114,-32,0,0,0,-45,-113,0,0,-106,19,0,0,0,0,-67,0,-106,0,0,0,0,59,0,0,119,0,125,126,0,90,0,0,-93,0,-124,0,0,0,0,105,0,-100,-119,-126,0,0,0,0,-71,0,0,36,0,0,88,-96,-113,0,-83,0,0,36,0,0,-33,0,0,0,0,-86,0,0,0,-106,0,0,0,37,0,0,0,0,-99,0,72,0,-88,121,0,0,0,0,0,0,0,82,-125,0,0,0,0,0,0,0,0,0,123,21,0,-122,0,0,0,0,0,0,0,0,0,0,0,109,0,0,0,0,-103,-125,0,0,0,-111,-32,0,0,117,96,0,0,0,0,121,0,-83,0,0,0,0,-101,0,0,-104,0,65,-37,0,-117,0,0,110,0,73,0,0,0,0,-79,0,-115,-115,-103,0,0,0,0,97,0,0,107,0,0,-91,-103,-70,0,121,0,0,-85,0,0,122,0,0,0,0,-116,0,0,0,54,0,0,0,127,0,0,0,0,126,0,-96,0,36,112,0,0,0,0,0,0,0,96,-36,0,0,0,0,0,0,0,0,0,122,-112,0,32,0,0,0,0,0,0,0,0,0,0,0,98,0,0,0,0,122,95,0,0,0,-48,-95,0,0,-94,125,0,0,0,0,125,0,109,0,0,0,0,-91,0,0,-84,0,-21,59,0,-84,0,0,-46,0,75,0,0,0,0,-81,0,-102,-68,91,0,0,0,0,-128,0,0,87,0,0,90,-24,91,0,117,0,0,124,0,0,124,0,0,0,0,106,0,0,0,-93,0,0,0,54,0,0,-119,0,0,0,88,22,0,0,0,0,78,-33,-61,0,114,0,0,0,0,-76,112,0,0,0,0,0,0,0,104,0,0,0,0,0,125,0,0,-16,0,-69,83,0,0,0,0,0,0,0,0,-33,0,0,0,0,54,72,-73,0,-105,65,0,0,57,-122,0,106,-111,0,-72,0,115,0,113,0,0,0,0,0,-93,0,-123,113,-68,-111,0,0,0,0,0,0,0,0,0,0,0,0,0,68,0,-17,-52,71,0,0,0,0,0,0,0,0,0,0,0,0,0,67,119,0,-80,0,51,0,0,0,0,102,95,28,0,0,0,-74,127,0,0,0,0,92,-125,-125,0,47,0,0,0,0,-71,123,0,0,0,0,0,0,0,41,0,0,0,0,0,72,0,0,-118,0,-114,-102,0,0,0,0,0,0,0,0,121,0,0,0,0,-84,-108,110,0,-107,122,0,0,69,100,0,-105,83,0,-78,0,-51,0,-102,0,0,0,0,0,-36,0,120,-121,-97,-53,0,0,0,0,0,0,0,0,0,0,0,0,0,120,0,-117,-121,-122,0,0,0,0,0,0,0,0,0,0,0,0,0,-59,100,0,64,0,121,0,0,0,0,-116,-35,122,0,0,0,115,-128,0,0,0,0,39,95,-107,0,124,0,0,0,0,59,78,0,0,0,0,0,0,0,122,0,0,0,0,0,105,0,0,98,0,60,100,0,0,0,0,0,0,0,0,116,0,0,0,0,112,-114,-126,0,8,121,0,0,-112,-94,0,-128,112,0,99,0,83,0,-104,0,0,0,0,0,-73,0,-97,69,-94,-81,0,0,0,0,0,0,0,0,0,0,0,0,0,-52,0,112,-55,-125,0,0,0,0,0,0,0,0,0,0,0,0,0,-97,-54,0,126,0,110,0,0,0,0,95,74,63,0,0,0,111,61,0,0,0,0,110,-96,101,0,21,0,0,0,0,-124,-17,0,0,0,0,0,0,0,108,0,0,0,0,0,52,0,0,-77,0,123,109,0,0,0,0,0,0,0,0,66,0,0,0,0,89,120,-93,0,-103,-97,0,0,94,116,0,39,-102,0,-113,0,-90,0,-76,0,0,0,0,0,-111,0,-47,105,114,77,0,0,0,0,0,0,0,0,0,0,0,0,0,87,0,-123,101,-41,0,0,0,0,0,0,0,0,0,0,0,0,0,96,81,0,92,0,-54,0,0,0,0,-55,118,101,0,0,0,0,0,0,19,0,0,0,-127,0,0,107,0,0,-128,-107,110,0,-57,112,0,0,88,0,113,0,0,0,0,0,0,0,0,-19,0,-120,0,-125,0,-107,0,-116,0,0,-85,0,0,0,0,0,0,-124,0,0,0,0,0,0,0,-20,0,59,0,0,0,0,0,0,0,0,0,0,-85,-90,0,0,0,-81,0,97,0,0,-107,0,-102,0,-82,0,0,0,42,0,0,0,-59,0,0,0,0,0,0,0,0,59,25,0,0,0,55,0,0,0,0,-108,0,0,0,0,0,0,0,0,0,0,-114,0,0,0,0,0,0,111,0,0,0,-37,0,0,126,0,0,109,62,110,0,38,-32,0,0,-92,0,88,0,0,0,0,0,0,0,0,-111,0,-3,0,-23,0,-122,0,-35,0,0,52,0,0,0,0,0,0,-114,0,0,0,0,0,0,0,125,0,-128,0,0,0,0,0,0,0,0,0,0,63,-69,0,0,0,125,0,122,0,0,-64,0,-107,0,-105,0,0,0,-95,0,0,0,76,0,0,0,0,0,0,0,0,-41,-128,0,0,0,118,0,0,0,0,97,0,0,0,0,0,0,0,0,0,0,-48,0,0,0,0,0,0,102,0,0,0,-34,0,0,80,0,0,123,-123,-68,0,126,98,0,0,-56,0,76,0,0,0,0,0,0,0,0,-107,0,-87,0,53,0,-10,0,-74,0,0,83,0,0,0,0,0,0,-126,0,0,0,0,0,0,0,119,0,-114,0,0,0,0,0,0,0,0,0,0,-117,121,0,0,0,67,0,33,0,0,92,0,-100,0,-120,0,0,0,-105,0,0,0,124,0,0,0,0,0,0,0,0,125,88,0,0,0,114,0,0,0,0,-109,0,0,0,0,0,0,0,0,0,0,-60,0,0,0,0,0,0,-110,0,0,0,126,0,0,29,0,0,28,71,-39,0,100,-82,0,0,97,0,-77,0,0,0,0,0,0,0,0,116,0,-115,0,117,0,-122,0,109,0,0,115,0,0,0,0,0,0,-122,0,0,0,0,0,0,0,-115,0,7,0,0,0,0,0,0,0,0,0,0,52,111,0,0,0,82,0,93,0,0,-62,0,83,0,10,0,0,0,-78,0,0,0,-67,0,0,0,0,0,0,0,0,88,68,0,0,0,67,0,0,0,0,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-99,-67,-123,0,0,110,0,0,0,0,0,0,0,60,0,-82,0,0,0,64,116,-125,0,-115,0,0,0,0,0,0,126,126,0,0,0,0,0,0,0,69,0,0,0,0,0,-120,0,0,0,0,-66,-110,0,0,0,0,0,0,0,102,115,0,0,0,0,0,0,0,-40,0,0,0,0,0,-115,0,0,-90,0,0,0,0,0,0,117,0,-87,0,98,0,0,-110,-122,-105,0,0,0,-115,86,0,-86,0,-91,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,126,99,0,0,0,0,0,0,92,-88,-108,0,0,-74,0,0,0,0,0,0,0,-82,0,88,0,0,0,-111,-55,103,0,-41,0,0,0,0,0,0,-109,-47,0,0,0,0,0,0,0,-113,0,0,0,0,0,125,0,0,0,0,122,10,0,0,0,0,0,0,0,106,-121,0,0,0,0,0,0,0,99,0,0,0,0,0,-49,0,0,-61,0,0,0,0,0,0,115,0,83,0,125,0,0,97,36,55,0,0,0,83,-48,0,-90,0,69,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-81,80,0,0,0,0,0,0,77,118,102,0,0,50,0,0,0,0,0,0,0,79,0,-113,0,0,0,-46,75,-29,0,88,0,0,0,0,0,0,-101,-38,0,0,0,0,0,0,0,-53,0,0,0,0,0,-30,0,0,0,0,-113,-78,0,0,0,0,0,0,0,98,-78,0,0,0,0,0,0,0,101,0,0,0,0,0,-123,0,0,94,0,0,0,0,0,0,-57,0,127,0,121,0,0,-104,105,-121,0,0,0,121,125,0,-79,0,-77,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-60,27,0,0,0,0,0,0,101,-96,44,0,0,-109,0,0,0,0,0,0,0,110,0,-124,0,0,0,-91,95,-56,0,-81,0,0,0,0,0,0,-9,117,0,0,0,0,0,0,0,-106,0,0,0,0,0,-44,0,0,0,0,68,-120,0,0,0,0,0,0,0,5,-69,0,0,0,0,0,0,0,126,0,0,0,0,0,20,0,0,-63,0,0,0,0,0,0,-60,0,-78,0,62,0,0,6,-48,-83,0,0,0,-30,-114,0,-107,0,99,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,85,108,0,0,0,92,28,0,116,0,0,0,0,0,0,0,0,0,0,0,0,-22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,107,-80,-40,-102,123,0,0,0,115,0,0,0,-88,0,-99,0,0,0,0,0,0,0,0,50,0,-57,0,-91,100,0,0,36,0,0,0,0,109,0,0,0,0,-48,-116,0,-113,-106,71,0,0,0,0,0,-126,0,0,0,0,0,0,0,0,0,-124,0,25,0,0,86,0,0,0,0,-127,0,0,0,0,0,0,0,0,0,0,0,0,115,0,0,0,0,0,0,0,0,0,98,-121,0,-120,0,0,0,0,0,0,0,0,0,0,0,0,-94,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,91,61,-82,-77,83,0,0,0,-82,0,0,0,63,0,94,0,0,0,0,0,0,0,0,-73,0,124,0,-91,-102,0,0,113,0,0,0,0,-50,0,0,0,0,121,94,0,106,-62,-105,0,0,0,0,0,-31,0,0,0,0,0,0,0,0,0,-68,0,-106,0,0,112,0,0,0,0,-78,0,0,0,0,0,0,0,0,0,0,0,0,-75,0,0,0,0,0,0,0,0,0,-114,125,0,-84,0,0,0,0,0,0,0,0,0,0,0,0,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,-110,122,122,-24,0,0,0,-78,0,0,0,87,0,76,0,0,0,0,0,0,0,0,-94,0,70,0,-56,34,0,0,-126,0,0,0,0,88,0,0,0,0,103,64,0,-44,-66,-78,0,0,0,0,0,84,0,0,0,0,0,0,0,0,0,52,0,74,0,0,121,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,127,0,0,0,0,0,0,0,0,0,-87,-125,0,-86,0,0,0,0,0,0,0,0,0,0,0,0,-124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-95,97,-114,46,-121,0,0,0,76,0,0,0,124,0,-124,0,0,0,0,0,0,0,0,122,0,-87,0,102,118,0,0,-84,0,0,0,0,-97,0,0,0,0,52,48,0,111,78,71,0,0,0,0,0,-94,0,0,0,0,0,0,0,0,0,102,0,127,0,0,-126,0,0,0,0,-116,0,0,0,0,0,0,0,0,0,0,0,0,108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-67,0,0,0,0,-124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,126,0,0,0,0,111,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,110,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,118,0,0,0,0,99,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-118,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}
+
+#define IP_SPARSE_WEIGHT {60,107,-92,-118,58,94,-104,47,-80,-73,78,-101,115,111,94,-61,94,-20,63,-121,100,-111,-69,-74,-121,107,-61,110,-106,-38,-43,-116,26,103,-125,88,94,111,120,-39,-79,-85,112,34,121,-121,-93,97,-45,-90,-106,-59,-97,109,-102,-41,-126,-76,-73,93,-34,110,117,62,-89,-100,120,-79,59,-127,-19,89,116,-46,113,-94,94,67,110,-14,-63,95,-87,-65,63,111,-93,110,-126,7,113,120,-127,-70,43,-122,-72,108,-103,127,116,90,115,-80,-97,96,124,-112,-22,-123,88,119,-119,-115,88,22,57,68,-123,88,-76,109,-47,68,-51,-90,-98,-122,33,94,71,-121,-109,82,76,93,-111,83,0,0,117,-52,0,0,-125,80,105,-71,25,123,-127,-82,-99,101,-111,-62,-51,60,-96,82,58,41,-29,36,105,-108,-118,-124,84,-87,114,93,53,125,-127,49,96,-112,94,-100,-126,69,-115,94,74,-113,-91,-47,-115,66,-96,121,-19,-104,63,125,86,-121,103,-20,-116,-78,-58,-119,-80,-80,99,-111,109,-72,63,92,-110,82,-124,69,83,109,22,-109,-47,-110,62,125,-123,121,98,-125,92,-90,101,-120,76,66,78,99,-113,106,-125,44,-104,-44,96,-126,124,112,33,-75,-9,-126,-120,-121,-119,-127,-70,-124,-33,105,-108,77,-108,-111,111,68,-70,-119,59,-124,-95,69,-119,102,-38,57,61,104,-96,122,88,99,77,122,-124,47,126,-74,-35,107,55,-91,10,-96,-54,125,100,-116,-1,96,-70,-57,123,-111,-94,-125,-101,-128,113,-104,80,-94,-87,111,-86,-104,-48,114,-93,-73,-128,-93,-82,-102,-125,91,-108,78,-69,-95,-86,-115,-120,120,9,-121,-29,118,-94,-29,89,48,89,-110,-95,-114,-103,-127,-83,111,-100,14,124,-56,-112,-123,-105,100,67,12,-80,-76,-80,-65,108,42,106,77,69,127,89,-66,112,-126,-110,43,103,0,82,-94,115,-101,-49,-122,102,-124,-89,82,83,-53,40,125,-108,-83,-26,-119,-72,-99,97,-74,80,127,-116,79,117,-127,-62,104,113,-41,67,-73,-30,114,74,-111,-124,-52,10,-82,120,-111,-126,-97,102,18,3,112,-35,121,122,-77,-123,-60,84,69,-45,-126,-69,-98,81,101,54,77,-109,104,125,93,94,-124,-119,33,101,69,-128,-77,67,121,120,-6,-86,83,-111,-85,-15,124,-92,-119,78,-108,-76,76,122,88,95,-117,36,-72,-115,52,82,119,-62,111,-122,116,105,-63,-45,110,-103,-123,3,107,-58,-101,126,-90,23,60,78,53,-117,111,123,-78,-98,-42,-125,110,-99,-113,-110,-94,111,-99,82,-69,126,41,92,127,-102,102,-53,79,32,-119,84,115,99,-117,-117,6,46,69,106,-124,-118,-52,41,-127,69,-91,105,77,-111,-38,-104,97,44,115,64,61,-112,60,123,-105,87,69,-1,80,88,107,-114,99,110,-19,-54,90,-81,115,-126,64,-92,65,36,-93,-94,-90,-111,118,-45,-121,-3,106,47,125,98,-98,88,-81,96,-43,28,105,-115,-88,123,-58,-80,91,103,-121,-88,-66,101,-88,87,125,118,86,102,-83,111,-26,-86,-124,126,-128,-62,-89,-109,-94,94,109,-37,99,-126,-116,-85,100,113,-19,-52,-101,127,-53,93,96,67,127,120,-96,96,127,34,91,-34,-52,75,-71,-77,-46,-100,-100,-98,90,-56,-3,75,104,-126,124,68,-127,-77,104,-89,-107,-106,53,-90,-58,118,-119,0,0,-102,-18,0,0,-117,58,-82,115,-127,-66,33,-125,91,-111,-128,114,24,-89,82,127,126,-108,71,-73,20,-76,104,-71,117,88,56,52,-45,115,126,78,-77,65,49,65,-113,85,102,113,61,36,126,-72,-117,123,123,-27,68,46,55,86,-110,-115,-60,108,-97,-100,65,-64,43,-88,106,113,91,-88,-56,106,-16,-117,63,125,69,49,-107,-76,-120,106,101,98,106,53,-60,66,83,-119,111,100,65,-100,92,-83,116,50,-72,116,103,111,55,-70,-5,111,-71,122,-46,-115,51,-74,-27,125,104,-86,-102,107,-64,124,83,51,-96,118,43,-95,3,122,-106,115,96,-106,-82,51,-119,121,-80,121,-120,96,90,-77,-36,97,-78,91,95,-91,64,106,-77,-109,92,-68,75,-108,126,-71,64,77,97,-19,82,127,114,24,-121,26,118,116,-104,-120,82,-115,81,-125,-69,-100,-46,-112,-40,112,-54,-110,79,-99,-51,94,-103,-10,96,75,-115,84,-106,55,87,-79,118,-84,71,-92,107,88,-56,67,-101,29,117,115,-108,125,103,-35,117,79,-58,-118,64,94,-67,-114,73,-114,69,111,106,-102,33,-114,93,-77,71,126,-50,90,-62,-57,-89,-69,96,114,106,107,-120,-110,-58,-42,-70,102,105,-112,-126,-67,-52,-89,-94,76,-95,-97,-113,95,111,89,-105,36,61,120,120,-103,80,-111,126,-96,39,102,102,-36,-50,-98,-83,-127,-81,-97,-60,71,124,74,108,-74,1,118,-57,112,-92,-123,120,-66,-29,126,-76,-107,-38,-101,-89,51,92,-104,27,-113,-96,99,108,81,-121,2,-9,109,-70,31,-127,122,-98,114,-88,117,-66,-86,115,75,-67,124,-108,-121,-120,-61,118,77,-122,51,-88,104,106,-108,14,118,34,65,-99,-104,51,-112,19,-101,69,122,107,79,0,0,115,-58,0,0,70,-95,-96,-84,-111,-75,-101,35,112,-86,118,-43,-93,-30,-76,-127,101,105,-64,31,-93,44,-90,126,52,20,-128,-28,120,-117,82,113,-128,-39,-105,-102,-102,59,-60,99,-47,-120,126,-125,125,35,113,53,93,74,-93,-8,109,-70,-92,114,-120,-63,-70,89,102,36,114,-99,-100,-101,123,100,-120,-70,-38,102,-89,102,82,59,-90,-80,118,123,-93,-44,-110,-51,-98,105,-58,-103,-92,9,-118,110,99,-128,-53,123,-127,-125,-102,-78,88,63,-67,100,117,44,-89,-128,-102,49,-65,-43,-114,-104,-124,118,96,-16,-125,23,103,-97,-77,114,116,77,-79,-58,-113,-80,-89,-113,-83,69,61,-125,83,-119,-96,49,38,92,-80,-82,-104,-119,-26,-118,95,60,-126,-93,41,121,104,-95,122,-49,-83,119,-92,107,-125,-81,117,60,88,-111,-124,-70,68,-125,33,-83,-30,-89,93,88,64,123,-44,117,126,59,-59,98,-60,-112,125,-48,73,78,106,102,63,-67,60,-108,53,-126,124,114,0,0,-14,-108,0,0,-68,93,-111,-64,69,-109,-128,-78,110,102,-120,79,71,117,-128,-51,76,123,-41,-86,111,71,80,124,-55,-108,58,116,110,59,85,-61,-24,111,-94,-90,-128,59,-109,-95,-37,79,108,-85,102,-96,-25,-94,123,42,104,-75,123,86,63,-95,-111,-3,64,-126,-96,112,-79,-112,127,56,101,118,69,73,-62,52,125,-84,-54,-87,65,-53,-116,-120,86,-125,52,123,-38,91,120,49,-118,-56,54,-96,-74,-82,100,-118,114,95,-113,10,-85,-89,89,107,97,-99,68,68,73,-46,99,-74,-111,-63,-105,82,86,-122,102,-38,-94,-89,43,-82,74,120,-119,-106,52,-63,-80,123,124,-118,75,98,100,89,-105,96,93,-52,86,55,77,67,59,-67,-106,112,-115,-120,-110,113,0,0,44,-62,0,0,84,-126,-82,-128,105,75,-113,-99,-64,-124,100,123,105,-128,-7,117,-128,-87,-81,-75,-18,-77,116,-110,-122,-60,100,-124,117,-35,82,77,87,125,29,-127,123,100,-54,-117,-49,-77,53,-103,-110,-101,-118,108,-103,122,86,-106,54,-86,82,-44,-126,65,63,-115,76,80,-109,-50,79,-115,-89,98,-71,-61,-88,113,120,110,-102,-33,108,-31,76,-128,90,76,-62,29,-104,-105,-116,120,-125,-108,-50,-121,-103,-38,-127,-34,-64,-68,121,-84,-109,-71,12,-118,-73,80,109,106,-88,-89,89,58,-110,-73,111,-121,-87,-128,-49,34,80,86,-25,74,-74,-71,104,117,-113,-99,111,-68,-20,121,96,-108,94,103,-117,-119,116,99,47,72,-85,-124,102,26,-115,36,-114,-112,-57,-108,86,-86,-104,76,114,-81,-110,-81,-118,-99,-97,-29,68,-118,-113,94,-123,97,93,-80,-117,-52,-108,70,0,0,-21,123,0,0,122,-117,-101,121,-82,40,81,-55,94,-125,78,43,-128,-101,118,-103,127,-54,-112,-102,117,48,-67,102,121,-106,104,46,-39,52,-91,-77,121,81,-78,-94,89,-78,111,-36,116,-78,92,7,124,103,107,127,-115,80,62,99,98,-95,-74,109,-126,-61,113,21,-58,87,-103,-106,122,96,-68,-108,-38,-118,82,119,-105,-90,48,116,99,37,-80,-63,-127,88,74,-61,-85,63,-75,125,-115,67,-119,-70,71,95,27,99,-59,-94,-64,110,-125,32,-96,105,-29,-101,-76,-81,116,-98,-72,97,-16,107,0,0,123,-89,0,0,-47,-84,102,-113,-107,105,-24,-112,124,83,-110,122,50,95,92,-85,-26,103,-93,116,116,88,100,-65,77,103,102,104,-99,103,60,-96,83,71,-60,-78,-111,92,-110,123,96,-105,-74,82,112,-68,-70,-84,-105,118,-108,-47,89,98,-42,119,-100,-80,-77,87,-122,-45,-94,-115,63,86,-10,84,-47,-114,101,123,71,-111,-22,106,43,-99,-94,111,111,-50,-113,95,-66,109,-86,-66,100,-66,-40,-83,-104,125,-106,116,-45,-86,39,103,-71,108,121,120,-97,-79,0,0,77,71,0,0,-64,-102,-99,-6,59,-100,115,112,-60,116,89,-104,-83,-118,29,-111,61,121,29,-114,116,-17,105,-68,-73,-120,123,-52,100,32,-110,-76,-86,109,-124,26,103,39,114,-48,-60,99,-47,-33,-101,117,-121,-112,117,-80,-57,-65,-102,24,-107,125,46,88,-109,-86,109,83,113,-29,97,-77,-53,125,-85,69,44,-96,64,-112,-123,-36,72,-103,79,92,-109,-98,-79,40,92,98,91,115,68,-72,112,-114,-101,-73,46,58,97,-36,95,-112,117,-124,105,-54,-86,-50,0,0,-108,-111,0,0,-111,109,118,43,-87,69,74,-102,-125,-75,-66,117,43,88,82,74,-79,-51,90,-33,-100,123,127,60,-123,123,-91,-86,-75,122,-120,-27,65,-123,114,-111,35,113,126,-93,90,57,97,83,62,-117,-81,45,64,-62,102,-125,110,88,43,95,107,-97,-99,-105,-122,4,110,-49,-44,-53,-106,-95,110,-124,-121,25,54,120,-108,14,-128,-9,85,112,-85,-109,-123,-72,57,100,15,-124,-107,-121,-21,95,-98,83,123,-128,83,106,95,-61,86,-54,-123,-44,-109,-110,-36,-96,127,-83,86,127,-116,35,-1,-121,50,-110,-109,86,119,-76,0,0,-28,-90,0,0,-80,-100,-98,89,-119,-36,64,118,107,-19,54,-115,-107,75,-39,98,102,90,52,-110,-55,109,-119,-47,-121,116,103,-121,68,6,119,-38,49,-117,90,109,-90,124,-92,61,-115,-107,60,-26,93,27,111,-124,-77,123,-94,108,-89,-54,78,-108,-119,55,106,59,95,123,-100,115,-74,77,-32,-91,114,49,-126,-83,-81,84,-103,102,-69,-99,-127,87,-126,-113,119,-104,-11,79,62,26,-96,78,74,-95,85,-82,99,-66,127,94,-126,-39,-117,-7,124,101,-90,54,-102,-104,-108,80,-125,90,122,91,-111,-106,-69,55,-108,-93,-54,-87,-89,70,-125,-111,-122,-47,126,126,-119,-49,-34,46,126,-87,-107,119,62,-89,25,-89,103,100,95,-124,-95,-93,-126,-9,-54,81,69,122,-67,18,-124,98,-105,117,-61,30,-99,-99,101,-118,-94,112,-82,103,-24,-91,-71,-105,90,120,-26,-110,109,107,62,-116,94,-125,-115,-36,-96,88,123,-65,108,119,-103,123,-59,78,-68,-99,118,107,37,127,122,-70,-117,-79,62,105,-85,127,-103,122,122,110,42,68,93,117,52,46,-42,-82,-119,-90,-92,106,55,-102,-50,88,-106,74,97,110,87,71,83,-95,125,26,-29,-74,50,78,102,125,74,107,-112,93,84,108,-32,119,-113,-17,104,81,125,-100,51,125,104,56,-83,30,101,120,123,-89,-89,18,-72,112,-100,-125,-106,-114,126,-23,123,50,-109,79,-66,-101,97,38,104,68,122,-105,93,-95,-51,63,-117,126,49,-112,-126,49,127,-111,-118,-86,-89,-100,-52,-88,-97,87,-111,116,-125,-55,-53,-68,4,-123,-122,-45,57,118,101,81,51,121,115,124,80,-128,-118,-125,-43,-73,-37,123,55,121,36,-127,93,56,-76,-53,-109,119,-128,52,-19,97,112,38,-127,-50,120,67,58,-97,-94,-103,-53,123,30,-94,37,108,51,119,114,-110,-55,115,-15,74,-59,71,-117,-99,111,79,115,-99,75,116,-90,93,-109,-111,95,112,77,-29,9,95,-117,94,-104,-124,97,-109,-102,77,-94,-29,-65,95,-16,-116,78,78,-79,-107,-51,-123,-105,14,94,35,112,124,73,120,-117,-108,123,-97,-84,75,-119,72,-108,-104,81,-118,70,63,121,5,71,-49,-56,103,-121,-90,-92,-100,-75,-121,-20,-122,38,-99,110,-58,-73,-70,-120,85,121,53,101,-81,10,126,24,81,104,-77,115,89,90,88,-90,123,-90,72,109,105,107,124,-125,63,60,-47,-70,-62,112,-41,127,52,115,-56,27,-112,-107,-118,114,78,-74,-96,77,60,-117,-91,-109,-89,-26,-84,82,36,116,121,-108,49,-50,-103,-115,38,-110,93,-92,114,-84,38,-43,-61,-110,-79,68,94,95,89,40,107,-97,77,89,127,112,-111,85,-5,-53,-69,0,0,113,84,0,0,118,-80,44,-115,-100,-54,-102,65,-94,65,-85,-4,-115,-46,127,-98,86,99,-45,91,108,-99,110,106,-116,-100,-110,83,-17,-81,-121,-120,-21,106,-121,-77,117,78,-125,-32,50,104,18,-126,-117,80,95,99,73,61,116,-127,-83,98,54,-17,113,65,-121,-78,37,123,120,104,117,61,114,16,-88,-123,-100,-87,-34,-77,-120,60,-126,-120,108,-123,116,111,124,93,-74,87,121,62,-37,97,-103,-23,110,-91,68,-112,-64,-109,0,0,58,-118,0,0,-53,93,117,-70,-54,121,-103,52,82,-124,78,-112,-122,84,82,93,-67,-42,68,37,110,-103,-123,101,116,61,105,109,-122,-11,-111,44,-74,-97,42,-99,114,105,122,87,-109,-128,109,-84,-49,-75,-55,-105,-71,-111,-64,118,99,-100,-121,-128,-75,-74,96,75,36,-122,59,90,-39,96,-84,108,-127,-106,81,-58,61,122,110,-50,101,45,-114,115,-100,32,-86,-101,-100,93,41,-113,-78,94,-55,112,61,-124,119,65,-108,-109,-36,-113,-116,81,-94,-67,117,83,80,34,-62,102,108,91,-112,-116,96,-64,-68,55,-41,-124,-15,-125,44,-53,-77,99,-120,99,-34,118,89,97,106,-95,71,-108,-126,-124,121,31,120,-107,79,127,103,118,-92,126,-55,125,60,41,110,-83,76,-54,-40,-92,-107,127,89,-123,107,-98,-96,95,59,75,-95,-116,-73,104,-81,-35,-106,47,113,51,-128,82,93,-84,-118,-33,-64,98,126,-20,-49,-104,-126,46,45,92,48,85,-91,105,-98,-95,-76,108,115,-85,-56,102,36,72,-106,-115,-79,-77,-106,85,-120,41,106,-81,-107,-92,83,-97,71,113,-104,-90,-120,112,98,-111,-6,89,105,-67,-125,81,57,-126,23,118,-95,117,-112,105,-126,74,-40,123,127,-124,48,92,63,123,-98,-111,102,98,97,109,107,-1,-46,109,95,-116,119,82,125,-6,116,15,67,30,0,0,111,-106,0,0,90,80,124,-104,71,66,120,59,-94,-124,83,90,-95,-80,-96,-64,-101,99,58,-122,-56,72,126,-30,86,-50,100,-60,-93,116,-54,120,-104,103,44,-102,-65,-69,81,-79,70,-110,110,-102,76,117,-28,-67,-124,-110,-97,-79,108,-83,88,-86,26,-99,-78,64,120,87,-83,-105,-116,83,114,97,59,121,-53,56,-64,101,57,-122,-123,-70,-119,-40,-113,25,109,-124,-90,123,-85,-16,-121,109,-78,-102,82,-23,-94,-60,-104,-96,-110,91,39,101,2,103,-111,75,-6,-78,116,-44,-127,112,-92,-112,64,-51,119,-32,95,-109,118,-92,-62,119,-109,-106,73,127,53,-125,0,0,89,115,0,0,-113,-103,92,123,-10,-121,59,-87,123,99,-121,-70,-99,-6,11,122,-108,-18,-104,-68,78,103,-108,31,75,-54,-126,62,-119,-66,64,117,-121,-40,-104,-117,-82,73,52,-56,-103,32,-105,-115,123,-75,17,105,94,125,-121,-122,88,36,-127,-97,4,113,122,52,-124,-117,94,40,48,118,116,-112,107,61,-110,127,-57,116,121,-84,-36,114,-95,-105,122,76,107,112,-31,102,122,-83,-128,101,126,-75,-62,111,-118,52,101,-55,-109,98,68,-128,109,114,-58,79,-52,95,121,-77,114,-52,-114,67,-115,113,-51,-94,-58,-33,56,-92,55,-120,80,-125,-85,126,-114,-126,113,-81,-29,-82,69,-59,-5,-91,127,43,120,-126,-111,-99,13,94,-95,-79,108,-127,-72,98,-124,25,-117,115,84,-99,-40,85,37,-125,-72,106,-96,70,126,111,-31,-89,-66,76,-114,-111,51,120,-123,-71,-102,-104,-20,-93,77,-30,47,82,-90,109,-114,-104,-108,-30,-95,-100,38,-103,-96,74,-57,109,72,86,-104,-99,66,85,43,76,-67,-109,-55,87,106,-52,116,-64,-104,-127,-85,-76,-88,103,-94,-102,23,-95,-110,-66,107,92,-126,-27,106,-110,58,114,-86,-52,-77,-63,76,-115,19,-126,-105,50,124,-37,107,-106,-119,53,102,-37,-86,-96,-76,99,0,0,-18,119,0,0,-39,83,-78,67,-99,126,72,-96,109,-92,89,94,-88,36,121,112,52,-104,-99,-46,82,96,-125,-36,-8,-125,-94,-81,123,122,21,-112,116,81,-73,87,-122,32,109,98,28,114,-113,-32,-103,122,-125,95,111,-45,-70,-113,-111,-48,-32,-95,-112,-106,81,19,117,-94,96,125,65,-67,-38,-106,121,125,-83,109,-65,59,86,119,-101,-91,-104,-84,-113,125,119,126,65,-21,-37,59,60,90,69,-93,-117,-84,110,-46,93,-124,76,105,73,75,-79,-81,93,-100,77,-119,-115,-102,-115,-68,69,-126,100,-71,-103,91,97,-128,-119,36,-80,88,107,87,-91,90,-111,-96,95,-113,-103,-24,-70,91,-122,-83,-118,36,121,117,-85,124,-45,-33,54,-86,122,124,-116,106,122,-106,92,37,54,-93,127,54,-119,28,88,-74,122,63,115,111,22,127,78,92,-128,61,39,110,-33,-125,-61,-125,95,-96,-107,101,114,47,-76,-71,124,21,59,-124,112,123,104,41,78,-17,122,108,125,72,-16,-118,105,52,98,-77,-69,-114,83,-102,60,123,100,109,-33,121,54,-84,116,66,112,89,72,-108,-73,110,-114,120,-126,-93,-105,-107,65,122,8,-103,121,-97,57,69,-122,100,-112,94,-94,116,106,-105,-111,83,-128,39,112,-102,-72,-78,115,-51,99,-113,83,-90,113,-102,-93,-36,-104,-76,-73,-111,-123,120,113,-121,-97,-47,69,105,-68,-97,-111,-53,-94,114,-81,77,68,120,-17,-117,-52,87,112,-123,-52,-121,71,-122,-55,101,-125,-41,67,-59,119,100,-97,96,-54,81,-80,64,51,121,126,92,110,-54,102,-116,95,-35,95,-55,74,118,101,-114,19,111,-48,-60,102,-110,-127,-37,107,126,-34,126,80,29,-128,109,-107,62,123,28,-123,71,110,110,-57,38,-68,-39,126,100,112,-32,88,-92,98,-82,-56,97,113,88,-19,-111,76,-77,-107,116,-120,-3,-125,-23,-87,-115,53,117,-107,-122,-116,-35,-10,-122,-74,109,-85,52,-124,-114,83,115,-126,-122,-20,125,59,-128,119,-115,-114,7,-85,63,-90,-69,-117,52,121,111,-81,125,97,122,67,82,33,93,-107,-64,-102,-107,92,-62,-100,83,-82,-105,42,-95,-120,10,-105,-78,-59,76,59,-41,124,-67,125,88,25,-128,55,118,88,68,114,67,-108,97,0,0,-109,68,0,0,-99,92,-67,-88,77,101,118,-96,-123,-108,110,-74,102,44,50,-109,60,-82,-82,88,79,110,-113,-124,64,-111,116,-55,-46,-91,75,95,-125,103,-115,-41,-29,-56,88,-81,126,-109,126,-47,-101,-9,-38,117,69,-113,-120,125,-53,-106,-30,-44,-66,122,-110,10,-113,68,-78,-120,102,106,115,-121,98,5,-78,-69,-40,99,-115,-49,101,126,-123,20,-90,-61,117,115,94,-63,-57,-60,-87,83,98,125,127,-78,121,62,-110,97,-122,36,-104,6,105,-48,-105,55,-115,83,-121,-83,121,-30,86,-48,-86,-90,125,-114,-79,-107,-91,69,126,-81,-77,99,-60,85,99,80,0,0,27,108,0,0,92,98,28,-121,-114,-87,125,-125,116,-120,-22,-94,-84,-86,97,-124,107,91,-80,61,29,-95,-110,97,-40,-82,-102,-77,122,-114,122,46,123,83,115,-82,-24,-121,-78,76,-88,63,-99,94,87,124,76,-124,50,-73,-57,124,-94,122,70,-87,-91,-91,100,-102,-56,102,34,118,36,113,109,-50,-126,-84,88,-97,-48,121,-116,94,103,52,64,48,-113,106,-106,-62,-44,111,-66,78,71,-105,-126,-31,-78,71,84,-94,-124,-68,25,-106,52,102,74,127,86,112,-127,-78,121,-126,8,-116,115,-75,0,0,127,108,0,0,-124,-108,-67,126,110,0,118,0,-124,111,-124,100,99,0,-118,0}
+
+#define IP_SPARSE_INDEX {4,5,11,12,14,17,19,20,21,23,24,25,26,43,47,50,52,59,61,66,79,84,86,91,96,99,100,106,107,112,113,117,119,121,124,124,0,3,6,14,19,20,22,24,26,28,36,38,49,56,59,60,65,68,69,75,76,79,89,93,94,95,97,100,102,104,113,114,116,117,119,124,1,2,9,11,13,15,22,26,34,37,38,51,53,60,61,69,71,75,79,82,84,85,93,101,103,105,107,111,114,117,118,122,123,125,3,4,7,11,17,29,36,40,50,53,61,62,63,67,72,77,78,82,91,93,98,103,110,114,116,117,1,6,10,13,23,26,27,30,40,42,43,44,46,47,50,52,53,54,56,57,64,65,70,72,74,75,76,80,82,86,96,97,99,102,107,112,122,122,6,8,9,13,18,19,25,29,31,37,44,50,66,69,75,79,81,90,91,94,96,108,109,110,111,119,120,125,7,9,10,12,15,17,21,23,27,30,34,39,44,51,56,58,61,63,65,68,70,72,79,82,85,88,91,98,104,107,117,118,6,7,13,19,20,22,33,36,42,44,45,48,50,53,61,64,71,72,74,80,81,89,97,99,100,111,115,118,121,121,5,16,19,26,27,35,36,38,39,58,60,66,72,73,74,79,82,86,87,95,96,99,108,109,110,115,4,5,12,16,21,24,27,36,41,56,68,71,76,77,86,90,95,101,102,103,107,116,123,124,125,125,2,3,11,14,15,16,20,21,22,25,26,30,34,38,39,45,48,49,50,52,56,59,61,67,72,78,89,92,93,98,99,101,102,103,107,112,119,120,125,125,0,4,8,9,12,13,14,15,16,17,19,21,22,24,28,29,31,32,35,37,39,41,46,51,64,66,67,68,71,80,83,85,88,91,94,97,100,106,107,109,112,115,117,119,122,122,6,24,25,27,38,45,46,47,54,56,62,63,64,65,67,69,70,73,74,81,86,87,92,99,107,116,124,125,126,126,0,1,22,24,33,41,45,46,52,57,59,61,78,85,90,91,92,93,95,96,105,106,113,118,120,122,125,125,0,2,5,13,14,26,32,34,36,41,46,48,51,55,61,69,74,83,87,90,92,97,99,104,109,112,114,114,1,6,9,10,13,15,17,23,25,28,29,33,35,36,37,50,56,58,60,67,68,70,73,83,95,100,102,107,117,124,126,126,8,16,21,26,28,29,30,32,33,35,36,37,39,40,42,46,50,51,52,54,56,57,64,66,71,75,77,83,88,90,95,97,98,99,101,102,105,107,110,112,116,117,119,120,122,124,2,6,7,14,15,29,32,35,38,49,50,53,55,57,63,68,71,72,81,83,87,93,96,97,102,107,110,117,118,122,1,10,11,15,17,37,45,52,53,54,61,64,65,69,70,80,85,87,92,99,106,108,111,112,114,116,118,119,122,125,1,2,4,11,16,28,31,33,38,47,55,57,59,63,69,72,74,75,77,78,81,83,84,87,93,100,113,115,118,120,123,123,14,18,23,24,31,32,47,49,53,56,58,66,70,71,76,79,82,87,90,99,100,102,105,109,121,121,0,1,3,15,24,29,31,32,33,35,37,43,46,47,49,53,55,57,60,66,74,79,86,88,93,99,105,107,108,113,115,119,121,124,2,4,6,10,19,22,24,26,31,35,36,39,42,43,48,50,51,55,59,61,65,68,75,83,84,88,91,96,97,103,106,107,119,125,126,126,0,2,3,5,9,15,25,32,33,34,37,39,43,45,52,54,64,66,70,73,75,79,82,83,85,90,97,104,107,114,117,119,121,121,6,9,34,35,36,38,43,46,49,52,55,65,80,81,85,87,96,98,101,104,112,114,115,116,117,120,122,123,125,126,0,1,2,6,7,8,13,16,19,22,23,27,28,29,33,34,40,42,50,51,53,56,61,70,84,86,87,97,98,99,103,104,114,116,120,120,2,4,6,7,15,16,26,27,29,41,46,47,51,52,55,56,61,63,68,71,73,74,76,79,81,86,88,89,90,95,98,101,102,103,105,108,111,116,120,124,0,4,5,10,11,12,14,19,20,28,34,37,39,40,49,54,55,56,58,59,62,63,65,66,68,70,72,78,80,81,82,83,97,99,100,101,115,116,118,120,125,126,0,7,11,14,17,18,19,21,22,25,27,36,38,40,42,44,47,54,62,64,75,76,80,82,85,87,89,93,97,106,107,111,116,116,4,5,6,9,17,19,23,24,25,27,34,35,43,49,54,55,63,64,72,78,81,88,90,92,95,96,97,101,102,104,106,123,124,124,1,2,4,17,33,34,35,36,37,41,45,47,56,58,60,61,64,69,74,75,77,78,79,85,95,97,100,105,118,118,23,62,67,111}
+
+#define IP_SPARSE_COUNT {18,18,17,13,19,14,16,15,13,13,20,23,15,14,14,16,23,15,15,16,13,17,18,17,15,18,20,21,17,17,15,2}
+
@@ -143,6 +143,42 @@ extern    "C"
                                                                 q7_t * bufferB  //buffer space for output
         );
 
+    void      arm_convolve_HWC_s8_ref(const q7_t * Im_in,   // input image
+                                      const uint16_t dim_im_in, // input image dimention
+                                      const uint16_t ch_im_in,  // number of input image channels
+                                      const q7_t * wt,  // kernel weights
+                                      const uint16_t ch_im_out, // number of filters, i.e., output image channels
+                                      const uint16_t dim_kernel,    // filter kernel size
+                                      const uint16_t padding,   // padding sizes
+                                      const uint16_t stride,    // stride
+                                      const q31_t * bias,   // per-channel bias
+                                      const q31_t * out_mult,   // per-channel output multipliers
+                                      const int32_t * out_shift,    // per-channel output shifts
+                                      const int32_t input_offset, const int32_t output_offset,  // zero points
+                                      const int32_t act_min, const int32_t act_max, // output range
+                                      q7_t * Im_out,    // output image
+                                      const uint16_t dim_im_out,    // output image dimension
+                                      q15_t * bufferA   //buffer space for input
+        );
+
+    void      arm_depthwise_conv_HWC_s8_ref(const q7_t * Im_in, // input image
+                                            const uint16_t dim_im_in,   // input image dimention
+                                            const uint16_t ch_im_in,    // number of input image channels
+                                            const q7_t * wt,    // kernel weights
+                                            const uint16_t ch_im_out,   // number of filters, i.e., output image channels
+                                            const uint16_t dim_kernel,  // filter kernel size
+                                            const uint16_t padding, // padding sizes
+                                            const uint16_t stride,  // stride
+                                            const q31_t * bias,   // per-channel bias
+                                            const q31_t * out_mult,   // per-channel output multipliers
+                                            const int32_t * out_shift,    // per-channel output shifts
+                                            const int32_t input_offset, const int32_t output_offset,  // zero points
+                                            const int32_t act_min, const int32_t act_max, // output range
+                                            q7_t * Im_out,  // output image
+                                            const uint16_t dim_im_out,  // output image dimension
+                                            q15_t * bufferA //buffer space for input
+        );
+
 /*
  *
  * Fully-connected reference implemenation
@@ -203,6 +239,18 @@ extern    "C"
                                                          const q7_t * bias, q15_t * pOut,   // output operand
                                                          q15_t * vec_buffer);
 
+    void      arm_fully_connected_s8_ref(const q7_t * pV,   // pointer to vector
+                                         const q7_t * pM,   // pointer to matrix
+                                         const uint16_t dim_vec,    // length of the vector
+                                         const uint16_t num_of_rows,    // numCol of A
+                                         const q31_t * bias,    // per-row bias
+                                         const q31_t * out_mult,    // per-row output multipliers
+                                         const int32_t * out_shift, // per-row output shifts
+                                         const int32_t input_offset, const int32_t output_offset,   // zero points
+                                         const int32_t act_min, const int32_t act_max,  // output range
+                                         q7_t * pOut,   // output operand
+                                         q15_t * vec_buffer);
+
 /*
  *
  * Pooling reference implemenation
@@ -229,6 +277,27 @@ extern    "C"
                                      q7_t * bufferA,    // a buffer for local storage
                                      q7_t * Im_out);
 
+    void      arm_avepool_s8_HWC_ref(const q7_t * Im_in,    // input image
+                                     const uint16_t dim_im_in,  // input image dimension
+                                     const uint16_t ch_im_in,   // number of input image channels
+                                     const uint16_t dim_kernel, // window kernel size
+                                     const uint16_t padding,    // padding sizes
+                                     const uint16_t stride, // stride
+                                     const uint16_t dim_im_out, // output image dimension
+                                     const int32_t act_min, const int32_t act_max,  // output range
+                                     q15_t * bufferA,   // a buffer for local storage
+                                     q7_t * Im_out);
+
+    void      arm_maxpool_s8_HWC_ref(const q7_t * Im_in,    // input image
+                                     const uint16_t dim_im_in,  // input image dimension
+                                     const uint16_t ch_im_in,   // number of input image channels
+                                     const uint16_t dim_kernel, // window kernel size
+                                     const uint16_t padding,    // padding sizes
+                                     const uint16_t stride, // stride
+                                     const uint16_t dim_im_out, // output image dimension
+                                     const int32_t act_min, const int32_t act_max,  // output range
+                                     q7_t * Im_out);
+
 /*
  *
  * Other reference implemenation
@@ -239,10 +308,21 @@ extern    "C"
 
     void      arm_relu_q15_ref(q15_t * data, uint16_t size);
 
+    void      arm_relu6_q7_ref(q7_t * data, uint32_t size, uint16_t int_width);
+
+    void      arm_relu6_q15_ref(q15_t * data, uint32_t size, uint16_t int_width);
+
+    void      arm_leaky_relu_q7_ref(q7_t * data, uint32_t size, q15_t alpha);
+
+    void      arm_leaky_relu_q15_ref(q15_t * data, uint32_t size, q15_t alpha);
+
     void      arm_nn_mult_q7_ref(q7_t * pSrcA, q7_t * pSrcB, q7_t * pDst, const uint16_t out_shift, uint32_t blockSize);
 
     void      arm_nn_mult_q15_ref(q15_t * pSrcA, q15_t * pSrcB, q15_t * pDst, const uint16_t out_shift, uint32_t blockSize);
 
+    q7_t      arm_nn_requantize_s8_ref(const q31_t val, const q31_t multiplier, const int32_t shift,
+                                       const int32_t output_offset, const int32_t act_min, const int32_t act_max);
+
 #ifdef __cplusplus
 }
 #endif
@@ -46,9 +46,17 @@
 #define TEST_CONV
 #define TEST_NONSQUARE
 #define TEST_NNMULT
+#define TEST_GRAPH
+#define TEST_FUSED
+#define TEST_S8
+#define TEST_WINOGRAD
+#define TEST_DEPTHWISE
+#define TEST_RECURRENT
+#define TEST_ACTI
+#define TEST_GEMM
 
 int test_index = 0;
-q7_t test_flags[50];
+q7_t test_flags[200];
 bool test_pass;
 
 int main()
@@ -63,7 +71,7 @@ int main()
     q7_t     *test3;
     q15_t    *test4;
 
-    for (test_index = 0; test_index<50; test_index++) {
+    for (test_index = 0; test_index<200; test_index++) {
         test_flags[test_index] = -1;
     }
     test_index = 0;
@@ -207,6 +215,7 @@ int main()
 
 #define POOL_IM_DIM 32
 #define POOL_IM_CH 8
+#define POOL_IM_CH_TAIL 7
 
     test1 = new q7_t[POOL_IM_DIM * POOL_IM_DIM * POOL_IM_CH * 2];
     test2 = new q15_t[POOL_IM_DIM * POOL_IM_CH];
@@ -292,6 +301,26 @@ int main()
         printf("Outputs match.\n");
     }
 
+    // a channel count that is not a multiple of 4, so the optimized maxpool has a tail
+    for (int i = 0; i < POOL_IM_DIM * POOL_IM_DIM * POOL_IM_CH_TAIL; i++)
+    {
+        img_in[i] = test1[i];
+    }
+
+    initialize_results_q7(pool_out_ref, pool_out_opt, POOL_IM_DIM / 2 * POOL_IM_DIM / 2 * POOL_IM_CH_TAIL);
+
+    arm_maxpool_q7_HWC_ref(img_in, POOL_IM_DIM, POOL_IM_CH_TAIL, 3, 0, 2, POOL_IM_DIM / 2, (q7_t *) test2,
+                           pool_out_ref);
+
+    for (int i = 0; i < POOL_IM_DIM * POOL_IM_DIM * POOL_IM_CH_TAIL; i++)
+    {
+        img_in[i] = test1[i];
+    }
+
+    arm_maxpool_q7_HWC(img_in, POOL_IM_DIM, POOL_IM_CH_TAIL, 3, 0, 2, POOL_IM_DIM / 2, (q7_t *) test2, pool_out_opt);
+
+    verify_results_q7(pool_out_ref, pool_out_opt, POOL_IM_DIM / 2 * POOL_IM_DIM / 2 * POOL_IM_CH_TAIL);
+
     delete[]test1;
     delete[]test2;
     delete[]test3;
@@ -340,6 +369,35 @@ int main()
 
     verify_results_q15(relu_ref_data_q15, relu_opt_data_q15, RELU_DIM);
 
+    // relu6 with six in range and saturated, then leaky relu
+    for (int t = 0; t < 4; t++)
+    {
+        for (int i = 0; i < RELU_DIM; i++)
+        {
+            test1[i] = (rand() % 256 - 128);
+            test2[i] = (rand() % 65536 - 32768);
+            test3[i] = test1[i];
+            test4[i] = test2[i];
+        }
+
+        if (t < 3)
+        {
+            arm_relu6_q7_ref(relu_ref_data_q7, RELU_DIM, 3 + t);
+            arm_relu6_q7(relu_opt_data_q7, RELU_DIM, 3 + t);
+            arm_relu6_q15_ref(relu_ref_data_q15, RELU_DIM, 2 + 3 * t);
+            arm_relu6_q15(relu_opt_data_q15, RELU_DIM, 2 + 3 * t);
+        } else
+        {
+            arm_leaky_relu_q7_ref(relu_ref_data_q7, RELU_DIM, 3277);
+            arm_leaky_relu_q7(relu_opt_data_q7, RELU_DIM, 3277);
+            arm_leaky_relu_q15_ref(relu_ref_data_q15, RELU_DIM, 3277);
+            arm_leaky_relu_q15(relu_opt_data_q15, RELU_DIM, 3277);
+        }
+
+        verify_results_q7(relu_ref_data_q7, relu_opt_data_q7, RELU_DIM);
+        verify_results_q15(relu_ref_data_q15, relu_opt_data_q15, RELU_DIM);
+    }
+
     delete[]test1;
     delete[]test2;
     delete[]test3;
@@ -357,6 +415,10 @@ int main()
     q7_t      ip_q7_q15_opt_weights[IP_ROW_DIM * IP_COL_DIM] = IP4_q7_q15_WEIGHT;
     q15_t     ip_q15_weights[IP_ROW_DIM * IP_COL_DIM] = IP2_WEIGHT;
     q15_t     ip_q15_opt_weights[IP_ROW_DIM * IP_COL_DIM] = IP4_WEIGHT_Q15;
+    q7_t      ip_pruned_weights[IP_ROW_DIM * IP_COL_DIM] = IP2_PRUNED_WEIGHT;
+    q7_t      ip_sparse_weights[] = IP_SPARSE_WEIGHT;
+    uint16_t  ip_sparse_index[] = IP_SPARSE_INDEX;
+    uint16_t  ip_sparse_count[] = IP_SPARSE_COUNT;
 
     test1 = new q7_t[IP_COL_DIM + IP_ROW_DIM];
     test2 = new q15_t[IP_COL_DIM];
@@ -466,6 +528,33 @@ int main()
 
     verify_results_q15(ip_out_q15_ref, ip_out_q15_opt, IP_ROW_DIM);
 
+    initialize_results_q7(ip_out_q7_ref, ip_out_q7_opt, IP_ROW_DIM);
+
+    printf("Start ref pruned q7 implementation\n");
+
+    arm_fully_connected_q7_ref(test1, ip_pruned_weights, IP_COL_DIM, IP_ROW_DIM, 1, 7, ip_bias_q7, ip_out_q7_ref, test2);
+
+    printf("Start sparse q7 implementation\n");
+
+    arm_fully_connected_q7_sparse(test1, ip_sparse_weights, ip_sparse_index, ip_sparse_count, IP_COL_DIM, IP_ROW_DIM,
+                                  1, 7, ip_bias_q7, ip_out_q7_opt, test2);
+
+    verify_results_q7(ip_out_q7_ref, ip_out_q7_opt, IP_ROW_DIM);
+
+    initialize_results_q15(ip_out_q15_ref, ip_out_q15_opt, IP_ROW_DIM);
+
+    printf("Start ref pruned q7_q15 implementation\n");
+
+    arm_fully_connected_mat_q7_vec_q15_ref(test4, ip_pruned_weights, IP_COL_DIM, IP_ROW_DIM, 1, 7, ip_bias_q7,
+                                           ip_out_q15_ref, test2);
+
+    printf("Start sparse q7_q15 implementation\n");
+
+    arm_fully_connected_mat_q7_vec_q15_sparse(test4, ip_sparse_weights, ip_sparse_index, ip_sparse_count, IP_COL_DIM,
+                                              IP_ROW_DIM, 1, 7, ip_bias_q7, ip_out_q15_opt, test2);
+
+    verify_results_q15(ip_out_q15_ref, ip_out_q15_opt, IP_ROW_DIM);
+
     delete[]test1;
     delete[]test2;
     delete[]test3;
@@ -781,6 +870,1003 @@ int main()
     delete[]test3;
     delete[]test4;
 
+#endif
+
+#ifdef TEST_GRAPH
+
+#define GRAPH_IM_DIM 8
+#define GRAPH_IM_CH 8
+#define GRAPH_OUT_CH 16
+#define GRAPH_POOL_DIM 4
+#define GRAPH_FC_DIM (2 * 2 * GRAPH_OUT_CH)
+#define GRAPH_FC_OUT 16
+#define GRAPH_CLASSES 10
+#define GRAPH_NUM_TENSORS 10
+#define GRAPH_NUM_LAYERS 10
+
+    /* weight blob: conv RGB, conv basic, depthwise, conv fast, fc, fc opt */
+    const uint32_t wt0 = 0;
+    const uint32_t bias0 = wt0 + 3 * 3 * 3 * GRAPH_IM_CH;
+    const uint32_t wt1 = bias0 + GRAPH_IM_CH;
+    const uint32_t bias1 = wt1 + GRAPH_IM_CH * 3 * 3 * GRAPH_IM_CH;
+    const uint32_t wt2 = bias1 + GRAPH_IM_CH;
+    const uint32_t bias2 = wt2 + GRAPH_IM_CH * 3 * 3;
+    const uint32_t wt3 = bias2 + GRAPH_IM_CH;
+    const uint32_t bias3 = wt3 + GRAPH_IM_CH * 3 * 3 * GRAPH_OUT_CH;
+    const uint32_t wt4 = bias3 + GRAPH_OUT_CH;
+    const uint32_t bias4 = wt4 + GRAPH_FC_DIM * GRAPH_FC_OUT;
+    const uint32_t wt5 = bias4 + GRAPH_FC_OUT;
+    const uint32_t bias5 = wt5 + GRAPH_FC_OUT * GRAPH_CLASSES;
+    const uint32_t wt_size = bias5 + GRAPH_CLASSES;
+
+    /* {op, in, out, dimIn, chIn, dimOut, chOut, dimKernel, padding, stride, biasShift, outShift, wtOffset, biasOffset} */
+    arm_nn_layer_q7 graph_layers[GRAPH_NUM_LAYERS] = {
+        {ARM_NN_CONV_HWC_Q7_RGB, 0, 1, GRAPH_IM_DIM, 3, GRAPH_IM_DIM, GRAPH_IM_CH, 3, 1, 1, 0, 8, wt0, bias0},
+        {ARM_NN_RELU_Q7, 1, 1, GRAPH_IM_DIM, GRAPH_IM_CH, GRAPH_IM_DIM, GRAPH_IM_CH, 0, 0, 0, 0, 0, 0, 0},
+        {ARM_NN_CONV_HWC_Q7_BASIC, 1, 2, GRAPH_IM_DIM, GRAPH_IM_CH, GRAPH_IM_DIM, GRAPH_IM_CH, 3, 1, 1, 0, 9, wt1, bias1},
+        {ARM_NN_DEPTHWISE_CONV_HWC_Q7, 2, 3, GRAPH_IM_DIM, GRAPH_IM_CH, GRAPH_IM_DIM, GRAPH_IM_CH, 3, 1, 1, 0, 7, wt2, bias2},
+        {ARM_NN_CONV_HWC_Q7_FAST, 3, 4, GRAPH_IM_DIM, GRAPH_IM_CH, GRAPH_IM_DIM, GRAPH_OUT_CH, 3, 1, 1, 0, 9, wt3, bias3},
+        {ARM_NN_MAXPOOL_HWC_Q7, 4, 5, GRAPH_IM_DIM, GRAPH_OUT_CH, GRAPH_POOL_DIM, GRAPH_OUT_CH, 2, 0, 2, 0, 0, 0, 0},
+        {ARM_NN_AVEPOOL_HWC_Q7, 5, 6, GRAPH_POOL_DIM, GRAPH_OUT_CH, 2, GRAPH_OUT_CH, 2, 0, 2, 0, 0, 0, 0},
+        {ARM_NN_FULLY_CONNECTED_Q7, 6, 7, 1, GRAPH_FC_DIM, 1, GRAPH_FC_OUT, 0, 0, 0, 0, 9, wt4, bias4},
+        {ARM_NN_FULLY_CONNECTED_Q7_OPT, 7, 8, 1, GRAPH_FC_OUT, 1, GRAPH_CLASSES, 0, 0, 0, 0, 8, wt5, bias5},
+        {ARM_NN_SOFTMAX_Q7, 8, 9, 1, GRAPH_CLASSES, 1, GRAPH_CLASSES, 0, 0, 0, 0, 0, 0, 0}
+    };
+
+    /* separate buffers for the hand-written network */
+    const uint32_t t0 = 0;
+    const uint32_t t1 = t0 + GRAPH_IM_DIM * GRAPH_IM_DIM * 3;
+    const uint32_t t2 = t1 + GRAPH_IM_DIM * GRAPH_IM_DIM * GRAPH_IM_CH;
+    const uint32_t t3 = t2 + GRAPH_IM_DIM * GRAPH_IM_DIM * GRAPH_IM_CH;
+    const uint32_t t4 = t3 + GRAPH_IM_DIM * GRAPH_IM_DIM * GRAPH_IM_CH;
+    const uint32_t t5 = t4 + GRAPH_IM_DIM * GRAPH_IM_DIM * GRAPH_OUT_CH;
+    const uint32_t t6 = t5 + GRAPH_POOL_DIM * GRAPH_POOL_DIM * GRAPH_OUT_CH;
+    const uint32_t t7 = t6 + GRAPH_FC_DIM;
+    const uint32_t t8 = t7 + GRAPH_FC_OUT;
+    const uint32_t t9 = t8 + GRAPH_CLASSES;
+    const uint32_t act_size = t9 + GRAPH_CLASSES;
+
+    test1 = new q7_t[wt_size];
+    test2 = new q15_t[2 * GRAPH_IM_CH * 3 * 3];
+    test3 = new q7_t[act_size];
+    q31_t    *graph_arena = new q31_t[act_size];
+    uint32_t *graph_offsets = new uint32_t[GRAPH_NUM_TENSORS + GRAPH_NUM_LAYERS +
+                                           ARM_NN_GRAPH_PLAN_WORK_SIZE(GRAPH_NUM_TENSORS, GRAPH_NUM_LAYERS)];
+
+    for (uint32_t i = 0; i < wt_size; i++)
+    {
+        test1[i] = rand() % 256 - 128;
+    }
+
+    for (uint32_t i = 0; i < t1; i++)
+    {
+        test3[i] = rand() % 256 - 128;
+    }
+
+    arm_nn_graph_q7 graph = {GRAPH_NUM_LAYERS, GRAPH_NUM_TENSORS, graph_layers, test1};
+    arm_nn_graph_plan plan = {0, graph_offsets, graph_offsets + GRAPH_NUM_TENSORS};
+    uint32_t *plan_work = graph_offsets + GRAPH_NUM_TENSORS + GRAPH_NUM_LAYERS;
+
+    printf("start graph planning\n");
+
+    arm_status graph_status = arm_nn_graph_plan_q7(&graph, &plan, plan_work);
+
+    printf("arena %d bytes, separate buffers %d bytes\n", (int) plan.arenaSize, (int) act_size);
+
+    test_flags[test_index++] = (graph_status == ARM_MATH_SUCCESS && plan.arenaSize < act_size) ? 0 : 1;
+
+    q7_t     *graph_arena_q7 = (q7_t *) graph_arena;
+    memcpy(graph_arena_q7 + plan.pTensorOffset[0], test3, t1);
+
+    printf("start hand-written network\n");
+
+    arm_convolve_HWC_q7_RGB(test3 + t0, GRAPH_IM_DIM, 3, test1 + wt0, GRAPH_IM_CH, 3, 1, 1, test1 + bias0, 0, 8,
+                            test3 + t1, GRAPH_IM_DIM, test2, NULL);
+    arm_relu_q7(test3 + t1, GRAPH_IM_DIM * GRAPH_IM_DIM * GRAPH_IM_CH);
+    arm_convolve_HWC_q7_basic(test3 + t1, GRAPH_IM_DIM, GRAPH_IM_CH, test1 + wt1, GRAPH_IM_CH, 3, 1, 1, test1 + bias1,
+                              0, 9, test3 + t2, GRAPH_IM_DIM, test2, NULL);
+    arm_depthwise_separable_conv_HWC_q7(test3 + t2, GRAPH_IM_DIM, GRAPH_IM_CH, test1 + wt2, GRAPH_IM_CH, 3, 1, 1,
+                                        test1 + bias2, 0, 7, test3 + t3, GRAPH_IM_DIM, test2, NULL);
+    arm_convolve_HWC_q7_fast(test3 + t3, GRAPH_IM_DIM, GRAPH_IM_CH, test1 + wt3, GRAPH_OUT_CH, 3, 1, 1, test1 + bias3,
+                             0, 9, test3 + t4, GRAPH_IM_DIM, test2, NULL);
+    arm_maxpool_q7_HWC(test3 + t4, GRAPH_IM_DIM, GRAPH_OUT_CH, 2, 0, 2, GRAPH_POOL_DIM, NULL, test3 + t5);
+    arm_avepool_q7_HWC(test3 + t5, GRAPH_POOL_DIM, GRAPH_OUT_CH, 2, 0, 2, 2, (q7_t *) test2, test3 + t6);
+    arm_fully_connected_q7(test3 + t6, test1 + wt4, GRAPH_FC_DIM, GRAPH_FC_OUT, 0, 9, test1 + bias4, test3 + t7, test2);
+    arm_fully_connected_q7_opt(test3 + t7, test1 + wt5, GRAPH_FC_OUT, GRAPH_CLASSES, 0, 8, test1 + bias5,
+                               test3 + t8, test2);
+    arm_softmax_q7(test3 + t8, GRAPH_CLASSES, test3 + t9);
+
+    printf("start graph network\n");
+
+    arm_nn_graph_run_q7(&graph, &plan, graph_arena_q7);
+
+    verify_results_q7(test3 + t8, graph_arena_q7 + plan.pTensorOffset[8], GRAPH_CLASSES);
+
+    verify_results_q7(test3 + t9, graph_arena_q7 + plan.pTensorOffset[9], GRAPH_CLASSES);
+
+    /* ReLU out-of-place and a pooling input read after the pooling are rejected */
+    printf("start graph checking\n");
+
+    graph_layers[1].out = 2;
+    graph_status = arm_nn_graph_plan_q7(&graph, &plan, plan_work);
+    graph_layers[1].out = 1;
+    graph_layers[6].in = 4;
+    graph_layers[6].dimIn = GRAPH_IM_DIM;
+    test_flags[test_index++] = (graph_status == ARM_MATH_ARGUMENT_ERROR
+                                && arm_nn_graph_plan_q7(&graph, &plan, plan_work) == ARM_MATH_ARGUMENT_ERROR) ? 0 : 1;
+
+    /* a ReLU over 64K elements is planned, a softmax of that length is not */
+    arm_nn_layer_q7 graph_big_layers[2] = {
+        {ARM_NN_RELU_Q7, 0, 0, 2, 16384, 2, 16384, 0, 0, 0, 0, 0, 0, 0},
+        {ARM_NN_SOFTMAX_Q7, 0, 1, 2, 16384, 2, 16384, 0, 0, 0, 0, 0, 0, 0}
+    };
+    arm_nn_graph_q7 graph_big = {1, 2, graph_big_layers, test1};
+
+    graph_status = arm_nn_graph_plan_q7(&graph_big, &plan, plan_work);
+    graph_big.numLayers = 2;
+    test_flags[test_index++] = (graph_status == ARM_MATH_SUCCESS
+                                && arm_nn_graph_plan_q7(&graph_big, &plan, plan_work) == ARM_MATH_SIZE_MISMATCH) ? 0 : 1;
+
+    delete[]test1;
+    delete[]test2;
+    delete[]test3;
+    delete[]graph_arena;
+    delete[]graph_offsets;
+
+#endif
+
+#ifdef TEST_FUSED
+
+#define FUSED_IM_DIM 15
+#define FUSED_IM_CH 8
+#define FUSED_OUT_CH 16
+#define FUSED_KER_DIM 5
+#define FUSED_POOL_OUT_DIM 8
+
+    printf("start fused conv relu maxpool checking\n");
+
+    test1 = new q7_t[FUSED_KER_DIM * FUSED_KER_DIM * FUSED_IM_CH * FUSED_OUT_CH + FUSED_OUT_CH];
+    test2 = new q15_t[2 * FUSED_KER_DIM * FUSED_KER_DIM * FUSED_IM_CH];
+    test3 = new q7_t[FUSED_IM_DIM * FUSED_IM_DIM * (FUSED_IM_CH + 3 * FUSED_OUT_CH) + 2 * FUSED_OUT_CH];
+
+    for (int i = 0; i < FUSED_KER_DIM * FUSED_KER_DIM * FUSED_IM_CH * FUSED_OUT_CH + FUSED_OUT_CH; i++)
+    {
+        test1[i] = rand() % 256 - 128;
+    }
+
+    for (int i = 0; i < FUSED_IM_DIM * FUSED_IM_DIM * FUSED_IM_CH; i++)
+    {
+        test3[i] = rand() % 256 - 128;
+    }
+
+    q7_t     *fused_weight = test1;
+    q7_t     *fused_bias = test1 + FUSED_KER_DIM * FUSED_KER_DIM * FUSED_IM_CH * FUSED_OUT_CH;
+    q7_t     *fused_im_in = test3;
+    q7_t     *fused_conv_out = test3 + FUSED_IM_DIM * FUSED_IM_DIM * FUSED_IM_CH;
+    q7_t     *fused_out_ref = fused_conv_out + FUSED_IM_DIM * FUSED_IM_DIM * FUSED_OUT_CH;
+    q7_t     *fused_out_opt = fused_out_ref + FUSED_IM_DIM * FUSED_IM_DIM * FUSED_OUT_CH;
+    q7_t     *fused_buf = fused_out_opt + FUSED_IM_DIM * FUSED_IM_DIM * FUSED_OUT_CH;
+
+    // 15x15 conv output, i.e. an odd number of pixels, pooled with 3x3 and 2x2 windows, and not pooled
+    const uint16_t fused_pool[5][4] = {
+        {FUSED_IM_CH, 3, 0, 2}, {FUSED_IM_CH, 2, 0, 2}, {FUSED_IM_CH, 1, 0, 1}, {3, 3, 0, 2}, {3, 3, 1, 2}
+    };
+
+    for (int t = 0; t < 5; t++)
+    {
+        const uint16_t ch_in = fused_pool[t][0];
+        const uint16_t pool_ker = fused_pool[t][1];
+        const uint16_t pool_pad = fused_pool[t][2];
+        const uint16_t pool_stride = fused_pool[t][3];
+        const uint16_t dim_out = pool_stride == 1 ? FUSED_IM_DIM : FUSED_POOL_OUT_DIM;
+
+        initialize_results_q7(fused_out_ref, fused_out_opt, dim_out * dim_out * FUSED_OUT_CH);
+
+        arm_convolve_HWC_q7_ref(fused_im_in, FUSED_IM_DIM, ch_in, fused_weight, FUSED_OUT_CH, FUSED_KER_DIM, 2, 1,
+                                fused_bias, 1, 7, fused_conv_out, FUSED_IM_DIM, test2, NULL);
+        arm_relu_q7_ref(fused_conv_out, FUSED_IM_DIM * FUSED_IM_DIM * FUSED_OUT_CH);
+        if (pool_stride == 1)
+        {
+            memcpy(fused_out_ref, fused_conv_out, FUSED_IM_DIM * FUSED_IM_DIM * FUSED_OUT_CH);
+        } else
+        {
+            arm_maxpool_q7_HWC_ref(fused_conv_out, FUSED_IM_DIM, FUSED_OUT_CH, pool_ker, pool_pad, pool_stride,
+                                   dim_out, NULL, fused_out_ref);
+        }
+
+        if (ch_in == 3)
+        {
+            arm_convolve_HWC_q7_RGB_relu_maxpool(fused_im_in, FUSED_IM_DIM, ch_in, fused_weight, FUSED_OUT_CH,
+                                                 FUSED_KER_DIM, 2, 1, fused_bias, 1, 7, FUSED_IM_DIM, pool_ker,
+                                                 pool_pad, pool_stride, fused_out_opt, dim_out, test2, fused_buf);
+        } else
+        {
+            arm_convolve_HWC_q7_fast_relu_maxpool(fused_im_in, FUSED_IM_DIM, ch_in, fused_weight, FUSED_OUT_CH,
+                                                  FUSED_KER_DIM, 2, 1, fused_bias, 1, 7, FUSED_IM_DIM, pool_ker,
+                                                  pool_pad, pool_stride, fused_out_opt, dim_out, test2, fused_buf);
+        }
+
+        verify_results_q7(fused_out_ref, fused_out_opt, dim_out * dim_out * FUSED_OUT_CH);
+    }
+
+    delete[]test1;
+    delete[]test2;
+    delete[]test3;
+
+#endif
+
+#ifdef TEST_S8
+
+#define S8_IM_DIM 9
+#define S8_IM_CH 5
+#define S8_OUT_CH 7
+#define S8_KER_DIM 3
+#define S8_DW_OUT_DIM 5
+#define S8_FC_DIM 23
+#define S8_FC_ROWS 13
+#define S8_SOFTMAX_DIM 37
+#define S8_SOFTMAX_LONG_DIM 8190
+
+    printf("start per-channel int8 checking\n");
+
+    float32_t *s8_w_float = new float32_t[S8_KER_DIM * S8_KER_DIM * S8_IM_CH * S8_OUT_CH + S8_FC_DIM * S8_FC_ROWS];
+    float32_t *s8_b_float = new float32_t[S8_FC_ROWS];
+    q31_t    *s8_params = new q31_t[3 * S8_FC_ROWS];
+    test1 = new q7_t[S8_KER_DIM * S8_KER_DIM * S8_IM_CH * S8_OUT_CH + S8_FC_DIM * S8_FC_ROWS];
+    test2 = new q15_t[2 * S8_KER_DIM * S8_KER_DIM * S8_IM_CH + 2 * S8_FC_DIM];
+    test3 = new q7_t[S8_IM_DIM * S8_IM_DIM * (S8_IM_CH + 2 * S8_OUT_CH)];
+
+    q31_t    *s8_bias = s8_params;
+    q31_t    *s8_mult = s8_params + S8_FC_ROWS;
+    int32_t  *s8_shift = (int32_t *) (s8_params + 2 * S8_FC_ROWS);
+    q7_t     *s8_im_in = test3;
+    q7_t     *s8_out_ref = test3 + S8_IM_DIM * S8_IM_DIM * S8_IM_CH;
+    q7_t     *s8_out_opt = s8_out_ref + S8_IM_DIM * S8_IM_DIM * S8_OUT_CH;
+
+    // channels get different ranges, so that their multipliers differ
+    for (int i = 0; i < S8_KER_DIM * S8_KER_DIM * S8_IM_CH * S8_OUT_CH + S8_FC_DIM * S8_FC_ROWS; i++)
+    {
+        s8_w_float[i] = (rand() % 2001 - 1000) / 1000.0f * (1 + i % 4);
+    }
+    for (int i = 0; i < S8_FC_ROWS; i++)
+    {
+        s8_b_float[i] = (rand() % 2001 - 1000) / 500.0f;
+    }
+    for (int i = 0; i < S8_IM_DIM * S8_IM_DIM * S8_IM_CH; i++)
+    {
+        s8_im_in[i] = rand() % 256 - 128;
+    }
+
+    // input zero point -5, output zero point -3, full range and fused ReLU
+    for (int t = 0; t < 2; t++)
+    {
+        const int32_t act_min = t == 0 ? -128 : -3;
+
+        arm_nn_quantize_weights_s8(s8_w_float, s8_b_float, S8_OUT_CH, S8_KER_DIM * S8_KER_DIM * S8_IM_CH, 0,
+                                   0.05f, 0.6f, test1, s8_bias, s8_mult, s8_shift);
+
+        initialize_results_q7(s8_out_ref, s8_out_opt, S8_IM_DIM * S8_IM_DIM * S8_OUT_CH);
+
+        arm_convolve_HWC_s8_ref(s8_im_in, S8_IM_DIM, S8_IM_CH, test1, S8_OUT_CH, S8_KER_DIM, 1, 1, s8_bias, s8_mult,
+                                s8_shift, 5, -3, act_min, 127, s8_out_ref, S8_IM_DIM, NULL);
+        arm_convolve_HWC_s8(s8_im_in, S8_IM_DIM, S8_IM_CH, test1, S8_OUT_CH, S8_KER_DIM, 1, 1, s8_bias, s8_mult,
+                            s8_shift, 5, -3, act_min, 127, s8_out_opt, S8_IM_DIM, test2);
+
+        verify_results_q7(s8_out_ref, s8_out_opt, S8_IM_DIM * S8_IM_DIM * S8_OUT_CH);
+    }
+
+    // depthwise, with the channel as the fastest index of the weights
+    arm_nn_quantize_weights_s8(s8_w_float, s8_b_float, S8_IM_CH, S8_KER_DIM * S8_KER_DIM, 1, 0.05f, 0.15f, test1,
+                               s8_bias, s8_mult, s8_shift);
+
+    initialize_results_q7(s8_out_ref, s8_out_opt, S8_DW_OUT_DIM * S8_DW_OUT_DIM * S8_IM_CH);
+
+    arm_depthwise_conv_HWC_s8_ref(s8_im_in, S8_IM_DIM, S8_IM_CH, test1, S8_IM_CH, S8_KER_DIM, 1, 2, s8_bias, s8_mult,
+                                  s8_shift, 5, 10, -128, 127, s8_out_ref, S8_DW_OUT_DIM, NULL);
+    arm_depthwise_conv_HWC_s8(s8_im_in, S8_IM_DIM, S8_IM_CH, test1, S8_IM_CH, S8_KER_DIM, 1, 2, s8_bias, s8_mult,
+                              s8_shift, 5, 10, -128, 127, s8_out_opt, S8_DW_OUT_DIM, test2);
+
+    verify_results_q7(s8_out_ref, s8_out_opt, S8_DW_OUT_DIM * S8_DW_OUT_DIM * S8_IM_CH);
+
+    test_flags[test_index++] =
+        arm_depthwise_conv_HWC_s8(s8_im_in, S8_IM_DIM, S8_IM_CH, test1, S8_OUT_CH, S8_KER_DIM, 1, 2, s8_bias,
+                                  s8_mult, s8_shift, 5, 10, -128, 127, s8_out_opt, S8_DW_OUT_DIM,
+                                  test2) == ARM_MATH_SIZE_MISMATCH ? 0 : 1;
+
+    // fully-connected, with an odd number of rows
+    arm_nn_quantize_weights_s8(s8_w_float, s8_b_float, S8_FC_ROWS, S8_FC_DIM, 0, 0.05f, 0.4f, test1, s8_bias,
+                               s8_mult, s8_shift);
+
+    initialize_results_q7(s8_out_ref, s8_out_opt, S8_FC_ROWS);
+
+    arm_fully_connected_s8_ref(s8_im_in, test1, S8_FC_DIM, S8_FC_ROWS, s8_bias, s8_mult, s8_shift, -7, 0, -128, 127,
+                               s8_out_ref, NULL);
+    arm_fully_connected_s8(s8_im_in, test1, S8_FC_DIM, S8_FC_ROWS, s8_bias, s8_mult, s8_shift, -7, 0, -128, 127,
+                           s8_out_opt, test2);
+
+    verify_results_q7(s8_out_ref, s8_out_opt, S8_FC_ROWS);
+
+    test_flags[test_index++] = arm_nn_quantize_weights_s8(s8_w_float, s8_b_float, S8_FC_ROWS, S8_FC_DIM, 0, 0.0f,
+                                                          0.1f, test1, s8_bias, s8_mult, s8_shift)
+        == ARM_MATH_ARGUMENT_ERROR ? 0 : 1;
+
+    // pooling, clamped to [-100, 100]
+    initialize_results_q7(s8_out_ref, s8_out_opt, S8_DW_OUT_DIM * S8_DW_OUT_DIM * S8_IM_CH);
+
+    arm_maxpool_s8_HWC_ref(s8_im_in, S8_IM_DIM, S8_IM_CH, 3, 1, 2, S8_DW_OUT_DIM, -100, 100, s8_out_ref);
+    arm_maxpool_s8_HWC(s8_im_in, S8_IM_DIM, S8_IM_CH, 3, 1, 2, S8_DW_OUT_DIM, -100, 100, s8_out_opt);
+
+    verify_results_q7(s8_out_ref, s8_out_opt, S8_DW_OUT_DIM * S8_DW_OUT_DIM * S8_IM_CH);
+
+    initialize_results_q7(s8_out_ref, s8_out_opt, S8_DW_OUT_DIM * S8_DW_OUT_DIM * S8_IM_CH);
+
+    arm_avepool_s8_HWC_ref(s8_im_in, S8_IM_DIM, S8_IM_CH, 3, 1, 2, S8_DW_OUT_DIM, -100, 100, NULL, s8_out_ref);
+    arm_avepool_s8_HWC(s8_im_in, S8_IM_DIM, S8_IM_CH, 3, 1, 2, S8_DW_OUT_DIM, -100, 100, test2, s8_out_opt);
+
+    verify_results_q7(s8_out_ref, s8_out_opt, S8_DW_OUT_DIM * S8_DW_OUT_DIM * S8_IM_CH);
+
+    // softmax, within one LSB of the float softmax
+    for (int t = 0; t < 2; t++)
+    {
+        const float64_t s8_scale = t == 0 ? 0.0625 : 0.3;
+        q31_t     s8_sm_mult;
+        int32_t   s8_sm_shift;
+        float64_t s8_sum = 0.0;
+        int       s8_max = -128;
+        bool      s8_sm_match = true;
+
+        arm_nn_quantize_multiplier(s8_scale * (1 << 26), &s8_sm_mult, &s8_sm_shift);
+        arm_softmax_s8(s8_im_in, S8_SOFTMAX_DIM, s8_sm_mult, s8_sm_shift, s8_out_opt);
+
+        for (int i = 0; i < S8_SOFTMAX_DIM; i++)
+        {
+            s8_max = s8_im_in[i] > s8_max ? s8_im_in[i] : s8_max;
+        }
+        for (int i = 0; i < S8_SOFTMAX_DIM; i++)
+        {
+            s8_sum += exp(s8_scale * (s8_im_in[i] - s8_max));
+        }
+        for (int i = 0; i < S8_SOFTMAX_DIM; i++)
+        {
+            float64_t expected = exp(s8_scale * (s8_im_in[i] - s8_max)) / s8_sum * 256.0 - 128.0;
+
+            expected = expected > 127.0 ? 127.0 : expected;
+            if (fabs(s8_out_opt[i] - expected) > 1.0)
+            {
+                printf("Output mismatch at %d, expected %f, actual %d\r\n", i, expected, s8_out_opt[i]);
+                s8_sm_match = false;
+            }
+        }
+        test_flags[test_index++] = s8_sm_match ? 0 : 1;
+    }
+
+    // softmax of equal inputs whose exponentials sum past 2^31 in Q12.19
+    {
+        q7_t     *s8_sm_long = new q7_t[2 * S8_SOFTMAX_LONG_DIM];
+        q7_t     *s8_sm_long_out = s8_sm_long + S8_SOFTMAX_LONG_DIM;
+        q31_t     s8_sm_mult;
+        int32_t   s8_sm_shift;
+        bool      s8_sm_match = true;
+
+        memset(s8_sm_long, 0, S8_SOFTMAX_LONG_DIM);
+        arm_nn_quantize_multiplier(0.0625 * (1 << 26), &s8_sm_mult, &s8_sm_shift);
+        arm_softmax_s8(s8_sm_long, S8_SOFTMAX_LONG_DIM, s8_sm_mult, s8_sm_shift, s8_sm_long_out);
+
+        for (int i = 0; i < S8_SOFTMAX_LONG_DIM; i++)
+        {
+            if (s8_sm_long_out[i] != -128)
+            {
+                printf("Output mismatch at %d, expected -128, actual %d\r\n", i, s8_sm_long_out[i]);
+                s8_sm_match = false;
+                break;
+            }
+        }
+        test_flags[test_index++] = s8_sm_match ? 0 : 1;
+
+        delete[]s8_sm_long;
+    }
+
+    delete[]s8_w_float;
+    delete[]s8_b_float;
+    delete[]s8_params;
+    delete[]test1;
+    delete[]test2;
+    delete[]test3;
+
+#endif
+
+#ifdef TEST_WINOGRAD
+
+#define WINO_MAX_DIM 10
+#define WINO_MAX_CH 8
+
+    printf("start winograd conv checking\n");
+
+    test1 = new q7_t[9 * WINO_MAX_CH * WINO_MAX_CH + WINO_MAX_CH + WINO_MAX_DIM * WINO_MAX_DIM * WINO_MAX_CH * 3];
+    test2 = new q15_t[9 * WINO_MAX_CH * WINO_MAX_CH + WINO_MAX_CH + WINO_MAX_DIM * WINO_MAX_DIM * WINO_MAX_CH * 3];
+    q15_t    *wino_wt_q7 = new q15_t[36 * WINO_MAX_CH * WINO_MAX_CH];
+    q31_t    *wino_wt_q15 = new q31_t[36 * WINO_MAX_CH * WINO_MAX_CH];
+    test4 = new q15_t[2 * 36 * WINO_MAX_CH];
+
+    // the q15 data is kept small enough for the 32-bit accumulator of the reference
+    for (int i = 0; i < 9 * WINO_MAX_CH * WINO_MAX_CH + WINO_MAX_CH + WINO_MAX_DIM * WINO_MAX_DIM * WINO_MAX_CH; i++)
+    {
+        test1[i] = rand() % 256 - 128;
+        test2[i] = rand() % 8192 - 4096;
+    }
+
+    q7_t     *wino_weight_q7 = test1;
+    q7_t     *wino_bias_q7 = wino_weight_q7 + 9 * WINO_MAX_CH * WINO_MAX_CH;
+    q7_t     *wino_im_in_q7 = wino_bias_q7 + WINO_MAX_CH;
+    q7_t     *wino_out_ref_q7 = wino_im_in_q7 + WINO_MAX_DIM * WINO_MAX_DIM * WINO_MAX_CH;
+    q7_t     *wino_out_opt_q7 = wino_out_ref_q7 + WINO_MAX_DIM * WINO_MAX_DIM * WINO_MAX_CH;
+    q15_t    *wino_weight_q15 = test2;
+    q15_t    *wino_bias_q15 = wino_weight_q15 + 9 * WINO_MAX_CH * WINO_MAX_CH;
+    q15_t    *wino_im_in_q15 = wino_bias_q15 + WINO_MAX_CH;
+    q15_t    *wino_out_ref_q15 = wino_im_in_q15 + WINO_MAX_DIM * WINO_MAX_DIM * WINO_MAX_CH;
+    q15_t    *wino_out_opt_q15 = wino_out_ref_q15 + WINO_MAX_DIM * WINO_MAX_DIM * WINO_MAX_CH;
+
+    // {ch_im_in, ch_im_out, dim_im_in, padding}, with partial output tiles and odd channel counts
+    const uint16_t wino_cfg[3][4] = { {8, 8, 10, 1}, {5, 7, 9, 1}, {4, 6, 8, 0} };
+
+    for (int t = 0; t < 3; t++)
+    {
+        const uint16_t ch_in = wino_cfg[t][0];
+        const uint16_t ch_out = wino_cfg[t][1];
+        const uint16_t dim_in = wino_cfg[t][2];
+        const uint16_t pad = wino_cfg[t][3];
+        const uint16_t dim_out = dim_in + 2 * pad - 2;
+        const int out_size = dim_out * dim_out * ch_out;
+
+        arm_convolve_HWC_q7_ref(wino_im_in_q7, dim_in, ch_in, wino_weight_q7, ch_out, 3, pad, 1, wino_bias_q7, 1, 9,
+                                wino_out_ref_q7, dim_out, NULL, NULL);
+        arm_convolve_HWC_q15_ref(wino_im_in_q15, dim_in, ch_in, wino_weight_q15, ch_out, 3, pad, 1, wino_bias_q15, 4,
+                                 14, wino_out_ref_q15, dim_out, NULL, NULL);
+
+        // both tile sizes are bit-exact
+        for (uint16_t dim_tile = 2; dim_tile <= 4; dim_tile += 2)
+        {
+            memset(wino_out_opt_q7, 0x55, out_size);
+            memset(wino_out_opt_q15, 0x55, out_size * sizeof(q15_t));
+
+            arm_nn_winograd_weights_q7(wino_weight_q7, ch_in, ch_out, dim_tile, wino_wt_q7);
+            arm_convolve_HWC_q7_winograd(wino_im_in_q7, dim_in, ch_in, wino_wt_q7, ch_out, dim_tile, pad,
+                                         wino_bias_q7, 1, 9, wino_out_opt_q7, dim_out, test4);
+            verify_results_q7(wino_out_ref_q7, wino_out_opt_q7, out_size);
+
+            arm_nn_winograd_weights_q15(wino_weight_q15, ch_in, ch_out, dim_tile, wino_wt_q15);
+            arm_convolve_HWC_q15_winograd(wino_im_in_q15, dim_in, ch_in, wino_wt_q15, ch_out, dim_tile, pad,
+                                          wino_bias_q15, 4, 14, wino_out_opt_q15, dim_out, test4);
+            verify_results_q15(wino_out_ref_q15, wino_out_opt_q15, out_size);
+        }
+    }
+
+    test_flags[test_index++] = arm_convolve_HWC_q7_winograd(wino_im_in_q7, 8, 4, wino_wt_q7, 6, 3, 0, wino_bias_q7,
+                                                            1, 9, wino_out_opt_q7, 6, test4)
+        == ARM_MATH_ARGUMENT_ERROR ? 0 : 1;
+    test_flags[test_index++] = arm_convolve_HWC_q7_winograd(wino_im_in_q7, 8, 4, wino_wt_q7, 6, 2, 0, wino_bias_q7,
+                                                            1, 9, wino_out_opt_q7, 8, test4)
+        == ARM_MATH_SIZE_MISMATCH ? 0 : 1;
+
+    delete[]test1;
+    delete[]test2;
+    delete[]test4;
+    delete[]wino_wt_q7;
+    delete[]wino_wt_q15;
+
+#endif
+
+#ifdef TEST_DEPTHWISE
+
+#define DW_MAX_DIM 10
+#define DW_MAX_CH 21
+
+    printf("start depthwise conv checking\n");
+
+    test1 = new q7_t[25 * DW_MAX_CH + DW_MAX_CH + DW_MAX_DIM * DW_MAX_DIM * DW_MAX_CH * 3];
+    test4 = new q15_t[4 * 25];
+
+    for (int i = 0; i < 25 * DW_MAX_CH + DW_MAX_CH + DW_MAX_DIM * DW_MAX_DIM * DW_MAX_CH; i++)
+    {
+        test1[i] = rand() % 256 - 128;
+    }
+
+    q7_t     *dw_weight_q7 = test1;
+    q7_t     *dw_bias_q7 = dw_weight_q7 + 25 * DW_MAX_CH;
+    q7_t     *dw_im_in_q7 = dw_bias_q7 + DW_MAX_CH;
+    q7_t     *dw_out_ref_q7 = dw_im_in_q7 + DW_MAX_DIM * DW_MAX_DIM * DW_MAX_CH;
+    q7_t     *dw_out_opt_q7 = dw_out_ref_q7 + DW_MAX_DIM * DW_MAX_DIM * DW_MAX_CH;
+
+    // {ch, dim_im_in, dim_kernel, padding, stride}, with channel counts that are not a multiple of 4 or 16
+    const uint16_t dw_cfg[6][5] = { {8, 10, 3, 1, 1}, {13, 9, 3, 1, 2}, {5, 7, 3, 0, 1}, {6, 8, 3, 1, 2}, {7, 9, 5, 2, 1},
+                                    {21, 8, 3, 1, 1} };
+
+    for (int t = 0; t < 6; t++)
+    {
+        const uint16_t ch = dw_cfg[t][0];
+        const uint16_t dim_in = dw_cfg[t][1];
+        const uint16_t ker = dw_cfg[t][2];
+        const uint16_t pad = dw_cfg[t][3];
+        const uint16_t stride = dw_cfg[t][4];
+        const uint16_t dim_out = (dim_in + 2 * pad - ker) / stride + 1;
+        const int out_size = dim_out * dim_out * ch;
+
+        arm_depthwise_separable_conv_HWC_q7_ref(dw_im_in_q7, dim_in, ch, dw_weight_q7, ch, ker, pad, stride,
+                                                dw_bias_q7, 0, 7, dw_out_ref_q7, dim_out, NULL, NULL);
+
+        memset(dw_out_opt_q7, 0x55, out_size);
+        arm_depthwise_conv_HWC_q7(dw_im_in_q7, dim_in, ch, dw_weight_q7, ch, ker, pad, stride, dw_bias_q7, 0, 7,
+                                  dw_out_opt_q7, dim_out, test4);
+        verify_results_q7(dw_out_ref_q7, dw_out_opt_q7, out_size);
+
+        if (ker == 3)
+        {
+            memset(dw_out_opt_q7, 0x55, out_size);
+            arm_depthwise_conv_3x3_HWC_q7(dw_im_in_q7, dim_in, ch, dw_weight_q7, ch, pad, stride, dw_bias_q7, 0, 7,
+                                          dw_out_opt_q7, dim_out);
+            verify_results_q7(dw_out_ref_q7, dw_out_opt_q7, out_size);
+        }
+    }
+
+    test_flags[test_index++] = arm_depthwise_conv_3x3_HWC_q7(dw_im_in_q7, 9, 8, dw_weight_q7, 8, 1, 3, dw_bias_q7, 0,
+                                                             7, dw_out_opt_q7, 3) == ARM_MATH_ARGUMENT_ERROR ? 0 : 1;
+
+    delete[]test1;
+    delete[]test4;
+
+#endif
+
+#ifdef TEST_RECURRENT
+
+#define RNN_MAX_IN 32
+#define RNN_MAX_HID 32
+#define RNN_SEQ 3
+
+    printf("start recurrent layer checking\n");
+
+    {
+        const int max_vec = RNN_MAX_IN + RNN_MAX_HID;
+        q7_t     *rnn_weight = new q7_t[4 * RNN_MAX_HID * max_vec + RNN_MAX_HID * max_vec + 4 * RNN_MAX_HID];
+        q7_t     *rnn_wn_ex = rnn_weight + 4 * RNN_MAX_HID * max_vec;
+        q7_t     *rnn_bias = rnn_wn_ex + RNN_MAX_HID * max_vec;
+        q15_t    *rnn_seq = new q15_t[RNN_SEQ * RNN_MAX_IN];
+        q15_t    *rnn_h0 = new q15_t[2 * RNN_MAX_HID];
+        q15_t    *rnn_opt = new q15_t[RNN_SEQ * RNN_MAX_HID + 2 * RNN_MAX_HID];
+        q15_t    *rnn_ref = new q15_t[RNN_SEQ * RNN_MAX_HID];
+        q15_t    *rnn_buf = new q15_t[9 * RNN_MAX_HID + RNN_MAX_IN];
+        test4 = new q15_t[RNN_MAX_IN + 3 * RNN_MAX_HID];
+
+        for (int i = 0; i < 4 * RNN_MAX_HID * max_vec; i++)
+        {
+            rnn_weight[i] = rand() % 256 - 128;
+        }
+        for (int i = 0; i < 4 * RNN_MAX_HID; i++)
+        {
+            rnn_bias[i] = rand() % 256 - 128;
+        }
+        for (int i = 0; i < RNN_SEQ * RNN_MAX_IN; i++)
+        {
+            rnn_seq[i] = rand() % 32768 - 16384;
+        }
+        for (int i = 0; i < 2 * RNN_MAX_HID; i++)
+        {
+            rnn_h0[i] = rand() % 32768 - 16384;
+        }
+
+        // {dim_input, dim_hidden}, the first one is the shape of the GRU example
+        const uint16_t rnn_cfg[2][2] = { {32, 32}, {13, 7} };
+
+        for (int t = 0; t < 2; t++)
+        {
+            const uint16_t dim_in = rnn_cfg[t][0];
+            const uint16_t dim_hid = rnn_cfg[t][1];
+            const int dim_vec = dim_in + dim_hid;
+            q15_t    *pReset = rnn_buf;
+            q15_t    *pIn = pReset + dim_hid;
+            q15_t    *pHist = pIn + dim_in;
+            q15_t    *pUpdate = pHist + dim_hid;
+            q15_t    *pHidden = pUpdate + dim_hid;
+            q15_t    *pCell = pHidden + dim_hid;
+            q15_t    *pGate = pCell + dim_hid;
+
+            // GRU, composed as in the GRU example: the buffer | r x h | x | h | gives the
+            // vector {x, h} of the update and reset gates and {r x h, x} of the candidate gate
+            for (int i = 0; i < dim_hid; i++)
+            {
+                const q7_t *pRow = rnn_weight + (2 * dim_hid + i) * dim_vec;
+                memcpy(rnn_wn_ex + i * dim_vec, pRow + dim_in, dim_hid);
+                memcpy(rnn_wn_ex + i * dim_vec + dim_hid, pRow, dim_in);
+            }
+            memcpy(pHist, rnn_h0, dim_hid * sizeof(q15_t));
+            for (int step = 0; step < RNN_SEQ; step++)
+            {
+                memcpy(pIn, rnn_seq + step * dim_in, dim_in * sizeof(q15_t));
+                arm_fully_connected_mat_q7_vec_q15_ref(pIn, rnn_weight + dim_hid * dim_vec, dim_vec, dim_hid, 8, 8,
+                                                       rnn_bias + dim_hid, pReset, NULL);
+                arm_nn_activations_direct_q15(pReset, dim_hid, 2, ARM_SIGMOID);
+                arm_mult_q15(pHist, pReset, pReset, dim_hid);
+                arm_fully_connected_mat_q7_vec_q15_ref(pIn, rnn_weight, dim_vec, dim_hid, 8, 8, rnn_bias, pUpdate,
+                                                       NULL);
+                arm_nn_activations_direct_q15(pUpdate, dim_hid, 2, ARM_SIGMOID);
+                arm_fully_connected_mat_q7_vec_q15_ref(pReset, rnn_wn_ex, dim_vec, dim_hid, 8, 8,
+                                                       rnn_bias + 2 * dim_hid, pHidden, NULL);
+                arm_nn_activations_direct_q15(pHidden, dim_hid, 2, ARM_TANH);
+                arm_mult_q15(pUpdate, pHidden, pHidden, dim_hid);
+                arm_offset_q15(pUpdate, 0x8000, pUpdate, dim_hid);
+                arm_mult_q15(pHist, pUpdate, pUpdate, dim_hid);
+                arm_sub_q15(pHidden, pUpdate, pHist, dim_hid);
+                memcpy(rnn_ref + step * dim_hid, pHist, dim_hid * sizeof(q15_t));
+            }
+
+            q15_t    *pState = rnn_opt + RNN_SEQ * dim_hid;
+            memset(rnn_opt, 0x55, RNN_SEQ * dim_hid * sizeof(q15_t));
+            memcpy(pState, rnn_h0, dim_hid * sizeof(q15_t));
+            arm_gru_q7_q15(rnn_seq, RNN_SEQ, dim_in, dim_hid, rnn_weight, rnn_bias, 8, 8, 2, pState, rnn_opt, test4);
+            verify_results_q15(rnn_ref, rnn_opt, RNN_SEQ * dim_hid);
+
+            // LSTM, with the cell state update composed of the DSP vector functions
+            memcpy(pHist, rnn_h0, dim_hid * sizeof(q15_t));
+            memcpy(pCell, rnn_h0 + RNN_MAX_HID, dim_hid * sizeof(q15_t));
+            for (int step = 0; step < RNN_SEQ; step++)
+            {
+                memcpy(pIn, rnn_seq + step * dim_in, dim_in * sizeof(q15_t));
+                for (int g = 0; g < 4; g++)
+                {
+                    arm_fully_connected_mat_q7_vec_q15_ref(pIn, rnn_weight + g * dim_hid * dim_vec, dim_vec, dim_hid,
+                                                           8, 8, rnn_bias + g * dim_hid, pGate + g * dim_hid, NULL);
+                    arm_nn_activations_direct_q15(pGate + g * dim_hid, dim_hid, 2, g == 2 ? ARM_TANH : ARM_SIGMOID);
+                }
+                arm_mult_q15(pGate, pGate + 2 * dim_hid, pGate, dim_hid);
+                arm_shift_q15(pGate, -2, pGate, dim_hid);
+                arm_mult_q15(pGate + dim_hid, pCell, pCell, dim_hid);
+                arm_add_q15(pCell, pGate, pCell, dim_hid);
+                memcpy(pHidden, pCell, dim_hid * sizeof(q15_t));
+                arm_nn_activations_direct_q15(pHidden, dim_hid, 2, ARM_TANH);
+                arm_mult_q15(pGate + 3 * dim_hid, pHidden, pHist, dim_hid);
+                memcpy(rnn_ref + step * dim_hid, pHist, dim_hid * sizeof(q15_t));
+            }
+
+            memset(rnn_opt, 0x55, RNN_SEQ * dim_hid * sizeof(q15_t));
+            memcpy(pState, rnn_h0, dim_hid * sizeof(q15_t));
+            memcpy(pState + dim_hid, rnn_h0 + RNN_MAX_HID, dim_hid * sizeof(q15_t));
+            arm_lstm_q7_q15(rnn_seq, RNN_SEQ, dim_in, dim_hid, rnn_weight, rnn_bias, 8, 8, 2, pState,
+                            pState + dim_hid, rnn_opt, test4);
+            verify_results_q15(rnn_ref, rnn_opt, RNN_SEQ * dim_hid);
+            test_flags[test_index++] = memcmp(pCell, pState + dim_hid, dim_hid * sizeof(q15_t)) ? 1 : 0;
+
+            // both cells one step at a time against double sigmoid and tanh, from the same states;
+            // every gate gets negative pre-activations, which use the negative half of the tables
+            for (int cell = 0; cell < 2; cell++)
+            {
+                const int num_gates = cell == 0 ? 3 : 4;
+                float64_t rnn_vec[RNN_MAX_IN + RNN_MAX_HID], rnn_vec_rh[RNN_MAX_IN + RNN_MAX_HID];
+                float64_t rnn_gate[4];
+                float64_t max_err_h = 0.0, max_err_c = 0.0;
+                int       num_neg[4] = { 0, 0, 0, 0 };
+                bool      all_neg = true;
+
+                memcpy(pState, rnn_h0, dim_hid * sizeof(q15_t));
+                memcpy(pState + dim_hid, rnn_h0 + RNN_MAX_HID, dim_hid * sizeof(q15_t));
+                for (int step = 0; step < RNN_SEQ; step++)
+                {
+                    const q15_t *pX = rnn_seq + step * dim_in;
+
+                    memcpy(pHist, pState, dim_hid * sizeof(q15_t));
+                    memcpy(pCell, pState + dim_hid, dim_hid * sizeof(q15_t));
+                    if (cell == 0)
+                    {
+                        arm_gru_q7_q15(pX, 1, dim_in, dim_hid, rnn_weight, rnn_bias, 8, 8, 2, pState, NULL, test4);
+                    }
+                    else
+                    {
+                        arm_lstm_q7_q15(pX, 1, dim_in, dim_hid, rnn_weight, rnn_bias, 8, 8, 2, pState,
+                                        pState + dim_hid, NULL, test4);
+                    }
+
+                    for (int i = 0; i < dim_in; i++)
+                    {
+                        rnn_vec[i] = pX[i];
+                        rnn_vec_rh[i] = pX[i];
+                    }
+                    for (int i = 0; i < dim_hid; i++)
+                    {
+                        rnn_vec[dim_in + i] = pHist[i];
+                    }
+
+                    // the GRU candidate gate reads {x, r x h}, so all the reset gates are needed first
+                    if (cell == 0)
+                    {
+                        for (int j = 0; j < dim_hid; j++)
+                        {
+                            float64_t pre = rnn_pre_activation(rnn_weight + (dim_hid + j) * dim_vec,
+                                                               rnn_bias[dim_hid + j], rnn_vec, dim_vec, 8, 8, 2);
+
+                            num_neg[1] += pre < 0.0;
+                            rnn_vec_rh[dim_in + j] = pHist[j] / (1.0 + exp(-pre));
+                        }
+                    }
+
+                    for (int j = 0; j < dim_hid; j++)
+                    {
+                        float64_t h, err;
+
+                        for (int g = 0; g < num_gates; g++)
+                        {
+                            float64_t pre;
+
+                            if (cell == 0 && g == 1)
+                            {
+                                continue;
+                            }
+                            pre = rnn_pre_activation(rnn_weight + (g * dim_hid + j) * dim_vec, rnn_bias[g * dim_hid + j],
+                                                     cell == 0 && g == 2 ? rnn_vec_rh : rnn_vec, dim_vec, 8, 8, 2);
+                            num_neg[g] += pre < 0.0;
+                            rnn_gate[g] = g == 2 ? tanh(pre) : 1.0 / (1.0 + exp(-pre));
+                        }
+
+                        if (cell == 0)
+                        {
+                            h = rnn_gate[0] * rnn_gate[2] + (1.0 - rnn_gate[0]) * pHist[j] / 32768.0;
+                        }
+                        else
+                        {
+                            float64_t c = rnn_gate[1] * pCell[j] / 8192.0 + rnn_gate[0] * rnn_gate[2];
+
+                            c = c > 32767.0 / 8192.0 ? 32767.0 / 8192.0 : (c < -4.0 ? -4.0 : c);
+                            err = fabs(pState[dim_hid + j] - c * 8192.0);
+                            max_err_c = err > max_err_c ? err : max_err_c;
+                            h = rnn_gate[3] * tanh(c);
+                        }
+                        h = h * 32768.0 > 32767.0 ? 32767.0 : h * 32768.0;
+                        err = fabs(pState[j] - h);
+                        max_err_h = err > max_err_h ? err : max_err_h;
+                    }
+                }
+
+                for (int g = 0; g < num_gates; g++)
+                {
+                    all_neg = all_neg && num_neg[g] > 0;
+                }
+                printf("%s max error: %f (h), %f (c)\r\n", cell == 0 ? "GRU" : "LSTM", max_err_h, max_err_c);
+                test_flags[test_index++] = (all_neg && max_err_h <= 32.0 && max_err_c <= 8.0) ? 0 : 1;
+            }
+        }
+
+        test_flags[test_index++] = arm_gru_q7_q15(rnn_seq, 1, 13, 7, rnn_weight, rnn_bias, 8, 8, 4, rnn_h0, NULL,
+                                                  test4) == ARM_MATH_ARGUMENT_ERROR ? 0 : 1;
+
+        delete[]rnn_weight;
+        delete[]rnn_seq;
+        delete[]rnn_h0;
+        delete[]rnn_opt;
+        delete[]rnn_ref;
+        delete[]rnn_buf;
+        delete[]test4;
+    }
+
+#endif
+
+#ifdef TEST_ACTI
+
+#define ACTI_DIM 1000
+
+    {
+        q7_t     *acti_q7 = new q7_t[ACTI_DIM];
+        q15_t    *acti_q15 = new q15_t[ACTI_DIM];
+        q7_t     *acti_in_q7 = new q7_t[ACTI_DIM];
+        q15_t    *acti_in_q15 = new q15_t[ACTI_DIM];
+
+        for (int i = 0; i < ACTI_DIM; i++)
+        {
+            acti_in_q7[i] = (rand() % 256 - 128);
+            acti_in_q15[i] = (rand() % 65536 - 32768);
+        }
+
+        // interpolated sigmoid and tanh, within one LSB (q7) and four LSBs (q15) of the float ones
+        for (int t = 0; t < 6; t++)
+        {
+            const arm_nn_activation_type type = t < 3 ? ARM_SIGMOID : ARM_TANH;
+            const int int_width = t % 3;
+            float64_t max_err_q7 = 0.0, max_err_q15 = 0.0;
+
+            memcpy(acti_q7, acti_in_q7, ACTI_DIM * sizeof(q7_t));
+            memcpy(acti_q15, acti_in_q15, ACTI_DIM * sizeof(q15_t));
+            arm_nn_activations_interp_q7(acti_q7, ACTI_DIM, int_width, type);
+            arm_nn_activations_interp_q15(acti_q15, ACTI_DIM, int_width, type);
+
+            for (int i = 0; i < ACTI_DIM; i++)
+            {
+                float64_t x7 = acti_in_q7[i] / (float64_t) (1 << (7 - int_width));
+                float64_t x15 = acti_in_q15[i] / (float64_t) (1 << (15 - int_width));
+                float64_t y7 = (type == ARM_SIGMOID ? 1.0 / (1.0 + exp(-x7)) : tanh(x7)) * 128.0;
+                float64_t y15 = (type == ARM_SIGMOID ? 1.0 / (1.0 + exp(-x15)) : tanh(x15)) * 32768.0;
+
+                y7 = y7 > 127.0 ? 127.0 : y7;
+                y15 = y15 > 32767.0 ? 32767.0 : y15;
+                max_err_q7 = fabs(acti_q7[i] - y7) > max_err_q7 ? fabs(acti_q7[i] - y7) : max_err_q7;
+                max_err_q15 = fabs(acti_q15[i] - y15) > max_err_q15 ? fabs(acti_q15[i] - y15) : max_err_q15;
+            }
+            printf("Interpolated activation max error: %f (q7), %f (q15)\r\n", max_err_q7, max_err_q15);
+            test_flags[test_index++] = (max_err_q7 <= 1.0 && max_err_q15 <= 4.0) ? 0 : 1;
+        }
+
+        // direct sigmoid and tanh over every q15 input, within 16 LSBs of the float ones
+        for (int t = 0; t < 8; t++)
+        {
+            const arm_nn_activation_type type = t < 4 ? ARM_SIGMOID : ARM_TANH;
+            const int int_width = t % 4;
+            float64_t max_err_neg = 0.0, max_err_pos = 0.0;
+
+            for (int start = -32768; start < 32768; start += ACTI_DIM)
+            {
+                const int n = 32768 - start < ACTI_DIM ? 32768 - start : ACTI_DIM;
+
+                for (int i = 0; i < n; i++)
+                {
+                    acti_q15[i] = (q15_t) (start + i);
+                }
+                arm_nn_activations_direct_q15(acti_q15, n, int_width, type);
+
+                for (int i = 0; i < n; i++)
+                {
+                    float64_t x15 = (start + i) / (float64_t) (1 << (15 - int_width));
+                    float64_t y15 = (type == ARM_SIGMOID ? 1.0 / (1.0 + exp(-x15)) : tanh(x15)) * 32768.0;
+                    float64_t err;
+
+                    y15 = y15 > 32767.0 ? 32767.0 : y15;
+                    err = fabs(acti_q15[i] - y15);
+                    if (start + i < 0)
+                    {
+                        max_err_neg = err > max_err_neg ? err : max_err_neg;
+                    }
+                    else
+                    {
+                        max_err_pos = err > max_err_pos ? err : max_err_pos;
+                    }
+                }
+            }
+            printf("Direct q15 activation max error: %f (negative), %f (positive)\r\n", max_err_neg, max_err_pos);
+            test_flags[test_index++] = (max_err_neg <= 16.0 && max_err_pos <= 16.0) ? 0 : 1;
+        }
+
+        // log-sum-exp softmax, within one LSB of the float softmax
+        for (int t = 0; t < 2; t++)
+        {
+            const int dim_vec = t == 0 ? 10 : ACTI_DIM;
+            float64_t sum_q7 = 0.0, sum_q15 = 0.0;
+            int       max_q7 = -128, max_q15 = -32768;
+            bool      lse_match = true;
+
+            arm_softmax_lse_q7(acti_in_q7, dim_vec, 3, acti_q7);
+            arm_softmax_lse_q15(acti_in_q15, dim_vec, 3, acti_q15);
+
+            for (int i = 0; i < dim_vec; i++)
+            {
+                max_q7 = acti_in_q7[i] > max_q7 ? acti_in_q7[i] : max_q7;
+                max_q15 = acti_in_q15[i] > max_q15 ? acti_in_q15[i] : max_q15;
+            }
+            for (int i = 0; i < dim_vec; i++)
+            {
+                sum_q7 += exp((acti_in_q7[i] - max_q7) / 16.0);
+                sum_q15 += exp((acti_in_q15[i] - max_q15) / 4096.0);
+            }
+            for (int i = 0; i < dim_vec; i++)
+            {
+                float64_t y7 = exp((acti_in_q7[i] - max_q7) / 16.0) / sum_q7 * 128.0;
+                float64_t y15 = exp((acti_in_q15[i] - max_q15) / 4096.0) / sum_q15 * 32768.0;
+
+                y7 = y7 > 127.0 ? 127.0 : y7;
+                y15 = y15 > 32767.0 ? 32767.0 : y15;
+                if (fabs(acti_q7[i] - y7) > 1.0 || fabs(acti_q15[i] - y15) > 1.0)
+                {
+                    printf("Output mismatch at %d, expected %f %f, actual %d %d\r\n", i, y7, y15, acti_q7[i],
+                           acti_q15[i]);
+                    lse_match = false;
+                }
+            }
+            test_flags[test_index++] = lse_match ? 0 : 1;
+        }
+
+        delete[]acti_q7;
+        delete[]acti_q15;
+        delete[]acti_in_q7;
+        delete[]acti_in_q15;
+    }
+
+#endif
+
+#ifdef TEST_GEMM
+
+#define GEMM_MAX_DIM 9
+#define GEMM_MAX_CH 16
+#define GEMM_MAX_VEC 127
+#define GEMM_MAX_BATCH 5
+
+    printf("start gemm conv and fully-connected checking\n");
+
+    {
+        q7_t     *gemm_weight = new q7_t[GEMM_MAX_VEC * GEMM_MAX_VEC + GEMM_MAX_VEC];
+        q7_t     *gemm_wt_packed = new q7_t[GEMM_MAX_VEC * GEMM_MAX_VEC];
+        q7_t     *gemm_in = new q7_t[GEMM_MAX_BATCH * GEMM_MAX_VEC];
+        q7_t     *gemm_out_ref = new q7_t[GEMM_MAX_DIM * GEMM_MAX_DIM * GEMM_MAX_CH];
+        q7_t     *gemm_out_opt = new q7_t[GEMM_MAX_DIM * GEMM_MAX_DIM * GEMM_MAX_CH];
+        q7_t     *gemm_bufB = new q7_t[4 * 9 * GEMM_MAX_CH];
+        q15_t    *gemm_bufA = new q15_t[GEMM_MAX_BATCH * GEMM_MAX_VEC];
+        q7_t     *gemm_bias = gemm_weight + GEMM_MAX_VEC * GEMM_MAX_VEC;
+
+        for (int i = 0; i < GEMM_MAX_VEC * GEMM_MAX_VEC + GEMM_MAX_VEC; i++)
+        {
+            gemm_weight[i] = rand() % 256 - 128;
+        }
+        for (int i = 0; i < GEMM_MAX_BATCH * GEMM_MAX_VEC; i++)
+        {
+            gemm_in[i] = rand() % 256 - 128;
+        }
+
+        // {ch_im_in, ch_im_out, dim_im_in, dim_kernel, padding, stride}, with left-over rows and columns
+        const uint16_t gemm_conv_cfg[3][6] = { {3, 16, 9, 3, 1, 1}, {5, 7, 8, 3, 1, 2}, {8, 6, 7, 1, 0, 1} };
+
+        for (int t = 0; t < 3; t++)
+        {
+            const uint16_t ch_in = gemm_conv_cfg[t][0];
+            const uint16_t ch_out = gemm_conv_cfg[t][1];
+            const uint16_t dim_in = gemm_conv_cfg[t][2];
+            const uint16_t ker = gemm_conv_cfg[t][3];
+            const uint16_t pad = gemm_conv_cfg[t][4];
+            const uint16_t stride = gemm_conv_cfg[t][5];
+            const uint16_t dim_out = (dim_in + 2 * pad - ker) / stride + 1;
+            const int out_size = dim_out * dim_out * ch_out;
+
+            arm_convolve_HWC_q7_ref(gemm_in, dim_in, ch_in, gemm_weight, ch_out, ker, pad, stride, gemm_bias, 1, 9,
+                                    gemm_out_ref, dim_out, NULL, NULL);
+
+            memset(gemm_out_opt, 0x55, out_size);
+            arm_nn_gemm_pack_q7(gemm_weight, ch_out, ch_in * ker * ker, gemm_wt_packed);
+            arm_convolve_HWC_q7_gemm(gemm_in, dim_in, ch_in, gemm_wt_packed, ch_out, ker, pad, stride, gemm_bias, 1,
+                                     9, gemm_out_opt, dim_out, gemm_bufA, gemm_bufB);
+            verify_results_q7(gemm_out_ref, gemm_out_opt, out_size);
+        }
+
+        // {dim_vec, num_of_rows, batch}, against arm_fully_connected_q7_ref and _opt for each vector
+        const uint16_t gemm_fc_cfg[3][3] = { {127, 127, 5}, {20, 9, 3}, {33, 4, 1} };
+
+        for (int t = 0; t < 3; t++)
+        {
+            const uint16_t dim_vec = gemm_fc_cfg[t][0];
+            const uint16_t rows = gemm_fc_cfg[t][1];
+            const uint16_t batch = gemm_fc_cfg[t][2];
+
+            arm_nn_gemm_pack_q7(gemm_weight, rows, dim_vec, gemm_wt_packed);
+
+            for (int b = 0; b < batch; b++)
+            {
+                arm_fully_connected_q7_ref(gemm_in + b * dim_vec, gemm_weight, dim_vec, rows, 1, 7, gemm_bias,
+                                           gemm_out_ref + b * rows, gemm_bufA);
+            }
+
+            memset(gemm_out_opt, 0x55, batch * rows);
+            for (int b = 0; b < batch; b++)
+            {
+                arm_fully_connected_q7_opt(gemm_in + b * dim_vec, gemm_wt_packed, dim_vec, rows, 1, 7, gemm_bias,
+                                           gemm_out_opt + b * rows, gemm_bufA);
+            }
+            verify_results_q7(gemm_out_ref, gemm_out_opt, batch * rows);
+
+            memset(gemm_out_opt, 0x55, batch * rows);
+            arm_fully_connected_q7_batch(gemm_in, gemm_wt_packed, dim_vec, rows, batch, 1, 7, gemm_bias, gemm_out_opt,
+                                         gemm_bufA);
+            verify_results_q7(gemm_out_ref, gemm_out_opt, batch * rows);
+        }
+
+        delete[]gemm_weight;
+        delete[]gemm_wt_packed;
+        delete[]gemm_in;
+        delete[]gemm_out_ref;
+        delete[]gemm_out_opt;
+        delete[]gemm_bufB;
+        delete[]gemm_bufA;
+    }
+
 #endif
 
     test_pass = true;
@@ -11,7 +11,7 @@
 #include "ref_functions.h"
 
 extern int test_index;
-extern q7_t test_flags[50];
+extern q7_t test_flags[200];
 
 void initialize_results_q7(q7_t * ref, q7_t * opt, int length)
 {
@@ -75,4 +75,21 @@ void verify_results_q15(q15_t * ref, q15_t * opt, int length)
 
 }
 
+/* W . {x, h} + b of one row of a recurrent gate, with the shifts and the 16-bit
+ * saturation of the q15 pre-activations, in real units of int_width integer bits */
+float64_t rnn_pre_activation(const q7_t * row, const q7_t bias, const float64_t * vec, int dim_vec,
+                             int bias_shift, int out_shift, int int_width)
+{
+    float64_t acc = bias * (float64_t) (1 << bias_shift);
+
+    for (int i = 0; i < dim_vec; i++)
+    {
+        acc += row[i] * vec[i];
+    }
+    acc /= (float64_t) (1 << out_shift);
+    acc = acc > 32767.0 ? 32767.0 : (acc < -32768.0 ? -32768.0 : acc);
+
+    return acc / (float64_t) (1 << (15 - int_width));
+}
+
 #endif
@@ -109,6 +109,55 @@ def convert_q7_q15_weights(weights):
         counter = counter + 4
     return new_weights
 
+def prune_4x1_blocks(weights, sparsity):
+    # zeroes the blocks of 4 rows x 1 column with the smallest magnitude,
+    # sparsity is the fraction of the blocks that are removed
+    [r, h, w, c] = weights.shape
+    weights = np.reshape(np.copy(weights), (r, h*w*c))
+    num_of_rows = r
+    num_of_cols = h*w*c
+    num_of_groups = (num_of_rows + 3) // 4
+    norms = np.zeros((num_of_groups, num_of_cols))
+    for g in range(num_of_groups):
+      norms[g] = np.sum(np.abs(weights[4*g:4*g+4]), axis=0)
+    num_of_pruned = int(round(sparsity * num_of_groups * num_of_cols))
+    order = np.argsort(norms, axis=None, kind='stable')
+    for k in order[:num_of_pruned]:
+      g = k // num_of_cols
+      j = k % num_of_cols
+      weights[4*g:4*g+4, j] = 0
+    return np.reshape(weights, (r, h, w, c))
+
+def convert_to_sparse_4x1_q7_weights(weights):
+    # packs the non-zero blocks of 4 rows x 1 column for
+    # arm_fully_connected_q7_sparse and arm_fully_connected_mat_q7_vec_q15_sparse
+    [r, h, w, c] = weights.shape
+    weights = np.reshape(weights, (r, h*w*c))
+    num_of_rows = r
+    num_of_cols = h*w*c
+    new_weights = []
+    col_index = []
+    pair_count = []
+    for i in range((num_of_rows + 3) // 4):
+      # the rows of the last group are padded with zeros
+      row_base = 4*i
+      block = np.zeros((4, num_of_cols), dtype=weights.dtype)
+      block[:min(4, num_of_rows-row_base)] = weights[row_base:row_base+4]
+      cols = [j for j in range(int(num_of_cols)) if np.any(block[:, j])]
+      for k in range(0, len(cols), 2):
+        w1 = block[:, cols[k]]
+        if k + 1 < len(cols):
+          j2 = cols[k+1]
+          w2 = block[:, j2]
+        else:
+          # an odd column is paired with itself and zero weights
+          j2 = cols[k]
+          w2 = np.zeros(4, dtype=weights.dtype)
+        new_weights += [w1[0], w1[1], w2[0], w2[1], w1[2], w1[3], w2[2], w2[3]]
+        col_index += [cols[k], j2]
+      pair_count.append((len(cols) + 1) // 2)
+    return np.array(new_weights, dtype=int), np.array(col_index, dtype=int), np.array(pair_count, dtype=int)
+
 # input dimensions
 vec_dim = 127
 row_dim = 127
@@ -142,5 +191,21 @@ outfile.write("#define IP4_WEIGHT_Q15 {")
 new_weight.tofile(outfile,sep=",",format="%d")
 outfile.write("}\n\n")
 
+pruned_weight = prune_4x1_blocks(weight, 0.75)
+outfile.write("#define IP2_PRUNED_WEIGHT {")
+pruned_weight.tofile(outfile,sep=",",format="%d")
+outfile.write("}\n\n")
+
+new_weight, col_index, pair_count = convert_to_sparse_4x1_q7_weights(pruned_weight)
+outfile.write("#define IP_SPARSE_WEIGHT {")
+new_weight.tofile(outfile,sep=",",format="%d")
+outfile.write("}\n\n")
+outfile.write("#define IP_SPARSE_INDEX {")
+col_index.tofile(outfile,sep=",",format="%d")
+outfile.write("}\n\n")
+outfile.write("#define IP_SPARSE_COUNT {")
+pair_count.tofile(outfile,sep=",",format="%d")
+outfile.write("}\n\n")
+
 
 outfile.close()
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_activations_interp_q15.c
+ * Description:  Q15 neural network activation function using table interpolation
+ *
+ * $Date:        13. July 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup Acti
+ * @{
+ */
+
+  /**
+   * @brief Q15 neural network activation function using table interpolation
+   * @param[in,out]   data        pointer to input
+   * @param[in]       size        number of elements
+   * @param[in]       int_width   bit-width of the integer part, assume to be smaller than 3
+   * @param[in]       type        type of activation functions
+   * @return none.
+   *
+   * @details
+   *
+   * Interpolates the 2-stage tables, whose step is half as large for
+   * inputs in [-2, 2), where sigmoid and tanh bend the most. Over the
+   * whole input range, the result is within four LSBs of the exact
+   * function.
+   *
+   */
+
+void arm_nn_activations_interp_q15(q15_t * data, uint32_t size, uint16_t int_width, arm_nn_activation_type type)
+{
+    uint32_t  i = size;
+    q15_t    *pIn = data;
+    q15_t    *pOut = data;
+    uint16_t  shift_size = int_width;
+    const q15_t *pL;
+    const q15_t *pH;
+
+    switch (type)
+    {
+    case ARM_SIGMOID:
+        pL = sigmoidLTable_q15;
+        pH = sigmoidHTable_q15;
+        break;
+    case ARM_TANH:
+    default:
+        pL = tanhLTable_q15;
+        pH = tanhHTable_q15;
+        break;
+    }
+
+    while (i)
+    {
+        *pOut++ = arm_nn_activation_hl_q15((q31_t) * pIn++ * (1 << shift_size), pL, pH);
+        i--;
+    }
+
+}
+
+/**
+ * @} end of Acti group
+ */
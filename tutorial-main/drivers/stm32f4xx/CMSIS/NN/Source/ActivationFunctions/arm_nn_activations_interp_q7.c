@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_activations_interp_q7.c
+ * Description:  Q7 neural network activation function using table interpolation
+ *
+ * $Date:        13. July 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup Acti
+ * @{
+ */
+
+  /**
+   * @brief Q7 neural network activation function using table interpolation
+   * @param[in,out]   data        pointer to input
+   * @param[in]       size        number of elements
+   * @param[in]       int_width   bit-width of the integer part, assume to be smaller than 3
+   * @param[in]       type        type of activation functions
+   * @return none.
+   *
+   * @details
+   *
+   * Unlike arm_nn_activations_direct_q7, which drops the low bits of the
+   * input for int_width below 3, this interpolates the 2-stage Q15 tables
+   * with the full input and rounds the result to Q7. The result is
+   * within one LSB of the exact function.
+   *
+   */
+
+void arm_nn_activations_interp_q7(q7_t * data, uint32_t size, uint16_t int_width, arm_nn_activation_type type)
+{
+    uint32_t  i = size;
+    q7_t     *pIn = data;
+    q7_t     *pOut = data;
+    uint16_t  shift_size = 8 + int_width;
+    const q15_t *pL;
+    const q15_t *pH;
+
+    switch (type)
+    {
+    case ARM_SIGMOID:
+        pL = sigmoidLTable_q15;
+        pH = sigmoidHTable_q15;
+        break;
+    case ARM_TANH:
+    default:
+        pL = tanhLTable_q15;
+        pH = tanhHTable_q15;
+        break;
+    }
+
+    while (i)
+    {
+        q15_t     out = arm_nn_activation_hl_q15((q31_t) * pIn++ * (1 << shift_size), pL, pH);
+
+        *pOut++ = (q7_t) __SSAT((out + 0x80) >> 8, 8);
+        i--;
+    }
+
+}
+
+/**
+ * @} end of Acti group
+ */
@@ -53,14 +53,18 @@
    * 
    * This is the direct table look-up approach.
    *
+   * The tables hold the positive inputs at indices 0 to 127 and the
+   * negative ones at 128 to 255, so the index is the input shifted down
+   * and truncated to 8 bits. The top entry is interpolated with itself.
+   *
    * Assume here the integer part of the fixed-point is <= 3.
    * More than 3 just not making much sense, makes no difference with
    * saturation followed by any of these activation functions. 
    */
 
-void arm_nn_activations_direct_q15(q15_t * data, uint16_t size, uint16_t int_width, arm_nn_activation_type type)
+void arm_nn_activations_direct_q15(q15_t * data, uint32_t size, uint16_t int_width, arm_nn_activation_type type)
 {
-    uint16_t  i = size;
+    uint32_t  i = size;
     q15_t    *pIn = data;
     q15_t    *pOut = data;
     uint16_t  shift_size = 8 + 3 - int_width;
@@ -84,8 +88,9 @@ void arm_nn_activations_direct_q15(q15_t * data, uint16_t size, uint16_t int_wid
         q15_t     out;
         q15_t     in = *pIn++;
         q15_t     frac = (uint32_t) in & bit_mask;
-        q15_t     value = lookup_table[__USAT(in >> shift_size, 8)];
-        q15_t     value2 = lookup_table[__USAT(1 + (in >> shift_size), 8)];
+        uint8_t   index = (uint8_t) (in >> shift_size);
+        q15_t     value = lookup_table[index];
+        q15_t     value2 = lookup_table[index == 127 ? 127 : (uint8_t) (index + 1)];
 
         /* doing the interpolation here for better accuracy */
         out = ((q31_t) (full_frac - frac) * value + (q31_t) value2 * frac) >> shift_size;
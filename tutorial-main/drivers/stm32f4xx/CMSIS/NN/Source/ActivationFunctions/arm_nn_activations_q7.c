@@ -58,9 +58,9 @@
    * saturation followed by any of these activation functions. 
    */
 
-void arm_nn_activations_direct_q7(q7_t * data, uint16_t size, uint16_t int_width, arm_nn_activation_type type)
+void arm_nn_activations_direct_q7(q7_t * data, uint32_t size, uint16_t int_width, arm_nn_activation_type type)
 {
-    uint16_t  i = size;
+    uint32_t  i = size;
     q7_t     *pIn = data;
     q7_t     *pOut = data;
     q7_t      in;
@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_relu6_q15.c
+ * Description:  Q15 version of ReLU6
+ *
+ * $Date:        13. July 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup Acti
+ * @{
+ */
+
+  /**
+   * @brief Q15 RELU6 function
+   * @param[in,out]   data        pointer to input
+   * @param[in]       size        number of elements
+   * @param[in]       int_width   bit-width of the integer part, at most 15
+   * @return none.
+   *
+   * @details
+   *
+   * Clips the data to [0, 6]. If 6 is out of range for int_width, i.e.,
+   * int_width is smaller than 3, the upper bound is the maximum value
+   * and this is the same as arm_relu_q15.
+   *
+   * Optimized with QSUB16 instructions, as arm_relu_q15.
+   *
+   */
+
+void arm_relu6_q15(q15_t * data, uint32_t size, uint16_t int_width)
+{
+    const q15_t six = (q15_t) __SSAT(6 << (15 - int_width), 16);
+
+#if defined (ARM_MATH_DSP)
+    /* Run the following code for Cortex-M4 and Cortex-M7 */
+
+    uint32_t  i = size >> 1;
+    q15_t    *pIn = data;
+    q15_t    *pOut = data;
+    q31_t     six2 = __PKHBT(six, six, 16);
+    q31_t     in;
+    q31_t     buf;
+    q31_t     mask;
+
+    while (i)
+    {
+        in = *__SIMD32(pIn)++;
+
+        /* if MSB=1, mask will be 0xFFFF, 0x0 otherwise */
+        buf = __ROR(in & 0x80008000, 15);
+        mask = __QSUB16(0x00000000, buf);
+        in = in & (~mask);
+
+        /* same for six - in, i.e., 0xFFFF where in is above six */
+        buf = __ROR(__QSUB16(six2, in) & 0x80008000, 15);
+        mask = __QSUB16(0x00000000, buf);
+
+        *__SIMD32(pOut)++ = (in & (~mask)) | (six2 & mask);
+        i--;
+    }
+
+    if (size & 0x1)
+    {
+        if (*pIn < 0)
+        {
+            *pIn = 0;
+        }
+        else if (*pIn > six)
+        {
+            *pIn = six;
+        }
+        pIn++;
+    }
+
+#else
+    /* Run the following code as reference implementation for Cortex-M0 and Cortex-M3 */
+
+    uint32_t  i;
+
+    for (i = 0; i < size; i++)
+    {
+        if (data[i] < 0)
+            data[i] = 0;
+        else if (data[i] > six)
+            data[i] = six;
+    }
+
+#endif                          /* ARM_MATH_DSP */
+
+}
+
+/**
+ * @} end of Acti group
+ */
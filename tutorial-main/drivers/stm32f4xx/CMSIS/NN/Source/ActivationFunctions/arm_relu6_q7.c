@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_relu6_q7.c
+ * Description:  Q7 version of ReLU6
+ *
+ * $Date:        13. July 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup Acti
+ * @{
+ */
+
+  /**
+   * @brief Q7 RELU6 function
+   * @param[in,out]   data        pointer to input
+   * @param[in]       size        number of elements
+   * @param[in]       int_width   bit-width of the integer part, at most 7
+   * @return none.
+   *
+   * @details
+   *
+   * Clips the data to [0, 6]. If 6 is out of range for int_width, i.e.,
+   * int_width is smaller than 3, the upper bound is the maximum value
+   * and this is the same as arm_relu_q7.
+   *
+   * Optimized with QSUB8 instructions, as arm_relu_q7.
+   *
+   */
+
+void arm_relu6_q7(q7_t * data, uint32_t size, uint16_t int_width)
+{
+    const q7_t six = (q7_t) __SSAT(6 << (7 - int_width), 8);
+
+#if defined (ARM_MATH_DSP)
+    /* Run the following code for Cortex-M4 and Cortex-M7 */
+
+    uint32_t  i = size >> 2;
+    q7_t     *pIn = data;
+    q7_t     *pOut = data;
+    q31_t     six4 = __PACKq7(six, six, six, six);
+    q31_t     in;
+    q31_t     buf;
+    q31_t     mask;
+
+    while (i)
+    {
+        in = *__SIMD32(pIn)++;
+
+        /* if MSB=1, mask will be 0xFF, 0x0 otherwise */
+        buf = __ROR(in & 0x80808080, 7);
+        mask = __QSUB8(0x00000000, buf);
+        in = in & (~mask);
+
+        /* same for six - in, i.e., 0xFF where in is above six */
+        buf = __ROR(__QSUB8(six4, in) & 0x80808080, 7);
+        mask = __QSUB8(0x00000000, buf);
+
+        *__SIMD32(pOut)++ = (in & (~mask)) | (six4 & mask);
+        i--;
+    }
+
+    i = size & 0x3;
+    while (i)
+    {
+        if (*pIn < 0)
+        {
+            *pIn = 0;
+        }
+        else if (*pIn > six)
+        {
+            *pIn = six;
+        }
+        pIn++;
+        i--;
+    }
+
+#else
+    /* Run the following code as reference implementation for Cortex-M0 and Cortex-M3 */
+
+    uint32_t  i;
+
+    for (i = 0; i < size; i++)
+    {
+        if (data[i] < 0)
+            data[i] = 0;
+        else if (data[i] > six)
+            data[i] = six;
+    }
+
+#endif                          /* ARM_MATH_DSP */
+
+}
+
+/**
+ * @} end of Acti group
+ */
@@ -52,13 +52,13 @@
    *
    */
 
-void arm_relu_q15(q15_t * data, uint16_t size)
+void arm_relu_q15(q15_t * data, uint32_t size)
 {
 
 #if defined (ARM_MATH_DSP)
     /* Run the following code for Cortex-M4 and Cortex-M7 */
 
-    uint16_t  i = size >> 1;
+    uint32_t  i = size >> 1;
     q15_t    *pIn = data;
     q15_t    *pOut = data;
     q31_t     in;
@@ -89,7 +89,7 @@ void arm_relu_q15(q15_t * data, uint16_t size)
     }
 #else
     /* Run the following code as reference implementation for Cortex-M0 and Cortex-M3 */
-    uint16_t  i;
+    uint32_t  i;
 
     for (i = 0; i < size; i++)
     {
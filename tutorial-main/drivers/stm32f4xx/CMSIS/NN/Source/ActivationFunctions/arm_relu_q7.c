@@ -52,13 +52,13 @@
    *
    */
 
-void arm_relu_q7(q7_t * data, uint16_t size)
+void arm_relu_q7(q7_t * data, uint32_t size)
 {
 
 #if defined (ARM_MATH_DSP)
     /* Run the following code for Cortex-M4 and Cortex-M7 */
 
-    uint16_t  i = size >> 2;
+    uint32_t  i = size >> 2;
     q7_t     *pIn = data;
     q7_t     *pOut = data;
     q31_t     in;
@@ -93,7 +93,7 @@ void arm_relu_q7(q7_t * data, uint16_t size)
 #else
     /* Run the following code as reference implementation for Cortex-M0 and Cortex-M3 */
 
-    uint16_t  i;
+    uint32_t  i;
 
     for (i = 0; i < size; i++)
     {
@@ -0,0 +1,221 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_convolve_HWC_q15_winograd.c
+ * Description:  Q15 version of 3x3 convolution with Winograd minimal filtering
+ *
+ * $Date:        13. July 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+  /**
+   * @brief Q15 3x3 convolution function with Winograd minimal filtering
+   * @param[in]       Im_in       pointer to input tensor
+   * @param[in]       dim_im_in   input tensor dimention
+   * @param[in]       ch_im_in    number of input tensor channels
+   * @param[in]       wt          pointer to the weights transformed by arm_nn_winograd_weights_q15
+   * @param[in]       ch_im_out   number of filters, i.e., output tensor channels
+   * @param[in]       dim_tile    output tile size, 2 for F(2x2,3x3) or 4 for F(4x4,3x3)
+   * @param[in]       padding     padding sizes
+   * @param[in]       bias        pointer to bias
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for output
+   * @param[in,out]   Im_out      pointer to output tensor
+   * @param[in]       dim_im_out  output tensor dimension
+   * @param[in,out]   bufferA     pointer to buffer space for input 
+   * @return     The function returns either
+   * <code>ARM_MATH_ARGUMENT_ERROR</code>, <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code>
+   * based on the outcome of argument and size checking.
+   *
+   * @details
+   *
+   * <b>Buffer size:</b>
+   *
+   * bufferA size: 2*ch_im_in*(dim_tile+2)*(dim_tile+2)
+   *
+   * <b>Input dimension constraints:</b>
+   *
+   * The kernel is 3x3 with stride 1, so dim_im_out is dim_im_in+2*padding-2.
+   *
+   * Same as arm_convolve_HWC_q7_winograd, with the transformed input tile
+   * in Q31 in bufferA and 64-bit accumulation. The output is the same as
+   * arm_convolve_HWC_q15_basic when that does not overflow.
+   */
+
+arm_status
+arm_convolve_HWC_q15_winograd(const q15_t * Im_in,
+                              const uint16_t dim_im_in,
+                              const uint16_t ch_im_in,
+                              const q31_t * wt,
+                              const uint16_t ch_im_out,
+                              const uint16_t dim_tile,
+                              const uint16_t padding,
+                              const q15_t * bias,
+                              const uint16_t bias_shift,
+                              const uint16_t out_shift,
+                              q15_t * Im_out,
+                              const uint16_t dim_im_out,
+                              q15_t * bufferA)
+{
+    const uint16_t dim_tile_in = dim_tile + 2;
+    const uint16_t num_pos = dim_tile_in * dim_tile_in;
+    int16_t   t_y, t_x, i, j, in_row, in_col;
+    uint16_t  i_ch, i_out, i_pos;
+    q31_t     d[6];
+    q63_t     m[6 * 6];
+    q63_t     out;
+    q31_t    *pBuffer;
+
+    if (dim_tile != 2 && dim_tile != 4)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+    if (dim_im_out + 2 != dim_im_in + 2 * padding)
+    {
+        return ARM_MATH_SIZE_MISMATCH;
+    }
+
+    for (t_y = 0; t_y < dim_im_out; t_y += dim_tile)
+    {
+        for (t_x = 0; t_x < dim_im_out; t_x += dim_tile)
+        {
+            /* copy the input tile to bufferA in Q31, with zeros outside the image */
+            pBuffer = (q31_t *) bufferA;
+            for (i = 0; i < dim_tile_in; i++)
+            {
+                in_row = t_y + i - padding;
+                for (j = 0; j < dim_tile_in; j++)
+                {
+                    in_col = t_x + j - padding;
+                    if (in_row < 0 || in_col < 0 || in_row >= dim_im_in || in_col >= dim_im_in)
+                    {
+                        memset(pBuffer, 0, sizeof(q31_t) * ch_im_in);
+                        pBuffer += ch_im_in;
+                    } else
+                    {
+                        const q15_t *pIn = Im_in + (in_row * dim_im_in + in_col) * ch_im_in;
+
+                        for (i_ch = 0; i_ch < ch_im_in; i_ch++)
+                        {
+                            *pBuffer++ = *pIn++;
+                        }
+                    }
+                }
+            }
+
+            /* input transform B^T d B of every channel, in-place */
+            for (i_ch = 0; i_ch < ch_im_in; i_ch++)
+            {
+                pBuffer = (q31_t *) bufferA + i_ch;
+                for (j = 0; j < dim_tile_in; j++)
+                {
+                    for (i = 0; i < dim_tile_in; i++)
+                    {
+                        d[i] = pBuffer[(i * dim_tile_in + j) * ch_im_in];
+                    }
+                    arm_nn_winograd_input_1d(d, dim_tile);
+                    for (i = 0; i < dim_tile_in; i++)
+                    {
+                        pBuffer[(i * dim_tile_in + j) * ch_im_in] = d[i];
+                    }
+                }
+                for (i = 0; i < dim_tile_in; i++)
+                {
+                    for (j = 0; j < dim_tile_in; j++)
+                    {
+                        d[j] = pBuffer[(i * dim_tile_in + j) * ch_im_in];
+                    }
+                    arm_nn_winograd_input_1d(d, dim_tile);
+                    for (j = 0; j < dim_tile_in; j++)
+                    {
+                        pBuffer[(i * dim_tile_in + j) * ch_im_in] = d[j];
+                    }
+                }
+            }
+
+            for (i_out = 0; i_out < ch_im_out; i_out++)
+            {
+                /* element-wise product, summed over the input channels */
+                for (i_pos = 0; i_pos < num_pos; i_pos++)
+                {
+                    const q31_t *pWt = wt + ((uint32_t) i_pos * ch_im_out + i_out) * ch_im_in;
+                    const q31_t *pV = (q31_t *) bufferA + i_pos * ch_im_in;
+                    q63_t     sum = 0;
+
+                    for (i_ch = 0; i_ch < ch_im_in; i_ch++)
+                    {
+                        sum += (q63_t) * pWt++ * *pV++;
+                    }
+                    m[i_pos] = sum;
+                }
+
+                /* output transform A^T m A */
+                for (j = 0; j < dim_tile_in; j++)
+                {
+                    q63_t     col[6];
+
+                    for (i = 0; i < dim_tile_in; i++)
+                    {
+                        col[i] = m[i * dim_tile_in + j];
+                    }
+                    arm_nn_winograd_output_1d(col, dim_tile);
+                    for (i = 0; i < dim_tile; i++)
+                    {
+                        m[i * dim_tile_in + j] = col[i];
+                    }
+                }
+                for (i = 0; i < dim_tile && t_y + i < dim_im_out; i++)
+                {
+                    arm_nn_winograd_output_1d(m + i * dim_tile_in, dim_tile);
+                    for (j = 0; j < dim_tile && t_x + j < dim_im_out; j++)
+                    {
+                        out = arm_nn_winograd_descale(m[i * dim_tile_in + j], dim_tile)
+                            + ((q63_t) bias[i_out] << bias_shift) + NN_ROUND(out_shift);
+                        out = out >> out_shift;
+                        Im_out[((t_y + i) * dim_im_out + t_x + j) * ch_im_out + i_out] =
+                            (q15_t) __SSAT(clip_q63_to_q31(out), 16);
+                    }
+                }
+            }
+        }
+    }
+
+    /* Return to application */
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of NNConv group
+ */
@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_convolve_HWC_q7_gemm.c
+ * Description:  Q7 convolution with interleaved weights over blocks of im2col columns
+ *
+ * $Date:        13. July 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/* im2col columns, i.e. output pixels, multiplied at a time */
+#define CONV_GEMM_NUM_COL 4
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+  /**
+   * @brief Q7 convolution function with interleaved weights
+   * @param[in]       Im_in       pointer to input tensor
+   * @param[in]       dim_im_in   input tensor dimention
+   * @param[in]       ch_im_in    number of input tensor channels
+   * @param[in]       wt          pointer to kernel weights, interleaved by arm_nn_gemm_pack_q7
+   * @param[in]       ch_im_out   number of filters, i.e., output tensor channels
+   * @param[in]       dim_kernel  filter kernel size
+   * @param[in]       padding     padding sizes
+   * @param[in]       stride      convolution stride
+   * @param[in]       bias        pointer to bias
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for output
+   * @param[in,out]   Im_out      pointer to output tensor
+   * @param[in]       dim_im_out  output tensor dimension
+   * @param[in,out]   bufferA     pointer to buffer space for input
+   * @param[in,out]   bufferB     pointer to buffer space for the q7 im2col columns
+   * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+   *
+   * @details
+   *
+   * <b>Buffer size:</b>
+   *
+   * bufferA size: 4*ch_im_in*dim_kernel*dim_kernel
+   *
+   * bufferB size: 4*ch_im_in*dim_kernel*dim_kernel
+   *
+   * The weights are packed once with arm_nn_gemm_pack_q7, with one row of
+   * dim_kernel*dim_kernel*ch_im_in values per output channel. The im2col
+   * columns of 4 output pixels are then multiplied with arm_nn_gemm_q7_q15.
+   * It works for any input tensor and weight dimension, with the same
+   * results as arm_convolve_HWC_q7_basic.
+   */
+
+arm_status
+arm_convolve_HWC_q7_gemm(const q7_t * Im_in,
+                         const uint16_t dim_im_in,
+                         const uint16_t ch_im_in,
+                         const q7_t * wt,
+                         const uint16_t ch_im_out,
+                         const uint16_t dim_kernel,
+                         const uint16_t padding,
+                         const uint16_t stride,
+                         const q7_t * bias,
+                         const uint16_t bias_shift,
+                         const uint16_t out_shift,
+                         q7_t * Im_out,
+                         const uint16_t dim_im_out,
+                         q15_t * bufferA,
+                         q7_t * bufferB)
+{
+    int16_t   i_out_y, i_out_x, i_ker_y, i_ker_x;
+    const uint16_t num_col_A = ch_im_in * dim_kernel * dim_kernel;
+    q7_t     *pBuffer = bufferB;
+    q7_t     *pOut = Im_out;
+    uint16_t  num_col = 0;
+
+    for (i_out_y = 0; i_out_y < dim_im_out; i_out_y++)
+    {
+        for (i_out_x = 0; i_out_x < dim_im_out; i_out_x++)
+        {
+            /* This part implements the im2col function */
+            for (i_ker_y = i_out_y * stride - padding; i_ker_y < i_out_y * stride - padding + dim_kernel; i_ker_y++)
+            {
+                for (i_ker_x = i_out_x * stride - padding; i_ker_x < i_out_x * stride - padding + dim_kernel; i_ker_x++)
+                {
+                    if (i_ker_y < 0 || i_ker_y >= dim_im_in || i_ker_x < 0 || i_ker_x >= dim_im_in)
+                    {
+                        memset(pBuffer, 0, ch_im_in);
+                    } else
+                    {
+                        memcpy(pBuffer, Im_in + (i_ker_y * dim_im_in + i_ker_x) * ch_im_in, ch_im_in);
+                    }
+                    pBuffer += ch_im_in;
+                }
+            }
+            num_col++;
+
+            if (num_col == CONV_GEMM_NUM_COL)
+            {
+                arm_nn_gemm_expand_q7(bufferB, num_col_A, num_col, bufferA);
+                arm_nn_gemm_q7_q15(wt, bufferA, ch_im_out, num_col_A, num_col, bias, bias_shift, out_shift, pOut);
+                pOut += num_col * ch_im_out;
+                pBuffer = bufferB;
+                num_col = 0;
+            }
+        }
+    }
+
+    /* left-over columns */
+    if (num_col > 0)
+    {
+        arm_nn_gemm_expand_q7(bufferB, num_col_A, num_col, bufferA);
+        arm_nn_gemm_q7_q15(wt, bufferA, ch_im_out, num_col_A, num_col, bias, bias_shift, out_shift, pOut);
+    }
+
+    /* Return to application */
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of NNConv group
+ */
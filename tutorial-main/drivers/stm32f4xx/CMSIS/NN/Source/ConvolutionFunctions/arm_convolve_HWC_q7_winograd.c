@@ -0,0 +1,301 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_convolve_HWC_q7_winograd.c
+ * Description:  Q7 version of 3x3 convolution with Winograd minimal filtering
+ *
+ * $Date:        13. July 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/*
+ * Dot product of two Q15 vectors with a Q31 accumulator, for F(2x2,3x3)
+ */
+static __INLINE q31_t winograd_dot_q15_q31(const q15_t * pA, const q15_t * pB, const uint16_t length)
+{
+    q31_t     sum = 0;
+    uint16_t  cnt;
+
+#if defined (ARM_MATH_DSP)
+    /* Run the following code for Cortex-M4 and Cortex-M7 */
+
+    cnt = length >> 2;
+    while (cnt > 0u)
+    {
+        q31_t     inA1 = *__SIMD32(pA)++;
+        q31_t     inB1 = *__SIMD32(pB)++;
+        q31_t     inA2 = *__SIMD32(pA)++;
+        q31_t     inB2 = *__SIMD32(pB)++;
+
+        sum = __SMLAD(inA1, inB1, sum);
+        sum = __SMLAD(inA2, inB2, sum);
+        cnt--;
+    }
+    cnt = length & 0x3;
+#else
+    /* Run the following code as reference implementation for Cortex-M0 and Cortex-M3 */
+
+    cnt = length;
+#endif                          /* ARM_MATH_DSP */
+
+    while (cnt > 0u)
+    {
+        sum += *pA++ * *pB++;
+        cnt--;
+    }
+
+    return sum;
+}
+
+/*
+ * Dot product of two Q15 vectors with a Q63 accumulator, for F(4x4,3x3)
+ */
+static __INLINE q63_t winograd_dot_q15_q63(const q15_t * pA, const q15_t * pB, const uint16_t length)
+{
+    q63_t     sum = 0;
+    uint16_t  cnt;
+
+#if defined (ARM_MATH_DSP)
+    /* Run the following code for Cortex-M4 and Cortex-M7 */
+
+    cnt = length >> 2;
+    while (cnt > 0u)
+    {
+        q31_t     inA1 = *__SIMD32(pA)++;
+        q31_t     inB1 = *__SIMD32(pB)++;
+        q31_t     inA2 = *__SIMD32(pA)++;
+        q31_t     inB2 = *__SIMD32(pB)++;
+
+        sum = __SMLALD(inA1, inB1, sum);
+        sum = __SMLALD(inA2, inB2, sum);
+        cnt--;
+    }
+    cnt = length & 0x3;
+#else
+    /* Run the following code as reference implementation for Cortex-M0 and Cortex-M3 */
+
+    cnt = length;
+#endif                          /* ARM_MATH_DSP */
+
+    while (cnt > 0u)
+    {
+        sum += (q31_t) * pA++ * *pB++;
+        cnt--;
+    }
+
+    return sum;
+}
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+  /**
+   * @brief Q7 3x3 convolution function with Winograd minimal filtering
+   * @param[in]       Im_in       pointer to input tensor
+   * @param[in]       dim_im_in   input tensor dimention
+   * @param[in]       ch_im_in    number of input tensor channels
+   * @param[in]       wt          pointer to the weights transformed by arm_nn_winograd_weights_q7
+   * @param[in]       ch_im_out   number of filters, i.e., output tensor channels
+   * @param[in]       dim_tile    output tile size, 2 for F(2x2,3x3) or 4 for F(4x4,3x3)
+   * @param[in]       padding     padding sizes
+   * @param[in]       bias        pointer to bias
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for output
+   * @param[in,out]   Im_out      pointer to output tensor
+   * @param[in]       dim_im_out  output tensor dimension
+   * @param[in,out]   bufferA     pointer to buffer space for input 
+   * @return     The function returns either
+   * <code>ARM_MATH_ARGUMENT_ERROR</code>, <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code>
+   * based on the outcome of argument and size checking.
+   *
+   * @details
+   *
+   * <b>Buffer size:</b>
+   *
+   * bufferA size: ch_im_in*(dim_tile+2)*(dim_tile+2)
+   *
+   * <b>Input dimension constraints:</b>
+   *
+   * The kernel is 3x3 with stride 1, so dim_im_out is dim_im_in+2*padding-2.
+   *
+   * The output is computed in dim_tile x dim_tile tiles. The input tile of
+   * each output tile is transformed once for all the filters, and each filter
+   * then takes (dim_tile+2)*(dim_tile+2)*ch_im_in multiplications per tile,
+   * instead of 9*dim_tile*dim_tile*ch_im_in with im2col. This is 2.25 times
+   * fewer for F(2x2,3x3) and 4 times fewer for F(4x4,3x3).
+   *
+   * All the transforms are exact in integers, so both tile sizes give the
+   * same output as arm_convolve_HWC_q7_fast, for ch_im_in up to 2048.
+   */
+
+arm_status
+arm_convolve_HWC_q7_winograd(const q7_t * Im_in,
+                             const uint16_t dim_im_in,
+                             const uint16_t ch_im_in,
+                             const q15_t * wt,
+                             const uint16_t ch_im_out,
+                             const uint16_t dim_tile,
+                             const uint16_t padding,
+                             const q7_t * bias,
+                             const uint16_t bias_shift,
+                             const uint16_t out_shift,
+                             q7_t * Im_out,
+                             const uint16_t dim_im_out,
+                             q15_t * bufferA)
+{
+    const uint16_t dim_tile_in = dim_tile + 2;
+    const uint16_t num_pos = dim_tile_in * dim_tile_in;
+    int16_t   t_y, t_x, i, j, col_start, col_end;
+    uint16_t  i_ch, i_out, i_pos;
+    q31_t     d[6];
+    q63_t     m[6 * 6];
+    q63_t     out;
+    q15_t    *pBuffer;
+
+    if (dim_tile != 2 && dim_tile != 4)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+    if (dim_im_out + 2 != dim_im_in + 2 * padding)
+    {
+        return ARM_MATH_SIZE_MISMATCH;
+    }
+
+    for (t_y = 0; t_y < dim_im_out; t_y += dim_tile)
+    {
+        for (t_x = 0; t_x < dim_im_out; t_x += dim_tile)
+        {
+            /* copy the input tile to bufferA, with zeros outside the image */
+            col_start = t_x - padding < 0 ? padding - t_x : 0;
+            col_end = t_x - padding + dim_tile_in > dim_im_in ? dim_im_in - t_x + padding : dim_tile_in;
+            pBuffer = bufferA;
+            for (i = 0; i < dim_tile_in; i++)
+            {
+                const int16_t in_row = t_y + i - padding;
+
+                if (in_row < 0 || in_row >= dim_im_in || col_end <= col_start)
+                {
+                    memset(pBuffer, 0, sizeof(q15_t) * ch_im_in * dim_tile_in);
+                } else
+                {
+                    memset(pBuffer, 0, sizeof(q15_t) * ch_im_in * col_start);
+                    arm_q7_to_q15_no_shift(Im_in + (in_row * dim_im_in + t_x - padding + col_start) * ch_im_in,
+                                           pBuffer + ch_im_in * col_start, ch_im_in * (col_end - col_start));
+                    memset(pBuffer + ch_im_in * col_end, 0, sizeof(q15_t) * ch_im_in * (dim_tile_in - col_end));
+                }
+                pBuffer += ch_im_in * dim_tile_in;
+            }
+
+            /* input transform B^T d B of every channel, in-place */
+            for (i_ch = 0; i_ch < ch_im_in; i_ch++)
+            {
+                pBuffer = bufferA + i_ch;
+                for (j = 0; j < dim_tile_in; j++)
+                {
+                    for (i = 0; i < dim_tile_in; i++)
+                    {
+                        d[i] = pBuffer[(i * dim_tile_in + j) * ch_im_in];
+                    }
+                    arm_nn_winograd_input_1d(d, dim_tile);
+                    for (i = 0; i < dim_tile_in; i++)
+                    {
+                        pBuffer[(i * dim_tile_in + j) * ch_im_in] = (q15_t) d[i];
+                    }
+                }
+                for (i = 0; i < dim_tile_in; i++)
+                {
+                    for (j = 0; j < dim_tile_in; j++)
+                    {
+                        d[j] = pBuffer[(i * dim_tile_in + j) * ch_im_in];
+                    }
+                    arm_nn_winograd_input_1d(d, dim_tile);
+                    for (j = 0; j < dim_tile_in; j++)
+                    {
+                        pBuffer[(i * dim_tile_in + j) * ch_im_in] = (q15_t) d[j];
+                    }
+                }
+            }
+
+            for (i_out = 0; i_out < ch_im_out; i_out++)
+            {
+                /* element-wise product, summed over the input channels */
+                for (i_pos = 0; i_pos < num_pos; i_pos++)
+                {
+                    const q15_t *pWt = wt + ((uint32_t) i_pos * ch_im_out + i_out) * ch_im_in;
+
+                    if (dim_tile == 2)
+                    {
+                        m[i_pos] = winograd_dot_q15_q31(pWt, bufferA + i_pos * ch_im_in, ch_im_in);
+                    } else
+                    {
+                        m[i_pos] = winograd_dot_q15_q63(pWt, bufferA + i_pos * ch_im_in, ch_im_in);
+                    }
+                }
+
+                /* output transform A^T m A */
+                for (j = 0; j < dim_tile_in; j++)
+                {
+                    q63_t     col[6];
+
+                    for (i = 0; i < dim_tile_in; i++)
+                    {
+                        col[i] = m[i * dim_tile_in + j];
+                    }
+                    arm_nn_winograd_output_1d(col, dim_tile);
+                    for (i = 0; i < dim_tile; i++)
+                    {
+                        m[i * dim_tile_in + j] = col[i];
+                    }
+                }
+                for (i = 0; i < dim_tile && t_y + i < dim_im_out; i++)
+                {
+                    arm_nn_winograd_output_1d(m + i * dim_tile_in, dim_tile);
+                    for (j = 0; j < dim_tile && t_x + j < dim_im_out; j++)
+                    {
+                        out = arm_nn_winograd_descale(m[i * dim_tile_in + j], dim_tile)
+                            + ((q63_t) bias[i_out] << bias_shift) + NN_ROUND(out_shift);
+                        out = out >> out_shift;
+                        Im_out[((t_y + i) * dim_im_out + t_x + j) * ch_im_out + i_out] =
+                            (q7_t) __SSAT(clip_q63_to_q31(out), 8);
+                    }
+                }
+            }
+        }
+    }
+
+    /* Return to application */
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of NNConv group
+ */
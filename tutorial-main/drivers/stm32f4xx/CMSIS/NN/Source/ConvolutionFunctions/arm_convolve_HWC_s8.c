@@ -0,0 +1,254 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_convolve_HWC_s8.c
+ * Description:  Per-channel quantized int8 convolution
+ *
+ * $Date:        13. July 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+  /**
+   * @brief Per-channel quantized int8 convolution function
+   * @param[in]       Im_in         pointer to input tensor
+   * @param[in]       dim_im_in     input tensor dimention
+   * @param[in]       ch_im_in      number of input tensor channels
+   * @param[in]       wt            pointer to kernel weights
+   * @param[in]       ch_im_out     number of filters, i.e., output tensor channels
+   * @param[in]       dim_kernel    filter kernel size
+   * @param[in]       padding       padding sizes
+   * @param[in]       stride        convolution stride
+   * @param[in]       bias          pointer to the per-channel Q31 bias
+   * @param[in]       out_mult      pointer to the per-channel output multipliers
+   * @param[in]       out_shift     pointer to the per-channel output shifts
+   * @param[in]       input_offset  negated input zero point, in the range [-127, 128]
+   * @param[in]       output_offset output zero point, in the range [-128, 127]
+   * @param[in]       act_min       minimum output value
+   * @param[in]       act_max       maximum output value
+   * @param[in,out]   Im_out        pointer to output tensor
+   * @param[in]       dim_im_out    output tensor dimension
+   * @param[in,out]   bufferA       pointer to buffer space for input 
+   * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+   *
+   * @details
+   *
+   * <b>Buffer size:</b>
+   *
+   * bufferA size: 2*ch_im_in*dim_kernel*dim_kernel
+   *
+   * The weights are quantized per output channel, symmetrically. Each
+   * output is
+   *
+   * <pre>
+   *     Im_out = clamp(requantize(bias + sum((Im_in + input_offset) * wt), out_mult, out_shift) + output_offset)
+   * </pre>
+   *
+   * where requantize is arm_nn_requantize with the multiplier and shift of
+   * the output channel, and clamp limits to [act_min, act_max]. A fused
+   * ReLU is act_min equal to output_offset.
+   *
+   * The im2col adds input_offset while converting the input to Q15, so the
+   * padding is zero and the GEMM is arm_nn_mat_mult_kernel_s8_s16.
+   * arm_nn_quantize_weights_s8 computes the weights, bias, multipliers and
+   * shifts from float weights.
+   */
+
+arm_status
+arm_convolve_HWC_s8(const q7_t * Im_in,
+                    const uint16_t dim_im_in,
+                    const uint16_t ch_im_in,
+                    const q7_t * wt,
+                    const uint16_t ch_im_out,
+                    const uint16_t dim_kernel,
+                    const uint16_t padding,
+                    const uint16_t stride,
+                    const q31_t * bias,
+                    const q31_t * out_mult,
+                    const int32_t * out_shift,
+                    const int32_t input_offset,
+                    const int32_t output_offset,
+                    const int32_t act_min,
+                    const int32_t act_max,
+                    q7_t * Im_out,
+                    const uint16_t dim_im_out,
+                    q15_t * bufferA)
+{
+
+#if defined (ARM_MATH_DSP)
+    /* Run the following code for Cortex-M4 and Cortex-M7 */
+
+    int16_t   i_out_y, i_out_x, i_ker_y, i_ker_x;
+    const uint16_t num_col = ch_im_in * dim_kernel * dim_kernel;
+
+    /*
+     *  Here we use bufferA as q15_t internally as computation are done with q15_t level
+     *  im2col are done to output in q15_t format from q7_t input
+     */
+
+    q15_t    *pBuffer = bufferA;
+    q7_t     *pOut = Im_out;
+
+    for (i_out_y = 0; i_out_y < dim_im_out; i_out_y++)
+    {
+        for (i_out_x = 0; i_out_x < dim_im_out; i_out_x++)
+        {
+            /* This part implements the im2col function, one kernel row at a time */
+            i_ker_x = i_out_x * stride - padding;
+            for (i_ker_y = i_out_y * stride - padding; i_ker_y < i_out_y * stride - padding + dim_kernel; i_ker_y++)
+            {
+                if (i_ker_y < 0 || i_ker_y >= dim_im_in)
+                {
+                    memset(pBuffer, 0, sizeof(q15_t) * ch_im_in * dim_kernel);
+                    pBuffer += ch_im_in * dim_kernel;
+                } else if (i_ker_x >= 0 && i_ker_x + dim_kernel <= dim_im_in)
+                {
+                    arm_q7_to_q15_with_offset(Im_in + (i_ker_y * dim_im_in + i_ker_x) * ch_im_in, pBuffer,
+                                              ch_im_in * dim_kernel, input_offset);
+                    pBuffer += ch_im_in * dim_kernel;
+                } else
+                {
+                    int16_t   i_x;
+
+                    for (i_x = i_ker_x; i_x < i_ker_x + dim_kernel; i_x++)
+                    {
+                        if (i_x < 0 || i_x >= dim_im_in)
+                        {
+                            memset(pBuffer, 0, sizeof(q15_t) * ch_im_in);
+                        } else
+                        {
+                            arm_q7_to_q15_with_offset(Im_in + (i_ker_y * dim_im_in + i_x) * ch_im_in, pBuffer,
+                                                      ch_im_in, input_offset);
+                        }
+                        pBuffer += ch_im_in;
+                    }
+                }
+            }
+
+            if (pBuffer == bufferA + 2 * num_col)
+            {
+                pOut = arm_nn_mat_mult_kernel_s8_s16(wt, bufferA, ch_im_out, num_col, bias, out_mult, out_shift,
+                                                     output_offset, act_min, act_max, pOut);
+                /* counter reset */
+                pBuffer = bufferA;
+            }
+        }
+    }
+
+    /* left-over because odd number of output pixels */
+    if (pBuffer != bufferA)
+    {
+        const q7_t *pA = wt;
+        int       i;
+
+        for (i = 0; i < ch_im_out; i++)
+        {
+            q31_t     sum = bias[i];
+            q15_t    *pB = bufferA;
+            /* each time it process 4 entries */
+            uint16_t  colCnt = num_col >> 2;
+
+            while (colCnt)
+            {
+
+                q31_t     inA1, inA2;
+                q31_t     inB1, inB2;
+
+                pA = (q7_t *) read_and_pad((void *)pA, &inA1, &inA2);
+
+                inB1 = *__SIMD32(pB)++;
+                sum = __SMLAD(inA1, inB1, sum);
+                inB2 = *__SIMD32(pB)++;
+                sum = __SMLAD(inA2, inB2, sum);
+
+                colCnt--;
+            }
+            colCnt = num_col & 0x3;
+            while (colCnt)
+            {
+                q7_t      inA1 = *pA++;
+                q15_t     inB1 = *pB++;
+                sum += inA1 * inB1;
+                colCnt--;
+            }
+            *pOut++ = arm_nn_requantize_s8(sum, out_mult[i], out_shift[i], output_offset, act_min, act_max);
+        }
+    }
+#else
+    /* Run the following code as reference implementation for Cortex-M0 and Cortex-M3 */
+
+    uint16_t  i, j, k, l, m, n;
+    q31_t     conv_out;
+    int16_t   in_row, in_col;
+
+    for (i = 0; i < ch_im_out; i++)
+    {
+        for (j = 0; j < dim_im_out; j++)
+        {
+            for (k = 0; k < dim_im_out; k++)
+            {
+                conv_out = bias[i];
+                for (m = 0; m < dim_kernel; m++)
+                {
+                    for (n = 0; n < dim_kernel; n++)
+                    {
+                        // if-for implementation
+                        in_row = stride * j + m - padding;
+                        in_col = stride * k + n - padding;
+                        if (in_row >= 0 && in_col >= 0 && in_row < dim_im_in && in_col < dim_im_in)
+                        {
+                            for (l = 0; l < ch_im_in; l++)
+                            {
+                                conv_out +=
+                                    (Im_in[(in_row * dim_im_in + in_col) * ch_im_in + l] + input_offset) *
+                                    wt[i * ch_im_in * dim_kernel * dim_kernel + (m * dim_kernel + n) * ch_im_in + l];
+                            }
+                        }
+                    }
+                }
+                Im_out[i + (j * dim_im_out + k) * ch_im_out] =
+                    arm_nn_requantize_s8(conv_out, out_mult[i], out_shift[i], output_offset, act_min, act_max);
+            }
+        }
+    }
+
+#endif                          /* ARM_MATH_DSP */
+
+    /* Return to application */
+    return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of NNConv group
+ */
@@ -0,0 +1,514 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_depthwise_conv_HWC_q7.c
+ * Description:  Q7 depthwise convolution with channel-vectorized inner loops
+ *
+ * $Date:        13. July 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/*
+ * Channels accumulated together by the reference implementation. The
+ * fixed-length inner loops over full blocks are vectorized by host
+ * compilers, and the remaining channels are computed one at a time.
+ */
+#define DEPTHWISE_CH_BLOCK 16
+
+#if defined (ARM_MATH_DSP)
+
+/*
+ * Sign-extends 4 channels of two kernel taps into channel pairs for __SMLAD:
+ * p[k] holds channel k of the tap in a and channel k of the tap in b.
+ */
+static __INLINE void depthwise_unpack_q7x4(q31_t a, q31_t b, q31_t * p)
+{
+    q31_t     lo, hi;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+    lo = __PKHBT(a, b, 16);
+    hi = __PKHTB(b, a, 16);
+    p[0] = __SXTB16(lo);
+    p[1] = __SXTB16(__ROR(lo, 8));
+    p[2] = __SXTB16(hi);
+    p[3] = __SXTB16(__ROR(hi, 8));
+#else
+    lo = __PKHTB(a, b, 16);
+    hi = __PKHBT(b, a, 16);
+    p[0] = __SXTB16(__ROR(lo, 8));
+    p[1] = __SXTB16(lo);
+    p[2] = __SXTB16(__ROR(hi, 8));
+    p[3] = __SXTB16(hi);
+#endif                          /* ARM_MATH_BIG_ENDIAN */
+}
+
+static __INLINE q31_t depthwise_read_q7x4(const q7_t * p)
+{
+    return *__SIMD32(p);
+}
+
+#endif                          /* ARM_MATH_DSP */
+
+/*
+ * Computes all channels of one output pixel. Tap t of the window reads the
+ * input at pIn + in_off[t] and the weights at wt + wt_off[t]; taps in the
+ * padding are left out of the lists, so the inner loops have no bounds checks.
+ */
+static void depthwise_q7_px(const q7_t * pIn,
+                            const int32_t * in_off,
+                            const q7_t * wt,
+                            const int32_t * wt_off,
+                            const uint16_t n_taps,
+                            const uint16_t ch,
+                            const q7_t * bias,
+                            const uint16_t bias_shift,
+                            const uint16_t out_shift,
+                            q7_t * pOut)
+{
+    int       c = 0;
+    int       t;
+
+#if defined (ARM_MATH_DSP)
+    /* Run the following code for Cortex-M4 and Cortex-M7 */
+
+    for (; c + 4 <= ch; c += 4)
+    {
+        q31_t     sum = ((q31_t)bias[c] << bias_shift) + NN_ROUND(out_shift);
+        q31_t     sum2 = ((q31_t)bias[c + 1] << bias_shift) + NN_ROUND(out_shift);
+        q31_t     sum3 = ((q31_t)bias[c + 2] << bias_shift) + NN_ROUND(out_shift);
+        q31_t     sum4 = ((q31_t)bias[c + 3] << bias_shift) + NN_ROUND(out_shift);
+        q31_t     inB[4], inA[4];
+
+        for (t = 0; t + 1 < n_taps; t += 2)
+        {
+            depthwise_unpack_q7x4(depthwise_read_q7x4(pIn + in_off[t] + c),
+                                  depthwise_read_q7x4(pIn + in_off[t + 1] + c), inB);
+            depthwise_unpack_q7x4(depthwise_read_q7x4(wt + wt_off[t] + c),
+                                  depthwise_read_q7x4(wt + wt_off[t + 1] + c), inA);
+            sum = __SMLAD(inA[0], inB[0], sum);
+            sum2 = __SMLAD(inA[1], inB[1], sum2);
+            sum3 = __SMLAD(inA[2], inB[2], sum3);
+            sum4 = __SMLAD(inA[3], inB[3], sum4);
+        }
+        if (t < n_taps)
+        {
+            const q7_t *pB = pIn + in_off[t] + c;
+            const q7_t *pA = wt + wt_off[t] + c;
+            sum += pA[0] * pB[0];
+            sum2 += pA[1] * pB[1];
+            sum3 += pA[2] * pB[2];
+            sum4 += pA[3] * pB[3];
+        }
+
+        pOut[c] = (q7_t) __SSAT((sum >> out_shift), 8);
+        pOut[c + 1] = (q7_t) __SSAT((sum2 >> out_shift), 8);
+        pOut[c + 2] = (q7_t) __SSAT((sum3 >> out_shift), 8);
+        pOut[c + 3] = (q7_t) __SSAT((sum4 >> out_shift), 8);
+    }
+
+#else
+    /* Run the following code as reference implementation for Cortex-M0 and Cortex-M3 */
+
+    for (; c + DEPTHWISE_CH_BLOCK <= ch; c += DEPTHWISE_CH_BLOCK)
+    {
+        q31_t     sum[DEPTHWISE_CH_BLOCK];
+        int       j;
+
+        for (j = 0; j < DEPTHWISE_CH_BLOCK; j++)
+        {
+            sum[j] = ((q31_t)bias[c + j] << bias_shift) + NN_ROUND(out_shift);
+        }
+        for (t = 0; t < n_taps; t++)
+        {
+            const q7_t *pB = pIn + in_off[t] + c;
+            const q7_t *pA = wt + wt_off[t] + c;
+            for (j = 0; j < DEPTHWISE_CH_BLOCK; j++)
+            {
+                sum[j] += pA[j] * pB[j];
+            }
+        }
+        for (j = 0; j < DEPTHWISE_CH_BLOCK; j++)
+        {
+            pOut[c + j] = (q7_t) __SSAT((sum[j] >> out_shift), 8);
+        }
+    }
+
+#endif                          /* ARM_MATH_DSP */
+
+    for (; c < ch; c++)
+    {
+        q31_t     sum = ((q31_t)bias[c] << bias_shift) + NN_ROUND(out_shift);
+        for (t = 0; t < n_taps; t++)
+        {
+            sum += wt[wt_off[t] + c] * pIn[in_off[t] + c];
+        }
+        pOut[c] = (q7_t) __SSAT((sum >> out_shift), 8);
+    }
+}
+
+/*
+ * Computes two output pixels that share the weights, the second one with
+ * its input window px_step values after the first. Each unpacked weight
+ * pair is used for both pixels.
+ */
+static void depthwise_q7_px2(const q7_t * pIn,
+                             const int32_t px_step,
+                             const int32_t * in_off,
+                             const q7_t * wt,
+                             const int32_t * wt_off,
+                             const uint16_t n_taps,
+                             const uint16_t ch,
+                             const q7_t * bias,
+                             const uint16_t bias_shift,
+                             const uint16_t out_shift,
+                             q7_t * pOut)
+{
+    int       c = 0;
+    int       t, j;
+
+#if defined (ARM_MATH_DSP)
+    /* Run the following code for Cortex-M4 and Cortex-M7 */
+
+    for (; c + 4 <= ch; c += 4)
+    {
+        q31_t     sum[4], sum2[4];
+        q31_t     inA[4], inB[4];
+
+        for (j = 0; j < 4; j++)
+        {
+            sum[j] = ((q31_t)bias[c + j] << bias_shift) + NN_ROUND(out_shift);
+            sum2[j] = sum[j];
+        }
+
+        for (t = 0; t + 1 < n_taps; t += 2)
+        {
+            const q7_t *pB = pIn + in_off[t] + c;
+            const q7_t *pB2 = pIn + in_off[t + 1] + c;
+
+            depthwise_unpack_q7x4(depthwise_read_q7x4(wt + wt_off[t] + c),
+                                  depthwise_read_q7x4(wt + wt_off[t + 1] + c), inA);
+
+            depthwise_unpack_q7x4(depthwise_read_q7x4(pB), depthwise_read_q7x4(pB2), inB);
+            sum[0] = __SMLAD(inA[0], inB[0], sum[0]);
+            sum[1] = __SMLAD(inA[1], inB[1], sum[1]);
+            sum[2] = __SMLAD(inA[2], inB[2], sum[2]);
+            sum[3] = __SMLAD(inA[3], inB[3], sum[3]);
+
+            depthwise_unpack_q7x4(depthwise_read_q7x4(pB + px_step), depthwise_read_q7x4(pB2 + px_step), inB);
+            sum2[0] = __SMLAD(inA[0], inB[0], sum2[0]);
+            sum2[1] = __SMLAD(inA[1], inB[1], sum2[1]);
+            sum2[2] = __SMLAD(inA[2], inB[2], sum2[2]);
+            sum2[3] = __SMLAD(inA[3], inB[3], sum2[3]);
+        }
+        if (t < n_taps)
+        {
+            const q7_t *pB = pIn + in_off[t] + c;
+            const q7_t *pA = wt + wt_off[t] + c;
+            for (j = 0; j < 4; j++)
+            {
+                sum[j] += pA[j] * pB[j];
+                sum2[j] += pA[j] * pB[j + px_step];
+            }
+        }
+
+        for (j = 0; j < 4; j++)
+        {
+            pOut[c + j] = (q7_t) __SSAT((sum[j] >> out_shift), 8);
+            pOut[ch + c + j] = (q7_t) __SSAT((sum2[j] >> out_shift), 8);
+        }
+    }
+
+#else
+    /* Run the following code as reference implementation for Cortex-M0 and Cortex-M3 */
+
+    for (; c + DEPTHWISE_CH_BLOCK <= ch; c += DEPTHWISE_CH_BLOCK)
+    {
+        q31_t     sum[DEPTHWISE_CH_BLOCK], sum2[DEPTHWISE_CH_BLOCK];
+
+        for (j = 0; j < DEPTHWISE_CH_BLOCK; j++)
+        {
+            sum[j] = ((q31_t)bias[c + j] << bias_shift) + NN_ROUND(out_shift);
+            sum2[j] = sum[j];
+        }
+        for (t = 0; t < n_taps; t++)
+        {
+            const q7_t *pB = pIn + in_off[t] + c;
+            const q7_t *pB2 = pB + px_step;
+            const q7_t *pA = wt + wt_off[t] + c;
+            for (j = 0; j < DEPTHWISE_CH_BLOCK; j++)
+            {
+                sum[j] += pA[j] * pB[j];
+                sum2[j] += pA[j] * pB2[j];
+            }
+        }
+        for (j = 0; j < DEPTHWISE_CH_BLOCK; j++)
+        {
+            pOut[c + j] = (q7_t) __SSAT((sum[j] >> out_shift), 8);
+            pOut[ch + c + j] = (q7_t) __SSAT((sum2[j] >> out_shift), 8);
+        }
+    }
+
+#endif                          /* ARM_MATH_DSP */
+
+    for (; c < ch; c++)
+    {
+        q31_t     sum = ((q31_t)bias[c] << bias_shift) + NN_ROUND(out_shift);
+        q31_t     sum2 = sum;
+        for (t = 0; t < n_taps; t++)
+        {
+            sum += wt[wt_off[t] + c] * pIn[in_off[t] + c];
+            sum2 += wt[wt_off[t] + c] * pIn[in_off[t] + c + px_step];
+        }
+        pOut[c] = (q7_t) __SSAT((sum >> out_shift), 8);
+        pOut[ch + c] = (q7_t) __SSAT((sum2 >> out_shift), 8);
+    }
+}
+
+/*
+ * Lists the taps of the window at input row in_y and column in_x that lie
+ * inside the image, with input offsets relative to Im_in. Returns the number
+ * of taps.
+ */
+static uint16_t depthwise_clip_taps(const int in_y,
+                                    const int in_x,
+                                    const uint16_t dim_im_in,
+                                    const uint16_t ch,
+                                    const uint16_t dim_kernel,
+                                    int32_t * in_off,
+                                    int32_t * wt_off)
+{
+    int       ky0 = in_y < 0 ? -in_y : 0;
+    int       kx0 = in_x < 0 ? -in_x : 0;
+    int       ky1 = dim_im_in - in_y < dim_kernel ? dim_im_in - in_y : dim_kernel;
+    int       kx1 = dim_im_in - in_x < dim_kernel ? dim_im_in - in_x : dim_kernel;
+    int       ky, kx;
+    uint16_t  n = 0;
+
+    for (ky = ky0; ky < ky1; ky++)
+    {
+        for (kx = kx0; kx < kx1; kx++)
+        {
+            in_off[n] = ((in_y + ky) * dim_im_in + in_x + kx) * ch;
+            wt_off[n] = (ky * dim_kernel + kx) * ch;
+            n++;
+        }
+    }
+    return n;
+}
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+  /**
+   * @brief Q7 depthwise convolution function
+   * @param[in]       Im_in       pointer to input tensor
+   * @param[in]       dim_im_in   input tensor dimention
+   * @param[in]       ch_im_in    number of input tensor channels
+   * @param[in]       wt          pointer to kernel weights
+   * @param[in]       ch_im_out   number of filters, i.e., output tensor channels
+   * @param[in]       dim_kernel  filter kernel size
+   * @param[in]       padding     padding sizes
+   * @param[in]       stride      convolution stride
+   * @param[in]       bias        pointer to bias
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for output
+   * @param[in,out]   Im_out      pointer to output tensor
+   * @param[in]       dim_im_out  output tensor dimension
+   * @param[in,out]   bufferA     pointer to buffer space for the tap offsets
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   *
+   * @details
+   *
+   * <b>Buffer size:</b>
+   *
+   * bufferA size: 4*dim_kernel*dim_kernel, 4-byte aligned
+   *
+   * <b>Input dimension constraints:</b>
+   *
+   * ch_im_in equals ch_im_out, of any value
+   *
+   * The results are identical to arm_depthwise_separable_conv_HWC_q7, with the
+   * same weight layout. The input is read in place instead of being copied
+   * to an im2col buffer. For each output pixel the taps that fall into the
+   * padding are dropped from the tap list before the channel loop, which
+   * computes 4 channels at a time with __SMLAD on Cortex-M4 and Cortex-M7.
+   */
+
+arm_status arm_depthwise_conv_HWC_q7(const q7_t * Im_in,
+                                     const uint16_t dim_im_in,
+                                     const uint16_t ch_im_in,
+                                     const q7_t * wt,
+                                     const uint16_t ch_im_out,
+                                     const uint16_t dim_kernel,
+                                     const uint16_t padding,
+                                     const uint16_t stride,
+                                     const q7_t * bias,
+                                     const uint16_t bias_shift,
+                                     const uint16_t out_shift,
+                                     q7_t * Im_out,
+                                     const uint16_t dim_im_out,
+                                     q15_t * bufferA)
+{
+    int32_t  *in_off = (int32_t *) bufferA;
+    int32_t  *wt_off = in_off + dim_kernel * dim_kernel;
+    int       i_out_y, i_out_x;
+    uint16_t  n_taps;
+
+    if (ch_im_in != ch_im_out)
+    {
+        return ARM_MATH_SIZE_MISMATCH;
+    }
+
+    for (i_out_y = 0; i_out_y < dim_im_out; i_out_y++)
+    {
+        for (i_out_x = 0; i_out_x < dim_im_out; i_out_x++)
+        {
+            n_taps = depthwise_clip_taps(i_out_y * stride - padding, i_out_x * stride - padding, dim_im_in,
+                                         ch_im_in, dim_kernel, in_off, wt_off);
+            depthwise_q7_px(Im_in, in_off, wt, wt_off, n_taps, ch_im_in, bias, bias_shift, out_shift,
+                            Im_out + (i_out_y * dim_im_out + i_out_x) * ch_im_out);
+        }
+    }
+
+    /* Return to application */
+    return ARM_MATH_SUCCESS;
+}
+
+  /**
+   * @brief Q7 depthwise convolution function with a 3x3 kernel
+   * @param[in]       Im_in       pointer to input tensor
+   * @param[in]       dim_im_in   input tensor dimention
+   * @param[in]       ch_im_in    number of input tensor channels
+   * @param[in]       wt          pointer to kernel weights
+   * @param[in]       ch_im_out   number of filters, i.e., output tensor channels
+   * @param[in]       padding     padding sizes
+   * @param[in]       stride      convolution stride, 1 or 2
+   * @param[in]       bias        pointer to bias
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for output
+   * @param[in,out]   Im_out      pointer to output tensor
+   * @param[in]       dim_im_out  output tensor dimension
+   * @return     The function returns <code>ARM_MATH_ARGUMENT_ERROR</code> if stride is not 1 or 2,
+   * <code>ARM_MATH_SIZE_MISMATCH</code> if ch_im_in differs from ch_im_out, or <code>ARM_MATH_SUCCESS</code>.
+   *
+   * @details
+   *
+   * <b>Buffer size:</b>
+   *
+   * none
+   *
+   * The results are identical to arm_depthwise_separable_conv_HWC_q7 with
+   * dim_kernel 3, for any number of channels. The offsets of the 9 taps are
+   * computed once. Pixels whose window lies inside the image are computed two
+   * at a time, sharing the unpacked weights, and only the border pixels build
+   * a clipped tap list.
+   */
+
+arm_status arm_depthwise_conv_3x3_HWC_q7(const q7_t * Im_in,
+                                         const uint16_t dim_im_in,
+                                         const uint16_t ch_im_in,
+                                         const q7_t * wt,
+                                         const uint16_t ch_im_out,
+                                         const uint16_t padding,
+                                         const uint16_t stride,
+                                         const q7_t * bias,
+                                         const uint16_t bias_shift,
+                                         const uint16_t out_shift,
+                                         q7_t * Im_out,
+                                         const uint16_t dim_im_out)
+{
+    int32_t   in_off[9], wt_off[9];
+    int32_t   clip_in_off[9], clip_wt_off[9];
+    const int32_t px_step = stride * ch_im_in;
+    int       i_out_y, i_out_x, in_y, in_x;
+    int       t;
+    uint16_t  n_taps;
+
+    if (stride != 1 && stride != 2)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+    if (ch_im_in != ch_im_out)
+    {
+        return ARM_MATH_SIZE_MISMATCH;
+    }
+
+    for (t = 0; t < 9; t++)
+    {
+        in_off[t] = ((t / 3) * dim_im_in + t % 3) * ch_im_in;
+        wt_off[t] = t * ch_im_in;
+    }
+
+    for (i_out_y = 0; i_out_y < dim_im_out; i_out_y++)
+    {
+        q7_t     *pOut = Im_out + i_out_y * dim_im_out * ch_im_out;
+        int       row_inside;
+
+        in_y = i_out_y * stride - padding;
+        row_inside = in_y >= 0 && in_y + 3 <= dim_im_in;
+
+        for (i_out_x = 0; i_out_x < dim_im_out;)
+        {
+            in_x = i_out_x * stride - padding;
+
+            if (row_inside && in_x >= 0 && in_x + stride + 3 <= dim_im_in && i_out_x + 1 < dim_im_out)
+            {
+                depthwise_q7_px2(Im_in + (in_y * dim_im_in + in_x) * ch_im_in, px_step, in_off, wt, wt_off, 9,
+                                 ch_im_in, bias, bias_shift, out_shift, pOut);
+                i_out_x += 2;
+                pOut += 2 * ch_im_out;
+            } else
+            {
+                if (row_inside && in_x >= 0 && in_x + 3 <= dim_im_in)
+                {
+                    depthwise_q7_px(Im_in + (in_y * dim_im_in + in_x) * ch_im_in, in_off, wt, wt_off, 9,
+                                    ch_im_in, bias, bias_shift, out_shift, pOut);
+                } else
+                {
+                    n_taps = depthwise_clip_taps(in_y, in_x, dim_im_in, ch_im_in, 3, clip_in_off, clip_wt_off);
+                    depthwise_q7_px(Im_in, clip_in_off, wt, clip_wt_off, n_taps, ch_im_in, bias, bias_shift,
+                                    out_shift, pOut);
+                }
+                i_out_x++;
+                pOut += ch_im_out;
+            }
+        }
+    }
+
+    /* Return to application */
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of NNConv group
+ */
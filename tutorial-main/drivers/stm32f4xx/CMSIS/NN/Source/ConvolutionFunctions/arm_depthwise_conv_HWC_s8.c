@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_depthwise_conv_HWC_s8.c
+ * Description:  Per-channel quantized int8 depthwise convolution
+ *
+ * $Date:        13. July 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+  /**
+   * @brief Per-channel quantized int8 depthwise convolution function
+   * @param[in]       Im_in         pointer to input tensor
+   * @param[in]       dim_im_in     input tensor dimention
+   * @param[in]       ch_im_in      number of input tensor channels
+   * @param[in]       wt            pointer to kernel weights
+   * @param[in]       ch_im_out     number of filters, i.e., output tensor channels
+   * @param[in]       dim_kernel    filter kernel size
+   * @param[in]       padding       padding sizes
+   * @param[in]       stride        convolution stride
+   * @param[in]       bias          pointer to the per-channel Q31 bias
+   * @param[in]       out_mult      pointer to the per-channel output multipliers
+   * @param[in]       out_shift     pointer to the per-channel output shifts
+   * @param[in]       input_offset  negated input zero point, in the range [-127, 128]
+   * @param[in]       output_offset output zero point, in the range [-128, 127]
+   * @param[in]       act_min       minimum output value
+   * @param[in]       act_max       maximum output value
+   * @param[in,out]   Im_out        pointer to output tensor
+   * @param[in]       dim_im_out    output tensor dimension
+   * @param[in,out]   bufferA       pointer to buffer space for the accumulators
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   *
+   * @details
+   *
+   * <b>Buffer size:</b>
+   *
+   * bufferA size: 2*ch_im_in
+   *
+   * <b>Input dimension constraints:</b>
+   *
+   * ch_im_in equals ch_im_out
+   *
+   * The weights are in the same order as for arm_depthwise_separable_conv_HWC_q7,
+   * i.e., wt[(i_ker_y * dim_kernel + i_ker_x) * ch_im_out + i_ch], and the
+   * quantization is the same as for arm_convolve_HWC_s8.
+   *
+   * Implementation:
+   * The Q31 sums of all channels of one output pixel are kept in bufferA. Each
+   * kernel tap inside the input adds a whole input pixel, so both the input
+   * and the weights are read sequentially, and the padding taps are skipped.
+   */
+
+arm_status
+arm_depthwise_conv_HWC_s8(const q7_t * Im_in,
+                          const uint16_t dim_im_in,
+                          const uint16_t ch_im_in,
+                          const q7_t * wt,
+                          const uint16_t ch_im_out,
+                          const uint16_t dim_kernel,
+                          const uint16_t padding,
+                          const uint16_t stride,
+                          const q31_t * bias,
+                          const q31_t * out_mult,
+                          const int32_t * out_shift,
+                          const int32_t input_offset,
+                          const int32_t output_offset,
+                          const int32_t act_min,
+                          const int32_t act_max,
+                          q7_t * Im_out,
+                          const uint16_t dim_im_out,
+                          q15_t * bufferA)
+{
+    int16_t   i_out_y, i_out_x, i_ker_y, i_ker_x;
+    q31_t    *pSum = (q31_t *) bufferA;
+    q7_t     *pOut = Im_out;
+    uint16_t  i_ch;
+
+    if (ch_im_in != ch_im_out)
+    {
+        return ARM_MATH_SIZE_MISMATCH;
+    }
+
+    for (i_out_y = 0; i_out_y < dim_im_out; i_out_y++)
+    {
+        for (i_out_x = 0; i_out_x < dim_im_out; i_out_x++)
+        {
+            memcpy(pSum, bias, ch_im_out * sizeof(q31_t));
+
+            for (i_ker_y = 0; i_ker_y < dim_kernel; i_ker_y++)
+            {
+                int16_t   in_row = i_out_y * stride + i_ker_y - padding;
+
+                if (in_row < 0 || in_row >= dim_im_in)
+                {
+                    continue;
+                }
+                for (i_ker_x = 0; i_ker_x < dim_kernel; i_ker_x++)
+                {
+                    int16_t   in_col = i_out_x * stride + i_ker_x - padding;
+
+                    if (in_col >= 0 && in_col < dim_im_in)
+                    {
+                        const q7_t *pIn = Im_in + (in_row * dim_im_in + in_col) * ch_im_in;
+                        const q7_t *pW = wt + (i_ker_y * dim_kernel + i_ker_x) * ch_im_out;
+                        q31_t    *pAcc = pSum;
+                        uint16_t  colCnt = ch_im_out;
+
+                        while (colCnt)
+                        {
+                            *pAcc++ += (*pIn++ + input_offset) * *pW++;
+                            colCnt--;
+                        }
+                    }
+                }
+            }
+
+            for (i_ch = 0; i_ch < ch_im_out; i_ch++)
+            {
+                *pOut++ = arm_nn_requantize_s8(pSum[i_ch], out_mult[i_ch], out_shift[i_ch], output_offset, act_min,
+                                               act_max);
+            }
+        }
+    }
+
+    /* Return to application */
+    return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of NNConv group
+ */
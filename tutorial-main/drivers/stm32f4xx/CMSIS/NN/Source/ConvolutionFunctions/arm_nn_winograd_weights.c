@@ -0,0 +1,209 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_winograd_weights.c
+ * Description:  Winograd weight transform of 3x3 convolution kernels
+ *
+ * $Date:        13. July 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/*
+ * Weight transform matrices. The F(2x2,3x3) matrix is 2*G, with G as in
+ * Lavin and Gray, "Fast Algorithms for Convolutional Neural Networks". The
+ * F(4x4,3x3) matrix is G with the row scales 1/4, -1/6, -1/6, 1/24, 1/24
+ * and 1 taken out, which arm_nn_winograd_output_1d applies instead, so that
+ * the transformed weights are integers.
+ */
+static const q31_t winograd_g_f2[4 * 3] = {
+    2, 0, 0,
+    1, 1, 1,
+    1, -1, 1,
+    0, 0, 2
+};
+
+static const q31_t winograd_g_f4[6 * 3] = {
+    1, 0, 0,
+    1, 1, 1,
+    1, -1, 1,
+    1, 2, 4,
+    1, -2, 4,
+    0, 0, 1
+};
+
+/*
+ * Transforms one 3x3 kernel g into the dim_tile+2 x dim_tile+2 tile G g G^T
+ */
+static void winograd_weight_tile(const q31_t * g, const uint16_t dim_tile_out, q31_t * pTile)
+{
+    const q31_t *G = dim_tile_out == 2 ? winograd_g_f2 : winograd_g_f4;
+    const uint16_t dim_tile_in = dim_tile_out + 2;
+    q31_t     Gg[6 * 3];
+    q31_t     sum;
+    int16_t   i, j, k;
+
+    for (i = 0; i < dim_tile_in; i++)
+    {
+        for (j = 0; j < 3; j++)
+        {
+            Gg[i * 3 + j] = G[i * 3] * g[j] + G[i * 3 + 1] * g[3 + j] + G[i * 3 + 2] * g[6 + j];
+        }
+    }
+
+    for (i = 0; i < dim_tile_in; i++)
+    {
+        for (j = 0; j < dim_tile_in; j++)
+        {
+            sum = 0;
+            for (k = 0; k < 3; k++)
+            {
+                sum += Gg[i * 3 + k] * G[j * 3 + k];
+            }
+            pTile[i * dim_tile_in + j] = sum;
+        }
+    }
+}
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+  /**
+   * @brief Winograd weight transform for arm_convolve_HWC_q7_winograd
+   * @param[in]       wt            pointer to the 3x3 kernel weights
+   * @param[in]       ch_im_in      number of input tensor channels
+   * @param[in]       ch_im_out     number of filters, i.e., output tensor channels
+   * @param[in]       dim_tile      output tile size, 2 or 4
+   * @param[out]      wt_out        pointer to the transformed weights
+   * @return     The function returns either
+   * <code>ARM_MATH_ARGUMENT_ERROR</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of argument checking.
+   *
+   * @details
+   *
+   * The weights are in the order of arm_convolve_HWC_q7_fast. The output
+   * has (dim_tile+2)*(dim_tile+2)*ch_im_in*ch_im_out values, one tile
+   * position after the other, each a ch_im_out x ch_im_in matrix.
+   *
+   * The transformed weights are exact integers, at most 9*128 in magnitude
+   * for F(2x2,3x3) and 49*128 for F(4x4,3x3). The transform runs offline or
+   * at initialization.
+   *
+   */
+
+arm_status arm_nn_winograd_weights_q7(const q7_t * wt,
+                                      const uint16_t ch_im_in,
+                                      const uint16_t ch_im_out,
+                                      const uint16_t dim_tile,
+                                      q15_t * wt_out)
+{
+    const uint16_t num_pos = (dim_tile + 2) * (dim_tile + 2);
+    q31_t     g[9], tile[36];
+    uint16_t  i_out, i_in, i_pos;
+    int16_t   k;
+
+    if (dim_tile != 2 && dim_tile != 4)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    for (i_out = 0; i_out < ch_im_out; i_out++)
+    {
+        for (i_in = 0; i_in < ch_im_in; i_in++)
+        {
+            for (k = 0; k < 9; k++)
+            {
+                g[k] = wt[(i_out * 9 + k) * ch_im_in + i_in];
+            }
+            winograd_weight_tile(g, dim_tile, tile);
+            for (i_pos = 0; i_pos < num_pos; i_pos++)
+            {
+                wt_out[((uint32_t) i_pos * ch_im_out + i_out) * ch_im_in + i_in] = (q15_t) tile[i_pos];
+            }
+        }
+    }
+
+    return ARM_MATH_SUCCESS;
+}
+
+  /**
+   * @brief Winograd weight transform for arm_convolve_HWC_q15_winograd
+   * @param[in]       wt            pointer to the 3x3 kernel weights
+   * @param[in]       ch_im_in      number of input tensor channels
+   * @param[in]       ch_im_out     number of filters, i.e., output tensor channels
+   * @param[in]       dim_tile      output tile size, 2 or 4
+   * @param[out]      wt_out        pointer to the transformed weights
+   * @return     The function returns either
+   * <code>ARM_MATH_ARGUMENT_ERROR</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of argument checking.
+   *
+   * @details
+   *
+   * Same as arm_nn_winograd_weights_q7, with Q31 transformed weights.
+   *
+   */
+
+arm_status arm_nn_winograd_weights_q15(const q15_t * wt,
+                                       const uint16_t ch_im_in,
+                                       const uint16_t ch_im_out,
+                                       const uint16_t dim_tile,
+                                       q31_t * wt_out)
+{
+    const uint16_t num_pos = (dim_tile + 2) * (dim_tile + 2);
+    q31_t     g[9], tile[36];
+    uint16_t  i_out, i_in, i_pos;
+    int16_t   k;
+
+    if (dim_tile != 2 && dim_tile != 4)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    for (i_out = 0; i_out < ch_im_out; i_out++)
+    {
+        for (i_in = 0; i_in < ch_im_in; i_in++)
+        {
+            for (k = 0; k < 9; k++)
+            {
+                g[k] = wt[(i_out * 9 + k) * ch_im_in + i_in];
+            }
+            winograd_weight_tile(g, dim_tile, tile);
+            for (i_pos = 0; i_pos < num_pos; i_pos++)
+            {
+                wt_out[((uint32_t) i_pos * ch_im_out + i_out) * ch_im_in + i_in] = tile[i_pos];
+            }
+        }
+    }
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of NNConv group
+ */
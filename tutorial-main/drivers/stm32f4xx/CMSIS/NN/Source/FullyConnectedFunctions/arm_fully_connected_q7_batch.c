@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_fully_connected_q7_batch.c
+ * Description:  Q7 fully-connected layer over a batch of input vectors
+ *
+ * $Date:        13. July 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup FC
+ * @{
+ */
+
+  /**
+   * @brief Q7 fully-connected layer function for a batch of input vectors
+   * @param[in]       pV          pointer to the input vectors, one after the other
+   * @param[in]       pM          pointer to matrix weights, interleaved as for arm_fully_connected_q7_opt
+   * @param[in]       dim_vec     length of each vector
+   * @param[in]       num_of_rows number of rows in weight matrix
+   * @param[in]       batch       number of input vectors
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for output
+   * @param[in]       bias        pointer to bias
+   * @param[in,out]   pOut        pointer to the output vectors, num_of_rows values each
+   * @param[in,out]   vec_buffer  pointer to buffer space for input
+   * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+   *
+   * @details
+   *
+   * <b>Buffer size:</b>
+   *
+   * vec_buffer size: batch*dim_vec
+   *
+   * Same results as arm_fully_connected_q7_opt called for each vector, with
+   * the same weights. The batch is multiplied with arm_nn_gemm_q7_q15,
+   * which reads the weights once for every two vectors.
+   */
+
+arm_status
+arm_fully_connected_q7_batch(const q7_t * pV,
+                             const q7_t * pM,
+                             const uint16_t dim_vec,
+                             const uint16_t num_of_rows,
+                             const uint16_t batch,
+                             const uint16_t bias_shift,
+                             const uint16_t out_shift,
+                             const q7_t * bias,
+                             q7_t * pOut,
+                             q15_t * vec_buffer)
+{
+    arm_nn_gemm_expand_q7(pV, dim_vec, batch, vec_buffer);
+    arm_nn_gemm_q7_q15(pM, vec_buffer, num_of_rows, dim_vec, batch, bias, bias_shift, out_shift, pOut);
+
+    /* Return to ARM_MATH_SUCCESS */
+    return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of FC group
+ */
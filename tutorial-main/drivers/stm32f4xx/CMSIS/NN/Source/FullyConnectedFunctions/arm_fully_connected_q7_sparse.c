@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_fully_connected_q7_sparse.c
+ * Description:  Q7 block-sparse fully-connected layer function
+ *
+ * $Date:        13. July 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup FC
+ * @{
+ */
+
+  /**
+   * @brief Q7 block-sparse fully-connected layer function
+   * @param[in]       pV          pointer to input vector
+   * @param[in]       pM          pointer to the packed non-zero weight blocks
+   * @param[in]       pIdx        pointer to the column index of each block
+   * @param[in]       pCnt        pointer to the number of block pairs of each group of 4 rows
+   * @param[in]       dim_vec     length of the vector
+   * @param[in]       num_of_rows number of rows in weight matrix
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for output
+   * @param[in]       bias        pointer to bias
+   * @param[in,out]   pOut        pointer to output vector
+   * @param[in,out]   vec_buffer  pointer to buffer space for input
+   * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+   *
+   * @details
+   *
+   * <b>Buffer size:</b>
+   *
+   * vec_buffer size: 0
+   *
+   * This function works with a weight matrix pruned in blocks of 4 rows
+   * by 1 column. Only the non-zero blocks are stored, and only the input
+   * elements of these columns are read. The weights are packed by
+   * convert_to_sparse_4x1_q7_weights in fully_connected_opt_weight_generation.py.
+   *
+   * The rows are split into groups of 4. The last group is padded with
+   * zero rows. The non-zero columns of each group are paired, and each
+   * pair is stored with the same interleaving as for
+   * arm_fully_connected_mat_q7_vec_q15_opt. For columns j and k of the
+   * rows 1 to 4 of a group this is:
+   *
+   *  | a1j | a2j | a1k | a2k | a3j | a4j | a3k | a4k |
+   *
+   * pIdx holds j and k of each pair, and pCnt the number of pairs of
+   * each group. An odd column is paired with itself and zero weights.
+   *
+   * Each block costs 4 bytes of weights and 2 bytes of index, so the
+   * weights take less flash than the dense matrix above 1/3 sparsity.
+   *
+   */
+
+arm_status
+arm_fully_connected_q7_sparse(const q7_t * pV,
+                              const q7_t * pM,
+                              const uint16_t * pIdx,
+                              const uint16_t * pCnt,
+                              const uint16_t dim_vec,
+                              const uint16_t num_of_rows,
+                              const uint16_t bias_shift,
+                              const uint16_t out_shift,
+                              const q7_t * bias,
+                              q7_t * pOut,
+                              q15_t * vec_buffer)
+{
+    const q7_t *pB = pM;
+    const uint16_t *pI = pIdx;
+    const q7_t *pBias = bias;
+    q7_t     *pO = pOut;
+    uint16_t  rowCnt = num_of_rows;
+
+    while (rowCnt)
+    {
+        uint16_t  rows = rowCnt < 4 ? rowCnt : 4;
+        uint16_t  pairCnt = *pCnt++;
+        q31_t     sum = ((q31_t)pBias[0] << bias_shift) + NN_ROUND(out_shift);
+        q31_t     sum2 = rows > 1 ? ((q31_t)pBias[1] << bias_shift) + NN_ROUND(out_shift) : 0;
+        q31_t     sum3 = rows > 2 ? ((q31_t)pBias[2] << bias_shift) + NN_ROUND(out_shift) : 0;
+        q31_t     sum4 = rows > 3 ? ((q31_t)pBias[3] << bias_shift) + NN_ROUND(out_shift) : 0;
+
+        while (pairCnt)
+        {
+#if defined (ARM_MATH_DSP)
+            /* Run the following code for Cortex-M4 and Cortex-M7 */
+            q31_t     inM11, inM12, inM13, inM14;
+            q31_t     inV;
+            q7_t      inV1 = pV[*pI++];
+            q7_t      inV2 = pV[*pI++];
+
+            inM11 = *__SIMD32(pB)++;
+            inM12 = __SXTB16(__ROR(inM11, 8));
+            inM11 = __SXTB16(inM11);
+            inM13 = *__SIMD32(pB)++;
+            inM14 = __SXTB16(__ROR(inM13, 8));
+            inM13 = __SXTB16(inM13);
+#ifndef ARM_MATH_BIG_ENDIAN
+            inV = __PKHBT(inV1, inV2, 16);
+            sum = __SMLAD(inM11, inV, sum);
+            sum2 = __SMLAD(inM12, inV, sum2);
+            sum3 = __SMLAD(inM13, inV, sum3);
+            sum4 = __SMLAD(inM14, inV, sum4);
+#else
+            inV = __PKHBT(inV2, inV1, 16);
+            sum = __SMLAD(inM12, inV, sum);
+            sum2 = __SMLAD(inM11, inV, sum2);
+            sum3 = __SMLAD(inM14, inV, sum3);
+            sum4 = __SMLAD(inM13, inV, sum4);
+#endif                          /* ARM_MATH_BIG_ENDIAN */
+#else
+            /* Run the following code as reference implementation for Cortex-M0 and Cortex-M3 */
+            q7_t      inV1 = pV[*pI++];
+            q7_t      inV2 = pV[*pI++];
+
+            sum += inV1 * pB[0] + inV2 * pB[2];
+            sum2 += inV1 * pB[1] + inV2 * pB[3];
+            sum3 += inV1 * pB[4] + inV2 * pB[6];
+            sum4 += inV1 * pB[5] + inV2 * pB[7];
+            pB += 8;
+#endif                          /* ARM_MATH_DSP */
+            pairCnt--;
+        }
+
+        *pO++ = (q7_t) __SSAT((sum >> out_shift), 8);
+        if (rows > 1)
+        {
+            *pO++ = (q7_t) __SSAT((sum2 >> out_shift), 8);
+        }
+        if (rows > 2)
+        {
+            *pO++ = (q7_t) __SSAT((sum3 >> out_shift), 8);
+        }
+        if (rows > 3)
+        {
+            *pO++ = (q7_t) __SSAT((sum4 >> out_shift), 8);
+        }
+
+        pBias += rows;
+        rowCnt -= rows;
+    }
+
+    /* Return to ARM_MATH_SUCCESS */
+    return (ARM_MATH_SUCCESS);
+
+}
+
+/**
+ * @} end of FC group
+ */
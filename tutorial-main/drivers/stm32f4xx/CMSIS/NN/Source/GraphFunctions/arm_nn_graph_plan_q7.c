@@ -0,0 +1,282 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_graph_plan_q7.c
+ * Description:  Liveness-based memory planner for Q7 graphs
+ *
+ * $Date:        13. July 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+#define ARM_NN_GRAPH_UNPLACED 0xFFFFFFFFU
+
+#define ARM_NN_GRAPH_ALIGN(x) (((x) + 3U) & ~3U)
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNGraph
+ * @{
+ */
+
+/*
+ * Size of the im2col buffer of a layer in bytes, as documented for the
+ * bufferA or vec_buffer argument of the layer function.
+ */
+static uint32_t arm_nn_graph_scratch_size(const arm_nn_layer_q7 * pLayer)
+{
+    switch (pLayer->op)
+    {
+    case ARM_NN_CONV_HWC_Q7_BASIC:
+    case ARM_NN_CONV_HWC_Q7_FAST:
+    case ARM_NN_CONV_HWC_Q7_RGB:
+        return 2 * sizeof(q15_t) * pLayer->chIn * pLayer->dimKernel * pLayer->dimKernel;
+    case ARM_NN_DEPTHWISE_CONV_HWC_Q7:
+        if (pLayer->dimKernel == 3 && (pLayer->stride == 1 || pLayer->stride == 2))
+        {
+            return 0;
+        }
+        return 4 * sizeof(q15_t) * pLayer->dimKernel * pLayer->dimKernel;
+    case ARM_NN_CONV_HWC_Q7_WINOGRAD_F2:
+        return sizeof(q15_t) * pLayer->chIn * 4 * 4;
+    case ARM_NN_CONV_HWC_Q7_WINOGRAD_F4:
+        return sizeof(q15_t) * pLayer->chIn * 6 * 6;
+    case ARM_NN_AVEPOOL_HWC_Q7:
+        return sizeof(q15_t) * pLayer->dimOut * pLayer->chIn;
+    case ARM_NN_FULLY_CONNECTED_Q7:
+    case ARM_NN_FULLY_CONNECTED_Q7_OPT:
+        return sizeof(q15_t) * pLayer->chIn;
+    default:
+        return 0;
+    }
+}
+
+  /**
+   * @brief Liveness-based memory planner for a Q7 graph
+   * @param[in]       S           points to an instance of the graph
+   * @param[in,out]   P           points to the plan, pTensorOffset and pScratchOffset are filled in
+   * @param[in,out]   pWork       points to a work buffer of ARM_NN_GRAPH_PLAN_WORK_SIZE words
+   * @return     The function returns either
+   * <code>ARM_MATH_ARGUMENT_ERROR</code>, <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code>
+   * based on the outcome of the graph checking.
+   *
+   * @details
+   *
+   * <b>Graph constraints:</b>
+   *
+   * Each tensor is written by one layer, except by the in-place layers
+   * ReLU and softmax, whose output tensor is their input tensor. ReLU always
+   * runs in-place.
+   *
+   * A tensor is read only after the layer that writes it. The input tensor
+   * of the first layer is the input of the graph.
+   *
+   * The pooling functions are input-destructive, so the input of a pooling
+   * layer must not be read by a later layer.
+   *
+   * The sizes of a tensor seen by its writer and by its readers must match,
+   * so a 4 x 4 x 64 image can be read as a 1 x 1 x 1024 vector.
+   *
+   * <b>Planning:</b>
+   *
+   * A tensor is live from the layer that writes it to the last layer that
+   * reads it, and the im2col buffer of a layer is live during that layer.
+   * Buffers are placed in decreasing order of size, each at the lowest
+   * 4-byte aligned offset that does not overlap a placed buffer that is
+   * live at the same time. The input and output of a layer are live
+   * during the layer, so they never overlap.
+   *
+   * The plan only depends on the layer list, and the same graph always
+   * gives the same plan.
+   */
+
+arm_status arm_nn_graph_plan_q7(const arm_nn_graph_q7 * S,
+                                arm_nn_graph_plan * P,
+                                uint32_t * pWork)
+{
+    const arm_nn_layer_q7 *pLayer = S->pLayers;
+    uint32_t  numBuffers = (uint32_t) S->numTensors + S->numLayers;
+    uint32_t *pSize = pWork;
+    uint32_t *pFirst = pSize + numBuffers;
+    uint32_t *pLast = pFirst + numBuffers;
+    uint32_t *pOffset = pLast + numBuffers;
+    uint32_t  arenaSize = 0;
+    uint32_t  inSize, outSize;
+    uint32_t  i, j, n, l;
+
+    if (S->numLayers == 0 || pLayer[0].in >= S->numTensors)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    for (i = 0; i < numBuffers; i++)
+    {
+        pSize[i] = 0;
+        pFirst[i] = 0;
+        pLast[i] = 0;
+        pOffset[i] = ARM_NN_GRAPH_UNPLACED;
+    }
+
+    /* the input of the graph is live from the first layer */
+    pSize[pLayer[0].in] = (uint32_t) pLayer[0].dimIn * pLayer[0].dimIn * pLayer[0].chIn;
+
+    /* compute the size and the lifetime of every buffer */
+    for (l = 0; l < S->numLayers; l++, pLayer++)
+    {
+        inSize = (uint32_t) pLayer->dimIn * pLayer->dimIn * pLayer->chIn;
+        outSize = (uint32_t) pLayer->dimOut * pLayer->dimOut * pLayer->chOut;
+
+        if (pLayer->op > ARM_NN_CONV_HWC_Q7_WINOGRAD_F4 || pLayer->in >= S->numTensors || pLayer->out >= S->numTensors
+            || inSize == 0 || outSize == 0)
+        {
+            return ARM_MATH_ARGUMENT_ERROR;
+        }
+
+        /* the input must have been written by an earlier layer */
+        if (pSize[pLayer->in] == 0)
+        {
+            return ARM_MATH_ARGUMENT_ERROR;
+        }
+        if (pSize[pLayer->in] != inSize)
+        {
+            return ARM_MATH_SIZE_MISMATCH;
+        }
+
+        switch (pLayer->op)
+        {
+        case ARM_NN_RELU_Q7:
+        case ARM_NN_SOFTMAX_Q7:
+            /* element-wise layers, the length argument of the softmax is 16-bit */
+            if (inSize != outSize || (pLayer->op == ARM_NN_SOFTMAX_Q7 && inSize > 0xFFFF))
+            {
+                return ARM_MATH_SIZE_MISMATCH;
+            }
+            if (pLayer->op == ARM_NN_RELU_Q7 && pLayer->out != pLayer->in)
+            {
+                return ARM_MATH_ARGUMENT_ERROR;
+            }
+            break;
+        case ARM_NN_MAXPOOL_HWC_Q7:
+        case ARM_NN_AVEPOOL_HWC_Q7:
+            if (pLayer->chOut != pLayer->chIn)
+            {
+                return ARM_MATH_SIZE_MISMATCH;
+            }
+            /* fall through */
+        default:
+            if (pLayer->out == pLayer->in)
+            {
+                return ARM_MATH_ARGUMENT_ERROR;
+            }
+            break;
+        }
+
+        pLast[pLayer->in] = l;
+
+        if (pLayer->out != pLayer->in)
+        {
+            /* each tensor is written once */
+            if (pSize[pLayer->out] != 0)
+            {
+                return ARM_MATH_ARGUMENT_ERROR;
+            }
+            pSize[pLayer->out] = outSize;
+            pFirst[pLayer->out] = l;
+            pLast[pLayer->out] = l;
+        }
+
+        pSize[S->numTensors + l] = arm_nn_graph_scratch_size(pLayer);
+        pFirst[S->numTensors + l] = l;
+        pLast[S->numTensors + l] = l;
+    }
+
+    /* the input of a pooling layer is undefined after the layer */
+    pLayer = S->pLayers;
+    for (l = 0; l < S->numLayers; l++, pLayer++)
+    {
+        if ((pLayer->op == ARM_NN_MAXPOOL_HWC_Q7 || pLayer->op == ARM_NN_AVEPOOL_HWC_Q7) && pLast[pLayer->in] > l)
+        {
+            return ARM_MATH_ARGUMENT_ERROR;
+        }
+    }
+
+    /* place the buffers, largest first */
+    for (n = 0; n < numBuffers; n++)
+    {
+        uint32_t  b = numBuffers;
+        uint32_t  offset = 0;
+        uint32_t  moved;
+
+        /* the largest unplaced buffer, the first one on ties */
+        for (i = 0; i < numBuffers; i++)
+        {
+            if (pOffset[i] == ARM_NN_GRAPH_UNPLACED && (b == numBuffers || pSize[i] > pSize[b]))
+            {
+                b = i;
+            }
+        }
+
+        /* move up past every placed buffer that is live at the same time and overlaps */
+        do
+        {
+            moved = 0;
+            for (j = 0; j < numBuffers && pSize[b] != 0; j++)
+            {
+                if (pOffset[j] != ARM_NN_GRAPH_UNPLACED && pSize[j] != 0
+                    && pFirst[j] <= pLast[b] && pFirst[b] <= pLast[j]
+                    && offset < pOffset[j] + pSize[j] && pOffset[j] < offset + pSize[b])
+                {
+                    offset = ARM_NN_GRAPH_ALIGN(pOffset[j] + pSize[j]);
+                    moved = 1;
+                }
+            }
+        } while (moved);
+
+        pOffset[b] = offset;
+        if (offset + pSize[b] > arenaSize)
+        {
+            arenaSize = offset + pSize[b];
+        }
+    }
+
+    for (i = 0; i < S->numTensors; i++)
+    {
+        P->pTensorOffset[i] = pOffset[i];
+    }
+    for (l = 0; l < S->numLayers; l++)
+    {
+        P->pScratchOffset[l] = pOffset[S->numTensors + l];
+    }
+    P->arenaSize = ARM_NN_GRAPH_ALIGN(arenaSize);
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of NNGraph group
+ */
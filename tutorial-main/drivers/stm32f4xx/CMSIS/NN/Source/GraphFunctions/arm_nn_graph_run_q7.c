@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_graph_run_q7.c
+ * Description:  Q7 graph executor
+ *
+ * $Date:        13. July 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNGraph
+ * @{
+ */
+
+  /**
+   * @brief Run a Q7 graph in a planned arena
+   * @param[in]       S           points to an instance of the graph
+   * @param[in]       P           points to the plan computed by arm_nn_graph_plan_q7
+   * @param[in,out]   pArena      points to the arena of P->arenaSize bytes, 4-byte aligned
+   * @return     The function returns the status of the first failing layer, or <code>ARM_MATH_SUCCESS</code>
+   *
+   * @details
+   *
+   * The input of the graph is written at pArena + P->pTensorOffset[S->pLayers[0].in]
+   * before the call, and the output is found at
+   * pArena + P->pTensorOffset[S->pLayers[S->numLayers - 1].out] after it. Other
+   * tensors are overwritten as the arena is reused, and the input of the graph
+   * is undefined after the call if the first layer is a pooling layer.
+   *
+   * The layers are executed in order by the same functions that a hand-written
+   * network calls, so the output is bit-exact with such a network.
+   *
+   * A 3x3 convolution layer with stride 1 selects the Winograd path with the
+   * ARM_NN_CONV_HWC_Q7_WINOGRAD_F2 or ARM_NN_CONV_HWC_Q7_WINOGRAD_F4
+   * operation. Its weights in the blob are the Q15 output of
+   * arm_nn_winograd_weights_q7, at a 4-byte aligned offset.
+   */
+
+arm_status arm_nn_graph_run_q7(const arm_nn_graph_q7 * S,
+                               const arm_nn_graph_plan * P,
+                               q7_t * pArena)
+{
+    const arm_nn_layer_q7 *pLayer = S->pLayers;
+    arm_status status = ARM_MATH_SUCCESS;
+    uint16_t  l;
+
+    for (l = 0; l < S->numLayers && status == ARM_MATH_SUCCESS; l++, pLayer++)
+    {
+        q7_t     *pIn = pArena + P->pTensorOffset[pLayer->in];
+        q7_t     *pOut = pArena + P->pTensorOffset[pLayer->out];
+        q15_t    *pBuffer = (q15_t *) (pArena + P->pScratchOffset[l]);
+        const q7_t *pWt = S->pWeights + pLayer->wtOffset;
+        const q7_t *pBias = S->pWeights + pLayer->biasOffset;
+
+        switch (pLayer->op)
+        {
+        case ARM_NN_CONV_HWC_Q7_BASIC:
+            status = arm_convolve_HWC_q7_basic(pIn, pLayer->dimIn, pLayer->chIn, pWt, pLayer->chOut,
+                                               pLayer->dimKernel, pLayer->padding, pLayer->stride, pBias,
+                                               pLayer->biasShift, pLayer->outShift, pOut, pLayer->dimOut,
+                                               pBuffer, NULL);
+            break;
+        case ARM_NN_CONV_HWC_Q7_FAST:
+            status = arm_convolve_HWC_q7_fast(pIn, pLayer->dimIn, pLayer->chIn, pWt, pLayer->chOut,
+                                              pLayer->dimKernel, pLayer->padding, pLayer->stride, pBias,
+                                              pLayer->biasShift, pLayer->outShift, pOut, pLayer->dimOut,
+                                              pBuffer, NULL);
+            break;
+        case ARM_NN_CONV_HWC_Q7_RGB:
+            status = arm_convolve_HWC_q7_RGB(pIn, pLayer->dimIn, pLayer->chIn, pWt, pLayer->chOut,
+                                             pLayer->dimKernel, pLayer->padding, pLayer->stride, pBias,
+                                             pLayer->biasShift, pLayer->outShift, pOut, pLayer->dimOut,
+                                             pBuffer, NULL);
+            break;
+        case ARM_NN_DEPTHWISE_CONV_HWC_Q7:
+            if (pLayer->dimKernel == 3 && (pLayer->stride == 1 || pLayer->stride == 2))
+            {
+                status = arm_depthwise_conv_3x3_HWC_q7(pIn, pLayer->dimIn, pLayer->chIn, pWt, pLayer->chOut,
+                                                       pLayer->padding, pLayer->stride, pBias, pLayer->biasShift,
+                                                       pLayer->outShift, pOut, pLayer->dimOut);
+            } else
+            {
+                status = arm_depthwise_conv_HWC_q7(pIn, pLayer->dimIn, pLayer->chIn, pWt, pLayer->chOut,
+                                                   pLayer->dimKernel, pLayer->padding, pLayer->stride, pBias,
+                                                   pLayer->biasShift, pLayer->outShift, pOut, pLayer->dimOut,
+                                                   pBuffer);
+            }
+            break;
+        case ARM_NN_RELU_Q7:
+            arm_relu_q7(pOut, pLayer->dimOut * pLayer->dimOut * pLayer->chOut);
+            break;
+        case ARM_NN_MAXPOOL_HWC_Q7:
+            arm_maxpool_q7_HWC(pIn, pLayer->dimIn, pLayer->chIn, pLayer->dimKernel, pLayer->padding,
+                               pLayer->stride, pLayer->dimOut, NULL, pOut);
+            break;
+        case ARM_NN_AVEPOOL_HWC_Q7:
+            arm_avepool_q7_HWC(pIn, pLayer->dimIn, pLayer->chIn, pLayer->dimKernel, pLayer->padding,
+                               pLayer->stride, pLayer->dimOut, (q7_t *) pBuffer, pOut);
+            break;
+        case ARM_NN_FULLY_CONNECTED_Q7:
+            status = arm_fully_connected_q7(pIn, pWt, pLayer->chIn, pLayer->chOut, pLayer->biasShift,
+                                            pLayer->outShift, pBias, pOut, pBuffer);
+            break;
+        case ARM_NN_FULLY_CONNECTED_Q7_OPT:
+            status = arm_fully_connected_q7_opt(pIn, pWt, pLayer->chIn, pLayer->chOut, pLayer->biasShift,
+                                                pLayer->outShift, pBias, pOut, pBuffer);
+            break;
+        case ARM_NN_SOFTMAX_Q7:
+            arm_softmax_q7(pIn, pLayer->dimIn * pLayer->dimIn * pLayer->chIn, pOut);
+            break;
+        case ARM_NN_CONV_HWC_Q7_WINOGRAD_F2:
+        case ARM_NN_CONV_HWC_Q7_WINOGRAD_F4:
+            status = arm_convolve_HWC_q7_winograd(pIn, pLayer->dimIn, pLayer->chIn, (const q15_t *) pWt,
+                                                  pLayer->chOut,
+                                                  pLayer->op == ARM_NN_CONV_HWC_Q7_WINOGRAD_F2 ? 2 : 4,
+                                                  pLayer->padding, pBias, pLayer->biasShift, pLayer->outShift,
+                                                  pOut, pLayer->dimOut, pBuffer);
+            break;
+        default:
+            status = ARM_MATH_ARGUMENT_ERROR;
+            break;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @} end of NNGraph group
+ */
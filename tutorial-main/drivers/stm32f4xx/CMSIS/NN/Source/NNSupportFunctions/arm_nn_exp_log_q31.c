@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_exp_log_q31.c
+ * Description:  Natural exponential and logarithm in fixed point
+ *
+ * $Date:        13. July 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ * @brief exp(x) in Q0.31 for x in [-1/4, 0), in Q0.31
+ *
+ * Taylor expansion of exp around -1/8 to the fourth order.
+ */
+
+static q31_t exp_on_interval_q31(q31_t x)
+{
+    const q31_t exp_minus_one_eighth = 1895147668;
+    const q31_t one_third = 715827883;
+    q31_t     x2, x3, x4, poly;
+
+    x = x + (1 << 28);
+    x2 = arm_nn_sat_doubling_high_mult(x, x);
+    x3 = arm_nn_sat_doubling_high_mult(x2, x);
+    x4 = arm_nn_sat_doubling_high_mult(x2, x2);
+
+    poly = arm_nn_divide_by_power_of_two(x4, 2);
+    poly = arm_nn_divide_by_power_of_two(arm_nn_sat_doubling_high_mult(poly + x3, one_third) + x2, 1);
+
+    return clip_q63_to_q31((q63_t) exp_minus_one_eighth + arm_nn_sat_doubling_high_mult(exp_minus_one_eighth, x + poly));
+}
+
+/**    
+ * @ingroup groupSupport    
+ */
+
+/**
+ * @addtogroup NNBasicMath
+ * @{
+ */
+
+/**
+ * @brief           exp(x) in Q0.31 for x <= 0 in Q5.26
+ * @param[in]       x             input value
+ * @return          the exponential
+ *
+ * The fraction modulo 1/4 goes through exp_on_interval_q31, and each set bit
+ * of the rest multiplies the result by a constant exp(-2^k).
+ */
+
+q31_t arm_nn_exp_on_negative_values(const q31_t x)
+{
+    static const q31_t exp_of_minus_pow2[7] = {
+        1672461947,             /* exp(-1/4) */
+        1302514674,             /* exp(-1/2) */
+        790015084,              /* exp(-1) */
+        290630308,              /* exp(-2) */
+        39332535,               /* exp(-4) */
+        720401,                 /* exp(-8) */
+        242                     /* exp(-16) */
+    };
+    const q31_t one_quarter = 1 << 24;
+    const q31_t x_mod_quarter_minus_quarter = (x & (one_quarter - 1)) - one_quarter;
+    const q31_t remainder = x_mod_quarter_minus_quarter - x;
+    q31_t     result = exp_on_interval_q31(x_mod_quarter_minus_quarter * 32);
+    int       i;
+
+    if (x == 0)
+    {
+        return 0x7FFFFFFF;
+    }
+
+    for (i = 0; i < 7; i++)
+    {
+        if (remainder & (1 << (24 + i)))
+        {
+            result = arm_nn_sat_doubling_high_mult(result, exp_of_minus_pow2[i]);
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief           Natural logarithm of a sum of Q0.31 values
+ * @param[in]       sum           non-zero sum, in Q0.31
+ * @return          ln(sum) in Q5.26
+ *
+ * The sum is normalized to f * 2^e with f in [sqrt(1/2), sqrt(2)), and
+ * ln(f) = 2 * atanh(u) with u = (f - 1) / (f + 1) is evaluated with the
+ * series u + u^3/3 + u^5/5 + u^7/7 + u^9/9. |u| is below 0.18, so the
+ * error is within a few LSBs of Q5.26. This takes one 64-bit division.
+ */
+
+q31_t arm_nn_log_of_sum(const uint64_t sum)
+{
+    const q31_t ln2 = 46516320;             /* ln(2) in Q5.26 */
+    const uint32_t sqrt_half = 3037000500u; /* sqrt(1/2) in Q0.32 */
+    const uint32_t high = (uint32_t) (sum >> 32);
+    int32_t   exponent;
+    uint32_t  m;
+    q31_t     f, u, u2, poly;
+
+    /* sum = m * 2^exponent with m in [1/2, 1) in Q0.32, and sum / 2^31 = m * 2^(exponent + 1) */
+    if (high)
+    {
+        int32_t   bits = 32 - __CLZ(high);
+
+        m = (uint32_t) (sum >> bits);
+        exponent = bits + 1;
+    }
+    else
+    {
+        int32_t   zeros = __CLZ((uint32_t) sum);
+
+        m = (uint32_t) sum << zeros;
+        exponent = 1 - zeros;
+    }
+
+    /* f in [sqrt(1/2), sqrt(2)) in Q2.30 */
+    if (m < sqrt_half)
+    {
+        f = (q31_t) (m >> 1);
+        exponent -= 1;
+    }
+    else
+    {
+        f = (q31_t) (m >> 2);
+    }
+
+    u = (q31_t) (((q63_t) (f - (1 << 30)) << 31) / ((q63_t) f + (1 << 30)));
+    u2 = arm_nn_sat_doubling_high_mult(u, u);
+
+    poly = 238609294;                       /* 1/9 */
+    poly = 306783378 + arm_nn_sat_doubling_high_mult(u2, poly);  /* 1/7 */
+    poly = 429496730 + arm_nn_sat_doubling_high_mult(u2, poly);  /* 1/5 */
+    poly = 715827883 + arm_nn_sat_doubling_high_mult(u2, poly);  /* 1/3 */
+    poly = u + arm_nn_sat_doubling_high_mult(arm_nn_sat_doubling_high_mult(u, u2), poly);
+
+    return exponent * ln2 + arm_nn_divide_by_power_of_two(poly, 4);
+}
+
+/**
+ * @} end of NNBasicMath group
+ */
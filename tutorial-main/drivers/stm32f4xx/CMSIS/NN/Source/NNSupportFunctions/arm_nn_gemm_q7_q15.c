@@ -0,0 +1,511 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_gemm_q7_q15.c
+ * Description:  Q7 x Q15 matrix multiplication over 4-row weight panels
+ *
+ * $Date:        13. July 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/*
+ * The weights are in the interleaved format of arm_fully_connected_q7_opt:
+ * each group of 4 rows is a panel that is read with a single pointer, and
+ * the left-over rows follow in their original order. A panel is used for
+ * all the columns of B before moving on to the next one.
+ */
+
+#if defined (ARM_MATH_DSP)
+
+/*
+ * 4 rows x 2 columns: each word of weights is sign-extended once and used
+ * for both columns.
+ */
+static void arm_nn_gemm_tile_4x2(const q7_t * pA,
+                                 const q15_t * pB,
+                                 const uint16_t num_col_A,
+                                 const q7_t * bias,
+                                 const uint16_t bias_shift,
+                                 const uint16_t out_shift,
+                                 q7_t * pOut,
+                                 const uint16_t num_row_A)
+{
+    const q15_t *pB2 = pB + num_col_A;
+    q7_t     *pOut2 = pOut + num_row_A;
+
+    q31_t     sum11 = ((q31_t)(bias[0]) << bias_shift) + NN_ROUND(out_shift);
+    q31_t     sum21 = ((q31_t)(bias[1]) << bias_shift) + NN_ROUND(out_shift);
+    q31_t     sum31 = ((q31_t)(bias[2]) << bias_shift) + NN_ROUND(out_shift);
+    q31_t     sum41 = ((q31_t)(bias[3]) << bias_shift) + NN_ROUND(out_shift);
+    q31_t     sum12 = sum11;
+    q31_t     sum22 = sum21;
+    q31_t     sum32 = sum31;
+    q31_t     sum42 = sum41;
+
+    uint16_t  colCnt = num_col_A >> 2;
+
+    while (colCnt)
+    {
+        q31_t     inA1, inA2;
+        q31_t     inB1 = *__SIMD32(pB)++;
+        q31_t     inB2 = *__SIMD32(pB2)++;
+
+        /* | a11 | a13 |, | a21 | a23 | with | b1 | b3 | of both columns */
+        pA = (q7_t *) read_and_pad_reordered((void *)pA, &inA1, &inA2);
+        sum11 = __SMLAD(inA1, inB1, sum11);
+        sum12 = __SMLAD(inA1, inB2, sum12);
+        sum21 = __SMLAD(inA2, inB1, sum21);
+        sum22 = __SMLAD(inA2, inB2, sum22);
+
+        pA = (q7_t *) read_and_pad_reordered((void *)pA, &inA1, &inA2);
+        sum31 = __SMLAD(inA1, inB1, sum31);
+        sum32 = __SMLAD(inA1, inB2, sum32);
+        sum41 = __SMLAD(inA2, inB1, sum41);
+        sum42 = __SMLAD(inA2, inB2, sum42);
+
+        /* | a12 | a14 |, | a22 | a24 | with | b2 | b4 | */
+        inB1 = *__SIMD32(pB)++;
+        inB2 = *__SIMD32(pB2)++;
+
+        pA = (q7_t *) read_and_pad_reordered((void *)pA, &inA1, &inA2);
+        sum11 = __SMLAD(inA1, inB1, sum11);
+        sum12 = __SMLAD(inA1, inB2, sum12);
+        sum21 = __SMLAD(inA2, inB1, sum21);
+        sum22 = __SMLAD(inA2, inB2, sum22);
+
+        pA = (q7_t *) read_and_pad_reordered((void *)pA, &inA1, &inA2);
+        sum31 = __SMLAD(inA1, inB1, sum31);
+        sum32 = __SMLAD(inA1, inB2, sum32);
+        sum41 = __SMLAD(inA2, inB1, sum41);
+        sum42 = __SMLAD(inA2, inB2, sum42);
+
+        colCnt--;
+    }
+
+    /* the left-over columns of A are in order, one value of each row */
+    colCnt = num_col_A & 0x3;
+    while (colCnt)
+    {
+        q15_t     inB1 = *pB++;
+        q15_t     inB2 = *pB2++;
+
+        sum11 += pA[0] * inB1;
+        sum12 += pA[0] * inB2;
+        sum21 += pA[1] * inB1;
+        sum22 += pA[1] * inB2;
+        sum31 += pA[2] * inB1;
+        sum32 += pA[2] * inB2;
+        sum41 += pA[3] * inB1;
+        sum42 += pA[3] * inB2;
+        pA += 4;
+        colCnt--;
+    }
+
+    pOut[0] = (q7_t) __SSAT((sum11 >> out_shift), 8);
+    pOut[1] = (q7_t) __SSAT((sum21 >> out_shift), 8);
+    pOut[2] = (q7_t) __SSAT((sum31 >> out_shift), 8);
+    pOut[3] = (q7_t) __SSAT((sum41 >> out_shift), 8);
+    pOut2[0] = (q7_t) __SSAT((sum12 >> out_shift), 8);
+    pOut2[1] = (q7_t) __SSAT((sum22 >> out_shift), 8);
+    pOut2[2] = (q7_t) __SSAT((sum32 >> out_shift), 8);
+    pOut2[3] = (q7_t) __SSAT((sum42 >> out_shift), 8);
+}
+
+/*
+ * 4 rows x 1 column, for the last column of an odd number of columns
+ */
+static void arm_nn_gemm_tile_4x1(const q7_t * pA,
+                                 const q15_t * pB,
+                                 const uint16_t num_col_A,
+                                 const q7_t * bias,
+                                 const uint16_t bias_shift,
+                                 const uint16_t out_shift,
+                                 q7_t * pOut)
+{
+    q31_t     sum = ((q31_t)(bias[0]) << bias_shift) + NN_ROUND(out_shift);
+    q31_t     sum2 = ((q31_t)(bias[1]) << bias_shift) + NN_ROUND(out_shift);
+    q31_t     sum3 = ((q31_t)(bias[2]) << bias_shift) + NN_ROUND(out_shift);
+    q31_t     sum4 = ((q31_t)(bias[3]) << bias_shift) + NN_ROUND(out_shift);
+
+    uint16_t  colCnt = num_col_A >> 2;
+
+    while (colCnt)
+    {
+        q31_t     inA1, inA2;
+        q31_t     inB = *__SIMD32(pB)++;
+
+        pA = (q7_t *) read_and_pad_reordered((void *)pA, &inA1, &inA2);
+        sum = __SMLAD(inA1, inB, sum);
+        sum2 = __SMLAD(inA2, inB, sum2);
+        pA = (q7_t *) read_and_pad_reordered((void *)pA, &inA1, &inA2);
+        sum3 = __SMLAD(inA1, inB, sum3);
+        sum4 = __SMLAD(inA2, inB, sum4);
+
+        inB = *__SIMD32(pB)++;
+
+        pA = (q7_t *) read_and_pad_reordered((void *)pA, &inA1, &inA2);
+        sum = __SMLAD(inA1, inB, sum);
+        sum2 = __SMLAD(inA2, inB, sum2);
+        pA = (q7_t *) read_and_pad_reordered((void *)pA, &inA1, &inA2);
+        sum3 = __SMLAD(inA1, inB, sum3);
+        sum4 = __SMLAD(inA2, inB, sum4);
+
+        colCnt--;
+    }
+
+    colCnt = num_col_A & 0x3;
+    while (colCnt)
+    {
+        q15_t     inB = *pB++;
+
+        sum += pA[0] * inB;
+        sum2 += pA[1] * inB;
+        sum3 += pA[2] * inB;
+        sum4 += pA[3] * inB;
+        pA += 4;
+        colCnt--;
+    }
+
+    pOut[0] = (q7_t) __SSAT((sum >> out_shift), 8);
+    pOut[1] = (q7_t) __SSAT((sum2 >> out_shift), 8);
+    pOut[2] = (q7_t) __SSAT((sum3 >> out_shift), 8);
+    pOut[3] = (q7_t) __SSAT((sum4 >> out_shift), 8);
+}
+
+/*
+ * 1 row x 2 columns, for the left-over rows
+ */
+static void arm_nn_gemm_tile_1x2(const q7_t * pA,
+                                 const q15_t * pB,
+                                 const uint16_t num_col_A,
+                                 const q7_t * bias,
+                                 const uint16_t bias_shift,
+                                 const uint16_t out_shift,
+                                 q7_t * pOut,
+                                 const uint16_t num_row_A)
+{
+    const q15_t *pB2 = pB + num_col_A;
+    q31_t     sum = ((q31_t)(bias[0]) << bias_shift) + NN_ROUND(out_shift);
+    q31_t     sum2 = sum;
+
+    uint16_t  colCnt = num_col_A >> 2;
+
+    while (colCnt)
+    {
+        q31_t     inA1, inA2;
+
+        pA = (q7_t *) read_and_pad_reordered((void *)pA, &inA1, &inA2);
+        sum = __SMLAD(inA1, *__SIMD32(pB)++, sum);
+        sum2 = __SMLAD(inA1, *__SIMD32(pB2)++, sum2);
+        sum = __SMLAD(inA2, *__SIMD32(pB)++, sum);
+        sum2 = __SMLAD(inA2, *__SIMD32(pB2)++, sum2);
+
+        colCnt--;
+    }
+
+    colCnt = num_col_A & 0x3;
+    while (colCnt)
+    {
+        q7_t      inA = *pA++;
+
+        sum += inA * *pB++;
+        sum2 += inA * *pB2++;
+        colCnt--;
+    }
+
+    pOut[0] = (q7_t) __SSAT((sum >> out_shift), 8);
+    pOut[num_row_A] = (q7_t) __SSAT((sum2 >> out_shift), 8);
+}
+
+/*
+ * 1 row x 1 column
+ */
+static void arm_nn_gemm_tile_1x1(const q7_t * pA,
+                                 const q15_t * pB,
+                                 const uint16_t num_col_A,
+                                 const q7_t * bias,
+                                 const uint16_t bias_shift,
+                                 const uint16_t out_shift,
+                                 q7_t * pOut)
+{
+    q31_t     sum = ((q31_t)(bias[0]) << bias_shift) + NN_ROUND(out_shift);
+
+    uint16_t  colCnt = num_col_A >> 2;
+
+    while (colCnt)
+    {
+        q31_t     inA1, inA2;
+
+        pA = (q7_t *) read_and_pad_reordered((void *)pA, &inA1, &inA2);
+        sum = __SMLAD(inA1, *__SIMD32(pB)++, sum);
+        sum = __SMLAD(inA2, *__SIMD32(pB)++, sum);
+
+        colCnt--;
+    }
+
+    colCnt = num_col_A & 0x3;
+    while (colCnt)
+    {
+        sum += *pA++ * *pB++;
+        colCnt--;
+    }
+
+    pOut[0] = (q7_t) __SSAT((sum >> out_shift), 8);
+}
+
+#else
+
+/*
+ * 4 rows x 1 column. The columns of B are in their original order.
+ */
+static void arm_nn_gemm_tile_4x1(const q7_t * pA,
+                                 const q15_t * pB,
+                                 const uint16_t num_col_A,
+                                 const q7_t * bias,
+                                 const uint16_t bias_shift,
+                                 const uint16_t out_shift,
+                                 q7_t * pOut)
+{
+    q31_t     sum = ((q31_t)(bias[0]) << bias_shift) + NN_ROUND(out_shift);
+    q31_t     sum2 = ((q31_t)(bias[1]) << bias_shift) + NN_ROUND(out_shift);
+    q31_t     sum3 = ((q31_t)(bias[2]) << bias_shift) + NN_ROUND(out_shift);
+    q31_t     sum4 = ((q31_t)(bias[3]) << bias_shift) + NN_ROUND(out_shift);
+
+    uint16_t  colCnt = num_col_A >> 2;
+
+    while (colCnt)
+    {
+        q15_t     inB1 = pB[0];
+        q15_t     inB2 = pB[1];
+        q15_t     inB3 = pB[2];
+        q15_t     inB4 = pB[3];
+
+        /* | a11 | a21 | a13 | a23 | a31 | a41 | a33 | a43 | a12 | a22 | a14 | a24 | a32 | a42 | a34 | a44 | */
+        sum += pA[0] * inB1 + pA[8] * inB2 + pA[2] * inB3 + pA[10] * inB4;
+        sum2 += pA[1] * inB1 + pA[9] * inB2 + pA[3] * inB3 + pA[11] * inB4;
+        sum3 += pA[4] * inB1 + pA[12] * inB2 + pA[6] * inB3 + pA[14] * inB4;
+        sum4 += pA[5] * inB1 + pA[13] * inB2 + pA[7] * inB3 + pA[15] * inB4;
+
+        pA += 16;
+        pB += 4;
+        colCnt--;
+    }
+
+    colCnt = num_col_A & 0x3;
+    while (colCnt)
+    {
+        q15_t     inB = *pB++;
+
+        sum += pA[0] * inB;
+        sum2 += pA[1] * inB;
+        sum3 += pA[2] * inB;
+        sum4 += pA[3] * inB;
+        pA += 4;
+        colCnt--;
+    }
+
+    pOut[0] = (q7_t) __SSAT((sum >> out_shift), 8);
+    pOut[1] = (q7_t) __SSAT((sum2 >> out_shift), 8);
+    pOut[2] = (q7_t) __SSAT((sum3 >> out_shift), 8);
+    pOut[3] = (q7_t) __SSAT((sum4 >> out_shift), 8);
+}
+
+/*
+ * 1 row x 1 column
+ */
+static void arm_nn_gemm_tile_1x1(const q7_t * pA,
+                                 const q15_t * pB,
+                                 const uint16_t num_col_A,
+                                 const q7_t * bias,
+                                 const uint16_t bias_shift,
+                                 const uint16_t out_shift,
+                                 q7_t * pOut)
+{
+    q31_t     sum = ((q31_t)(bias[0]) << bias_shift) + NN_ROUND(out_shift);
+    uint16_t  colCnt = num_col_A;
+
+    while (colCnt)
+    {
+        sum += *pA++ * *pB++;
+        colCnt--;
+    }
+
+    pOut[0] = (q7_t) __SSAT((sum >> out_shift), 8);
+}
+
+#endif                          /* ARM_MATH_DSP */
+
+  /**
+   * @brief Q7 x Q15 matrix multiplication with interleaved weights
+   * @param[in]       pA          pointer to operand A, interleaved by arm_nn_gemm_pack_q7
+   * @param[in]       pB          pointer to operand B, expanded by arm_nn_gemm_expand_q7
+   * @param[in]       num_row_A   numRow of A, i.e., number of outputs of each column
+   * @param[in]       num_col_A   numCol of A, i.e., length of each column of B
+   * @param[in]       num_col_B   numCol of B
+   * @param[in]       bias        pointer to bias
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for output
+   * @param[in,out]   pOut        pointer to output, num_row_A values for each column of B
+   * @return none.
+   *
+   * @details
+   *
+   * Each column of B and of the output is contiguous. The DSP version
+   * computes 4 rows x 2 columns at a time, so every weight is loaded and
+   * sign-extended once for two columns, where the fully-connected
+   * functions load it again for every input vector. The results are
+   * bit-exact with arm_fully_connected_q7 run on each column.
+   */
+
+void arm_nn_gemm_q7_q15(const q7_t * pA,
+                        const q15_t * pB,
+                        const uint16_t num_row_A,
+                        const uint16_t num_col_A,
+                        const uint16_t num_col_B,
+                        const q7_t * bias,
+                        const uint16_t bias_shift,
+                        const uint16_t out_shift,
+                        q7_t * pOut)
+{
+    const q7_t *pPanel = pA;
+    uint16_t  row, col;
+
+    for (row = 0; row + 4 <= num_row_A; row += 4)
+    {
+        col = 0;
+#if defined (ARM_MATH_DSP)
+        for (; col + 2 <= num_col_B; col += 2)
+        {
+            arm_nn_gemm_tile_4x2(pPanel, pB + col * num_col_A, num_col_A, bias + row, bias_shift, out_shift,
+                                 pOut + col * num_row_A + row, num_row_A);
+        }
+#endif
+        for (; col < num_col_B; col++)
+        {
+            arm_nn_gemm_tile_4x1(pPanel, pB + col * num_col_A, num_col_A, bias + row, bias_shift, out_shift,
+                                 pOut + col * num_row_A + row);
+        }
+        pPanel += 4 * num_col_A;
+    }
+
+    /* left-over rows, in their original order */
+    for (; row < num_row_A; row++)
+    {
+        col = 0;
+#if defined (ARM_MATH_DSP)
+        for (; col + 2 <= num_col_B; col += 2)
+        {
+            arm_nn_gemm_tile_1x2(pPanel, pB + col * num_col_A, num_col_A, bias + row, bias_shift, out_shift,
+                                 pOut + col * num_row_A + row, num_row_A);
+        }
+#endif
+        for (; col < num_col_B; col++)
+        {
+            arm_nn_gemm_tile_1x1(pPanel, pB + col * num_col_A, num_col_A, bias + row, bias_shift, out_shift,
+                                 pOut + col * num_row_A + row);
+        }
+        pPanel += num_col_A;
+    }
+}
+
+  /**
+   * @brief Expands the Q7 columns of operand B of arm_nn_gemm_q7_q15
+   * @param[in]       pSrc        pointer to the Q7 columns
+   * @param[in]       num_col_A   length of each column
+   * @param[in]       num_col_B   number of columns
+   * @param[out]      pDst        pointer to the Q15 columns
+   * @return none.
+   *
+   * @details
+   *
+   * With DSP, each column is reordered as by arm_q7_to_q15_reordered_no_shift,
+   * to match the sign-extension of the interleaved weights.
+   */
+
+void arm_nn_gemm_expand_q7(const q7_t * pSrc, const uint16_t num_col_A, const uint16_t num_col_B, q15_t * pDst)
+{
+    uint16_t  i;
+
+    for (i = 0; i < num_col_B; i++)
+    {
+#if defined (ARM_MATH_DSP)
+        arm_q7_to_q15_reordered_no_shift(pSrc, pDst, num_col_A);
+#else
+        arm_q7_to_q15_no_shift(pSrc, pDst, num_col_A);
+#endif
+        pSrc += num_col_A;
+        pDst += num_col_A;
+    }
+}
+
+  /**
+   * @brief Interleaves a Q7 weight matrix for arm_nn_gemm_q7_q15
+   * @param[in]       wt          pointer to the weights, one row after the other
+   * @param[in]       num_row     number of rows
+   * @param[in]       num_col     number of columns
+   * @param[out]      wt_out      pointer to the num_row*num_col interleaved weights
+   * @return none.
+   *
+   * @details
+   *
+   * This is the format of arm_fully_connected_q7_opt, as written by
+   * convert_to_x4_q7_weights of fully_connected_opt_weight_generation.py.
+   * Convolution weights are packed with one row per output channel.
+   */
+
+void arm_nn_gemm_pack_q7(const q7_t * wt, const uint16_t num_row, const uint16_t num_col, q7_t * wt_out)
+{
+    uint16_t  row, col;
+
+    for (row = 0; row + 4 <= num_row; row += 4)
+    {
+        const q7_t *pRow = wt + row * num_col;
+
+        for (col = 0; col + 4 <= num_col; col += 4)
+        {
+            uint16_t  i;
+
+            /* columns 1 and 3, then 2 and 4, of rows 1 and 2, then 3 and 4 */
+            for (i = 0; i < 16; i++)
+            {
+                uint16_t  r = (i & 0x1) + ((i >> 1) & 0x2);
+                uint16_t  c = (i & 0x2) + ((i >> 3) & 0x1);
+
+                *wt_out++ = pRow[r * num_col + col + c];
+            }
+        }
+        for (; col < num_col; col++)
+        {
+            *wt_out++ = pRow[col];
+            *wt_out++ = pRow[num_col + col];
+            *wt_out++ = pRow[2 * num_col + col];
+            *wt_out++ = pRow[3 * num_col + col];
+        }
+    }
+
+    /* the left-over rows are in order */
+    memcpy(wt_out, wt + row * num_col, (num_row - row) * num_col);
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_maxpool_scatter_q7.c
+ * Description:  Q7 max pooling of one pixel for fused layers
+ *
+ * $Date:        13. July 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+
+/**    
+ * @ingroup groupSupport    
+ */
+
+/**
+ * @addtogroup NNBasicMath
+ * @{
+ */
+
+/**
+ * @brief           Q7 max pooling of one pixel into the pooling windows that contain it
+ * @param[in]       *pSrc         pointer to the ch_im_in channels of the pixel
+ * @param[in]       ch_im_in      number of channels
+ * @param[in]       x             column of the pixel in the pooling input
+ * @param[in]       y             row of the pixel in the pooling input
+ * @param[in]       dim_kernel    pooling kernel size
+ * @param[in]       padding       pooling padding size
+ * @param[in]       stride        pooling stride
+ * @param[in]       dim_im_out    pooling output dimension
+ * @param[in,out]   *pDst         pointer to the pooling output
+ * @return none.
+ *
+ * The pooling output is initialized by the caller, and holds the maximum
+ * of all pixels pooled so far in each window.
+ *
+ * Output i pools the inputs i * stride - padding to i * stride - padding + dim_kernel - 1,
+ * clipped to the input, as in arm_maxpool_q7_HWC. Pooling every pixel of the input
+ * in any order gives the same result as arm_maxpool_q7_HWC without padding.
+ */
+
+void arm_nn_maxpool_scatter_q7(
+  const q7_t * pSrc,
+  const uint16_t ch_im_in,
+  const int16_t x,
+  const int16_t y,
+  const uint16_t dim_kernel,
+  const uint16_t padding,
+  const uint16_t stride,
+  const uint16_t dim_im_out,
+  q7_t * pDst)
+{
+    int16_t   x_first, x_last, y_first, y_last;
+    int16_t   i_x, i_y;
+    int16_t   n;
+
+    /* first and last output window that contain the pixel */
+    n = x + padding - dim_kernel + 1;
+    x_first = n <= 0 ? 0 : (n + stride - 1) / stride;
+    x_last = (x + padding) / stride;
+    if (x_last >= dim_im_out)
+    {
+        x_last = dim_im_out - 1;
+    }
+
+    n = y + padding - dim_kernel + 1;
+    y_first = n <= 0 ? 0 : (n + stride - 1) / stride;
+    y_last = (y + padding) / stride;
+    if (y_last >= dim_im_out)
+    {
+        y_last = dim_im_out - 1;
+    }
+
+    for (i_y = y_first; i_y <= y_last; i_y++)
+    {
+        for (i_x = x_first; i_x <= x_last; i_x++)
+        {
+            const q7_t *pIn = pSrc;
+            q7_t     *pOut = pDst + (i_y * dim_im_out + i_x) * ch_im_in;
+            uint16_t  cnt = ch_im_in;
+
+            while (cnt > 0u)
+            {
+                if (*pIn > *pOut)
+                {
+                    *pOut = *pIn;
+                }
+                pIn++;
+                pOut++;
+                cnt--;
+            }
+        }
+    }
+}
+
+/**
+ * @} end of NNBasicMath group
+ */
@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_quantize_s8.c
+ * Description:  Conversion of float weights to per-channel quantized int8
+ *
+ * $Date:        13. July 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNQuant
+ * @{
+ */
+
+  /**
+   * @brief Converts a positive real multiplier to a Q31 multiplier and a shift
+   * @param[in]       real        real multiplier
+   * @param[out]      pMult       Q31 multiplier, in the range [0.5, 1)
+   * @param[out]      pShift      amount of left-shift if positive, of right-shift if negative
+   * @return none.
+   *
+   * @details
+   *
+   * real equals pMult / 2^31 * 2^pShift, which is the multiplier and shift
+   * taken by arm_nn_requantize. Multipliers below 2^-32 and non-positive
+   * multipliers give zero.
+   *
+   */
+
+void arm_nn_quantize_multiplier(const float64_t real, q31_t * pMult, int32_t * pShift)
+{
+    int       shift;
+    q63_t     mult;
+
+    if (real <= 0.0)
+    {
+        *pMult = 0;
+        *pShift = 0;
+        return;
+    }
+
+    mult = (q63_t) round(frexp(real, &shift) * 2147483648.0);
+    if (mult == (1LL << 31))
+    {
+        mult /= 2;
+        shift++;
+    }
+    if (shift < -31)
+    {
+        mult = 0;
+        shift = 0;
+    }
+
+    *pMult = (q31_t) mult;
+    *pShift = shift;
+}
+
+  /**
+   * @brief Quantizes float weights and bias per output channel
+   * @param[in]       pW            pointer to the float weights
+   * @param[in]       pBias         pointer to the float bias
+   * @param[in]       num_ch        number of output channels
+   * @param[in]       ch_size       number of weights of each output channel
+   * @param[in]       interleaved   0 if the weights of a channel are contiguous, 1 if the channel is the fastest index
+   * @param[in]       input_scale   scale of the input tensor
+   * @param[in]       output_scale  scale of the output tensor
+   * @param[out]      pWOut         pointer to the int8 weights, in the same order as pW
+   * @param[out]      pBiasOut      pointer to the Q31 bias
+   * @param[out]      pMult         pointer to the per-channel output multipliers
+   * @param[out]      pShift        pointer to the per-channel output shifts
+   * @return     The function returns either
+   * <code>ARM_MATH_ARGUMENT_ERROR</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of argument checking.
+   *
+   * @details
+   *
+   * The weights of each channel are quantized symmetrically to [-127, 127]
+   * with the scale max(|w|) / 127, and the bias with the scale input_scale
+   * times the weight scale. The multiplier and shift of each channel are
+   * input_scale * weight scale / output_scale.
+   *
+   * The convolution and fully-connected weights are contiguous per channel,
+   * interleaved is 0. The depthwise weights are interleaved, with the channel
+   * as the fastest index.
+   *
+   * The outputs are the parameters of arm_convolve_HWC_s8,
+   * arm_depthwise_conv_HWC_s8 and arm_fully_connected_s8. The input and output
+   * offsets are the negated input zero point and the output zero point.
+   *
+   */
+
+arm_status arm_nn_quantize_weights_s8(const float32_t * pW,
+                                      const float32_t * pBias,
+                                      const uint16_t num_ch,
+                                      const uint32_t ch_size,
+                                      const uint16_t interleaved,
+                                      const float32_t input_scale,
+                                      const float32_t output_scale,
+                                      q7_t * pWOut,
+                                      q31_t * pBiasOut,
+                                      q31_t * pMult,
+                                      int32_t * pShift)
+{
+    uint16_t  i;
+    uint32_t  j;
+
+    if (input_scale <= 0.0f || output_scale <= 0.0f)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    for (i = 0; i < num_ch; i++)
+    {
+        const uint32_t start = interleaved ? i : i * ch_size;
+        const uint32_t step = interleaved ? num_ch : 1;
+        float64_t max = 0.0;
+        float64_t w_scale, b;
+
+        for (j = 0; j < ch_size; j++)
+        {
+            float64_t w = fabs(pW[start + j * step]);
+
+            if (w > max)
+            {
+                max = w;
+            }
+        }
+
+        /* all-zero channels keep a unit scale */
+        w_scale = max > 0.0 ? max / 127.0 : 1.0;
+
+        for (j = 0; j < ch_size; j++)
+        {
+            float64_t w = round(pW[start + j * step] / w_scale);
+
+            w = w > 127.0 ? 127.0 : w;
+            w = w < -127.0 ? -127.0 : w;
+            pWOut[start + j * step] = (q7_t) w;
+        }
+
+        b = round(pBias[i] / (input_scale * w_scale));
+        b = b > 2147483647.0 ? 2147483647.0 : b;
+        b = b < -2147483648.0 ? -2147483648.0 : b;
+        pBiasOut[i] = (q31_t) b;
+
+        arm_nn_quantize_multiplier(input_scale * w_scale / output_scale, &pMult[i], &pShift[i]);
+    }
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of NNQuant group
+ */
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_q15_to_q15_reordered.c
+ * Description:  Reorders the elements of a Q15 vector for the Q7 x Q15 dot products
+ *
+ * $Date:        13. July 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnsupportfunctions.h"
+
+/**    
+ * @ingroup groupSupport    
+ */
+
+/**    
+ * @addtogroup nndata_convert    
+ * @{    
+ */
+
+/**    
+ * @brief Reorders the elements of a Q15 vector for arm_nn_dot4_q7_q15_reordered
+ * @param[in]       *pSrc points to the Q15 input vector    
+ * @param[out]      *pDst points to the Q15 output vector   
+ * @param[in]       blockSize length of the input vector    
+ * @return none.    
+ *    
+ * @details
+ *
+ * Every 4 elements
+ *
+ * <pre>
+ *  |   A1   |   A2   |   A3   |   A4   |
+ * </pre>
+ *
+ * are stored as
+ *
+ * <pre>
+ *  |   A1   |   A3   |   A2   |   A4   |
+ * </pre>
+ *
+ * which is the order of the Q7 weights expanded by read_and_pad_reordered, so
+ * the products need no repacking. The tail (i.e., last (N % 4) elements) stays
+ * in original order. Without ARM_MATH_DSP the vector is copied unchanged.
+ *   
+ */
+
+void arm_q15_to_q15_reordered(const q15_t * pSrc, q15_t * pDst, uint32_t blockSize)
+{
+    const q15_t *pIn = pSrc;    /* Src pointer */
+    uint32_t  blkCnt;           /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+    blkCnt = blockSize >> 2u;
+
+    while (blkCnt > 0u)
+    {
+        pDst[0] = pIn[0];
+        pDst[1] = pIn[2];
+        pDst[2] = pIn[1];
+        pDst[3] = pIn[3];
+        pIn += 4;
+        pDst += 4;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    blkCnt = blockSize % 0x4u;
+
+#else
+
+    /* Run the below code for Cortex-M0 and Cortex-M3 */
+
+    blkCnt = blockSize;
+
+#endif                          /* ARM_MATH_DSP */
+
+    while (blkCnt > 0u)
+    {
+        *pDst++ = *pIn++;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+}
+
+/**    
+ * @} end of nndata_convert group    
+ */
@@ -79,6 +79,17 @@ static void compare_and_replace_if_larger_q7(q7_t * base,   // base data
 
         cnt--;
     }
+    cnt = length & 0x3;
+    while (cnt > 0u)
+    {
+        if (*pCom > *pIn)
+        {
+            *pIn = *pCom;
+        }
+        pIn++;
+        pCom++;
+        cnt--;
+    }
 }
 
 static void accumulate_q7_to_q15(q15_t * base, q7_t * target, const uint16_t length)
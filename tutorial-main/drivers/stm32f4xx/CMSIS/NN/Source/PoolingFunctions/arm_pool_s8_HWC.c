@@ -0,0 +1,214 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_pool_s8_HWC.c
+ * Description:  Pooling functions for per-channel quantized int8 tensors
+ *
+ * $Date:        13. July 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup Pooling
+ * @{
+ */
+
+  /**
+   * @brief int8 max pooling function
+   * @param[in]       Im_in       pointer to input tensor
+   * @param[in]       dim_im_in   input tensor dimention
+   * @param[in]       ch_im_in    number of input tensor channels
+   * @param[in]       dim_kernel  filter kernel size
+   * @param[in]       padding     padding sizes
+   * @param[in]       stride      convolution stride
+   * @param[in]       dim_im_out  output tensor dimension
+   * @param[in]       act_min     minimum output value
+   * @param[in]       act_max     maximum output value
+   * @param[in,out]   Im_out      pointer to output tensor
+   * @return none.
+   *
+   * @details
+   *
+   * The input and output have the same scale and zero point, so the pooling
+   * needs no requantization. Unlike arm_maxpool_q7_HWC, the input is not
+   * modified. The outputs are clamped to [act_min, act_max], which fuses
+   * a ReLU when act_min is the zero point.
+   *
+   */
+
+void
+arm_maxpool_s8_HWC(const q7_t * Im_in,
+                   const uint16_t dim_im_in,
+                   const uint16_t ch_im_in,
+                   const uint16_t dim_kernel,
+                   const uint16_t padding,
+                   const uint16_t stride,
+                   const uint16_t dim_im_out,
+                   const int32_t act_min,
+                   const int32_t act_max,
+                   q7_t * Im_out)
+{
+    int16_t   i_x, i_y, k_x, k_y;
+    uint16_t  i_ch;
+    q7_t     *pOut = Im_out;
+
+    for (i_y = 0; i_y < dim_im_out; i_y++)
+    {
+        /* the window is clipped to the input, so the taps need no bounds check */
+        const int16_t y_start = i_y * stride - padding < 0 ? 0 : i_y * stride - padding;
+        const int16_t y_end = i_y * stride - padding + dim_kernel > dim_im_in ?
+            dim_im_in : i_y * stride - padding + dim_kernel;
+
+        for (i_x = 0; i_x < dim_im_out; i_x++)
+        {
+            const int16_t x_start = i_x * stride - padding < 0 ? 0 : i_x * stride - padding;
+            const int16_t x_end = i_x * stride - padding + dim_kernel > dim_im_in ?
+                dim_im_in : i_x * stride - padding + dim_kernel;
+
+            memcpy(pOut, Im_in + (y_start * dim_im_in + x_start) * ch_im_in, ch_im_in);
+
+            for (k_y = y_start; k_y < y_end; k_y++)
+            {
+                for (k_x = x_start; k_x < x_end; k_x++)
+                {
+                    const q7_t *pIn = Im_in + (k_y * dim_im_in + k_x) * ch_im_in;
+                    q7_t     *pMax = pOut;
+
+                    i_ch = ch_im_in;
+                    while (i_ch > 0u)
+                    {
+                        const q7_t in = *pIn++;
+
+                        *pMax = in > *pMax ? in : *pMax;
+                        pMax++;
+                        i_ch--;
+                    }
+                }
+            }
+
+            for (i_ch = 0; i_ch < ch_im_in; i_ch++)
+            {
+                q31_t     max = pOut[i_ch];
+
+                max = max < act_min ? act_min : max;
+                max = max > act_max ? act_max : max;
+                pOut[i_ch] = (q7_t) max;
+            }
+            pOut += ch_im_in;
+        }
+    }
+}
+
+  /**
+   * @brief int8 average pooling function
+   * @param[in]       Im_in       pointer to input tensor
+   * @param[in]       dim_im_in   input tensor dimention
+   * @param[in]       ch_im_in    number of input tensor channels
+   * @param[in]       dim_kernel  filter kernel size
+   * @param[in]       padding     padding sizes
+   * @param[in]       stride      convolution stride
+   * @param[in]       dim_im_out  output tensor dimension
+   * @param[in]       act_min     minimum output value
+   * @param[in]       act_max     maximum output value
+   * @param[in,out]   bufferA     pointer to buffer space for the sums
+   * @param[in,out]   Im_out      pointer to output tensor
+   * @return none.
+   *
+   * @details
+   *
+   * <b>Buffer size:</b>
+   *
+   * bufferA size: 2*ch_im_in
+   *
+   * The average is over the window taps inside the input, rounded to the
+   * nearest with ties away from zero. The input and output have the same
+   * scale and zero point, and the outputs are clamped to [act_min, act_max].
+   *
+   */
+
+void
+arm_avepool_s8_HWC(const q7_t * Im_in,
+                   const uint16_t dim_im_in,
+                   const uint16_t ch_im_in,
+                   const uint16_t dim_kernel,
+                   const uint16_t padding,
+                   const uint16_t stride,
+                   const uint16_t dim_im_out,
+                   const int32_t act_min,
+                   const int32_t act_max,
+                   q15_t * bufferA,
+                   q7_t * Im_out)
+{
+    int16_t   i_x, i_y, k_x, k_y;
+    uint16_t  i_ch;
+    q31_t    *pSum = (q31_t *) bufferA;
+    q7_t     *pOut = Im_out;
+
+    for (i_y = 0; i_y < dim_im_out; i_y++)
+    {
+        for (i_x = 0; i_x < dim_im_out; i_x++)
+        {
+            q31_t     count = 0;
+
+            memset(pSum, 0, ch_im_in * sizeof(q31_t));
+
+            for (k_y = i_y * stride - padding; k_y < i_y * stride - padding + dim_kernel; k_y++)
+            {
+                for (k_x = i_x * stride - padding; k_x < i_x * stride - padding + dim_kernel; k_x++)
+                {
+                    if (k_y >= 0 && k_x >= 0 && k_y < dim_im_in && k_x < dim_im_in)
+                    {
+                        const q7_t *pIn = Im_in + (k_y * dim_im_in + k_x) * ch_im_in;
+
+                        for (i_ch = 0; i_ch < ch_im_in; i_ch++)
+                        {
+                            pSum[i_ch] += pIn[i_ch];
+                        }
+                        count++;
+                    }
+                }
+            }
+
+            for (i_ch = 0; i_ch < ch_im_in; i_ch++)
+            {
+                q31_t     sum = pSum[i_ch];
+                q31_t     avg = (sum > 0 ? sum + count / 2 : sum - count / 2) / count;
+
+                avg = avg < act_min ? act_min : avg;
+                avg = avg > act_max ? act_max : avg;
+                *pOut++ = (q7_t) avg;
+            }
+        }
+    }
+}
+
+/**
+ * @} end of Pooling group
+ */
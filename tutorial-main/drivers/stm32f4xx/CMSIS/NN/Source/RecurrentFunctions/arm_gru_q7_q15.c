@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_gru_q7_q15.c
+ * Description:  Mixed Q15-Q7 gated recurrent unit (GRU) layer
+ *
+ * $Date:        13. July 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNRecurrent
+ * @{
+ */
+
+  /**
+   * @brief Mixed Q15-Q7 GRU layer function
+   * @param[in]       pInput      pointer to the input sequence, seq_len vectors of dim_input
+   * @param[in]       seq_len     number of time steps
+   * @param[in]       dim_input   length of the input vector
+   * @param[in]       dim_hidden  length of the hidden state
+   * @param[in]       pWeight     pointer to the concatenated weights of the update, reset and candidate gates
+   * @param[in]       pBias       pointer to the concatenated bias of the update, reset and candidate gates
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for the gate pre-activations
+   * @param[in]       int_width   bit-width of the integer part of the pre-activations, at most 3
+   * @param[in,out]   pHidden     pointer to the hidden state, updated in place
+   * @param[out]      pOutput     pointer to the hidden state of every step, seq_len vectors of dim_hidden, or NULL
+   * @param[in,out]   bufferA     pointer to buffer space for the gates
+   * @return     The function returns either
+   * <code>ARM_MATH_ARGUMENT_ERROR</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of argument checking.
+   *
+   * @details
+   *
+   * <b>Buffer size:</b>
+   *
+   * bufferA size: dim_input + 3*dim_hidden
+   *
+   * Each step computes
+   * <pre>
+   * z = sigmoid(W_z &sdot; {x, h} + b_z)
+   * r = sigmoid(W_r &sdot; {x, h} + b_r)
+   * n = tanh(W_n &sdot; {x, r &times; h} + b_n)
+   * h = z &times; n + (1 - z) &times; h </pre>
+   *
+   * pWeight holds W_z, W_r and W_n one after the other. Each is a row-major
+   * dim_hidden x (dim_input + dim_hidden) Q7 matrix whose first dim_input
+   * columns multiply the input. pBias holds b_z, b_r and b_n.
+   *
+   * The results are identical to the composition of the GRU example, i.e.
+   * arm_fully_connected_mat_q7_vec_q15 per gate followed by
+   * arm_nn_activations_direct_q15, arm_mult_q15, arm_offset_q15 and
+   * arm_sub_q15, with the same shifts. Unlike in the example, the columns
+   * of W_n multiply {x, r &times; h} in that order, as for the other gates.
+   *
+   * The update and reset gates of a row are computed in one pass over the
+   * input and the hidden state, and the candidate gate in a second pass
+   * that also updates the hidden state. The activations and the element-wise
+   * operations are applied to each accumulator directly, so the gates need no
+   * buffers of their own.
+   */
+
+arm_status arm_gru_q7_q15(const q15_t * pInput,
+                          const uint16_t seq_len,
+                          const uint16_t dim_input,
+                          const uint16_t dim_hidden,
+                          const q7_t * pWeight,
+                          const q7_t * pBias,
+                          const uint16_t bias_shift,
+                          const uint16_t out_shift,
+                          const uint16_t int_width,
+                          q15_t * pHidden,
+                          q15_t * pOutput,
+                          q15_t * bufferA)
+{
+    const uint32_t dim_vec = dim_input + dim_hidden;
+    const q7_t *pWz = pWeight;
+    const q7_t *pWr = pWz + dim_hidden * dim_vec;
+    const q7_t *pWn = pWr + dim_hidden * dim_vec;
+    const q7_t *pBz = pBias;
+    const q7_t *pBr = pBz + dim_hidden;
+    const q7_t *pBn = pBr + dim_hidden;
+    q15_t    *pX = bufferA;
+    q15_t    *pV = pX + dim_input;
+    q15_t    *pRH = pV + dim_hidden;
+    q15_t    *pZ = pRH + dim_hidden;
+    uint16_t  step;
+    int       j, k;
+
+    if (int_width > 3)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    for (step = 0; step < seq_len; step++)
+    {
+        arm_q15_to_q15_reordered(pInput + step * dim_input, pX, dim_input);
+        arm_q15_to_q15_reordered(pHidden, pV, dim_hidden);
+
+        /* update and reset gates, two units at a time */
+        for (j = 0; j < dim_hidden; j += 2)
+        {
+            const int units = dim_hidden - j < 2 ? 1 : 2;
+            const q7_t *pW[4];
+            q31_t     sum[4];
+
+            for (k = 0; k < 2; k++)
+            {
+                const int row = j + (k < units ? k : 0);
+
+                pW[2 * k] = pWz + row * dim_vec;
+                pW[2 * k + 1] = pWr + row * dim_vec;
+                sum[2 * k] = ((q31_t)pBz[row] << bias_shift) + NN_ROUND(out_shift);
+                sum[2 * k + 1] = ((q31_t)pBr[row] << bias_shift) + NN_ROUND(out_shift);
+            }
+
+            arm_nn_dot4_q7_q15_reordered(pX, pW, dim_input, sum);
+            for (k = 0; k < 4; k++)
+            {
+                pW[k] += dim_input;
+            }
+            arm_nn_dot4_q7_q15_reordered(pV, pW, dim_hidden, sum);
+
+            for (k = 0; k < units; k++)
+            {
+                q15_t     r = arm_nn_activation_q15((q15_t) __SSAT((sum[2 * k + 1] >> out_shift), 16),
+                                                    sigmoidTable_q15, int_width);
+
+                pZ[j + k] = arm_nn_activation_q15((q15_t) __SSAT((sum[2 * k] >> out_shift), 16),
+                                                  sigmoidTable_q15, int_width);
+                pRH[j + k] = (q15_t) __SSAT((((q31_t) pHidden[j + k] * r) >> 15), 16);
+            }
+        }
+
+        /* the candidate gate reads r x h in place of h */
+        arm_q15_to_q15_reordered(pRH, pV, dim_hidden);
+
+        /* candidate gate and new hidden state, four units at a time */
+        for (j = 0; j < dim_hidden; j += 4)
+        {
+            const int units = dim_hidden - j < 4 ? dim_hidden - j : 4;
+            const q7_t *pW[4];
+            q31_t     sum[4];
+
+            for (k = 0; k < 4; k++)
+            {
+                const int row = j + (k < units ? k : 0);
+
+                pW[k] = pWn + row * dim_vec;
+                sum[k] = ((q31_t)pBn[row] << bias_shift) + NN_ROUND(out_shift);
+            }
+
+            arm_nn_dot4_q7_q15_reordered(pX, pW, dim_input, sum);
+            for (k = 0; k < 4; k++)
+            {
+                pW[k] += dim_input;
+            }
+            arm_nn_dot4_q7_q15_reordered(pV, pW, dim_hidden, sum);
+
+            for (k = 0; k < units; k++)
+            {
+                q15_t     n = arm_nn_activation_q15((q15_t) __SSAT((sum[k] >> out_shift), 16), tanhTable_q15,
+                                                    int_width);
+                q15_t     z = pZ[j + k];
+                q15_t     h = pHidden[j + k];
+                q31_t     zn = __SSAT((((q31_t) z * n) >> 15), 16);
+                /* (1 - z) x h is computed as -((z - 1) x h) */
+                q31_t     zh = __SSAT((((q31_t) h * __SSAT((q31_t) z - 0x8000, 16)) >> 15), 16);
+
+                pHidden[j + k] = (q15_t) __SSAT(zn - zh, 16);
+            }
+        }
+
+        if (pOutput)
+        {
+            memcpy(pOutput + step * dim_hidden, pHidden, dim_hidden * sizeof(q15_t));
+        }
+    }
+
+    /* Return to application */
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of NNRecurrent group
+ */
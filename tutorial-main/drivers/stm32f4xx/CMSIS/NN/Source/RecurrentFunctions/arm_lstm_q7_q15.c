@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_lstm_q7_q15.c
+ * Description:  Mixed Q15-Q7 long short-term memory (LSTM) layer
+ *
+ * $Date:        13. July 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNRecurrent
+ * @{
+ */
+
+  /**
+   * @brief Mixed Q15-Q7 LSTM layer function
+   * @param[in]       pInput      pointer to the input sequence, seq_len vectors of dim_input
+   * @param[in]       seq_len     number of time steps
+   * @param[in]       dim_input   length of the input vector
+   * @param[in]       dim_hidden  length of the hidden and cell states
+   * @param[in]       pWeight     pointer to the concatenated weights of the input, forget, cell and output gates
+   * @param[in]       pBias       pointer to the concatenated bias of the input, forget, cell and output gates
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for the gate pre-activations
+   * @param[in]       int_width   bit-width of the integer part of the pre-activations and the cell state, at most 3
+   * @param[in,out]   pHidden     pointer to the hidden state, updated in place
+   * @param[in,out]   pCell       pointer to the cell state, updated in place
+   * @param[out]      pOutput     pointer to the hidden state of every step, seq_len vectors of dim_hidden, or NULL
+   * @param[in,out]   bufferA     pointer to buffer space for the input and hidden vectors
+   * @return     The function returns either
+   * <code>ARM_MATH_ARGUMENT_ERROR</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of argument checking.
+   *
+   * @details
+   *
+   * <b>Buffer size:</b>
+   *
+   * bufferA size: dim_input + dim_hidden
+   *
+   * Each step computes
+   * <pre>
+   * i = sigmoid(W_i &sdot; {x, h} + b_i)
+   * f = sigmoid(W_f &sdot; {x, h} + b_f)
+   * g = tanh(W_g &sdot; {x, h} + b_g)
+   * o = sigmoid(W_o &sdot; {x, h} + b_o)
+   * c = f &times; c + i &times; g
+   * h = o &times; tanh(c) </pre>
+   *
+   * pWeight holds W_i, W_f, W_g and W_o one after the other. Each is a
+   * row-major dim_hidden x (dim_input + dim_hidden) Q7 matrix whose first
+   * dim_input columns multiply the input. pBias holds b_i, b_f, b_g and b_o.
+   *
+   * The gates are in Q15 and the cell state has int_width integer bits, like
+   * the pre-activations. The products are truncated as by arm_mult_q15 and
+   * i &times; g is shifted right by int_width before the saturating addition.
+   *
+   * All four gates of a row are computed in one pass over the input and the
+   * hidden state, and the states of the row are updated right away.
+   */
+
+arm_status arm_lstm_q7_q15(const q15_t * pInput,
+                           const uint16_t seq_len,
+                           const uint16_t dim_input,
+                           const uint16_t dim_hidden,
+                           const q7_t * pWeight,
+                           const q7_t * pBias,
+                           const uint16_t bias_shift,
+                           const uint16_t out_shift,
+                           const uint16_t int_width,
+                           q15_t * pHidden,
+                           q15_t * pCell,
+                           q15_t * pOutput,
+                           q15_t * bufferA)
+{
+    const uint32_t dim_vec = dim_input + dim_hidden;
+    const uint32_t gate_size = dim_hidden * dim_vec;
+    q15_t    *pX = bufferA;
+    q15_t    *pV = pX + dim_input;
+    uint16_t  step;
+    int       j;
+
+    if (int_width > 3)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    for (step = 0; step < seq_len; step++)
+    {
+        arm_q15_to_q15_reordered(pInput + step * dim_input, pX, dim_input);
+        arm_q15_to_q15_reordered(pHidden, pV, dim_hidden);
+
+        for (j = 0; j < dim_hidden; j++)
+        {
+            const q7_t *pW[4];
+            q31_t     sum[4];
+            q15_t     i, f, g, o, c;
+            int       k;
+
+            /* the four gates of one unit share the vector loads */
+            for (k = 0; k < 4; k++)
+            {
+                pW[k] = pWeight + k * gate_size + j * dim_vec;
+                sum[k] = ((q31_t)pBias[k * dim_hidden + j] << bias_shift) + NN_ROUND(out_shift);
+            }
+
+            arm_nn_dot4_q7_q15_reordered(pX, pW, dim_input, sum);
+            for (k = 0; k < 4; k++)
+            {
+                pW[k] += dim_input;
+            }
+            arm_nn_dot4_q7_q15_reordered(pV, pW, dim_hidden, sum);
+
+            i = arm_nn_activation_q15((q15_t) __SSAT((sum[0] >> out_shift), 16), sigmoidTable_q15, int_width);
+            f = arm_nn_activation_q15((q15_t) __SSAT((sum[1] >> out_shift), 16), sigmoidTable_q15, int_width);
+            g = arm_nn_activation_q15((q15_t) __SSAT((sum[2] >> out_shift), 16), tanhTable_q15, int_width);
+            o = arm_nn_activation_q15((q15_t) __SSAT((sum[3] >> out_shift), 16), sigmoidTable_q15, int_width);
+
+            c = (q15_t) __SSAT((((q31_t) f * pCell[j]) >> 15) + (((q31_t) i * g) >> (15 + int_width)), 16);
+            pCell[j] = c;
+            pHidden[j] = (q15_t) __SSAT((((q31_t) o * arm_nn_activation_q15(c, tanhTable_q15, int_width)) >> 15), 16);
+        }
+
+        if (pOutput)
+        {
+            memcpy(pOutput + step * dim_hidden, pHidden, dim_hidden * sizeof(q15_t));
+        }
+    }
+
+    /* Return to application */
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of NNRecurrent group
+ */
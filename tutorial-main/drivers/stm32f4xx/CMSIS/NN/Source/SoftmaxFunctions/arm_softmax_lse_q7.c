@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_softmax_lse_q7.c
+ * Description:  Q7 softmax function with a natural exponential
+ *
+ * $Date:        13. July 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup Softmax
+ * @{
+ */
+
+  /**
+   * @brief Q7 log-sum-exp softmax function
+   * @param[in]       vec_in      pointer to input vector
+   * @param[in]       dim_vec     input vector dimention
+   * @param[in]       int_width   bit-width of the integer part of the input, at most 4
+   * @param[out]      p_out       pointer to output vector
+   * @return none.
+   *
+   * @details
+   *
+   *  Unlike arm_softmax_q7, this is the natural exponent based softmax
+   *  of the fixed-point input
+   *
+   *  y_i = e^(x_i) / sum(e^x_j) = e^(x_i - max - ln(sum(e^(x_j - max))))
+   *
+   *  The sum of the exponentials is taken in 64 bits, so there is no
+   *  limit on the range of the input or on dim_vec. Its logarithm is
+   *  subtracted from the exponents, so each output is one more
+   *  exponential and no division. The output is in Q0.7 and within
+   *  one LSB of the float softmax.
+   *
+   */
+
+void arm_softmax_lse_q7(const q7_t * vec_in, const uint32_t dim_vec, const uint16_t int_width, q7_t * p_out)
+{
+    /* amount of left-shift of the input differences to Q5.26 */
+    const int32_t shift = 19 + int_width;
+    uint64_t  sum = 0;
+    q31_t     max = vec_in[0];
+    q31_t     lse;
+    uint32_t  i;
+
+    for (i = 1; i < dim_vec; i++)
+    {
+        if (vec_in[i] > max)
+        {
+            max = vec_in[i];
+        }
+    }
+
+    for (i = 0; i < dim_vec; i++)
+    {
+        sum += (uint32_t) arm_nn_exp_on_negative_values((vec_in[i] - max) * (1 << shift));
+    }
+
+    /* the sum is at least e^0 = 1, up to the rounding of 0x7FFFFFFF */
+    lse = arm_nn_log_of_sum(sum);
+    lse = lse > 0 ? lse : 0;
+
+    for (i = 0; i < dim_vec; i++)
+    {
+        q31_t     diff = __QSUB((vec_in[i] - max) * (1 << shift), lse);
+        q31_t     out = 0;
+
+        /* below e^-6, the output rounds to zero */
+        if (diff >= -(6 << 26))
+        {
+            out = arm_nn_divide_by_power_of_two(arm_nn_exp_on_negative_values(diff), 24);
+        }
+        p_out[i] = (q7_t) __SSAT(out, 8);
+    }
+}
+
+/**
+ * @} end of Softmax group
+ */
@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_softmax_s8.c
+ * Description:  int8 softmax function with a natural exponential
+ *
+ * $Date:        13. July 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup Softmax
+ * @{
+ */
+
+  /**
+   * @brief int8 softmax function
+   * @param[in]       vec_in      pointer to input vector
+   * @param[in]       dim_vec     input vector dimention
+   * @param[in]       input_mult  multiplier of the input differences
+   * @param[in]       input_shift amount of left-shift of the input differences
+   * @param[out]      p_out       pointer to output vector
+   * @return none.
+   *
+   * @details
+   *
+   *  Unlike arm_softmax_q7, this is the natural exponent based softmax
+   *
+   *  y_i = e^(s*x_i) / sum(e^(s*x_j))
+   *
+   *  where s is the input scale. input_mult and input_shift are
+   *  arm_nn_quantize_multiplier of s*2^26, i.e., they convert the difference
+   *  of an input with the maximum to Q5.26. The output scale is 1/256 and
+   *  the output zero point is -128, so the output is within one LSB of the
+   *  float softmax. Inputs more than 31/s below the maximum give -128.
+   *
+   *  s is at most 16. The sum of the exponentials is kept in 64 bits, as
+   *  4096 equal inputs already sum to 2^31 in Q12.19.
+   *
+   */
+
+void arm_softmax_s8(const q7_t * vec_in, const uint16_t dim_vec, const q31_t input_mult, const int32_t input_shift,
+                    q7_t * p_out)
+{
+    const q31_t diff_min = -(q31_t) (((q63_t) 31 << 26) >> input_shift);
+    q63_t     sum = 0;
+    q31_t     max = -128;
+    int32_t   i;
+
+    for (i = 0; i < dim_vec; i++)
+    {
+        if (vec_in[i] > max)
+        {
+            max = vec_in[i];
+        }
+    }
+
+    /* sum of the exponentials in Q12.19 */
+    for (i = 0; i < dim_vec; i++)
+    {
+        q31_t     diff = vec_in[i] - max;
+
+        if (diff >= diff_min)
+        {
+            diff = arm_nn_requantize(diff, input_mult, input_shift);
+            sum += arm_nn_divide_by_power_of_two(arm_nn_exp_on_negative_values(diff), 12);
+        }
+    }
+
+    for (i = 0; i < dim_vec; i++)
+    {
+        q31_t     diff = vec_in[i] - max;
+        q31_t     out = -128;
+
+        if (diff >= diff_min)
+        {
+            q31_t     exp_q19;
+
+            diff = arm_nn_requantize(diff, input_mult, input_shift);
+            exp_q19 = arm_nn_divide_by_power_of_two(arm_nn_exp_on_negative_values(diff), 12);
+
+            out = (q31_t) ((((q63_t) exp_q19 << 8) + (sum >> 1)) / sum) - 128;
+            out = out > 127 ? 127 : out;
+        }
+        p_out[i] = (q7_t) out;
+    }
+}
+
+/**
+ * @} end of Softmax group
+ */